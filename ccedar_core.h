@@ -50,6 +50,10 @@ namespace ccedar {
     da () : _bheadF (0), _bheadC (0), _bheadO (0), _capacity (0), _size (0), _ok ()
     { _initialize (); }
     ~da () { clear (); }
+    // bytes allocated for _array, _ninfo and _block
+    size_t array_bytes () const { return sizeof (node)  * _array.capacity (); }
+    size_t ninfo_bytes () const { return sizeof (ninfo) * _ninfo.capacity (); }
+    size_t block_bytes () const { return sizeof (block) * _block.capacity (); }
     // interfance
     template <typename T>
     T exactMatchSearch (const key_type* key) const
@@ -132,6 +136,15 @@ namespace ccedar {
       //_no_delete = true;
     }
     const void* array () const { return _array.data(); }
+    size_t size () const { return static_cast <size_t> (_size); }
+    // read-only from here: release the update-only _ninfo and _block and
+    // trim _array to the used blocks; no update () after this
+    void freeze () {
+      std::vector<node> (_array.begin (), _array.begin () + _size).swap (_array);
+      std::vector<ninfo> ().swap (_ninfo);
+      std::vector<block> ().swap (_block);
+      _capacity = _size;
+    }
     void clear (const bool reuse = true) {
       //if (_array && ! _no_delete) std::free (_array);
       //if (_ninfo) std::free (_ninfo);
@@ -75,6 +75,10 @@ namespace cedar {
     size_t size       () const { return static_cast <size_t> (_size); }
     size_t total_size () const { return sizeof (node) * _size; }
     size_t unit_size  () const { return sizeof (node); }
+    // bytes allocated for _array, _ninfo and _block
+    size_t array_bytes () const { return _array ? sizeof (node)  * static_cast <size_t> (_capacity) : 0; }
+    size_t ninfo_bytes () const { return _ninfo ? sizeof (ninfo) * static_cast <size_t> (_capacity) : 0; }
+    size_t block_bytes () const { return _block ? sizeof (block) * static_cast <size_t> (_capacity >> 8) : 0; }
     size_t nonzero_size () const {
       size_t i = 0;
       for (int to = 0; to < _size; ++to)
@@ -305,6 +309,16 @@ namespace cedar {
       _no_delete = true;
     }
     const void* array () const { return _array; }
+    // read-only from here: release the update-only _ninfo and _block and
+    // trim _array to the used blocks (update () restores them on demand)
+    void freeze () {
+      if (_ninfo) std::free (_ninfo);
+      if (_block) std::free (_block);
+      _ninfo = 0; _block = 0;
+      if (_array && ! _no_delete && _size < _capacity)
+        _realloc_array (_array, _size, _size);
+      _capacity = _size;
+    }
     void clear (const bool reuse = true) {
       if (_array && ! _no_delete) std::free (_array);
       if (_ninfo) std::free (_ninfo);
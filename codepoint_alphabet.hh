@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace nanotokenizer {
+
+// Dense trie labels for the codepoints of a vocab.
+//
+// A codepoint trie indexed by raw codepoints needs a 2^21 label space and
+// spreads the children of a node(e.g. CJK ideographs) over a wide range of
+// double-array slots. Instead, each codepoint is spelled with
+// `label_bits`-bit labels:
+//
+//   - ASCII keeps its own value as the label [1, 127], so the most frequent
+//     characters need no table lookup,
+//   - the other codepoints of the vocab are numbered by frequency and the
+//     most frequent get one label [128, 128 + num_direct),
+//   - the rest an escape label [128 + num_direct, 2^label_bits) followed by
+//     a second label [1, 2^label_bits).
+//
+// Label 0 is left to the trie(terminal). Codepoints not in the vocab have no
+// labels: no token can contain them. Covers U+0000 - U+10FFFF.
+//
+// The labels of a codepoint are packed in one 32 bit code,
+// `first | (second << 16)`(second = 0 for one label). It is below 2^31:
+// with at most kMaxSymbols codepoints, 16-bit labels never need an escape.
+class CodepointAlphabet {
+ public:
+  static constexpr uint32_t kMaxCodepoint = 0x10FFFF;
+  static constexpr uint32_t kNumAscii = 128;
+  static constexpr uint32_t kPageBits = 8;
+  static constexpr uint32_t kMaxSymbols = 0xFFFF - (kNumAscii - 1);  // non-ASCII
+
+  // `counts`: codepoint -> number of occurrences in the vocab.
+  bool build(const std::unordered_map<uint32_t, size_t> &counts,
+             int label_bits, std::string &err) {
+    clear();
+    if ((label_bits < 8) || (label_bits > 16)) {
+      err += "label_bits must be in [8, 16].\n";
+      return false;
+    }
+
+    std::vector<std::pair<size_t, uint32_t>> order;  // (count, codepoint)
+    order.reserve(counts.size());
+    for (const auto &it : counts) {
+      if (it.first > kMaxCodepoint) {
+        err += "Codepoint exceeds U+10FFFF.\n";
+        return false;
+      }
+      if (it.first >= kNumAscii) {
+        order.push_back({it.second, it.first});
+      }
+    }
+    if (order.size() > kMaxSymbols) {
+      err += "Too many distinct codepoints in the vocab.\n";
+      return false;
+    }
+    // most frequent first, ties by codepoint.
+    std::sort(order.begin(), order.end(),
+              [](const std::pair<size_t, uint32_t> &a,
+                 const std::pair<size_t, uint32_t> &b) {
+                return (a.first != b.first) ? (a.first > b.first)
+                                            : (a.second < b.second);
+              });
+
+    const size_t n = order.size();
+    _num_labels = 1u << label_bits;  // including 0
+    const uint32_t m = _num_labels - 1;  // usable labels
+    const uint32_t free_labels = m - (kNumAscii - 1);  // after ASCII
+    if (n <= free_labels) {
+      _num_direct = uint32_t(n);
+    } else {
+      // smallest number of escape labels `e` with
+      // (free_labels - e) + e * m >= n
+      const size_t e = (n - free_labels + (m - 2)) / (m - 1);
+      if (e >= free_labels) {
+        err += "Too many distinct codepoints for " +
+               std::to_string(label_bits) + "-bit labels.\n";
+        return false;
+      }
+      _num_direct = free_labels - uint32_t(e);
+    }
+
+    // two-level codepoint -> packed labels table. Page 0 stays all
+    // zero(absent). Packed at build time: no division on lookup.
+    _page_index.assign((kMaxCodepoint >> kPageBits) + 1, 0);
+    _pages.assign(size_t(1) << kPageBits, 0);
+    for (size_t s = 0; s < n; s++) {
+      const uint32_t cp = order[s].second;
+      uint16_t &page = _page_index[cp >> kPageBits];
+      if (page == 0) {
+        page = uint16_t(_pages.size() >> kPageBits);
+        _pages.resize(_pages.size() + (size_t(1) << kPageBits), 0);
+      }
+      _pages[(size_t(page) << kPageBits) | (cp & ((1u << kPageBits) - 1))] =
+          pack(uint32_t(s + 1));
+    }
+    _pages.shrink_to_fit();
+    _size = uint32_t(n);
+    return true;
+  }
+
+  void clear() {
+    _page_index.clear();
+    _pages.clear();
+    _size = 0;
+    _num_direct = 0;
+    _num_labels = 0;
+  }
+
+  // Packed labels of codepoint `cp`, 0 when it is not in the alphabet.
+  uint32_t code(uint32_t cp) const {
+    if (cp < kNumAscii) {
+      return cp;  // 0(NUL) is not in the trie
+    }
+    if ((cp > kMaxCodepoint) || _page_index.empty()) {
+      return 0;
+    }
+    return _pages[(size_t(_page_index[cp >> kPageBits]) << kPageBits) |
+                  (cp & ((1u << kPageBits) - 1))];
+  }
+
+  // Unpack `code`(> 0) to `lab`. Returns the number of labels(1 or 2).
+  static uint32_t labels(uint32_t code, int lab[2]) {
+    lab[0] = int(code & 0xFFFF);
+    lab[1] = int(code >> 16);
+    return (lab[1] != 0) ? 2 : 1;
+  }
+
+  // Number of non-ASCII codepoints in the alphabet.
+  size_t size() const { return _size; }
+
+  // Number of symbols spelled with one label.
+  size_t num_direct() const { return _num_direct; }
+
+  size_t memory_usage() const {
+    return _page_index.capacity() * sizeof(uint16_t) +
+           _pages.capacity() * sizeof(uint32_t);
+  }
+
+ private:
+  // Labels of non-ASCII `symbol`(1: the most frequent), packed.
+  uint32_t pack(uint32_t symbol) const {
+    if (symbol <= _num_direct) {
+      return kNumAscii - 1 + symbol;
+    }
+    const uint32_t r = symbol - _num_direct - 1;
+    return (kNumAscii + _num_direct + r / (_num_labels - 1)) |
+           ((1 + r % (_num_labels - 1)) << 16);
+  }
+
+  std::vector<uint16_t> _page_index;  // cp >> kPageBits -> page
+  std::vector<uint32_t> _pages;       // packed labels, 2^kPageBits per page
+  uint32_t _size{0};
+  uint32_t _num_direct{0};
+  uint32_t _num_labels{0};
+};
+
+}  // namespace nanotokenizer
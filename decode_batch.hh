@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace nanotokenizer {
+
+namespace detail {
+
+// Run `fn(t)` for t in [0, num_threads) on separate threads.
+template <class Fn>
+void parallel_for_blocks(uint32_t num_threads, const Fn &fn) {
+  if (num_threads == 1) {
+    fn(0);
+    return;
+  }
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads);
+  for (uint32_t t = 0; t < num_threads; t++) {
+    workers.emplace_back(fn, t);
+  }
+  for (auto &w : workers) {
+    w.join();
+  }
+}
+
+} // namespace detail
+
+// Decode many id sequences at once into one contiguous buffer.
+//
+// Sequences are given in CSR form: sequence `s` is
+// `ids[id_offsets[s], id_offsets[s + 1])`. On success `out` holds all
+// decoded strings back to back and sequence `s` is
+// `out[out_offsets[s], out_offsets[s + 1])`.
+//
+// Works with any tokenizer providing thread-safe const
+// `decoded_length(ids, n, len)` and `decode_into(ids, n, out, cap, out_len)`.
+// Sequences are split into `num_threads` blocks of roughly equal id count.
+// Output offsets are computed with a parallel prefix sum(per-block scan,
+// scan of block totals, per-block fixup), then every block decodes straight
+// into its region of `out`.
+template <class Tokenizer>
+bool decode_batch(const Tokenizer &tokenizer, const int *ids,
+                  const size_t *id_offsets, size_t nseq,
+                  std::vector<size_t> &out_offsets, std::string &out,
+                  uint32_t num_threads = 0) {
+  out_offsets.assign(nseq + 1, 0);
+  out.clear();
+  if (nseq == 0) {
+    return true;
+  }
+
+  if (num_threads == 0) {
+    num_threads = (std::max)(1u, std::thread::hardware_concurrency());
+  }
+
+  // Small batches are not worth spawning threads.
+  const size_t kMinIdsPerThread = 16 * 1024;
+  const size_t total_ids = id_offsets[nseq] - id_offsets[0];
+  num_threads = uint32_t((std::min)(
+      size_t(num_threads),
+      (std::max)(size_t(1), total_ids / kMinIdsPerThread)));
+  num_threads = uint32_t((std::min)(size_t(num_threads), nseq));
+
+  // Block `t` covers sequences [block_begin[t], block_begin[t + 1]).
+  std::vector<size_t> block_begin(num_threads + 1, nseq);
+  block_begin[0] = 0;
+  for (uint32_t t = 1; t < num_threads; t++) {
+    size_t target = id_offsets[0] + (total_ids * t) / num_threads;
+    size_t s = size_t(std::lower_bound(id_offsets, id_offsets + nseq, target) -
+                      id_offsets);
+    block_begin[t] = (std::max)(block_begin[t - 1], s);
+  }
+
+  std::vector<size_t> block_sum(num_threads, 0);
+  std::vector<char> block_ok(num_threads, 1);
+
+  // pass 1: per-block inclusive scan of decoded lengths.
+  detail::parallel_for_blocks(num_threads, [&](uint32_t t) {
+    size_t acc = 0;
+    for (size_t s = block_begin[t]; s < block_begin[t + 1]; s++) {
+      size_t len;
+      if (!tokenizer.decoded_length(ids + id_offsets[s],
+                                    id_offsets[s + 1] - id_offsets[s], len)) {
+        block_ok[t] = 0;
+        return;
+      }
+      acc += len;
+      out_offsets[s + 1] = acc;
+    }
+    block_sum[t] = acc;
+  });
+
+  size_t base = 0;
+  for (uint32_t t = 0; t < num_threads; t++) {
+    if (!block_ok[t]) {
+      return false;
+    }
+    size_t sum = block_sum[t];
+    block_sum[t] = base;  // exclusive scan of block totals
+    base += sum;
+  }
+
+  out.resize(base);
+  if (base == 0) {
+    return true;
+  }
+
+  // pass 2: add block base to offsets, then decode into place.
+  // `cap` is limited to each sequence's own region so no write crosses into
+  // a region owned by another thread.
+  char *dst = &out[0];
+  detail::parallel_for_blocks(num_threads, [&](uint32_t t) {
+    const size_t block_base = block_sum[t];
+    for (size_t s = block_begin[t]; s < block_begin[t + 1]; s++) {
+      out_offsets[s + 1] += block_base;
+    }
+    size_t begin = block_base;
+    for (size_t s = block_begin[t]; s < block_begin[t + 1]; s++) {
+      const size_t cap = out_offsets[s + 1] - begin;
+      size_t len;
+      if (!tokenizer.decode_into(ids + id_offsets[s],
+                                 id_offsets[s + 1] - id_offsets[s],
+                                 dst + begin, cap, len) ||
+          (len != cap)) {
+        block_ok[t] = 0;
+        return;
+      }
+      begin = out_offsets[s + 1];
+    }
+  });
+
+  for (uint32_t t = 0; t < num_threads; t++) {
+    if (!block_ok[t]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace nanotokenizer
@@ -0,0 +1,157 @@
+# MIT license
+# Copyright 2024-Present Light Transport Entertainment Inc.
+#
+# Generate benchmark corpora and golden pretokenizer splits(testdata/) with
+# the reference regex(`regex` module, as in qwen2-test.py).
+#
+#   testdata/<corpus>.txt           : UTF-8 text
+#   testdata/<corpus>.<model>.golden: byte length of each word, one per line
+#
+# Models and split regexes are read from pretokenizer-models.txt.
+# Consecutive lines of the same model are applied in order, each keeping
+# unmatched text as a word(HuggingFace `Split` with `Isolated` behavior).
+#
+# $ make gen-golden
+#
+import os
+import random
+import sys
+
+import regex as re
+
+CORPUS_BYTES = 48 * 1024
+
+ENGLISH = [
+    "The quick brown fox jumps over the lazy dog.",
+    "It's 12:30, isn't it? I'll say we'd've gone.",
+    "SHE'S HERE, THEY'LL COME, WE'RE LATE, I'M SURE, YOU'VE SEEN IT, HE'D KNOW.",
+    "Tokenization converts raw text into integer identifiers understood by language models.",
+    "In 1969, 600 million people watched; 3.14159 is pi, and 1,000,000 is a million.",
+    "\"Quoted,\" she said -- (parenthetical) [bracketed] {braced} <angled>...",
+    "Email: someone@example.com, URL: https://example.org/path?query=1&x=2#frag",
+    "Price: $19.99 (save 25%!) -- limited offer #42 * conditions apply ^_^",
+    "rock'n'roll, o'clock, 'quoted', ''double'', James' book and the '90s",
+    "Mr. Smith went to Washington D.C. on Jan. 3rd, 2024.",
+]
+
+CJK = [
+    "吾輩は猫である。名前はまだ無い。",
+    "どこで生れたかとんと見当がつかぬ。",
+    "天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。",
+    "東京都渋谷区1丁目2番3号、電話０３－１２３４－５６７８。",
+    "今日は2024年1月1日です。気温は１５度。",
+    "한국어 텍스트도 포함됩니다. 서울특별시 123번지.",
+    "「かぎかっこ」『二重かぎ』（括弧）【隅付き】〜波ダッシュ〜",
+    "カタカナとひらがなと漢字が混ざった文章ｶﾀｶﾅ半角も。",
+    "中文和English混合的句子，还有数字42和符号！",
+    "　全角スペース　で区切られた　テキスト",
+]
+
+CODE = [
+    "    for (size_t i = 0; i < n; i++) {\n        sum += a[i] * 2;\n    }\n",
+    "def tokenize(text: str) -> list[int]:\n    return [ord(c) for c in text if c.isalnum()]\n",
+    "\t\treturn EXIT_SUCCESS;\n\t}\n",
+    "#include <vector>\r\n#include \"nanopretokenizer.hh\"\r\n",
+    "                if (configuration_parameters.enable_vectorization) {\n",
+    "const x = {a: 1, b: [2, 3], 'c': \"4\"};  // comment\n",
+    "SELECT id, name FROM users WHERE age >= 18 AND name LIKE '%son';\n",
+    "0x7FFFFFFF, 1e-9, 3.0f, 0b1010, 1_000_000, -42\n",
+    "  }\n\n\n  // trailing spaces   \n",
+    "<div class=\"container\"><span id='x'>&nbsp;&lt;tag&gt;</span></div>\n",
+]
+
+EMOJI = [
+    "🤩🤩 Ça va? ",
+    "👨‍👩‍👧‍👦 family, 👍🏽 thumbs, 🏳️‍🌈 flag, 🇯🇵🇺🇸 flags",
+    "I ❤️ NY! ☕️+🍰=😋",
+    "🚀🚀🚀 launch at 10:00 🕙",
+    "emoji✨inside✨words and 1️⃣2️⃣3️⃣ keycaps",
+    "🙂 🙃 😉 😊 😇",
+    "math: ∑ ∫ √ ∞ ≠ ≤ ≥ → ←",
+    "naïve café résumé Ångström",
+    "Привет, мир! Как дела?",
+    "مرحبا بالعالم ١٢٣",
+]
+
+WHITESPACE = [
+    " ", "  ", "   ", "\t", "\t\t", "\n", "\n\n", "\r\n", "\r", " \n", "\n ", "  \n  ",
+    " ", "　", " ", "  ", "\u000B", "\u000C", "\u0085",
+    "a", "A", "word", "x1", "12", "1234567", "'s", "'S", "'ll", "'LL", "'", "''",
+    "!", "?!", "...", "-", "́", "é", "​", "‍", "é", "漢", "😀",
+]
+
+
+def make_sentences(pieces, rng, separators):
+    out = []
+    size = 0
+    while size < CORPUS_BYTES:
+        s = rng.choice(pieces) + rng.choice(separators)
+        out.append(s)
+        size += len(s.encode('utf-8'))
+    return ''.join(out)
+
+
+def make_corpora():
+    rng = random.Random(20240601)
+    return [
+        ('english', make_sentences(ENGLISH, rng, [' ', ' ', '\n', '  ', '\n\n'])),
+        ('cjk', make_sentences(CJK, rng, ['', '\n', ' '])),
+        ('code', make_sentences(CODE, rng, [''])),
+        ('emoji', make_sentences(EMOJI, rng, [' ', '\n', ''])),
+        ('whitespace', make_sentences(WHITESPACE, rng, [''])),
+    ]
+
+
+def read_models(filename):
+    models = []
+    with open(filename, encoding='utf-8') as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if not line or line.startswith('#'):
+                continue
+            name, pattern = line.split('\t', 1)
+            if models and models[-1][0] == name:
+                models[-1][1].append(pattern)
+            else:
+                models.append((name, [pattern]))
+    return models
+
+
+def split(patterns, text):
+    words = [text]
+    for pattern in patterns:
+        pat = re.compile(pattern)
+        next_words = []
+        for word in words:
+            pos = 0
+            for m in pat.finditer(word):
+                if m.start() > pos:
+                    next_words.append(word[pos:m.start()])
+                if m.end() > m.start():
+                    next_words.append(m.group())
+                pos = m.end()
+            if pos < len(word):
+                next_words.append(word[pos:])
+        words = next_words
+    return words
+
+
+def main():
+    outdir = sys.argv[1] if len(sys.argv) > 1 else 'testdata'
+    os.makedirs(outdir, exist_ok=True)
+
+    models = read_models(os.path.join(os.path.dirname(os.path.abspath(__file__)), 'pretokenizer-models.txt'))
+    for corpus_name, text in make_corpora():
+        with open(os.path.join(outdir, corpus_name + '.txt'), 'w', encoding='utf-8', newline='') as f:
+            f.write(text)
+        for model_name, patterns in models:
+            words = split(patterns, text)
+            assert ''.join(words) == text
+            with open(os.path.join(outdir, '%s.%s.golden' % (corpus_name, model_name)), 'w') as f:
+                for w in words:
+                    f.write('%d\n' % len(w.encode('utf-8')))
+            print('%s/%s: %d bytes, %d words' % (corpus_name, model_name, len(text.encode('utf-8')), len(words)))
+
+
+if __name__ == '__main__':
+    main()
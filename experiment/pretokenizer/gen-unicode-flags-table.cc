@@ -0,0 +1,202 @@
+// MIT license
+// Copyright 2024-Present Light Transport Entertainment Inc.
+//
+// Generate two-stage codepoint tables(unicode-flags-table.cc) from
+// unicode-data.cc and unicode-letter-data.cc.
+//
+//   flags(cp) = stage2[(stage1[cp >> BLOCK_BITS] << BLOCK_BITS) | (cp & BLOCK_MASK)]
+//
+// Identical blocks are shared, so the table is a small fraction of a
+// 0x110000 entry array. Lowercase and NFD mappings are stored as deltas
+// (mapped - cp) so that e.g. all of A-Z share one value.
+//
+// $ make gen
+//
+#include <cassert>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "unicode-data.hh"
+#include "unicode-util.hh"
+
+using namespace nanotokenizer;
+
+static std::vector<uint16_t> unicode_cpt_flags_array() {
+    std::vector<codepoint_flags> cpt_flags(MAX_CODEPOINTS, codepoint_flags::UNDEFINED);
+
+    assert (unicode_ranges_flags.begin()[0].first == 0);
+    assert (unicode_ranges_flags.begin()[unicode_ranges_flags.size()-1].first == MAX_CODEPOINTS);
+    for (size_t i = 1; i < unicode_ranges_flags.size(); ++i) {
+        const auto range_ini = unicode_ranges_flags.begin()[i-1];  // codepoint_ini, flags
+        const auto range_end = unicode_ranges_flags.begin()[i];    // codepoint_end, flags
+        for (uint32_t cpt = range_ini.first; cpt < range_end.first; ++cpt) {
+            cpt_flags[cpt] = range_ini.second;
+        }
+    }
+
+    // subcategory of the letters of unicode-data.cc. A letter unknown to the
+    // subcategory data(other Unicode version) is Lo, so \p{L} stays the
+    // union of \p{Lu} \p{Ll} \p{Lt} \p{Lm} \p{Lo}.
+    assert (unicode_ranges_letter_type.begin()[0].first == 0);
+    assert (unicode_ranges_letter_type.begin()[unicode_ranges_letter_type.size()-1].first == MAX_CODEPOINTS);
+    for (size_t i = 1; i < unicode_ranges_letter_type.size(); ++i) {
+        const auto range_ini = unicode_ranges_letter_type.begin()[i-1];
+        const auto range_end = unicode_ranges_letter_type.begin()[i];
+        for (uint32_t cpt = range_ini.first; cpt < range_end.first; ++cpt) {
+            if (cpt_flags[cpt].is_letter) {
+                cpt_flags[cpt].letter_type = range_ini.second ? range_ini.second : uint16_t(codepoint_flags::LETTER_OTHER);
+            }
+        }
+    }
+
+    for (auto cpt : unicode_set_whitespace) {
+        cpt_flags[cpt].is_whitespace = true;
+    }
+
+    for (auto p : unicode_map_lowercase) {
+        cpt_flags[p.second].is_lowercase = true;
+    }
+
+    for (auto p : unicode_map_uppercase) {
+        cpt_flags[p.second].is_uppercase = true;
+    }
+
+    for (auto &range : unicode_ranges_nfd) {  // start, last, nfd
+        cpt_flags[range.nfd].is_nfd = true;
+    }
+
+    std::vector<uint16_t> result(MAX_CODEPOINTS);
+    for (size_t i = 0; i < MAX_CODEPOINTS; i++) {
+        result[i] = cpt_flags[i].as_uint();
+    }
+    return result;
+}
+
+// Mapping of each codepoint as `mapped - cp`.
+static std::vector<int32_t> unicode_lowercase_delta_array() {
+    std::vector<int32_t> result(MAX_CODEPOINTS, 0);
+    for (auto p : unicode_map_lowercase) {
+        result[p.first] = int32_t(p.second) - int32_t(p.first);
+    }
+    return result;
+}
+
+static std::vector<int32_t> unicode_nfd_delta_array() {
+    std::vector<int32_t> result(MAX_CODEPOINTS, 0);
+    for (auto &range : unicode_ranges_nfd) {  // start, last, nfd
+        for (uint32_t cpt = range.first; cpt <= range.last; ++cpt) {
+            result[cpt] = int32_t(range.nfd) - int32_t(cpt);
+        }
+    }
+    return result;
+}
+
+template<typename T>
+struct two_stage_table {
+    std::vector<uint16_t> stage1;
+    std::vector<T> stage2;
+    size_t num_blocks;
+
+    size_t bytes() const {
+        return stage1.size() * sizeof(uint16_t) + stage2.size() * sizeof(T);
+    }
+};
+
+template<typename T>
+static bool build_two_stage(const std::vector<T> & values, two_stage_table<T> & table) {
+    const uint32_t block_size = 1u << UNICODE_FLAGS_BLOCK_BITS;
+    const uint32_t nblocks = MAX_CODEPOINTS / block_size;
+
+    table.stage1.assign(nblocks, 0);
+    table.stage2.clear();
+    std::map<std::vector<T>, uint16_t> block_ids;
+
+    for (uint32_t b = 0; b < nblocks; b++) {
+        std::vector<T> block(values.begin() + b * block_size,
+                             values.begin() + (b + 1) * block_size);
+        auto it = block_ids.find(block);
+        if (it == block_ids.end()) {
+            if (block_ids.size() >= 65536) {
+                fprintf(stderr, "Too many unique blocks\n");
+                return false;
+            }
+            uint16_t id = uint16_t(block_ids.size());
+            it = block_ids.emplace(block, id).first;
+            table.stage2.insert(table.stage2.end(), block.begin(), block.end());
+        }
+        table.stage1[b] = it->second;
+    }
+    table.num_blocks = block_ids.size();
+    return true;
+}
+
+static void write_stage1(FILE *fp, const char *name, const std::vector<uint16_t> & stage1) {
+    fprintf(fp, "const uint16_t %s[%d] = {\n", name, int(stage1.size()));
+    for (size_t i = 0; i < stage1.size(); i++) {
+        fprintf(fp, "%d,%s", int(stage1[i]), ((i % 16) == 15) ? "\n" : "");
+    }
+    fprintf(fp, "};\n\n");
+}
+
+static void write_delta_table(FILE *fp, const char *name, const two_stage_table<int32_t> & table) {
+    fprintf(fp, "// %d unique blocks. %d bytes.\n", int(table.num_blocks), int(table.bytes()));
+    write_stage1(fp, (std::string(name) + "_stage1").c_str(), table.stage1);
+    fprintf(fp, "const int32_t %s_stage2[%d] = {\n", name, int(table.stage2.size()));
+    for (size_t i = 0; i < table.stage2.size(); i++) {
+        fprintf(fp, "%d,%s", int(table.stage2[i]), ((i % 16) == 15) ? "\n" : "");
+    }
+    fprintf(fp, "};\n\n");
+}
+
+int main(int argc, char **argv) {
+    const char *filename = "unicode-flags-table.cc";
+    if (argc > 1) {
+        filename = argv[1];
+    }
+
+    const std::vector<uint16_t> flags = unicode_cpt_flags_array();
+
+    two_stage_table<uint16_t> flags_table;
+    two_stage_table<int32_t> lower_table;
+    two_stage_table<int32_t> nfd_table;
+    if (!build_two_stage(flags, flags_table) ||
+        !build_two_stage(unicode_lowercase_delta_array(), lower_table) ||
+        !build_two_stage(unicode_nfd_delta_array(), nfd_table)) {
+        return -1;
+    }
+
+    FILE *fp = fopen(filename, "w");
+    if (!fp) {
+        fprintf(stderr, "Failed to open file: %s\n", filename);
+        return -1;
+    }
+
+    fprintf(fp, "// generated with gen-unicode-flags-table.cc. DO NOT EDIT.\n");
+    fprintf(fp, "// %d unique blocks of %d codepoints. %d bytes total.\n\n",
+            int(flags_table.num_blocks), int(1u << UNICODE_FLAGS_BLOCK_BITS), int(flags_table.bytes()));
+    fprintf(fp, "#include \"unicode-data.hh\"\n\n");
+    fprintf(fp, "namespace nanotokenizer {\n\n");
+
+    write_stage1(fp, "unicode_flags_stage1", flags_table.stage1);
+
+    fprintf(fp, "const uint16_t unicode_flags_stage2[%d] = {\n", int(flags_table.stage2.size()));
+    for (size_t i = 0; i < flags_table.stage2.size(); i++) {
+        fprintf(fp, "0x%04X,%s", int(flags_table.stage2[i]), ((i % 16) == 15) ? "\n" : "");
+    }
+    fprintf(fp, "};\n\n");
+
+    write_delta_table(fp, "unicode_lower", lower_table);
+    write_delta_table(fp, "unicode_nfd", nfd_table);
+
+    fprintf(fp, "} // namespace nanotokenizer\n");
+    fclose(fp);
+
+    printf("Wrote %s: flags %d blocks(%d bytes), lowercase %d blocks(%d bytes), nfd %d blocks(%d bytes)\n", filename,
+           int(flags_table.num_blocks), int(flags_table.bytes()),
+           int(lower_table.num_blocks), int(lower_table.bytes()),
+           int(nfd_table.num_blocks), int(nfd_table.bytes()));
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+# MIT license
+# Copyright 2024-Present Light Transport Entertainment Inc.
+#
+# Generate letter subcategory ranges(unicode-letter-data.cc) from Python's
+# unicodedata module, for regex \p{Lu} \p{Ll} \p{Lt} \p{Lm} \p{Lo}.
+#
+# unicode-data.cc only has the major categories. gen-unicode-flags-table.cc
+# merges these ranges into `codepoint_flags::letter_type`.
+#
+# $ make gen-letter
+#
+import sys
+import unicodedata
+
+MAX_CODEPOINTS = 0x110000
+
+# same values as codepoint_flags::LETTER_*
+LETTER_TYPES = {'Lu': 1, 'Ll': 2, 'Lt': 3, 'Lm': 4, 'Lo': 5}
+
+
+def main():
+    filename = sys.argv[1] if len(sys.argv) > 1 else 'unicode-letter-data.cc'
+
+    ranges = []  # (start, letter type), last = next start - 1
+    for cp in range(MAX_CODEPOINTS):
+        t = LETTER_TYPES.get(unicodedata.category(chr(cp)), 0)
+        if not ranges or ranges[-1][1] != t:
+            ranges.append((cp, t))
+    ranges.append((MAX_CODEPOINTS, 0))
+
+    with open(filename, 'w') as f:
+        w = f.write
+        w('// generated with gen-unicode-letter-data.py. DO NOT EDIT.\n')
+        w('// Unicode %s. %d ranges.\n\n' % (unicodedata.unidata_version, len(ranges)))
+        w('#include "unicode-data.hh"\n\n')
+        w('namespace nanotokenizer {\n\n')
+        w('const std::initializer_list<std::pair<uint32_t, uint8_t>> unicode_ranges_letter_type = {'
+          '  // start, letter type // last=next_start-1\n')
+        for start, t in ranges:
+            w('{0x%06X, %d},\n' % (start, t))
+        w('};\n\n')
+        w('} // namespace nanotokenizer\n')
+
+    print('Wrote %s: %d ranges' % (filename, len(ranges)))
+
+
+if __name__ == '__main__':
+    main()
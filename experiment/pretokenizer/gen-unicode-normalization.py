@@ -0,0 +1,183 @@
+# MIT license
+# Copyright 2024-Present Light Transport Entertainment Inc.
+#
+# Generate Unicode normalization tables(unicode-normalization-data.cc) from
+# Python's unicodedata module.
+#
+# Per codepoint record(two-stage table in the layout of unicode-flags-table.cc):
+#   canonical combining class, quick check value of each form, whether a
+#   normalization boundary is before the codepoint, and the offsets of its
+#   full canonical/compatibility decomposition in a shared codepoint pool.
+# Hangul syllables are decomposed/composed algorithmically and are not in
+# the pools.
+#
+# $ make gen-norm
+#
+import sys
+import unicodedata
+
+MAX_CODEPOINTS = 0x110000
+BLOCK_BITS = 6  # UNICODE_FLAGS_BLOCK_BITS
+
+S_BASE, L_BASE, V_BASE, T_BASE = 0xAC00, 0x1100, 0x1161, 0x11A7
+L_COUNT, V_COUNT, T_COUNT = 19, 21, 28
+S_COUNT = L_COUNT * V_COUNT * T_COUNT
+
+# quick check values
+QC_YES, QC_NO, QC_MAYBE = 0, 1, 2
+
+# form indices, same order as `unicode_normalization_form`
+FORMS = ['NFC', 'NFD', 'NFKC', 'NFKD']
+
+
+def is_hangul_syllable(cp):
+    return S_BASE <= cp < S_BASE + S_COUNT
+
+
+def primary_composites():
+    """(first, second) -> composite for canonical pairs not excluded from composition."""
+    pairs = {}
+    for cp in range(MAX_CODEPOINTS):
+        if is_hangul_syllable(cp):
+            continue
+        d = unicodedata.decomposition(chr(cp))
+        if not d or d.startswith('<'):
+            continue
+        parts = [int(x, 16) for x in d.split()]
+        if len(parts) != 2:
+            continue
+        if unicodedata.normalize('NFC', chr(cp)) != chr(cp):
+            continue  # composition exclusion or non-starter decomposition
+        pairs[(parts[0], parts[1])] = cp
+    return pairs
+
+
+def main():
+    filename = sys.argv[1] if len(sys.argv) > 1 else 'unicode-normalization-data.cc'
+
+    pairs = primary_composites()
+    # second chars of composition pairs combine with the preceding starter.
+    combines_backward = set(second for (_, second) in pairs)
+    combines_backward.update(range(V_BASE, V_BASE + V_COUNT))
+    combines_backward.update(range(T_BASE + 1, T_BASE + T_COUNT))
+
+    pool = []
+    pool_index = {}
+
+    def intern(cpts):
+        key = tuple(cpts)
+        if key not in pool_index:
+            pool_index[key] = len(pool)
+            pool.extend(cpts)
+        return pool_index[key]
+
+    records = []
+    record_index = {}
+    cp_record = [0] * MAX_CODEPOINTS
+
+    default = (0, 0, 0xF, 0, 0, 0, 0)  # ccc, qc, boundary, d_len, kd_len, d_off, kd_off
+    records.append(default)
+    record_index[default] = 0
+
+    for cp in range(MAX_CODEPOINTS):
+        c = chr(cp)
+        ccc = unicodedata.combining(c)
+
+        if is_hangul_syllable(cp):
+            nfd = nfkd = [ord(x) for x in unicodedata.normalize('NFD', c)]
+            d_len = kd_len = 0  # algorithmic
+        else:
+            nfd = [ord(x) for x in unicodedata.normalize('NFD', c)]
+            nfkd = [ord(x) for x in unicodedata.normalize('NFKD', c)]
+            d_len = len(nfd) if nfd != [cp] else 0
+            kd_len = len(nfkd) if nfkd != [cp] else 0
+
+        qc = 0
+        boundary = 0
+        for i, form in enumerate(FORMS):
+            if unicodedata.normalize(form, c) != c:
+                v = QC_NO
+            elif form in ('NFC', 'NFKC') and cp in combines_backward:
+                v = QC_MAYBE
+            else:
+                v = QC_YES
+            qc |= v << (2 * i)
+
+            decomp = nfkd if form.startswith('NFK') else nfd
+            first = decomp[0]
+            starts_with_starter = unicodedata.combining(chr(first)) == 0
+            if form in ('NFD', 'NFKD'):
+                b = starts_with_starter
+            else:
+                b = (ccc == 0 and v == QC_YES and starts_with_starter and
+                     first not in combines_backward)
+            if b:
+                boundary |= 1 << i
+
+        d_off = intern(nfd) if d_len else 0
+        kd_off = intern(nfkd) if kd_len else 0
+        rec = (ccc, qc, boundary, d_len, kd_len, d_off, kd_off)
+        if rec not in record_index:
+            record_index[rec] = len(records)
+            records.append(rec)
+        cp_record[cp] = record_index[rec]
+
+    assert len(records) < 65536 and len(pool) < 65536
+
+    block_size = 1 << BLOCK_BITS
+    stage1 = []
+    stage2 = []
+    block_ids = {}
+    for b in range(MAX_CODEPOINTS // block_size):
+        block = tuple(cp_record[b * block_size:(b + 1) * block_size])
+        if block not in block_ids:
+            block_ids[block] = len(block_ids)
+            stage2.extend(block)
+        stage1.append(block_ids[block])
+
+    composites = sorted(((first << 21) | second, cp) for (first, second), cp in pairs.items())
+
+    total = (len(stage1) + len(stage2)) * 2 + len(records) * 10 + len(pool) * 4 + len(composites) * 16
+
+    with open(filename, 'w') as f:
+        w = f.write
+        w('// generated with gen-unicode-normalization.py. DO NOT EDIT.\n')
+        w('// Unicode %s. %d records, %d unique blocks, %d bytes total.\n\n' % (
+            unicodedata.unidata_version, len(records), len(block_ids), total))
+        w('#include "unicode-data.hh"\n\n')
+        w('namespace nanotokenizer {\n\n')
+
+        w('const uint16_t unicode_norm_stage1[%d] = {\n' % len(stage1))
+        for i, v in enumerate(stage1):
+            w('%d,%s' % (v, '\n' if i % 16 == 15 else ''))
+        w('};\n\n')
+
+        w('const uint16_t unicode_norm_stage2[%d] = {\n' % len(stage2))
+        for i, v in enumerate(stage2):
+            w('%d,%s' % (v, '\n' if i % 16 == 15 else ''))
+        w('};\n\n')
+
+        w('const unicode_norm_record unicode_norm_records[%d] = {  // ccc, qc, boundary, d_len, kd_len, d_offset, kd_offset\n' % len(records))
+        for rec in records:
+            w('{%d, 0x%02X, 0x%X, %d, %d, %d, %d},\n' % rec)
+        w('};\n\n')
+
+        w('const uint32_t unicode_norm_decomp[%d] = {\n' % max(len(pool), 1))
+        for i, v in enumerate(pool):
+            w('0x%06X,%s' % (v, '\n' if i % 8 == 7 else ''))
+        w('};\n\n')
+
+        w('const uint32_t unicode_norm_num_composites = %d;\n\n' % len(composites))
+        w('const unicode_norm_composite unicode_norm_composites[%d] = {  // (first << 21) | second, composite\n' % len(composites))
+        for key, cp in composites:
+            w('{0x%011XULL, 0x%06X},\n' % (key, cp))
+        w('};\n\n')
+
+        w('} // namespace nanotokenizer\n')
+
+    print('Wrote %s: %d records, %d blocks, %d decomposition codepoints, %d composites, %d bytes' % (
+        filename, len(records), len(block_ids), len(pool), len(composites), total))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,1253 @@
+// MIT license
+// Copyright 2024-Present Light Transport Entertainment Inc.
+//
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "nanobpe.hh"
+#include "unicode-util.hh"
+
+namespace nanotokenizer {
+
+namespace {
+
+static const uint32_t NO_SYMBOL = 0xFFFFFFFF;
+static const uint32_t NO_MERGE = 0xFFFFFFFF;
+
+// Words up to this many bytes rescan cached pair ranks instead of using the
+// heap. Most words are this short, and a scan over a few flat entries is
+// cheaper than heap maintenance.
+static const size_t kShortWordBytes = 16;
+
+// Mergeable pair of symbols at `left` and next[left].
+// Entries are never removed when a merge changes a neighbour; stale ones are
+// detected with `left_id`/`right_id` when popped.
+struct bpe_candidate {
+    uint32_t rank;
+    uint32_t left;
+    int left_id;
+    int right_id;
+    int merged;
+
+    bool operator>(const bpe_candidate & rhs) const {
+        return rank != rhs.rank ? rank > rhs.rank : left > rhs.left;
+    }
+};
+
+// Merge state of one word, kept in flat arrays and reused across words.
+struct bpe_scratch {
+    std::vector<int> sym;         // token id of symbol, -1 once merged away
+    std::vector<uint32_t> prev;   // doubly linked list of live symbols
+    std::vector<uint32_t> next;
+    std::vector<uint32_t> rank;   // short words: rank of (i, next[i])
+    std::vector<int> merged;      // short words: result of (i, next[i])
+    std::vector<bpe_candidate> heap;
+    std::vector<pretoken_span> spans;
+    std::string normalized;       // input after normalization
+};
+
+static thread_local bpe_scratch tls_scratch;
+
+// Word cache of the current thread for one tokenizer.
+struct bpe_thread_cache {
+    uint64_t owner{0};
+    size_t budget{0};
+    uint64_t last_used{0};
+    std::unique_ptr<bpe_word_cache> cache;
+};
+
+// The least recently used one is replaced for another tokenizer.
+static thread_local bpe_thread_cache tls_caches[bpe_tokenizer::kThreadCaches];
+static thread_local uint64_t tls_cache_clock{0};
+
+static std::atomic<uint64_t> bpe_instance_counter{0};
+
+} // namespace
+
+// Word caches of `encode_parallel` workers. The worker threads live for one
+// call, so their caches are kept here and handed to the next call's workers.
+struct bpe_worker_caches {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<bpe_word_cache>> caches;
+    size_t budget{0};  // of every cache in `caches`
+
+    // `n` caches of `budget` bytes, reused when possible.
+    std::vector<std::unique_ptr<bpe_word_cache>> take(size_t n, size_t byte_budget) {
+        std::vector<std::unique_ptr<bpe_word_cache>> taken;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (budget != byte_budget) {
+                caches.clear();
+                budget = byte_budget;
+            }
+            while (taken.size() < n && !caches.empty()) {
+                taken.push_back(std::move(caches.back()));
+                caches.pop_back();
+            }
+        }
+        while (taken.size() < n) {
+            taken.emplace_back(new bpe_word_cache(byte_budget));
+        }
+        return taken;
+    }
+
+    void give_back(std::vector<std::unique_ptr<bpe_word_cache>> & taken, size_t byte_budget) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (budget != byte_budget) {
+            return;  // budget changed meanwhile
+        }
+        for (auto & c : taken) {
+            caches.push_back(std::move(c));
+        }
+    }
+};
+
+const uint64_t bpe_tokenizer::kEmptyKey;
+const size_t bpe_tokenizer::kThreadCaches;
+const size_t bpe_word_cache::kMaxWordBytes;
+const size_t bpe_word_cache::kMinByteBudget;
+
+bpe_word_cache::bpe_word_cache(size_t byte_budget)
+{
+    static_assert(kMinByteBudget == 16 * sizeof(entry) + 64 * sizeof(uint32_t), "minimum footprint");
+    byte_budget = (std::max)(byte_budget, kMinByteBudget);
+
+    // 1/4 of the budget for slots(load factor <= 1/2), the rest for the arena.
+    size_t num_slots = 16;
+    while (num_slots * 2 * sizeof(entry) <= byte_budget / 4) {
+        num_slots *= 2;
+    }
+    _slots.assign(num_slots, entry{});
+    _slot_mask = num_slots - 1;
+
+    const size_t slot_bytes = num_slots * sizeof(entry);
+    _arena.resize((byte_budget - slot_bytes) / sizeof(uint32_t));
+}
+
+uint64_t bpe_word_cache::hash_bytes(const char * p, size_t n)
+{
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ (n * 0xC2B2AE3D27D4EB4FULL);
+    for (; n >= 8; p += 8, n -= 8) {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        h = (h ^ v) * 0xff51afd7ed558ccdULL;
+        h ^= h >> 32;
+    }
+    uint64_t v = 0;
+    memcpy(&v, p, n);
+    h = (h ^ v) * 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 29;
+    return h | 1;  // 0 marks an empty slot
+}
+
+bpe_word_cache::entry * bpe_word_cache::probe(uint64_t hash, const char * word, size_t size)
+{
+    for (size_t i = hash & _slot_mask; ; i = (i + 1) & _slot_mask) {
+        entry & e = _slots[i];
+        if (e.hash == 0) {
+            return &e;
+        }
+        if (e.hash == hash && e.key_size == size && memcmp(&_arena[e.offset], word, size) == 0) {
+            return &e;
+        }
+    }
+}
+
+bool bpe_word_cache::find(const char * word, size_t size, const int * & ids, size_t & num_ids)
+{
+    if (size > kMaxWordBytes) {
+        _misses++;
+        return false;
+    }
+    entry * e = probe(hash_bytes(word, size), word, size);
+    if (e->hash == 0) {
+        _misses++;
+        return false;
+    }
+    e->referenced = 1;
+    ids = reinterpret_cast<const int *>(&_arena[e->offset + (e->key_size + 3) / 4]);
+    num_ids = e->num_ids;
+    _hits++;
+    return true;
+}
+
+void bpe_word_cache::insert(const char * word, size_t size, const int * ids, size_t num_ids)
+{
+    const size_t words = (size + 3) / 4 + num_ids;  // in uint32_t
+    if (size > kMaxWordBytes || num_ids > 255 || words > _arena.size() / 4) {
+        return;
+    }
+
+    if (_arena_used + words > _arena.size() || (_num_entries + 1) * 2 > _slots.size()) {
+        evict();
+    }
+
+    const uint64_t hash = hash_bytes(word, size);
+    entry * e = probe(hash, word, size);
+    if (e->hash != 0) {
+        return;  // already cached
+    }
+
+    e->hash = hash;
+    e->offset = uint32_t(_arena_used);
+    e->key_size = uint16_t(size);
+    e->num_ids = uint8_t(num_ids);
+    e->referenced = 0;
+    memcpy(&_arena[_arena_used], word, size);
+    memcpy(&_arena[_arena_used + (size + 3) / 4], ids, num_ids * sizeof(int));
+    _arena_used += words;
+    _num_entries++;
+}
+
+void bpe_word_cache::evict()
+{
+    // Keep entries referenced since the last eviction, up to half of the
+    // arena and a quarter of the slots. The scan starts at the clock hand so
+    // unreferenced-but-kept survivors rotate when everything is referenced.
+    const size_t num_slots = _slots.size();
+    const size_t max_words = _arena.size() / 2;
+    const size_t max_entries = num_slots / 4;
+
+    size_t kept_words = 0;
+    size_t kept = 0;
+    for (size_t k = 0; k < num_slots; k++) {
+        entry & e = _slots[(_clock_hand + k) & _slot_mask];
+        if (e.hash == 0) {
+            continue;
+        }
+        const size_t words = (e.key_size + 3) / 4 + e.num_ids;
+        if (!e.referenced || kept_words + words > max_words || kept + 1 > max_entries) {
+            e = entry{};
+            _evictions++;
+            continue;
+        }
+        kept_words += words;
+        kept++;
+    }
+
+    // Pack survivors to the front of the slots in arena order, and slide
+    // their keys and ids down the arena.
+    size_t n = 0;
+    for (size_t i = 0; i < num_slots; i++) {
+        if (_slots[i].hash != 0) {
+            _slots[n++] = _slots[i];
+        }
+    }
+    std::fill(_slots.begin() + long(n), _slots.end(), entry{});
+    std::sort(_slots.begin(), _slots.begin() + long(n),
+              [](const entry & a, const entry & b) { return a.offset < b.offset; });
+
+    const uint8_t kUnplaced = 2;
+    size_t used = 0;
+    for (size_t i = 0; i < n; i++) {
+        entry & e = _slots[i];
+        const size_t words = (e.key_size + 3) / 4 + e.num_ids;
+        memmove(&_arena[used], &_arena[e.offset], words * sizeof(uint32_t));
+        e.offset = uint32_t(used);
+        e.referenced = kUnplaced;
+        used += words;
+    }
+
+    // Rehash in place. An entry being placed takes over the first unplaced
+    // slot on its probe path, so no placed entry probes past a slot that is
+    // emptied later.
+    for (size_t i = 0; i < n; i++) {
+        if (_slots[i].referenced != kUnplaced) {
+            continue;
+        }
+        entry e = _slots[i];
+        _slots[i] = entry{};
+        e.referenced = 0;
+        for (size_t p = e.hash & _slot_mask; ; ) {
+            entry & s = _slots[p];
+            if (s.hash == 0) {
+                s = e;
+                break;
+            }
+            if (s.referenced == kUnplaced) {
+                std::swap(s, e);
+                e.referenced = 0;
+                p = e.hash & _slot_mask;
+                continue;
+            }
+            p = (p + 1) & _slot_mask;
+        }
+    }
+
+    _clock_hand = (_clock_hand + num_slots / 2) & _slot_mask;
+    _arena_used = used;
+    _num_entries = n;
+}
+
+void bpe_word_cache::clear()
+{
+    std::fill(_slots.begin(), _slots.end(), entry{});
+    _arena_used = 0;
+    _num_entries = 0;
+    _clock_hand = 0;
+}
+
+bool bpe_tokenizer::load(const std::map<std::string, int> & vocab,
+                         const std::vector<std::pair<std::string, std::string>> & merges,
+                         std::string & err)
+{
+    // byte-to-unicode mapping(GPT-2 bytes_to_unicode)
+    for (uint32_t b = 0; b < 256; b++) {
+        const std::string s = unicode_byte_to_utf8(uint8_t(b));
+        auto it = vocab.find(s);
+        if (it == vocab.end()) {
+            err = "byte token not in vocab: " + s;
+            return false;
+        }
+        _byte_to_id[b] = it->second;
+    }
+
+    int max_id = -1;
+    for (const auto & kv : vocab) {
+        if (kv.second < 0) {
+            err = "negative id in vocab: " + kv.first;
+            return false;
+        }
+        max_id = (std::max)(max_id, kv.second);
+    }
+
+    _id_to_bytes.assign(size_t(max_id + 1), std::string());
+    for (const auto & kv : vocab) {
+        std::string & bytes = _id_to_bytes[size_t(kv.second)];
+        if (unicode_bpe_chars_to_bytes(kv.first.data(), kv.first.size(), bytes)) {
+            continue;
+        }
+        for (const uint32_t cpt : unicode_cpts_from_utf8(kv.first)) {
+            const int b = unicode_bpe_cpt_to_byte(cpt);
+            if (b >= 0) {
+                bytes += char(b);
+            } else {
+                bytes += unicode_cpt_to_utf8(cpt);  // not a mapped byte(e.g. added token). keep as is.
+            }
+        }
+    }
+
+    size_t capacity = 16;
+    while (capacity < merges.size() * 2) {
+        capacity *= 2;
+    }
+    _pairs.assign(capacity, pair_entry{kEmptyKey, 0, -1});
+    _pair_mask = capacity - 1;
+
+    for (size_t rank = 0; rank < merges.size(); rank++) {
+        const std::string & left = merges[rank].first;
+        const std::string & right = merges[rank].second;
+        auto lit = vocab.find(left);
+        auto rit = vocab.find(right);
+        auto mit = vocab.find(left + right);
+        if (lit == vocab.end() || rit == vocab.end() || mit == vocab.end()) {
+            err = "merge not in vocab: " + left + " " + right;
+            return false;
+        }
+
+        const uint64_t key = pair_key(lit->second, rit->second);
+        for (size_t i = hash(key) & _pair_mask; ; i = (i + 1) & _pair_mask) {
+            pair_entry & e = _pairs[i];
+            if (e.key == key) {
+                break;  // duplicated rule. the first one wins.
+            }
+            if (e.key == kEmptyKey) {
+                e = pair_entry{key, uint32_t(rank), mit->second};
+                break;
+            }
+        }
+    }
+
+    _instance_id = ++bpe_instance_counter;
+    _worker_caches = std::make_shared<bpe_worker_caches>();
+
+    return true;
+}
+
+size_t bpe_tokenizer::encode_word(const char * word, size_t size, int * out, size_t cap) const
+{
+    if (size == 0 || size > cap) {
+        return 0;
+    }
+    if (size == 1) {
+        out[0] = _byte_to_id[uint8_t(word[0])];
+        return 1;
+    }
+
+    bpe_scratch & s = tls_scratch;
+    if (s.sym.size() < size) {
+        s.sym.resize(size);
+        s.prev.resize(size);
+        s.next.resize(size);
+        s.rank.resize(size);
+        s.merged.resize(size);
+    }
+    int * sym = s.sym.data();
+    uint32_t * prev = s.prev.data();
+    uint32_t * next = s.next.data();
+
+    for (size_t i = 0; i < size; i++) {
+        sym[i] = _byte_to_id[uint8_t(word[i])];
+        prev[i] = uint32_t(i - 1);  // NO_SYMBOL for i == 0
+        next[i] = uint32_t(i + 1);
+    }
+    next[size - 1] = NO_SYMBOL;
+
+    // Unlink `right` = next[left] after merging it into `left`.
+    auto unlink_right = [&] (uint32_t left) {
+        const uint32_t right = next[left];
+        sym[right] = -1;
+        next[left] = next[right];
+        if (next[right] != NO_SYMBOL) {
+            prev[next[right]] = left;
+        }
+    };
+
+    if (size <= kShortWordBytes) {
+        uint32_t * rank = s.rank.data();
+        int * merged = s.merged.data();
+
+        auto update_pair = [&] (uint32_t left) {
+            if (next[left] == NO_SYMBOL || !find_merge(sym[left], sym[next[left]], rank[left], merged[left])) {
+                rank[left] = NO_MERGE;
+            }
+        };
+
+        for (size_t i = 0; i < size; i++) {
+            update_pair(uint32_t(i));
+        }
+
+        for (;;) {
+            uint32_t best = NO_SYMBOL;
+            uint32_t best_rank = NO_MERGE;
+            for (uint32_t i = 0; i != NO_SYMBOL; i = next[i]) {
+                if (rank[i] < best_rank) {  // strict: leftmost wins ties
+                    best_rank = rank[i];
+                    best = i;
+                }
+            }
+            if (best == NO_SYMBOL) {
+                break;
+            }
+
+            sym[best] = merged[best];
+            unlink_right(best);
+
+            if (prev[best] != NO_SYMBOL) {
+                update_pair(prev[best]);
+            }
+            update_pair(best);
+        }
+    } else {
+        std::vector<bpe_candidate> & heap = s.heap;
+        heap.clear();
+
+        auto add_candidate = [&] (uint32_t left) -> bool {
+            if (left == NO_SYMBOL || next[left] == NO_SYMBOL) {
+                return false;
+            }
+            const int left_id = sym[left];
+            const int right_id = sym[next[left]];
+            uint32_t rank;
+            int merged;
+            if (!find_merge(left_id, right_id, rank, merged)) {
+                return false;
+            }
+            heap.push_back({rank, left, left_id, right_id, merged});
+            return true;
+        };
+
+        auto push_candidate = [&] (uint32_t left) {
+            if (add_candidate(left)) {
+                std::push_heap(heap.begin(), heap.end(), std::greater<bpe_candidate>());
+            }
+        };
+
+        for (size_t i = 0; i + 1 < size; i++) {
+            add_candidate(uint32_t(i));
+        }
+        std::make_heap(heap.begin(), heap.end(), std::greater<bpe_candidate>());
+
+        // Always merge the lowest rank pair, leftmost first.
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<bpe_candidate>());
+            const bpe_candidate c = heap.back();
+            heap.pop_back();
+
+            const uint32_t left = c.left;
+            const uint32_t right = next[left];
+            if (sym[left] != c.left_id || right == NO_SYMBOL || sym[right] != c.right_id) {
+                continue;  // stale
+            }
+
+            sym[left] = c.merged;
+            unlink_right(left);
+
+            push_candidate(prev[left]);
+            push_candidate(left);
+        }
+    }
+
+    size_t n = 0;
+    for (uint32_t i = 0; i != NO_SYMBOL; i = next[i]) {
+        out[n++] = sym[i];
+    }
+    return n;
+}
+
+bool bpe_tokenizer::encode_into(const char * text, size_t size, int * out, size_t cap, size_t & out_len) const
+{
+    return encode_into(text, size, out, cap, out_len, thread_word_cache());
+}
+
+bool bpe_tokenizer::encode_into(const char * text, size_t size, int * out, size_t cap, size_t & out_len, bpe_word_cache * cache) const
+{
+    if (_pairs.empty()) {
+        return false;  // not loaded
+    }
+
+    normalize_input(text, size, tls_scratch.normalized);
+    return encode_words(text, size, out, cap, out_len, cache);
+}
+
+void bpe_tokenizer::normalize_input(const char * & text, size_t & size, std::string & buf) const
+{
+    if (_normalize && unicode_normalization_quick_check(_normalization_form, text, size) != UNICODE_QC_YES) {
+        buf.clear();
+        unicode_normalize(_normalization_form, text, size, buf);
+        text = buf.data();
+        size = buf.size();
+    }
+}
+
+size_t bpe_tokenizer::encode_word_cached(const char * word, size_t size, int * out, size_t cap, bpe_word_cache * cache) const
+{
+    if (!cache || size <= 1) {
+        return encode_word(word, size, out, cap);
+    }
+    size_t n;
+    const int * cached;
+    if (cache->find(word, size, cached, n)) {
+        if (n > cap) {
+            return 0;
+        }
+        memcpy(out, cached, n * sizeof(int));
+        return n;
+    }
+    n = encode_word(word, size, out, cap);
+    if (n) {
+        cache->insert(word, size, out, n);
+    }
+    return n;
+}
+
+namespace {
+
+// Output state of the fused path: words are encoded from the pretokenizer
+// callback straight into `out`.
+struct bpe_word_sink {
+    const bpe_tokenizer * tok;
+    const char * text;
+    int * out;
+    size_t cap;
+    size_t len;
+    bpe_word_cache * cache;
+    bool ok;
+};
+}
+
+void bpe_tokenizer::encode_visited(void * user, size_t offset, size_t length)
+{
+    bpe_word_sink & sink = *static_cast<bpe_word_sink *>(user);
+    if (!sink.ok) {
+        return;
+    }
+    const size_t n = sink.tok->encode_word_cached(sink.text + offset, length, sink.out + sink.len, sink.cap - sink.len, sink.cache);
+    sink.ok = n != 0;
+    sink.len += n;
+}
+
+bool bpe_tokenizer::encode_words(const char * text, size_t size, int * out, size_t cap, size_t & out_len, bpe_word_cache * cache) const
+{
+    if (_visit) {
+        bpe_word_sink sink{this, text, out, cap, 0, cache, true};
+        _visit(text, size, encode_visited, &sink);
+        if (!sink.ok) {
+            return false;
+        }
+        out_len = sink.len;
+        return true;
+    }
+
+    std::vector<pretoken_span> & spans = tls_scratch.spans;
+    _pretokenize(text, size, spans);
+
+    size_t len = 0;
+    for (const auto & span : spans) {
+        const size_t n = encode_word_cached(text + span.offset, span.length, out + len, cap - len, cache);
+        if (n == 0) {
+            return false;
+        }
+        len += n;
+    }
+    out_len = len;
+    return true;
+}
+
+bool bpe_tokenizer::encode_parallel(const std::string & text, std::vector<int> & ids, uint32_t num_threads) const
+{
+    if (_pairs.empty()) {
+        return false;  // not loaded
+    }
+
+    const char * data = text.data();
+    size_t size = text.size();
+    std::string normalized;
+    normalize_input(data, size, normalized);
+
+    if (num_threads == 0) {
+        num_threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    }
+
+    ids.resize(size);  // at most one id per byte
+    if (size < kParallelMinBytes || num_threads == 1) {
+        size_t len = 0;
+        if (size && !encode_words(data, size, &ids[0], size, len, thread_word_cache())) {
+            ids.clear();
+            return false;
+        }
+        ids.resize(len);
+        return true;
+    }
+
+    std::vector<size_t> bounds(1, 0);
+    while (bounds.back() < size) {
+        bounds.push_back(pretokenize_chunk_boundary(data, size, bounds.back() + kParallelBatchBytes));
+    }
+    const size_t num_batches = bounds.size() - 1;
+    std::vector<size_t> lens(num_batches, 0);
+    std::atomic<size_t> next_batch{0};
+    std::atomic<bool> ok{true};
+
+    auto worker = [&](bpe_word_cache * cache) {
+        for (size_t b; (b = next_batch.fetch_add(1)) < num_batches && ok.load(std::memory_order_relaxed); ) {
+            const size_t begin = bounds[b];
+            const size_t n = bounds[b + 1] - begin;
+            if (!encode_words(data + begin, n, &ids[begin], n, lens[b], cache)) {
+                ok = false;
+            }
+        }
+    };
+
+    // The calling thread uses its own cache; the short-lived workers take
+    // caches kept from earlier calls.
+    const size_t num_workers = (std::min)(size_t(num_threads), num_batches) - 1;
+    const size_t budget = _cache_budget;
+    std::vector<std::unique_ptr<bpe_word_cache>> caches;
+    if (budget) {
+        caches = _worker_caches->take(num_workers, budget);
+    }
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < num_workers; i++) {
+        workers.emplace_back(worker, budget ? caches[i].get() : nullptr);
+    }
+    worker(thread_word_cache());
+    for (auto & w : workers) {
+        w.join();
+    }
+    if (budget) {
+        _worker_caches->give_back(caches, budget);
+    }
+    if (!ok) {
+        ids.clear();
+        return false;
+    }
+
+    size_t len = lens[0];
+    for (size_t b = 1; b < num_batches; b++) {
+        memmove(&ids[len], &ids[bounds[b]], lens[b] * sizeof(int));
+        len += lens[b];
+    }
+    ids.resize(len);
+    return true;
+}
+
+bpe_word_cache * bpe_tokenizer::thread_word_cache() const
+{
+    if (_cache_budget == 0 || _instance_id == 0) {
+        return nullptr;
+    }
+    bpe_thread_cache * tc = &tls_caches[0];
+    for (auto & c : tls_caches) {
+        if (c.owner == _instance_id) {
+            tc = &c;
+            break;
+        }
+        if (c.last_used < tc->last_used) {
+            tc = &c;
+        }
+    }
+    if (!tc->cache || tc->owner != _instance_id || tc->budget != _cache_budget) {
+        tc->cache.reset(new bpe_word_cache(_cache_budget));
+        tc->owner = _instance_id;
+        tc->budget = _cache_budget;
+    }
+    tc->last_used = ++tls_cache_clock;
+    return tc->cache.get();
+}
+
+bool bpe_tokenizer::encode(const std::string & text, std::vector<int> & ids) const
+{
+    if (_pairs.empty()) {
+        return false;  // not loaded
+    }
+
+    // Size for the normalized text, which can be longer than `text`.
+    const char * data = text.data();
+    size_t size = text.size();
+    normalize_input(data, size, tls_scratch.normalized);
+
+    ids.resize(size);  // at most one id per byte
+    size_t len = 0;
+    if (size && !encode_words(data, size, &ids[0], size, len, thread_word_cache())) {
+        ids.clear();
+        return false;
+    }
+    ids.resize(len);
+    return true;
+}
+
+bool bpe_tokenizer::decode(const std::vector<int> & ids, std::string & text) const
+{
+    text.clear();
+    for (const int id : ids) {
+        if (id < 0 || size_t(id) >= _id_to_bytes.size()) {
+            return false;
+        }
+        text += _id_to_bytes[size_t(id)];
+    }
+    return true;
+}
+
+bool bpe_read_merges(const std::string & filename, std::vector<std::pair<std::string, std::string>> & merges, std::string & err)
+{
+    std::ifstream ifs(filename);
+    if (!ifs) {
+        err = "failed to open: " + filename;
+        return false;
+    }
+
+    merges.clear();
+    std::string line;
+    while (std::getline(ifs, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        const size_t sp = line.find(' ', 1);
+        if (sp == std::string::npos) {
+            err = "invalid merge rule: " + line;
+            return false;
+        }
+        merges.emplace_back(line.substr(0, sp), line.substr(sp + 1));
+    }
+    return true;
+}
+
+} // namespace nanotokenizer
+
+#ifdef BPE_BENCH_MAIN
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <set>
+
+using namespace nanotokenizer;
+
+// Count heap allocations to compare the pipelines.
+static std::atomic<size_t> g_num_allocs{0};
+
+void * operator new(size_t size)
+{
+    g_num_allocs.fetch_add(1, std::memory_order_relaxed);
+    void * p = malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void * p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void * p, size_t) noexcept
+{
+    free(p);
+}
+
+// Learn merges from word counts(plain BPE training), so the benchmark runs
+// without downloading a vocab.
+static void train_merges(const std::map<std::string, size_t> & word_counts, size_t num_merges,
+                         std::map<std::string, int> & vocab,
+                         std::vector<std::pair<std::string, std::string>> & merges)
+{
+    std::vector<std::pair<std::vector<std::string>, size_t>> words;
+    for (const auto & wc : word_counts) {
+        std::vector<std::string> syms;
+        for (const char c : wc.first) {
+            syms.push_back(unicode_byte_to_utf8(uint8_t(c)));
+        }
+        words.emplace_back(syms, wc.second);
+    }
+
+    vocab.clear();
+    for (uint32_t b = 0; b < 256; b++) {
+        vocab[unicode_byte_to_utf8(uint8_t(b))] = int(b);
+    }
+
+    for (size_t m = 0; m < num_merges; m++) {
+        std::map<std::pair<std::string, std::string>, size_t> pair_counts;
+        for (const auto & w : words) {
+            for (size_t i = 0; i + 1 < w.first.size(); i++) {
+                pair_counts[{w.first[i], w.first[i + 1]}] += w.second;
+            }
+        }
+
+        const std::pair<std::string, std::string> * best = nullptr;
+        size_t best_count = 0;
+        for (const auto & pc : pair_counts) {
+            if (pc.second > best_count) {
+                best = &pc.first;
+                best_count = pc.second;
+            }
+        }
+        if (!best) {
+            break;
+        }
+
+        const auto rule = *best;
+        const std::string merged = rule.first + rule.second;
+        merges.push_back(rule);
+        vocab.emplace(merged, int(vocab.size()));
+
+        for (auto & w : words) {
+            std::vector<std::string> & syms = w.first;
+            for (size_t i = 0; i + 1 < syms.size(); i++) {
+                if (syms[i] == rule.first && syms[i + 1] == rule.second) {
+                    syms[i] = merged;
+                    syms.erase(syms.begin() + long(i) + 1);
+                }
+            }
+        }
+    }
+}
+
+// Reference BPE: rescan all pairs for the lowest rank after every merge. O(n^2).
+static size_t encode_word_naive(const bpe_tokenizer & tok, const char * word, size_t size, std::vector<int> & syms)
+{
+    syms.clear();
+    for (size_t i = 0; i < size; i++) {
+        syms.push_back(tok.byte_id(uint8_t(word[i])));
+    }
+    for (;;) {
+        uint32_t best_rank = 0xFFFFFFFF;
+        size_t best = 0;
+        int best_merged = -1;
+        for (size_t i = 0; i + 1 < syms.size(); i++) {
+            uint32_t rank;
+            int merged;
+            if (tok.find_merge(syms[i], syms[i + 1], rank, merged) && rank < best_rank) {
+                best_rank = rank;
+                best = i;
+                best_merged = merged;
+            }
+        }
+        if (best_merged < 0) {
+            break;
+        }
+        syms[best] = best_merged;
+        syms.erase(syms.begin() + long(best) + 1);
+    }
+    return syms.size();
+}
+
+static std::string make_input(const char * const * samples, size_t nsamples, size_t nbytes) {
+    std::string input;
+    for (size_t i = 0; input.size() < nbytes; i++) {
+        input += samples[(i * 7) % nsamples];
+    }
+    return input;
+}
+
+// Words drawn with a Zipf distribution from a large
+// pseudo-random vocabulary, so that a word cache sees both hot and cold words.
+static std::string make_words(size_t nwords, size_t nbytes) {
+    uint32_t seed = 12345;
+    auto next = [&seed]() { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+    std::vector<std::string> words(nwords);
+    for (auto & w : words) {
+        const size_t len = 2 + next() % 10;
+        for (size_t i = 0; i < len; i++) {
+            w += char('a' + next() % 26);
+        }
+    }
+    std::string input;
+    while (input.size() < nbytes) {
+        // log-uniform index: P(i) ~ 1/i
+        const double u = double(next()) / double(1u << 24);
+        input += ' ';
+        input += words[size_t(std::exp(u * std::log(double(nwords)))) - 1];
+    }
+    return input;
+}
+
+int main(int argc, char **argv)
+{
+    const char *text_samples[] = {
+        "The quick brown fox jumps over the lazy dog. It's 12:30, isn't it?\n",
+        "    for (size_t i = 0; i < n; i++) {\n        sum += a[i] * 2;\n    }\n",
+        u8"吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。\n",
+        u8"Привет, мир! 🤩🤩 Ça va? \n\n",
+        "Tokenization converts raw text into integer identifiers understood by language models.\n",
+    };
+    // long words: base64 blobs, separator lines and deep indentation.
+    const char *long_samples[] = {
+        "data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAAAEAAAABCAYAAAAfFcSJAAAADUlEQVR42mNkYPhfDwAChwGAgAAAAASUVORK5CYIIaGVsbG8gd29ybGQgdGhpcyBpcyBhIGxvbmcgYmFzZTY0IHN0cmluZw\n",
+        "================================================================================================================================\n",
+        "                                                                                                                                return;\n",
+    };
+
+    const struct { const char *name; std::string input; } corpora[] = {
+        {"text", make_input(text_samples, sizeof(text_samples) / sizeof(text_samples[0]), 4 * 1024 * 1024)},
+        {"long", make_input(long_samples, sizeof(long_samples) / sizeof(long_samples[0]), 4 * 1024 * 1024)},
+        {"words", make_words(200000, 4 * 1024 * 1024)},
+    };
+
+    const struct { const char *name; pretokenize_span_fn fn; pretokenize_visit_rule visit; } models[] = {
+        {"gpt2", pretokenize_gpt2, pretokenize_gpt2},
+        {"llama3", pretokenize_llama3, pretokenize_llama3},
+        {"qwen2", pretokenize_qwen2, pretokenize_qwen2},
+    };
+
+    std::vector<pretoken_span> spans;
+    std::vector<int> syms;
+    for (const auto & model : models) {
+        // merges learned from the words of all corpora
+        std::map<std::string, size_t> word_counts;
+        for (const auto & c : corpora) {
+            model.fn(c.input.data(), (std::min)(c.input.size(), size_t(64 * 1024)), spans);
+            for (const auto & span : spans) {
+                word_counts[c.input.substr(span.offset, span.length)]++;
+            }
+        }
+        std::map<std::string, int> vocab;
+        std::vector<std::pair<std::string, std::string>> merges;
+        train_merges(word_counts, 2000, vocab, merges);
+
+        bpe_tokenizer tok(model.fn);
+        std::string err;
+        if (!tok.load(vocab, merges, err)) {
+            fprintf(stderr, "load failed: %s\n", err.c_str());
+            return -1;
+        }
+
+        for (const auto & c : corpora) {
+            const std::string & input = c.input;
+            std::vector<int> ids;
+
+            auto start = std::chrono::steady_clock::now();
+            if (!tok.encode(input, ids)) {
+                fprintf(stderr, "encode failed\n");
+                return -1;
+            }
+            const double encode_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::string decoded;
+            if (!tok.decode(ids, decoded) || decoded != input) {
+                fprintf(stderr, "%s: decode(encode(text)) != text\n", model.name);
+                return -1;
+            }
+
+            // merge loop only
+            model.fn(input.data(), input.size(), spans);
+            std::vector<int> word_ids(input.size());
+            start = std::chrono::steady_clock::now();
+            size_t nids = 0;
+            for (const auto & span : spans) {
+                nids += tok.encode_word(input.data() + span.offset, span.length, word_ids.data() + nids, word_ids.size() - nids);
+            }
+            const double heap_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            for (const auto & span : spans) {
+                encode_word_naive(tok, input.data() + span.offset, span.length, syms);
+            }
+            const double naive_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            // heap and naive merge loop must agree word by word.
+            size_t pos = 0;
+            for (const auto & span : spans) {
+                const size_t n = encode_word_naive(tok, input.data() + span.offset, span.length, syms);
+                if (pos + n > ids.size() || !std::equal(syms.begin(), syms.end(), ids.begin() + long(pos))) {
+                    fprintf(stderr, "%s: heap and naive BPE differ\n", model.name);
+                    return -1;
+                }
+                pos += n;
+            }
+            if (pos != ids.size() || nids != ids.size()) {
+                fprintf(stderr, "%s: heap and naive BPE differ\n", model.name);
+                return -1;
+            }
+
+            const double mb = double(input.size()) / (1024.0 * 1024.0);
+            printf("%-7s %-5s %zu merges, %zu ids: encode %7.2f MB/s | merge loop: flat %7.2f MB/s, naive %7.2f MB/s (%.2fx)\n",
+                   model.name, c.name, merges.size(), nids, mb / encode_sec, mb / heap_sec, mb / naive_sec, naive_sec / heap_sec);
+
+            // word cache: a roomy one and a small one that keeps evicting.
+            for (size_t budget : {size_t(4 * 1024 * 1024), size_t(16 * 1024)}) {
+                bpe_word_cache cache(budget);
+                std::vector<int> cached_ids(input.size());
+                size_t cached_len = 0;
+                const size_t allocs = g_num_allocs.load();
+                start = std::chrono::steady_clock::now();
+                if (!tok.encode_into(input.data(), input.size(), cached_ids.data(), cached_ids.size(), cached_len, &cache)) {
+                    fprintf(stderr, "encode failed\n");
+                    return -1;
+                }
+                const double cached_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                if (g_num_allocs.load() != allocs) {
+                    fprintf(stderr, "%s: word cache(budget %zu) allocated while encoding\n", model.name, budget);
+                    return -1;
+                }
+                cached_ids.resize(cached_len);
+                if (cached_ids != ids || cache.memory_usage() > budget) {
+                    fprintf(stderr, "%s: ids differ with word cache(budget %zu)\n", model.name, budget);
+                    return -1;
+                }
+                const double hit_rate = double(cache.hits()) / double((std::max)(cache.hits() + cache.misses(), uint64_t(1)));
+                printf("%-7s %-5s   word cache %5zu KB: encode %7.2f MB/s (%.2fx), hit %5.1f%%, %zu entries, %llu evicted\n",
+                       model.name, c.name, cache.memory_usage() / 1024, mb / cached_sec, encode_sec / cached_sec,
+                       100.0 * hit_rate, cache.size(), (unsigned long long)cache.evictions());
+            }
+
+            // per-thread cache used by encode()
+            tok.set_word_cache_budget(1024 * 1024);
+            std::vector<int> thread_ids;
+            if (!tok.encode(input, thread_ids) || thread_ids != ids || !tok.thread_word_cache() ||
+                tok.thread_word_cache()->hits() + tok.thread_word_cache()->misses() == 0) {
+                fprintf(stderr, "%s: ids differ with thread word cache\n", model.name);
+                return -1;
+            }
+
+            // Alternating tokenizers on one thread keep their own caches,
+            // and a budget below the minimum does not rebuild on every call.
+            {
+                bpe_tokenizer other(model.fn);
+                if (!other.load(vocab, merges, err)) {
+                    fprintf(stderr, "load failed: %s\n", err.c_str());
+                    return -1;
+                }
+                other.set_word_cache_budget(1);
+                const bpe_word_cache * tok_cache = tok.thread_word_cache();
+                const bpe_word_cache * other_cache = other.thread_word_cache();
+                std::vector<int> other_ids;
+                if (!other.encode(text_samples[0], other_ids) || !tok.encode(text_samples[0], other_ids) ||
+                    !other.encode(text_samples[1], other_ids) || tok.thread_word_cache() != tok_cache ||
+                    other.thread_word_cache() != other_cache ||
+                    other_cache->memory_usage() > bpe_word_cache::kMinByteBudget) {
+                    fprintf(stderr, "%s: thread word cache rebuilt\n", model.name);
+                    return -1;
+                }
+            }
+            tok.set_word_cache_budget(0);
+
+            // Pipelines: pretokenize into spans then encode each piece into
+            // its own vector(unfused), spans reused across calls, words
+            // encoded from the pretokenizer callback(fused), fused with
+            // batches on worker threads, and that again with word caches,
+            // which the workers keep across calls.
+            bpe_tokenizer fused(model.fn, model.visit);
+            if (!fused.load(vocab, merges, err)) {
+                fprintf(stderr, "load failed: %s\n", err.c_str());
+                return -1;
+            }
+            const uint32_t num_threads = 4;
+            std::vector<int> pipeline_ids;
+            double pipeline_sec[5];
+            size_t pipeline_allocs[5];
+            for (int p = 0; p < 5; p++) {
+                if (p == 4) {
+                    fused.set_word_cache_budget(4 * 1024 * 1024);
+                }
+                // warm up thread local scratch and caches, then measure
+                for (int round = 0; round < 2; round++) {
+                    pipeline_ids = std::vector<int>();
+                    const size_t allocs = g_num_allocs.load();
+                    start = std::chrono::steady_clock::now();
+                    bool ok = true;
+                    if (p == 0) {
+                        std::vector<pretoken_span> piece_spans;
+                        model.fn(input.data(), input.size(), piece_spans);
+                        for (const auto & span : piece_spans) {
+                            std::vector<int> piece(span.length);
+                            const size_t n = tok.encode_word(input.data() + span.offset, span.length, piece.data(), piece.size());
+                            ok = ok && n != 0;
+                            pipeline_ids.insert(pipeline_ids.end(), piece.begin(), piece.begin() + long(n));
+                        }
+                    } else if (p == 1) {
+                        ok = tok.encode(input, pipeline_ids);
+                    } else if (p == 2) {
+                        ok = fused.encode(input, pipeline_ids);
+                    } else {
+                        ok = fused.encode_parallel(input, pipeline_ids, num_threads);
+                    }
+                    pipeline_sec[p] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    pipeline_allocs[p] = g_num_allocs.load() - allocs;
+                    if (!ok || pipeline_ids != ids) {
+                        fprintf(stderr, "%s: ids differ in pipeline %d\n", model.name, p);
+                        return -1;
+                    }
+                }
+            }
+            fused.set_word_cache_budget(0);
+            printf("%-7s %-5s   pipeline: unfused %7.2f MB/s (%.0f allocs/MB), spans %7.2f MB/s (%.1f allocs/MB), "
+                   "fused %7.2f MB/s (%.1f allocs/MB), fused %u threads %7.2f MB/s (%.1f allocs/MB), "
+                   "cached %7.2f MB/s (%.1f allocs/MB)\n",
+                   model.name, c.name,
+                   mb / pipeline_sec[0], double(pipeline_allocs[0]) / mb,
+                   mb / pipeline_sec[1], double(pipeline_allocs[1]) / mb,
+                   mb / pipeline_sec[2], double(pipeline_allocs[2]) / mb,
+                   num_threads, mb / pipeline_sec[3], double(pipeline_allocs[3]) / mb,
+                   mb / pipeline_sec[4], double(pipeline_allocs[4]) / mb);
+
+            // NFC input passes the quick check and must encode the same.
+            tok.set_normalization(UNICODE_NFC);
+            std::vector<int> nfc_ids;
+            if (!tok.encode(input, nfc_ids) || nfc_ids != ids) {
+                fprintf(stderr, "%s: ids differ with NFC normalization\n", model.name);
+                return -1;
+            }
+            tok.clear_normalization();
+        }
+    }
+
+    return 0;
+}
+#endif
+
+#ifdef BPE_TEST_MAIN
+#include <cstdio>
+
+#include "pretokenizer-dfa.hh"
+
+using namespace nanotokenizer;
+
+static void pretokenize_gpt4o(const char * text, size_t size, std::vector<pretoken_span> & spans)
+{
+    pretokenize_dfa(*pretokenizer_dfa_find("gpt4o"), text, size, spans);
+}
+
+int main(int argc, char **argv)
+{
+    // byte tokens and one merge that none of the inputs uses, so each byte
+    // of the normalized text is one id.
+    std::map<std::string, int> vocab;
+    for (uint32_t b = 0; b < 256; b++) {
+        vocab[unicode_byte_to_utf8(uint8_t(b))] = int(b);
+    }
+    vocab["qq"] = 256;
+    const std::vector<std::pair<std::string, std::string>> merges = {{"q", "q"}};
+
+    bpe_tokenizer tok(pretokenize_gpt2);
+    std::string err;
+    if (!tok.load(vocab, merges, err)) {
+        printf("load failed: %s\n", err.c_str());
+        return -1;
+    }
+
+    // normalization that makes the text longer.
+    const struct { unicode_normalization_form form; const char *input; } cases[] = {
+        {UNICODE_NFD, u8"café"},
+        {UNICODE_NFKC, u8"½"},
+        {UNICODE_NFKC, u8"x ㍿"},
+        {UNICODE_NFKD, u8"café"},
+        {UNICODE_NFKD, u8"½"},
+        {UNICODE_NFKD, u8"x ㍿"},
+    };
+    for (const auto &c : cases) {
+        const std::string normalized = unicode_normalize(c.form, c.input);
+        tok.set_normalization(c.form);
+        for (size_t budget : {size_t(0), size_t(64 * 1024)}) {
+            tok.set_word_cache_budget(budget);
+            std::vector<int> ids;
+            std::vector<int> parallel_ids;
+            std::string decoded;
+            if (!tok.encode(c.input, ids) || ids.size() != normalized.size() ||
+                !tok.decode(ids, decoded) || decoded != normalized ||
+                !tok.encode_parallel(c.input, parallel_ids, 1) || parallel_ids != ids) {
+                printf("encode(%d, %s) failed\n", int(c.form), c.input);
+                return -1;
+            }
+        }
+    }
+    tok.clear_normalization();
+    printf("normalized encode: OK\n");
+
+    // encode_parallel cuts batches at pretokenize_chunk_boundary, which must
+    // not split a word of any model. gpt4o keeps `[\r\n/]*` after
+    // punctuation, so "a.\n/b" is one place it could.
+    {
+        const char *pieces[] = {"a.\n/b", ".\n/", "\n", "\n\n", " ", "/", ".", "'s", "a", "Z", "7", "word",
+                                u8"é", u8"中", u8"🤩", "\r\n", "\t"};
+        const size_t num_pieces = sizeof(pieces) / sizeof(pieces[0]);
+        std::string text;
+        uint32_t seed = 42;
+        while (text.size() < 4 * bpe_tokenizer::kParallelMinBytes) {
+            seed = seed * 1664525u + 1013904223u;
+            text += pieces[(seed >> 8) % num_pieces];
+        }
+        // merges across ".\n/", so a split inside it changes the ids.
+        std::map<std::string, int> gpt4o_vocab = vocab;
+        gpt4o_vocab[".\xC4\x8A"] = 257;
+        gpt4o_vocab[".\xC4\x8A/"] = 258;
+        const std::vector<std::pair<std::string, std::string>> gpt4o_merges = {{".", "\xC4\x8A"}, {".\xC4\x8A", "/"}};
+        bpe_tokenizer gpt4o(pretokenize_gpt4o);
+        if (!gpt4o.load(gpt4o_vocab, gpt4o_merges, err)) {
+            printf("load failed: %s\n", err.c_str());
+            return -1;
+        }
+        std::vector<int> ids;
+        if (!gpt4o.encode(text, ids) || std::find(ids.begin(), ids.end(), 258) == ids.end()) {
+            printf("gpt4o encode failed\n");
+            return -1;
+        }
+        // twice per budget: the second call reuses the worker caches.
+        for (size_t budget : {size_t(0), size_t(64 * 1024), size_t(64 * 1024), size_t(1024)}) {
+            gpt4o.set_word_cache_budget(budget);
+            for (uint32_t num_threads : {1u, 3u, 8u}) {
+                std::vector<int> parallel_ids;
+                if (!gpt4o.encode_parallel(text, parallel_ids, num_threads) || parallel_ids != ids) {
+                    printf("gpt4o encode_parallel(%u threads, budget %zu) differs from encode\n", num_threads, budget);
+                    return -1;
+                }
+            }
+        }
+    }
+    printf("gpt4o encode_parallel: OK\n");
+
+    return 0;
+}
+#endif
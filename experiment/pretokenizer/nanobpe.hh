@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: MIT
+// Copyright 2024-Present Light Transport Entertainment Inc.
+//
+// Byte-level BPE(GPT-2, Llama-3, Qwen2 style) on top of nanopretokenizer.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nanopretokenizer.hh"
+#include "unicode-normalization.hh"
+
+namespace nanotokenizer {
+
+// Cache of pretoken bytes -> BPE ids.
+//
+// Open addressing(linear probing) over fixed slots. Keys and ids live in one
+// arena. When the arena or the slots fill up, entries not hit since the
+// previous eviction are dropped(CLOCK second chance), survivors are slid
+// down to the front of the arena and the slots are rebuilt in place, so an
+// eviction does not allocate.
+// Slots plus arena stay within `byte_budget`(at least `kMinByteBudget`).
+// Not thread-safe; use one per thread(see `bpe_tokenizer::set_word_cache_budget`).
+class bpe_word_cache {
+  public:
+    explicit bpe_word_cache(size_t byte_budget = 4 * 1024 * 1024);
+
+    // On hit, `ids` points into the arena and stays valid until the next `insert`.
+    bool find(const char * word, size_t size, const int * & ids, size_t & num_ids);
+
+    // Words longer than `kMaxWordBytes` or too large for the arena are not cached.
+    void insert(const char * word, size_t size, const int * ids, size_t num_ids);
+
+    void clear();
+
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+    uint64_t evictions() const { return _evictions; }
+    void reset_stats() { _hits = _misses = _evictions = 0; }
+
+    size_t size() const { return _num_entries; }
+    size_t memory_usage() const {
+        return _slots.size() * sizeof(entry) + _arena.size() * sizeof(uint32_t);
+    }
+
+    static const size_t kMaxWordBytes = 256;
+    static const size_t kMinByteBudget = 512;  // 16 slots and a 64-word arena
+
+  private:
+    struct entry {
+        uint64_t hash;  // 0: empty
+        uint32_t offset;  // in `_arena`: key bytes(padded to 4), then ids
+        uint16_t key_size;
+        uint8_t num_ids;
+        uint8_t referenced;
+    };
+
+    static uint64_t hash_bytes(const char * p, size_t n);
+    void evict();
+    entry * probe(uint64_t hash, const char * word, size_t size);
+
+    std::vector<entry> _slots;
+    size_t _slot_mask{0};
+    std::vector<uint32_t> _arena;
+    size_t _arena_used{0};  // in uint32_t
+    size_t _num_entries{0};
+    size_t _clock_hand{0};
+
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+    uint64_t _evictions{0};
+};
+
+struct bpe_worker_caches;  // nanobpe.cc
+
+class bpe_tokenizer {
+  public:
+    // `pretokenize`: word split rule of the model, e.g. `pretokenize_llama3`.
+    // `visit`: optional callback variant of the same rule. With it, each
+    // word is encoded as soon as the pretokenizer finds it, without
+    // collecting spans first.
+    explicit bpe_tokenizer(pretokenize_span_fn pretokenize, pretokenize_visit_rule visit = nullptr)
+        : _pretokenize(pretokenize), _visit(visit) {}
+
+    // `vocab`: token(byte-to-unicode mapped, as in vocab.json/tokenizer.json) -> id.
+    // `merges`: merge rules in rank order(merges.txt without the header).
+    // Every byte and every merge result must be in `vocab`.
+    bool load(const std::map<std::string, int> & vocab,
+              const std::vector<std::pair<std::string, std::string>> & merges,
+              std::string & err);
+
+    // Encode `text` into `out` without allocating. At most one id is
+    // written per byte of the normalized text. Without normalization
+    // `cap` >= `size` is always enough; normalization can make the text
+    // longer(NFKC of "½" is 5 bytes), and false is returned when `out` is
+    // too small. `encode` sizes for the normalized text. The number of ids
+    // written is stored to `out_len`.
+    bool encode_into(const char * text, size_t size, int * out, size_t cap, size_t & out_len) const;
+
+    // Same as above, but looks up and fills `cache` for each word.
+    // `cache` must only be used with this tokenizer.
+    bool encode_into(const char * text, size_t size, int * out, size_t cap, size_t & out_len, bpe_word_cache * cache) const;
+
+    bool encode(const std::string & text, std::vector<int> & ids) const;
+
+    // Documents smaller than this are encoded on the calling thread by
+    // `encode_parallel`.
+    static const size_t kParallelMinBytes = 512 * 1024;
+    static const size_t kParallelBatchBytes = 128 * 1024;
+
+    // Same result as `encode` for any split rule that keeps the
+    // `pretokenize_chunk_boundary` guarantee(all rules and DFA models in
+    // this directory). A large document is cut there into batches of about
+    // `kParallelBatchBytes`, which `num_threads`(0: hardware concurrency)
+    // threads take in order, each with its own scratch and word cache.
+    // Worker caches are kept by the tokenizer between calls(up to one per
+    // worker, `set_word_cache_budget` bytes each), so they stay warm.
+    // Batches write into their own range of `ids`, which is compacted at
+    // the end.
+    bool encode_parallel(const std::string & text, std::vector<int> & ids, uint32_t num_threads = 0) const;
+
+    // Normalize text(e.g. UNICODE_NFC) ahead of the pretokenizer. Text that
+    // passes the quick check is encoded without copying.
+    void set_normalization(unicode_normalization_form form) {
+        _normalize = true;
+        _normalization_form = form;
+    }
+    void clear_normalization() { _normalize = false; }
+
+    // Let `encode`/`encode_into` use a word cache of `byte_budget` bytes
+    // per calling thread(0 disables, smaller budgets are raised to
+    // `bpe_word_cache::kMinByteBudget`). Threads never share a cache, so
+    // there is no locking. A thread keeps the caches of the last
+    // `kThreadCaches` tokenizers it used, so alternating between them does
+    // not start over.
+    void set_word_cache_budget(size_t byte_budget) {
+        _cache_budget = byte_budget == 0 ? 0 : (std::max)(byte_budget, bpe_word_cache::kMinByteBudget);
+    }
+    static const size_t kThreadCaches = 4;
+
+    // Word cache of the calling thread for this tokenizer, or nullptr when
+    // disabled. Use it to read hit/miss counters.
+    bpe_word_cache * thread_word_cache() const;
+
+    // BPE of a single pretokenized word. Appends ids to `out`.
+    // Returns the number of ids, or 0 when they do not fit in `cap`.
+    size_t encode_word(const char * word, size_t size, int * out, size_t cap) const;
+
+    bool decode(const std::vector<int> & ids, std::string & text) const;
+
+    // Rank and result of merging `left` and `right`. Returns false when
+    // there is no such merge rule.
+    bool find_merge(int left, int right, uint32_t & rank, int & merged) const {
+        if (_pairs.empty()) {
+            return false;
+        }
+        const uint64_t key = pair_key(left, right);
+        for (size_t i = hash(key) & _pair_mask; ; i = (i + 1) & _pair_mask) {
+            const pair_entry & e = _pairs[i];
+            if (e.key == key) {
+                rank = e.rank;
+                merged = e.merged;
+                return true;
+            }
+            if (e.key == kEmptyKey) {
+                return false;
+            }
+        }
+    }
+
+    // id of the single-byte token of `byte`.
+    int byte_id(uint8_t byte) const { return _byte_to_id[byte]; }
+
+    size_t vocab_size() const { return _id_to_bytes.size(); }
+
+  private:
+    static const uint64_t kEmptyKey = ~uint64_t(0);
+
+    static uint64_t pair_key(int left, int right) {
+        return (uint64_t(uint32_t(left)) << 32) | uint32_t(right);
+    }
+
+    static size_t hash(uint64_t key) {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return size_t(key);
+    }
+
+    // Encode already normalized text.
+    bool encode_words(const char * text, size_t size, int * out, size_t cap, size_t & out_len, bpe_word_cache * cache) const;
+
+    // Normalize `text` into `buf` when enabled and needed, and point
+    // `text`/`size` at the result.
+    void normalize_input(const char * & text, size_t & size, std::string & buf) const;
+
+    // `encode_word` through `cache`(may be nullptr).
+    size_t encode_word_cached(const char * word, size_t size, int * out, size_t cap, bpe_word_cache * cache) const;
+
+    // `pretoken_visit_fn` of the fused path.
+    static void encode_visited(void * user, size_t offset, size_t length);
+
+    pretokenize_span_fn _pretokenize;
+    pretokenize_visit_rule _visit{nullptr};
+    bool _normalize{false};
+    unicode_normalization_form _normalization_form{UNICODE_NFC};
+    uint64_t _instance_id{0};  // unique per load(), binds thread caches
+    size_t _cache_budget{0};
+    std::shared_ptr<bpe_worker_caches> _worker_caches;  // of `encode_parallel`
+
+    int _byte_to_id[256]{};
+    std::vector<std::string> _id_to_bytes;  // raw bytes of each token
+
+    // merge rules: open addressing hash of (left, right) -> (rank, merged id)
+    struct pair_entry {
+        uint64_t key;
+        uint32_t rank;
+        int merged;
+    };
+    std::vector<pair_entry> _pairs;
+    size_t _pair_mask{0};
+};
+
+// Read merges.txt(`left right` per line, `#` lines are comments).
+bool bpe_read_merges(const std::string & filename, std::vector<std::pair<std::string, std::string>> & merges, std::string & err);
+
+} // namespace nanotokenizer
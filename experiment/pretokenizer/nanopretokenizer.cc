@@ -4,43 +4,354 @@
 // Copyright llama.cpp
 // Copyright 2024-Present Light Transport Entertainment Inc.
 //
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <thread>
 
 #include "nanopretokenizer.hh"
+#include "pretokenizer-dfa.hh"
 #include "unicode-util.hh"
 
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace nanotokenizer {
 
+namespace {
+
+static const uint32_t OUT_OF_RANGE = 0xFFFFFFFF;
+
+// ASCII character classes for run scanning.
+//
+//   class(c) = ascii_class_lo[c & 0xF] & ascii_class_hi[c >> 4]
+//
+// Each bit is a (high nibble set) x (low nibble set) product, so the lookup
+// is two PSHUFB(TBL on ARM). Bytes >= 0x80 have no class.
+enum : uint8_t {
+    ASCII_LETTER  = 0x03,  // [A-Za-z]: 0x41-0x4F 0x61-0x6F | 0x50-0x5A 0x70-0x7A
+    ASCII_DIGIT   = 0x04,  // [0-9]
+    ASCII_BLANK   = 0x18,  // [ \t\v\f]: 0x20 | 0x09 0x0B 0x0C
+    ASCII_NEWLINE = 0x20,  // [\r\n]
+    ASCII_SPACE   = ASCII_BLANK | ASCII_NEWLINE,  // \s
+};
+
+alignas(16) static const uint8_t ascii_class_lo[16] = {
+    0x0E, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x17, 0x23, 0x11, 0x11, 0x21, 0x01, 0x01,
+};
+
+alignas(16) static const uint8_t ascii_class_hi[16] = {
+    0x30, 0x00, 0x08, 0x04, 0x01, 0x02, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// codepoint_flags of ASCII, to skip the two-stage table in the hot loops.
+struct ascii_flags_table {
+    uint16_t flags[128];
+    ascii_flags_table() {
+        for (uint32_t c = 0; c < 128; c++) {
+            flags[c] = unicode_cpt_flags(c).as_uint();
+        }
+    }
+};
+
+static const ascii_flags_table ascii_flags;
+
+static inline uint8_t ascii_class(const uint8_t c) {
+    return ascii_class_lo[c & 0xF] & ascii_class_hi[c >> 4];
+}
+
+// Number of leading bytes of `p[0, n)` in any of the classes of `mask`.
+static size_t ascii_class_run(const char * p, const size_t n, const uint8_t mask) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i lo_tbl = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(ascii_class_lo)));
+    const __m256i hi_tbl = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(ascii_class_hi)));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i vmask = _mm256_set1_epi8(char(mask));
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+        const __m256i lo = _mm256_shuffle_epi8(lo_tbl, _mm256_and_si256(v, nibble));
+        const __m256i hi = _mm256_shuffle_epi8(hi_tbl, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+        const __m256i cls = _mm256_and_si256(_mm256_and_si256(lo, hi), vmask);
+        const uint32_t outside = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(cls, _mm256_setzero_si256())));
+        if (outside) {
+            return i + __builtin_ctz(outside);
+        }
+    }
+#elif defined(__SSSE3__)
+    const __m128i lo_tbl = _mm_load_si128(reinterpret_cast<const __m128i *>(ascii_class_lo));
+    const __m128i hi_tbl = _mm_load_si128(reinterpret_cast<const __m128i *>(ascii_class_hi));
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i vmask = _mm_set1_epi8(char(mask));
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+        const __m128i lo = _mm_shuffle_epi8(lo_tbl, _mm_and_si128(v, nibble));
+        const __m128i hi = _mm_shuffle_epi8(hi_tbl, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+        const __m128i cls = _mm_and_si128(_mm_and_si128(lo, hi), vmask);
+        const uint32_t outside = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(cls, _mm_setzero_si128())));
+        if (outside) {
+            return i + __builtin_ctz(outside);
+        }
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    const uint8x16_t lo_tbl = vld1q_u8(ascii_class_lo);
+    const uint8x16_t hi_tbl = vld1q_u8(ascii_class_hi);
+    const uint8x16_t nibble = vdupq_n_u8(0x0F);
+    const uint8x16_t vmask = vdupq_n_u8(mask);
+    for (; i + 16 <= n; i += 16) {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(p + i));
+        const uint8x16_t lo = vqtbl1q_u8(lo_tbl, vandq_u8(v, nibble));
+        const uint8x16_t hi = vqtbl1q_u8(hi_tbl, vshrq_n_u8(v, 4));
+        const uint8x16_t outside = vceqq_u8(vandq_u8(vandq_u8(lo, hi), vmask), vdupq_n_u8(0));
+        // 4 bits per byte
+        const uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(outside), 4)), 0);
+        if (bits) {
+            return i + (__builtin_ctzll(bits) >> 2);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (!(ascii_class(uint8_t(p[i])) & mask)) {
+            break;
+        }
+    }
+    return i;
+}
+
+// Decodes UTF-8 text on the fly for the pretokenize kernels.
+//
+// Kernels address codepoints by absolute index, but only the last
+// `kWindow` decoded codepoints(codepoint, flags, byte offset) are kept,
+// so memory use is O(1) regardless of the input size and flags are looked
+// up once per codepoint. Going back further than `kWindow` needs `rewind`.
+class cpt_window {
+  public:
+    static const size_t kWindow = 8;  // must be power of 2
+
+    cpt_window(const char * text, size_t size) : _text(text), _text_size(size) {}
+
+    // Restrict access to codepoints in [ini, end).
+    void set_range(size_t ini, size_t end) {
+        _range_ini = ini;
+        _range_end = end;
+    }
+
+    bool in_range(const size_t pos) {
+        if (pos < _range_ini || pos >= _range_end) {
+            return false;
+        }
+        while (pos >= _decoded) {
+            if (_byte_pos >= _text_size) {
+                return false;
+            }
+            decode_next();
+        }
+        return true;
+    }
+
+    uint32_t cpt(const size_t pos) {
+        return in_range(pos) ? entry(pos).cpt : OUT_OF_RANGE;
+    }
+
+    codepoint_flags flags(const size_t pos) {
+        return in_range(pos) ? codepoint_flags(entry(pos).flags) : codepoint_flags{};
+    }
+
+    // Returns false when `pos` is out of range.
+    bool get(const size_t pos, uint32_t & cpt, codepoint_flags & flags) {
+        if (!in_range(pos)) {
+            return false;
+        }
+        const cpt_entry & e = entry(pos);
+        cpt = e.cpt;
+        flags = codepoint_flags(e.flags);
+        return true;
+    }
+
+    // Byte offset of codepoint `pos`. `pos` must be decoded and within the
+    // window, or the next codepoint to be decoded.
+    size_t byte_offset(const size_t pos) const {
+        assert(pos <= _decoded);
+        if (pos == _decoded) {
+            return _byte_pos;
+        }
+        return entry(pos).byte_offset;
+    }
+
+    // Restart decoding at codepoint `pos` located at `byte_offset`.
+    void rewind(const size_t pos, const size_t byte_offset) {
+        _decoded = pos;
+        _byte_pos = byte_offset;
+        _window_ini = pos;  // entries before `pos` are no longer valid
+    }
+
+    // Returns the first position >= `pos` which is not an ASCII codepoint of
+    // the classes in `mask`. The run is scanned over raw bytes with SIMD
+    // instead of decoding codepoint by codepoint. The last `kWindow`
+    // codepoints of the run are decoded, so they stay accessible.
+    size_t skip_ascii(size_t pos, const uint8_t mask) {
+        auto in_run = [mask](const uint8_t c) { return (ascii_class(c) & mask) != 0; };
+        return skip_ascii_run(pos, in_run, [&](const char * p, const size_t limit) {
+            // Most runs are short words: check the first `kWindow` bytes, which
+            // are decoded into the ring anyway, before going SIMD.
+            size_t n = 0;
+            while (n < kWindow && n < limit && in_run(uint8_t(p[n]))) {
+                n++;
+            }
+            if (n == kWindow) {
+                n += ascii_class_run(p + n, limit - n, mask);
+            }
+            return n;
+        });
+    }
+
+    // Same as above for the ASCII codepoints `c` with bit `c` of `set` on.
+    size_t skip_ascii(size_t pos, const uint64_t set[2]) {
+        auto in = [set](const uint8_t c) { return c < 0x80 && ((set[c >> 6] >> (c & 63)) & 1); };
+        return skip_ascii_run(pos, in, [&](const char * p, const size_t limit) {
+            size_t n = 0;
+            while (n < limit && in(uint8_t(p[n]))) {
+                n++;
+            }
+            return n;
+        });
+    }
+
+    // Continue from codepoint `pos` located at `byte_offset`. Keeps decoded
+    // entries when `pos` is still inside the window.
+    void seek(const size_t pos, const size_t byte_offset) {
+        if (pos >= _window_ini && pos <= _decoded && pos + kWindow >= _decoded) {
+            return;
+        }
+        rewind(pos, byte_offset);
+    }
+
+  private:
+    struct cpt_entry {
+        uint32_t cpt;
+        uint16_t flags;
+        size_t byte_offset;
+    };
+
+    // `in_run(c)`: whether ASCII byte `c` is in the run. `scan(p, limit)`:
+    // length of the run at raw bytes `p`, at most `limit`.
+    template <class InRun, class Scan>
+    size_t skip_ascii_run(size_t pos, const InRun & in_run, const Scan & scan) {
+        for (; pos < _decoded; pos++) {
+            if (pos < _range_ini || pos >= _range_end) {
+                return pos;
+            }
+            const cpt_entry & e = entry(pos);
+            if (e.cpt >= 0x80 || !in_run(uint8_t(e.cpt))) {
+                return pos;
+            }
+        }
+        if (pos != _decoded || pos >= _range_end || _byte_pos >= _text_size) {
+            return pos;
+        }
+
+        const char * p = _text + _byte_pos;
+        const size_t n = scan(p, (std::min)(_text_size - _byte_pos, _range_end - pos));
+
+        // keep the last `kWindow` codepoints of the run. ASCII: one byte per codepoint.
+        for (size_t i = (n > kWindow ? n - kWindow : 0); i < n; i++) {
+            cpt_entry & e = _ring[(pos + i) & (kWindow - 1)];
+            e.byte_offset = _byte_pos + i;
+            e.cpt = uint8_t(p[i]);
+            e.flags = ascii_flags.flags[e.cpt];
+        }
+        _decoded += n;
+        _byte_pos += n;
+        return pos + n;
+    }
+
+    const cpt_entry & entry(const size_t pos) const {
+        assert(pos >= _window_ini && pos < _decoded && pos + kWindow >= _decoded);
+        return _ring[pos & (kWindow - 1)];
+    }
+
+    void decode_next() {
+        cpt_entry & e = _ring[_decoded & (kWindow - 1)];
+        e.byte_offset = _byte_pos;
+        const uint8_t c = uint8_t(_text[_byte_pos]);
+        if (c < 0x80) {
+            e.cpt = c;
+            e.flags = ascii_flags.flags[c];
+            _byte_pos++;
+        } else {
+            e.cpt = unicode_cpt_from_utf8(_text, _text_size, _byte_pos);
+            e.flags = unicode_cpt_flags(e.cpt).as_uint();
+        }
+        _decoded++;
+    }
+
+    const char * _text;
+    size_t _text_size;
+    size_t _byte_pos{0};  // byte offset of codepoint `_decoded`
+    size_t _decoded{0};   // number of codepoints decoded so far
+    size_t _window_ini{0};
+    size_t _range_ini{0};
+    size_t _range_end{0};
+    cpt_entry _ring[kWindow];
+};
+
+// Kernels report each word through an emitter:
+// emit(codepoint_length, byte_offset, byte_length)
+struct cpt_length_emitter {
+    std::vector<size_t> & out;
+    void operator()(size_t cpt_len, size_t, size_t) { out.push_back(cpt_len); }
+};
+
+struct span_emitter {
+    std::vector<pretoken_span> & out;
+    void operator()(size_t, size_t byte_offset, size_t byte_len) { out.push_back({byte_offset, byte_len}); }
+};
+
+struct visit_emitter {
+    pretoken_visit_fn visit;
+    void * user;
+    void operator()(size_t, size_t byte_offset, size_t byte_len) { visit(user, byte_offset, byte_len); }
+};
+
+} // namespace
+
 // GPT2 system regex:  's|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+
-std::vector<size_t> pretokenize_gpt2(const std::string & text, const std::vector<size_t> & offsets)
+template <class Emitter>
+static void pretokenize_gpt2_impl(cpt_window & win, const std::vector<size_t> & offsets, Emitter & emit)
 {
-    std::vector<size_t> bpe_offsets; // store the offset of each word
-    bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
-
-    const auto cpts = unicode_cpts_from_utf8(text);
+    // No offsets = single segment covering the whole text.
+    const size_t num_segments = offsets.empty() ? 1 : offsets.size();
 
     size_t start = 0;
-    for (auto offset : offsets) {
+    for (size_t seg = 0; seg < num_segments; seg++) {
         const size_t offset_ini = start;
-        const size_t offset_end = start + offset;
-        assert(offset_end <= cpts.size());
+        const size_t offset_end = offsets.empty() ? SIZE_MAX : start + offsets[seg];
         start = offset_end;
+        win.set_range(offset_ini, offset_end);
 
-        static const uint32_t OUT_OF_RANGE = 0xFFFFFFFF;
         auto _get_cpt = [&] (const size_t pos) -> uint32_t {
-            return (offset_ini <= pos && pos < offset_end) ? cpts[pos] : OUT_OF_RANGE;
+            return win.cpt(pos);
         };
 
         auto _get_flags = [&] (const size_t pos) -> codepoint_flags {
-            return (offset_ini <= pos && pos < offset_end) ? unicode_cpt_flags(cpts[pos]) : codepoint_flags{};
+            return win.flags(pos);
         };
 
         size_t _prev_end = offset_ini;
+        size_t _prev_end_byte = win.byte_offset(offset_ini);
         auto _add_token = [&] (const size_t end) -> size_t {
-            assert(_prev_end <= end && end <= offset_end);
+            assert(_prev_end <= end);
             size_t len = end - _prev_end;
             if (len > 0) {
-                bpe_offsets.push_back(len);
+                const size_t end_byte = win.byte_offset(end);
+                emit(len, _prev_end_byte, end_byte - _prev_end_byte);
+                _prev_end_byte = end_byte;
             }
             _prev_end = end;
             //if (len > 0) {
@@ -52,18 +363,18 @@ std::vector<size_t> pretokenize_gpt2(const std::string & text, const std::vector
             return len;
         };
 
-        for (size_t pos = offset_ini; pos < offset_end; /*pos++*/ ) {
+        for (size_t pos = offset_ini; win.in_range(pos); /*pos++*/ ) {
             const uint32_t cpt = _get_cpt(pos);
             const auto flags = _get_flags(pos);
 
             // regex: 's|'t|'re|'ve|'m|'ll|'d
-            if (cpt == '\'' && pos+1 < offset_end) {
+            if (cpt == '\'' && win.in_range(pos+1)) {
                 uint32_t cpt_next = _get_cpt(pos+1);
                 if (cpt_next == 's' || cpt_next == 't' || cpt_next == 'm' || cpt_next == 'd') {
                     pos += _add_token(pos+2);
                     continue;
                 }
-                if (pos+2 < offset_end) {
+                if (win.in_range(pos+2)) {
                     uint32_t cpt_next_next = _get_cpt(pos+2);
                     if ((cpt_next == 'r' && cpt_next_next == 'e') ||
                         (cpt_next == 'v' && cpt_next_next == 'e') ||
@@ -79,7 +390,8 @@ std::vector<size_t> pretokenize_gpt2(const std::string & text, const std::vector
             if (flags2.is_letter) {
                 pos += (cpt == ' ');
                 while (flags2.is_letter) {
-                    flags2 = _get_flags(++pos);
+                    pos = win.skip_ascii(pos+1, ASCII_LETTER);
+                    flags2 = _get_flags(pos);
                 }
                 _add_token(pos);
                 continue;
@@ -88,7 +400,8 @@ std::vector<size_t> pretokenize_gpt2(const std::string & text, const std::vector
             if (flags2.is_number) {
                 pos += (cpt == ' ');
                 while (flags2.is_number) {
-                    flags2 = _get_flags(++pos);
+                    pos = win.skip_ascii(pos+1, ASCII_DIGIT);
+                    flags2 = _get_flags(pos);
                 }
                 _add_token(pos);
                 continue;
@@ -105,7 +418,7 @@ std::vector<size_t> pretokenize_gpt2(const std::string & text, const std::vector
 
             size_t num_whitespaces = 0;
             while (_get_flags(pos+num_whitespaces).is_whitespace) {
-                num_whitespaces++;
+                num_whitespaces = win.skip_ascii(pos+num_whitespaces+1, ASCII_SPACE) - pos;
             }
 
             // regex: \s+(?!\S)
@@ -126,40 +439,39 @@ std::vector<size_t> pretokenize_gpt2(const std::string & text, const std::vector
             _add_token(++pos);
         }
     }
-
-    return bpe_offsets;
 }
 
 // LLAMA3 system regex: "(?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+"
-std::vector<size_t> pretokenize_llama3(const std::string & text, const std::vector<size_t> & offsets)
+template <class Emitter>
+static void pretokenize_llama3_impl(cpt_window & win, const std::vector<size_t> & offsets, Emitter & emit)
 {
-    std::vector<size_t> bpe_offsets; // store the offset of each word
-    bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
-
-    const auto cpts = unicode_cpts_from_utf8(text);
+    // No offsets = single segment covering the whole text.
+    const size_t num_segments = offsets.empty() ? 1 : offsets.size();
 
     size_t start = 0;
-    for (auto offset : offsets) {
+    for (size_t seg = 0; seg < num_segments; seg++) {
         const size_t offset_ini = start;
-        const size_t offset_end = start + offset;
-        assert(offset_end <= cpts.size());
+        const size_t offset_end = offsets.empty() ? SIZE_MAX : start + offsets[seg];
         start = offset_end;
+        win.set_range(offset_ini, offset_end);
 
-        static const uint32_t OUT_OF_RANGE = 0xFFFFFFFF;
         auto _get_cpt = [&] (const size_t pos) -> uint32_t {
-            return (offset_ini <= pos && pos < offset_end) ? cpts[pos] : OUT_OF_RANGE;
+            return win.cpt(pos);
         };
 
         auto _get_flags = [&] (const size_t pos) -> codepoint_flags {
-            return (offset_ini <= pos && pos < offset_end) ? unicode_cpt_flags(cpts[pos]) : codepoint_flags{};
+            return win.flags(pos);
         };
 
         size_t _prev_end = offset_ini;
+        size_t _prev_end_byte = win.byte_offset(offset_ini);
         auto _add_token = [&] (const size_t end) -> size_t {
-            assert(_prev_end <= end && end <= offset_end);
+            assert(_prev_end <= end);
             size_t len = end - _prev_end;
             if (len > 0) {
-                bpe_offsets.push_back(len);
+                const size_t end_byte = win.byte_offset(end);
+                emit(len, _prev_end_byte, end_byte - _prev_end_byte);
+                _prev_end_byte = end_byte;
             }
             _prev_end = end;
             //if (len > 0) {
@@ -171,18 +483,18 @@ std::vector<size_t> pretokenize_llama3(const std::string & text, const std::vect
             return len;
         };
 
-        for (size_t pos = offset_ini; pos < offset_end; /*pos++*/ ) {
+        for (size_t pos = offset_ini; win.in_range(pos); /*pos++*/ ) {
             const uint32_t cpt = _get_cpt(pos);
             const auto flags = _get_flags(pos);
 
             // regex: (?i:'s|'t|'re|'ve|'m|'ll|'d) // case insensitive
-            if (cpt == '\'' && pos+1 < offset_end) {
+            if (cpt == '\'' && win.in_range(pos+1)) {
                 uint32_t cpt_next = unicode_tolower(_get_cpt(pos+1));
                 if (cpt_next == 's' || cpt_next == 't' || cpt_next == 'm' || cpt_next == 'd') {
                     pos += _add_token(pos+2);
                     continue;
                 }
-                if (pos+2 < offset_end) {
+                if (win.in_range(pos+2)) {
                     uint32_t cpt_next_next = unicode_tolower(_get_cpt(pos+2));
                     if ((cpt_next == 'r' && cpt_next_next == 'e') ||
                         (cpt_next == 'v' && cpt_next_next == 'e') ||
@@ -196,9 +508,9 @@ std::vector<size_t> pretokenize_llama3(const std::string & text, const std::vect
             // regex: [^\r\n\p{L}\p{N}]?\p{L}+
             if (!(cpt == '\r' || cpt == '\n' || flags.is_number)) {
                 if (flags.is_letter || _get_flags(pos+1).is_letter) {  // one or more letters
-                    pos++;
+                    pos = win.skip_ascii(pos+1, ASCII_LETTER);
                     while (_get_flags(pos).is_letter) {
-                        pos++;
+                        pos = win.skip_ascii(pos+1, ASCII_LETTER);
                     }
                     _add_token(pos);
                     continue;
@@ -208,6 +520,17 @@ std::vector<size_t> pretokenize_llama3(const std::string & text, const std::vect
             // regex: \p{N}{1,3}
             if (flags.is_number) {
                 size_t ini = pos;
+                assert(_prev_end == pos);
+                // ASCII digits are one byte each, so chunks of the leading
+                // ASCII run are emitted without decoding them.
+                const size_t ascii_end = win.skip_ascii(pos, ASCII_DIGIT);
+                while (ascii_end - ini >= 3) {
+                    emit(3, _prev_end_byte, 3);
+                    _prev_end_byte += 3;
+                    _prev_end += 3;
+                    ini += 3;
+                }
+                pos = ascii_end;
                 while (_get_flags(pos).is_number) {
                     if (++pos - ini >= 3 ) {
                         _add_token(pos);
@@ -235,17 +558,21 @@ std::vector<size_t> pretokenize_llama3(const std::string & text, const std::vect
 
             size_t num_whitespaces = 0;
             size_t last_end_r_or_n = 0;
+            size_t last_end_r_or_n_byte = 0;
             while (_get_flags(pos+num_whitespaces).is_whitespace) {
                 uint32_t cpt2 = _get_cpt(pos+num_whitespaces);
                 if (cpt2 == '\r' || cpt2 == '\n') {
                     last_end_r_or_n = pos + num_whitespaces + 1;
+                    last_end_r_or_n_byte = win.byte_offset(pos + num_whitespaces) + 1;
                 }
-                num_whitespaces++;
+                num_whitespaces = win.skip_ascii(pos+num_whitespaces+1, ASCII_BLANK) - pos;
             }
 
             // regex: \s*[\r\n]+
             if (last_end_r_or_n > 0) {
                 pos = last_end_r_or_n;
+                // whitespace run may be longer than the window.
+                win.rewind(pos, last_end_r_or_n_byte);
                 _add_token(pos);
                 continue;
             }
@@ -268,11 +595,10 @@ std::vector<size_t> pretokenize_llama3(const std::string & text, const std::vect
             _add_token(++pos);
         }
     }
-
-    return bpe_offsets;
 }
 
-std::vector<size_t> pretokenize_qwen2(const std::string & text, const std::vector<size_t> & offsets)
+template <class Emitter>
+static void pretokenize_qwen2_impl(cpt_window & win, const std::vector<size_t> & offsets, Emitter & emit)
 {
   //  "(?:'[sS]|'[tT]|'[rR][eE]|'[vV][eE]|'[mM]|'[lL][lL]|'[dD])|[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+"
   //  Its similar to llama3, but digit string is limited to single character.
@@ -292,33 +618,33 @@ std::vector<size_t> pretokenize_qwen2(const std::string & text, const std::vecto
   // - \\s+
   //   whitespace+
 
-    std::vector<size_t> bpe_offsets; // store the offset of each word
-    bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
-
-    const auto cpts = unicode_cpts_from_utf8(text);
+    // No offsets = single segment covering the whole text.
+    const size_t num_segments = offsets.empty() ? 1 : offsets.size();
 
     size_t start = 0;
-    for (auto offset : offsets) {
+    for (size_t seg = 0; seg < num_segments; seg++) {
         const size_t offset_ini = start;
-        const size_t offset_end = start + offset;
-        assert(offset_end <= cpts.size());
+        const size_t offset_end = offsets.empty() ? SIZE_MAX : start + offsets[seg];
         start = offset_end;
+        win.set_range(offset_ini, offset_end);
 
-        static const uint32_t OUT_OF_RANGE = 0xFFFFFFFF;
         auto _get_cpt = [&] (const size_t pos) -> uint32_t {
-            return (offset_ini <= pos && pos < offset_end) ? cpts[pos] : OUT_OF_RANGE;
+            return win.cpt(pos);
         };
 
         auto _get_flags = [&] (const size_t pos) -> codepoint_flags {
-            return (offset_ini <= pos && pos < offset_end) ? unicode_cpt_flags(cpts[pos]) : codepoint_flags{};
+            return win.flags(pos);
         };
 
         size_t _prev_end = offset_ini;
+        size_t _prev_end_byte = win.byte_offset(offset_ini);
         auto _add_token = [&] (const size_t end) -> size_t {
-            assert(_prev_end <= end && end <= offset_end);
+            assert(_prev_end <= end);
             size_t len = end - _prev_end;
             if (len > 0) {
-                bpe_offsets.push_back(len);
+                const size_t end_byte = win.byte_offset(end);
+                emit(len, _prev_end_byte, end_byte - _prev_end_byte);
+                _prev_end_byte = end_byte;
             }
             _prev_end = end;
             //if (len > 0) {
@@ -330,18 +656,18 @@ std::vector<size_t> pretokenize_qwen2(const std::string & text, const std::vecto
             return len;
         };
 
-        for (size_t pos = offset_ini; pos < offset_end; /*pos++*/ ) {
+        for (size_t pos = offset_ini; win.in_range(pos); /*pos++*/ ) {
             const uint32_t cpt = _get_cpt(pos);
             const auto flags = _get_flags(pos);
 
             // regex: (?i:'s|'t|'re|'ve|'m|'ll|'d) // case insensitive
-            if (cpt == '\'' && pos+1 < offset_end) {
+            if (cpt == '\'' && win.in_range(pos+1)) {
                 uint32_t cpt_next = unicode_tolower(_get_cpt(pos+1));
                 if (cpt_next == 's' || cpt_next == 't' || cpt_next == 'm' || cpt_next == 'd') {
                     pos += _add_token(pos+2);
                     continue;
                 }
-                if (pos+2 < offset_end) {
+                if (win.in_range(pos+2)) {
                     uint32_t cpt_next_next = unicode_tolower(_get_cpt(pos+2));
                     if ((cpt_next == 'r' && cpt_next_next == 'e') ||
                         (cpt_next == 'v' && cpt_next_next == 'e') ||
@@ -355,9 +681,9 @@ std::vector<size_t> pretokenize_qwen2(const std::string & text, const std::vecto
             // regex: [^\r\n\p{L}\p{N}]?\p{L}+
             if (!(cpt == '\r' || cpt == '\n' || flags.is_number)) {
                 if (flags.is_letter || _get_flags(pos+1).is_letter) {  // one or more letters
-                    pos++;
+                    pos = win.skip_ascii(pos+1, ASCII_LETTER);
                     while (_get_flags(pos).is_letter) {
-                        pos++;
+                        pos = win.skip_ascii(pos+1, ASCII_LETTER);
                     }
                     _add_token(pos);
                     continue;
@@ -366,6 +692,7 @@ std::vector<size_t> pretokenize_qwen2(const std::string & text, const std::vecto
 
             // regex: \p{N}
             if (flags.is_number) {
+                pos++;
                 _add_token(pos);
                 continue;
             }
@@ -387,17 +714,21 @@ std::vector<size_t> pretokenize_qwen2(const std::string & text, const std::vecto
 
             size_t num_whitespaces = 0;
             size_t last_end_r_or_n = 0;
+            size_t last_end_r_or_n_byte = 0;
             while (_get_flags(pos+num_whitespaces).is_whitespace) {
                 uint32_t cpt2 = _get_cpt(pos+num_whitespaces);
                 if (cpt2 == '\r' || cpt2 == '\n') {
                     last_end_r_or_n = pos + num_whitespaces + 1;
+                    last_end_r_or_n_byte = win.byte_offset(pos + num_whitespaces) + 1;
                 }
-                num_whitespaces++;
+                num_whitespaces = win.skip_ascii(pos+num_whitespaces+1, ASCII_BLANK) - pos;
             }
 
             // regex: \s*[\r\n]+
             if (last_end_r_or_n > 0) {
                 pos = last_end_r_or_n;
+                // whitespace run may be longer than the window.
+                win.rewind(pos, last_end_r_or_n_byte);
                 _add_token(pos);
                 continue;
             }
@@ -420,13 +751,389 @@ std::vector<size_t> pretokenize_qwen2(const std::string & text, const std::vecto
             _add_token(++pos);
         }
     }
+}
+
+static inline uint32_t pretokenize_dfa_class(const pretokenizer_dfa_stage & dfa, const uint32_t cpt, const codepoint_flags flags)
+{
+    if (cpt < 128) {
+        return dfa.ascii_class[cpt];
+    }
+    uint32_t bucket = 0;
+    if (dfa.bucket_stage1) {
+        if (cpt >= 0x110000) {
+            bucket = dfa.num_buckets - 1;  // invalid UTF-8
+        } else {
+            const uint32_t block = dfa.bucket_stage1[cpt >> PRETOKENIZER_DFA_BUCKET_BLOCK_BITS];
+            bucket = dfa.bucket_stage2[(block << PRETOKENIZER_DFA_BUCKET_BLOCK_BITS) | (cpt & PRETOKENIZER_DFA_BUCKET_BLOCK_MASK)];
+        }
+    }
+    const uint32_t key = pretokenizer_dfa_key(flags.as_uint()) & ((1u << dfa.key_bits) - 1);
+    return dfa.nonascii_class[(bucket << dfa.key_bits) | key];
+}
+
+// Runs one DFA stage. Matches become words, text between matches is kept
+// as one word(HuggingFace `Split` with `Isolated` behavior).
+template <class Emitter>
+static void pretokenize_dfa_stage_impl(const pretokenizer_dfa_stage & dfa, cpt_window & win, const std::vector<size_t> & offsets, Emitter & emit)
+{
+    const uint32_t stride = dfa.num_classes + 1;
+    const uint32_t end_of_text = dfa.num_classes;
+    const uint16_t * start_transitions = dfa.transitions + PRETOKENIZER_DFA_START * stride;
+
+    // ASCII codepoints which cannot start a match. Runs of them(e.g. all but
+    // digits for \p{N}{1,3}) are skipped over raw bytes without the DFA.
+    uint64_t ascii_no_start[2] = {0, 0};
+    for (uint32_t c = 0; c < 128; c++) {
+        if ((start_transitions[dfa.ascii_class[c]] & PRETOKENIZER_DFA_STATE_MASK) == 0) {
+            ascii_no_start[c >> 6] |= uint64_t(1) << (c & 63);
+        }
+    }
+
+    // No offsets = single segment covering the whole text.
+    const size_t num_segments = offsets.empty() ? 1 : offsets.size();
+
+    size_t start = 0;
+    for (size_t seg = 0; seg < num_segments; seg++) {
+        const size_t offset_ini = start;
+        const size_t offset_end = offsets.empty() ? SIZE_MAX : start + offsets[seg];
+        start = offset_end;
+        win.set_range(offset_ini, offset_end);
+
+        size_t _prev_end = offset_ini;
+        size_t _prev_end_byte = win.byte_offset(offset_ini);
+        auto _add_token = [&] (const size_t end, const size_t end_byte) {
+            assert(_prev_end <= end);
+            if (end > _prev_end) {
+                emit(end - _prev_end, _prev_end_byte, end_byte - _prev_end_byte);
+            }
+            _prev_end = end;
+            _prev_end_byte = end_byte;
+        };
+
+        size_t pos = offset_ini;
+        size_t pos_byte = _prev_end_byte;
+        uint32_t cpt;
+        codepoint_flags flags;
+        while (win.get(pos, cpt, flags)) {
+            // no match starts here: part of the unmatched text.
+            if (cpt < 128 && ((ascii_no_start[cpt >> 6] >> (cpt & 63)) & 1)) {
+                pos = win.skip_ascii(pos, ascii_no_start);
+                pos_byte = win.byte_offset(pos);
+                continue;
+            }
+            const uint32_t cls0 = pretokenize_dfa_class(dfa, cpt, flags);
+            const size_t next_byte = win.byte_offset(pos + 1);
+            if ((start_transitions[cls0] & PRETOKENIZER_DFA_STATE_MASK) == 0) {
+                pos++;
+                pos_byte = next_byte;
+                continue;
+            }
+
+            // Longest match from `pos` with leftmost-first priority.
+            uint32_t state = PRETOKENIZER_DFA_START;
+            size_t match_end = pos;
+            size_t match_end_byte = pos_byte;
+            for (size_t p = pos; ; p++) {
+                const uint32_t cls = (p == pos) ? cls0 : win.get(p, cpt, flags) ? pretokenize_dfa_class(dfa, cpt, flags) : end_of_text;
+                const uint16_t t = dfa.transitions[state * stride + cls];
+                if (t & PRETOKENIZER_DFA_MATCH) {
+                    match_end = p;
+                    match_end_byte = win.byte_offset(p);
+                }
+                state = t & PRETOKENIZER_DFA_STATE_MASK;
+                if (state == 0 || cls == end_of_text) {
+                    break;
+                }
+                // ASCII run which stays in `state`(e.g. letters of \p{L}+):
+                // skip it over raw bytes. Its transitions share one match bit.
+                const uint64_t * loop = dfa.ascii_loop + 2 * state;
+                if ((loop[0] | loop[1]) != 0) {
+                    const size_t q = win.skip_ascii(p + 1, loop);
+                    if (q > p + 1) {
+                        p = q - 1;
+                        if (dfa.transitions[state * stride + dfa.ascii_class[win.cpt(p)]] & PRETOKENIZER_DFA_MATCH) {
+                            match_end = p;
+                            match_end_byte = win.byte_offset(p);
+                        }
+                    }
+                }
+            }
+
+            if (match_end > pos) {
+                _add_token(pos, pos_byte);  // unmatched text before the match
+                _add_token(match_end, match_end_byte);
+                pos = match_end;
+                pos_byte = match_end_byte;
+            } else {
+                pos++;
+                pos_byte = next_byte;
+            }
+            win.seek(pos, pos_byte);
+        }
+
+        // unmatched text at the end of segment
+        _add_token(pos, pos_byte);
+    }
+}
+
+template <class Emitter>
+static void pretokenize_dfa_impl(const pretokenizer_dfa & dfa, const char * text, size_t size, const std::vector<size_t> & offsets, Emitter & emit)
+{
+    if (dfa.num_stages == 0) {
+        return;
+    }
+
+    // Each stage splits the words of the previous stage.
+    std::vector<size_t> cur;
+    std::vector<size_t> next;
+    const std::vector<size_t> * segments = &offsets;
+    for (uint32_t i = 0; i + 1 < dfa.num_stages; i++) {
+        cpt_window win(text, size);
+        next.clear();
+        cpt_length_emitter stage_emit{next};
+        pretokenize_dfa_stage_impl(dfa.stages[i], win, *segments, stage_emit);
+        cur.swap(next);
+        segments = &cur;
+        if (cur.empty()) {
+            return;
+        }
+    }
+
+    cpt_window win(text, size);
+    pretokenize_dfa_stage_impl(dfa.stages[dfa.num_stages - 1], win, *segments, emit);
+}
+
+std::vector<size_t> pretokenize_gpt2(const std::string & text, const std::vector<size_t> & offsets)
+{
+    std::vector<size_t> bpe_offsets; // store the offset of each word
+    bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
+
+    cpt_window win(text.data(), text.size());
+    cpt_length_emitter emit{bpe_offsets};
+    pretokenize_gpt2_impl(win, offsets, emit);
+
+    return bpe_offsets;
+}
+
+void pretokenize_gpt2(const char * text, size_t size, std::vector<pretoken_span> & spans)
+{
+    spans.clear();
+
+    static const std::vector<size_t> whole_text;
+    cpt_window win(text, size);
+    span_emitter emit{spans};
+    pretokenize_gpt2_impl(win, whole_text, emit);
+}
+
+void pretokenize_gpt2(const std::string & text, std::vector<pretoken_span> & spans)
+{
+    pretokenize_gpt2(text.data(), text.size(), spans);
+}
+
+void pretokenize_gpt2(const char * text, size_t size, pretoken_visit_fn visit, void * user)
+{
+    static const std::vector<size_t> whole_text;
+    cpt_window win(text, size);
+    visit_emitter emit{visit, user};
+    pretokenize_gpt2_impl(win, whole_text, emit);
+}
+
+std::vector<size_t> pretokenize_llama3(const std::string & text, const std::vector<size_t> & offsets)
+{
+    std::vector<size_t> bpe_offsets; // store the offset of each word
+    bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
+
+    cpt_window win(text.data(), text.size());
+    cpt_length_emitter emit{bpe_offsets};
+    pretokenize_llama3_impl(win, offsets, emit);
+
+    return bpe_offsets;
+}
+
+void pretokenize_llama3(const char * text, size_t size, std::vector<pretoken_span> & spans)
+{
+    spans.clear();
+
+    static const std::vector<size_t> whole_text;
+    cpt_window win(text, size);
+    span_emitter emit{spans};
+    pretokenize_llama3_impl(win, whole_text, emit);
+}
+
+void pretokenize_llama3(const std::string & text, std::vector<pretoken_span> & spans)
+{
+    pretokenize_llama3(text.data(), text.size(), spans);
+}
+
+void pretokenize_llama3(const char * text, size_t size, pretoken_visit_fn visit, void * user)
+{
+    static const std::vector<size_t> whole_text;
+    cpt_window win(text, size);
+    visit_emitter emit{visit, user};
+    pretokenize_llama3_impl(win, whole_text, emit);
+}
+
+std::vector<size_t> pretokenize_qwen2(const std::string & text, const std::vector<size_t> & offsets)
+{
+    std::vector<size_t> bpe_offsets; // store the offset of each word
+    bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
+
+    cpt_window win(text.data(), text.size());
+    cpt_length_emitter emit{bpe_offsets};
+    pretokenize_qwen2_impl(win, offsets, emit);
+
+    return bpe_offsets;
+}
+
+void pretokenize_qwen2(const char * text, size_t size, std::vector<pretoken_span> & spans)
+{
+    spans.clear();
+
+    static const std::vector<size_t> whole_text;
+    cpt_window win(text, size);
+    span_emitter emit{spans};
+    pretokenize_qwen2_impl(win, whole_text, emit);
+}
+
+void pretokenize_qwen2(const std::string & text, std::vector<pretoken_span> & spans)
+{
+    pretokenize_qwen2(text.data(), text.size(), spans);
+}
+
+void pretokenize_qwen2(const char * text, size_t size, pretoken_visit_fn visit, void * user)
+{
+    static const std::vector<size_t> whole_text;
+    cpt_window win(text, size);
+    visit_emitter emit{visit, user};
+    pretokenize_qwen2_impl(win, whole_text, emit);
+}
+
+static inline bool is_ascii_non_space(const char c) {
+    return uint8_t(c) < 0x80 && !(ascii_class(uint8_t(c)) & ASCII_SPACE);
+}
+
+static inline bool is_ascii_alnum(const char c) {
+    return uint8_t(c) < 0x80 && (ascii_class(uint8_t(c)) & (ASCII_LETTER | ASCII_DIGIT));
+}
+
+size_t pretokenize_chunk_boundary(const char * text, const size_t size, size_t from) {
+    from = (std::max)(from, size_t(1));
+    while (from + 1 < size) {
+        const char * p = static_cast<const char *>(memchr(text + from, '\n', size - from - 1));
+        if (!p) {
+            break;
+        }
+        const size_t nl = size_t(p - text);
+        // `Y` must be alphanumeric: gpt4o's ` ?[^\s\p{L}\p{N}]+[\r\n/]*` carries
+        // a punctuation word across `\n` into a following `/`.
+        if (is_ascii_non_space(text[nl - 1]) && is_ascii_alnum(text[nl + 1])) {
+            return nl + 1;
+        }
+        from = nl + 1;
+    }
+    return size;
+}
+
+void pretokenize_parallel(pretokenize_span_fn fn, const char * text, size_t size, std::vector<pretoken_span> & spans, uint32_t num_threads)
+{
+    if (num_threads == 0) {
+        num_threads = (std::max)(1u, std::thread::hardware_concurrency());
+    }
+
+    // Small texts are not worth spawning threads.
+    const size_t kMinChunkBytes = 64 * 1024;
+    const size_t num_chunks = (std::min)(size_t(num_threads), (std::max)(size_t(1), size / kMinChunkBytes));
+
+    // chunk `i` is [bounds[i], bounds[i + 1])
+    std::vector<size_t> bounds{0};
+    for (size_t i = 1; i < num_chunks; i++) {
+        const size_t b = pretokenize_chunk_boundary(text, size, (std::max)(bounds.back() + 1, (size * i) / num_chunks));
+        if (b >= size) {
+            break;
+        }
+        bounds.push_back(b);
+    }
+    bounds.push_back(size);
+
+    if (bounds.size() == 2) {
+        fn(text, size, spans);
+        return;
+    }
+
+    std::vector<std::vector<pretoken_span>> chunk_spans(bounds.size() - 1);
+    std::vector<std::thread> workers;
+    workers.reserve(chunk_spans.size());
+    for (size_t i = 0; i < chunk_spans.size(); i++) {
+        workers.emplace_back([&, i] () {
+            fn(text + bounds[i], bounds[i + 1] - bounds[i], chunk_spans[i]);
+        });
+    }
+    for (auto & w : workers) {
+        w.join();
+    }
+
+    size_t total = 0;
+    for (const auto & cs : chunk_spans) {
+        total += cs.size();
+    }
+    spans.clear();
+    spans.reserve(total);
+    for (size_t i = 0; i < chunk_spans.size(); i++) {
+        for (const auto & span : chunk_spans[i]) {
+            spans.push_back({span.offset + bounds[i], span.length});
+        }
+    }
+}
+
+std::vector<size_t> pretokenize_dfa(const pretokenizer_dfa & dfa, const std::string & text, const std::vector<size_t> & offsets)
+{
+    std::vector<size_t> bpe_offsets; // store the offset of each word
+    bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
+
+    cpt_length_emitter emit{bpe_offsets};
+    pretokenize_dfa_impl(dfa, text.data(), text.size(), offsets, emit);
 
     return bpe_offsets;
 }
 
+void pretokenize_dfa(const pretokenizer_dfa & dfa, const char * text, size_t size, std::vector<pretoken_span> & spans)
+{
+    spans.clear();
+
+    static const std::vector<size_t> whole_text;
+    span_emitter emit{spans};
+    pretokenize_dfa_impl(dfa, text, size, whole_text, emit);
+}
+
+void pretokenize_dfa(const pretokenizer_dfa & dfa, const std::string & text, std::vector<pretoken_span> & spans)
+{
+    pretokenize_dfa(dfa, text.data(), text.size(), spans);
+}
+
+void pretokenize_dfa(const pretokenizer_dfa & dfa, const char * text, size_t size, pretoken_visit_fn visit, void * user)
+{
+    static const std::vector<size_t> whole_text;
+    visit_emitter emit{visit, user};
+    pretokenize_dfa_impl(dfa, text, size, whole_text, emit);
+}
+
+const pretokenizer_dfa * pretokenizer_dfa_find(const std::string & name)
+{
+    for (uint32_t i = 0; i < pretokenizer_dfa_num_models; i++) {
+        if (name == pretokenizer_dfa_models[i].name) {
+            return &pretokenizer_dfa_models[i];
+        }
+    }
+    return nullptr;
+}
+
 }
 
 #ifdef TEST_MAIN
+#include <cstdio>
+#include "pretokenizer-dfa.hh"
+#include "unicode-data.hh"
+#include "unicode-normalization.hh"
 
 int main(int argc, char **argv)
 {
@@ -435,10 +1142,426 @@ int main(int argc, char **argv)
   std::vector<size_t> ret;
   ret = nanotokenizer::pretokenize_qwen2(input, offsets);
 
+  std::vector<nanotokenizer::pretoken_span> spans;
+  nanotokenizer::pretokenize_qwen2(input, spans);
+  for (const auto &span : spans) {
+    printf("'%s'\n", input.substr(span.offset, span.length).c_str());
+  }
+
+  // pretokenize_parallel must match the single-threaded result.
+  {
+    const char *lines[] = {
+      "The quick brown fox jumps over the lazy dog.",
+      "It's 12:30, isn't it? I'll say we'd've gone.",
+      u8"吾輩は猫である。名前はまだ無い。",
+      u8"Привет, мир! Как дела?",
+      u8"天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。",
+      u8"مرحبا بالعالم",
+      u8"🤩🤩 Ça va? naïve café",
+      "    for (size_t i = 0; i < n; i++) {",
+      "\t\treturn EXIT_SUCCESS;",
+      "trailing spaces   ",
+      u8"trailing ideographic space　",
+      "3.14159265358979323846264338327950288",
+      "",
+      "    ",
+      "crlf line\r",
+      "!!!",
+    };
+    const size_t nlines = sizeof(lines) / sizeof(lines[0]);
+
+    std::string corpus;
+    uint32_t seed = 12345;
+    while (corpus.size() < 1024 * 1024) {
+      seed = seed * 1103515245u + 12345u;
+      corpus += lines[(seed >> 16) % nlines];
+      corpus += ((seed >> 8) % 7 == 0) ? "\n\n" : "\n";
+    }
+
+    const struct { const char *name; nanotokenizer::pretokenize_span_fn fn; } kernels[] = {
+      {"gpt2", nanotokenizer::pretokenize_gpt2},
+      {"llama3", nanotokenizer::pretokenize_llama3},
+      {"qwen2", nanotokenizer::pretokenize_qwen2},
+    };
+
+    std::vector<nanotokenizer::pretoken_span> serial;
+    std::vector<nanotokenizer::pretoken_span> parallel;
+    for (const auto &k : kernels) {
+      k.fn(corpus.data(), corpus.size(), serial);
+      for (uint32_t num_threads : {2u, 3u, 8u, 13u}) {
+        nanotokenizer::pretokenize_parallel(k.fn, corpus.data(), corpus.size(), parallel, num_threads);
+        bool same = serial.size() == parallel.size();
+        for (size_t i = 0; same && i < serial.size(); i++) {
+          same = (serial[i].offset == parallel[i].offset) && (serial[i].length == parallel[i].length);
+        }
+        if (!same) {
+          printf("pretokenize_parallel(%s, %u threads) mismatch\n", k.name, num_threads);
+          return -1;
+        }
+      }
+    }
+    printf("pretokenize_parallel: OK\n");
+  }
+
+  // Every rule and DFA model must split the same at pretokenize_chunk_boundary
+  // as over the whole text. Random text from fragments around `\n`.
+  {
+    const char *pieces[] = {
+      "\n", "\n", "\n", "\r", " ", "\t", "/", ".", "'", "'s", "a", "Z", "7", "123",
+      "word", u8"é", u8"\u0301", u8"中", u8"\u3000", u8"🤩", "_", "-", "\"",
+    };
+    const size_t npieces = sizeof(pieces) / sizeof(pieces[0]);
+    std::string text;
+    uint32_t seed = 4242;
+    while (text.size() < 256 * 1024) {
+      seed = seed * 1664525u + 1013904223u;
+      text += pieces[(seed >> 8) % npieces];
+    }
+
+    struct rule { std::string name; nanotokenizer::pretokenize_span_fn fn; const nanotokenizer::pretokenizer_dfa *dfa; };
+    std::vector<rule> rules = {
+      {"gpt2", nanotokenizer::pretokenize_gpt2, nullptr},
+      {"llama3", nanotokenizer::pretokenize_llama3, nullptr},
+      {"qwen2", nanotokenizer::pretokenize_qwen2, nullptr},
+    };
+    for (uint32_t m = 0; m < nanotokenizer::pretokenizer_dfa_num_models; m++) {
+      const nanotokenizer::pretokenizer_dfa &dfa = nanotokenizer::pretokenizer_dfa_models[m];
+      rules.push_back({std::string("dfa:") + dfa.name, nullptr, &dfa});
+    }
+    auto split = [](const rule &r, const char *t, size_t n, std::vector<nanotokenizer::pretoken_span> &out) {
+      if (r.dfa) {
+        nanotokenizer::pretokenize_dfa(*r.dfa, t, n, out);
+      } else {
+        r.fn(t, n, out);
+      }
+    };
+
+    std::vector<nanotokenizer::pretoken_span> whole;
+    std::vector<nanotokenizer::pretoken_span> chunked;
+    std::vector<nanotokenizer::pretoken_span> chunk;
+    for (const auto &r : rules) {
+      split(r, text.data(), text.size(), whole);
+      chunked.clear();
+      size_t nchunks = 0;
+      for (size_t begin = 0; begin < text.size(); nchunks++) {
+        const size_t end = nanotokenizer::pretokenize_chunk_boundary(text.data(), text.size(), begin + 1 + (begin * 7) % 61);
+        split(r, text.data() + begin, end - begin, chunk);
+        for (const auto &span : chunk) {
+          chunked.push_back({span.offset + begin, span.length});
+        }
+        begin = end;
+      }
+      bool same = nchunks > 1 && whole.size() == chunked.size();
+      for (size_t i = 0; same && i < whole.size(); i++) {
+        same = (whole[i].offset == chunked[i].offset) && (whole[i].length == chunked[i].length);
+      }
+      if (!same) {
+        printf("pretokenize_chunk_boundary: %s splits differently\n", r.name.c_str());
+        return -1;
+      }
+    }
+    printf("pretokenize_chunk_boundary: OK\n");
+  }
+
+  // byte-level BPE mapping must match GPT-2 bytes_to_unicode.
+  {
+    uint32_t expected[256];
+    uint32_t n = 0;
+    for (uint32_t b = 0; b < 256; b++) {
+      const bool printable = (0x21 <= b && b <= 0x7E) || (0xA1 <= b && b <= 0xAC) || (0xAE <= b && b <= 0xFF);
+      expected[b] = printable ? b : 256 + n++;
+    }
+
+    std::string all_bytes;
+    for (uint32_t b = 0; b < 256; b++) {
+      all_bytes += char(b);
+      const std::string utf8 = nanotokenizer::unicode_byte_to_utf8(uint8_t(b));
+      if (utf8 != nanotokenizer::unicode_cpt_to_utf8(expected[b]) ||
+          nanotokenizer::unicode_utf8_to_byte(utf8) != b ||
+          nanotokenizer::unicode_bpe_cpt_to_byte(expected[b]) != int(b)) {
+        printf("byte mapping mismatch at 0x%02x\n", b);
+        return -1;
+      }
+    }
+
+    std::string chars;
+    std::string bytes;
+    nanotokenizer::unicode_bytes_to_bpe_chars(all_bytes.data(), all_bytes.size(), chars);
+    if (!nanotokenizer::unicode_bpe_chars_to_bytes(chars.data(), chars.size(), bytes) || bytes != all_bytes) {
+      printf("bpe chars round trip failed\n");
+      return -1;
+    }
+
+    const char *unmapped[] = {" ", u8"\u0144", u8"\u00AD", u8"\u3042", "\xC4"};
+    for (const char *s : unmapped) {
+      if (nanotokenizer::unicode_bpe_chars_to_bytes(s, strlen(s), bytes)) {
+        printf("unmapped bpe char accepted\n");
+        return -1;
+      }
+    }
+    printf("byte mapping: OK\n");
+  }
+
+  // two-stage lowercase/NFD tables must match the sorted lists.
+  {
+    std::vector<uint32_t> lower(nanotokenizer::MAX_CODEPOINTS);
+    std::vector<uint32_t> nfd(nanotokenizer::MAX_CODEPOINTS);
+    for (uint32_t cp = 0; cp < nanotokenizer::MAX_CODEPOINTS; cp++) {
+      lower[cp] = nfd[cp] = cp;
+    }
+    for (const auto &p : nanotokenizer::unicode_map_lowercase) {
+      lower[p.first] = p.second;
+    }
+    for (const auto &range : nanotokenizer::unicode_ranges_nfd) {
+      for (uint32_t cp = range.first; cp <= range.last; cp++) {
+        nfd[cp] = range.nfd;
+      }
+    }
+    for (uint32_t cp = 0; cp < nanotokenizer::MAX_CODEPOINTS; cp++) {
+      if (nanotokenizer::unicode_tolower(cp) != lower[cp] || nanotokenizer::unicode_cpt_nfd(cp) != nfd[cp]) {
+        printf("lowercase/nfd table mismatch at U+%04X\n", cp);
+        return -1;
+      }
+    }
+    if (nanotokenizer::unicode_tolower(~0u) != ~0u || nanotokenizer::unicode_cpt_nfd(~0u) != ~0u) {
+      printf("lowercase/nfd of invalid codepoint\n");
+      return -1;
+    }
+
+    const std::string text = u8"Hello WORLD, Ça VA? ÀÉÎÕÜ İSTANBUL Ⱥ Привет ΣΊΣΥΦΟΣ 吾輩 \xff\xc3 end";
+    std::string expected;
+    size_t offset = 0;
+    while (offset < text.size()) {
+      const size_t start = offset;
+      const uint32_t cp = nanotokenizer::unicode_cpt_from_utf8(text, offset);
+      if (cp == ~0u) {
+        expected.append(text, start, offset - start);
+      } else {
+        expected += nanotokenizer::unicode_cpt_to_utf8(lower[nfd[cp]]);
+      }
+    }
+    std::string normalized;
+    nanotokenizer::unicode_normalize_utf8(text.data(), text.size(),
+      nanotokenizer::UNICODE_NORMALIZE_LOWERCASE | nanotokenizer::UNICODE_NORMALIZE_NFD, normalized);
+    if (normalized != expected) {
+      printf("unicode_normalize_utf8 mismatch: %s\n", normalized.c_str());
+      return -1;
+    }
+    printf("lowercase/nfd tables: OK\n");
+  }
+
+  // letter subcategories(\p{Lu} etc) in the flags table.
+  {
+    using namespace nanotokenizer;
+    const struct { uint32_t cp; uint16_t letter_type; } cases[] = {
+      {'A', codepoint_flags::LETTER_UPPERCASE}, {'z', codepoint_flags::LETTER_LOWERCASE},
+      {0x00C9, codepoint_flags::LETTER_UPPERCASE}, {0x03C3, codepoint_flags::LETTER_LOWERCASE},
+      {0x01C5, codepoint_flags::LETTER_TITLECASE}, {0x02B0, codepoint_flags::LETTER_MODIFIER},
+      {0x4E2D, codepoint_flags::LETTER_OTHER}, {0x3042, codepoint_flags::LETTER_OTHER},
+      {'1', 0}, {' ', 0}, {0x0301, 0}, {0x1F600, 0},
+    };
+    for (const auto &c : cases) {
+      const codepoint_flags flags = unicode_cpt_flags(c.cp);
+      if (flags.letter_type != c.letter_type || (c.letter_type != 0) != bool(flags.is_letter)) {
+        printf("letter type mismatch at U+%04X: %d\n", c.cp, int(flags.letter_type));
+        return -1;
+      }
+    }
+    printf("letter types: OK\n");
+  }
+
+  // normalization: known results, and streaming must match one-shot.
+  {
+    using namespace nanotokenizer;
+    const struct { unicode_normalization_form form; const char *input; const char *expected; } cases[] = {
+      {UNICODE_NFC, u8"e\u0301", u8"\u00E9"},
+      {UNICODE_NFD, u8"\u00E9", u8"e\u0301"},
+      {UNICODE_NFC, u8"\u212B", u8"\u00C5"},                  // singleton
+      {UNICODE_NFC, u8"a\u0323\u0302", u8"\u1EAD"},
+      {UNICODE_NFC, u8"a\u0302\u0323", u8"\u1EAD"},             // reordered, then composed
+      {UNICODE_NFD, u8"\u1E0B\u0323", u8"d\u0323\u0307"},
+      {UNICODE_NFC, u8"\u1100\u1161\u11A8", u8"\uAC01"},      // Hangul
+      {UNICODE_NFD, u8"\uAC01", u8"\u1100\u1161\u11A8"},
+      {UNICODE_NFKC, u8"\uFB01x\u2460\u00BD", u8"fix11\u20442"},
+      {UNICODE_NFKD, u8"\u1E9B\u0323", u8"s\u0323\u0307"},
+      {UNICODE_NFKC, u8"\u1E9B\u0323", u8"\u1E69"},
+      {UNICODE_NFC, "plain ascii", "plain ascii"},
+      {UNICODE_NFC, "bad \xff\xc3 utf8\xcc\x81", "bad \xff\xc3 utf8\xcc\x81"},
+    };
+    for (const auto &c : cases) {
+      const std::string out = unicode_normalize(c.form, c.input);
+      if (out != c.expected || !unicode_is_normalized(c.form, out.data(), out.size())) {
+        printf("normalize(%d, %s) = %s, expected %s\n", int(c.form), c.input, out.c_str(), c.expected);
+        return -1;
+      }
+    }
+
+    const char *pieces[] = {
+      "The quick brown fox. ", u8"Ça va? ", u8"e\u0301\u0323", u8"\uAC00\u11A8", u8"\u1100", u8"\u1161",
+      u8"\u0301", u8"\uFB01", u8"\u212B ", u8"\u0915\u093C", "\xff", "\xe3\x81", u8"\u3042", "\n",
+    };
+    const size_t npieces = sizeof(pieces) / sizeof(pieces[0]);
+    std::string text;
+    uint32_t seed = 777;
+    while (text.size() < 256 * 1024) {
+      seed = seed * 1664525u + 1013904223u;
+      text += pieces[(seed >> 8) % npieces];
+    }
+    for (int f = 0; f < 4; f++) {
+      const unicode_normalization_form form = unicode_normalization_form(f);
+      const std::string expected = unicode_normalize(form, text);
+      unicode_normalizer normalizer(form);
+      std::string streamed;
+      size_t pos = 0;
+      while (pos < text.size()) {
+        seed = seed * 1664525u + 1013904223u;
+        const size_t n = std::min(size_t((seed >> 8) % 97), text.size() - pos);
+        normalizer.push(text.data() + pos, n, streamed);
+        pos += n;
+      }
+      normalizer.flush(streamed);
+      if (streamed != expected || unicode_normalize(form, expected) != expected) {
+        printf("streaming normalization mismatch(form %d)\n", f);
+        return -1;
+      }
+    }
+    printf("normalization: OK\n");
+  }
+
+  return 0;
 }
 #endif
 
 
+#ifdef BENCH_MAIN
+#include <chrono>
+#include <cstdio>
+#include "unicode-normalization.hh"
+
+static std::string make_input(const char * const * samples, size_t nsamples) {
+  std::string input;
+  for (size_t i = 0; input.size() < 8 * 1024 * 1024; i++) {
+    input += samples[(i * 7) % nsamples];
+  }
+  return input;
+}
+
+int main(int argc, char **argv)
+{
+  const char *text_samples[] = {
+    "The quick brown fox jumps over the lazy dog. It's 12:30, isn't it?\n",
+    "    for (size_t i = 0; i < n; i++) {\n        sum += a[i] * 2;\n    }\n",
+    u8"吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。\n",
+    u8"Привет, мир! 🤩🤩 Ça va? \n\n",
+  };
+  // indentation-heavy source code
+  const char *code_samples[] = {
+    "                if (configuration_parameters.enable_vectorization) {\n",
+    "                    accumulated_value += coefficients[index] * samples[index];\n",
+    "                }\n\n",
+    "\t\t\t\t\treturn ComputeTransformationMatrix(rotation, translation);\n",
+  };
+  // long numbers
+  const char *digit_samples[] = {
+    "3.14159265358979323846264338327950288419716939937510582097494459230781640628 ",
+    "2718281828459045235360287471352662497757247093699959574966967627724076630353\n",
+    "id=00000000000000000000000000000000000000000000000000000000000000001234567890, ",
+  };
+
+  const struct { const char *name; std::string input; } corpora[] = {
+    {"text", make_input(text_samples, sizeof(text_samples) / sizeof(text_samples[0]))},
+    {"code", make_input(code_samples, sizeof(code_samples) / sizeof(code_samples[0]))},
+    {"digits", make_input(digit_samples, sizeof(digit_samples) / sizeof(digit_samples[0]))},
+  };
+
+  typedef std::vector<size_t> (*pretokenize_fn)(const std::string &, const std::vector<size_t> &);
+  const struct { const char *name; pretokenize_fn fn; } kernels[] = {
+    {"gpt2", nanotokenizer::pretokenize_gpt2},
+    {"llama3", nanotokenizer::pretokenize_llama3},
+    {"qwen2", nanotokenizer::pretokenize_qwen2},
+  };
+
+  const size_t nrepeat = 5;
+  for (const auto &c : corpora) {
+    const std::string &input = c.input;
+    printf("[%s]\n", c.name);
+
+    for (const auto &k : kernels) {
+      size_t nwords = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < nrepeat; i++) {
+        nwords = k.fn(input, {}).size();
+      }
+      double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      printf("%-14s %8.2f MB/s %8.2f Mwords/s (%zu bytes, %zu words)\n", k.name,
+             double(input.size() * nrepeat) / (1024.0 * 1024.0) / sec,
+             double(nwords * nrepeat) / 1e6 / sec, input.size(), nwords);
+    }
+
+    {
+      std::vector<nanotokenizer::pretoken_span> spans;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < nrepeat; i++) {
+        nanotokenizer::pretokenize_parallel(nanotokenizer::pretokenize_llama3, input.data(), input.size(), spans);
+      }
+      double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      printf("%-14s %8.2f MB/s %8.2f Mwords/s (%u threads)\n", "llama3(par)",
+             double(input.size() * nrepeat) / (1024.0 * 1024.0) / sec,
+             double(spans.size() * nrepeat) / 1e6 / sec, std::thread::hardware_concurrency());
+    }
+
+    // table-driven DFA compiled from pretokenizer-models.txt
+    for (uint32_t m = 0; m < nanotokenizer::pretokenizer_dfa_num_models; m++) {
+      const nanotokenizer::pretokenizer_dfa &dfa = nanotokenizer::pretokenizer_dfa_models[m];
+      size_t nwords = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < nrepeat; i++) {
+        nwords = nanotokenizer::pretokenize_dfa(dfa, input, {}).size();
+      }
+      double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      printf("dfa:%-10s %8.2f MB/s %8.2f Mwords/s (%zu bytes, %zu words)\n", dfa.name,
+             double(input.size() * nrepeat) / (1024.0 * 1024.0) / sec,
+             double(nwords * nrepeat) / 1e6 / sec, input.size(), nwords);
+    }
+
+    {
+      std::string normalized;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < nrepeat; i++) {
+        normalized.clear();
+        nanotokenizer::unicode_normalize_utf8(input.data(), input.size(),
+          nanotokenizer::UNICODE_NORMALIZE_LOWERCASE | nanotokenizer::UNICODE_NORMALIZE_NFD, normalized);
+      }
+      double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      printf("%-14s %8.2f MB/s\n", "lower+nfd",
+             double(input.size() * nrepeat) / (1024.0 * 1024.0) / sec);
+    }
+
+    // Unicode normalization: input as is(mostly passes the quick check) and decomposed.
+    {
+      const std::string decomposed = nanotokenizer::unicode_normalize(nanotokenizer::UNICODE_NFKD, input);
+      const struct { const char *name; nanotokenizer::unicode_normalization_form form; const std::string *text; } runs[] = {
+        {"nfc", nanotokenizer::UNICODE_NFC, &input},
+        {"nfkc", nanotokenizer::UNICODE_NFKC, &input},
+        {"nfc(nfkd)", nanotokenizer::UNICODE_NFC, &decomposed},
+      };
+      for (const auto &r : runs) {
+        std::string normalized;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < nrepeat; i++) {
+          normalized.clear();
+          nanotokenizer::unicode_normalize(r.form, r.text->data(), r.text->size(), normalized);
+        }
+        double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printf("%-14s %8.2f MB/s\n", r.name, double(r.text->size() * nrepeat) / (1024.0 * 1024.0) / sec);
+      }
+    }
+  }
+
+  return 0;
+}
+#endif
+
 #ifdef FUZZ_MAIN
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
   std::string s(reinterpret_cast<const char*>(Data), Size);
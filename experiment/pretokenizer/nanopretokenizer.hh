@@ -1,19 +1,78 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <string>
 
 namespace nanotokenizer {
 
+// Byte range of a word in the input text.
+struct pretoken_span {
+    size_t offset;  // byte offset
+    size_t length;  // byte length
+};
+
+// `offsets`: codepoint lengths of the segments of `text` to split.
+// Empty `offsets` splits the whole `text`.
+// Returns codepoint length of each word.
+//
+// `spans` variants split the whole text and write the byte span of each
+// word into `spans`. `spans` is cleared first, so its capacity is reused
+// when the same vector is passed again.
+//
+// `visit` variants split the whole text and call `visit(user, byte_offset,
+// byte_length)` for each word in order without storing anything, so words
+// can be consumed(e.g. BPE encoded) while they are found.
+
+typedef void (*pretoken_visit_fn)(void * user, size_t offset, size_t length);
+
 // Split unicode string with GPT2 rule.
 std::vector<size_t> pretokenize_gpt2(const std::string & text, const std::vector<size_t> & offsets);
+void pretokenize_gpt2(const char * text, size_t size, std::vector<pretoken_span> & spans);
+void pretokenize_gpt2(const std::string & text, std::vector<pretoken_span> & spans);
+void pretokenize_gpt2(const char * text, size_t size, pretoken_visit_fn visit, void * user);
 
 // Split unicode string with Qwen2 rule.
 std::vector<size_t> pretokenize_qwen2(const std::string & text, const std::vector<size_t> & offsets);
+void pretokenize_qwen2(const char * text, size_t size, std::vector<pretoken_span> & spans);
+void pretokenize_qwen2(const std::string & text, std::vector<pretoken_span> & spans);
+void pretokenize_qwen2(const char * text, size_t size, pretoken_visit_fn visit, void * user);
 
 // Split unicode string with llama3 rule.
 std::vector<size_t> pretokenize_llama3(const std::string & text, const std::vector<size_t> & offsets);
+void pretokenize_llama3(const char * text, size_t size, std::vector<pretoken_span> & spans);
+void pretokenize_llama3(const std::string & text, std::vector<pretoken_span> & spans);
+void pretokenize_llama3(const char * text, size_t size, pretoken_visit_fn visit, void * user);
+
+typedef void (*pretokenize_span_fn)(const char * text, size_t size, std::vector<pretoken_span> & spans);
+typedef void (*pretokenize_visit_rule)(const char * text, size_t size, pretoken_visit_fn visit, void * user);
+
+// Split a long text on `num_threads` threads(0 = hardware concurrency) with
+// one of the rules above, e.g. `pretokenize_parallel(pretokenize_llama3, ...)`.
+// The text is cut into chunks at `X\nY`(X: ASCII non-whitespace, Y: ASCII
+// letter or digit), where every rule, including the DFA models, ends a word
+// right before `Y` regardless of the rest of the text, so `spans` is
+// identical to the single-threaded result.
+// Texts smaller than 64 KB per thread or without such a boundary are split
+// on the calling thread.
+void pretokenize_parallel(pretokenize_span_fn fn, const char * text, size_t size, std::vector<pretoken_span> & spans, uint32_t num_threads = 0);
+
+// First `X\nY` chunk boundary(position of Y) at or after `from`, or `size`.
+// Text split there pretokenizes the same as a whole with every rule above
+// and every model in pretokenizer-models.txt(checked in TEST_MAIN). A new
+// model must keep that, or its callers must not split.
+size_t pretokenize_chunk_boundary(const char * text, size_t size, size_t from);
+
+struct pretokenizer_dfa;  // pretokenizer-dfa.hh
+
+// Split unicode string with the compiled split regex of a model.
+// Get `dfa` with `pretokenizer_dfa_find("llama3")` etc. Models are listed in
+// pretokenizer-models.txt.
+std::vector<size_t> pretokenize_dfa(const pretokenizer_dfa & dfa, const std::string & text, const std::vector<size_t> & offsets);
+void pretokenize_dfa(const pretokenizer_dfa & dfa, const char * text, size_t size, std::vector<pretoken_span> & spans);
+void pretokenize_dfa(const pretokenizer_dfa & dfa, const std::string & text, std::vector<pretoken_span> & spans);
+void pretokenize_dfa(const pretokenizer_dfa & dfa, const char * text, size_t size, pretoken_visit_fn visit, void * user);
 
 } // namespace nanotokenizer
 
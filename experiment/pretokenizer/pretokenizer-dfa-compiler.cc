@@ -0,0 +1,1016 @@
+// MIT license
+// Copyright 2024-Present Light Transport Entertainment Inc.
+//
+// Compile pretokenizer split regex into table-driven DFA
+// (pretokenizer-dfa-tables.cc). See pretokenizer-dfa.hh for the table layout.
+//
+// $ make gen-dfa
+//
+// Input: one line per regex stage, `name<TAB>regex`. Consecutive lines with
+// the same name are stages of one model. Lines starting with '#' are comments.
+//
+// Supported regex subset(what the tokenizer split patterns use):
+//
+//   a|b  ab  (...)  (?:...)  (?i:...)          ASCII case-insensitive only
+//   ?  *  +  {m}  {m,}  {m,n}                  greedy only
+//   [...]  [^...]  a-b  .                      literal or \x{...} ranges
+//   \p{L} \p{N} \p{P} \p{S} \p{M} \p{Z} \p{C} and \P{..}
+//   \p{Lu} \p{Ll} \p{Lt} \p{Lm} \p{Lo}
+//   \s \S \r \n \t \f \v \xHH \x{H..} \uHHHH \<punct>
+//   (?!X) (?=X)                                X: single character class,
+//                                              only at the end of an alternative
+//
+// Matching follows leftmost-first(Perl/Python `regex`) semantics. NFA threads
+// are kept in priority order in each DFA state and threads after a match are
+// dropped, as in RE2's DFA.
+//
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "pretokenizer-dfa.hh"
+#include "unicode-util.hh"
+
+using namespace nanotokenizer;
+
+namespace {
+
+const uint32_t kMaxCodepoint = 0x110000;
+
+// flags of a symbol(see `pretokenizer_dfa_key`): categories(bits 0-7),
+// is_whitespace(bit 8), letter type(bits 9-11)
+const uint16_t kWhitespaceBit = 0x100;
+const uint32_t kLetterTypeShift = 9;
+const uint32_t kKeyBits = 9;             // without letter types
+const uint32_t kLetterTypeKeyBits = 12;  // with letter types
+
+struct char_item {
+    enum kind_t { RANGE, PROP, LETTER_TYPE, WHITESPACE } kind;
+    uint32_t lo{0}, hi{0};  // RANGE: inclusive
+    uint16_t mask{0};       // PROP: codepoint_flags category mask
+    uint16_t letter_type{0};  // LETTER_TYPE: codepoint_flags::LETTER_*
+    bool negate{false};
+};
+
+struct char_set {
+    std::vector<char_item> items;
+    bool negate{false};
+    bool icase{false};
+};
+
+struct node {
+    enum type_t { SET, CAT, ALT, REPEAT, LOOKAHEAD } type;
+    int set{-1};
+    std::vector<int> children;
+    int min{0}, max{0};  // REPEAT. max < 0 = unbounded
+    bool negate{false};  // LOOKAHEAD
+};
+
+[[noreturn]] void fail(const std::string & msg) {
+    fprintf(stderr, "pretokenizer-dfa-compiler: %s\n", msg.c_str());
+    exit(1);
+}
+
+//
+// Parser
+//
+class parser {
+  public:
+    parser(const std::string & re, std::vector<char_set> & sets, std::vector<node> & nodes)
+        : _re(re), _sets(sets), _nodes(nodes) {}
+
+    int parse() {
+        int n = parse_alt(false);
+        if (_pos != _re.size()) {
+            error("unexpected ')'");
+        }
+        return n;
+    }
+
+  private:
+    const std::string & _re;
+    size_t _pos{0};
+    std::vector<char_set> & _sets;
+    std::vector<node> & _nodes;
+
+    [[noreturn]] void error(const std::string & msg) {
+        fail(msg + " at offset " + std::to_string(_pos) + " in: " + _re);
+    }
+
+    bool eof() const { return _pos >= _re.size(); }
+    char peek() const { return _re[_pos]; }
+
+    int add_node(const node & n) {
+        _nodes.push_back(n);
+        return int(_nodes.size()) - 1;
+    }
+
+    int add_set(const char_set & s) {
+        _sets.push_back(s);
+        node n;
+        n.type = node::SET;
+        n.set = int(_sets.size()) - 1;
+        return add_node(n);
+    }
+
+    uint32_t next_cpt() {
+        size_t offset = _pos;
+        uint32_t cpt = unicode_cpt_from_utf8(_re, offset);
+        if (cpt == ~0u) {
+            error("invalid UTF-8");
+        }
+        _pos = offset;
+        return cpt;
+    }
+
+    uint32_t parse_hex(size_t ndigits) {
+        uint32_t v = 0;
+        for (size_t i = 0; i < ndigits; i++) {
+            if (eof() || !isxdigit(uint8_t(peek()))) {
+                error("invalid hex escape");
+            }
+            v = v * 16 + uint32_t(strtol(std::string(1, _re[_pos++]).c_str(), nullptr, 16));
+        }
+        return v;
+    }
+
+    // Parse escape after '\'. Returns true and sets `item` for class escape,
+    // otherwise sets `cpt` to the literal.
+    bool parse_escape(char_item & item, uint32_t & cpt) {
+        if (eof()) {
+            error("trailing '\\'");
+        }
+        char c = _re[_pos++];
+        switch (c) {
+            case 'p':
+            case 'P': {
+                if (eof() || peek() != '{') {
+                    error("expected '{' after \\p");
+                }
+                size_t end = _re.find('}', _pos);
+                if (end == std::string::npos) {
+                    error("unterminated \\p{");
+                }
+                std::string name = _re.substr(_pos + 1, end - _pos - 1);
+                _pos = end + 1;
+                static const std::map<std::string, uint16_t> props = {
+                    {"L", codepoint_flags::LETTER},      {"N", codepoint_flags::NUMBER},
+                    {"P", codepoint_flags::PUNCTUATION}, {"S", codepoint_flags::SYMBOL},
+                    {"M", codepoint_flags::ACCENT_MARK}, {"Z", codepoint_flags::SEPARATOR},
+                    {"C", codepoint_flags::CONTROL},
+                };
+                static const std::map<std::string, uint16_t> letter_types = {
+                    {"Lu", codepoint_flags::LETTER_UPPERCASE}, {"Ll", codepoint_flags::LETTER_LOWERCASE},
+                    {"Lt", codepoint_flags::LETTER_TITLECASE}, {"Lm", codepoint_flags::LETTER_MODIFIER},
+                    {"Lo", codepoint_flags::LETTER_OTHER},
+                };
+                item.negate = (c == 'P');
+                auto it = props.find(name);
+                if (it != props.end()) {
+                    item.kind = char_item::PROP;
+                    item.mask = it->second;
+                    return true;
+                }
+                auto lt = letter_types.find(name);
+                if (lt != letter_types.end()) {
+                    item.kind = char_item::LETTER_TYPE;
+                    item.letter_type = lt->second;
+                    return true;
+                }
+                error("unsupported property \\p{" + name + "}");
+            }
+            case 's':
+            case 'S':
+                item.kind = char_item::WHITESPACE;
+                item.negate = (c == 'S');
+                return true;
+            case 'r': cpt = '\r'; return false;
+            case 'n': cpt = '\n'; return false;
+            case 't': cpt = '\t'; return false;
+            case 'f': cpt = '\f'; return false;
+            case 'v': cpt = '\v'; return false;
+            case 'x':
+                if (!eof() && peek() == '{') {
+                    size_t end = _re.find('}', _pos);
+                    if (end == std::string::npos) {
+                        error("unterminated \\x{");
+                    }
+                    _pos++;
+                    cpt = parse_hex(end - _pos);
+                    _pos++;
+                } else {
+                    cpt = parse_hex(2);
+                }
+                return false;
+            case 'u':
+                cpt = parse_hex(4);
+                return false;
+            default:
+                if (isalnum(uint8_t(c))) {
+                    error(std::string("unsupported escape \\") + c);
+                }
+                cpt = uint8_t(c);
+                return false;
+        }
+    }
+
+    int parse_bracket(bool icase) {
+        // '[' consumed
+        char_set s;
+        s.icase = icase;
+        if (!eof() && peek() == '^') {
+            s.negate = true;
+            _pos++;
+        }
+        bool first = true;
+        while (true) {
+            if (eof()) {
+                error("unterminated '['");
+            }
+            if (peek() == ']' && !first) {
+                _pos++;
+                break;
+            }
+            first = false;
+
+            char_item item;
+            uint32_t lo;
+            if (peek() == '\\') {
+                _pos++;
+                if (parse_escape(item, lo)) {
+                    s.items.push_back(item);
+                    continue;
+                }
+            } else {
+                lo = next_cpt();
+            }
+
+            uint32_t hi = lo;
+            if ((_pos + 1 < _re.size()) && (peek() == '-') && (_re[_pos + 1] != ']')) {
+                _pos++;
+                if (peek() == '\\') {
+                    _pos++;
+                    if (parse_escape(item, hi)) {
+                        error("class escape in range");
+                    }
+                } else {
+                    hi = next_cpt();
+                }
+                if (hi < lo) {
+                    error("invalid range");
+                }
+            }
+            item.kind = char_item::RANGE;
+            item.lo = lo;
+            item.hi = hi;
+            item.negate = false;
+            s.items.push_back(item);
+        }
+        return add_set(s);
+    }
+
+    int parse_atom(bool icase) {
+        char c = peek();
+        if (c == '(') {
+            _pos++;
+            bool sub_icase = icase;
+            int lookahead = 0;  // 1: (?=, -1: (?!
+            if (!eof() && peek() == '?') {
+                _pos++;
+                if (_re.compare(_pos, 1, ":") == 0) {
+                    _pos += 1;
+                } else if (_re.compare(_pos, 2, "i:") == 0) {
+                    _pos += 2;
+                    sub_icase = true;
+                } else if (_re.compare(_pos, 1, "=") == 0) {
+                    _pos += 1;
+                    lookahead = 1;
+                } else if (_re.compare(_pos, 1, "!") == 0) {
+                    _pos += 1;
+                    lookahead = -1;
+                } else {
+                    error("unsupported group");
+                }
+            }
+            int n = parse_alt(sub_icase);
+            if (eof() || peek() != ')') {
+                error("expected ')'");
+            }
+            _pos++;
+            if (lookahead) {
+                if (_nodes[n].type != node::SET) {
+                    error("lookahead must be a single character class");
+                }
+                node la;
+                la.type = node::LOOKAHEAD;
+                la.set = _nodes[n].set;
+                la.negate = (lookahead < 0);
+                return add_node(la);
+            }
+            return n;
+        }
+        if (c == '[') {
+            _pos++;
+            return parse_bracket(icase);
+        }
+        if (c == '.') {
+            _pos++;
+            char_set s;
+            s.negate = true;
+            char_item item;
+            item.kind = char_item::RANGE;
+            item.lo = item.hi = '\n';
+            s.items.push_back(item);
+            return add_set(s);
+        }
+
+        char_set s;
+        s.icase = icase;
+        char_item item;
+        uint32_t cpt;
+        if (c == '\\') {
+            _pos++;
+            if (!parse_escape(item, cpt)) {
+                item.kind = char_item::RANGE;
+                item.lo = item.hi = cpt;
+            }
+        } else {
+            if (c == '*' || c == '+' || c == '?' || c == '{') {
+                error("nothing to repeat");
+            }
+            cpt = next_cpt();
+            item.kind = char_item::RANGE;
+            item.lo = item.hi = cpt;
+        }
+        s.items.push_back(item);
+        return add_set(s);
+    }
+
+    bool parse_int(int & v) {
+        size_t start = _pos;
+        v = 0;
+        while (!eof() && isdigit(uint8_t(peek()))) {
+            v = v * 10 + (peek() - '0');
+            _pos++;
+        }
+        return _pos != start;
+    }
+
+    int parse_repeat(bool icase) {
+        int n = parse_atom(icase);
+        while (!eof()) {
+            int min, max;
+            char c = peek();
+            if (c == '?') {
+                min = 0; max = 1;
+                _pos++;
+            } else if (c == '*') {
+                min = 0; max = -1;
+                _pos++;
+            } else if (c == '+') {
+                min = 1; max = -1;
+                _pos++;
+            } else if (c == '{') {
+                _pos++;
+                if (!parse_int(min)) {
+                    error("invalid repeat");
+                }
+                max = min;
+                if (!eof() && peek() == ',') {
+                    _pos++;
+                    if (!parse_int(max)) {
+                        max = -1;
+                    }
+                }
+                if (eof() || peek() != '}' || (max >= 0 && max < min)) {
+                    error("invalid repeat");
+                }
+                _pos++;
+            } else {
+                break;
+            }
+            if (!eof() && (peek() == '?' || peek() == '+')) {
+                error("lazy/possessive quantifier is not supported");
+            }
+            if (_nodes[n].type == node::LOOKAHEAD) {
+                error("cannot repeat lookahead");
+            }
+            node r;
+            r.type = node::REPEAT;
+            r.children.push_back(n);
+            r.min = min;
+            r.max = max;
+            n = add_node(r);
+        }
+        return n;
+    }
+
+    int parse_concat(bool icase) {
+        node cat;
+        cat.type = node::CAT;
+        while (!eof() && peek() != '|' && peek() != ')') {
+            cat.children.push_back(parse_repeat(icase));
+        }
+        if (cat.children.size() == 1) {
+            return cat.children[0];
+        }
+        return add_node(cat);
+    }
+
+    int parse_alt(bool icase) {
+        node alt;
+        alt.type = node::ALT;
+        alt.children.push_back(parse_concat(icase));
+        while (!eof() && peek() == '|') {
+            _pos++;
+            alt.children.push_back(parse_concat(icase));
+        }
+        if (alt.children.size() == 1) {
+            return alt.children[0];
+        }
+        return add_node(alt);
+    }
+};
+
+//
+// Character classes
+//
+
+// Symbol: ASCII codepoint, or non-ASCII(bucket, flags) combination.
+struct symbol {
+    uint32_t cpt;    // ASCII codepoint or first codepoint of bucket
+    uint16_t flags;  // `pretokenizer_dfa_key`
+};
+
+uint16_t symbol_flags(const codepoint_flags & f) {
+    return uint16_t(pretokenizer_dfa_key(f.as_uint()));
+}
+
+bool item_contains(const char_item & item, const symbol & sym) {
+    bool r = false;
+    switch (item.kind) {
+        case char_item::RANGE: r = (item.lo <= sym.cpt) && (sym.cpt <= item.hi); break;
+        case char_item::PROP: r = (sym.flags & item.mask) != 0; break;
+        case char_item::LETTER_TYPE: r = (sym.flags >> kLetterTypeShift) == item.letter_type; break;
+        case char_item::WHITESPACE: r = (sym.flags & kWhitespaceBit) != 0; break;
+    }
+    return item.negate ? !r : r;
+}
+
+bool set_contains(const char_set & s, const symbol & sym) {
+    auto contains = [&](const symbol & x) {
+        bool r = false;
+        for (const auto & item : s.items) {
+            if (item_contains(item, x)) {
+                r = true;
+                break;
+            }
+        }
+        return s.negate ? !r : r;
+    };
+    if (contains(sym)) {
+        return true;
+    }
+    if (s.icase && sym.cpt < 128 && isalpha(int(sym.cpt))) {
+        symbol other = sym;
+        other.cpt = uint32_t(isupper(int(sym.cpt)) ? tolower(int(sym.cpt)) : toupper(int(sym.cpt)));
+        other.flags = symbol_flags(unicode_cpt_flags(other.cpt));
+        return contains(other);
+    }
+    return false;
+}
+
+struct alphabet {
+    std::vector<uint32_t> bucket_bounds;   // [num_buckets + 1]
+    std::vector<uint8_t> bucket_stage1;    // empty for one bucket
+    std::vector<uint8_t> bucket_stage2;
+    uint32_t key_bits{kKeyBits};
+    std::vector<uint8_t> ascii_class;      // [128]
+    std::vector<uint8_t> nonascii_class;   // [num_buckets << key_bits]
+    std::vector<std::vector<bool>> class_sets;  // class_sets[class][set]
+};
+
+// codepoint -> bucket as a two-stage table of PRETOKENIZER_DFA_BUCKET_BLOCK_BITS
+// blocks(see gen-unicode-flags-table.cc). Bucket bounds are few, so nearly
+// all blocks are uniform and shared.
+void build_bucket_table(alphabet & a) {
+    const size_t num_buckets = a.bucket_bounds.size() - 1;
+    if (num_buckets == 1) {
+        return;
+    }
+    if (num_buckets > 256) {
+        fail("too many non-ASCII ranges");
+    }
+
+    const uint32_t block_size = 1u << PRETOKENIZER_DFA_BUCKET_BLOCK_BITS;
+    std::map<std::vector<uint8_t>, uint8_t> block_ids;
+    std::vector<uint8_t> block(block_size);
+    size_t b = 0;  // bucket of `cpt`
+    for (uint32_t blk = 0; blk < (kMaxCodepoint >> PRETOKENIZER_DFA_BUCKET_BLOCK_BITS); blk++) {
+        for (uint32_t i = 0; i < block_size; i++) {
+            const uint32_t cpt = (blk << PRETOKENIZER_DFA_BUCKET_BLOCK_BITS) | i;
+            while (cpt >= a.bucket_bounds[b + 1]) {
+                b++;
+            }
+            block[i] = uint8_t(b);  // ASCII: bucket 0, not used
+        }
+        auto it = block_ids.find(block);
+        if (it == block_ids.end()) {
+            if (block_ids.size() >= 256) {
+                fail("too many bucket table blocks");
+            }
+            it = block_ids.emplace(block, uint8_t(block_ids.size())).first;
+            a.bucket_stage2.insert(a.bucket_stage2.end(), block.begin(), block.end());
+        }
+        a.bucket_stage1.push_back(it->second);
+    }
+}
+
+alphabet build_alphabet(const std::vector<char_set> & sets) {
+    alphabet a;
+
+    a.bucket_bounds.push_back(128);
+    a.bucket_bounds.push_back(kMaxCodepoint);
+    for (const auto & s : sets) {
+        for (const auto & item : s.items) {
+            if (item.kind != char_item::RANGE) {
+                continue;
+            }
+            if (item.lo > 128 && item.lo < kMaxCodepoint) {
+                a.bucket_bounds.push_back(item.lo);
+            }
+            if (item.hi + 1 > 128 && item.hi + 1 < kMaxCodepoint) {
+                a.bucket_bounds.push_back(item.hi + 1);
+            }
+        }
+    }
+    std::sort(a.bucket_bounds.begin(), a.bucket_bounds.end());
+    a.bucket_bounds.erase(std::unique(a.bucket_bounds.begin(), a.bucket_bounds.end()), a.bucket_bounds.end());
+    build_bucket_table(a);
+
+    for (const auto & s : sets) {
+        for (const auto & item : s.items) {
+            if (item.kind == char_item::LETTER_TYPE) {
+                a.key_bits = kLetterTypeKeyBits;
+            }
+        }
+    }
+
+    std::map<std::vector<bool>, uint32_t> class_ids;
+    auto classify = [&](const symbol & sym) -> uint8_t {
+        std::vector<bool> sig(sets.size());
+        for (size_t i = 0; i < sets.size(); i++) {
+            sig[i] = set_contains(sets[i], sym);
+        }
+        auto it = class_ids.find(sig);
+        if (it == class_ids.end()) {
+            if (class_ids.size() >= 255) {
+                fail("too many character classes");
+            }
+            it = class_ids.emplace(sig, uint32_t(class_ids.size())).first;
+            a.class_sets.push_back(sig);
+        }
+        return uint8_t(it->second);
+    };
+
+    for (uint32_t cpt = 0; cpt < 128; cpt++) {
+        a.ascii_class.push_back(classify({cpt, symbol_flags(unicode_cpt_flags(cpt))}));
+    }
+    for (size_t b = 0; b + 1 < a.bucket_bounds.size(); b++) {
+        for (uint32_t f = 0; f < (1u << a.key_bits); f++) {
+            a.nonascii_class.push_back(classify({a.bucket_bounds[b], uint16_t(f)}));
+        }
+    }
+
+    return a;
+}
+
+//
+// NFA(Pike VM program)
+//
+struct inst {
+    enum op_t { CHAR, SPLIT, JMP, MATCH, ASSERT } op;
+    int x{0}, y{0};
+    int set{-1};
+    bool negate{false};
+};
+
+class nfa_compiler {
+  public:
+    nfa_compiler(const std::vector<node> & nodes) : _nodes(nodes) {}
+
+    std::vector<inst> compile(int root) {
+        emit_node(root);
+        inst m;
+        m.op = inst::MATCH;
+        _prog.push_back(m);
+        return _prog;
+    }
+
+  private:
+    const std::vector<node> & _nodes;
+    std::vector<inst> _prog;
+
+    int emit(inst::op_t op) {
+        inst i;
+        i.op = op;
+        _prog.push_back(i);
+        return int(_prog.size()) - 1;
+    }
+
+    void emit_node(int n) {
+        const node & nd = _nodes[n];
+        switch (nd.type) {
+            case node::SET: {
+                int pc = emit(inst::CHAR);
+                _prog[pc].set = nd.set;
+                break;
+            }
+            case node::LOOKAHEAD: {
+                int pc = emit(inst::ASSERT);
+                _prog[pc].set = nd.set;
+                _prog[pc].negate = nd.negate;
+                break;
+            }
+            case node::CAT:
+                for (int c : nd.children) {
+                    emit_node(c);
+                }
+                break;
+            case node::ALT: {
+                std::vector<int> jumps;
+                for (size_t i = 0; i < nd.children.size(); i++) {
+                    int split = -1;
+                    if (i + 1 < nd.children.size()) {
+                        split = emit(inst::SPLIT);
+                        _prog[split].x = split + 1;
+                    }
+                    emit_node(nd.children[i]);
+                    if (i + 1 < nd.children.size()) {
+                        jumps.push_back(emit(inst::JMP));
+                        _prog[split].y = int(_prog.size());
+                    }
+                }
+                for (int j : jumps) {
+                    _prog[j].x = int(_prog.size());
+                }
+                break;
+            }
+            case node::REPEAT: {
+                const int child = nd.children[0];
+                for (int i = 0; i < nd.min; i++) {
+                    emit_node(child);
+                }
+                if (nd.max < 0) {
+                    // L: SPLIT body, end; body; JMP L
+                    int split = emit(inst::SPLIT);
+                    _prog[split].x = split + 1;
+                    emit_node(child);
+                    int jmp = emit(inst::JMP);
+                    _prog[jmp].x = split;
+                    _prog[split].y = int(_prog.size());
+                } else {
+                    // (body(body(...)?)?)?
+                    std::vector<int> splits;
+                    for (int i = nd.min; i < nd.max; i++) {
+                        int split = emit(inst::SPLIT);
+                        _prog[split].x = split + 1;
+                        splits.push_back(split);
+                        emit_node(child);
+                    }
+                    for (int s : splits) {
+                        _prog[s].y = int(_prog.size());
+                    }
+                }
+                break;
+            }
+        }
+    }
+};
+
+//
+// DFA(subset construction over ordered thread lists)
+//
+struct dfa {
+    uint32_t num_classes;  // excluding end of text
+    std::vector<uint16_t> transitions;
+    uint32_t num_states;
+    std::vector<uint64_t> ascii_loop;  // [num_states * 2]
+};
+
+// ASCII bytes which keep each state, all with the match bit of the lowest
+// such byte(see `pretokenizer_dfa_stage::ascii_loop`).
+std::vector<uint64_t> build_ascii_loop(const dfa & d, const alphabet & a) {
+    const uint32_t stride = d.num_classes + 1;
+    std::vector<uint64_t> loop(size_t(d.num_states) * 2, 0);
+    for (uint32_t s = 1; s < d.num_states; s++) {
+        int match_bit = -1;
+        for (uint32_t c = 0; c < 128; c++) {
+            const uint16_t t = d.transitions[s * stride + a.ascii_class[c]];
+            if ((t & PRETOKENIZER_DFA_STATE_MASK) != s) {
+                continue;
+            }
+            if (match_bit < 0) {
+                match_bit = t & PRETOKENIZER_DFA_MATCH;
+            } else if (match_bit != (t & PRETOKENIZER_DFA_MATCH)) {
+                continue;
+            }
+            loop[s * 2 + (c >> 6)] |= uint64_t(1) << (c & 63);
+        }
+    }
+    return loop;
+}
+
+class dfa_builder {
+  public:
+    dfa_builder(const std::vector<inst> & prog, const alphabet & a) : _prog(prog), _alpha(a) {
+        // lookahead must be followed by MATCH only.
+        for (size_t pc = 0; pc < _prog.size(); pc++) {
+            if (_prog[pc].op == inst::ASSERT) {
+                std::vector<int> next;
+                closure(int(pc) + 1, next);
+                if (next.size() != 1 || _prog[next[0]].op != inst::MATCH) {
+                    fail("lookahead is only supported at the end of an alternative");
+                }
+            }
+        }
+    }
+
+    dfa build() {
+        const uint32_t num_classes = uint32_t(_alpha.class_sets.size());
+        const uint32_t stride = num_classes + 1;  // + end of text
+
+        state_id({});  // 0: dead
+        std::vector<int> start;
+        closure(0, start);
+        state_id(start);  // 1: start
+
+        std::vector<uint16_t> trans;
+        for (size_t s = 0; s < _states.size(); s++) {
+            // `_states` grows while iterating.
+            const std::vector<int> cur = _states[s];
+            for (uint32_t cls = 0; cls < stride; cls++) {
+                std::vector<int> next;
+                bool matched = false;
+                for (int pc : cur) {
+                    const inst & in = _prog[pc];
+                    if (in.op == inst::CHAR) {
+                        if (cls < num_classes && _alpha.class_sets[cls][in.set]) {
+                            closure(pc + 1, next);
+                        }
+                    } else if (in.op == inst::MATCH) {
+                        matched = true;
+                        break;  // lower priority threads are dropped
+                    } else if (in.op == inst::ASSERT) {
+                        bool ok = (cls < num_classes) && _alpha.class_sets[cls][in.set];
+                        if (in.negate) {
+                            ok = !ok;
+                        }
+                        if (ok) {
+                            matched = true;
+                            break;
+                        }
+                    }
+                }
+                if (cls == num_classes) {
+                    next.clear();  // nothing follows end of text
+                }
+                uint32_t id = state_id(next);
+                if (id > PRETOKENIZER_DFA_STATE_MASK) {
+                    fail("too many DFA states");
+                }
+                trans.push_back(uint16_t(id | (matched ? PRETOKENIZER_DFA_MATCH : 0)));
+            }
+        }
+
+        dfa d;
+        d.num_classes = num_classes;
+        d.num_states = uint32_t(_states.size());
+        d.transitions = trans;
+        return d;
+    }
+
+  private:
+    const std::vector<inst> & _prog;
+    const alphabet & _alpha;
+    std::vector<std::vector<int>> _states;
+    std::map<std::vector<int>, uint32_t> _state_ids;
+
+    // Ordered epsilon closure. Keeps CHAR, MATCH and ASSERT instructions.
+    void closure(int pc, std::vector<int> & list) {
+        std::vector<bool> visited(_prog.size(), false);
+        for (int p : list) {
+            visited[p] = true;
+        }
+        closure_rec(pc, list, visited);
+    }
+
+    void closure_rec(int pc, std::vector<int> & list, std::vector<bool> & visited) {
+        if (visited[pc]) {
+            return;
+        }
+        visited[pc] = true;
+        const inst & in = _prog[pc];
+        switch (in.op) {
+            case inst::JMP:
+                closure_rec(in.x, list, visited);
+                break;
+            case inst::SPLIT:
+                closure_rec(in.x, list, visited);
+                closure_rec(in.y, list, visited);
+                break;
+            default:
+                list.push_back(pc);
+                break;
+        }
+    }
+
+    uint32_t state_id(const std::vector<int> & list) {
+        auto it = _state_ids.find(list);
+        if (it != _state_ids.end()) {
+            return it->second;
+        }
+        uint32_t id = uint32_t(_states.size());
+        _states.push_back(list);
+        _state_ids[list] = id;
+        return id;
+    }
+};
+
+std::string c_escape(const std::string & s) {
+    std::string r;
+    for (unsigned char c : s) {
+        if (c == '\\' || c == '"') {
+            r += '\\';
+            r += char(c);
+        } else if (c == '\n') {
+            r += "\\n";
+        } else if (c == '\r') {
+            r += "\\r";
+        } else if (c < 0x20 || c >= 0x7f) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\%03o", c);
+            r += buf;
+        } else {
+            r += char(c);
+        }
+    }
+    return r;
+}
+
+struct stage_output {
+    std::string regex;
+    alphabet alpha;
+    dfa d;
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s pretokenizer-models.txt pretokenizer-dfa-tables.cc\n", argv[0]);
+        return -1;
+    }
+
+    std::ifstream ifs(argv[1]);
+    if (!ifs) {
+        fail(std::string("failed to open ") + argv[1]);
+    }
+
+    // name -> stages, in file order
+    std::vector<std::pair<std::string, std::vector<stage_output>>> models;
+
+    std::string line;
+    while (std::getline(ifs, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        size_t tab = line.find('\t');
+        if (tab == std::string::npos) {
+            fail("expected `name<TAB>regex`: " + line);
+        }
+        const std::string name = line.substr(0, tab);
+        const std::string re = line.substr(tab + 1);
+
+        std::vector<char_set> sets;
+        std::vector<node> nodes;
+        parser p(re, sets, nodes);
+        int root = p.parse();
+
+        stage_output st;
+        st.regex = re;
+        st.alpha = build_alphabet(sets);
+        nfa_compiler nc(nodes);
+        std::vector<inst> prog = nc.compile(root);
+        dfa_builder db(prog, st.alpha);
+        st.d = db.build();
+        st.d.ascii_loop = build_ascii_loop(st.d, st.alpha);
+
+        if (models.empty() || models.back().first != name) {
+            models.emplace_back(name, std::vector<stage_output>());
+        }
+        models.back().second.push_back(st);
+
+        printf("%s: %d classes, %d states, %d buckets, %d key bits: %s\n", name.c_str(),
+               int(st.d.num_classes), int(st.d.num_states),
+               int(st.alpha.bucket_bounds.size() - 1), int(st.alpha.key_bits), re.c_str());
+    }
+
+    FILE *fp = fopen(argv[2], "w");
+    if (!fp) {
+        fail(std::string("failed to open ") + argv[2]);
+    }
+
+    fprintf(fp, "// generated with pretokenizer-dfa-compiler.cc from pretokenizer-models.txt. DO NOT EDIT.\n\n");
+    fprintf(fp, "#include \"pretokenizer-dfa.hh\"\n\n");
+    fprintf(fp, "namespace nanotokenizer {\n\n");
+    fprintf(fp, "namespace {\n\n");
+
+    for (const auto & m : models) {
+        for (size_t i = 0; i < m.second.size(); i++) {
+            const stage_output & st = m.second[i];
+            const std::string prefix = m.first + "_" + std::to_string(i);
+
+            fprintf(fp, "// %s\n", c_escape(st.regex).c_str());
+            fprintf(fp, "const uint8_t %s_ascii_class[128] = {\n", prefix.c_str());
+            for (size_t k = 0; k < st.alpha.ascii_class.size(); k++) {
+                fprintf(fp, "%d,%s", st.alpha.ascii_class[k], ((k % 32) == 31) ? "\n" : "");
+            }
+            fprintf(fp, "};\n\n");
+
+            fprintf(fp, "const uint32_t %s_bucket_bounds[%d] = {\n", prefix.c_str(), int(st.alpha.bucket_bounds.size()));
+            for (size_t k = 0; k < st.alpha.bucket_bounds.size(); k++) {
+                fprintf(fp, "0x%06X,%s", st.alpha.bucket_bounds[k], ((k % 8) == 7) ? "\n" : "");
+            }
+            fprintf(fp, "\n};\n\n");
+
+            if (!st.alpha.bucket_stage1.empty()) {
+                fprintf(fp, "const uint8_t %s_bucket_stage1[%d] = {\n", prefix.c_str(), int(st.alpha.bucket_stage1.size()));
+                for (size_t k = 0; k < st.alpha.bucket_stage1.size(); k++) {
+                    fprintf(fp, "%d,%s", st.alpha.bucket_stage1[k], ((k % 32) == 31) ? "\n" : "");
+                }
+                fprintf(fp, "};\n\n");
+
+                fprintf(fp, "const uint8_t %s_bucket_stage2[%d] = {\n", prefix.c_str(), int(st.alpha.bucket_stage2.size()));
+                for (size_t k = 0; k < st.alpha.bucket_stage2.size(); k++) {
+                    fprintf(fp, "%d,%s", st.alpha.bucket_stage2[k], ((k % 32) == 31) ? "\n" : "");
+                }
+                fprintf(fp, "};\n\n");
+            }
+
+            fprintf(fp, "const uint8_t %s_nonascii_class[%d] = {\n", prefix.c_str(), int(st.alpha.nonascii_class.size()));
+            for (size_t k = 0; k < st.alpha.nonascii_class.size(); k++) {
+                fprintf(fp, "%d,%s", st.alpha.nonascii_class[k], ((k % 32) == 31) ? "\n" : "");
+            }
+            fprintf(fp, "};\n\n");
+
+            fprintf(fp, "const uint64_t %s_ascii_loop[%d] = {\n", prefix.c_str(), int(st.d.ascii_loop.size()));
+            for (size_t k = 0; k < st.d.ascii_loop.size(); k++) {
+                fprintf(fp, "0x%016llXULL,%s", (unsigned long long)st.d.ascii_loop[k], ((k % 2) == 1) ? "\n" : "");
+            }
+            fprintf(fp, "};\n\n");
+
+            fprintf(fp, "const uint16_t %s_transitions[%d] = {\n", prefix.c_str(), int(st.d.transitions.size()));
+            const uint32_t stride = st.d.num_classes + 1;
+            for (size_t k = 0; k < st.d.transitions.size(); k++) {
+                fprintf(fp, "0x%04X,%s", st.d.transitions[k], ((k % stride) == stride - 1) ? "\n" : "");
+            }
+            fprintf(fp, "};\n\n");
+        }
+
+        fprintf(fp, "const pretokenizer_dfa_stage %s_stages[%d] = {\n", m.first.c_str(), int(m.second.size()));
+        for (size_t i = 0; i < m.second.size(); i++) {
+            const stage_output & st = m.second[i];
+            const std::string prefix = m.first + "_" + std::to_string(i);
+            const bool has_buckets = !st.alpha.bucket_stage1.empty();
+            fprintf(fp, "  {\"%s\", %d, %d, %s_ascii_class, %d, %s_bucket_bounds, %s%s, %s%s, %d, %s_nonascii_class, %s_transitions, %s_ascii_loop},\n",
+                    c_escape(st.regex).c_str(), int(st.d.num_states), int(st.d.num_classes), prefix.c_str(),
+                    int(st.alpha.bucket_bounds.size() - 1), prefix.c_str(),
+                    has_buckets ? prefix.c_str() : "nullptr", has_buckets ? "_bucket_stage1" : "",
+                    has_buckets ? prefix.c_str() : "nullptr", has_buckets ? "_bucket_stage2" : "",
+                    int(st.alpha.key_bits), prefix.c_str(), prefix.c_str(), prefix.c_str());
+        }
+        fprintf(fp, "};\n\n");
+    }
+
+    fprintf(fp, "} // namespace\n\n");
+
+    fprintf(fp, "const pretokenizer_dfa pretokenizer_dfa_models[] = {\n");
+    for (const auto & m : models) {
+        fprintf(fp, "  {\"%s\", %d, %s_stages},\n", m.first.c_str(), int(m.second.size()), m.first.c_str());
+    }
+    fprintf(fp, "};\n\n");
+    fprintf(fp, "const uint32_t pretokenizer_dfa_num_models = %d;\n\n", int(models.size()));
+    fprintf(fp, "} // namespace nanotokenizer\n");
+    fclose(fp);
+
+    return 0;
+}
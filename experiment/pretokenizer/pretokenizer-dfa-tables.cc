@@ -0,0 +1,988 @@
+// generated with pretokenizer-dfa-compiler.cc from pretokenizer-models.txt. DO NOT EDIT.
+
+#include "pretokenizer-dfa.hh"
+
+namespace nanotokenizer {
+
+namespace {
+
+// 's|'t|'re|'ve|'m|'ll|'d| ?\\p{L}+| ?\\p{N}+| ?[^\\s\\p{L}\\p{N}]+|\\s+(?!\\S)|\\s+
+const uint8_t gpt2_0_ascii_class[128] = {
+0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,0,0,0,0,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
+0,5,5,5,6,7,5,5,5,5,5,5,8,9,5,5,5,5,10,11,12,5,13,5,5,5,5,0,0,0,0,0,
+};
+
+const uint32_t gpt2_0_bucket_bounds[2] = {
+0x000080,0x110000,
+};
+
+const uint8_t gpt2_0_nonascii_class[512] = {
+0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,
+0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,
+0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,
+0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,
+0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,
+0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,
+0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,
+0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,0,0,4,4,5,5,14,14,
+1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,
+1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,
+1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,
+1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,
+1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,
+1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,
+1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,
+1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,1,1,15,15,16,16,17,17,
+};
+
+const uint64_t gpt2_0_ascii_loop[40] = {
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0xFC00FFFEFFFFC1FFULL,0xF8000001F8000001ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x03FF000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x07FFFFFE07FFFFFEULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000100003E00ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+};
+
+const uint16_t gpt2_0_transitions[380] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0002,0x0003,0x0004,0x0005,0x0006,0x0007,0x0007,0x0007,0x0007,0x0007,0x0007,0x0007,0x0007,0x0007,0x0008,0x0009,0x000A,0x000B,0x0000,
+0x8002,0x8000,0x8000,0x8002,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x800C,0x800C,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x800C,0x800C,0x800C,0x8000,
+0x8002,0x800C,0x800C,0x8002,0x8006,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8008,0x800D,0x800E,0x800F,0x8000,
+0x8002,0x8000,0x8000,0x8002,0x8000,0x8000,0x8010,0x8000,0x8011,0x8010,0x8012,0x8010,0x8010,0x8013,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8006,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8006,0x8006,0x8000,0x8006,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8006,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8006,0x8006,0x8000,0x8006,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8000,
+0x0000,0x800C,0x800C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x800C,0x800C,0x800C,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8006,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8006,0x8006,0x8000,0x8006,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+};
+
+const pretokenizer_dfa_stage gpt2_stages[1] = {
+  {"'s|'t|'re|'ve|'m|'ll|'d| ?\\p{L}+| ?\\p{N}+| ?[^\\s\\p{L}\\p{N}]+|\\s+(?!\\S)|\\s+", 20, 18, gpt2_0_ascii_class, 1, gpt2_0_bucket_bounds, nullptr, nullptr, 9, gpt2_0_nonascii_class, gpt2_0_transitions, gpt2_0_ascii_loop},
+};
+
+// (?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}{1,3}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+
+const uint8_t llama3_0_ascii_class[128] = {
+0,0,0,0,0,0,0,0,0,1,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,
+0,6,6,6,7,8,6,6,6,6,6,6,9,10,6,6,6,6,11,12,13,6,14,6,6,6,6,0,0,0,0,0,
+0,6,6,6,7,8,6,6,6,6,6,6,9,10,6,6,6,6,11,12,13,6,14,6,6,6,6,0,0,0,0,0,
+};
+
+const uint32_t llama3_0_bucket_bounds[2] = {
+0x000080,0x110000,
+};
+
+const uint8_t llama3_0_nonascii_class[512] = {
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+};
+
+const uint64_t llama3_0_ascii_loop[52] = {
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x07FFFFFE07FFFFFEULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0xFC00FFFEFFFFC1FFULL,0xF8000001F8000001ULL,
+0x0000000000002400ULL,0x0000000000000000ULL,
+0x0000000100001A00ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000100001A00ULL,0x0000000000000000ULL,
+0x0000000000002400ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+};
+
+const uint16_t llama3_0_transitions[520] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0002,0x0003,0x0004,0x0005,0x0006,0x0007,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0009,0x000A,0x000B,0x000C,0x0000,
+0x800D,0x8000,0x800E,0x8000,0x800D,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x800F,0x8010,0x800F,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x800F,0x8011,0x8011,0x8000,
+0x8000,0x8012,0x8013,0x8012,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8012,0x8012,0x8012,0x8000,
+0x800D,0x800F,0x8010,0x800F,0x800D,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x800F,0x8011,0x8011,0x8000,
+0x800D,0x8000,0x800E,0x8000,0x800D,0x8000,0x8008,0x8014,0x8008,0x8015,0x8014,0x8016,0x8014,0x8014,0x8017,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8018,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8018,0x8018,0x8000,0x8018,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8018,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8018,0x8018,0x8000,0x8018,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x800D,0x8000,0x800E,0x8000,0x800D,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x800E,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x0000,0x800F,0x8010,0x800F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x800F,0x800F,0x800F,0x8000,
+0x8000,0x8012,0x8013,0x8012,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8012,0x8012,0x8012,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x0000,0x0012,0x0013,0x0012,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0012,0x0012,0x0012,0x0000,
+0x8000,0x8012,0x8013,0x8012,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8012,0x8012,0x8012,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8014,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8014,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8014,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8019,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8019,0x8019,0x8000,0x8019,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+};
+
+const pretokenizer_dfa_stage llama3_stages[1] = {
+  {"(?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}{1,3}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+", 26, 19, llama3_0_ascii_class, 1, llama3_0_bucket_bounds, nullptr, nullptr, 9, llama3_0_nonascii_class, llama3_0_transitions, llama3_0_ascii_loop},
+};
+
+// (?:'[sS]|'[tT]|'[rR][eE]|'[vV][eE]|'[mM]|'[lL][lL]|'[dD])|[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+
+const uint8_t qwen2_0_ascii_class[128] = {
+0,0,0,0,0,0,0,0,0,1,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,
+0,6,6,6,7,8,6,6,6,6,6,6,9,10,6,6,6,6,11,12,13,6,14,6,6,6,6,0,0,0,0,0,
+0,6,6,6,7,8,6,6,6,6,6,6,9,10,6,6,6,6,11,12,13,6,14,6,6,6,6,0,0,0,0,0,
+};
+
+const uint32_t qwen2_0_bucket_bounds[2] = {
+0x000080,0x110000,
+};
+
+const uint8_t qwen2_0_nonascii_class[512] = {
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,0,0,5,5,6,6,15,15,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,1,1,16,16,17,17,18,18,
+};
+
+const uint64_t qwen2_0_ascii_loop[44] = {
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x07FFFFFE07FFFFFEULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0xFC00FFFEFFFFC1FFULL,0xF8000001F8000001ULL,
+0x0000000000002400ULL,0x0000000000000000ULL,
+0x0000000100001A00ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000100001A00ULL,0x0000000000000000ULL,
+0x0000000000002400ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+};
+
+const uint16_t qwen2_0_transitions[440] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0002,0x0003,0x0004,0x0005,0x0006,0x0007,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0009,0x000A,0x000A,0x0000,
+0x800B,0x8000,0x800C,0x8000,0x800B,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x800D,0x800E,0x800D,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x800D,0x800F,0x800F,0x8000,
+0x8000,0x8010,0x8011,0x8010,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8010,0x8010,0x8010,0x8000,
+0x800B,0x800D,0x800E,0x800D,0x800B,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x800D,0x800F,0x800F,0x8000,
+0x800B,0x8000,0x800C,0x8000,0x800B,0x8000,0x8008,0x8012,0x8008,0x8013,0x8012,0x8014,0x8012,0x8012,0x8015,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x800B,0x8000,0x800C,0x8000,0x800B,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x800C,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x0000,0x800D,0x800E,0x800D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x800D,0x800D,0x800D,0x8000,
+0x8000,0x8010,0x8011,0x8010,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8010,0x8010,0x8010,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x0000,0x0010,0x0011,0x0010,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0010,0x0010,0x0010,0x0000,
+0x8000,0x8010,0x8011,0x8010,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8010,0x8010,0x8010,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8012,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8012,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8012,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8000,
+};
+
+const pretokenizer_dfa_stage qwen2_stages[1] = {
+  {"(?:'[sS]|'[tT]|'[rR][eE]|'[vV][eE]|'[mM]|'[lL][lL]|'[dD])|[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+", 22, 19, qwen2_0_ascii_class, 1, qwen2_0_bucket_bounds, nullptr, nullptr, 9, qwen2_0_nonascii_class, qwen2_0_transitions, qwen2_0_ascii_loop},
+};
+
+// \\p{N}{1,3}
+const uint8_t deepseek3_0_ascii_class[128] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const uint32_t deepseek3_0_bucket_bounds[2] = {
+0x000080,0x110000,
+};
+
+const uint8_t deepseek3_0_nonascii_class[512] = {
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+};
+
+const uint64_t deepseek3_0_ascii_loop[10] = {
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+};
+
+const uint16_t deepseek3_0_transitions[15] = {
+0x0000,0x0000,0x0000,
+0x0000,0x0002,0x0000,
+0x8000,0x8003,0x8000,
+0x8000,0x8004,0x8000,
+0x8000,0x8000,0x8000,
+};
+
+// [\344\270\200-\351\276\245\343\201\200-\343\202\237\343\202\240-\343\203\277]+
+const uint8_t deepseek3_1_ascii_class[128] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const uint32_t deepseek3_1_bucket_bounds[7] = {
+0x000080,0x003040,0x0030A0,0x003100,0x004E00,0x009FA6,0x110000,
+};
+
+const uint8_t deepseek3_1_bucket_stage1[4352] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,4,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+};
+
+const uint8_t deepseek3_1_bucket_stage2[1536] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+};
+
+const uint8_t deepseek3_1_nonascii_class[3072] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const uint64_t deepseek3_1_ascii_loop[6] = {
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+};
+
+const uint16_t deepseek3_1_transitions[9] = {
+0x0000,0x0000,0x0000,
+0x0000,0x0002,0x0000,
+0x8000,0x8002,0x8000,
+};
+
+// [!\"#$%&'()*+,\\-./:;<=>?@\\[\\\\\\]^_`{|}~][A-Za-z]+|[^\\r\\n\\p{L}\\p{P}\\p{S}]?[\\p{L}\\p{M}]+| ?[\\p{P}\\p{S}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+
+const uint8_t deepseek3_2_ascii_class[128] = {
+0,0,0,0,0,0,0,0,0,1,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,4,4,4,4,4,4,
+4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,
+4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,4,4,4,0,
+};
+
+const uint32_t deepseek3_2_bucket_bounds[2] = {
+0x000080,0x110000,
+};
+
+const uint8_t deepseek3_2_nonascii_class[512] = {
+0,0,0,0,6,6,6,6,0,0,0,0,6,6,6,6,7,7,7,7,6,6,6,6,7,7,7,7,6,6,6,6,
+8,8,8,8,9,9,9,9,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+8,8,8,8,9,9,9,9,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+8,8,8,8,9,9,9,9,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+0,0,0,0,6,6,6,6,0,0,0,0,6,6,6,6,7,7,7,7,6,6,6,6,7,7,7,7,6,6,6,6,
+8,8,8,8,9,9,9,9,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+8,8,8,8,9,9,9,9,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+8,8,8,8,9,9,9,9,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+1,1,1,1,10,10,10,10,1,1,1,1,10,10,10,10,11,11,11,11,10,10,10,10,11,11,11,11,10,10,10,10,
+12,12,12,12,13,13,13,13,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+12,12,12,12,13,13,13,13,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+12,12,12,12,13,13,13,13,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+1,1,1,1,10,10,10,10,1,1,1,1,10,10,10,10,11,11,11,11,10,10,10,10,11,11,11,11,10,10,10,10,
+12,12,12,12,13,13,13,13,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+12,12,12,12,13,13,13,13,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+12,12,12,12,13,13,13,13,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+};
+
+const uint64_t deepseek3_2_ascii_loop[48] = {
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x07FFFFFE07FFFFFEULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0xFC00FFFE00000000ULL,0x78000001F8000001ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000100001A00ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000100001A00ULL,0x0000000000000000ULL,
+0x0000000000002400ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000002400ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x07FFFFFE07FFFFFEULL,
+};
+
+const uint16_t deepseek3_2_transitions[360] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0002,0x0003,0x0004,0x0005,0x0006,0x0007,0x0007,0x0008,0x0009,0x000A,0x000B,0x000C,0x000D,0x000E,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x0007,0x0007,0x0000,0x0007,0x0007,0x0007,0x0000,0x0007,0x0000,
+0x8000,0x800F,0x8010,0x800F,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8011,0x8011,0x800F,0x8011,0x8000,
+0x8000,0x8012,0x8013,0x8012,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8012,0x8012,0x8012,0x8012,0x8000,
+0x8000,0x800F,0x8010,0x800F,0x8009,0x8007,0x8007,0x8007,0x8009,0x800A,0x8011,0x8011,0x8014,0x8015,0x8000,
+0x8000,0x8000,0x8016,0x8000,0x8009,0x8017,0x8000,0x8000,0x8009,0x8009,0x8000,0x8000,0x8009,0x8009,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8000,
+0x8000,0x8000,0x8016,0x8000,0x8009,0x8000,0x8000,0x8000,0x8009,0x8009,0x8000,0x8000,0x8009,0x8009,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8000,
+0x8000,0x8000,0x8016,0x8000,0x8009,0x8000,0x8000,0x8000,0x8009,0x8009,0x8000,0x8000,0x8009,0x8009,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8000,
+0x0000,0x800F,0x8010,0x800F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x800F,0x800F,0x800F,0x800F,0x8000,
+0x8000,0x8012,0x8013,0x8012,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8012,0x8012,0x8012,0x8012,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8000,
+0x0000,0x0012,0x0013,0x0012,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0012,0x0012,0x0012,0x0012,0x0000,
+0x8000,0x8012,0x8013,0x8012,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8012,0x8012,0x8012,0x8012,0x8000,
+0x8000,0x8000,0x8016,0x8000,0x8009,0x8000,0x8000,0x8000,0x8009,0x8009,0x8000,0x8000,0x8009,0x8009,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8007,0x8007,0x8000,0x8007,0x8000,
+0x8000,0x8000,0x8016,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8017,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+};
+
+const pretokenizer_dfa_stage deepseek3_stages[3] = {
+  {"\\p{N}{1,3}", 5, 2, deepseek3_0_ascii_class, 1, deepseek3_0_bucket_bounds, nullptr, nullptr, 9, deepseek3_0_nonascii_class, deepseek3_0_transitions, deepseek3_0_ascii_loop},
+  {"[\344\270\200-\351\276\245\343\201\200-\343\202\237\343\202\240-\343\203\277]+", 3, 2, deepseek3_1_ascii_class, 6, deepseek3_1_bucket_bounds, deepseek3_1_bucket_stage1, deepseek3_1_bucket_stage2, 9, deepseek3_1_nonascii_class, deepseek3_1_transitions, deepseek3_1_ascii_loop},
+  {"[!\"#$%&'()*+,\\-./:;<=>?@\\[\\\\\\]^_`{|}~][A-Za-z]+|[^\\r\\n\\p{L}\\p{P}\\p{S}]?[\\p{L}\\p{M}]+| ?[\\p{P}\\p{S}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+", 24, 14, deepseek3_2_ascii_class, 1, deepseek3_2_bucket_bounds, nullptr, nullptr, 9, deepseek3_2_nonascii_class, deepseek3_2_transitions, deepseek3_2_ascii_loop},
+};
+
+// [^\\r\\n\\p{L}\\p{N}]?[\\p{Lu}\\p{Lt}\\p{Lm}\\p{Lo}\\p{M}]*[\\p{Ll}\\p{Lm}\\p{Lo}\\p{M}]+(?i:'s|'t|'re|'ve|'m|'ll|'d)?|[^\\r\\n\\p{L}\\p{N}]?[\\p{Lu}\\p{Lt}\\p{Lm}\\p{Lo}\\p{M}]+[\\p{Ll}\\p{Lm}\\p{Lo}\\p{M}]*(?i:'s|'t|'re|'ve|'m|'ll|'d)?|\\p{N}{1,3}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n/]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+
+const uint8_t gpt4o_0_ascii_class[128] = {
+0,0,0,0,0,0,0,0,0,1,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,0,0,0,4,0,0,0,0,0,0,0,5,6,6,6,6,6,6,6,6,6,6,0,0,0,0,0,0,
+0,7,7,7,8,9,7,7,7,7,7,7,10,11,7,7,7,7,12,13,14,7,15,7,7,7,7,0,0,0,0,0,
+0,16,16,16,17,18,16,16,16,16,16,16,19,20,16,16,16,16,21,22,23,16,24,16,16,16,16,0,0,0,0,0,
+};
+
+const uint32_t gpt4o_0_bucket_bounds[2] = {
+0x000080,0x110000,
+};
+
+const uint8_t gpt4o_0_nonascii_class[4096] = {
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+39,39,40,40,16,16,40,40,39,39,40,40,16,16,40,40,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+39,39,40,40,16,16,40,40,39,39,40,40,16,16,40,40,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+39,39,40,40,16,16,40,40,39,39,40,40,16,16,40,40,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+39,39,40,40,16,16,40,40,39,39,40,40,16,16,40,40,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+39,39,40,40,16,16,40,40,39,39,40,40,16,16,40,40,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+39,39,40,40,16,16,40,40,39,39,40,40,16,16,40,40,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+39,39,40,40,16,16,40,40,39,39,40,40,16,16,40,40,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+39,39,40,40,16,16,40,40,39,39,40,40,16,16,40,40,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+41,41,42,42,43,43,42,42,41,41,42,42,43,43,42,42,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+41,41,42,42,43,43,42,42,41,41,42,42,43,43,42,42,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+41,41,42,42,43,43,42,42,41,41,42,42,43,43,42,42,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+41,41,42,42,43,43,42,42,41,41,42,42,43,43,42,42,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+41,41,42,42,43,43,42,42,41,41,42,42,43,43,42,42,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+41,41,42,42,43,43,42,42,41,41,42,42,43,43,42,42,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+41,41,42,42,43,43,42,42,41,41,42,42,43,43,42,42,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+41,41,42,42,43,43,42,42,41,41,42,42,43,43,42,42,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+34,34,35,35,7,7,35,35,34,34,35,35,7,7,35,35,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+36,36,37,37,38,38,37,37,36,36,37,37,38,38,37,37,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+0,0,6,6,25,25,6,6,0,0,6,6,25,25,6,6,26,26,27,27,28,28,27,27,26,26,27,27,28,28,27,27,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+1,1,29,29,30,30,29,29,1,1,29,29,30,30,29,29,31,31,32,32,33,33,32,32,31,31,32,32,33,33,32,32,
+};
+
+const uint64_t gpt4o_0_ascii_loop[104] = {
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000007FFFFFEULL,
+0x0000000000000000ULL,0x07FFFFFE00000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0xFC00FFFEFFFFC1FFULL,0xF8000001F8000001ULL,
+0x0000800000002400ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000100001A00ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000100001A00ULL,0x0000000000000000ULL,
+0x0000000000002400ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000007FFFFFEULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+0x0000000000000000ULL,0x0000000000000000ULL,
+};
+
+const uint16_t gpt4o_0_transitions[2340] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0002,0x0003,0x0004,0x0005,0x0002,0x0002,0x0006,0x0007,0x0007,0x0007,0x0007,0x0007,0x0007,0x0007,0x0007,0x0007,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0000,0x0009,0x000A,0x000B,0x000C,0x000D,0x000E,0x000F,0x0010,0x0011,0x0012,0x0013,0x0014,0x0015,0x0016,0x0017,0x0018,0x0019,0x001A,0x0000,
+0x801B,0x8000,0x801C,0x8000,0x801B,0x801B,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x801D,0x800B,0x800B,0x8000,0x8000,0x800B,0x800B,0x800B,0x801E,0x8007,0x8007,0x8007,0x8007,0x801F,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8020,0x8021,0x8020,0x8000,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x800B,0x800B,0x800B,0x8020,0x8020,0x8022,0x8022,0x8022,0x8007,0x8007,0x8023,0x8023,0x8023,0x8008,0x8008,0x8024,0x8024,0x8024,0x8000,
+0x8000,0x8025,0x8026,0x8025,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8025,0x8025,0x8025,0x8025,0x8025,0x8000,0x8000,0x8025,0x8025,0x8025,0x8000,0x8000,0x8025,0x8025,0x8025,0x8000,
+0x801B,0x8020,0x8021,0x8020,0x801B,0x801B,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x801D,0x800B,0x800B,0x8020,0x8020,0x8022,0x8022,0x8022,0x801E,0x8007,0x8023,0x8023,0x8023,0x801F,0x8008,0x8024,0x8024,0x8024,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8027,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8027,0x8000,0x8027,0x8000,0x8000,0x8027,0x8000,0x8000,0x8027,0x8000,0x8027,0x8000,0x8000,0x8027,0x8000,0x8027,0x8000,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8028,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,0x800B,0x800B,0x800B,0x8000,0x8000,0x800B,0x800B,0x800B,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8027,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8027,0x8000,0x8027,0x8000,0x8000,0x8027,0x8000,0x8000,0x8027,0x8000,0x8027,0x8000,0x8000,0x8027,0x8000,0x8027,0x8000,0x8000,
+0x8000,0x8020,0x8021,0x8020,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8020,0x8020,0x8020,0x8020,0x8020,0x8000,0x8000,0x8020,0x8020,0x8020,0x8000,0x8000,0x8020,0x8020,0x8020,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8028,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,0x800B,0x800B,0x800B,0x8000,0x8000,0x800B,0x800B,0x800B,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8028,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,0x800B,0x800B,0x800B,0x8000,0x8000,0x800B,0x800B,0x800B,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8028,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,0x800B,0x800B,0x800B,0x8000,0x8000,0x800B,0x800B,0x800B,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8028,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,0x800B,0x800B,0x800B,0x8000,0x8000,0x800B,0x800B,0x800B,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8028,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,0x800B,0x800B,0x800B,0x8000,0x8000,0x800B,0x800B,0x800B,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x801B,0x8000,0x801C,0x8000,0x801B,0x801B,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x801B,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x801B,0x8000,0x8000,0x8000,0x8000,0x801B,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x801C,0x8000,0x8000,0x801C,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8028,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,0x800B,0x800B,0x800B,0x8000,0x8000,0x800B,0x800B,0x800B,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x0000,0x8020,0x8021,0x8020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8020,0x8020,0x8020,0x8020,0x8020,0x0000,0x0000,0x8020,0x8020,0x8020,0x0000,0x0000,0x8020,0x8020,0x8020,0x8000,
+0x8000,0x8025,0x8026,0x8025,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8025,0x8025,0x8025,0x8025,0x8025,0x8000,0x8000,0x8025,0x8025,0x8025,0x8000,0x8000,0x8025,0x8025,0x8025,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8028,0x8000,0x8000,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,0x800B,0x800B,0x800B,0x8000,0x8000,0x800B,0x800B,0x800B,0x8007,0x8007,0x8007,0x8007,0x8007,0x8029,0x8029,0x8029,0x8029,0x8029,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x0000,0x0025,0x0026,0x0025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0025,0x0025,0x0025,0x0025,0x0025,0x0000,0x0000,0x0025,0x0025,0x0025,0x0000,0x0000,0x0025,0x0025,0x0025,0x0000,
+0x8000,0x8025,0x8026,0x8025,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8025,0x8025,0x8025,0x8025,0x8025,0x8000,0x8000,0x8025,0x8025,0x8025,0x8000,0x8000,0x8025,0x8025,0x8025,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x802D,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x802D,0x8000,0x802D,0x8000,0x8000,0x802D,0x8000,0x8000,0x802D,0x8000,0x802D,0x8000,0x8000,0x802D,0x8000,0x802D,0x8000,0x8000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x002E,0x002D,0x002F,0x002D,0x002D,0x0030,0x0000,0x002D,0x0000,0x002E,0x002D,0x002F,0x002D,0x002D,0x0030,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8008,0x8008,0x8008,0x8000,0x8000,0x8000,0x8000,0x8000,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0031,0x002D,0x0032,0x002D,0x002D,0x0033,0x0000,0x002D,0x0000,0x0031,0x002D,0x0032,0x002D,0x002D,0x0033,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002B,0x002B,0x002B,0x002B,0x002B,0x002B,0x002B,0x002B,0x002B,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0008,0x0000,0x002C,0x002C,0x002C,0x0000,0x0000,0x002C,0x002C,0x002C,0x002B,0x002B,0x002B,0x002B,0x002B,0x0008,0x0008,0x0008,0x0008,0x0008,0x0000,
+0x8000,0x8000,0x8000,0x8000,0x802A,0x8000,0x8000,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,0x802C,0x802C,0x802C,0x8000,0x8000,0x802C,0x802C,0x802C,0x802B,0x802B,0x802B,0x802B,0x802B,0x8008,0x8008,0x8008,0x8008,0x8008,0x8000,
+0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x002D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+};
+
+const pretokenizer_dfa_stage gpt4o_stages[1] = {
+  {"[^\\r\\n\\p{L}\\p{N}]?[\\p{Lu}\\p{Lt}\\p{Lm}\\p{Lo}\\p{M}]*[\\p{Ll}\\p{Lm}\\p{Lo}\\p{M}]+(?i:'s|'t|'re|'ve|'m|'ll|'d)?|[^\\r\\n\\p{L}\\p{N}]?[\\p{Lu}\\p{Lt}\\p{Lm}\\p{Lo}\\p{M}]+[\\p{Ll}\\p{Lm}\\p{Lo}\\p{M}]*(?i:'s|'t|'re|'ve|'m|'ll|'d)?|\\p{N}{1,3}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n/]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+", 52, 44, gpt4o_0_ascii_class, 1, gpt4o_0_bucket_bounds, nullptr, nullptr, 12, gpt4o_0_nonascii_class, gpt4o_0_transitions, gpt4o_0_ascii_loop},
+};
+
+} // namespace
+
+const pretokenizer_dfa pretokenizer_dfa_models[] = {
+  {"gpt2", 1, gpt2_stages},
+  {"llama3", 1, llama3_stages},
+  {"qwen2", 1, qwen2_stages},
+  {"deepseek3", 3, deepseek3_stages},
+  {"gpt4o", 1, gpt4o_stages},
+};
+
+const uint32_t pretokenizer_dfa_num_models = 5;
+
+} // namespace nanotokenizer
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: MIT
+// Copyright 2024-Present Light Transport Entertainment Inc.
+//
+// Table-driven DFA for pretokenizer split regex.
+// Tables are generated offline by pretokenizer-dfa-compiler.cc from
+// pretokenizer-models.txt. See `pretokenize_dfa` in nanopretokenizer.hh.
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace nanotokenizer {
+
+// One split regex compiled to a DFA over character classes.
+//
+// Character class of a codepoint:
+//   cp < 128 : ascii_class[cp]
+//   else     : nonascii_class[(bucket << key_bits) | pretokenizer_dfa_key(flags)]
+// where `flags` is codepoint_flags and `bucket` is the index of the
+// [bucket_bounds[i], bucket_bounds[i + 1]) interval containing cp(non-ASCII
+// literal ranges used in the regex). Buckets are looked up with a two-stage
+// table as the flags:
+//   bucket = bucket_stage2[(bucket_stage1[cp >> BITS] << BITS) | (cp & MASK)]
+// (nullptr when there is one bucket). Codepoints out of Unicode range fall
+// into the last bucket. `key_bits` is 12 when the regex uses letter
+// subcategories(\p{Lu} etc.), 9 otherwise(the letter type is masked out).
+// Class `num_classes` is the end of text.
+//
+// transitions[state * (num_classes + 1) + class]:
+//   bits 0-14: next state(0 = dead, 1 = start)
+//   bit 15   : match ends before this codepoint(leftmost-first semantics)
+//
+// ascii_loop[state * 2 + (c >> 6)] bit (c & 63): ASCII codepoint `c` stays in
+// `state`, with the same match bit as the other bytes of the set. Runs of
+// them are scanned over raw bytes.
+struct pretokenizer_dfa_stage {
+    const char * regex;
+    uint32_t num_states;
+    uint32_t num_classes;
+    const uint8_t * ascii_class;     // [128]
+    uint32_t num_buckets;
+    const uint32_t * bucket_bounds;  // [num_buckets + 1]
+    const uint8_t * bucket_stage1;   // [0x110000 >> PRETOKENIZER_DFA_BUCKET_BLOCK_BITS]
+    const uint8_t * bucket_stage2;   // [num_blocks << PRETOKENIZER_DFA_BUCKET_BLOCK_BITS]
+    uint32_t key_bits;
+    const uint8_t * nonascii_class;  // [num_buckets << key_bits]
+    const uint16_t * transitions;    // [num_states * (num_classes + 1)]
+    const uint64_t * ascii_loop;     // [num_states * 2]
+};
+
+static const uint32_t PRETOKENIZER_DFA_BUCKET_BLOCK_BITS = 8;
+static const uint32_t PRETOKENIZER_DFA_BUCKET_BLOCK_MASK = (1u << PRETOKENIZER_DFA_BUCKET_BLOCK_BITS) - 1;
+
+// Class key of codepoint_flags `flags`: categories(bits 0-7),
+// is_whitespace(bit 8) and letter_type(flags bits 12-14 -> key bits 9-11).
+static inline uint32_t pretokenizer_dfa_key(const uint16_t flags) {
+    return uint32_t(flags & 0x1FF) | (uint32_t(flags >> 3) & 0xE00);
+}
+
+static const uint16_t PRETOKENIZER_DFA_MATCH = 0x8000;
+static const uint16_t PRETOKENIZER_DFA_STATE_MASK = 0x7FFF;
+static const uint32_t PRETOKENIZER_DFA_START = 1;
+
+// Pretokenizer of a model. Each stage splits the words produced by the
+// previous stage. Text not matched by a stage is kept as a word.
+struct pretokenizer_dfa {
+    const char * name;
+    uint32_t num_stages;
+    const pretokenizer_dfa_stage * stages;
+};
+
+extern const pretokenizer_dfa pretokenizer_dfa_models[];
+extern const uint32_t pretokenizer_dfa_num_models;
+
+// Returns nullptr when no model named `name` exists.
+const pretokenizer_dfa * pretokenizer_dfa_find(const std::string & name);
+
+} // namespace nanotokenizer
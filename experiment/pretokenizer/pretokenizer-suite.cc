@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+// Copyright 2024-Present Light Transport Entertainment Inc.
+//
+// Pretokenizer correctness and throughput suite.
+//
+// For each corpus in testdata/(see gen-pretokenizer-golden.py), checks the
+// hand written kernels and the DFA models against the golden splits of the
+// reference regex, then reports MB/s and Mwords/s.
+//
+// $ make bench-suite
+//
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "nanopretokenizer.hh"
+#include "pretokenizer-dfa.hh"
+
+using namespace nanotokenizer;
+
+namespace {
+
+const char *kCorpora[] = {"english", "cjk", "code", "emoji", "whitespace"};
+
+bool read_file(const std::string &filename, std::string &data) {
+  std::ifstream ifs(filename, std::ios::binary);
+  if (!ifs) {
+    return false;
+  }
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  data = ss.str();
+  return true;
+}
+
+bool read_golden(const std::string &filename, std::vector<size_t> &lengths) {
+  std::ifstream ifs(filename);
+  if (!ifs) {
+    return false;
+  }
+  lengths.clear();
+  size_t n;
+  while (ifs >> n) {
+    lengths.push_back(n);
+  }
+  return true;
+}
+
+// Returns the index of the first differing word, or -1 when equal.
+long first_mismatch(const std::vector<pretoken_span> &spans, const std::vector<size_t> &golden) {
+  const size_t n = spans.size() < golden.size() ? spans.size() : golden.size();
+  for (size_t i = 0; i < n; i++) {
+    if (spans[i].length != golden[i]) {
+      return long(i);
+    }
+  }
+  return spans.size() == golden.size() ? -1 : long(n);
+}
+
+void print_mismatch(const char *corpus, const char *kernel, const std::string &text,
+                    const std::vector<pretoken_span> &spans, const std::vector<size_t> &golden, long idx) {
+  size_t offset = 0;
+  for (long i = 0; i < idx; i++) {
+    offset += golden[size_t(i)];
+  }
+  const size_t expected = size_t(idx) < golden.size() ? golden[size_t(idx)] : 0;
+  const size_t actual = size_t(idx) < spans.size() ? spans[size_t(idx)].length : 0;
+  printf("  MISMATCH %s/%s at word %ld(byte %zu): expected '%s', got '%s'\n", corpus, kernel, idx, offset,
+         text.substr(offset, expected).c_str(), text.substr(offset, actual).c_str());
+}
+
+// Repeat `text` up to about `nbytes` for stable timing.
+std::string repeat(const std::string &text, size_t nbytes) {
+  std::string out;
+  while (out.size() < nbytes) {
+    out += text;
+  }
+  return out;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::string dir = argc > 1 ? argv[1] : "testdata";
+  const size_t nrepeat = 5;
+
+  struct kernel {
+    std::string name;
+    std::string model;  // golden
+    pretokenize_span_fn fn;
+    const pretokenizer_dfa *dfa;
+  };
+  std::vector<kernel> kernels = {
+    {"gpt2", "gpt2", pretokenize_gpt2, nullptr},
+    {"llama3", "llama3", pretokenize_llama3, nullptr},
+    {"qwen2", "qwen2", pretokenize_qwen2, nullptr},
+  };
+  for (uint32_t m = 0; m < pretokenizer_dfa_num_models; m++) {
+    const pretokenizer_dfa &dfa = pretokenizer_dfa_models[m];
+    kernels.push_back({std::string("dfa:") + dfa.name, dfa.name, nullptr, &dfa});
+  }
+
+  int failures = 0;
+  for (const char *corpus : kCorpora) {
+    std::string text;
+    if (!read_file(dir + "/" + corpus + ".txt", text)) {
+      fprintf(stderr, "Failed to read %s/%s.txt. Run `make gen-golden`.\n", dir.c_str(), corpus);
+      return -1;
+    }
+    const std::string input = repeat(text, 8 * 1024 * 1024);
+    printf("[%s] %zu bytes\n", corpus, text.size());
+
+    std::vector<pretoken_span> spans;
+    for (const auto &k : kernels) {
+      std::vector<size_t> golden;
+      if (!read_golden(dir + "/" + corpus + "." + k.model + ".golden", golden)) {
+        fprintf(stderr, "Failed to read golden of %s/%s\n", corpus, k.model.c_str());
+        return -1;
+      }
+
+      auto run = [&](const std::string &s) {
+        if (k.dfa) {
+          pretokenize_dfa(*k.dfa, s.data(), s.size(), spans);
+        } else {
+          k.fn(s.data(), s.size(), spans);
+        }
+      };
+
+      run(text);
+      const long idx = first_mismatch(spans, golden);
+      if (idx >= 0) {
+        print_mismatch(corpus, k.name.c_str(), text, spans, golden, idx);
+        failures++;
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < nrepeat; i++) {
+        run(input);
+      }
+      const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      printf("%-14s %8.2f MB/s %8.2f Mwords/s %s\n", k.name.c_str(),
+             double(input.size() * nrepeat) / (1024.0 * 1024.0) / sec,
+             double(spans.size() * nrepeat) / 1e6 / sec, idx >= 0 ? "MISMATCH" : "ok");
+    }
+  }
+
+  if (failures) {
+    printf("%d mismatches\n", failures);
+    return -1;
+  }
+  printf("all splits match the golden\n");
+  return 0;
+}
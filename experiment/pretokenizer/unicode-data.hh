@@ -16,10 +16,53 @@ struct range_nfd {
 
 static const uint32_t MAX_CODEPOINTS = 0x110000;
 
+// Two-stage codepoint flags table(generated by gen-unicode-flags-table.cc)
+// flags(cp) = unicode_flags_stage2[(unicode_flags_stage1[cp >> BITS] << BITS) | (cp & MASK)]
+static const uint32_t UNICODE_FLAGS_BLOCK_BITS = 6;
+static const uint32_t UNICODE_FLAGS_BLOCK_MASK = (1u << UNICODE_FLAGS_BLOCK_BITS) - 1;
+
+extern const uint16_t unicode_flags_stage1[MAX_CODEPOINTS >> UNICODE_FLAGS_BLOCK_BITS];
+extern const uint16_t unicode_flags_stage2[];
+
+// Lowercase and NFD mappings in the same layout, stored as `mapped - cp`.
+extern const uint16_t unicode_lower_stage1[MAX_CODEPOINTS >> UNICODE_FLAGS_BLOCK_BITS];
+extern const int32_t unicode_lower_stage2[];
+extern const uint16_t unicode_nfd_stage1[MAX_CODEPOINTS >> UNICODE_FLAGS_BLOCK_BITS];
+extern const int32_t unicode_nfd_stage2[];
+
+// Normalization tables(generated by gen-unicode-normalization.py)
+// record(cp) = unicode_norm_records[unicode_norm_stage2[(unicode_norm_stage1[cp >> BITS] << BITS) | (cp & MASK)]]
+struct unicode_norm_record {
+    uint8_t ccc;        // canonical combining class
+    uint8_t qc;         // quick check(0: yes, 1: no, 2: maybe), 2 bits per `unicode_normalization_form`
+    uint8_t boundary;   // bit per form: text can be split before this codepoint
+    uint8_t d_len;      // full canonical decomposition. 0: none(or Hangul syllable)
+    uint8_t kd_len;     // full compatibility decomposition. 0: none(or Hangul syllable)
+    uint16_t d_offset;  // in unicode_norm_decomp
+    uint16_t kd_offset;
+};
+
+// Primary composites sorted by `key` = (first << 21) | second. Hangul excluded.
+struct unicode_norm_composite {
+    uint64_t key;
+    uint32_t composite;
+};
+
+extern const uint16_t unicode_norm_stage1[MAX_CODEPOINTS >> UNICODE_FLAGS_BLOCK_BITS];
+extern const uint16_t unicode_norm_stage2[];
+extern const unicode_norm_record unicode_norm_records[];
+extern const uint32_t unicode_norm_decomp[];
+extern const uint32_t unicode_norm_num_composites;
+extern const unicode_norm_composite unicode_norm_composites[];
+
 extern const std::initializer_list<std::pair<uint32_t, uint16_t>> unicode_ranges_flags;
 extern const std::unordered_set<uint32_t> unicode_set_whitespace;
 extern const std::initializer_list<std::pair<uint32_t, uint32_t>> unicode_map_lowercase;
 extern const std::initializer_list<std::pair<uint32_t, uint32_t>> unicode_map_uppercase;
 extern const std::initializer_list<range_nfd> unicode_ranges_nfd;
 
+// Letter subcategory ranges(generated by gen-unicode-letter-data.py). Only
+// needed to generate the flags table.
+extern const std::initializer_list<std::pair<uint32_t, uint8_t>> unicode_ranges_letter_type;
+
 } // namespace nanotokenizer
@@ -0,0 +1,7292 @@
+// generated with gen-unicode-flags-table.cc. DO NOT EDIT.
+// 692 unique blocks of 64 codepoints. 123392 bytes total.
+
+#include "unicode-data.hh"
+
+namespace nanotokenizer {
+
+const uint16_t unicode_flags_stage1[17408] = {
+0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,
+48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+64,65,66,67,68,26,26,26,26,69,70,71,72,73,74,75,
+76,26,26,26,26,26,26,26,26,77,78,79,80,81,82,83,
+84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,
+100,101,102,103,104,105,106,107,108,108,109,108,110,111,112,113,
+114,115,116,117,118,119,120,121,122,123,124,125,126,125,125,125,
+127,128,129,130,125,125,125,125,125,125,125,125,125,131,132,133,
+125,125,125,125,125,125,134,135,125,125,125,136,125,137,138,125,
+139,140,108,141,142,143,144,145,146,147,148,149,125,125,125,150,
+151,152,153,154,155,26,156,157,158,159,160,125,125,125,125,125,
+26,26,161,162,163,26,26,26,26,26,26,164,26,26,165,26,
+166,167,26,168,169,26,26,26,170,171,26,172,173,174,175,26,
+176,177,26,26,178,26,179,26,26,26,180,26,181,26,26,182,
+183,184,179,185,166,26,26,26,186,26,187,26,188,189,26,190,
+191,192,26,26,192,193,26,194,195,26,196,197,26,26,26,26,
+26,26,26,26,26,26,163,198,26,199,200,26,178,26,26,177,
+26,26,26,201,26,179,26,125,202,165,203,204,26,187,205,26,
+206,207,189,208,26,209,210,211,212,213,214,215,216,217,26,218,
+219,220,221,222,223,224,225,226,184,227,26,228,229,26,191,230,
+231,232,233,234,235,236,26,237,238,239,195,26,240,26,241,242,
+243,244,245,246,189,247,248,249,250,251,252,253,254,255,256,257,
+258,195,259,260,261,262,263,264,265,175,266,267,268,269,270,271,
+272,273,274,275,26,276,189,277,278,279,280,281,282,283,284,285,
+286,287,288,26,289,290,185,291,292,26,293,294,295,296,297,26,
+26,298,299,300,301,302,241,303,304,170,169,305,306,170,26,307,
+308,309,310,173,26,311,312,313,314,315,316,317,291,318,319,320,
+321,322,323,324,325,326,26,327,328,329,26,330,331,332,333,26,
+26,334,335,336,337,338,339,340,312,341,342,343,187,26,26,344,
+196,345,346,347,348,349,350,351,352,353,26,26,196,354,355,207,
+353,356,357,26,358,26,26,359,360,361,362,363,364,365,366,367,
+268,368,26,369,179,172,26,370,371,372,373,327,374,375,376,377,
+378,379,26,380,223,381,382,26,26,26,383,384,385,176,332,26,
+26,386,192,387,388,389,182,390,26,26,26,391,392,327,393,26,
+394,395,396,397,398,291,399,400,401,402,26,403,275,324,26,228,
+163,26,26,26,26,26,404,26,170,405,406,407,408,409,26,410,
+411,320,26,412,413,26,414,415,26,291,26,26,287,166,26,26,
+26,416,26,268,26,414,417,207,320,418,419,420,421,422,423,26,
+424,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,425,426,26,26,26,26,427,428,429,430,431,432,433,434,
+435,436,437,438,439,440,441,442,443,444,445,446,447,448,449,450,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,451,452,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,26,26,26,26,26,454,26,455,456,457,458,459,
+26,26,26,26,460,461,462,463,464,465,26,466,467,468,469,470,
+471,472,26,473,474,475,476,477,478,478,479,480,481,482,483,484,
+485,486,487,488,489,490,491,478,26,26,26,26,492,493,494,478,
+495,496,497,498,499,478,500,501,502,503,504,505,506,507,508,478,
+26,509,510,511,512,478,478,478,478,513,514,515,516,517,518,519,
+520,521,522,523,524,525,526,527,528,529,530,531,532,533,478,478,
+534,535,536,537,478,478,538,539,540,541,542,543,544,545,478,478,
+546,478,547,548,549,550,551,552,553,554,555,556,557,478,478,478,
+558,559,560,478,561,562,563,478,478,478,478,564,565,566,567,568,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,455,478,
+569,570,26,26,26,571,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,572,573,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+574,575,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+26,26,26,26,26,26,26,26,26,545,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+26,26,26,26,26,26,26,26,556,576,577,578,579,580,581,478,
+478,478,478,478,478,478,478,478,478,582,583,478,26,584,585,586,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,587,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,588,509,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,589,
+26,26,26,26,590,591,26,26,26,26,26,592,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+26,593,594,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,595,596,125,597,
+125,125,125,598,599,600,601,602,125,603,478,604,125,605,478,478,
+606,607,608,609,610,611,612,613,614,615,616,617,618,619,620,621,
+125,125,125,125,125,125,125,125,622,623,624,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,625,478,478,478,
+626,627,628,478,629,630,478,478,478,478,631,632,478,478,478,478,
+478,478,478,633,478,478,478,478,478,478,478,478,478,478,478,634,
+26,26,26,635,636,637,478,478,478,478,478,478,478,478,478,478,
+478,638,639,478,640,478,478,478,641,642,643,644,478,478,478,478,
+645,125,646,647,648,125,649,650,651,652,478,478,125,125,125,125,
+125,125,125,125,125,125,125,125,125,125,125,653,125,654,125,655,
+656,657,658,478,125,125,125,125,125,659,660,661,125,125,662,663,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+26,26,26,26,327,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,664,191,26,26,207,26,26,26,26,26,26,26,
+275,26,26,320,26,26,26,26,171,26,26,26,26,185,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,172,26,26,26,26,26,26,293,291,26,26,26,26,
+26,26,26,26,26,26,26,261,26,26,26,26,176,26,26,26,
+26,26,26,26,191,26,26,665,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,666,26,26,26,26,26,266,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,289,26,26,26,26,
+26,667,26,26,26,26,26,26,26,26,26,26,668,26,26,266,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+324,26,26,26,26,26,26,26,26,26,669,26,26,162,670,671,
+26,672,26,26,26,26,26,26,26,26,185,26,26,26,26,26,
+26,26,414,26,26,26,26,26,26,26,245,207,26,26,26,26,
+26,26,182,26,320,26,26,26,26,26,26,673,26,320,177,26,
+26,26,26,26,26,26,26,26,26,185,26,170,26,26,192,26,
+26,26,26,26,26,26,26,26,261,26,26,26,195,26,26,26,
+289,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+222,26,287,26,26,26,26,26,26,26,26,26,26,26,674,26,
+26,275,26,675,676,26,26,26,26,174,26,26,26,26,26,26,
+175,26,26,26,26,26,26,26,198,26,677,241,26,26,26,26,
+26,26,26,26,26,182,26,26,26,26,414,26,26,26,192,26,
+26,26,246,223,26,26,26,26,26,26,26,26,26,26,184,26,
+26,26,26,26,26,26,26,677,293,197,26,189,196,26,26,26,
+26,26,26,677,185,26,293,26,26,26,26,26,26,26,678,26,
+26,26,26,26,26,26,26,26,26,26,26,26,182,26,26,26,
+222,26,26,163,26,192,26,26,26,26,26,26,171,26,266,26,
+26,26,26,287,26,26,26,26,26,26,26,26,26,26,26,324,
+26,26,26,26,26,26,26,26,26,414,26,26,26,26,26,26,
+26,26,170,26,26,198,26,26,26,26,26,26,26,26,26,26,
+26,26,293,26,26,26,26,26,26,26,26,278,166,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,679,26,26,26,26,170,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,207,
+26,26,26,26,26,389,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,241,26,162,677,26,26,26,26,26,26,26,
+324,26,179,26,26,26,222,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,680,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,177,241,26,26,26,177,26,673,26,26,26,287,26,
+26,26,26,26,26,26,26,26,246,26,26,681,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,682,26,26,26,
+683,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,684,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,685,
+26,26,26,26,26,26,26,26,26,686,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+26,26,26,26,26,26,26,26,686,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,687,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,688,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+689,453,478,478,107,107,107,690,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,478,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,691,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,
+453,453,453,453,453,453,453,453,453,453,453,453,453,453,453,691,
+};
+
+const uint16_t unicode_flags_stage2[44288] = {
+0x0880,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0180,0x0180,0x0180,0x0180,0x0180,0x0080,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0108,0x0020,0x0020,0x0020,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0040,0x0020,0x0020,0x0020,0x0020,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0020,0x0820,0x0840,0x0840,0x0840,0x0020,
+0x0020,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,
+0x1C04,0x1404,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x1C04,0x0020,0x0020,0x0020,0x0040,0x0020,
+0x0840,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,
+0x2A04,0x2204,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x2A04,0x0020,0x0040,0x0020,0x0040,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0180,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0108,0x0020,0x0040,0x0040,0x0040,0x0040,0x0040,0x0020,0x0840,0x0040,0x5004,0x0020,0x0040,0x0080,0x0040,0x0040,
+0x0040,0x0040,0x0002,0x0002,0x0840,0x2004,0x0020,0x0820,0x0040,0x0002,0x5004,0x0020,0x0002,0x0002,0x0002,0x0020,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1C04,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0040,0x1C04,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2A04,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0040,0x2A04,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1004,0x2004,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x2004,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,
+0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x2004,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x2804,
+0x2204,0x1404,0x1404,0x2204,0x1404,0x2204,0x1404,0x1404,0x2204,0x1404,0x1404,0x1404,0x2204,0x2004,0x1404,0x1404,
+0x1404,0x1404,0x2204,0x1404,0x1404,0x2204,0x1404,0x1404,0x1404,0x2204,0x2204,0x2004,0x1404,0x1404,0x2204,0x1404,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x1404,0x2204,0x1404,0x2004,0x2004,0x1404,0x2204,0x1404,0x1404,
+0x2204,0x1404,0x1404,0x1404,0x2204,0x1404,0x2204,0x1C04,0x1404,0x2204,0x2004,0x5004,0x1404,0x2204,0x2004,0x2204,
+0x5004,0x5004,0x5004,0x5004,0x1404,0x3004,0x2204,0x1404,0x3004,0x2204,0x1404,0x3004,0x2204,0x1404,0x2204,0x1404,
+0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x2004,0x1404,0x3004,0x2204,0x1404,0x2204,0x1404,0x1404,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2004,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1404,0x1404,0x2204,0x1404,0x1404,0x2204,
+0x2204,0x1404,0x2204,0x1404,0x1404,0x1404,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2004,0x2204,0x2204,0x2004,0x2204,0x2004,0x2204,0x2204,0x2004,0x2004,0x2004,
+0x2204,0x2204,0x2004,0x2204,0x2004,0x2204,0x2204,0x2004,0x2204,0x2204,0x2204,0x2204,0x2204,0x2004,0x2004,0x2204,
+0x2004,0x2204,0x2204,0x2004,0x2004,0x2204,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2204,0x2004,0x2004,
+0x2204,0x2004,0x2204,0x2204,0x2004,0x2004,0x2004,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2A04,0x2004,0x5004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2204,0x2204,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4804,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x0040,0x0040,0x0040,0x0040,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x4004,0x0040,0x4004,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0810,0x0810,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0810,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0810,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x1404,0x2204,0x1404,0x2204,0x4004,0x0040,0x1404,0x2204,0x0001,0x0001,0x4004,0x2204,0x2204,0x2204,0x0020,0x1404,
+0x0001,0x0001,0x0001,0x0001,0x0040,0x0040,0x1404,0x0020,0x1404,0x1404,0x1404,0x0001,0x1404,0x0001,0x1404,0x1404,
+0x2004,0x1C04,0x1404,0x1404,0x1404,0x1C04,0x1404,0x1C04,0x1404,0x1C04,0x1404,0x1404,0x1404,0x1404,0x1404,0x1C04,
+0x1404,0x1C04,0x0001,0x1404,0x1404,0x1C04,0x1404,0x1404,0x1404,0x1C04,0x1404,0x1404,0x2204,0x2204,0x2204,0x2204,
+0x2004,0x2A04,0x2204,0x2204,0x2204,0x2A04,0x2204,0x2A04,0x2204,0x2A04,0x2204,0x2204,0x2204,0x2204,0x2204,0x2A04,
+0x2204,0x2A04,0x2004,0x2204,0x2204,0x2A04,0x2204,0x2204,0x2204,0x2A04,0x2204,0x2204,0x2204,0x2204,0x2204,0x1404,
+0x2004,0x2004,0x1804,0x1004,0x1004,0x2004,0x2004,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x2004,0x2004,0x2204,0x2204,0x1004,0x2004,0x0040,0x1404,0x2204,0x1404,0x1404,0x2204,0x2004,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1C04,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1C04,0x1404,0x1404,0x1C04,0x1404,0x1C04,0x1C04,0x1C04,0x1C04,0x1404,0x1C04,0x1404,0x1404,0x1404,0x1C04,0x1404,
+0x1404,0x1404,0x1404,0x1C04,0x1404,0x1404,0x1404,0x1C04,0x1404,0x1404,0x1404,0x1C04,0x1404,0x1C04,0x1404,0x1404,
+0x2A04,0x2204,0x2204,0x2A04,0x2204,0x2A04,0x2A04,0x2A04,0x2A04,0x2204,0x2A04,0x2204,0x2204,0x2204,0x2A04,0x2204,
+0x2204,0x2204,0x2204,0x2A04,0x2204,0x2204,0x2204,0x2A04,0x2204,0x2204,0x2204,0x2A04,0x2204,0x2A04,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2A04,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1C04,0x2A04,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x0040,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1C04,0x2A04,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1C04,0x2A04,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x0001,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0001,0x0001,0x4004,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x2004,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2004,0x2004,0x0020,0x0020,0x0001,0x0001,0x0040,0x0040,0x0040,
+0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0010,
+0x0020,0x0010,0x0010,0x0020,0x0010,0x0010,0x0020,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5004,0x5804,0x5804,0x5804,0x5804,0x5804,0x5004,0x5804,0x5004,
+0x5804,0x5804,0x5004,0x5804,0x5804,0x5004,0x5804,0x5804,0x5804,0x5804,0x5804,0x0001,0x0001,0x0001,0x0001,0x5004,
+0x5004,0x5004,0x5804,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0040,0x0040,0x0040,0x0020,0x0020,0x0040,0x0020,0x0020,0x0040,0x0040,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0080,0x0020,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x4004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0020,0x0020,0x0020,0x0020,0x5004,0x5004,
+0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x0020,0x5804,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0080,0x0040,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x4004,0x4004,0x0010,0x0010,0x0040,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,0x5004,0x5004,0x0040,0x0040,0x5004,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0080,
+0x5004,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x4004,0x4004,0x0040,0x0020,0x0020,0x0020,0x4004,0x0001,0x0001,0x0010,0x0040,0x0040,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x4004,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x4004,0x0010,0x0010,0x0010,0x4004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0001,0x0001,0x0020,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0040,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x0080,0x0080,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x4004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0080,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,
+0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x5004,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0020,0x0020,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0020,0x4004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0010,0x0010,0x0010,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,
+0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x0001,0x5004,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0010,0x5004,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0810,0x0010,0x0001,0x0001,0x0010,0x0010,0x0010,0x5004,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x0001,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x5004,0x0040,0x0040,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x5004,0x0020,0x0010,0x0001,
+0x0001,0x0010,0x0010,0x0010,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x5004,
+0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0001,0x5804,0x5004,0x0001,0x5004,0x5004,0x0001,0x5804,0x5004,0x0001,0x0001,0x0010,0x0001,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0010,0x0010,0x0001,0x0001,0x0010,0x0010,0x0010,0x0001,0x0001,
+0x0001,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0010,0x0010,0x5004,0x5004,0x5004,0x0010,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0010,0x0010,0x0010,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,
+0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0001,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0010,0x5004,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0001,0x0001,
+0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0020,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0001,0x0010,0x0010,0x0010,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,
+0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0001,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0010,0x5004,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0810,0x0010,0x0001,0x0001,0x0010,0x0010,0x0010,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x0001,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0040,0x5004,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0010,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x5004,0x5004,
+0x5004,0x0001,0x5804,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x5004,0x5004,0x0001,0x5004,0x0001,0x5004,0x5004,
+0x0001,0x0001,0x0001,0x5004,0x5004,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0810,0x0810,0x0010,0x0001,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,
+0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,
+0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0010,0x5004,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0810,0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0010,0x0001,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0020,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,
+0x5004,0x0010,0x0010,0x0010,0x0020,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,
+0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0010,0x5004,0x0010,0x0810,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0810,0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x0001,
+0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0001,0x5004,0x5004,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,
+0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x5004,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0810,0x0810,0x0010,0x0001,0x0010,0x0010,0x0010,0x0010,0x5004,0x0040,
+0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x0010,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x0010,0x0010,0x0010,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0010,0x0001,0x0001,0x0001,0x0001,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0010,0x0001,0x0010,0x0810,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0001,0x0001,0x0010,0x0010,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0010,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0040,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x4004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x5004,0x5004,0x0001,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0010,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x4004,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x0040,0x0040,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0040,0x0020,0x0040,0x0040,0x0040,0x0010,0x0010,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0040,0x0010,0x0040,0x0010,0x0040,0x0010,0x0020,0x0020,0x0020,0x0020,0x0010,0x0010,
+0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,
+0x0001,0x0810,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,
+0x0810,0x0010,0x0810,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0810,0x0010,0x0010,0x0010,
+0x0010,0x0810,0x0010,0x0010,0x0010,0x0010,0x0810,0x0010,0x0010,0x0010,0x0010,0x0810,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0810,0x0810,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0010,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0040,0x0040,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0040,0x0040,0x0040,0x0040,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,
+0x0010,0x5004,0x0010,0x0010,0x0010,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,
+0x5004,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x0010,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0010,0x0010,0x0010,0x0010,0x0040,0x0040,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0001,0x1404,0x0001,0x0001,0x0001,0x0001,0x0001,0x1404,0x0001,0x0001,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0020,0x4004,0x2204,0x2204,0x2204,
+0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,0x5804,
+0x5804,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0010,0x0010,0x0010,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0001,0x0001,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0001,0x0001,
+0x0020,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0040,0x0020,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0108,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0020,0x0020,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0020,0x0020,0x0020,0x0002,0x0002,
+0x0002,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0010,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,
+0x5004,0x0001,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0020,0x0020,0x0020,0x4004,0x0020,0x0020,0x0020,0x0040,0x5004,0x0010,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0010,0x0010,0x0010,0x0080,0x0010,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x4004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0001,0x0001,0x0001,0x0020,0x0020,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0010,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x4004,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0810,0x0010,0x0810,0x0010,0x0810,0x0810,
+0x0010,0x0010,0x0810,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0020,0x0020,0x0001,
+0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0020,0x0020,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x0020,0x0020,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0001,0x0001,0x1404,0x1404,0x1404,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0020,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x0010,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0010,0x5004,0x5004,0x0010,0x0010,0x0010,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x4004,0x2204,0x2004,0x2004,0x2004,0x2204,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2204,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x2004,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0001,0x0001,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0001,0x0001,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0001,0x0001,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0001,0x0001,
+0x2004,0x2204,0x2004,0x2204,0x2004,0x2204,0x2004,0x2204,0x0001,0x1404,0x0001,0x1404,0x0001,0x1404,0x0001,0x1404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0001,0x0001,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x3404,0x3404,0x3404,0x3404,0x3404,0x3404,0x3404,0x3404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x3404,0x3404,0x3404,0x3404,0x3404,0x3404,0x3404,0x3404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x3404,0x3404,0x3404,0x3404,0x3404,0x3404,0x3404,0x3404,
+0x2204,0x2204,0x2004,0x2204,0x2004,0x0001,0x2004,0x2004,0x1404,0x1404,0x1404,0x1404,0x3404,0x0040,0x2004,0x0840,
+0x0040,0x0040,0x2004,0x2204,0x2004,0x0001,0x2004,0x2004,0x1404,0x1404,0x1404,0x1404,0x3404,0x0040,0x0040,0x0040,
+0x2204,0x2204,0x2004,0x2004,0x0001,0x0001,0x2004,0x2004,0x1404,0x1404,0x1404,0x1404,0x0001,0x0040,0x0040,0x0040,
+0x2204,0x2204,0x2004,0x2004,0x2004,0x2204,0x2004,0x2004,0x1404,0x1404,0x1404,0x1404,0x1404,0x0040,0x0040,0x0040,
+0x0001,0x0001,0x2004,0x2204,0x2004,0x0001,0x2004,0x2004,0x1404,0x1404,0x1404,0x1404,0x3404,0x0040,0x0840,0x0001,
+0x0108,0x0108,0x0908,0x0908,0x0108,0x0108,0x0108,0x0108,0x0108,0x0108,0x0108,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0108,0x0108,0x0080,0x0080,0x0080,0x0080,0x0080,0x0108,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0108,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0001,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0002,0x4004,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0020,0x0020,0x4004,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0020,0x0020,0x0001,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x1004,0x0040,0x0040,0x0040,0x0040,0x1004,0x0040,0x0040,0x2004,0x1004,0x1004,0x1004,0x2004,0x2004,
+0x1004,0x1004,0x1004,0x2004,0x0040,0x1004,0x0040,0x0040,0x0040,0x1004,0x1004,0x1004,0x1004,0x1004,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x1004,0x0040,0x1004,0x0040,0x1004,0x0040,0x1004,0x1004,0x1004,0x1004,0x0040,0x2004,
+0x1004,0x1004,0x1404,0x1004,0x2004,0x5004,0x5004,0x5004,0x5004,0x2004,0x0040,0x0040,0x2004,0x2004,0x1004,0x1004,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x1004,0x2004,0x2004,0x2004,0x2004,0x0040,0x0040,0x0040,0x0040,0x2204,0x0040,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,0x0402,
+0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,0x0202,
+0x0002,0x0002,0x0002,0x1404,0x2204,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,
+0x0840,0x0040,0x0840,0x0040,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0840,0x0040,0x0840,0x0040,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0840,0x0040,0x0040,0x0040,0x0040,0x0840,0x0040,0x0040,0x0840,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0840,0x0040,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0840,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0840,0x0040,0x0840,0x0040,0x0040,0x0840,0x0040,0x0040,0x0040,0x0040,0x0840,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0840,0x0040,0x0040,0x0840,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0840,0x0840,0x0040,0x0040,0x0840,0x0840,0x0040,0x0040,0x0840,0x0840,0x0840,0x0840,0x0040,0x0040,
+0x0040,0x0040,0x0840,0x0840,0x0040,0x0040,0x0840,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0840,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,0x0840,0x0840,0x0040,0x0840,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0840,0x0840,0x0840,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0020,0x0020,0x0020,0x0020,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0020,0x0020,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,
+0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,0x0440,
+0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,
+0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0240,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0020,0x0020,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0020,0x0020,0x0020,0x0020,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0020,0x0020,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0840,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x1404,0x2204,0x1404,0x1404,0x1404,0x2204,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x1404,0x1404,
+0x1404,0x2004,0x1404,0x2204,0x2004,0x1404,0x2204,0x2004,0x2004,0x2004,0x2004,0x2004,0x4004,0x4004,0x1404,0x1404,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x2004,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x1404,0x2204,0x1404,0x2204,0x0010,
+0x0010,0x0010,0x1404,0x2204,0x0001,0x0001,0x0001,0x0001,0x0001,0x0020,0x0020,0x0020,0x0020,0x0002,0x0020,0x0020,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0001,0x2204,0x0001,0x0001,0x0001,0x0001,0x0001,0x2204,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x4004,
+0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x4004,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0040,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0108,0x0020,0x0020,0x0020,0x0040,0x4004,0x5004,0x0002,0x0820,0x0820,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0040,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0040,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0020,0x4004,0x4004,0x4004,0x4004,0x4004,0x0040,0x0040,0x0002,0x0002,0x0002,0x4004,0x5004,0x0020,0x0040,0x0040,
+0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,
+0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,
+0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0010,0x0010,0x0040,0x0040,0x4804,0x4004,0x5004,
+0x0020,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,
+0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,
+0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5804,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0020,0x4004,0x4804,0x4004,0x5004,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x0040,0x0040,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0040,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0040,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5804,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5804,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5804,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x4004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x4004,0x0020,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x5004,0x0010,
+0x0010,0x0010,0x0010,0x0020,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x4004,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x4004,0x4004,0x0010,0x0010,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0010,0x0010,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x0040,0x0040,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x2004,0x2004,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x4004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1404,0x2204,0x1404,0x2204,0x1404,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x4004,0x0040,0x0040,0x1404,0x2204,0x1404,0x2004,0x5004,
+0x1404,0x2204,0x1404,0x2204,0x2204,0x2004,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x1404,0x1404,0x1404,0x1404,0x2004,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,0x1404,0x2204,
+0x1404,0x2204,0x1404,0x2204,0x1404,0x1404,0x1404,0x1404,0x2204,0x1404,0x2204,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x2204,0x0001,0x2004,0x0001,0x2004,0x1404,0x2204,0x1404,0x2204,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x4004,0x4004,0x4004,0x1404,0x2204,0x5004,0x4004,0x4004,0x2004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0010,0x5004,0x5004,0x5004,0x0010,0x5004,0x5004,0x5004,0x5004,0x0010,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0040,0x0040,0x0040,0x0040,0x0010,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0020,0x0020,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0020,0x0020,0x0020,0x5004,0x0020,0x5004,0x5004,0x0010,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x4004,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x4004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0020,0x0020,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x4004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0040,0x0040,0x0040,0x5004,0x0010,0x0010,0x0010,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0010,0x5004,0x0010,0x0010,0x0010,0x5004,0x5004,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,
+0x5004,0x0010,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x4004,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0020,0x0020,0x5004,0x4004,0x4004,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2204,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x0040,0x4004,0x4004,0x4004,0x4004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x4004,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0010,0x0010,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x2004,0x2004,0x2004,0x2004,0x2004,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x0010,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0040,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x0001,
+0x5004,0x5004,0x0001,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0020,0x0020,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0040,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0040,0x0040,0x0040,0x0040,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0001,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0040,0x0020,0x0040,0x0040,0x0040,0x0001,0x0020,0x0040,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0080,
+0x0001,0x0020,0x0020,0x0020,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0040,0x0020,0x0020,0x0020,0x0020,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0020,0x0020,0x0040,0x0040,0x0040,0x0020,
+0x0020,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0020,0x0020,0x0020,0x0040,0x0020,
+0x0040,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0020,0x0040,0x0020,0x0040,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x4004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x4004,0x4004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0080,0x0080,0x0080,0x0040,0x0040,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x0001,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0002,0x0002,0x0040,0x0040,0x0040,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,
+0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0010,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0002,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0020,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x0001,0x0001,0x0001,0x0001,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0020,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0001,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x0001,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x0001,0x1404,0x1404,0x0001,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x0001,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x0001,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x0001,0x2204,0x2204,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x0001,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x4004,0x0001,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x0001,0x0001,0x0001,0x5004,0x0001,0x0001,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0020,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0040,0x0040,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x5004,0x5004,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x0010,0x0010,0x0010,0x0001,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0010,0x0010,0x0010,
+0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0010,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0002,0x0002,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0002,0x0002,0x0002,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0040,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0010,0x0010,0x0020,0x0001,0x0001,
+0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0010,0x0010,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0002,0x0002,0x0002,0x0002,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,
+0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0010,0x5004,0x5004,0x0010,0x0010,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,
+0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0020,0x0080,0x0020,0x0020,
+0x0020,0x0020,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0080,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0810,0x0810,0x0010,0x0010,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0020,0x0020,0x0020,0x0020,0x5004,0x0010,0x0010,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0010,0x0020,0x0020,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x5004,0x5004,0x5004,0x5004,0x0020,0x0020,0x0020,0x0020,0x0010,0x0010,0x0010,0x0010,0x0020,0x0010,0x0010,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x5004,0x0020,0x5004,0x0020,0x0020,0x0020,
+0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0010,0x5004,
+0x5004,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,
+0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0001,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0010,0x0010,0x5004,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0810,0x0010,0x0001,0x0001,0x0010,0x0010,0x0010,0x0001,0x0001,
+0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0020,0x0020,0x0001,0x0020,0x0010,0x5004,
+0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0810,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x0020,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0810,0x0810,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0020,0x0020,0x0020,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0020,0x0020,0x0020,0x0040,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0810,0x0001,0x0010,0x0010,0x0001,0x0001,0x0010,0x0010,0x0010,0x0010,0x5004,
+0x0010,0x5004,0x0010,0x0010,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x5004,0x0020,0x5004,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x0010,0x0010,0x0010,0x0010,0x0020,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0020,0x0020,0x5004,0x0020,0x0020,
+0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x5004,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,
+0x0020,0x0020,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0010,0x0001,0x0010,0x0010,0x0001,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,
+0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x5004,0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,0x0020,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0020,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,
+0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0010,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0020,0x0020,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0020,0x0020,0x0020,0x0020,0x0020,0x0040,0x0040,0x0040,0x0040,
+0x4004,0x4004,0x4004,0x4004,0x0020,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0010,
+0x5004,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,
+0x0010,0x0010,0x0010,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x4004,0x4004,0x0020,0x4004,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x4004,0x4004,0x4004,0x4004,0x0001,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x0001,0x4004,0x4004,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x0001,0x0001,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0040,0x0010,0x0010,0x0020,
+0x0080,0x0080,0x0080,0x0080,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0840,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0010,0x0010,0x0010,0x0010,0x0010,0x0040,0x0040,0x0040,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0040,0x0040,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0010,0x0010,0x0010,0x0010,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0840,0x0840,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0010,0x0010,0x0010,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x0001,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x0001,0x1004,0x1004,
+0x0001,0x0001,0x1004,0x0001,0x0001,0x1004,0x1004,0x0001,0x0001,0x1004,0x1004,0x1004,0x1004,0x0001,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x2004,0x2004,0x2004,0x2004,0x0001,0x2004,0x0001,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x0001,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x0001,0x1004,0x1004,0x1004,0x1004,0x0001,0x0001,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x0001,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x0001,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x0001,0x1004,0x1004,0x1004,0x1004,0x0001,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x0001,0x1004,0x0001,0x0001,0x0001,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x0001,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x0001,0x0001,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x0040,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x0040,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x0040,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x0040,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x0040,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x0040,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x0040,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x0040,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,
+0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x1004,0x0040,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x0040,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x1004,0x2004,0x0001,0x0001,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0040,0x0040,0x0040,0x0040,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0010,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0010,0x0040,0x0040,0x0020,0x0020,0x0020,0x0020,0x0020,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x5004,0x2004,0x2004,0x2004,0x2004,0x2004,
+0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x2004,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0001,0x0010,0x0010,0x0001,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0010,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x4004,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x5004,0x0040,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0040,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0010,0x0010,0x0010,0x0010,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,0x1404,
+0x1404,0x1404,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,0x2204,
+0x2204,0x2204,0x2204,0x2204,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x4004,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0020,0x0020,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0002,0x0002,0x0002,
+0x0040,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0002,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x5004,0x5004,0x0001,0x5004,0x0001,0x0001,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x0001,0x5004,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x5004,0x0001,0x0001,0x0001,0x0001,0x5004,0x0001,0x5004,0x0001,0x5004,0x0001,0x5004,0x5004,0x5004,
+0x0001,0x5004,0x5004,0x0001,0x5004,0x0001,0x0001,0x5004,0x0001,0x5004,0x0001,0x5004,0x0001,0x5004,0x0001,0x5004,
+0x0001,0x5004,0x5004,0x0001,0x5004,0x0001,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,
+0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,
+0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0001,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,
+0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0040,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5804,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5804,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,0x5004,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0080,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,0x0010,
+0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,
+0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0080,0x0001,0x0001,
+};
+
+// 53 unique blocks. 48384 bytes.
+const uint16_t unicode_lower_stage1[17408] = {
+0,1,0,2,3,4,5,6,7,8,0,0,0,9,10,11,
+12,13,14,15,16,17,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,18,19,0,0,0,0,0,0,0,0,0,0,20,21,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,22,0,0,0,0,0,23,23,24,23,25,26,27,28,
+0,0,0,0,29,30,31,0,0,0,0,0,0,0,0,0,
+0,0,32,33,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+34,35,23,36,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,37,38,0,39,40,41,42,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,43,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+44,0,45,46,0,47,48,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const int32_t unicode_lower_stage2[3392] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,0,32,32,32,32,32,32,32,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+-199,0,1,0,1,0,1,0,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,-121,1,0,1,0,1,0,0,
+0,210,1,0,1,0,206,1,0,205,205,1,0,0,79,202,
+203,1,0,205,207,0,211,209,1,0,0,0,211,213,0,214,
+1,0,1,0,1,0,218,1,0,218,0,0,1,0,218,1,
+0,217,217,1,0,1,0,219,1,0,0,0,1,0,0,0,
+0,0,0,0,2,1,0,2,1,0,2,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0,2,1,0,1,0,-97,-56,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+-130,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,0,0,0,0,0,0,10795,1,0,-163,10792,0,
+0,1,0,-195,69,71,1,0,1,0,1,0,1,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,116,
+0,0,0,0,0,0,38,0,37,37,37,0,64,0,63,63,
+0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,0,32,32,32,32,32,32,32,32,32,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,
+0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0,0,0,0,-60,0,0,1,0,-7,1,0,0,-130,-130,-130,
+80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+15,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,48,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,
+7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,
+7264,7264,7264,7264,7264,7264,0,7264,0,0,0,0,0,7264,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,
+38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,
+38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,
+38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,
+38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,38864,
+8,8,8,8,8,8,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,
+-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,
+-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,0,0,-3008,-3008,-3008,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,0,0,0,0,0,0,0,0,-7615,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+0,0,0,0,0,0,0,0,0,-8,0,-8,0,-8,0,-8,
+0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+0,0,0,0,0,0,0,0,-8,-8,-74,-74,-9,0,0,0,
+0,0,0,0,0,0,0,0,-86,-86,-86,-86,-9,0,0,0,
+0,0,0,0,0,0,0,0,-8,-8,-100,-100,0,0,0,0,
+0,0,0,0,0,0,0,0,-8,-8,-112,-112,-7,0,0,0,
+0,0,0,0,0,0,0,0,-128,-128,-126,-126,-9,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,-7517,0,0,0,-8383,-8262,0,0,0,0,
+0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,-10743,-3814,-10727,0,0,1,0,1,0,1,0,-10780,-10749,-10783,
+-10782,0,1,0,0,1,0,0,0,0,0,0,0,0,-10815,-10815,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,0,0,0,0,0,0,0,1,0,1,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+0,0,0,0,0,0,0,0,0,1,0,1,0,-35332,1,0,
+1,0,1,0,1,0,1,0,0,0,0,1,0,-42280,0,0,
+1,0,1,0,0,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,-42308,-42319,-42315,-42305,-42308,0,
+-42258,-42282,-42261,928,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,-48,-42307,-35384,1,0,1,0,0,0,0,0,0,
+1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,
+40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+39,39,39,39,39,39,39,39,39,39,39,0,39,39,39,39,
+39,39,39,39,39,39,39,39,39,39,39,0,39,39,39,39,
+39,39,39,0,39,39,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+64,64,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+34,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+// 255 unique blocks. 100096 bytes.
+const uint16_t unicode_nfd_stage1[17408] = {
+0,0,0,1,2,3,4,5,6,0,0,0,0,7,8,9,
+10,11,0,12,0,0,0,0,13,0,0,14,0,0,0,0,
+0,0,0,0,15,16,0,17,18,19,0,0,0,20,21,22,
+0,23,0,24,0,22,0,25,0,0,0,0,0,26,27,0,
+28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,29,30,0,0,
+0,0,0,0,0,0,0,0,31,32,33,34,35,36,37,38,
+39,0,0,0,40,0,41,42,43,44,45,46,47,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,49,50,51,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,
+68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,
+84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,
+100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,
+116,117,118,119,120,121,122,123,124,125,126,127,128,129,130,131,
+132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,
+148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,
+164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,
+180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,
+196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,
+212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,227,228,229,230,231,232,233,234,235,236,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,237,0,238,0,0,0,0,0,0,0,0,239,0,0,
+0,0,240,0,0,0,241,0,0,0,0,0,0,0,0,0,
+0,0,0,0,242,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,243,244,245,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+246,247,248,249,250,251,252,253,254,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const int32_t unicode_nfd_stage2[16320] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-127,-128,-129,-130,-131,-132,0,-132,-131,-132,-133,-134,-131,-132,-133,-134,
+0,-131,-131,-132,-133,-134,-135,0,0,-132,-133,-134,-135,-132,0,0,
+-127,-128,-129,-130,-131,-132,0,-132,-131,-132,-133,-134,-131,-132,-133,-134,
+0,-131,-131,-132,-133,-134,-135,0,0,-132,-133,-134,-135,-132,0,-134,
+-191,-160,-193,-162,-195,-164,-195,-164,-197,-166,-199,-168,-201,-170,-202,-171,
+0,0,-205,-174,-207,-176,-209,-178,-211,-180,-213,-182,-213,-182,-215,-184,
+-217,-186,-219,-188,-220,-189,0,0,-223,-192,-225,-194,-227,-196,-229,-198,
+-231,0,0,0,-234,-203,-235,-204,0,-237,-206,-239,-208,-241,-210,0,
+0,0,0,-245,-214,-247,-216,-249,-218,0,0,0,-253,-222,-255,-224,
+-257,-226,0,0,-258,-227,-260,-229,-262,-231,-263,-232,-265,-234,-267,-236,
+-269,-238,-270,-239,-272,-241,0,0,-275,-244,-277,-246,-279,-248,-281,-250,
+-283,-252,-285,-254,-285,-254,-285,-254,-287,-287,-256,-289,-258,-291,-260,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-337,-306,0,0,0,0,0,0,0,0,0,0,0,0,0,-346,
+-315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,-396,-365,-390,
+-359,-386,-355,-382,-351,-384,-353,-386,-355,-388,-357,-390,-359,0,-413,-382,
+-415,-384,-284,-253,0,0,-415,-384,-413,-382,-411,-380,-413,-382,-55,163,
+-390,0,0,0,-429,-398,0,0,-426,-395,-441,-410,-310,-279,-294,-263,
+-447,-416,-449,-418,-447,-416,-449,-418,-447,-416,-449,-418,-445,-414,-447,-416,
+-446,-415,-448,-417,-447,-416,-449,-418,-453,-422,-454,-423,0,0,-470,-439,
+0,0,0,0,0,0,-485,-454,-483,-452,-475,-444,-477,-446,-479,-448,
+-481,-450,-473,-442,0,0,0,0,0,0,0,0,0,0,0,0,
+-64,-64,0,-48,-60,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,-187,0,0,0,0,0,0,0,0,0,-835,0,
+0,0,0,0,0,-733,11,-720,13,14,15,0,19,0,23,26,
+41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-17,-6,5,8,9,10,
+21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-17,-6,-13,-8,-5,0,
+0,0,0,-1,-2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+21,20,0,16,0,0,0,-1,0,0,0,0,14,11,21,0,
+0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-27,-28,0,-32,0,0,0,-1,0,0,0,0,-34,-37,-27,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,-2,-2,0,0,0,0,0,0,0,0,
+0,-171,-140,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-192,-161,-194,-163,0,0,-193,-162,0,0,-2,-2,-198,-167,-199,-168,
+0,0,-202,-171,-204,-173,-200,-169,0,0,-2,-2,-191,-160,-203,-172,
+-205,-174,-207,-176,-205,-174,0,0,-205,-174,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,5,4,36,2,36,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+21,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,
+0,-1,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,-67,-67,-67,-63,-59,-59,-51,-48,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,-4,-5,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,-59,-59,0,-48,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,-1,0,0,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,-67,-67,-63,0,0,-51,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,-1,0,0,-4,-5,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,-59,-59,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-4,-4,-6,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-1,0,0,0,0,0,0,-1,-2,0,-4,-5,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,-3,-4,-5,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,0,0,
+0,0,-1,0,0,0,0,-1,0,0,0,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,-41,0,0,0,0,0,0,
+0,0,0,-2,0,-4,60,0,59,0,0,0,0,0,0,0,
+0,-16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,-1,0,0,0,0,0,0,0,0,0,-1,0,0,
+0,0,-1,0,0,0,0,-1,0,0,0,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,-41,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,-1,0,-1,0,-1,0,-1,0,-1,0,
+0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,
+-2,-2,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-7615,-7584,-7616,-7585,-7618,-7587,-7620,-7589,-7621,-7590,-7622,-7591,-7624,-7593,-7626,-7595,
+-7628,-7597,-7630,-7599,-7631,-7600,-7633,-7602,-7635,-7604,-7637,-7606,-7639,-7608,-7640,-7609,
+-7641,-7610,-7642,-7611,-7644,-7613,-7646,-7615,-7648,-7617,-7650,-7619,-7651,-7620,-7653,-7622,
+-7653,-7622,-7655,-7624,-7657,-7626,-7658,-7627,-7660,-7629,-7662,-7631,-7664,-7633,-7665,-7634,
+-7667,-7636,-7669,-7638,-7670,-7639,-7672,-7641,-7674,-7643,-7676,-7645,-7677,-7646,-7679,-7648,
+-7681,-7650,-7683,-7652,-7684,-7653,-7686,-7655,-7686,-7655,-7688,-7657,-7690,-7659,-7692,-7661,
+-7693,-7662,-7695,-7664,-7697,-7666,-7699,-7668,-7701,-7670,-7702,-7671,-7704,-7673,-7706,-7675,
+-7708,-7677,-7709,-7678,-7711,-7680,-7713,-7682,-7715,-7684,-7717,-7686,-7718,-7687,-7720,-7689,
+-7721,-7690,-7723,-7692,-7725,-7694,-7727,-7696,-7729,-7698,-7730,-7699,-7732,-7701,-7733,-7702,
+-7734,-7703,-7736,-7705,-7738,-7707,-7726,-7715,-7713,-7712,0,-7452,0,0,0,0,
+-7775,-7744,-7777,-7746,-7779,-7748,-7781,-7750,-7783,-7752,-7785,-7754,-7787,-7756,-7789,-7758,
+-7791,-7760,-7793,-7762,-7795,-7764,-7797,-7766,-7795,-7764,-7797,-7766,-7799,-7768,-7801,-7770,
+-7803,-7772,-7805,-7774,-7807,-7776,-7809,-7778,-7807,-7776,-7809,-7778,-7805,-7774,-7807,-7776,
+-7809,-7778,-7811,-7780,-7813,-7782,-7815,-7784,-7817,-7786,-7819,-7788,-7821,-7790,-7823,-7792,
+-7825,-7794,-7827,-7796,-7823,-7792,-7825,-7794,-7827,-7796,-7829,-7798,-7831,-7800,-7833,-7802,
+-7835,-7804,-7833,-7802,-7835,-7804,-7837,-7806,-7839,-7808,0,0,0,0,0,0,
+-6991,-6992,-6993,-6994,-6995,-6996,-6997,-6998,-7031,-7032,-7033,-7034,-7035,-7036,-7037,-7038,
+-7003,-7004,-7005,-7006,-7007,-7008,0,0,-7043,-7044,-7045,-7046,-7047,-7048,0,0,
+-7017,-7018,-7019,-7020,-7021,-7022,-7023,-7024,-7057,-7058,-7059,-7060,-7061,-7062,-7063,-7064,
+-7031,-7032,-7033,-7034,-7035,-7036,-7037,-7038,-7071,-7072,-7073,-7074,-7075,-7076,-7077,-7078,
+-7041,-7042,-7043,-7044,-7045,-7046,0,0,-7081,-7082,-7083,-7084,-7085,-7086,0,0,
+-7051,-7052,-7053,-7054,-7055,-7056,-7057,-7058,0,-7092,0,-7094,0,-7096,0,-7098,
+-7063,-7064,-7065,-7066,-7067,-7068,-7069,-7070,-7103,-7104,-7105,-7106,-7107,-7108,-7109,-7110,
+-7103,-7104,-7101,-7102,-7101,-7102,-7101,-7102,-7097,-7098,-7093,-7094,-7091,-7092,0,0,
+-7119,-7120,-7121,-7122,-7123,-7124,-7125,-7126,-7159,-7160,-7161,-7162,-7163,-7164,-7165,-7166,
+-7129,-7130,-7131,-7132,-7133,-7134,-7135,-7136,-7169,-7170,-7171,-7172,-7173,-7174,-7175,-7176,
+-7127,-7128,-7129,-7130,-7131,-7132,-7133,-7134,-7167,-7168,-7169,-7170,-7171,-7172,-7173,-7174,
+-7167,-7168,-7169,-7170,-7171,0,-7173,-7174,-7207,-7208,-7209,-7210,-7211,0,-7173,0,
+0,-7961,-7179,-7180,-7181,0,-7183,-7184,-7219,-7220,-7219,-7220,-7221,-14,-15,-16,
+-7191,-7192,-7193,-7194,0,0,-7197,-7198,-7231,-7232,-7233,-7234,0,33,32,31,
+-7195,-7196,-7197,-7198,-7203,-7204,-7201,-7202,-7235,-7236,-7237,-7238,-7243,-8005,-8006,-8079,
+0,0,-7209,-7210,-7211,0,-7213,-7214,-7257,-7258,-7249,-7250,-7251,-8009,0,0,
+2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,-7549,0,0,0,-8415,-8426,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-10,-9,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,-26,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,3,6,3,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,-1,0,0,0,0,-1,0,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,-1,0,-1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,-5,0,0,-1,0,0,-2,0,-1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-8739,0,-1,0,0,0,0,0,0,0,0,0,0,-32,-8754,-8753,
+-12,-12,0,0,-2,-2,0,0,-2,-2,0,0,0,0,0,0,
+-6,-6,0,0,-2,-2,0,0,-2,-2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,-10,-5,-5,-4,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-100,-100,-81,-81,0,0,0,0,0,0,-56,-56,-56,-56,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,3295,3295,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,
+-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,
+-1,0,-1,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,
+-1,-2,0,-1,-2,0,-1,-2,0,-1,-2,0,-1,-2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,-78,0,0,0,0,0,0,0,0,0,-1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,
+-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,
+-1,0,-1,0,0,-1,0,-1,0,-1,0,0,0,0,0,0,
+-1,-2,0,-1,-2,0,-1,-2,0,-1,-2,0,-1,-2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,-78,0,0,-8,-8,-8,-8,0,0,0,-1,0,
+-39680,-39681,-39682,-39683,-39684,-39685,-39686,-39687,-39688,-39689,-39690,-39691,-39692,-39693,-39694,-39695,
+-39696,-39697,-39698,-39699,-39700,-39701,-39702,-39703,-39704,-39705,-39706,-39707,-39708,-39709,-39710,-39711,
+-39712,-39713,-39714,-39715,-39716,-39717,-39718,-39719,-39720,-39721,-39722,-39723,-39724,-39725,-39726,-39727,
+-39728,-39729,-39730,-39731,-39732,-39733,-39734,-39735,-39736,-39737,-39738,-39739,-39740,-39741,-39742,-39743,
+-39744,-39745,-39746,-39747,-39748,-39749,-39750,-39751,-39752,-39753,-39754,-39755,-39756,-39757,-39758,-39759,
+-39760,-39761,-39762,-39763,-39764,-39765,-39766,-39767,-39768,-39769,-39770,-39771,-39772,-39773,-39774,-39775,
+-39776,-39777,-39778,-39779,-39780,-39781,-39782,-39783,-39784,-39785,-39786,-39787,-39788,-39789,-39790,-39791,
+-39792,-39793,-39794,-39795,-39796,-39797,-39798,-39799,-39800,-39801,-39802,-39803,-39804,-39805,-39806,-39807,
+-39808,-39809,-39810,-39811,-39812,-39813,-39814,-39815,-39816,-39817,-39818,-39819,-39820,-39821,-39822,-39823,
+-39824,-39825,-39826,-39827,-39828,-39829,-39830,-39831,-39832,-39833,-39834,-39835,-39836,-39837,-39838,-39839,
+-39840,-39841,-39842,-39843,-39844,-39845,-39846,-39847,-39848,-39849,-39850,-39851,-39852,-39853,-39854,-39855,
+-39856,-39857,-39858,-39859,-39860,-39861,-39862,-39863,-39864,-39865,-39866,-39867,-39868,-39869,-39870,-39871,
+-39872,-39873,-39874,-39875,-39876,-39877,-39878,-39879,-39880,-39881,-39882,-39883,-39884,-39885,-39886,-39887,
+-39888,-39889,-39890,-39891,-39892,-39893,-39894,-39895,-39896,-39897,-39898,-39899,-39900,-39901,-39902,-39903,
+-39904,-39905,-39906,-39907,-39908,-39909,-39910,-39911,-39912,-39913,-39914,-39915,-39916,-39917,-39918,-39919,
+-39920,-39921,-39922,-39923,-39924,-39925,-39926,-39927,-39928,-39929,-39930,-39931,-39932,-39933,-39934,-39935,
+-39936,-39937,-39938,-39939,-39940,-39941,-39942,-39943,-39944,-39945,-39946,-39947,-39948,-39949,-39950,-39951,
+-39952,-39953,-39954,-39955,-39956,-39957,-39958,-39959,-39960,-39961,-39962,-39963,-39964,-39965,-39966,-39967,
+-39968,-39969,-39970,-39971,-39972,-39973,-39974,-39975,-39976,-39977,-39978,-39979,-39980,-39981,-39982,-39983,
+-39984,-39985,-39986,-39987,-39988,-39989,-39990,-39991,-39992,-39993,-39994,-39995,-39996,-39997,-39998,-39999,
+-40000,-40001,-40002,-40003,-40004,-40005,-40006,-40007,-40008,-40009,-40010,-40011,-40012,-40013,-40014,-40015,
+-40016,-40017,-40018,-40019,-40020,-40021,-40022,-40023,-40024,-40025,-40026,-40027,-40028,-40029,-40030,-40031,
+-40032,-40033,-40034,-40035,-40036,-40037,-40038,-40039,-40040,-40041,-40042,-40043,-40044,-40045,-40046,-40047,
+-40048,-40049,-40050,-40051,-40052,-40053,-40054,-40055,-40056,-40057,-40058,-40059,-40060,-40061,-40062,-40063,
+-40064,-40065,-40066,-40067,-40068,-40069,-40070,-40071,-40072,-40073,-40074,-40075,-40076,-40077,-40078,-40079,
+-40080,-40081,-40082,-40083,-40084,-40085,-40086,-40087,-40088,-40089,-40090,-40091,-40092,-40093,-40094,-40095,
+-40096,-40097,-40098,-40099,-40100,-40101,-40102,-40103,-40104,-40105,-40106,-40107,-40108,-40109,-40110,-40111,
+-40112,-40113,-40114,-40115,-40116,-40117,-40118,-40119,-40120,-40121,-40122,-40123,-40124,-40125,-40126,-40127,
+-40128,-40129,-40130,-40131,-40132,-40133,-40134,-40135,-40136,-40137,-40138,-40139,-40140,-40141,-40142,-40143,
+-40144,-40145,-40146,-40147,-40148,-40149,-40150,-40151,-40152,-40153,-40154,-40155,-40156,-40157,-40158,-40159,
+-40160,-40161,-40162,-40163,-40164,-40165,-40166,-40167,-40168,-40169,-40170,-40171,-40172,-40173,-40174,-40175,
+-40176,-40177,-40178,-40179,-40180,-40181,-40182,-40183,-40184,-40185,-40186,-40187,-40188,-40189,-40190,-40191,
+-40192,-40193,-40194,-40195,-40196,-40197,-40198,-40199,-40200,-40201,-40202,-40203,-40204,-40205,-40206,-40207,
+-40208,-40209,-40210,-40211,-40212,-40213,-40214,-40215,-40216,-40217,-40218,-40219,-40220,-40221,-40222,-40223,
+-40224,-40225,-40226,-40227,-40228,-40229,-40230,-40231,-40232,-40233,-40234,-40235,-40236,-40237,-40238,-40239,
+-40240,-40241,-40242,-40243,-40244,-40245,-40246,-40247,-40248,-40249,-40250,-40251,-40252,-40253,-40254,-40255,
+-40256,-40257,-40258,-40259,-40260,-40261,-40262,-40263,-40264,-40265,-40266,-40267,-40267,-40268,-40269,-40270,
+-40271,-40272,-40273,-40274,-40275,-40276,-40277,-40278,-40279,-40280,-40281,-40282,-40283,-40284,-40285,-40286,
+-40287,-40288,-40289,-40290,-40291,-40292,-40293,-40294,-40295,-40296,-40297,-40298,-40299,-40300,-40301,-40302,
+-40303,-40304,-40305,-40306,-40307,-40308,-40309,-40310,-40311,-40312,-40313,-40314,-40315,-40316,-40317,-40318,
+-40319,-40320,-40321,-40322,-40323,-40324,-40325,-40326,-40327,-40328,-40329,-40330,-40331,-40332,-40333,-40334,
+-40335,-40336,-40337,-40338,-40339,-40340,-40341,-40342,-40343,-40344,-40345,-40346,-40347,-40348,-40349,-40350,
+-40351,-40352,-40353,-40354,-40355,-40356,-40357,-40358,-40359,-40360,-40361,-40362,-40363,-40364,-40365,-40366,
+-40367,-40368,-40369,-40370,-40371,-40372,-40373,-40374,-40375,-40376,-40377,-40378,-40379,-40380,-40381,-40382,
+-40383,-40384,-40385,-40386,-40387,-40388,-40389,-40390,-40391,-40392,-40393,-40394,-40395,-40396,-40397,-40398,
+-40399,-40400,-40401,-40402,-40403,-40404,-40405,-40406,-40407,-40408,-40409,-40410,-40411,-40412,-40413,-40414,
+-40415,-40416,-40417,-40418,-40419,-40420,-40421,-40422,-40423,-40424,-40425,-40426,-40427,-40428,-40429,-40430,
+-40431,-40432,-40433,-40434,-40435,-40436,-40437,-40438,-40439,-40440,-40441,-40442,-40443,-40444,-40445,-40446,
+-40447,-40448,-40449,-40450,-40451,-40452,-40453,-40454,-40455,-40456,-40457,-40458,-40459,-40460,-40461,-40462,
+-40463,-40464,-40465,-40466,-40467,-40468,-40469,-40470,-40471,-40472,-40473,-40474,-40475,-40476,-40477,-40478,
+-40479,-40480,-40481,-40482,-40483,-40484,-40485,-40486,-40487,-40488,-40489,-40490,-40491,-40492,-40493,-40494,
+-40495,-40496,-40497,-40498,-40499,-40500,-40501,-40502,-40503,-40504,-40505,-40506,-40507,-40508,-40509,-40510,
+-40511,-40512,-40513,-40514,-40515,-40516,-40517,-40518,-40519,-40520,-40521,-40522,-40523,-40524,-40525,-40526,
+-40527,-40528,-40529,-40530,-40531,-40532,-40533,-40534,-40535,-40536,-40537,-40538,-40539,-40540,-40541,-40542,
+-40543,-40544,-40545,-40546,-40547,-40548,-40549,-40550,-40551,-40552,-40553,-40554,-40555,-40556,-40557,-40558,
+-40559,-40560,-40561,-40562,-40563,-40564,-40565,-40566,-40567,-40568,-40569,-40570,-40571,-40572,-40573,-40574,
+-40575,-40576,-40577,-40578,-40579,-40580,-40581,-40582,-40583,-40584,-40585,-40586,-40587,-40588,-40589,-40590,
+-40591,-40592,-40593,-40594,-40595,-40596,-40597,-40598,-40599,-40600,-40601,-40602,-40603,-40604,-40605,-40606,
+-40607,-40608,-40609,-40610,-40611,-40612,-40613,-40614,-40615,-40616,-40617,-40618,-40619,-40620,-40621,-40622,
+-40623,-40624,-40625,-40626,-40627,-40628,-40629,-40630,-40631,-40632,-40633,-40634,-40635,-40636,-40637,-40638,
+-40639,-40640,-40641,-40642,-40643,-40644,-40645,-40646,-40647,-40648,-40649,-40650,-40651,-40652,-40653,-40654,
+-40655,-40656,-40657,-40658,-40659,-40660,-40661,-40662,-40663,-40664,-40665,-40666,-40667,-40668,-40669,-40670,
+-40671,-40672,-40673,-40674,-40675,-40676,-40677,-40678,-40679,-40680,-40681,-40682,-40683,-40684,-40685,-40686,
+-40687,-40688,-40689,-40690,-40691,-40692,-40693,-40694,-40695,-40696,-40697,-40698,-40699,-40700,-40701,-40702,
+-40703,-40704,-40705,-40706,-40707,-40708,-40709,-40710,-40711,-40712,-40713,-40714,-40715,-40716,-40717,-40718,
+-40719,-40720,-40721,-40722,-40723,-40724,-40725,-40726,-40727,-40728,-40729,-40730,-40731,-40732,-40733,-40734,
+-40735,-40736,-40737,-40738,-40739,-40740,-40741,-40742,-40743,-40744,-40745,-40746,-40747,-40748,-40749,-40750,
+-40751,-40752,-40753,-40754,-40755,-40756,-40757,-40758,-40759,-40760,-40761,-40762,-40763,-40764,-40765,-40766,
+-40767,-40768,-40769,-40770,-40771,-40772,-40773,-40774,-40775,-40776,-40777,-40778,-40779,-40780,-40781,-40782,
+-40783,-40784,-40785,-40786,-40787,-40788,-40789,-40790,-40791,-40792,-40793,-40794,-40795,-40796,-40797,-40798,
+-40799,-40800,-40801,-40802,-40803,-40804,-40805,-40806,-40807,-40808,-40809,-40810,-40811,-40812,-40813,-40814,
+-40815,-40816,-40817,-40818,-40819,-40820,-40821,-40822,-40823,-40824,-40825,-40826,-40827,-40828,-40829,-40830,
+-40831,-40832,-40833,-40834,-40835,-40836,-40837,-40838,-40839,-40840,-40841,-40842,-40843,-40844,-40845,-40846,
+-40847,-40848,-40849,-40850,-40851,-40852,-40853,-40854,-40854,-40855,-40856,-40857,-40858,-40859,-40860,-40861,
+-40862,-40863,-40864,-40865,-40866,-40867,-40868,-40869,-40870,-40871,-40872,-40873,-40874,-40875,-40876,-40877,
+-40878,-40879,-40880,-40881,-40882,-40883,-40884,-40885,-40886,-40887,-40888,-40889,-40890,-40891,-40892,-40893,
+-40894,-40895,-40896,-40897,-40898,-40899,-40900,-40901,-40902,-40903,-40904,-40905,-40906,-40907,-40908,-40909,
+-40910,-40911,-40912,-40913,-40914,-40915,-40916,-40917,-40918,-40919,-40920,-40921,-40922,-40923,-40924,-40925,
+-40926,-40927,-40928,-40929,-40930,-40931,-40932,-40933,-40934,-40935,-40936,-40937,-40938,-40939,-40940,-40941,
+-40942,-40943,-40944,-40945,-40946,-40947,-40948,-40949,-40950,-40951,-40952,-40953,-40954,-40955,-40956,-40957,
+-40958,-40959,-40960,-40961,-40962,-40963,-40964,-40965,-40966,-40967,-40968,-40969,-40970,-40971,-40972,-40973,
+-40974,-40975,-40976,-40977,-40978,-40979,-40980,-40981,-40982,-40983,-40984,-40985,-40986,-40987,-40988,-40989,
+-40990,-40991,-40992,-40993,-40994,-40995,-40996,-40997,-40998,-40999,-41000,-41001,-41002,-41003,-41004,-41005,
+-41006,-41007,-41008,-41009,-41010,-41011,-41012,-41013,-41014,-41015,-41016,-41017,-41018,-41019,-41020,-41021,
+-41022,-41023,-41024,-41025,-41026,-41027,-41028,-41029,-41030,-41031,-41032,-41033,-41034,-41035,-41036,-41037,
+-41038,-41039,-41040,-41041,-41042,-41043,-41044,-41045,-41046,-41047,-41048,-41049,-41050,-41051,-41052,-41053,
+-41054,-41055,-41056,-41057,-41058,-41059,-41060,-41061,-41062,-41063,-41064,-41065,-41066,-41067,-41068,-41069,
+-41070,-41071,-41072,-41073,-41074,-41075,-41076,-41077,-41078,-41079,-41080,-41081,-41082,-41083,-41084,-41085,
+-41086,-41087,-41088,-41089,-41090,-41091,-41092,-41093,-41094,-41095,-41096,-41097,-41098,-41099,-41100,-41101,
+-41102,-41103,-41104,-41105,-41106,-41107,-41108,-41109,-41110,-41111,-41112,-41113,-41114,-41115,-41116,-41117,
+-41118,-41119,-41120,-41121,-41122,-41123,-41124,-41125,-41126,-41127,-41128,-41129,-41130,-41131,-41132,-41133,
+-41134,-41135,-41136,-41137,-41138,-41139,-41140,-41141,-41142,-41143,-41144,-41145,-41146,-41147,-41148,-41149,
+-41150,-41151,-41152,-41153,-41154,-41155,-41156,-41157,-41158,-41159,-41160,-41161,-41162,-41163,-41164,-41165,
+-41166,-41167,-41168,-41169,-41170,-41171,-41172,-41173,-41174,-41175,-41176,-41177,-41178,-41179,-41180,-41181,
+-41182,-41183,-41184,-41185,-41186,-41187,-41188,-41189,-41190,-41191,-41192,-41193,-41194,-41195,-41196,-41197,
+-41198,-41199,-41200,-41201,-41202,-41203,-41204,-41205,-41206,-41207,-41208,-41209,-41210,-41211,-41212,-41213,
+-41214,-41215,-41216,-41217,-41218,-41219,-41220,-41221,-41222,-41223,-41224,-41225,-41226,-41227,-41228,-41229,
+-41230,-41231,-41232,-41233,-41234,-41235,-41236,-41237,-41238,-41239,-41240,-41241,-41242,-41243,-41244,-41245,
+-41246,-41247,-41248,-41249,-41250,-41251,-41252,-41253,-41254,-41255,-41256,-41257,-41258,-41259,-41260,-41261,
+-41262,-41263,-41264,-41265,-41266,-41267,-41268,-41269,-41270,-41271,-41272,-41273,-41274,-41275,-41276,-41277,
+-41278,-41279,-41280,-41281,-41282,-41283,-41284,-41285,-41286,-41287,-41288,-41289,-41290,-41291,-41292,-41293,
+-41294,-41295,-41296,-41297,-41298,-41299,-41300,-41301,-41302,-41303,-41304,-41305,-41306,-41307,-41308,-41309,
+-41310,-41311,-41312,-41313,-41314,-41315,-41316,-41317,-41318,-41319,-41320,-41321,-41322,-41323,-41324,-41325,
+-41326,-41327,-41328,-41329,-41330,-41331,-41332,-41333,-41334,-41335,-41336,-41337,-41338,-41339,-41340,-41341,
+-41342,-41343,-41344,-41345,-41346,-41347,-41348,-41349,-41350,-41351,-41352,-41353,-41354,-41355,-41356,-41357,
+-41358,-41359,-41360,-41361,-41362,-41363,-41364,-41365,-41366,-41367,-41368,-41369,-41370,-41371,-41372,-41373,
+-41374,-41375,-41376,-41377,-41378,-41379,-41380,-41381,-41382,-41383,-41384,-41385,-41386,-41387,-41388,-41389,
+-41390,-41391,-41392,-41393,-41394,-41395,-41396,-41397,-41398,-41399,-41400,-41401,-41402,-41403,-41404,-41405,
+-41406,-41407,-41408,-41409,-41410,-41411,-41412,-41413,-41414,-41415,-41416,-41417,-41418,-41419,-41420,-41421,
+-41422,-41423,-41424,-41425,-41426,-41427,-41428,-41429,-41430,-41431,-41432,-41433,-41434,-41435,-41436,-41437,
+-41438,-41439,-41440,-41441,-41441,-41442,-41443,-41444,-41445,-41446,-41447,-41448,-41449,-41450,-41451,-41452,
+-41453,-41454,-41455,-41456,-41457,-41458,-41459,-41460,-41461,-41462,-41463,-41464,-41465,-41466,-41467,-41468,
+-41469,-41470,-41471,-41472,-41473,-41474,-41475,-41476,-41477,-41478,-41479,-41480,-41481,-41482,-41483,-41484,
+-41485,-41486,-41487,-41488,-41489,-41490,-41491,-41492,-41493,-41494,-41495,-41496,-41497,-41498,-41499,-41500,
+-41501,-41502,-41503,-41504,-41505,-41506,-41507,-41508,-41509,-41510,-41511,-41512,-41513,-41514,-41515,-41516,
+-41517,-41518,-41519,-41520,-41521,-41522,-41523,-41524,-41525,-41526,-41527,-41528,-41529,-41530,-41531,-41532,
+-41533,-41534,-41535,-41536,-41537,-41538,-41539,-41540,-41541,-41542,-41543,-41544,-41545,-41546,-41547,-41548,
+-41549,-41550,-41551,-41552,-41553,-41554,-41555,-41556,-41557,-41558,-41559,-41560,-41561,-41562,-41563,-41564,
+-41565,-41566,-41567,-41568,-41569,-41570,-41571,-41572,-41573,-41574,-41575,-41576,-41577,-41578,-41579,-41580,
+-41581,-41582,-41583,-41584,-41585,-41586,-41587,-41588,-41589,-41590,-41591,-41592,-41593,-41594,-41595,-41596,
+-41597,-41598,-41599,-41600,-41601,-41602,-41603,-41604,-41605,-41606,-41607,-41608,-41609,-41610,-41611,-41612,
+-41613,-41614,-41615,-41616,-41617,-41618,-41619,-41620,-41621,-41622,-41623,-41624,-41625,-41626,-41627,-41628,
+-41629,-41630,-41631,-41632,-41633,-41634,-41635,-41636,-41637,-41638,-41639,-41640,-41641,-41642,-41643,-41644,
+-41645,-41646,-41647,-41648,-41649,-41650,-41651,-41652,-41653,-41654,-41655,-41656,-41657,-41658,-41659,-41660,
+-41661,-41662,-41663,-41664,-41665,-41666,-41667,-41668,-41669,-41670,-41671,-41672,-41673,-41674,-41675,-41676,
+-41677,-41678,-41679,-41680,-41681,-41682,-41683,-41684,-41685,-41686,-41687,-41688,-41689,-41690,-41691,-41692,
+-41693,-41694,-41695,-41696,-41697,-41698,-41699,-41700,-41701,-41702,-41703,-41704,-41705,-41706,-41707,-41708,
+-41709,-41710,-41711,-41712,-41713,-41714,-41715,-41716,-41717,-41718,-41719,-41720,-41721,-41722,-41723,-41724,
+-41725,-41726,-41727,-41728,-41729,-41730,-41731,-41732,-41733,-41734,-41735,-41736,-41737,-41738,-41739,-41740,
+-41741,-41742,-41743,-41744,-41745,-41746,-41747,-41748,-41749,-41750,-41751,-41752,-41753,-41754,-41755,-41756,
+-41757,-41758,-41759,-41760,-41761,-41762,-41763,-41764,-41765,-41766,-41767,-41768,-41769,-41770,-41771,-41772,
+-41773,-41774,-41775,-41776,-41777,-41778,-41779,-41780,-41781,-41782,-41783,-41784,-41785,-41786,-41787,-41788,
+-41789,-41790,-41791,-41792,-41793,-41794,-41795,-41796,-41797,-41798,-41799,-41800,-41801,-41802,-41803,-41804,
+-41805,-41806,-41807,-41808,-41809,-41810,-41811,-41812,-41813,-41814,-41815,-41816,-41817,-41818,-41819,-41820,
+-41821,-41822,-41823,-41824,-41825,-41826,-41827,-41828,-41829,-41830,-41831,-41832,-41833,-41834,-41835,-41836,
+-41837,-41838,-41839,-41840,-41841,-41842,-41843,-41844,-41845,-41846,-41847,-41848,-41849,-41850,-41851,-41852,
+-41853,-41854,-41855,-41856,-41857,-41858,-41859,-41860,-41861,-41862,-41863,-41864,-41865,-41866,-41867,-41868,
+-41869,-41870,-41871,-41872,-41873,-41874,-41875,-41876,-41877,-41878,-41879,-41880,-41881,-41882,-41883,-41884,
+-41885,-41886,-41887,-41888,-41889,-41890,-41891,-41892,-41893,-41894,-41895,-41896,-41897,-41898,-41899,-41900,
+-41901,-41902,-41903,-41904,-41905,-41906,-41907,-41908,-41909,-41910,-41911,-41912,-41913,-41914,-41915,-41916,
+-41917,-41918,-41919,-41920,-41921,-41922,-41923,-41924,-41925,-41926,-41927,-41928,-41929,-41930,-41931,-41932,
+-41933,-41934,-41935,-41936,-41937,-41938,-41939,-41940,-41941,-41942,-41943,-41944,-41945,-41946,-41947,-41948,
+-41949,-41950,-41951,-41952,-41953,-41954,-41955,-41956,-41957,-41958,-41959,-41960,-41961,-41962,-41963,-41964,
+-41965,-41966,-41967,-41968,-41969,-41970,-41971,-41972,-41973,-41974,-41975,-41976,-41977,-41978,-41979,-41980,
+-41981,-41982,-41983,-41984,-41985,-41986,-41987,-41988,-41989,-41990,-41991,-41992,-41993,-41994,-41995,-41996,
+-41997,-41998,-41999,-42000,-42001,-42002,-42003,-42004,-42005,-42006,-42007,-42008,-42009,-42010,-42011,-42012,
+-42013,-42014,-42015,-42016,-42017,-42018,-42019,-42020,-42021,-42022,-42023,-42024,-42025,-42026,-42027,-42028,
+-42028,-42029,-42030,-42031,-42032,-42033,-42034,-42035,-42036,-42037,-42038,-42039,-42040,-42041,-42042,-42043,
+-42044,-42045,-42046,-42047,-42048,-42049,-42050,-42051,-42052,-42053,-42054,-42055,-42056,-42057,-42058,-42059,
+-42060,-42061,-42062,-42063,-42064,-42065,-42066,-42067,-42068,-42069,-42070,-42071,-42072,-42073,-42074,-42075,
+-42076,-42077,-42078,-42079,-42080,-42081,-42082,-42083,-42084,-42085,-42086,-42087,-42088,-42089,-42090,-42091,
+-42092,-42093,-42094,-42095,-42096,-42097,-42098,-42099,-42100,-42101,-42102,-42103,-42104,-42105,-42106,-42107,
+-42108,-42109,-42110,-42111,-42112,-42113,-42114,-42115,-42116,-42117,-42118,-42119,-42120,-42121,-42122,-42123,
+-42124,-42125,-42126,-42127,-42128,-42129,-42130,-42131,-42132,-42133,-42134,-42135,-42136,-42137,-42138,-42139,
+-42140,-42141,-42142,-42143,-42144,-42145,-42146,-42147,-42148,-42149,-42150,-42151,-42152,-42153,-42154,-42155,
+-42156,-42157,-42158,-42159,-42160,-42161,-42162,-42163,-42164,-42165,-42166,-42167,-42168,-42169,-42170,-42171,
+-42172,-42173,-42174,-42175,-42176,-42177,-42178,-42179,-42180,-42181,-42182,-42183,-42184,-42185,-42186,-42187,
+-42188,-42189,-42190,-42191,-42192,-42193,-42194,-42195,-42196,-42197,-42198,-42199,-42200,-42201,-42202,-42203,
+-42204,-42205,-42206,-42207,-42208,-42209,-42210,-42211,-42212,-42213,-42214,-42215,-42216,-42217,-42218,-42219,
+-42220,-42221,-42222,-42223,-42224,-42225,-42226,-42227,-42228,-42229,-42230,-42231,-42232,-42233,-42234,-42235,
+-42236,-42237,-42238,-42239,-42240,-42241,-42242,-42243,-42244,-42245,-42246,-42247,-42248,-42249,-42250,-42251,
+-42252,-42253,-42254,-42255,-42256,-42257,-42258,-42259,-42260,-42261,-42262,-42263,-42264,-42265,-42266,-42267,
+-42268,-42269,-42270,-42271,-42272,-42273,-42274,-42275,-42276,-42277,-42278,-42279,-42280,-42281,-42282,-42283,
+-42284,-42285,-42286,-42287,-42288,-42289,-42290,-42291,-42292,-42293,-42294,-42295,-42296,-42297,-42298,-42299,
+-42300,-42301,-42302,-42303,-42304,-42305,-42306,-42307,-42308,-42309,-42310,-42311,-42312,-42313,-42314,-42315,
+-42316,-42317,-42318,-42319,-42320,-42321,-42322,-42323,-42324,-42325,-42326,-42327,-42328,-42329,-42330,-42331,
+-42332,-42333,-42334,-42335,-42336,-42337,-42338,-42339,-42340,-42341,-42342,-42343,-42344,-42345,-42346,-42347,
+-42348,-42349,-42350,-42351,-42352,-42353,-42354,-42355,-42356,-42357,-42358,-42359,-42360,-42361,-42362,-42363,
+-42364,-42365,-42366,-42367,-42368,-42369,-42370,-42371,-42372,-42373,-42374,-42375,-42376,-42377,-42378,-42379,
+-42380,-42381,-42382,-42383,-42384,-42385,-42386,-42387,-42388,-42389,-42390,-42391,-42392,-42393,-42394,-42395,
+-42396,-42397,-42398,-42399,-42400,-42401,-42402,-42403,-42404,-42405,-42406,-42407,-42408,-42409,-42410,-42411,
+-42412,-42413,-42414,-42415,-42416,-42417,-42418,-42419,-42420,-42421,-42422,-42423,-42424,-42425,-42426,-42427,
+-42428,-42429,-42430,-42431,-42432,-42433,-42434,-42435,-42436,-42437,-42438,-42439,-42440,-42441,-42442,-42443,
+-42444,-42445,-42446,-42447,-42448,-42449,-42450,-42451,-42452,-42453,-42454,-42455,-42456,-42457,-42458,-42459,
+-42460,-42461,-42462,-42463,-42464,-42465,-42466,-42467,-42468,-42469,-42470,-42471,-42472,-42473,-42474,-42475,
+-42476,-42477,-42478,-42479,-42480,-42481,-42482,-42483,-42484,-42485,-42486,-42487,-42488,-42489,-42490,-42491,
+-42492,-42493,-42494,-42495,-42496,-42497,-42498,-42499,-42500,-42501,-42502,-42503,-42504,-42505,-42506,-42507,
+-42508,-42509,-42510,-42511,-42512,-42513,-42514,-42515,-42516,-42517,-42518,-42519,-42520,-42521,-42522,-42523,
+-42524,-42525,-42526,-42527,-42528,-42529,-42530,-42531,-42532,-42533,-42534,-42535,-42536,-42537,-42538,-42539,
+-42540,-42541,-42542,-42543,-42544,-42545,-42546,-42547,-42548,-42549,-42550,-42551,-42552,-42553,-42554,-42555,
+-42556,-42557,-42558,-42559,-42560,-42561,-42562,-42563,-42564,-42565,-42566,-42567,-42568,-42569,-42570,-42571,
+-42572,-42573,-42574,-42575,-42576,-42577,-42578,-42579,-42580,-42581,-42582,-42583,-42584,-42585,-42586,-42587,
+-42588,-42589,-42590,-42591,-42592,-42593,-42594,-42595,-42596,-42597,-42598,-42599,-42600,-42601,-42602,-42603,
+-42604,-42605,-42606,-42607,-42608,-42609,-42610,-42611,-42612,-42613,-42614,-42615,-42615,-42616,-42617,-42618,
+-42619,-42620,-42621,-42622,-42623,-42624,-42625,-42626,-42627,-42628,-42629,-42630,-42631,-42632,-42633,-42634,
+-42635,-42636,-42637,-42638,-42639,-42640,-42641,-42642,-42643,-42644,-42645,-42646,-42647,-42648,-42649,-42650,
+-42651,-42652,-42653,-42654,-42655,-42656,-42657,-42658,-42659,-42660,-42661,-42662,-42663,-42664,-42665,-42666,
+-42667,-42668,-42669,-42670,-42671,-42672,-42673,-42674,-42675,-42676,-42677,-42678,-42679,-42680,-42681,-42682,
+-42683,-42684,-42685,-42686,-42687,-42688,-42689,-42690,-42691,-42692,-42693,-42694,-42695,-42696,-42697,-42698,
+-42699,-42700,-42701,-42702,-42703,-42704,-42705,-42706,-42707,-42708,-42709,-42710,-42711,-42712,-42713,-42714,
+-42715,-42716,-42717,-42718,-42719,-42720,-42721,-42722,-42723,-42724,-42725,-42726,-42727,-42728,-42729,-42730,
+-42731,-42732,-42733,-42734,-42735,-42736,-42737,-42738,-42739,-42740,-42741,-42742,-42743,-42744,-42745,-42746,
+-42747,-42748,-42749,-42750,-42751,-42752,-42753,-42754,-42755,-42756,-42757,-42758,-42759,-42760,-42761,-42762,
+-42763,-42764,-42765,-42766,-42767,-42768,-42769,-42770,-42771,-42772,-42773,-42774,-42775,-42776,-42777,-42778,
+-42779,-42780,-42781,-42782,-42783,-42784,-42785,-42786,-42787,-42788,-42789,-42790,-42791,-42792,-42793,-42794,
+-42795,-42796,-42797,-42798,-42799,-42800,-42801,-42802,-42803,-42804,-42805,-42806,-42807,-42808,-42809,-42810,
+-42811,-42812,-42813,-42814,-42815,-42816,-42817,-42818,-42819,-42820,-42821,-42822,-42823,-42824,-42825,-42826,
+-42827,-42828,-42829,-42830,-42831,-42832,-42833,-42834,-42835,-42836,-42837,-42838,-42839,-42840,-42841,-42842,
+-42843,-42844,-42845,-42846,-42847,-42848,-42849,-42850,-42851,-42852,-42853,-42854,-42855,-42856,-42857,-42858,
+-42859,-42860,-42861,-42862,-42863,-42864,-42865,-42866,-42867,-42868,-42869,-42870,-42871,-42872,-42873,-42874,
+-42875,-42876,-42877,-42878,-42879,-42880,-42881,-42882,-42883,-42884,-42885,-42886,-42887,-42888,-42889,-42890,
+-42891,-42892,-42893,-42894,-42895,-42896,-42897,-42898,-42899,-42900,-42901,-42902,-42903,-42904,-42905,-42906,
+-42907,-42908,-42909,-42910,-42911,-42912,-42913,-42914,-42915,-42916,-42917,-42918,-42919,-42920,-42921,-42922,
+-42923,-42924,-42925,-42926,-42927,-42928,-42929,-42930,-42931,-42932,-42933,-42934,-42935,-42936,-42937,-42938,
+-42939,-42940,-42941,-42942,-42943,-42944,-42945,-42946,-42947,-42948,-42949,-42950,-42951,-42952,-42953,-42954,
+-42955,-42956,-42957,-42958,-42959,-42960,-42961,-42962,-42963,-42964,-42965,-42966,-42967,-42968,-42969,-42970,
+-42971,-42972,-42973,-42974,-42975,-42976,-42977,-42978,-42979,-42980,-42981,-42982,-42983,-42984,-42985,-42986,
+-42987,-42988,-42989,-42990,-42991,-42992,-42993,-42994,-42995,-42996,-42997,-42998,-42999,-43000,-43001,-43002,
+-43003,-43004,-43005,-43006,-43007,-43008,-43009,-43010,-43011,-43012,-43013,-43014,-43015,-43016,-43017,-43018,
+-43019,-43020,-43021,-43022,-43023,-43024,-43025,-43026,-43027,-43028,-43029,-43030,-43031,-43032,-43033,-43034,
+-43035,-43036,-43037,-43038,-43039,-43040,-43041,-43042,-43043,-43044,-43045,-43046,-43047,-43048,-43049,-43050,
+-43051,-43052,-43053,-43054,-43055,-43056,-43057,-43058,-43059,-43060,-43061,-43062,-43063,-43064,-43065,-43066,
+-43067,-43068,-43069,-43070,-43071,-43072,-43073,-43074,-43075,-43076,-43077,-43078,-43079,-43080,-43081,-43082,
+-43083,-43084,-43085,-43086,-43087,-43088,-43089,-43090,-43091,-43092,-43093,-43094,-43095,-43096,-43097,-43098,
+-43099,-43100,-43101,-43102,-43103,-43104,-43105,-43106,-43107,-43108,-43109,-43110,-43111,-43112,-43113,-43114,
+-43115,-43116,-43117,-43118,-43119,-43120,-43121,-43122,-43123,-43124,-43125,-43126,-43127,-43128,-43129,-43130,
+-43131,-43132,-43133,-43134,-43135,-43136,-43137,-43138,-43139,-43140,-43141,-43142,-43143,-43144,-43145,-43146,
+-43147,-43148,-43149,-43150,-43151,-43152,-43153,-43154,-43155,-43156,-43157,-43158,-43159,-43160,-43161,-43162,
+-43163,-43164,-43165,-43166,-43167,-43168,-43169,-43170,-43171,-43172,-43173,-43174,-43175,-43176,-43177,-43178,
+-43179,-43180,-43181,-43182,-43183,-43184,-43185,-43186,-43187,-43188,-43189,-43190,-43191,-43192,-43193,-43194,
+-43195,-43196,-43197,-43198,-43199,-43200,-43201,-43202,-43202,-43203,-43204,-43205,-43206,-43207,-43208,-43209,
+-43210,-43211,-43212,-43213,-43214,-43215,-43216,-43217,-43218,-43219,-43220,-43221,-43222,-43223,-43224,-43225,
+-43226,-43227,-43228,-43229,-43230,-43231,-43232,-43233,-43234,-43235,-43236,-43237,-43238,-43239,-43240,-43241,
+-43242,-43243,-43244,-43245,-43246,-43247,-43248,-43249,-43250,-43251,-43252,-43253,-43254,-43255,-43256,-43257,
+-43258,-43259,-43260,-43261,-43262,-43263,-43264,-43265,-43266,-43267,-43268,-43269,-43270,-43271,-43272,-43273,
+-43274,-43275,-43276,-43277,-43278,-43279,-43280,-43281,-43282,-43283,-43284,-43285,-43286,-43287,-43288,-43289,
+-43290,-43291,-43292,-43293,-43294,-43295,-43296,-43297,-43298,-43299,-43300,-43301,-43302,-43303,-43304,-43305,
+-43306,-43307,-43308,-43309,-43310,-43311,-43312,-43313,-43314,-43315,-43316,-43317,-43318,-43319,-43320,-43321,
+-43322,-43323,-43324,-43325,-43326,-43327,-43328,-43329,-43330,-43331,-43332,-43333,-43334,-43335,-43336,-43337,
+-43338,-43339,-43340,-43341,-43342,-43343,-43344,-43345,-43346,-43347,-43348,-43349,-43350,-43351,-43352,-43353,
+-43354,-43355,-43356,-43357,-43358,-43359,-43360,-43361,-43362,-43363,-43364,-43365,-43366,-43367,-43368,-43369,
+-43370,-43371,-43372,-43373,-43374,-43375,-43376,-43377,-43378,-43379,-43380,-43381,-43382,-43383,-43384,-43385,
+-43386,-43387,-43388,-43389,-43390,-43391,-43392,-43393,-43394,-43395,-43396,-43397,-43398,-43399,-43400,-43401,
+-43402,-43403,-43404,-43405,-43406,-43407,-43408,-43409,-43410,-43411,-43412,-43413,-43414,-43415,-43416,-43417,
+-43418,-43419,-43420,-43421,-43422,-43423,-43424,-43425,-43426,-43427,-43428,-43429,-43430,-43431,-43432,-43433,
+-43434,-43435,-43436,-43437,-43438,-43439,-43440,-43441,-43442,-43443,-43444,-43445,-43446,-43447,-43448,-43449,
+-43450,-43451,-43452,-43453,-43454,-43455,-43456,-43457,-43458,-43459,-43460,-43461,-43462,-43463,-43464,-43465,
+-43466,-43467,-43468,-43469,-43470,-43471,-43472,-43473,-43474,-43475,-43476,-43477,-43478,-43479,-43480,-43481,
+-43482,-43483,-43484,-43485,-43486,-43487,-43488,-43489,-43490,-43491,-43492,-43493,-43494,-43495,-43496,-43497,
+-43498,-43499,-43500,-43501,-43502,-43503,-43504,-43505,-43506,-43507,-43508,-43509,-43510,-43511,-43512,-43513,
+-43514,-43515,-43516,-43517,-43518,-43519,-43520,-43521,-43522,-43523,-43524,-43525,-43526,-43527,-43528,-43529,
+-43530,-43531,-43532,-43533,-43534,-43535,-43536,-43537,-43538,-43539,-43540,-43541,-43542,-43543,-43544,-43545,
+-43546,-43547,-43548,-43549,-43550,-43551,-43552,-43553,-43554,-43555,-43556,-43557,-43558,-43559,-43560,-43561,
+-43562,-43563,-43564,-43565,-43566,-43567,-43568,-43569,-43570,-43571,-43572,-43573,-43574,-43575,-43576,-43577,
+-43578,-43579,-43580,-43581,-43582,-43583,-43584,-43585,-43586,-43587,-43588,-43589,-43590,-43591,-43592,-43593,
+-43594,-43595,-43596,-43597,-43598,-43599,-43600,-43601,-43602,-43603,-43604,-43605,-43606,-43607,-43608,-43609,
+-43610,-43611,-43612,-43613,-43614,-43615,-43616,-43617,-43618,-43619,-43620,-43621,-43622,-43623,-43624,-43625,
+-43626,-43627,-43628,-43629,-43630,-43631,-43632,-43633,-43634,-43635,-43636,-43637,-43638,-43639,-43640,-43641,
+-43642,-43643,-43644,-43645,-43646,-43647,-43648,-43649,-43650,-43651,-43652,-43653,-43654,-43655,-43656,-43657,
+-43658,-43659,-43660,-43661,-43662,-43663,-43664,-43665,-43666,-43667,-43668,-43669,-43670,-43671,-43672,-43673,
+-43674,-43675,-43676,-43677,-43678,-43679,-43680,-43681,-43682,-43683,-43684,-43685,-43686,-43687,-43688,-43689,
+-43690,-43691,-43692,-43693,-43694,-43695,-43696,-43697,-43698,-43699,-43700,-43701,-43702,-43703,-43704,-43705,
+-43706,-43707,-43708,-43709,-43710,-43711,-43712,-43713,-43714,-43715,-43716,-43717,-43718,-43719,-43720,-43721,
+-43722,-43723,-43724,-43725,-43726,-43727,-43728,-43729,-43730,-43731,-43732,-43733,-43734,-43735,-43736,-43737,
+-43738,-43739,-43740,-43741,-43742,-43743,-43744,-43745,-43746,-43747,-43748,-43749,-43750,-43751,-43752,-43753,
+-43754,-43755,-43756,-43757,-43758,-43759,-43760,-43761,-43762,-43763,-43764,-43765,-43766,-43767,-43768,-43769,
+-43770,-43771,-43772,-43773,-43774,-43775,-43776,-43777,-43778,-43779,-43780,-43781,-43782,-43783,-43784,-43785,
+-43786,-43787,-43788,-43789,-43789,-43790,-43791,-43792,-43793,-43794,-43795,-43796,-43797,-43798,-43799,-43800,
+-43801,-43802,-43803,-43804,-43805,-43806,-43807,-43808,-43809,-43810,-43811,-43812,-43813,-43814,-43815,-43816,
+-43817,-43818,-43819,-43820,-43821,-43822,-43823,-43824,-43825,-43826,-43827,-43828,-43829,-43830,-43831,-43832,
+-43833,-43834,-43835,-43836,-43837,-43838,-43839,-43840,-43841,-43842,-43843,-43844,-43845,-43846,-43847,-43848,
+-43849,-43850,-43851,-43852,-43853,-43854,-43855,-43856,-43857,-43858,-43859,-43860,-43861,-43862,-43863,-43864,
+-43865,-43866,-43867,-43868,-43869,-43870,-43871,-43872,-43873,-43874,-43875,-43876,-43877,-43878,-43879,-43880,
+-43881,-43882,-43883,-43884,-43885,-43886,-43887,-43888,-43889,-43890,-43891,-43892,-43893,-43894,-43895,-43896,
+-43897,-43898,-43899,-43900,-43901,-43902,-43903,-43904,-43905,-43906,-43907,-43908,-43909,-43910,-43911,-43912,
+-43913,-43914,-43915,-43916,-43917,-43918,-43919,-43920,-43921,-43922,-43923,-43924,-43925,-43926,-43927,-43928,
+-43929,-43930,-43931,-43932,-43933,-43934,-43935,-43936,-43937,-43938,-43939,-43940,-43941,-43942,-43943,-43944,
+-43945,-43946,-43947,-43948,-43949,-43950,-43951,-43952,-43953,-43954,-43955,-43956,-43957,-43958,-43959,-43960,
+-43961,-43962,-43963,-43964,-43965,-43966,-43967,-43968,-43969,-43970,-43971,-43972,-43973,-43974,-43975,-43976,
+-43977,-43978,-43979,-43980,-43981,-43982,-43983,-43984,-43985,-43986,-43987,-43988,-43989,-43990,-43991,-43992,
+-43993,-43994,-43995,-43996,-43997,-43998,-43999,-44000,-44001,-44002,-44003,-44004,-44005,-44006,-44007,-44008,
+-44009,-44010,-44011,-44012,-44013,-44014,-44015,-44016,-44017,-44018,-44019,-44020,-44021,-44022,-44023,-44024,
+-44025,-44026,-44027,-44028,-44029,-44030,-44031,-44032,-44033,-44034,-44035,-44036,-44037,-44038,-44039,-44040,
+-44041,-44042,-44043,-44044,-44045,-44046,-44047,-44048,-44049,-44050,-44051,-44052,-44053,-44054,-44055,-44056,
+-44057,-44058,-44059,-44060,-44061,-44062,-44063,-44064,-44065,-44066,-44067,-44068,-44069,-44070,-44071,-44072,
+-44073,-44074,-44075,-44076,-44077,-44078,-44079,-44080,-44081,-44082,-44083,-44084,-44085,-44086,-44087,-44088,
+-44089,-44090,-44091,-44092,-44093,-44094,-44095,-44096,-44097,-44098,-44099,-44100,-44101,-44102,-44103,-44104,
+-44105,-44106,-44107,-44108,-44109,-44110,-44111,-44112,-44113,-44114,-44115,-44116,-44117,-44118,-44119,-44120,
+-44121,-44122,-44123,-44124,-44125,-44126,-44127,-44128,-44129,-44130,-44131,-44132,-44133,-44134,-44135,-44136,
+-44137,-44138,-44139,-44140,-44141,-44142,-44143,-44144,-44145,-44146,-44147,-44148,-44149,-44150,-44151,-44152,
+-44153,-44154,-44155,-44156,-44157,-44158,-44159,-44160,-44161,-44162,-44163,-44164,-44165,-44166,-44167,-44168,
+-44169,-44170,-44171,-44172,-44173,-44174,-44175,-44176,-44177,-44178,-44179,-44180,-44181,-44182,-44183,-44184,
+-44185,-44186,-44187,-44188,-44189,-44190,-44191,-44192,-44193,-44194,-44195,-44196,-44197,-44198,-44199,-44200,
+-44201,-44202,-44203,-44204,-44205,-44206,-44207,-44208,-44209,-44210,-44211,-44212,-44213,-44214,-44215,-44216,
+-44217,-44218,-44219,-44220,-44221,-44222,-44223,-44224,-44225,-44226,-44227,-44228,-44229,-44230,-44231,-44232,
+-44233,-44234,-44235,-44236,-44237,-44238,-44239,-44240,-44241,-44242,-44243,-44244,-44245,-44246,-44247,-44248,
+-44249,-44250,-44251,-44252,-44253,-44254,-44255,-44256,-44257,-44258,-44259,-44260,-44261,-44262,-44263,-44264,
+-44265,-44266,-44267,-44268,-44269,-44270,-44271,-44272,-44273,-44274,-44275,-44276,-44277,-44278,-44279,-44280,
+-44281,-44282,-44283,-44284,-44285,-44286,-44287,-44288,-44289,-44290,-44291,-44292,-44293,-44294,-44295,-44296,
+-44297,-44298,-44299,-44300,-44301,-44302,-44303,-44304,-44305,-44306,-44307,-44308,-44309,-44310,-44311,-44312,
+-44313,-44314,-44315,-44316,-44317,-44318,-44319,-44320,-44321,-44322,-44323,-44324,-44325,-44326,-44327,-44328,
+-44329,-44330,-44331,-44332,-44333,-44334,-44335,-44336,-44337,-44338,-44339,-44340,-44341,-44342,-44343,-44344,
+-44345,-44346,-44347,-44348,-44349,-44350,-44351,-44352,-44353,-44354,-44355,-44356,-44357,-44358,-44359,-44360,
+-44361,-44362,-44363,-44364,-44365,-44366,-44367,-44368,-44369,-44370,-44371,-44372,-44373,-44374,-44375,-44376,
+-44376,-44377,-44378,-44379,-44380,-44381,-44382,-44383,-44384,-44385,-44386,-44387,-44388,-44389,-44390,-44391,
+-44392,-44393,-44394,-44395,-44396,-44397,-44398,-44399,-44400,-44401,-44402,-44403,-44404,-44405,-44406,-44407,
+-44408,-44409,-44410,-44411,-44412,-44413,-44414,-44415,-44416,-44417,-44418,-44419,-44420,-44421,-44422,-44423,
+-44424,-44425,-44426,-44427,-44428,-44429,-44430,-44431,-44432,-44433,-44434,-44435,-44436,-44437,-44438,-44439,
+-44440,-44441,-44442,-44443,-44444,-44445,-44446,-44447,-44448,-44449,-44450,-44451,-44452,-44453,-44454,-44455,
+-44456,-44457,-44458,-44459,-44460,-44461,-44462,-44463,-44464,-44465,-44466,-44467,-44468,-44469,-44470,-44471,
+-44472,-44473,-44474,-44475,-44476,-44477,-44478,-44479,-44480,-44481,-44482,-44483,-44484,-44485,-44486,-44487,
+-44488,-44489,-44490,-44491,-44492,-44493,-44494,-44495,-44496,-44497,-44498,-44499,-44500,-44501,-44502,-44503,
+-44504,-44505,-44506,-44507,-44508,-44509,-44510,-44511,-44512,-44513,-44514,-44515,-44516,-44517,-44518,-44519,
+-44520,-44521,-44522,-44523,-44524,-44525,-44526,-44527,-44528,-44529,-44530,-44531,-44532,-44533,-44534,-44535,
+-44536,-44537,-44538,-44539,-44540,-44541,-44542,-44543,-44544,-44545,-44546,-44547,-44548,-44549,-44550,-44551,
+-44552,-44553,-44554,-44555,-44556,-44557,-44558,-44559,-44560,-44561,-44562,-44563,-44564,-44565,-44566,-44567,
+-44568,-44569,-44570,-44571,-44572,-44573,-44574,-44575,-44576,-44577,-44578,-44579,-44580,-44581,-44582,-44583,
+-44584,-44585,-44586,-44587,-44588,-44589,-44590,-44591,-44592,-44593,-44594,-44595,-44596,-44597,-44598,-44599,
+-44600,-44601,-44602,-44603,-44604,-44605,-44606,-44607,-44608,-44609,-44610,-44611,-44612,-44613,-44614,-44615,
+-44616,-44617,-44618,-44619,-44620,-44621,-44622,-44623,-44624,-44625,-44626,-44627,-44628,-44629,-44630,-44631,
+-44632,-44633,-44634,-44635,-44636,-44637,-44638,-44639,-44640,-44641,-44642,-44643,-44644,-44645,-44646,-44647,
+-44648,-44649,-44650,-44651,-44652,-44653,-44654,-44655,-44656,-44657,-44658,-44659,-44660,-44661,-44662,-44663,
+-44664,-44665,-44666,-44667,-44668,-44669,-44670,-44671,-44672,-44673,-44674,-44675,-44676,-44677,-44678,-44679,
+-44680,-44681,-44682,-44683,-44684,-44685,-44686,-44687,-44688,-44689,-44690,-44691,-44692,-44693,-44694,-44695,
+-44696,-44697,-44698,-44699,-44700,-44701,-44702,-44703,-44704,-44705,-44706,-44707,-44708,-44709,-44710,-44711,
+-44712,-44713,-44714,-44715,-44716,-44717,-44718,-44719,-44720,-44721,-44722,-44723,-44724,-44725,-44726,-44727,
+-44728,-44729,-44730,-44731,-44732,-44733,-44734,-44735,-44736,-44737,-44738,-44739,-44740,-44741,-44742,-44743,
+-44744,-44745,-44746,-44747,-44748,-44749,-44750,-44751,-44752,-44753,-44754,-44755,-44756,-44757,-44758,-44759,
+-44760,-44761,-44762,-44763,-44764,-44765,-44766,-44767,-44768,-44769,-44770,-44771,-44772,-44773,-44774,-44775,
+-44776,-44777,-44778,-44779,-44780,-44781,-44782,-44783,-44784,-44785,-44786,-44787,-44788,-44789,-44790,-44791,
+-44792,-44793,-44794,-44795,-44796,-44797,-44798,-44799,-44800,-44801,-44802,-44803,-44804,-44805,-44806,-44807,
+-44808,-44809,-44810,-44811,-44812,-44813,-44814,-44815,-44816,-44817,-44818,-44819,-44820,-44821,-44822,-44823,
+-44824,-44825,-44826,-44827,-44828,-44829,-44830,-44831,-44832,-44833,-44834,-44835,-44836,-44837,-44838,-44839,
+-44840,-44841,-44842,-44843,-44844,-44845,-44846,-44847,-44848,-44849,-44850,-44851,-44852,-44853,-44854,-44855,
+-44856,-44857,-44858,-44859,-44860,-44861,-44862,-44863,-44864,-44865,-44866,-44867,-44868,-44869,-44870,-44871,
+-44872,-44873,-44874,-44875,-44876,-44877,-44878,-44879,-44880,-44881,-44882,-44883,-44884,-44885,-44886,-44887,
+-44888,-44889,-44890,-44891,-44892,-44893,-44894,-44895,-44896,-44897,-44898,-44899,-44900,-44901,-44902,-44903,
+-44904,-44905,-44906,-44907,-44908,-44909,-44910,-44911,-44912,-44913,-44914,-44915,-44916,-44917,-44918,-44919,
+-44920,-44921,-44922,-44923,-44924,-44925,-44926,-44927,-44928,-44929,-44930,-44931,-44932,-44933,-44934,-44935,
+-44936,-44937,-44938,-44939,-44940,-44941,-44942,-44943,-44944,-44945,-44946,-44947,-44948,-44949,-44950,-44951,
+-44952,-44953,-44954,-44955,-44956,-44957,-44958,-44959,-44960,-44961,-44962,-44963,-44963,-44964,-44965,-44966,
+-44967,-44968,-44969,-44970,-44971,-44972,-44973,-44974,-44975,-44976,-44977,-44978,-44979,-44980,-44981,-44982,
+-44983,-44984,-44985,-44986,-44987,-44988,-44989,-44990,-44991,-44992,-44993,-44994,-44995,-44996,-44997,-44998,
+-44999,-45000,-45001,-45002,-45003,-45004,-45005,-45006,-45007,-45008,-45009,-45010,-45011,-45012,-45013,-45014,
+-45015,-45016,-45017,-45018,-45019,-45020,-45021,-45022,-45023,-45024,-45025,-45026,-45027,-45028,-45029,-45030,
+-45031,-45032,-45033,-45034,-45035,-45036,-45037,-45038,-45039,-45040,-45041,-45042,-45043,-45044,-45045,-45046,
+-45047,-45048,-45049,-45050,-45051,-45052,-45053,-45054,-45055,-45056,-45057,-45058,-45059,-45060,-45061,-45062,
+-45063,-45064,-45065,-45066,-45067,-45068,-45069,-45070,-45071,-45072,-45073,-45074,-45075,-45076,-45077,-45078,
+-45079,-45080,-45081,-45082,-45083,-45084,-45085,-45086,-45087,-45088,-45089,-45090,-45091,-45092,-45093,-45094,
+-45095,-45096,-45097,-45098,-45099,-45100,-45101,-45102,-45103,-45104,-45105,-45106,-45107,-45108,-45109,-45110,
+-45111,-45112,-45113,-45114,-45115,-45116,-45117,-45118,-45119,-45120,-45121,-45122,-45123,-45124,-45125,-45126,
+-45127,-45128,-45129,-45130,-45131,-45132,-45133,-45134,-45135,-45136,-45137,-45138,-45139,-45140,-45141,-45142,
+-45143,-45144,-45145,-45146,-45147,-45148,-45149,-45150,-45151,-45152,-45153,-45154,-45155,-45156,-45157,-45158,
+-45159,-45160,-45161,-45162,-45163,-45164,-45165,-45166,-45167,-45168,-45169,-45170,-45171,-45172,-45173,-45174,
+-45175,-45176,-45177,-45178,-45179,-45180,-45181,-45182,-45183,-45184,-45185,-45186,-45187,-45188,-45189,-45190,
+-45191,-45192,-45193,-45194,-45195,-45196,-45197,-45198,-45199,-45200,-45201,-45202,-45203,-45204,-45205,-45206,
+-45207,-45208,-45209,-45210,-45211,-45212,-45213,-45214,-45215,-45216,-45217,-45218,-45219,-45220,-45221,-45222,
+-45223,-45224,-45225,-45226,-45227,-45228,-45229,-45230,-45231,-45232,-45233,-45234,-45235,-45236,-45237,-45238,
+-45239,-45240,-45241,-45242,-45243,-45244,-45245,-45246,-45247,-45248,-45249,-45250,-45251,-45252,-45253,-45254,
+-45255,-45256,-45257,-45258,-45259,-45260,-45261,-45262,-45263,-45264,-45265,-45266,-45267,-45268,-45269,-45270,
+-45271,-45272,-45273,-45274,-45275,-45276,-45277,-45278,-45279,-45280,-45281,-45282,-45283,-45284,-45285,-45286,
+-45287,-45288,-45289,-45290,-45291,-45292,-45293,-45294,-45295,-45296,-45297,-45298,-45299,-45300,-45301,-45302,
+-45303,-45304,-45305,-45306,-45307,-45308,-45309,-45310,-45311,-45312,-45313,-45314,-45315,-45316,-45317,-45318,
+-45319,-45320,-45321,-45322,-45323,-45324,-45325,-45326,-45327,-45328,-45329,-45330,-45331,-45332,-45333,-45334,
+-45335,-45336,-45337,-45338,-45339,-45340,-45341,-45342,-45343,-45344,-45345,-45346,-45347,-45348,-45349,-45350,
+-45351,-45352,-45353,-45354,-45355,-45356,-45357,-45358,-45359,-45360,-45361,-45362,-45363,-45364,-45365,-45366,
+-45367,-45368,-45369,-45370,-45371,-45372,-45373,-45374,-45375,-45376,-45377,-45378,-45379,-45380,-45381,-45382,
+-45383,-45384,-45385,-45386,-45387,-45388,-45389,-45390,-45391,-45392,-45393,-45394,-45395,-45396,-45397,-45398,
+-45399,-45400,-45401,-45402,-45403,-45404,-45405,-45406,-45407,-45408,-45409,-45410,-45411,-45412,-45413,-45414,
+-45415,-45416,-45417,-45418,-45419,-45420,-45421,-45422,-45423,-45424,-45425,-45426,-45427,-45428,-45429,-45430,
+-45431,-45432,-45433,-45434,-45435,-45436,-45437,-45438,-45439,-45440,-45441,-45442,-45443,-45444,-45445,-45446,
+-45447,-45448,-45449,-45450,-45451,-45452,-45453,-45454,-45455,-45456,-45457,-45458,-45459,-45460,-45461,-45462,
+-45463,-45464,-45465,-45466,-45467,-45468,-45469,-45470,-45471,-45472,-45473,-45474,-45475,-45476,-45477,-45478,
+-45479,-45480,-45481,-45482,-45483,-45484,-45485,-45486,-45487,-45488,-45489,-45490,-45491,-45492,-45493,-45494,
+-45495,-45496,-45497,-45498,-45499,-45500,-45501,-45502,-45503,-45504,-45505,-45506,-45507,-45508,-45509,-45510,
+-45511,-45512,-45513,-45514,-45515,-45516,-45517,-45518,-45519,-45520,-45521,-45522,-45523,-45524,-45525,-45526,
+-45527,-45528,-45529,-45530,-45531,-45532,-45533,-45534,-45535,-45536,-45537,-45538,-45539,-45540,-45541,-45542,
+-45543,-45544,-45545,-45546,-45547,-45548,-45549,-45550,-45550,-45551,-45552,-45553,-45554,-45555,-45556,-45557,
+-45558,-45559,-45560,-45561,-45562,-45563,-45564,-45565,-45566,-45567,-45568,-45569,-45570,-45571,-45572,-45573,
+-45574,-45575,-45576,-45577,-45578,-45579,-45580,-45581,-45582,-45583,-45584,-45585,-45586,-45587,-45588,-45589,
+-45590,-45591,-45592,-45593,-45594,-45595,-45596,-45597,-45598,-45599,-45600,-45601,-45602,-45603,-45604,-45605,
+-45606,-45607,-45608,-45609,-45610,-45611,-45612,-45613,-45614,-45615,-45616,-45617,-45618,-45619,-45620,-45621,
+-45622,-45623,-45624,-45625,-45626,-45627,-45628,-45629,-45630,-45631,-45632,-45633,-45634,-45635,-45636,-45637,
+-45638,-45639,-45640,-45641,-45642,-45643,-45644,-45645,-45646,-45647,-45648,-45649,-45650,-45651,-45652,-45653,
+-45654,-45655,-45656,-45657,-45658,-45659,-45660,-45661,-45662,-45663,-45664,-45665,-45666,-45667,-45668,-45669,
+-45670,-45671,-45672,-45673,-45674,-45675,-45676,-45677,-45678,-45679,-45680,-45681,-45682,-45683,-45684,-45685,
+-45686,-45687,-45688,-45689,-45690,-45691,-45692,-45693,-45694,-45695,-45696,-45697,-45698,-45699,-45700,-45701,
+-45702,-45703,-45704,-45705,-45706,-45707,-45708,-45709,-45710,-45711,-45712,-45713,-45714,-45715,-45716,-45717,
+-45718,-45719,-45720,-45721,-45722,-45723,-45724,-45725,-45726,-45727,-45728,-45729,-45730,-45731,-45732,-45733,
+-45734,-45735,-45736,-45737,-45738,-45739,-45740,-45741,-45742,-45743,-45744,-45745,-45746,-45747,-45748,-45749,
+-45750,-45751,-45752,-45753,-45754,-45755,-45756,-45757,-45758,-45759,-45760,-45761,-45762,-45763,-45764,-45765,
+-45766,-45767,-45768,-45769,-45770,-45771,-45772,-45773,-45774,-45775,-45776,-45777,-45778,-45779,-45780,-45781,
+-45782,-45783,-45784,-45785,-45786,-45787,-45788,-45789,-45790,-45791,-45792,-45793,-45794,-45795,-45796,-45797,
+-45798,-45799,-45800,-45801,-45802,-45803,-45804,-45805,-45806,-45807,-45808,-45809,-45810,-45811,-45812,-45813,
+-45814,-45815,-45816,-45817,-45818,-45819,-45820,-45821,-45822,-45823,-45824,-45825,-45826,-45827,-45828,-45829,
+-45830,-45831,-45832,-45833,-45834,-45835,-45836,-45837,-45838,-45839,-45840,-45841,-45842,-45843,-45844,-45845,
+-45846,-45847,-45848,-45849,-45850,-45851,-45852,-45853,-45854,-45855,-45856,-45857,-45858,-45859,-45860,-45861,
+-45862,-45863,-45864,-45865,-45866,-45867,-45868,-45869,-45870,-45871,-45872,-45873,-45874,-45875,-45876,-45877,
+-45878,-45879,-45880,-45881,-45882,-45883,-45884,-45885,-45886,-45887,-45888,-45889,-45890,-45891,-45892,-45893,
+-45894,-45895,-45896,-45897,-45898,-45899,-45900,-45901,-45902,-45903,-45904,-45905,-45906,-45907,-45908,-45909,
+-45910,-45911,-45912,-45913,-45914,-45915,-45916,-45917,-45918,-45919,-45920,-45921,-45922,-45923,-45924,-45925,
+-45926,-45927,-45928,-45929,-45930,-45931,-45932,-45933,-45934,-45935,-45936,-45937,-45938,-45939,-45940,-45941,
+-45942,-45943,-45944,-45945,-45946,-45947,-45948,-45949,-45950,-45951,-45952,-45953,-45954,-45955,-45956,-45957,
+-45958,-45959,-45960,-45961,-45962,-45963,-45964,-45965,-45966,-45967,-45968,-45969,-45970,-45971,-45972,-45973,
+-45974,-45975,-45976,-45977,-45978,-45979,-45980,-45981,-45982,-45983,-45984,-45985,-45986,-45987,-45988,-45989,
+-45990,-45991,-45992,-45993,-45994,-45995,-45996,-45997,-45998,-45999,-46000,-46001,-46002,-46003,-46004,-46005,
+-46006,-46007,-46008,-46009,-46010,-46011,-46012,-46013,-46014,-46015,-46016,-46017,-46018,-46019,-46020,-46021,
+-46022,-46023,-46024,-46025,-46026,-46027,-46028,-46029,-46030,-46031,-46032,-46033,-46034,-46035,-46036,-46037,
+-46038,-46039,-46040,-46041,-46042,-46043,-46044,-46045,-46046,-46047,-46048,-46049,-46050,-46051,-46052,-46053,
+-46054,-46055,-46056,-46057,-46058,-46059,-46060,-46061,-46062,-46063,-46064,-46065,-46066,-46067,-46068,-46069,
+-46070,-46071,-46072,-46073,-46074,-46075,-46076,-46077,-46078,-46079,-46080,-46081,-46082,-46083,-46084,-46085,
+-46086,-46087,-46088,-46089,-46090,-46091,-46092,-46093,-46094,-46095,-46096,-46097,-46098,-46099,-46100,-46101,
+-46102,-46103,-46104,-46105,-46106,-46107,-46108,-46109,-46110,-46111,-46112,-46113,-46114,-46115,-46116,-46117,
+-46118,-46119,-46120,-46121,-46122,-46123,-46124,-46125,-46126,-46127,-46128,-46129,-46130,-46131,-46132,-46133,
+-46134,-46135,-46136,-46137,-46137,-46138,-46139,-46140,-46141,-46142,-46143,-46144,-46145,-46146,-46147,-46148,
+-46149,-46150,-46151,-46152,-46153,-46154,-46155,-46156,-46157,-46158,-46159,-46160,-46161,-46162,-46163,-46164,
+-46165,-46166,-46167,-46168,-46169,-46170,-46171,-46172,-46173,-46174,-46175,-46176,-46177,-46178,-46179,-46180,
+-46181,-46182,-46183,-46184,-46185,-46186,-46187,-46188,-46189,-46190,-46191,-46192,-46193,-46194,-46195,-46196,
+-46197,-46198,-46199,-46200,-46201,-46202,-46203,-46204,-46205,-46206,-46207,-46208,-46209,-46210,-46211,-46212,
+-46213,-46214,-46215,-46216,-46217,-46218,-46219,-46220,-46221,-46222,-46223,-46224,-46225,-46226,-46227,-46228,
+-46229,-46230,-46231,-46232,-46233,-46234,-46235,-46236,-46237,-46238,-46239,-46240,-46241,-46242,-46243,-46244,
+-46245,-46246,-46247,-46248,-46249,-46250,-46251,-46252,-46253,-46254,-46255,-46256,-46257,-46258,-46259,-46260,
+-46261,-46262,-46263,-46264,-46265,-46266,-46267,-46268,-46269,-46270,-46271,-46272,-46273,-46274,-46275,-46276,
+-46277,-46278,-46279,-46280,-46281,-46282,-46283,-46284,-46285,-46286,-46287,-46288,-46289,-46290,-46291,-46292,
+-46293,-46294,-46295,-46296,-46297,-46298,-46299,-46300,-46301,-46302,-46303,-46304,-46305,-46306,-46307,-46308,
+-46309,-46310,-46311,-46312,-46313,-46314,-46315,-46316,-46317,-46318,-46319,-46320,-46321,-46322,-46323,-46324,
+-46325,-46326,-46327,-46328,-46329,-46330,-46331,-46332,-46333,-46334,-46335,-46336,-46337,-46338,-46339,-46340,
+-46341,-46342,-46343,-46344,-46345,-46346,-46347,-46348,-46349,-46350,-46351,-46352,-46353,-46354,-46355,-46356,
+-46357,-46358,-46359,-46360,-46361,-46362,-46363,-46364,-46365,-46366,-46367,-46368,-46369,-46370,-46371,-46372,
+-46373,-46374,-46375,-46376,-46377,-46378,-46379,-46380,-46381,-46382,-46383,-46384,-46385,-46386,-46387,-46388,
+-46389,-46390,-46391,-46392,-46393,-46394,-46395,-46396,-46397,-46398,-46399,-46400,-46401,-46402,-46403,-46404,
+-46405,-46406,-46407,-46408,-46409,-46410,-46411,-46412,-46413,-46414,-46415,-46416,-46417,-46418,-46419,-46420,
+-46421,-46422,-46423,-46424,-46425,-46426,-46427,-46428,-46429,-46430,-46431,-46432,-46433,-46434,-46435,-46436,
+-46437,-46438,-46439,-46440,-46441,-46442,-46443,-46444,-46445,-46446,-46447,-46448,-46449,-46450,-46451,-46452,
+-46453,-46454,-46455,-46456,-46457,-46458,-46459,-46460,-46461,-46462,-46463,-46464,-46465,-46466,-46467,-46468,
+-46469,-46470,-46471,-46472,-46473,-46474,-46475,-46476,-46477,-46478,-46479,-46480,-46481,-46482,-46483,-46484,
+-46485,-46486,-46487,-46488,-46489,-46490,-46491,-46492,-46493,-46494,-46495,-46496,-46497,-46498,-46499,-46500,
+-46501,-46502,-46503,-46504,-46505,-46506,-46507,-46508,-46509,-46510,-46511,-46512,-46513,-46514,-46515,-46516,
+-46517,-46518,-46519,-46520,-46521,-46522,-46523,-46524,-46525,-46526,-46527,-46528,-46529,-46530,-46531,-46532,
+-46533,-46534,-46535,-46536,-46537,-46538,-46539,-46540,-46541,-46542,-46543,-46544,-46545,-46546,-46547,-46548,
+-46549,-46550,-46551,-46552,-46553,-46554,-46555,-46556,-46557,-46558,-46559,-46560,-46561,-46562,-46563,-46564,
+-46565,-46566,-46567,-46568,-46569,-46570,-46571,-46572,-46573,-46574,-46575,-46576,-46577,-46578,-46579,-46580,
+-46581,-46582,-46583,-46584,-46585,-46586,-46587,-46588,-46589,-46590,-46591,-46592,-46593,-46594,-46595,-46596,
+-46597,-46598,-46599,-46600,-46601,-46602,-46603,-46604,-46605,-46606,-46607,-46608,-46609,-46610,-46611,-46612,
+-46613,-46614,-46615,-46616,-46617,-46618,-46619,-46620,-46621,-46622,-46623,-46624,-46625,-46626,-46627,-46628,
+-46629,-46630,-46631,-46632,-46633,-46634,-46635,-46636,-46637,-46638,-46639,-46640,-46641,-46642,-46643,-46644,
+-46645,-46646,-46647,-46648,-46649,-46650,-46651,-46652,-46653,-46654,-46655,-46656,-46657,-46658,-46659,-46660,
+-46661,-46662,-46663,-46664,-46665,-46666,-46667,-46668,-46669,-46670,-46671,-46672,-46673,-46674,-46675,-46676,
+-46677,-46678,-46679,-46680,-46681,-46682,-46683,-46684,-46685,-46686,-46687,-46688,-46689,-46690,-46691,-46692,
+-46693,-46694,-46695,-46696,-46697,-46698,-46699,-46700,-46701,-46702,-46703,-46704,-46705,-46706,-46707,-46708,
+-46709,-46710,-46711,-46712,-46713,-46714,-46715,-46716,-46717,-46718,-46719,-46720,-46721,-46722,-46723,-46724,
+-46724,-46725,-46726,-46727,-46728,-46729,-46730,-46731,-46732,-46733,-46734,-46735,-46736,-46737,-46738,-46739,
+-46740,-46741,-46742,-46743,-46744,-46745,-46746,-46747,-46748,-46749,-46750,-46751,-46752,-46753,-46754,-46755,
+-46756,-46757,-46758,-46759,-46760,-46761,-46762,-46763,-46764,-46765,-46766,-46767,-46768,-46769,-46770,-46771,
+-46772,-46773,-46774,-46775,-46776,-46777,-46778,-46779,-46780,-46781,-46782,-46783,-46784,-46785,-46786,-46787,
+-46788,-46789,-46790,-46791,-46792,-46793,-46794,-46795,-46796,-46797,-46798,-46799,-46800,-46801,-46802,-46803,
+-46804,-46805,-46806,-46807,-46808,-46809,-46810,-46811,-46812,-46813,-46814,-46815,-46816,-46817,-46818,-46819,
+-46820,-46821,-46822,-46823,-46824,-46825,-46826,-46827,-46828,-46829,-46830,-46831,-46832,-46833,-46834,-46835,
+-46836,-46837,-46838,-46839,-46840,-46841,-46842,-46843,-46844,-46845,-46846,-46847,-46848,-46849,-46850,-46851,
+-46852,-46853,-46854,-46855,-46856,-46857,-46858,-46859,-46860,-46861,-46862,-46863,-46864,-46865,-46866,-46867,
+-46868,-46869,-46870,-46871,-46872,-46873,-46874,-46875,-46876,-46877,-46878,-46879,-46880,-46881,-46882,-46883,
+-46884,-46885,-46886,-46887,-46888,-46889,-46890,-46891,-46892,-46893,-46894,-46895,-46896,-46897,-46898,-46899,
+-46900,-46901,-46902,-46903,-46904,-46905,-46906,-46907,-46908,-46909,-46910,-46911,-46912,-46913,-46914,-46915,
+-46916,-46917,-46918,-46919,-46920,-46921,-46922,-46923,-46924,-46925,-46926,-46927,-46928,-46929,-46930,-46931,
+-46932,-46933,-46934,-46935,-46936,-46937,-46938,-46939,-46940,-46941,-46942,-46943,-46944,-46945,-46946,-46947,
+-46948,-46949,-46950,-46951,-46952,-46953,-46954,-46955,-46956,-46957,-46958,-46959,-46960,-46961,-46962,-46963,
+-46964,-46965,-46966,-46967,-46968,-46969,-46970,-46971,-46972,-46973,-46974,-46975,-46976,-46977,-46978,-46979,
+-46980,-46981,-46982,-46983,-46984,-46985,-46986,-46987,-46988,-46989,-46990,-46991,-46992,-46993,-46994,-46995,
+-46996,-46997,-46998,-46999,-47000,-47001,-47002,-47003,-47004,-47005,-47006,-47007,-47008,-47009,-47010,-47011,
+-47012,-47013,-47014,-47015,-47016,-47017,-47018,-47019,-47020,-47021,-47022,-47023,-47024,-47025,-47026,-47027,
+-47028,-47029,-47030,-47031,-47032,-47033,-47034,-47035,-47036,-47037,-47038,-47039,-47040,-47041,-47042,-47043,
+-47044,-47045,-47046,-47047,-47048,-47049,-47050,-47051,-47052,-47053,-47054,-47055,-47056,-47057,-47058,-47059,
+-47060,-47061,-47062,-47063,-47064,-47065,-47066,-47067,-47068,-47069,-47070,-47071,-47072,-47073,-47074,-47075,
+-47076,-47077,-47078,-47079,-47080,-47081,-47082,-47083,-47084,-47085,-47086,-47087,-47088,-47089,-47090,-47091,
+-47092,-47093,-47094,-47095,-47096,-47097,-47098,-47099,-47100,-47101,-47102,-47103,-47104,-47105,-47106,-47107,
+-47108,-47109,-47110,-47111,-47112,-47113,-47114,-47115,-47116,-47117,-47118,-47119,-47120,-47121,-47122,-47123,
+-47124,-47125,-47126,-47127,-47128,-47129,-47130,-47131,-47132,-47133,-47134,-47135,-47136,-47137,-47138,-47139,
+-47140,-47141,-47142,-47143,-47144,-47145,-47146,-47147,-47148,-47149,-47150,-47151,-47152,-47153,-47154,-47155,
+-47156,-47157,-47158,-47159,-47160,-47161,-47162,-47163,-47164,-47165,-47166,-47167,-47168,-47169,-47170,-47171,
+-47172,-47173,-47174,-47175,-47176,-47177,-47178,-47179,-47180,-47181,-47182,-47183,-47184,-47185,-47186,-47187,
+-47188,-47189,-47190,-47191,-47192,-47193,-47194,-47195,-47196,-47197,-47198,-47199,-47200,-47201,-47202,-47203,
+-47204,-47205,-47206,-47207,-47208,-47209,-47210,-47211,-47212,-47213,-47214,-47215,-47216,-47217,-47218,-47219,
+-47220,-47221,-47222,-47223,-47224,-47225,-47226,-47227,-47228,-47229,-47230,-47231,-47232,-47233,-47234,-47235,
+-47236,-47237,-47238,-47239,-47240,-47241,-47242,-47243,-47244,-47245,-47246,-47247,-47248,-47249,-47250,-47251,
+-47252,-47253,-47254,-47255,-47256,-47257,-47258,-47259,-47260,-47261,-47262,-47263,-47264,-47265,-47266,-47267,
+-47268,-47269,-47270,-47271,-47272,-47273,-47274,-47275,-47276,-47277,-47278,-47279,-47280,-47281,-47282,-47283,
+-47284,-47285,-47286,-47287,-47288,-47289,-47290,-47291,-47292,-47293,-47294,-47295,-47296,-47297,-47298,-47299,
+-47300,-47301,-47302,-47303,-47304,-47305,-47306,-47307,-47308,-47309,-47310,-47311,-47311,-47312,-47313,-47314,
+-47315,-47316,-47317,-47318,-47319,-47320,-47321,-47322,-47323,-47324,-47325,-47326,-47327,-47328,-47329,-47330,
+-47331,-47332,-47333,-47334,-47335,-47336,-47337,-47338,-47339,-47340,-47341,-47342,-47343,-47344,-47345,-47346,
+-47347,-47348,-47349,-47350,-47351,-47352,-47353,-47354,-47355,-47356,-47357,-47358,-47359,-47360,-47361,-47362,
+-47363,-47364,-47365,-47366,-47367,-47368,-47369,-47370,-47371,-47372,-47373,-47374,-47375,-47376,-47377,-47378,
+-47379,-47380,-47381,-47382,-47383,-47384,-47385,-47386,-47387,-47388,-47389,-47390,-47391,-47392,-47393,-47394,
+-47395,-47396,-47397,-47398,-47399,-47400,-47401,-47402,-47403,-47404,-47405,-47406,-47407,-47408,-47409,-47410,
+-47411,-47412,-47413,-47414,-47415,-47416,-47417,-47418,-47419,-47420,-47421,-47422,-47423,-47424,-47425,-47426,
+-47427,-47428,-47429,-47430,-47431,-47432,-47433,-47434,-47435,-47436,-47437,-47438,-47439,-47440,-47441,-47442,
+-47443,-47444,-47445,-47446,-47447,-47448,-47449,-47450,-47451,-47452,-47453,-47454,-47455,-47456,-47457,-47458,
+-47459,-47460,-47461,-47462,-47463,-47464,-47465,-47466,-47467,-47468,-47469,-47470,-47471,-47472,-47473,-47474,
+-47475,-47476,-47477,-47478,-47479,-47480,-47481,-47482,-47483,-47484,-47485,-47486,-47487,-47488,-47489,-47490,
+-47491,-47492,-47493,-47494,-47495,-47496,-47497,-47498,-47499,-47500,-47501,-47502,-47503,-47504,-47505,-47506,
+-47507,-47508,-47509,-47510,-47511,-47512,-47513,-47514,-47515,-47516,-47517,-47518,-47519,-47520,-47521,-47522,
+-47523,-47524,-47525,-47526,-47527,-47528,-47529,-47530,-47531,-47532,-47533,-47534,-47535,-47536,-47537,-47538,
+-47539,-47540,-47541,-47542,-47543,-47544,-47545,-47546,-47547,-47548,-47549,-47550,-47551,-47552,-47553,-47554,
+-47555,-47556,-47557,-47558,-47559,-47560,-47561,-47562,-47563,-47564,-47565,-47566,-47567,-47568,-47569,-47570,
+-47571,-47572,-47573,-47574,-47575,-47576,-47577,-47578,-47579,-47580,-47581,-47582,-47583,-47584,-47585,-47586,
+-47587,-47588,-47589,-47590,-47591,-47592,-47593,-47594,-47595,-47596,-47597,-47598,-47599,-47600,-47601,-47602,
+-47603,-47604,-47605,-47606,-47607,-47608,-47609,-47610,-47611,-47612,-47613,-47614,-47615,-47616,-47617,-47618,
+-47619,-47620,-47621,-47622,-47623,-47624,-47625,-47626,-47627,-47628,-47629,-47630,-47631,-47632,-47633,-47634,
+-47635,-47636,-47637,-47638,-47639,-47640,-47641,-47642,-47643,-47644,-47645,-47646,-47647,-47648,-47649,-47650,
+-47651,-47652,-47653,-47654,-47655,-47656,-47657,-47658,-47659,-47660,-47661,-47662,-47663,-47664,-47665,-47666,
+-47667,-47668,-47669,-47670,-47671,-47672,-47673,-47674,-47675,-47676,-47677,-47678,-47679,-47680,-47681,-47682,
+-47683,-47684,-47685,-47686,-47687,-47688,-47689,-47690,-47691,-47692,-47693,-47694,-47695,-47696,-47697,-47698,
+-47699,-47700,-47701,-47702,-47703,-47704,-47705,-47706,-47707,-47708,-47709,-47710,-47711,-47712,-47713,-47714,
+-47715,-47716,-47717,-47718,-47719,-47720,-47721,-47722,-47723,-47724,-47725,-47726,-47727,-47728,-47729,-47730,
+-47731,-47732,-47733,-47734,-47735,-47736,-47737,-47738,-47739,-47740,-47741,-47742,-47743,-47744,-47745,-47746,
+-47747,-47748,-47749,-47750,-47751,-47752,-47753,-47754,-47755,-47756,-47757,-47758,-47759,-47760,-47761,-47762,
+-47763,-47764,-47765,-47766,-47767,-47768,-47769,-47770,-47771,-47772,-47773,-47774,-47775,-47776,-47777,-47778,
+-47779,-47780,-47781,-47782,-47783,-47784,-47785,-47786,-47787,-47788,-47789,-47790,-47791,-47792,-47793,-47794,
+-47795,-47796,-47797,-47798,-47799,-47800,-47801,-47802,-47803,-47804,-47805,-47806,-47807,-47808,-47809,-47810,
+-47811,-47812,-47813,-47814,-47815,-47816,-47817,-47818,-47819,-47820,-47821,-47822,-47823,-47824,-47825,-47826,
+-47827,-47828,-47829,-47830,-47831,-47832,-47833,-47834,-47835,-47836,-47837,-47838,-47839,-47840,-47841,-47842,
+-47843,-47844,-47845,-47846,-47847,-47848,-47849,-47850,-47851,-47852,-47853,-47854,-47855,-47856,-47857,-47858,
+-47859,-47860,-47861,-47862,-47863,-47864,-47865,-47866,-47867,-47868,-47869,-47870,-47871,-47872,-47873,-47874,
+-47875,-47876,-47877,-47878,-47879,-47880,-47881,-47882,-47883,-47884,-47885,-47886,-47887,-47888,-47889,-47890,
+-47891,-47892,-47893,-47894,-47895,-47896,-47897,-47898,-47898,-47899,-47900,-47901,-47902,-47903,-47904,-47905,
+-47906,-47907,-47908,-47909,-47910,-47911,-47912,-47913,-47914,-47915,-47916,-47917,-47918,-47919,-47920,-47921,
+-47922,-47923,-47924,-47925,-47926,-47927,-47928,-47929,-47930,-47931,-47932,-47933,-47934,-47935,-47936,-47937,
+-47938,-47939,-47940,-47941,-47942,-47943,-47944,-47945,-47946,-47947,-47948,-47949,-47950,-47951,-47952,-47953,
+-47954,-47955,-47956,-47957,-47958,-47959,-47960,-47961,-47962,-47963,-47964,-47965,-47966,-47967,-47968,-47969,
+-47970,-47971,-47972,-47973,-47974,-47975,-47976,-47977,-47978,-47979,-47980,-47981,-47982,-47983,-47984,-47985,
+-47986,-47987,-47988,-47989,-47990,-47991,-47992,-47993,-47994,-47995,-47996,-47997,-47998,-47999,-48000,-48001,
+-48002,-48003,-48004,-48005,-48006,-48007,-48008,-48009,-48010,-48011,-48012,-48013,-48014,-48015,-48016,-48017,
+-48018,-48019,-48020,-48021,-48022,-48023,-48024,-48025,-48026,-48027,-48028,-48029,-48030,-48031,-48032,-48033,
+-48034,-48035,-48036,-48037,-48038,-48039,-48040,-48041,-48042,-48043,-48044,-48045,-48046,-48047,-48048,-48049,
+-48050,-48051,-48052,-48053,-48054,-48055,-48056,-48057,-48058,-48059,-48060,-48061,-48062,-48063,-48064,-48065,
+-48066,-48067,-48068,-48069,-48070,-48071,-48072,-48073,-48074,-48075,-48076,-48077,-48078,-48079,-48080,-48081,
+-48082,-48083,-48084,-48085,-48086,-48087,-48088,-48089,-48090,-48091,-48092,-48093,-48094,-48095,-48096,-48097,
+-48098,-48099,-48100,-48101,-48102,-48103,-48104,-48105,-48106,-48107,-48108,-48109,-48110,-48111,-48112,-48113,
+-48114,-48115,-48116,-48117,-48118,-48119,-48120,-48121,-48122,-48123,-48124,-48125,-48126,-48127,-48128,-48129,
+-48130,-48131,-48132,-48133,-48134,-48135,-48136,-48137,-48138,-48139,-48140,-48141,-48142,-48143,-48144,-48145,
+-48146,-48147,-48148,-48149,-48150,-48151,-48152,-48153,-48154,-48155,-48156,-48157,-48158,-48159,-48160,-48161,
+-48162,-48163,-48164,-48165,-48166,-48167,-48168,-48169,-48170,-48171,-48172,-48173,-48174,-48175,-48176,-48177,
+-48178,-48179,-48180,-48181,-48182,-48183,-48184,-48185,-48186,-48187,-48188,-48189,-48190,-48191,-48192,-48193,
+-48194,-48195,-48196,-48197,-48198,-48199,-48200,-48201,-48202,-48203,-48204,-48205,-48206,-48207,-48208,-48209,
+-48210,-48211,-48212,-48213,-48214,-48215,-48216,-48217,-48218,-48219,-48220,-48221,-48222,-48223,-48224,-48225,
+-48226,-48227,-48228,-48229,-48230,-48231,-48232,-48233,-48234,-48235,-48236,-48237,-48238,-48239,-48240,-48241,
+-48242,-48243,-48244,-48245,-48246,-48247,-48248,-48249,-48250,-48251,-48252,-48253,-48254,-48255,-48256,-48257,
+-48258,-48259,-48260,-48261,-48262,-48263,-48264,-48265,-48266,-48267,-48268,-48269,-48270,-48271,-48272,-48273,
+-48274,-48275,-48276,-48277,-48278,-48279,-48280,-48281,-48282,-48283,-48284,-48285,-48286,-48287,-48288,-48289,
+-48290,-48291,-48292,-48293,-48294,-48295,-48296,-48297,-48298,-48299,-48300,-48301,-48302,-48303,-48304,-48305,
+-48306,-48307,-48308,-48309,-48310,-48311,-48312,-48313,-48314,-48315,-48316,-48317,-48318,-48319,-48320,-48321,
+-48322,-48323,-48324,-48325,-48326,-48327,-48328,-48329,-48330,-48331,-48332,-48333,-48334,-48335,-48336,-48337,
+-48338,-48339,-48340,-48341,-48342,-48343,-48344,-48345,-48346,-48347,-48348,-48349,-48350,-48351,-48352,-48353,
+-48354,-48355,-48356,-48357,-48358,-48359,-48360,-48361,-48362,-48363,-48364,-48365,-48366,-48367,-48368,-48369,
+-48370,-48371,-48372,-48373,-48374,-48375,-48376,-48377,-48378,-48379,-48380,-48381,-48382,-48383,-48384,-48385,
+-48386,-48387,-48388,-48389,-48390,-48391,-48392,-48393,-48394,-48395,-48396,-48397,-48398,-48399,-48400,-48401,
+-48402,-48403,-48404,-48405,-48406,-48407,-48408,-48409,-48410,-48411,-48412,-48413,-48414,-48415,-48416,-48417,
+-48418,-48419,-48420,-48421,-48422,-48423,-48424,-48425,-48426,-48427,-48428,-48429,-48430,-48431,-48432,-48433,
+-48434,-48435,-48436,-48437,-48438,-48439,-48440,-48441,-48442,-48443,-48444,-48445,-48446,-48447,-48448,-48449,
+-48450,-48451,-48452,-48453,-48454,-48455,-48456,-48457,-48458,-48459,-48460,-48461,-48462,-48463,-48464,-48465,
+-48466,-48467,-48468,-48469,-48470,-48471,-48472,-48473,-48474,-48475,-48476,-48477,-48478,-48479,-48480,-48481,
+-48482,-48483,-48484,-48485,-48485,-48486,-48487,-48488,-48489,-48490,-48491,-48492,-48493,-48494,-48495,-48496,
+-48497,-48498,-48499,-48500,-48501,-48502,-48503,-48504,-48505,-48506,-48507,-48508,-48509,-48510,-48511,-48512,
+-48513,-48514,-48515,-48516,-48517,-48518,-48519,-48520,-48521,-48522,-48523,-48524,-48525,-48526,-48527,-48528,
+-48529,-48530,-48531,-48532,-48533,-48534,-48535,-48536,-48537,-48538,-48539,-48540,-48541,-48542,-48543,-48544,
+-48545,-48546,-48547,-48548,-48549,-48550,-48551,-48552,-48553,-48554,-48555,-48556,-48557,-48558,-48559,-48560,
+-48561,-48562,-48563,-48564,-48565,-48566,-48567,-48568,-48569,-48570,-48571,-48572,-48573,-48574,-48575,-48576,
+-48577,-48578,-48579,-48580,-48581,-48582,-48583,-48584,-48585,-48586,-48587,-48588,-48589,-48590,-48591,-48592,
+-48593,-48594,-48595,-48596,-48597,-48598,-48599,-48600,-48601,-48602,-48603,-48604,-48605,-48606,-48607,-48608,
+-48609,-48610,-48611,-48612,-48613,-48614,-48615,-48616,-48617,-48618,-48619,-48620,-48621,-48622,-48623,-48624,
+-48625,-48626,-48627,-48628,-48629,-48630,-48631,-48632,-48633,-48634,-48635,-48636,-48637,-48638,-48639,-48640,
+-48641,-48642,-48643,-48644,-48645,-48646,-48647,-48648,-48649,-48650,-48651,-48652,-48653,-48654,-48655,-48656,
+-48657,-48658,-48659,-48660,-48661,-48662,-48663,-48664,-48665,-48666,-48667,-48668,-48669,-48670,-48671,-48672,
+-48673,-48674,-48675,-48676,-48677,-48678,-48679,-48680,-48681,-48682,-48683,-48684,-48685,-48686,-48687,-48688,
+-48689,-48690,-48691,-48692,-48693,-48694,-48695,-48696,-48697,-48698,-48699,-48700,-48701,-48702,-48703,-48704,
+-48705,-48706,-48707,-48708,-48709,-48710,-48711,-48712,-48713,-48714,-48715,-48716,-48717,-48718,-48719,-48720,
+-48721,-48722,-48723,-48724,-48725,-48726,-48727,-48728,-48729,-48730,-48731,-48732,-48733,-48734,-48735,-48736,
+-48737,-48738,-48739,-48740,-48741,-48742,-48743,-48744,-48745,-48746,-48747,-48748,-48749,-48750,-48751,-48752,
+-48753,-48754,-48755,-48756,-48757,-48758,-48759,-48760,-48761,-48762,-48763,-48764,-48765,-48766,-48767,-48768,
+-48769,-48770,-48771,-48772,-48773,-48774,-48775,-48776,-48777,-48778,-48779,-48780,-48781,-48782,-48783,-48784,
+-48785,-48786,-48787,-48788,-48789,-48790,-48791,-48792,-48793,-48794,-48795,-48796,-48797,-48798,-48799,-48800,
+-48801,-48802,-48803,-48804,-48805,-48806,-48807,-48808,-48809,-48810,-48811,-48812,-48813,-48814,-48815,-48816,
+-48817,-48818,-48819,-48820,-48821,-48822,-48823,-48824,-48825,-48826,-48827,-48828,-48829,-48830,-48831,-48832,
+-48833,-48834,-48835,-48836,-48837,-48838,-48839,-48840,-48841,-48842,-48843,-48844,-48845,-48846,-48847,-48848,
+-48849,-48850,-48851,-48852,-48853,-48854,-48855,-48856,-48857,-48858,-48859,-48860,-48861,-48862,-48863,-48864,
+-48865,-48866,-48867,-48868,-48869,-48870,-48871,-48872,-48873,-48874,-48875,-48876,-48877,-48878,-48879,-48880,
+-48881,-48882,-48883,-48884,-48885,-48886,-48887,-48888,-48889,-48890,-48891,-48892,-48893,-48894,-48895,-48896,
+-48897,-48898,-48899,-48900,-48901,-48902,-48903,-48904,-48905,-48906,-48907,-48908,-48909,-48910,-48911,-48912,
+-48913,-48914,-48915,-48916,-48917,-48918,-48919,-48920,-48921,-48922,-48923,-48924,-48925,-48926,-48927,-48928,
+-48929,-48930,-48931,-48932,-48933,-48934,-48935,-48936,-48937,-48938,-48939,-48940,-48941,-48942,-48943,-48944,
+-48945,-48946,-48947,-48948,-48949,-48950,-48951,-48952,-48953,-48954,-48955,-48956,-48957,-48958,-48959,-48960,
+-48961,-48962,-48963,-48964,-48965,-48966,-48967,-48968,-48969,-48970,-48971,-48972,-48973,-48974,-48975,-48976,
+-48977,-48978,-48979,-48980,-48981,-48982,-48983,-48984,-48985,-48986,-48987,-48988,-48989,-48990,-48991,-48992,
+-48993,-48994,-48995,-48996,-48997,-48998,-48999,-49000,-49001,-49002,-49003,-49004,-49005,-49006,-49007,-49008,
+-49009,-49010,-49011,-49012,-49013,-49014,-49015,-49016,-49017,-49018,-49019,-49020,-49021,-49022,-49023,-49024,
+-49025,-49026,-49027,-49028,-49029,-49030,-49031,-49032,-49033,-49034,-49035,-49036,-49037,-49038,-49039,-49040,
+-49041,-49042,-49043,-49044,-49045,-49046,-49047,-49048,-49049,-49050,-49051,-49052,-49053,-49054,-49055,-49056,
+-49057,-49058,-49059,-49060,-49061,-49062,-49063,-49064,-49065,-49066,-49067,-49068,-49069,-49070,-49071,-49072,
+-49072,-49073,-49074,-49075,-49076,-49077,-49078,-49079,-49080,-49081,-49082,-49083,-49084,-49085,-49086,-49087,
+-49088,-49089,-49090,-49091,-49092,-49093,-49094,-49095,-49096,-49097,-49098,-49099,-49100,-49101,-49102,-49103,
+-49104,-49105,-49106,-49107,-49108,-49109,-49110,-49111,-49112,-49113,-49114,-49115,-49116,-49117,-49118,-49119,
+-49120,-49121,-49122,-49123,-49124,-49125,-49126,-49127,-49128,-49129,-49130,-49131,-49132,-49133,-49134,-49135,
+-49136,-49137,-49138,-49139,-49140,-49141,-49142,-49143,-49144,-49145,-49146,-49147,-49148,-49149,-49150,-49151,
+-49152,-49153,-49154,-49155,-49156,-49157,-49158,-49159,-49160,-49161,-49162,-49163,-49164,-49165,-49166,-49167,
+-49168,-49169,-49170,-49171,-49172,-49173,-49174,-49175,-49176,-49177,-49178,-49179,-49180,-49181,-49182,-49183,
+-49184,-49185,-49186,-49187,-49188,-49189,-49190,-49191,-49192,-49193,-49194,-49195,-49196,-49197,-49198,-49199,
+-49200,-49201,-49202,-49203,-49204,-49205,-49206,-49207,-49208,-49209,-49210,-49211,-49212,-49213,-49214,-49215,
+-49216,-49217,-49218,-49219,-49220,-49221,-49222,-49223,-49224,-49225,-49226,-49227,-49228,-49229,-49230,-49231,
+-49232,-49233,-49234,-49235,-49236,-49237,-49238,-49239,-49240,-49241,-49242,-49243,-49244,-49245,-49246,-49247,
+-49248,-49249,-49250,-49251,-49252,-49253,-49254,-49255,-49256,-49257,-49258,-49259,-49260,-49261,-49262,-49263,
+-49264,-49265,-49266,-49267,-49268,-49269,-49270,-49271,-49272,-49273,-49274,-49275,-49276,-49277,-49278,-49279,
+-49280,-49281,-49282,-49283,-49284,-49285,-49286,-49287,-49288,-49289,-49290,-49291,-49292,-49293,-49294,-49295,
+-49296,-49297,-49298,-49299,-49300,-49301,-49302,-49303,-49304,-49305,-49306,-49307,-49308,-49309,-49310,-49311,
+-49312,-49313,-49314,-49315,-49316,-49317,-49318,-49319,-49320,-49321,-49322,-49323,-49324,-49325,-49326,-49327,
+-49328,-49329,-49330,-49331,-49332,-49333,-49334,-49335,-49336,-49337,-49338,-49339,-49340,-49341,-49342,-49343,
+-49344,-49345,-49346,-49347,-49348,-49349,-49350,-49351,-49352,-49353,-49354,-49355,-49356,-49357,-49358,-49359,
+-49360,-49361,-49362,-49363,-49364,-49365,-49366,-49367,-49368,-49369,-49370,-49371,-49372,-49373,-49374,-49375,
+-49376,-49377,-49378,-49379,-49380,-49381,-49382,-49383,-49384,-49385,-49386,-49387,-49388,-49389,-49390,-49391,
+-49392,-49393,-49394,-49395,-49396,-49397,-49398,-49399,-49400,-49401,-49402,-49403,-49404,-49405,-49406,-49407,
+-49408,-49409,-49410,-49411,-49412,-49413,-49414,-49415,-49416,-49417,-49418,-49419,-49420,-49421,-49422,-49423,
+-49424,-49425,-49426,-49427,-49428,-49429,-49430,-49431,-49432,-49433,-49434,-49435,-49436,-49437,-49438,-49439,
+-49440,-49441,-49442,-49443,-49444,-49445,-49446,-49447,-49448,-49449,-49450,-49451,-49452,-49453,-49454,-49455,
+-49456,-49457,-49458,-49459,-49460,-49461,-49462,-49463,-49464,-49465,-49466,-49467,-49468,-49469,-49470,-49471,
+-49472,-49473,-49474,-49475,-49476,-49477,-49478,-49479,-49480,-49481,-49482,-49483,-49484,-49485,-49486,-49487,
+-49488,-49489,-49490,-49491,-49492,-49493,-49494,-49495,-49496,-49497,-49498,-49499,-49500,-49501,-49502,-49503,
+-49504,-49505,-49506,-49507,-49508,-49509,-49510,-49511,-49512,-49513,-49514,-49515,-49516,-49517,-49518,-49519,
+-49520,-49521,-49522,-49523,-49524,-49525,-49526,-49527,-49528,-49529,-49530,-49531,-49532,-49533,-49534,-49535,
+-49536,-49537,-49538,-49539,-49540,-49541,-49542,-49543,-49544,-49545,-49546,-49547,-49548,-49549,-49550,-49551,
+-49552,-49553,-49554,-49555,-49556,-49557,-49558,-49559,-49560,-49561,-49562,-49563,-49564,-49565,-49566,-49567,
+-49568,-49569,-49570,-49571,-49572,-49573,-49574,-49575,-49576,-49577,-49578,-49579,-49580,-49581,-49582,-49583,
+-49584,-49585,-49586,-49587,-49588,-49589,-49590,-49591,-49592,-49593,-49594,-49595,-49596,-49597,-49598,-49599,
+-49600,-49601,-49602,-49603,-49604,-49605,-49606,-49607,-49608,-49609,-49610,-49611,-49612,-49613,-49614,-49615,
+-49616,-49617,-49618,-49619,-49620,-49621,-49622,-49623,-49624,-49625,-49626,-49627,-49628,-49629,-49630,-49631,
+-49632,-49633,-49634,-49635,-49636,-49637,-49638,-49639,-49640,-49641,-49642,-49643,-49644,-49645,-49646,-49647,
+-49648,-49649,-49650,-49651,-49652,-49653,-49654,-49655,-49656,-49657,-49658,-49659,-49659,-49660,-49661,-49662,
+-49663,-49664,-49665,-49666,-49667,-49668,-49669,-49670,-49671,-49672,-49673,-49674,-49675,-49676,-49677,-49678,
+-49679,-49680,-49681,-49682,-49683,-49684,-49685,-49686,-49687,-49688,-49689,-49690,-49691,-49692,-49693,-49694,
+-49695,-49696,-49697,-49698,-49699,-49700,-49701,-49702,-49703,-49704,-49705,-49706,-49707,-49708,-49709,-49710,
+-49711,-49712,-49713,-49714,-49715,-49716,-49717,-49718,-49719,-49720,-49721,-49722,-49723,-49724,-49725,-49726,
+-49727,-49728,-49729,-49730,-49731,-49732,-49733,-49734,-49735,-49736,-49737,-49738,-49739,-49740,-49741,-49742,
+-49743,-49744,-49745,-49746,-49747,-49748,-49749,-49750,-49751,-49752,-49753,-49754,-49755,-49756,-49757,-49758,
+-49759,-49760,-49761,-49762,-49763,-49764,-49765,-49766,-49767,-49768,-49769,-49770,-49771,-49772,-49773,-49774,
+-49775,-49776,-49777,-49778,-49779,-49780,-49781,-49782,-49783,-49784,-49785,-49786,-49787,-49788,-49789,-49790,
+-49791,-49792,-49793,-49794,-49795,-49796,-49797,-49798,-49799,-49800,-49801,-49802,-49803,-49804,-49805,-49806,
+-49807,-49808,-49809,-49810,-49811,-49812,-49813,-49814,-49815,-49816,-49817,-49818,-49819,-49820,-49821,-49822,
+-49823,-49824,-49825,-49826,-49827,-49828,-49829,-49830,-49831,-49832,-49833,-49834,-49835,-49836,-49837,-49838,
+-49839,-49840,-49841,-49842,-49843,-49844,-49845,-49846,-49847,-49848,-49849,-49850,-49851,-49852,-49853,-49854,
+-49855,-49856,-49857,-49858,-49859,-49860,-49861,-49862,-49863,-49864,-49865,-49866,-49867,-49868,-49869,-49870,
+-49871,-49872,-49873,-49874,-49875,-49876,-49877,-49878,-49879,-49880,-49881,-49882,-49883,-49884,-49885,-49886,
+-49887,-49888,-49889,-49890,-49891,-49892,-49893,-49894,-49895,-49896,-49897,-49898,-49899,-49900,-49901,-49902,
+-49903,-49904,-49905,-49906,-49907,-49908,-49909,-49910,-49911,-49912,-49913,-49914,-49915,-49916,-49917,-49918,
+-49919,-49920,-49921,-49922,-49923,-49924,-49925,-49926,-49927,-49928,-49929,-49930,-49931,-49932,-49933,-49934,
+-49935,-49936,-49937,-49938,-49939,-49940,-49941,-49942,-49943,-49944,-49945,-49946,-49947,-49948,-49949,-49950,
+-49951,-49952,-49953,-49954,-49955,-49956,-49957,-49958,-49959,-49960,-49961,-49962,-49963,-49964,-49965,-49966,
+-49967,-49968,-49969,-49970,-49971,-49972,-49973,-49974,-49975,-49976,-49977,-49978,-49979,-49980,-49981,-49982,
+-49983,-49984,-49985,-49986,-49987,-49988,-49989,-49990,-49991,-49992,-49993,-49994,-49995,-49996,-49997,-49998,
+-49999,-50000,-50001,-50002,-50003,-50004,-50005,-50006,-50007,-50008,-50009,-50010,-50011,-50012,-50013,-50014,
+-50015,-50016,-50017,-50018,-50019,-50020,-50021,-50022,-50023,-50024,-50025,-50026,-50027,-50028,-50029,-50030,
+-50031,-50032,-50033,-50034,-50035,-50036,-50037,-50038,-50039,-50040,-50041,-50042,-50043,-50044,-50045,-50046,
+-50047,-50048,-50049,-50050,-50051,-50052,-50053,-50054,-50055,-50056,-50057,-50058,-50059,-50060,-50061,-50062,
+-50063,-50064,-50065,-50066,-50067,-50068,-50069,-50070,-50071,-50072,-50073,-50074,-50075,-50076,-50077,-50078,
+-50079,-50080,-50081,-50082,-50083,-50084,-50085,-50086,-50087,-50088,-50089,-50090,-50091,-50092,-50093,-50094,
+-50095,-50096,-50097,-50098,-50099,-50100,-50101,-50102,-50103,-50104,-50105,-50106,-50107,-50108,-50109,-50110,
+-50111,-50112,-50113,-50114,-50115,-50116,-50117,-50118,-50119,-50120,-50121,-50122,-50123,-50124,-50125,-50126,
+-50127,-50128,-50129,-50130,-50131,-50132,-50133,-50134,-50135,-50136,-50137,-50138,-50139,-50140,-50141,-50142,
+-50143,-50144,-50145,-50146,-50147,-50148,-50149,-50150,-50151,-50152,-50153,-50154,-50155,-50156,-50157,-50158,
+-50159,-50160,-50161,-50162,-50163,-50164,-50165,-50166,-50167,-50168,-50169,-50170,-50171,-50172,-50173,-50174,
+-50175,-50176,-50177,-50178,-50179,-50180,-50181,-50182,-50183,-50184,-50185,-50186,-50187,-50188,-50189,-50190,
+-50191,-50192,-50193,-50194,-50195,-50196,-50197,-50198,-50199,-50200,-50201,-50202,-50203,-50204,-50205,-50206,
+-50207,-50208,-50209,-50210,-50211,-50212,-50213,-50214,-50215,-50216,-50217,-50218,-50219,-50220,-50221,-50222,
+-50223,-50224,-50225,-50226,-50227,-50228,-50229,-50230,-50231,-50232,-50233,-50234,-50235,-50236,-50237,-50238,
+-50239,-50240,-50241,-50242,-50243,-50244,-50245,-50246,-50246,-50247,-50248,-50249,-50250,-50251,-50252,-50253,
+-50254,-50255,-50256,-50257,-50258,-50259,-50260,-50261,-50262,-50263,-50264,-50265,-50266,-50267,-50268,-50269,
+-50270,-50271,-50272,-50273,-50274,-50275,-50276,-50277,-50278,-50279,-50280,-50281,-50282,-50283,-50284,-50285,
+-50286,-50287,-50288,-50289,-50290,-50291,-50292,-50293,-50294,-50295,-50296,-50297,-50298,-50299,-50300,-50301,
+-50302,-50303,-50304,-50305,-50306,-50307,-50308,-50309,-50310,-50311,-50312,-50313,-50314,-50315,-50316,-50317,
+-50318,-50319,-50320,-50321,-50322,-50323,-50324,-50325,-50326,-50327,-50328,-50329,-50330,-50331,-50332,-50333,
+-50334,-50335,-50336,-50337,-50338,-50339,-50340,-50341,-50342,-50343,-50344,-50345,-50346,-50347,-50348,-50349,
+-50350,-50351,-50352,-50353,-50354,-50355,-50356,-50357,-50358,-50359,-50360,-50361,-50362,-50363,-50364,-50365,
+-50366,-50367,-50368,-50369,-50370,-50371,-50372,-50373,-50374,-50375,-50376,-50377,-50378,-50379,-50380,-50381,
+-50382,-50383,-50384,-50385,-50386,-50387,-50388,-50389,-50390,-50391,-50392,-50393,-50394,-50395,-50396,-50397,
+-50398,-50399,-50400,-50401,-50402,-50403,-50404,-50405,-50406,-50407,-50408,-50409,-50410,-50411,-50412,-50413,
+-50414,-50415,-50416,-50417,-50418,-50419,-50420,-50421,-50422,-50423,-50424,-50425,-50426,-50427,-50428,-50429,
+-50430,-50431,-50432,-50433,-50434,-50435,-50436,-50437,-50438,-50439,-50440,-50441,-50442,-50443,-50444,-50445,
+-50446,-50447,-50448,-50449,-50450,-50451,-50452,-50453,-50454,-50455,-50456,-50457,-50458,-50459,-50460,-50461,
+-50462,-50463,-50464,-50465,-50466,-50467,-50468,-50469,-50470,-50471,-50472,-50473,-50474,-50475,-50476,-50477,
+-50478,-50479,-50480,-50481,-50482,-50483,-50484,-50485,-50486,-50487,-50488,-50489,-50490,-50491,-50492,-50493,
+-50494,-50495,-50496,-50497,-50498,-50499,-50500,-50501,-50502,-50503,-50504,-50505,-50506,-50507,-50508,-50509,
+-50510,-50511,-50512,-50513,-50514,-50515,-50516,-50517,-50518,-50519,-50520,-50521,-50522,-50523,-50524,-50525,
+-50526,-50527,-50528,-50529,-50530,-50531,-50532,-50533,-50534,-50535,-50536,-50537,-50538,-50539,-50540,-50541,
+-50542,-50543,-50544,-50545,-50546,-50547,-50548,-50549,-50550,-50551,-50552,-50553,-50554,-50555,-50556,-50557,
+-50558,-50559,-50560,-50561,-50562,-50563,-50564,-50565,-50566,-50567,-50568,-50569,-50570,-50571,-50572,-50573,
+-50574,-50575,-50576,-50577,-50578,-50579,-50580,-50581,-50582,-50583,-50584,-50585,-50586,-50587,-50588,-50589,
+-50590,-50591,-50592,-50593,-50594,-50595,-50596,-50597,-50598,-50599,-50600,-50601,-50602,-50603,-50604,-50605,
+-50606,-50607,-50608,-50609,-50610,-50611,-50612,-50613,-50614,-50615,-50616,-50617,-50618,-50619,-50620,-50621,
+-50622,-50623,-50624,-50625,-50626,-50627,-50628,-50629,-50630,-50631,-50632,-50633,-50634,-50635,-50636,-50637,
+-50638,-50639,-50640,-50641,-50642,-50643,-50644,-50645,-50646,-50647,-50648,-50649,-50650,-50651,-50652,-50653,
+-50654,-50655,-50656,-50657,-50658,-50659,-50660,-50661,-50662,-50663,-50664,-50665,-50666,-50667,-50668,-50669,
+-50670,-50671,-50672,-50673,-50674,-50675,-50676,-50677,-50678,-50679,-50680,-50681,-50682,-50683,-50684,-50685,
+-50686,-50687,-50688,-50689,-50690,-50691,-50692,-50693,-50694,-50695,-50696,-50697,-50698,-50699,-50700,-50701,
+-50702,-50703,-50704,-50705,-50706,-50707,-50708,-50709,-50710,-50711,-50712,-50713,-50714,-50715,-50716,-50717,
+-50718,-50719,-50720,-50721,-50722,-50723,-50724,-50725,-50726,-50727,-50728,-50729,-50730,-50731,-50732,-50733,
+-50734,-50735,-50736,-50737,-50738,-50739,-50740,-50741,-50742,-50743,-50744,-50745,-50746,-50747,-50748,-50749,
+-50750,-50751,-50752,-50753,-50754,-50755,-50756,-50757,-50758,-50759,-50760,-50761,-50762,-50763,-50764,-50765,
+-50766,-50767,-50768,-50769,-50770,-50771,-50772,-50773,-50774,-50775,-50776,-50777,-50778,-50779,-50780,-50781,
+-50782,-50783,-50784,-50785,-50786,-50787,-50788,-50789,-50790,-50791,-50792,-50793,-50794,-50795,-50796,-50797,
+-50798,-50799,-50800,-50801,-50802,-50803,-50804,-50805,-50806,-50807,-50808,-50809,-50810,-50811,-50812,-50813,
+-50814,-50815,-50816,-50817,-50818,-50819,-50820,-50821,-50822,-50823,-50824,-50825,-50826,-50827,-50828,-50829,
+-50830,-50831,-50832,-50833,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-27832,-37389,-27192,-27707,-35379,-43731,-42273,-22891,-22892,-40888,-26425,-41860,-40900,-38679,-33445,-31114,
+-29393,-29015,-28698,-26756,-36626,-35834,-34877,-34105,-29915,-26543,-24361,-43673,-42407,-36377,-34563,-29426,
+-23298,-39889,-35127,-29526,-28608,-38492,-30542,-28936,-39518,-37394,-35776,-34351,-26718,-43431,-42871,-42577,
+-37996,-36446,-34594,-33356,-31027,-29487,-29402,-27464,-25094,-24010,-23360,-32943,-32701,-31645,-30069,-26171,
+-23233,-28267,-41059,-39487,-31972,-30919,-34532,-32893,-27782,-25170,-41074,-40169,-36665,-35699,-35391,-31776,
+-31513,-25350,-42624,-30920,-42872,-42889,-32570,-31641,-30055,-25316,-28122,-38540,-36698,-28255,-43813,-40312,
+-39246,-34266,-33778,-42572,-32873,-43430,-39357,-43866,-35996,-37873,-31816,-42408,-41230,-33388,-29989,-28357,
+-36278,-27073,-36074,-38517,-30351,-38357,-33809,-43721,-43023,-42928,-37113,-31892,-30477,-28331,-26543,-42634,
+-42302,-40974,-39574,-37822,-35206,-32859,-25561,-24349,-23281,-23227,-42735,-37573,-36373,-27179,-39706,-38911,
+-38800,-38135,-35439,-34890,-34059,-32715,-31650,-31016,-27250,-29867,-26999,-26193,-42885,-42746,-42209,-35031,
+-28894,-28407,-39641,-39342,-38441,-36343,-32104,-34354,-43716,-41648,-40387,-39921,-39312,-34299,-34117,-31253,
+-31082,-26493,-25276,-25195,-24988,-43562,-32776,-26627,-25344,-39128,-43828,-43233,-40398,-40318,-37925,-36797,
+-34802,-33663,-29894,-26951,-23095,-37693,-25496,-42814,-37453,-37334,-35977,-35631,-34243,-33908,-33123,-31935,
+-24946,-43108,-38820,-25435,-43433,-40124,-35820,-27309,-39501,-39061,-37315,-34388,-25430,-42932,-42447,-40314,
+-37837,-37523,-37178,-36094,-34270,-33795,-31341,-28952,-28935,-26653,-25352,-42668,-35634,-42448,-34846,-34135,
+-29686,-25422,-23963,-23380,-37469,-35882,-30734,-32556,-32472,-32103,-34618,-35170,-28324,-43837,-30408,-42949,
+-43001,-39771,-38703,-32045,-40575,-36071,-37714,-27340,-29116,-25532,-28799,-39736,-43212,-42061,0,0,
+-41398,0,-37790,0,0,-43063,-34540,-33613,-32988,-32955,-32949,-32908,-25286,-32095,-31329,0,
+-29710,0,-28458,0,0,-27117,-26921,0,0,0,-24891,-24879,-24836,-23673,-26960,-25464,
+-43650,-43338,-43237,-42858,-42832,-42724,-42137,-42033,-41936,-41465,-41362,-40407,-40398,-39337,-39126,-39089,
+-38990,-38130,-37984,-37810,-37311,-36046,-35884,-35621,-35034,-34846,-34344,-33210,-33038,-33028,-33030,-33023,
+-33018,-33012,-32965,-32965,-32788,-32724,-32406,-31843,-31823,-31768,-31464,-31318,-30831,-30692,-30693,-30216,
+-29008,-28875,-28513,-28458,-28049,-27997,-27312,-27183,-25477,-25194,-25135,-39414,84098,-30805,0,0,
+-44106,-43196,-43274,-43763,-43311,-43253,-42927,-42877,-42203,-42276,-42209,-42137,-41506,-41418,-41274,-41259,
+-40990,-40793,-39856,-39850,-39707,-39640,-39342,-39225,-39296,-39163,-39210,-39065,-39000,-38601,-38514,-38461,
+-38202,-37917,-37755,-37752,-37694,-36636,-36572,-36182,-35773,-35790,-35704,-35453,-35118,-33526,-34921,-34800,
+-34678,-34352,-34204,-34152,-33927,-33926,-33756,-33740,-33716,-33631,-33642,-33247,-32763,-32493,-32307,-32084,
+-31932,-31603,-31405,-30561,-30405,-29500,-29045,-28977,-28962,-28666,-28610,-28656,-28603,-28607,-28625,-28550,
+-28470,-28089,-27530,-27217,-26923,-26703,-25674,-25572,-25458,-25326,-25291,-25280,-25233,-24507,-23346,77179,
+77172,80132,-48949,-47803,-47771,87924,90618,99324,-23445,-23371,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,-62788,0,-62765,
+0,0,0,0,0,0,0,0,0,0,-62785,-62786,-62787,-62788,-62814,-62815,
+-62816,-62816,-62816,-62816,-62816,-62816,-62816,0,-62816,-62816,-62816,-62816,-62816,0,-62816,0,
+-62816,-62816,0,-62816,-62816,0,-62816,-62816,-62816,-62816,-62816,-62838,-62843,-62834,-62826,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-1,0,-1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,-6,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,-4,-5,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,-2,-3,0,-5,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,-2,-2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,-3,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,-7,-7,
+-8,-9,-10,-11,-12,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,-2,-2,-4,-4,-6,
+-6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+-174531,-174537,-174529,-63201,-174244,-174167,-174155,-174085,-173966,-173936,-173859,-173884,-181102,-61907,-173761,-173755,
+-173740,-173722,-62198,-181082,-173741,-173704,-62155,-173696,-173684,-174413,-173678,-173670,-26173,-173608,-173595,-181056,
+-173541,-173531,-173488,-173484,-181007,-173406,-173405,-173379,-173358,-173348,-173348,-173332,-173283,-173276,-173268,-173244,
+-173235,-173234,-173235,-173236,-60936,-165829,-173164,-173144,-60629,-173134,-173129,-173109,-172958,-173061,-173046,-173015,
+-172958,-172875,-172850,-172784,-172769,-172737,-172738,-172718,-172701,-172694,-172680,-172341,-172614,-172342,-172541,-172507,
+-173641,-171875,-172164,-172127,-172103,-172234,-172068,-172070,-171948,-58229,-171880,-171876,-171862,-171843,-171836,-171773,
+-57784,-57719,-171638,-171592,-171581,-171661,-171520,-180601,-180588,-171361,-171308,-171309,-56996,-171178,-171158,-171144,
+-171133,-56665,-171123,-171117,-170273,-171091,-180469,-171031,-171018,-170937,-170989,-55959,-170809,-55959,-170768,-170772,
+-170756,-170656,-170656,-180308,-170631,-170589,-170569,-170526,-180262,-55046,-180238,-170459,-170457,-170455,-170436,-21757,
+-170386,-54624,-54625,-161426,-170354,-170355,-180175,-50655,-38590,-170295,-170287,-180152,-170242,-170192,-170183,-170150,
+-170015,-180071,-180102,-169999,-53712,-169950,-169822,-169819,-169818,-169821,-169776,-169757,-169722,-169737,-169727,-169681,
+-169662,-169659,-169634,-169624,-169559,-169476,-169442,-169319,-52652,-169340,-169406,-169299,-169273,-169177,-52429,-169117,
+-169211,-169240,-179860,-169050,-169030,-169000,-169039,-179803,-168825,-168797,-51392,-168680,-168404,-168580,-179637,-168510,
+-179656,-179693,-173888,-173886,-168404,-168505,-161833,-177406,-168385,-168382,-168377,-168317,-168329,-50458,-179605,-168165,
+-168283,-168079,-168029,-50294,-168022,-168134,-167890,-179530,-167846,-167750,-167680,-167491,-49737,-167442,-179414,-167374,
+-49225,-167325,-179364,-167297,-167253,-167227,-167227,-48746,-56301,-48639,-167084,-48191,-166973,-166960,-167063,-166889,
+-166850,-166794,-166849,-166810,-166796,-166784,-48104,-166867,-166617,-166555,-179159,-166464,-166469,-47676,-166677,-166305,
+-47538,-47491,-166220,-166106,-166134,-166138,-179072,-166093,-166043,-166050,-165997,-62454,-165847,-46778,-165762,-46452,
+-165624,-165612,-165586,-45851,-165540,-165520,-45553,-45331,-165294,-165278,-178814,-165254,-178804,-178805,-165095,-165075,
+-165055,-165036,-164968,-178712,-164880,-44287,-164856,-44197,-164808,-55194,-164650,-43418,-43396,-43257,-178498,-178487,
+-164428,-43086,-43088,-43050,-43025,-164391,-164391,-164392,-164350,-178448,-164287,-178437,-178358,-42288,-164096,-164035,
+-163972,-178286,-41772,-163837,-41658,-41616,-163783,-163692,-178217,-163609,-163600,-163596,-40928,-40630,-40631,-163441,
+-178014,-40374,-163228,-163226,-177981,-40165,-162964,-177863,-162944,-162950,-162922,-39397,-162825,-177772,-162727,-162669,
+-162603,-177725,-38730,-38700,-177691,-38556,-162300,-38457,-162275,-162175,-162165,-38049,-37977,-162077,-37846,-162063,
+-50721,-177580,-162000,-161920,-177529,-161863,-171729,-37344,-37331,-50678,-50670,-161674,-161672,-158191,-177443,-161534,
+-161541,-161524,-173791,-161506,-161505,-161496,-161456,-36443,-161459,-161404,-161335,-161262,-161401,-161248,-161207,-161096,
+-161357,-161239,-161238,-161223,-36206,-35898,-36049,-177276,-160951,-160950,-160916,-34273,-160840,-35457,-177233,-177230,
+-35327,-35039,-177223,-160611,-160600,-160590,-160589,-160526,-160560,-160427,-160472,-160322,-160404,-160338,-160312,-177128,
+-160223,-160192,-177097,-160099,-160097,-33630,-159983,-159977,-177043,-159951,-181519,-33053,-32870,-176911,-176903,-159535,
+-159459,-159303,-159101,-32043,-159017,-158996,-158907,-158816,-31401,-61909,-158735,-158751,-158700,-61695,-158474,-158375,
+-29710,-29684,-158030,-157938,-157907,-29367,-157899,-157615,-157457,-157457,-157550,-157170,-157143,-28147,-156771,-176218,
+-156729,-27770,-176140,-156464,-171074,-156370,-26801,-26589,-176010,-176003,-156186,-26097,-175946,-25959,-156147,-156148,
+-156119,-25675,-155936,-175824,-155867,-155742,-155716,-155657,-175674,-24281,-155384,-155083,-154895,-175423,-175393,-154792,
+-22850,-175385,-22797,-22533,-22403,-154458,-175296,-154398,-154394,-154388,-154379,-154373,-154337,-21533,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+} // namespace nanotokenizer
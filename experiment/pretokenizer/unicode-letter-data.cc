@@ -0,0 +1,2544 @@
+// generated with gen-unicode-letter-data.py. DO NOT EDIT.
+// Unicode 14.0.0. 2533 ranges.
+
+#include "unicode-data.hh"
+
+namespace nanotokenizer {
+
+const std::initializer_list<std::pair<uint32_t, uint8_t>> unicode_ranges_letter_type = {  // start, letter type // last=next_start-1
+{0x000000, 0},
+{0x000041, 1},
+{0x00005B, 0},
+{0x000061, 2},
+{0x00007B, 0},
+{0x0000AA, 5},
+{0x0000AB, 0},
+{0x0000B5, 2},
+{0x0000B6, 0},
+{0x0000BA, 5},
+{0x0000BB, 0},
+{0x0000C0, 1},
+{0x0000D7, 0},
+{0x0000D8, 1},
+{0x0000DF, 2},
+{0x0000F7, 0},
+{0x0000F8, 2},
+{0x000100, 1},
+{0x000101, 2},
+{0x000102, 1},
+{0x000103, 2},
+{0x000104, 1},
+{0x000105, 2},
+{0x000106, 1},
+{0x000107, 2},
+{0x000108, 1},
+{0x000109, 2},
+{0x00010A, 1},
+{0x00010B, 2},
+{0x00010C, 1},
+{0x00010D, 2},
+{0x00010E, 1},
+{0x00010F, 2},
+{0x000110, 1},
+{0x000111, 2},
+{0x000112, 1},
+{0x000113, 2},
+{0x000114, 1},
+{0x000115, 2},
+{0x000116, 1},
+{0x000117, 2},
+{0x000118, 1},
+{0x000119, 2},
+{0x00011A, 1},
+{0x00011B, 2},
+{0x00011C, 1},
+{0x00011D, 2},
+{0x00011E, 1},
+{0x00011F, 2},
+{0x000120, 1},
+{0x000121, 2},
+{0x000122, 1},
+{0x000123, 2},
+{0x000124, 1},
+{0x000125, 2},
+{0x000126, 1},
+{0x000127, 2},
+{0x000128, 1},
+{0x000129, 2},
+{0x00012A, 1},
+{0x00012B, 2},
+{0x00012C, 1},
+{0x00012D, 2},
+{0x00012E, 1},
+{0x00012F, 2},
+{0x000130, 1},
+{0x000131, 2},
+{0x000132, 1},
+{0x000133, 2},
+{0x000134, 1},
+{0x000135, 2},
+{0x000136, 1},
+{0x000137, 2},
+{0x000139, 1},
+{0x00013A, 2},
+{0x00013B, 1},
+{0x00013C, 2},
+{0x00013D, 1},
+{0x00013E, 2},
+{0x00013F, 1},
+{0x000140, 2},
+{0x000141, 1},
+{0x000142, 2},
+{0x000143, 1},
+{0x000144, 2},
+{0x000145, 1},
+{0x000146, 2},
+{0x000147, 1},
+{0x000148, 2},
+{0x00014A, 1},
+{0x00014B, 2},
+{0x00014C, 1},
+{0x00014D, 2},
+{0x00014E, 1},
+{0x00014F, 2},
+{0x000150, 1},
+{0x000151, 2},
+{0x000152, 1},
+{0x000153, 2},
+{0x000154, 1},
+{0x000155, 2},
+{0x000156, 1},
+{0x000157, 2},
+{0x000158, 1},
+{0x000159, 2},
+{0x00015A, 1},
+{0x00015B, 2},
+{0x00015C, 1},
+{0x00015D, 2},
+{0x00015E, 1},
+{0x00015F, 2},
+{0x000160, 1},
+{0x000161, 2},
+{0x000162, 1},
+{0x000163, 2},
+{0x000164, 1},
+{0x000165, 2},
+{0x000166, 1},
+{0x000167, 2},
+{0x000168, 1},
+{0x000169, 2},
+{0x00016A, 1},
+{0x00016B, 2},
+{0x00016C, 1},
+{0x00016D, 2},
+{0x00016E, 1},
+{0x00016F, 2},
+{0x000170, 1},
+{0x000171, 2},
+{0x000172, 1},
+{0x000173, 2},
+{0x000174, 1},
+{0x000175, 2},
+{0x000176, 1},
+{0x000177, 2},
+{0x000178, 1},
+{0x00017A, 2},
+{0x00017B, 1},
+{0x00017C, 2},
+{0x00017D, 1},
+{0x00017E, 2},
+{0x000181, 1},
+{0x000183, 2},
+{0x000184, 1},
+{0x000185, 2},
+{0x000186, 1},
+{0x000188, 2},
+{0x000189, 1},
+{0x00018C, 2},
+{0x00018E, 1},
+{0x000192, 2},
+{0x000193, 1},
+{0x000195, 2},
+{0x000196, 1},
+{0x000199, 2},
+{0x00019C, 1},
+{0x00019E, 2},
+{0x00019F, 1},
+{0x0001A1, 2},
+{0x0001A2, 1},
+{0x0001A3, 2},
+{0x0001A4, 1},
+{0x0001A5, 2},
+{0x0001A6, 1},
+{0x0001A8, 2},
+{0x0001A9, 1},
+{0x0001AA, 2},
+{0x0001AC, 1},
+{0x0001AD, 2},
+{0x0001AE, 1},
+{0x0001B0, 2},
+{0x0001B1, 1},
+{0x0001B4, 2},
+{0x0001B5, 1},
+{0x0001B6, 2},
+{0x0001B7, 1},
+{0x0001B9, 2},
+{0x0001BB, 5},
+{0x0001BC, 1},
+{0x0001BD, 2},
+{0x0001C0, 5},
+{0x0001C4, 1},
+{0x0001C5, 3},
+{0x0001C6, 2},
+{0x0001C7, 1},
+{0x0001C8, 3},
+{0x0001C9, 2},
+{0x0001CA, 1},
+{0x0001CB, 3},
+{0x0001CC, 2},
+{0x0001CD, 1},
+{0x0001CE, 2},
+{0x0001CF, 1},
+{0x0001D0, 2},
+{0x0001D1, 1},
+{0x0001D2, 2},
+{0x0001D3, 1},
+{0x0001D4, 2},
+{0x0001D5, 1},
+{0x0001D6, 2},
+{0x0001D7, 1},
+{0x0001D8, 2},
+{0x0001D9, 1},
+{0x0001DA, 2},
+{0x0001DB, 1},
+{0x0001DC, 2},
+{0x0001DE, 1},
+{0x0001DF, 2},
+{0x0001E0, 1},
+{0x0001E1, 2},
+{0x0001E2, 1},
+{0x0001E3, 2},
+{0x0001E4, 1},
+{0x0001E5, 2},
+{0x0001E6, 1},
+{0x0001E7, 2},
+{0x0001E8, 1},
+{0x0001E9, 2},
+{0x0001EA, 1},
+{0x0001EB, 2},
+{0x0001EC, 1},
+{0x0001ED, 2},
+{0x0001EE, 1},
+{0x0001EF, 2},
+{0x0001F1, 1},
+{0x0001F2, 3},
+{0x0001F3, 2},
+{0x0001F4, 1},
+{0x0001F5, 2},
+{0x0001F6, 1},
+{0x0001F9, 2},
+{0x0001FA, 1},
+{0x0001FB, 2},
+{0x0001FC, 1},
+{0x0001FD, 2},
+{0x0001FE, 1},
+{0x0001FF, 2},
+{0x000200, 1},
+{0x000201, 2},
+{0x000202, 1},
+{0x000203, 2},
+{0x000204, 1},
+{0x000205, 2},
+{0x000206, 1},
+{0x000207, 2},
+{0x000208, 1},
+{0x000209, 2},
+{0x00020A, 1},
+{0x00020B, 2},
+{0x00020C, 1},
+{0x00020D, 2},
+{0x00020E, 1},
+{0x00020F, 2},
+{0x000210, 1},
+{0x000211, 2},
+{0x000212, 1},
+{0x000213, 2},
+{0x000214, 1},
+{0x000215, 2},
+{0x000216, 1},
+{0x000217, 2},
+{0x000218, 1},
+{0x000219, 2},
+{0x00021A, 1},
+{0x00021B, 2},
+{0x00021C, 1},
+{0x00021D, 2},
+{0x00021E, 1},
+{0x00021F, 2},
+{0x000220, 1},
+{0x000221, 2},
+{0x000222, 1},
+{0x000223, 2},
+{0x000224, 1},
+{0x000225, 2},
+{0x000226, 1},
+{0x000227, 2},
+{0x000228, 1},
+{0x000229, 2},
+{0x00022A, 1},
+{0x00022B, 2},
+{0x00022C, 1},
+{0x00022D, 2},
+{0x00022E, 1},
+{0x00022F, 2},
+{0x000230, 1},
+{0x000231, 2},
+{0x000232, 1},
+{0x000233, 2},
+{0x00023A, 1},
+{0x00023C, 2},
+{0x00023D, 1},
+{0x00023F, 2},
+{0x000241, 1},
+{0x000242, 2},
+{0x000243, 1},
+{0x000247, 2},
+{0x000248, 1},
+{0x000249, 2},
+{0x00024A, 1},
+{0x00024B, 2},
+{0x00024C, 1},
+{0x00024D, 2},
+{0x00024E, 1},
+{0x00024F, 2},
+{0x000294, 5},
+{0x000295, 2},
+{0x0002B0, 4},
+{0x0002C2, 0},
+{0x0002C6, 4},
+{0x0002D2, 0},
+{0x0002E0, 4},
+{0x0002E5, 0},
+{0x0002EC, 4},
+{0x0002ED, 0},
+{0x0002EE, 4},
+{0x0002EF, 0},
+{0x000370, 1},
+{0x000371, 2},
+{0x000372, 1},
+{0x000373, 2},
+{0x000374, 4},
+{0x000375, 0},
+{0x000376, 1},
+{0x000377, 2},
+{0x000378, 0},
+{0x00037A, 4},
+{0x00037B, 2},
+{0x00037E, 0},
+{0x00037F, 1},
+{0x000380, 0},
+{0x000386, 1},
+{0x000387, 0},
+{0x000388, 1},
+{0x00038B, 0},
+{0x00038C, 1},
+{0x00038D, 0},
+{0x00038E, 1},
+{0x000390, 2},
+{0x000391, 1},
+{0x0003A2, 0},
+{0x0003A3, 1},
+{0x0003AC, 2},
+{0x0003CF, 1},
+{0x0003D0, 2},
+{0x0003D2, 1},
+{0x0003D5, 2},
+{0x0003D8, 1},
+{0x0003D9, 2},
+{0x0003DA, 1},
+{0x0003DB, 2},
+{0x0003DC, 1},
+{0x0003DD, 2},
+{0x0003DE, 1},
+{0x0003DF, 2},
+{0x0003E0, 1},
+{0x0003E1, 2},
+{0x0003E2, 1},
+{0x0003E3, 2},
+{0x0003E4, 1},
+{0x0003E5, 2},
+{0x0003E6, 1},
+{0x0003E7, 2},
+{0x0003E8, 1},
+{0x0003E9, 2},
+{0x0003EA, 1},
+{0x0003EB, 2},
+{0x0003EC, 1},
+{0x0003ED, 2},
+{0x0003EE, 1},
+{0x0003EF, 2},
+{0x0003F4, 1},
+{0x0003F5, 2},
+{0x0003F6, 0},
+{0x0003F7, 1},
+{0x0003F8, 2},
+{0x0003F9, 1},
+{0x0003FB, 2},
+{0x0003FD, 1},
+{0x000430, 2},
+{0x000460, 1},
+{0x000461, 2},
+{0x000462, 1},
+{0x000463, 2},
+{0x000464, 1},
+{0x000465, 2},
+{0x000466, 1},
+{0x000467, 2},
+{0x000468, 1},
+{0x000469, 2},
+{0x00046A, 1},
+{0x00046B, 2},
+{0x00046C, 1},
+{0x00046D, 2},
+{0x00046E, 1},
+{0x00046F, 2},
+{0x000470, 1},
+{0x000471, 2},
+{0x000472, 1},
+{0x000473, 2},
+{0x000474, 1},
+{0x000475, 2},
+{0x000476, 1},
+{0x000477, 2},
+{0x000478, 1},
+{0x000479, 2},
+{0x00047A, 1},
+{0x00047B, 2},
+{0x00047C, 1},
+{0x00047D, 2},
+{0x00047E, 1},
+{0x00047F, 2},
+{0x000480, 1},
+{0x000481, 2},
+{0x000482, 0},
+{0x00048A, 1},
+{0x00048B, 2},
+{0x00048C, 1},
+{0x00048D, 2},
+{0x00048E, 1},
+{0x00048F, 2},
+{0x000490, 1},
+{0x000491, 2},
+{0x000492, 1},
+{0x000493, 2},
+{0x000494, 1},
+{0x000495, 2},
+{0x000496, 1},
+{0x000497, 2},
+{0x000498, 1},
+{0x000499, 2},
+{0x00049A, 1},
+{0x00049B, 2},
+{0x00049C, 1},
+{0x00049D, 2},
+{0x00049E, 1},
+{0x00049F, 2},
+{0x0004A0, 1},
+{0x0004A1, 2},
+{0x0004A2, 1},
+{0x0004A3, 2},
+{0x0004A4, 1},
+{0x0004A5, 2},
+{0x0004A6, 1},
+{0x0004A7, 2},
+{0x0004A8, 1},
+{0x0004A9, 2},
+{0x0004AA, 1},
+{0x0004AB, 2},
+{0x0004AC, 1},
+{0x0004AD, 2},
+{0x0004AE, 1},
+{0x0004AF, 2},
+{0x0004B0, 1},
+{0x0004B1, 2},
+{0x0004B2, 1},
+{0x0004B3, 2},
+{0x0004B4, 1},
+{0x0004B5, 2},
+{0x0004B6, 1},
+{0x0004B7, 2},
+{0x0004B8, 1},
+{0x0004B9, 2},
+{0x0004BA, 1},
+{0x0004BB, 2},
+{0x0004BC, 1},
+{0x0004BD, 2},
+{0x0004BE, 1},
+{0x0004BF, 2},
+{0x0004C0, 1},
+{0x0004C2, 2},
+{0x0004C3, 1},
+{0x0004C4, 2},
+{0x0004C5, 1},
+{0x0004C6, 2},
+{0x0004C7, 1},
+{0x0004C8, 2},
+{0x0004C9, 1},
+{0x0004CA, 2},
+{0x0004CB, 1},
+{0x0004CC, 2},
+{0x0004CD, 1},
+{0x0004CE, 2},
+{0x0004D0, 1},
+{0x0004D1, 2},
+{0x0004D2, 1},
+{0x0004D3, 2},
+{0x0004D4, 1},
+{0x0004D5, 2},
+{0x0004D6, 1},
+{0x0004D7, 2},
+{0x0004D8, 1},
+{0x0004D9, 2},
+{0x0004DA, 1},
+{0x0004DB, 2},
+{0x0004DC, 1},
+{0x0004DD, 2},
+{0x0004DE, 1},
+{0x0004DF, 2},
+{0x0004E0, 1},
+{0x0004E1, 2},
+{0x0004E2, 1},
+{0x0004E3, 2},
+{0x0004E4, 1},
+{0x0004E5, 2},
+{0x0004E6, 1},
+{0x0004E7, 2},
+{0x0004E8, 1},
+{0x0004E9, 2},
+{0x0004EA, 1},
+{0x0004EB, 2},
+{0x0004EC, 1},
+{0x0004ED, 2},
+{0x0004EE, 1},
+{0x0004EF, 2},
+{0x0004F0, 1},
+{0x0004F1, 2},
+{0x0004F2, 1},
+{0x0004F3, 2},
+{0x0004F4, 1},
+{0x0004F5, 2},
+{0x0004F6, 1},
+{0x0004F7, 2},
+{0x0004F8, 1},
+{0x0004F9, 2},
+{0x0004FA, 1},
+{0x0004FB, 2},
+{0x0004FC, 1},
+{0x0004FD, 2},
+{0x0004FE, 1},
+{0x0004FF, 2},
+{0x000500, 1},
+{0x000501, 2},
+{0x000502, 1},
+{0x000503, 2},
+{0x000504, 1},
+{0x000505, 2},
+{0x000506, 1},
+{0x000507, 2},
+{0x000508, 1},
+{0x000509, 2},
+{0x00050A, 1},
+{0x00050B, 2},
+{0x00050C, 1},
+{0x00050D, 2},
+{0x00050E, 1},
+{0x00050F, 2},
+{0x000510, 1},
+{0x000511, 2},
+{0x000512, 1},
+{0x000513, 2},
+{0x000514, 1},
+{0x000515, 2},
+{0x000516, 1},
+{0x000517, 2},
+{0x000518, 1},
+{0x000519, 2},
+{0x00051A, 1},
+{0x00051B, 2},
+{0x00051C, 1},
+{0x00051D, 2},
+{0x00051E, 1},
+{0x00051F, 2},
+{0x000520, 1},
+{0x000521, 2},
+{0x000522, 1},
+{0x000523, 2},
+{0x000524, 1},
+{0x000525, 2},
+{0x000526, 1},
+{0x000527, 2},
+{0x000528, 1},
+{0x000529, 2},
+{0x00052A, 1},
+{0x00052B, 2},
+{0x00052C, 1},
+{0x00052D, 2},
+{0x00052E, 1},
+{0x00052F, 2},
+{0x000530, 0},
+{0x000531, 1},
+{0x000557, 0},
+{0x000559, 4},
+{0x00055A, 0},
+{0x000560, 2},
+{0x000589, 0},
+{0x0005D0, 5},
+{0x0005EB, 0},
+{0x0005EF, 5},
+{0x0005F3, 0},
+{0x000620, 5},
+{0x000640, 4},
+{0x000641, 5},
+{0x00064B, 0},
+{0x00066E, 5},
+{0x000670, 0},
+{0x000671, 5},
+{0x0006D4, 0},
+{0x0006D5, 5},
+{0x0006D6, 0},
+{0x0006E5, 4},
+{0x0006E7, 0},
+{0x0006EE, 5},
+{0x0006F0, 0},
+{0x0006FA, 5},
+{0x0006FD, 0},
+{0x0006FF, 5},
+{0x000700, 0},
+{0x000710, 5},
+{0x000711, 0},
+{0x000712, 5},
+{0x000730, 0},
+{0x00074D, 5},
+{0x0007A6, 0},
+{0x0007B1, 5},
+{0x0007B2, 0},
+{0x0007CA, 5},
+{0x0007EB, 0},
+{0x0007F4, 4},
+{0x0007F6, 0},
+{0x0007FA, 4},
+{0x0007FB, 0},
+{0x000800, 5},
+{0x000816, 0},
+{0x00081A, 4},
+{0x00081B, 0},
+{0x000824, 4},
+{0x000825, 0},
+{0x000828, 4},
+{0x000829, 0},
+{0x000840, 5},
+{0x000859, 0},
+{0x000860, 5},
+{0x00086B, 0},
+{0x000870, 5},
+{0x000888, 0},
+{0x000889, 5},
+{0x00088F, 0},
+{0x0008A0, 5},
+{0x0008C9, 4},
+{0x0008CA, 0},
+{0x000904, 5},
+{0x00093A, 0},
+{0x00093D, 5},
+{0x00093E, 0},
+{0x000950, 5},
+{0x000951, 0},
+{0x000958, 5},
+{0x000962, 0},
+{0x000971, 4},
+{0x000972, 5},
+{0x000981, 0},
+{0x000985, 5},
+{0x00098D, 0},
+{0x00098F, 5},
+{0x000991, 0},
+{0x000993, 5},
+{0x0009A9, 0},
+{0x0009AA, 5},
+{0x0009B1, 0},
+{0x0009B2, 5},
+{0x0009B3, 0},
+{0x0009B6, 5},
+{0x0009BA, 0},
+{0x0009BD, 5},
+{0x0009BE, 0},
+{0x0009CE, 5},
+{0x0009CF, 0},
+{0x0009DC, 5},
+{0x0009DE, 0},
+{0x0009DF, 5},
+{0x0009E2, 0},
+{0x0009F0, 5},
+{0x0009F2, 0},
+{0x0009FC, 5},
+{0x0009FD, 0},
+{0x000A05, 5},
+{0x000A0B, 0},
+{0x000A0F, 5},
+{0x000A11, 0},
+{0x000A13, 5},
+{0x000A29, 0},
+{0x000A2A, 5},
+{0x000A31, 0},
+{0x000A32, 5},
+{0x000A34, 0},
+{0x000A35, 5},
+{0x000A37, 0},
+{0x000A38, 5},
+{0x000A3A, 0},
+{0x000A59, 5},
+{0x000A5D, 0},
+{0x000A5E, 5},
+{0x000A5F, 0},
+{0x000A72, 5},
+{0x000A75, 0},
+{0x000A85, 5},
+{0x000A8E, 0},
+{0x000A8F, 5},
+{0x000A92, 0},
+{0x000A93, 5},
+{0x000AA9, 0},
+{0x000AAA, 5},
+{0x000AB1, 0},
+{0x000AB2, 5},
+{0x000AB4, 0},
+{0x000AB5, 5},
+{0x000ABA, 0},
+{0x000ABD, 5},
+{0x000ABE, 0},
+{0x000AD0, 5},
+{0x000AD1, 0},
+{0x000AE0, 5},
+{0x000AE2, 0},
+{0x000AF9, 5},
+{0x000AFA, 0},
+{0x000B05, 5},
+{0x000B0D, 0},
+{0x000B0F, 5},
+{0x000B11, 0},
+{0x000B13, 5},
+{0x000B29, 0},
+{0x000B2A, 5},
+{0x000B31, 0},
+{0x000B32, 5},
+{0x000B34, 0},
+{0x000B35, 5},
+{0x000B3A, 0},
+{0x000B3D, 5},
+{0x000B3E, 0},
+{0x000B5C, 5},
+{0x000B5E, 0},
+{0x000B5F, 5},
+{0x000B62, 0},
+{0x000B71, 5},
+{0x000B72, 0},
+{0x000B83, 5},
+{0x000B84, 0},
+{0x000B85, 5},
+{0x000B8B, 0},
+{0x000B8E, 5},
+{0x000B91, 0},
+{0x000B92, 5},
+{0x000B96, 0},
+{0x000B99, 5},
+{0x000B9B, 0},
+{0x000B9C, 5},
+{0x000B9D, 0},
+{0x000B9E, 5},
+{0x000BA0, 0},
+{0x000BA3, 5},
+{0x000BA5, 0},
+{0x000BA8, 5},
+{0x000BAB, 0},
+{0x000BAE, 5},
+{0x000BBA, 0},
+{0x000BD0, 5},
+{0x000BD1, 0},
+{0x000C05, 5},
+{0x000C0D, 0},
+{0x000C0E, 5},
+{0x000C11, 0},
+{0x000C12, 5},
+{0x000C29, 0},
+{0x000C2A, 5},
+{0x000C3A, 0},
+{0x000C3D, 5},
+{0x000C3E, 0},
+{0x000C58, 5},
+{0x000C5B, 0},
+{0x000C5D, 5},
+{0x000C5E, 0},
+{0x000C60, 5},
+{0x000C62, 0},
+{0x000C80, 5},
+{0x000C81, 0},
+{0x000C85, 5},
+{0x000C8D, 0},
+{0x000C8E, 5},
+{0x000C91, 0},
+{0x000C92, 5},
+{0x000CA9, 0},
+{0x000CAA, 5},
+{0x000CB4, 0},
+{0x000CB5, 5},
+{0x000CBA, 0},
+{0x000CBD, 5},
+{0x000CBE, 0},
+{0x000CDD, 5},
+{0x000CDF, 0},
+{0x000CE0, 5},
+{0x000CE2, 0},
+{0x000CF1, 5},
+{0x000CF3, 0},
+{0x000D04, 5},
+{0x000D0D, 0},
+{0x000D0E, 5},
+{0x000D11, 0},
+{0x000D12, 5},
+{0x000D3B, 0},
+{0x000D3D, 5},
+{0x000D3E, 0},
+{0x000D4E, 5},
+{0x000D4F, 0},
+{0x000D54, 5},
+{0x000D57, 0},
+{0x000D5F, 5},
+{0x000D62, 0},
+{0x000D7A, 5},
+{0x000D80, 0},
+{0x000D85, 5},
+{0x000D97, 0},
+{0x000D9A, 5},
+{0x000DB2, 0},
+{0x000DB3, 5},
+{0x000DBC, 0},
+{0x000DBD, 5},
+{0x000DBE, 0},
+{0x000DC0, 5},
+{0x000DC7, 0},
+{0x000E01, 5},
+{0x000E31, 0},
+{0x000E32, 5},
+{0x000E34, 0},
+{0x000E40, 5},
+{0x000E46, 4},
+{0x000E47, 0},
+{0x000E81, 5},
+{0x000E83, 0},
+{0x000E84, 5},
+{0x000E85, 0},
+{0x000E86, 5},
+{0x000E8B, 0},
+{0x000E8C, 5},
+{0x000EA4, 0},
+{0x000EA5, 5},
+{0x000EA6, 0},
+{0x000EA7, 5},
+{0x000EB1, 0},
+{0x000EB2, 5},
+{0x000EB4, 0},
+{0x000EBD, 5},
+{0x000EBE, 0},
+{0x000EC0, 5},
+{0x000EC5, 0},
+{0x000EC6, 4},
+{0x000EC7, 0},
+{0x000EDC, 5},
+{0x000EE0, 0},
+{0x000F00, 5},
+{0x000F01, 0},
+{0x000F40, 5},
+{0x000F48, 0},
+{0x000F49, 5},
+{0x000F6D, 0},
+{0x000F88, 5},
+{0x000F8D, 0},
+{0x001000, 5},
+{0x00102B, 0},
+{0x00103F, 5},
+{0x001040, 0},
+{0x001050, 5},
+{0x001056, 0},
+{0x00105A, 5},
+{0x00105E, 0},
+{0x001061, 5},
+{0x001062, 0},
+{0x001065, 5},
+{0x001067, 0},
+{0x00106E, 5},
+{0x001071, 0},
+{0x001075, 5},
+{0x001082, 0},
+{0x00108E, 5},
+{0x00108F, 0},
+{0x0010A0, 1},
+{0x0010C6, 0},
+{0x0010C7, 1},
+{0x0010C8, 0},
+{0x0010CD, 1},
+{0x0010CE, 0},
+{0x0010D0, 2},
+{0x0010FB, 0},
+{0x0010FC, 4},
+{0x0010FD, 2},
+{0x001100, 5},
+{0x001249, 0},
+{0x00124A, 5},
+{0x00124E, 0},
+{0x001250, 5},
+{0x001257, 0},
+{0x001258, 5},
+{0x001259, 0},
+{0x00125A, 5},
+{0x00125E, 0},
+{0x001260, 5},
+{0x001289, 0},
+{0x00128A, 5},
+{0x00128E, 0},
+{0x001290, 5},
+{0x0012B1, 0},
+{0x0012B2, 5},
+{0x0012B6, 0},
+{0x0012B8, 5},
+{0x0012BF, 0},
+{0x0012C0, 5},
+{0x0012C1, 0},
+{0x0012C2, 5},
+{0x0012C6, 0},
+{0x0012C8, 5},
+{0x0012D7, 0},
+{0x0012D8, 5},
+{0x001311, 0},
+{0x001312, 5},
+{0x001316, 0},
+{0x001318, 5},
+{0x00135B, 0},
+{0x001380, 5},
+{0x001390, 0},
+{0x0013A0, 1},
+{0x0013F6, 0},
+{0x0013F8, 2},
+{0x0013FE, 0},
+{0x001401, 5},
+{0x00166D, 0},
+{0x00166F, 5},
+{0x001680, 0},
+{0x001681, 5},
+{0x00169B, 0},
+{0x0016A0, 5},
+{0x0016EB, 0},
+{0x0016F1, 5},
+{0x0016F9, 0},
+{0x001700, 5},
+{0x001712, 0},
+{0x00171F, 5},
+{0x001732, 0},
+{0x001740, 5},
+{0x001752, 0},
+{0x001760, 5},
+{0x00176D, 0},
+{0x00176E, 5},
+{0x001771, 0},
+{0x001780, 5},
+{0x0017B4, 0},
+{0x0017D7, 4},
+{0x0017D8, 0},
+{0x0017DC, 5},
+{0x0017DD, 0},
+{0x001820, 5},
+{0x001843, 4},
+{0x001844, 5},
+{0x001879, 0},
+{0x001880, 5},
+{0x001885, 0},
+{0x001887, 5},
+{0x0018A9, 0},
+{0x0018AA, 5},
+{0x0018AB, 0},
+{0x0018B0, 5},
+{0x0018F6, 0},
+{0x001900, 5},
+{0x00191F, 0},
+{0x001950, 5},
+{0x00196E, 0},
+{0x001970, 5},
+{0x001975, 0},
+{0x001980, 5},
+{0x0019AC, 0},
+{0x0019B0, 5},
+{0x0019CA, 0},
+{0x001A00, 5},
+{0x001A17, 0},
+{0x001A20, 5},
+{0x001A55, 0},
+{0x001AA7, 4},
+{0x001AA8, 0},
+{0x001B05, 5},
+{0x001B34, 0},
+{0x001B45, 5},
+{0x001B4D, 0},
+{0x001B83, 5},
+{0x001BA1, 0},
+{0x001BAE, 5},
+{0x001BB0, 0},
+{0x001BBA, 5},
+{0x001BE6, 0},
+{0x001C00, 5},
+{0x001C24, 0},
+{0x001C4D, 5},
+{0x001C50, 0},
+{0x001C5A, 5},
+{0x001C78, 4},
+{0x001C7E, 0},
+{0x001C80, 2},
+{0x001C89, 0},
+{0x001C90, 1},
+{0x001CBB, 0},
+{0x001CBD, 1},
+{0x001CC0, 0},
+{0x001CE9, 5},
+{0x001CED, 0},
+{0x001CEE, 5},
+{0x001CF4, 0},
+{0x001CF5, 5},
+{0x001CF7, 0},
+{0x001CFA, 5},
+{0x001CFB, 0},
+{0x001D00, 2},
+{0x001D2C, 4},
+{0x001D6B, 2},
+{0x001D78, 4},
+{0x001D79, 2},
+{0x001D9B, 4},
+{0x001DC0, 0},
+{0x001E00, 1},
+{0x001E01, 2},
+{0x001E02, 1},
+{0x001E03, 2},
+{0x001E04, 1},
+{0x001E05, 2},
+{0x001E06, 1},
+{0x001E07, 2},
+{0x001E08, 1},
+{0x001E09, 2},
+{0x001E0A, 1},
+{0x001E0B, 2},
+{0x001E0C, 1},
+{0x001E0D, 2},
+{0x001E0E, 1},
+{0x001E0F, 2},
+{0x001E10, 1},
+{0x001E11, 2},
+{0x001E12, 1},
+{0x001E13, 2},
+{0x001E14, 1},
+{0x001E15, 2},
+{0x001E16, 1},
+{0x001E17, 2},
+{0x001E18, 1},
+{0x001E19, 2},
+{0x001E1A, 1},
+{0x001E1B, 2},
+{0x001E1C, 1},
+{0x001E1D, 2},
+{0x001E1E, 1},
+{0x001E1F, 2},
+{0x001E20, 1},
+{0x001E21, 2},
+{0x001E22, 1},
+{0x001E23, 2},
+{0x001E24, 1},
+{0x001E25, 2},
+{0x001E26, 1},
+{0x001E27, 2},
+{0x001E28, 1},
+{0x001E29, 2},
+{0x001E2A, 1},
+{0x001E2B, 2},
+{0x001E2C, 1},
+{0x001E2D, 2},
+{0x001E2E, 1},
+{0x001E2F, 2},
+{0x001E30, 1},
+{0x001E31, 2},
+{0x001E32, 1},
+{0x001E33, 2},
+{0x001E34, 1},
+{0x001E35, 2},
+{0x001E36, 1},
+{0x001E37, 2},
+{0x001E38, 1},
+{0x001E39, 2},
+{0x001E3A, 1},
+{0x001E3B, 2},
+{0x001E3C, 1},
+{0x001E3D, 2},
+{0x001E3E, 1},
+{0x001E3F, 2},
+{0x001E40, 1},
+{0x001E41, 2},
+{0x001E42, 1},
+{0x001E43, 2},
+{0x001E44, 1},
+{0x001E45, 2},
+{0x001E46, 1},
+{0x001E47, 2},
+{0x001E48, 1},
+{0x001E49, 2},
+{0x001E4A, 1},
+{0x001E4B, 2},
+{0x001E4C, 1},
+{0x001E4D, 2},
+{0x001E4E, 1},
+{0x001E4F, 2},
+{0x001E50, 1},
+{0x001E51, 2},
+{0x001E52, 1},
+{0x001E53, 2},
+{0x001E54, 1},
+{0x001E55, 2},
+{0x001E56, 1},
+{0x001E57, 2},
+{0x001E58, 1},
+{0x001E59, 2},
+{0x001E5A, 1},
+{0x001E5B, 2},
+{0x001E5C, 1},
+{0x001E5D, 2},
+{0x001E5E, 1},
+{0x001E5F, 2},
+{0x001E60, 1},
+{0x001E61, 2},
+{0x001E62, 1},
+{0x001E63, 2},
+{0x001E64, 1},
+{0x001E65, 2},
+{0x001E66, 1},
+{0x001E67, 2},
+{0x001E68, 1},
+{0x001E69, 2},
+{0x001E6A, 1},
+{0x001E6B, 2},
+{0x001E6C, 1},
+{0x001E6D, 2},
+{0x001E6E, 1},
+{0x001E6F, 2},
+{0x001E70, 1},
+{0x001E71, 2},
+{0x001E72, 1},
+{0x001E73, 2},
+{0x001E74, 1},
+{0x001E75, 2},
+{0x001E76, 1},
+{0x001E77, 2},
+{0x001E78, 1},
+{0x001E79, 2},
+{0x001E7A, 1},
+{0x001E7B, 2},
+{0x001E7C, 1},
+{0x001E7D, 2},
+{0x001E7E, 1},
+{0x001E7F, 2},
+{0x001E80, 1},
+{0x001E81, 2},
+{0x001E82, 1},
+{0x001E83, 2},
+{0x001E84, 1},
+{0x001E85, 2},
+{0x001E86, 1},
+{0x001E87, 2},
+{0x001E88, 1},
+{0x001E89, 2},
+{0x001E8A, 1},
+{0x001E8B, 2},
+{0x001E8C, 1},
+{0x001E8D, 2},
+{0x001E8E, 1},
+{0x001E8F, 2},
+{0x001E90, 1},
+{0x001E91, 2},
+{0x001E92, 1},
+{0x001E93, 2},
+{0x001E94, 1},
+{0x001E95, 2},
+{0x001E9E, 1},
+{0x001E9F, 2},
+{0x001EA0, 1},
+{0x001EA1, 2},
+{0x001EA2, 1},
+{0x001EA3, 2},
+{0x001EA4, 1},
+{0x001EA5, 2},
+{0x001EA6, 1},
+{0x001EA7, 2},
+{0x001EA8, 1},
+{0x001EA9, 2},
+{0x001EAA, 1},
+{0x001EAB, 2},
+{0x001EAC, 1},
+{0x001EAD, 2},
+{0x001EAE, 1},
+{0x001EAF, 2},
+{0x001EB0, 1},
+{0x001EB1, 2},
+{0x001EB2, 1},
+{0x001EB3, 2},
+{0x001EB4, 1},
+{0x001EB5, 2},
+{0x001EB6, 1},
+{0x001EB7, 2},
+{0x001EB8, 1},
+{0x001EB9, 2},
+{0x001EBA, 1},
+{0x001EBB, 2},
+{0x001EBC, 1},
+{0x001EBD, 2},
+{0x001EBE, 1},
+{0x001EBF, 2},
+{0x001EC0, 1},
+{0x001EC1, 2},
+{0x001EC2, 1},
+{0x001EC3, 2},
+{0x001EC4, 1},
+{0x001EC5, 2},
+{0x001EC6, 1},
+{0x001EC7, 2},
+{0x001EC8, 1},
+{0x001EC9, 2},
+{0x001ECA, 1},
+{0x001ECB, 2},
+{0x001ECC, 1},
+{0x001ECD, 2},
+{0x001ECE, 1},
+{0x001ECF, 2},
+{0x001ED0, 1},
+{0x001ED1, 2},
+{0x001ED2, 1},
+{0x001ED3, 2},
+{0x001ED4, 1},
+{0x001ED5, 2},
+{0x001ED6, 1},
+{0x001ED7, 2},
+{0x001ED8, 1},
+{0x001ED9, 2},
+{0x001EDA, 1},
+{0x001EDB, 2},
+{0x001EDC, 1},
+{0x001EDD, 2},
+{0x001EDE, 1},
+{0x001EDF, 2},
+{0x001EE0, 1},
+{0x001EE1, 2},
+{0x001EE2, 1},
+{0x001EE3, 2},
+{0x001EE4, 1},
+{0x001EE5, 2},
+{0x001EE6, 1},
+{0x001EE7, 2},
+{0x001EE8, 1},
+{0x001EE9, 2},
+{0x001EEA, 1},
+{0x001EEB, 2},
+{0x001EEC, 1},
+{0x001EED, 2},
+{0x001EEE, 1},
+{0x001EEF, 2},
+{0x001EF0, 1},
+{0x001EF1, 2},
+{0x001EF2, 1},
+{0x001EF3, 2},
+{0x001EF4, 1},
+{0x001EF5, 2},
+{0x001EF6, 1},
+{0x001EF7, 2},
+{0x001EF8, 1},
+{0x001EF9, 2},
+{0x001EFA, 1},
+{0x001EFB, 2},
+{0x001EFC, 1},
+{0x001EFD, 2},
+{0x001EFE, 1},
+{0x001EFF, 2},
+{0x001F08, 1},
+{0x001F10, 2},
+{0x001F16, 0},
+{0x001F18, 1},
+{0x001F1E, 0},
+{0x001F20, 2},
+{0x001F28, 1},
+{0x001F30, 2},
+{0x001F38, 1},
+{0x001F40, 2},
+{0x001F46, 0},
+{0x001F48, 1},
+{0x001F4E, 0},
+{0x001F50, 2},
+{0x001F58, 0},
+{0x001F59, 1},
+{0x001F5A, 0},
+{0x001F5B, 1},
+{0x001F5C, 0},
+{0x001F5D, 1},
+{0x001F5E, 0},
+{0x001F5F, 1},
+{0x001F60, 2},
+{0x001F68, 1},
+{0x001F70, 2},
+{0x001F7E, 0},
+{0x001F80, 2},
+{0x001F88, 3},
+{0x001F90, 2},
+{0x001F98, 3},
+{0x001FA0, 2},
+{0x001FA8, 3},
+{0x001FB0, 2},
+{0x001FB5, 0},
+{0x001FB6, 2},
+{0x001FB8, 1},
+{0x001FBC, 3},
+{0x001FBD, 0},
+{0x001FBE, 2},
+{0x001FBF, 0},
+{0x001FC2, 2},
+{0x001FC5, 0},
+{0x001FC6, 2},
+{0x001FC8, 1},
+{0x001FCC, 3},
+{0x001FCD, 0},
+{0x001FD0, 2},
+{0x001FD4, 0},
+{0x001FD6, 2},
+{0x001FD8, 1},
+{0x001FDC, 0},
+{0x001FE0, 2},
+{0x001FE8, 1},
+{0x001FED, 0},
+{0x001FF2, 2},
+{0x001FF5, 0},
+{0x001FF6, 2},
+{0x001FF8, 1},
+{0x001FFC, 3},
+{0x001FFD, 0},
+{0x002071, 4},
+{0x002072, 0},
+{0x00207F, 4},
+{0x002080, 0},
+{0x002090, 4},
+{0x00209D, 0},
+{0x002102, 1},
+{0x002103, 0},
+{0x002107, 1},
+{0x002108, 0},
+{0x00210A, 2},
+{0x00210B, 1},
+{0x00210E, 2},
+{0x002110, 1},
+{0x002113, 2},
+{0x002114, 0},
+{0x002115, 1},
+{0x002116, 0},
+{0x002119, 1},
+{0x00211E, 0},
+{0x002124, 1},
+{0x002125, 0},
+{0x002126, 1},
+{0x002127, 0},
+{0x002128, 1},
+{0x002129, 0},
+{0x00212A, 1},
+{0x00212E, 0},
+{0x00212F, 2},
+{0x002130, 1},
+{0x002134, 2},
+{0x002135, 5},
+{0x002139, 2},
+{0x00213A, 0},
+{0x00213C, 2},
+{0x00213E, 1},
+{0x002140, 0},
+{0x002145, 1},
+{0x002146, 2},
+{0x00214A, 0},
+{0x00214E, 2},
+{0x00214F, 0},
+{0x002183, 1},
+{0x002184, 2},
+{0x002185, 0},
+{0x002C00, 1},
+{0x002C30, 2},
+{0x002C60, 1},
+{0x002C61, 2},
+{0x002C62, 1},
+{0x002C65, 2},
+{0x002C67, 1},
+{0x002C68, 2},
+{0x002C69, 1},
+{0x002C6A, 2},
+{0x002C6B, 1},
+{0x002C6C, 2},
+{0x002C6D, 1},
+{0x002C71, 2},
+{0x002C72, 1},
+{0x002C73, 2},
+{0x002C75, 1},
+{0x002C76, 2},
+{0x002C7C, 4},
+{0x002C7E, 1},
+{0x002C81, 2},
+{0x002C82, 1},
+{0x002C83, 2},
+{0x002C84, 1},
+{0x002C85, 2},
+{0x002C86, 1},
+{0x002C87, 2},
+{0x002C88, 1},
+{0x002C89, 2},
+{0x002C8A, 1},
+{0x002C8B, 2},
+{0x002C8C, 1},
+{0x002C8D, 2},
+{0x002C8E, 1},
+{0x002C8F, 2},
+{0x002C90, 1},
+{0x002C91, 2},
+{0x002C92, 1},
+{0x002C93, 2},
+{0x002C94, 1},
+{0x002C95, 2},
+{0x002C96, 1},
+{0x002C97, 2},
+{0x002C98, 1},
+{0x002C99, 2},
+{0x002C9A, 1},
+{0x002C9B, 2},
+{0x002C9C, 1},
+{0x002C9D, 2},
+{0x002C9E, 1},
+{0x002C9F, 2},
+{0x002CA0, 1},
+{0x002CA1, 2},
+{0x002CA2, 1},
+{0x002CA3, 2},
+{0x002CA4, 1},
+{0x002CA5, 2},
+{0x002CA6, 1},
+{0x002CA7, 2},
+{0x002CA8, 1},
+{0x002CA9, 2},
+{0x002CAA, 1},
+{0x002CAB, 2},
+{0x002CAC, 1},
+{0x002CAD, 2},
+{0x002CAE, 1},
+{0x002CAF, 2},
+{0x002CB0, 1},
+{0x002CB1, 2},
+{0x002CB2, 1},
+{0x002CB3, 2},
+{0x002CB4, 1},
+{0x002CB5, 2},
+{0x002CB6, 1},
+{0x002CB7, 2},
+{0x002CB8, 1},
+{0x002CB9, 2},
+{0x002CBA, 1},
+{0x002CBB, 2},
+{0x002CBC, 1},
+{0x002CBD, 2},
+{0x002CBE, 1},
+{0x002CBF, 2},
+{0x002CC0, 1},
+{0x002CC1, 2},
+{0x002CC2, 1},
+{0x002CC3, 2},
+{0x002CC4, 1},
+{0x002CC5, 2},
+{0x002CC6, 1},
+{0x002CC7, 2},
+{0x002CC8, 1},
+{0x002CC9, 2},
+{0x002CCA, 1},
+{0x002CCB, 2},
+{0x002CCC, 1},
+{0x002CCD, 2},
+{0x002CCE, 1},
+{0x002CCF, 2},
+{0x002CD0, 1},
+{0x002CD1, 2},
+{0x002CD2, 1},
+{0x002CD3, 2},
+{0x002CD4, 1},
+{0x002CD5, 2},
+{0x002CD6, 1},
+{0x002CD7, 2},
+{0x002CD8, 1},
+{0x002CD9, 2},
+{0x002CDA, 1},
+{0x002CDB, 2},
+{0x002CDC, 1},
+{0x002CDD, 2},
+{0x002CDE, 1},
+{0x002CDF, 2},
+{0x002CE0, 1},
+{0x002CE1, 2},
+{0x002CE2, 1},
+{0x002CE3, 2},
+{0x002CE5, 0},
+{0x002CEB, 1},
+{0x002CEC, 2},
+{0x002CED, 1},
+{0x002CEE, 2},
+{0x002CEF, 0},
+{0x002CF2, 1},
+{0x002CF3, 2},
+{0x002CF4, 0},
+{0x002D00, 2},
+{0x002D26, 0},
+{0x002D27, 2},
+{0x002D28, 0},
+{0x002D2D, 2},
+{0x002D2E, 0},
+{0x002D30, 5},
+{0x002D68, 0},
+{0x002D6F, 4},
+{0x002D70, 0},
+{0x002D80, 5},
+{0x002D97, 0},
+{0x002DA0, 5},
+{0x002DA7, 0},
+{0x002DA8, 5},
+{0x002DAF, 0},
+{0x002DB0, 5},
+{0x002DB7, 0},
+{0x002DB8, 5},
+{0x002DBF, 0},
+{0x002DC0, 5},
+{0x002DC7, 0},
+{0x002DC8, 5},
+{0x002DCF, 0},
+{0x002DD0, 5},
+{0x002DD7, 0},
+{0x002DD8, 5},
+{0x002DDF, 0},
+{0x002E2F, 4},
+{0x002E30, 0},
+{0x003005, 4},
+{0x003006, 5},
+{0x003007, 0},
+{0x003031, 4},
+{0x003036, 0},
+{0x00303B, 4},
+{0x00303C, 5},
+{0x00303D, 0},
+{0x003041, 5},
+{0x003097, 0},
+{0x00309D, 4},
+{0x00309F, 5},
+{0x0030A0, 0},
+{0x0030A1, 5},
+{0x0030FB, 0},
+{0x0030FC, 4},
+{0x0030FF, 5},
+{0x003100, 0},
+{0x003105, 5},
+{0x003130, 0},
+{0x003131, 5},
+{0x00318F, 0},
+{0x0031A0, 5},
+{0x0031C0, 0},
+{0x0031F0, 5},
+{0x003200, 0},
+{0x003400, 5},
+{0x004DC0, 0},
+{0x004E00, 5},
+{0x00A015, 4},
+{0x00A016, 5},
+{0x00A48D, 0},
+{0x00A4D0, 5},
+{0x00A4F8, 4},
+{0x00A4FE, 0},
+{0x00A500, 5},
+{0x00A60C, 4},
+{0x00A60D, 0},
+{0x00A610, 5},
+{0x00A620, 0},
+{0x00A62A, 5},
+{0x00A62C, 0},
+{0x00A640, 1},
+{0x00A641, 2},
+{0x00A642, 1},
+{0x00A643, 2},
+{0x00A644, 1},
+{0x00A645, 2},
+{0x00A646, 1},
+{0x00A647, 2},
+{0x00A648, 1},
+{0x00A649, 2},
+{0x00A64A, 1},
+{0x00A64B, 2},
+{0x00A64C, 1},
+{0x00A64D, 2},
+{0x00A64E, 1},
+{0x00A64F, 2},
+{0x00A650, 1},
+{0x00A651, 2},
+{0x00A652, 1},
+{0x00A653, 2},
+{0x00A654, 1},
+{0x00A655, 2},
+{0x00A656, 1},
+{0x00A657, 2},
+{0x00A658, 1},
+{0x00A659, 2},
+{0x00A65A, 1},
+{0x00A65B, 2},
+{0x00A65C, 1},
+{0x00A65D, 2},
+{0x00A65E, 1},
+{0x00A65F, 2},
+{0x00A660, 1},
+{0x00A661, 2},
+{0x00A662, 1},
+{0x00A663, 2},
+{0x00A664, 1},
+{0x00A665, 2},
+{0x00A666, 1},
+{0x00A667, 2},
+{0x00A668, 1},
+{0x00A669, 2},
+{0x00A66A, 1},
+{0x00A66B, 2},
+{0x00A66C, 1},
+{0x00A66D, 2},
+{0x00A66E, 5},
+{0x00A66F, 0},
+{0x00A67F, 4},
+{0x00A680, 1},
+{0x00A681, 2},
+{0x00A682, 1},
+{0x00A683, 2},
+{0x00A684, 1},
+{0x00A685, 2},
+{0x00A686, 1},
+{0x00A687, 2},
+{0x00A688, 1},
+{0x00A689, 2},
+{0x00A68A, 1},
+{0x00A68B, 2},
+{0x00A68C, 1},
+{0x00A68D, 2},
+{0x00A68E, 1},
+{0x00A68F, 2},
+{0x00A690, 1},
+{0x00A691, 2},
+{0x00A692, 1},
+{0x00A693, 2},
+{0x00A694, 1},
+{0x00A695, 2},
+{0x00A696, 1},
+{0x00A697, 2},
+{0x00A698, 1},
+{0x00A699, 2},
+{0x00A69A, 1},
+{0x00A69B, 2},
+{0x00A69C, 4},
+{0x00A69E, 0},
+{0x00A6A0, 5},
+{0x00A6E6, 0},
+{0x00A717, 4},
+{0x00A720, 0},
+{0x00A722, 1},
+{0x00A723, 2},
+{0x00A724, 1},
+{0x00A725, 2},
+{0x00A726, 1},
+{0x00A727, 2},
+{0x00A728, 1},
+{0x00A729, 2},
+{0x00A72A, 1},
+{0x00A72B, 2},
+{0x00A72C, 1},
+{0x00A72D, 2},
+{0x00A72E, 1},
+{0x00A72F, 2},
+{0x00A732, 1},
+{0x00A733, 2},
+{0x00A734, 1},
+{0x00A735, 2},
+{0x00A736, 1},
+{0x00A737, 2},
+{0x00A738, 1},
+{0x00A739, 2},
+{0x00A73A, 1},
+{0x00A73B, 2},
+{0x00A73C, 1},
+{0x00A73D, 2},
+{0x00A73E, 1},
+{0x00A73F, 2},
+{0x00A740, 1},
+{0x00A741, 2},
+{0x00A742, 1},
+{0x00A743, 2},
+{0x00A744, 1},
+{0x00A745, 2},
+{0x00A746, 1},
+{0x00A747, 2},
+{0x00A748, 1},
+{0x00A749, 2},
+{0x00A74A, 1},
+{0x00A74B, 2},
+{0x00A74C, 1},
+{0x00A74D, 2},
+{0x00A74E, 1},
+{0x00A74F, 2},
+{0x00A750, 1},
+{0x00A751, 2},
+{0x00A752, 1},
+{0x00A753, 2},
+{0x00A754, 1},
+{0x00A755, 2},
+{0x00A756, 1},
+{0x00A757, 2},
+{0x00A758, 1},
+{0x00A759, 2},
+{0x00A75A, 1},
+{0x00A75B, 2},
+{0x00A75C, 1},
+{0x00A75D, 2},
+{0x00A75E, 1},
+{0x00A75F, 2},
+{0x00A760, 1},
+{0x00A761, 2},
+{0x00A762, 1},
+{0x00A763, 2},
+{0x00A764, 1},
+{0x00A765, 2},
+{0x00A766, 1},
+{0x00A767, 2},
+{0x00A768, 1},
+{0x00A769, 2},
+{0x00A76A, 1},
+{0x00A76B, 2},
+{0x00A76C, 1},
+{0x00A76D, 2},
+{0x00A76E, 1},
+{0x00A76F, 2},
+{0x00A770, 4},
+{0x00A771, 2},
+{0x00A779, 1},
+{0x00A77A, 2},
+{0x00A77B, 1},
+{0x00A77C, 2},
+{0x00A77D, 1},
+{0x00A77F, 2},
+{0x00A780, 1},
+{0x00A781, 2},
+{0x00A782, 1},
+{0x00A783, 2},
+{0x00A784, 1},
+{0x00A785, 2},
+{0x00A786, 1},
+{0x00A787, 2},
+{0x00A788, 4},
+{0x00A789, 0},
+{0x00A78B, 1},
+{0x00A78C, 2},
+{0x00A78D, 1},
+{0x00A78E, 2},
+{0x00A78F, 5},
+{0x00A790, 1},
+{0x00A791, 2},
+{0x00A792, 1},
+{0x00A793, 2},
+{0x00A796, 1},
+{0x00A797, 2},
+{0x00A798, 1},
+{0x00A799, 2},
+{0x00A79A, 1},
+{0x00A79B, 2},
+{0x00A79C, 1},
+{0x00A79D, 2},
+{0x00A79E, 1},
+{0x00A79F, 2},
+{0x00A7A0, 1},
+{0x00A7A1, 2},
+{0x00A7A2, 1},
+{0x00A7A3, 2},
+{0x00A7A4, 1},
+{0x00A7A5, 2},
+{0x00A7A6, 1},
+{0x00A7A7, 2},
+{0x00A7A8, 1},
+{0x00A7A9, 2},
+{0x00A7AA, 1},
+{0x00A7AF, 2},
+{0x00A7B0, 1},
+{0x00A7B5, 2},
+{0x00A7B6, 1},
+{0x00A7B7, 2},
+{0x00A7B8, 1},
+{0x00A7B9, 2},
+{0x00A7BA, 1},
+{0x00A7BB, 2},
+{0x00A7BC, 1},
+{0x00A7BD, 2},
+{0x00A7BE, 1},
+{0x00A7BF, 2},
+{0x00A7C0, 1},
+{0x00A7C1, 2},
+{0x00A7C2, 1},
+{0x00A7C3, 2},
+{0x00A7C4, 1},
+{0x00A7C8, 2},
+{0x00A7C9, 1},
+{0x00A7CA, 2},
+{0x00A7CB, 0},
+{0x00A7D0, 1},
+{0x00A7D1, 2},
+{0x00A7D2, 0},
+{0x00A7D3, 2},
+{0x00A7D4, 0},
+{0x00A7D5, 2},
+{0x00A7D6, 1},
+{0x00A7D7, 2},
+{0x00A7D8, 1},
+{0x00A7D9, 2},
+{0x00A7DA, 0},
+{0x00A7F2, 4},
+{0x00A7F5, 1},
+{0x00A7F6, 2},
+{0x00A7F7, 5},
+{0x00A7F8, 4},
+{0x00A7FA, 2},
+{0x00A7FB, 5},
+{0x00A802, 0},
+{0x00A803, 5},
+{0x00A806, 0},
+{0x00A807, 5},
+{0x00A80B, 0},
+{0x00A80C, 5},
+{0x00A823, 0},
+{0x00A840, 5},
+{0x00A874, 0},
+{0x00A882, 5},
+{0x00A8B4, 0},
+{0x00A8F2, 5},
+{0x00A8F8, 0},
+{0x00A8FB, 5},
+{0x00A8FC, 0},
+{0x00A8FD, 5},
+{0x00A8FF, 0},
+{0x00A90A, 5},
+{0x00A926, 0},
+{0x00A930, 5},
+{0x00A947, 0},
+{0x00A960, 5},
+{0x00A97D, 0},
+{0x00A984, 5},
+{0x00A9B3, 0},
+{0x00A9CF, 4},
+{0x00A9D0, 0},
+{0x00A9E0, 5},
+{0x00A9E5, 0},
+{0x00A9E6, 4},
+{0x00A9E7, 5},
+{0x00A9F0, 0},
+{0x00A9FA, 5},
+{0x00A9FF, 0},
+{0x00AA00, 5},
+{0x00AA29, 0},
+{0x00AA40, 5},
+{0x00AA43, 0},
+{0x00AA44, 5},
+{0x00AA4C, 0},
+{0x00AA60, 5},
+{0x00AA70, 4},
+{0x00AA71, 5},
+{0x00AA77, 0},
+{0x00AA7A, 5},
+{0x00AA7B, 0},
+{0x00AA7E, 5},
+{0x00AAB0, 0},
+{0x00AAB1, 5},
+{0x00AAB2, 0},
+{0x00AAB5, 5},
+{0x00AAB7, 0},
+{0x00AAB9, 5},
+{0x00AABE, 0},
+{0x00AAC0, 5},
+{0x00AAC1, 0},
+{0x00AAC2, 5},
+{0x00AAC3, 0},
+{0x00AADB, 5},
+{0x00AADD, 4},
+{0x00AADE, 0},
+{0x00AAE0, 5},
+{0x00AAEB, 0},
+{0x00AAF2, 5},
+{0x00AAF3, 4},
+{0x00AAF5, 0},
+{0x00AB01, 5},
+{0x00AB07, 0},
+{0x00AB09, 5},
+{0x00AB0F, 0},
+{0x00AB11, 5},
+{0x00AB17, 0},
+{0x00AB20, 5},
+{0x00AB27, 0},
+{0x00AB28, 5},
+{0x00AB2F, 0},
+{0x00AB30, 2},
+{0x00AB5B, 0},
+{0x00AB5C, 4},
+{0x00AB60, 2},
+{0x00AB69, 4},
+{0x00AB6A, 0},
+{0x00AB70, 2},
+{0x00ABC0, 5},
+{0x00ABE3, 0},
+{0x00AC00, 5},
+{0x00D7A4, 0},
+{0x00D7B0, 5},
+{0x00D7C7, 0},
+{0x00D7CB, 5},
+{0x00D7FC, 0},
+{0x00F900, 5},
+{0x00FA6E, 0},
+{0x00FA70, 5},
+{0x00FADA, 0},
+{0x00FB00, 2},
+{0x00FB07, 0},
+{0x00FB13, 2},
+{0x00FB18, 0},
+{0x00FB1D, 5},
+{0x00FB1E, 0},
+{0x00FB1F, 5},
+{0x00FB29, 0},
+{0x00FB2A, 5},
+{0x00FB37, 0},
+{0x00FB38, 5},
+{0x00FB3D, 0},
+{0x00FB3E, 5},
+{0x00FB3F, 0},
+{0x00FB40, 5},
+{0x00FB42, 0},
+{0x00FB43, 5},
+{0x00FB45, 0},
+{0x00FB46, 5},
+{0x00FBB2, 0},
+{0x00FBD3, 5},
+{0x00FD3E, 0},
+{0x00FD50, 5},
+{0x00FD90, 0},
+{0x00FD92, 5},
+{0x00FDC8, 0},
+{0x00FDF0, 5},
+{0x00FDFC, 0},
+{0x00FE70, 5},
+{0x00FE75, 0},
+{0x00FE76, 5},
+{0x00FEFD, 0},
+{0x00FF21, 1},
+{0x00FF3B, 0},
+{0x00FF41, 2},
+{0x00FF5B, 0},
+{0x00FF66, 5},
+{0x00FF70, 4},
+{0x00FF71, 5},
+{0x00FF9E, 4},
+{0x00FFA0, 5},
+{0x00FFBF, 0},
+{0x00FFC2, 5},
+{0x00FFC8, 0},
+{0x00FFCA, 5},
+{0x00FFD0, 0},
+{0x00FFD2, 5},
+{0x00FFD8, 0},
+{0x00FFDA, 5},
+{0x00FFDD, 0},
+{0x010000, 5},
+{0x01000C, 0},
+{0x01000D, 5},
+{0x010027, 0},
+{0x010028, 5},
+{0x01003B, 0},
+{0x01003C, 5},
+{0x01003E, 0},
+{0x01003F, 5},
+{0x01004E, 0},
+{0x010050, 5},
+{0x01005E, 0},
+{0x010080, 5},
+{0x0100FB, 0},
+{0x010280, 5},
+{0x01029D, 0},
+{0x0102A0, 5},
+{0x0102D1, 0},
+{0x010300, 5},
+{0x010320, 0},
+{0x01032D, 5},
+{0x010341, 0},
+{0x010342, 5},
+{0x01034A, 0},
+{0x010350, 5},
+{0x010376, 0},
+{0x010380, 5},
+{0x01039E, 0},
+{0x0103A0, 5},
+{0x0103C4, 0},
+{0x0103C8, 5},
+{0x0103D0, 0},
+{0x010400, 1},
+{0x010428, 2},
+{0x010450, 5},
+{0x01049E, 0},
+{0x0104B0, 1},
+{0x0104D4, 0},
+{0x0104D8, 2},
+{0x0104FC, 0},
+{0x010500, 5},
+{0x010528, 0},
+{0x010530, 5},
+{0x010564, 0},
+{0x010570, 1},
+{0x01057B, 0},
+{0x01057C, 1},
+{0x01058B, 0},
+{0x01058C, 1},
+{0x010593, 0},
+{0x010594, 1},
+{0x010596, 0},
+{0x010597, 2},
+{0x0105A2, 0},
+{0x0105A3, 2},
+{0x0105B2, 0},
+{0x0105B3, 2},
+{0x0105BA, 0},
+{0x0105BB, 2},
+{0x0105BD, 0},
+{0x010600, 5},
+{0x010737, 0},
+{0x010740, 5},
+{0x010756, 0},
+{0x010760, 5},
+{0x010768, 0},
+{0x010780, 4},
+{0x010786, 0},
+{0x010787, 4},
+{0x0107B1, 0},
+{0x0107B2, 4},
+{0x0107BB, 0},
+{0x010800, 5},
+{0x010806, 0},
+{0x010808, 5},
+{0x010809, 0},
+{0x01080A, 5},
+{0x010836, 0},
+{0x010837, 5},
+{0x010839, 0},
+{0x01083C, 5},
+{0x01083D, 0},
+{0x01083F, 5},
+{0x010856, 0},
+{0x010860, 5},
+{0x010877, 0},
+{0x010880, 5},
+{0x01089F, 0},
+{0x0108E0, 5},
+{0x0108F3, 0},
+{0x0108F4, 5},
+{0x0108F6, 0},
+{0x010900, 5},
+{0x010916, 0},
+{0x010920, 5},
+{0x01093A, 0},
+{0x010980, 5},
+{0x0109B8, 0},
+{0x0109BE, 5},
+{0x0109C0, 0},
+{0x010A00, 5},
+{0x010A01, 0},
+{0x010A10, 5},
+{0x010A14, 0},
+{0x010A15, 5},
+{0x010A18, 0},
+{0x010A19, 5},
+{0x010A36, 0},
+{0x010A60, 5},
+{0x010A7D, 0},
+{0x010A80, 5},
+{0x010A9D, 0},
+{0x010AC0, 5},
+{0x010AC8, 0},
+{0x010AC9, 5},
+{0x010AE5, 0},
+{0x010B00, 5},
+{0x010B36, 0},
+{0x010B40, 5},
+{0x010B56, 0},
+{0x010B60, 5},
+{0x010B73, 0},
+{0x010B80, 5},
+{0x010B92, 0},
+{0x010C00, 5},
+{0x010C49, 0},
+{0x010C80, 1},
+{0x010CB3, 0},
+{0x010CC0, 2},
+{0x010CF3, 0},
+{0x010D00, 5},
+{0x010D24, 0},
+{0x010E80, 5},
+{0x010EAA, 0},
+{0x010EB0, 5},
+{0x010EB2, 0},
+{0x010F00, 5},
+{0x010F1D, 0},
+{0x010F27, 5},
+{0x010F28, 0},
+{0x010F30, 5},
+{0x010F46, 0},
+{0x010F70, 5},
+{0x010F82, 0},
+{0x010FB0, 5},
+{0x010FC5, 0},
+{0x010FE0, 5},
+{0x010FF7, 0},
+{0x011003, 5},
+{0x011038, 0},
+{0x011071, 5},
+{0x011073, 0},
+{0x011075, 5},
+{0x011076, 0},
+{0x011083, 5},
+{0x0110B0, 0},
+{0x0110D0, 5},
+{0x0110E9, 0},
+{0x011103, 5},
+{0x011127, 0},
+{0x011144, 5},
+{0x011145, 0},
+{0x011147, 5},
+{0x011148, 0},
+{0x011150, 5},
+{0x011173, 0},
+{0x011176, 5},
+{0x011177, 0},
+{0x011183, 5},
+{0x0111B3, 0},
+{0x0111C1, 5},
+{0x0111C5, 0},
+{0x0111DA, 5},
+{0x0111DB, 0},
+{0x0111DC, 5},
+{0x0111DD, 0},
+{0x011200, 5},
+{0x011212, 0},
+{0x011213, 5},
+{0x01122C, 0},
+{0x011280, 5},
+{0x011287, 0},
+{0x011288, 5},
+{0x011289, 0},
+{0x01128A, 5},
+{0x01128E, 0},
+{0x01128F, 5},
+{0x01129E, 0},
+{0x01129F, 5},
+{0x0112A9, 0},
+{0x0112B0, 5},
+{0x0112DF, 0},
+{0x011305, 5},
+{0x01130D, 0},
+{0x01130F, 5},
+{0x011311, 0},
+{0x011313, 5},
+{0x011329, 0},
+{0x01132A, 5},
+{0x011331, 0},
+{0x011332, 5},
+{0x011334, 0},
+{0x011335, 5},
+{0x01133A, 0},
+{0x01133D, 5},
+{0x01133E, 0},
+{0x011350, 5},
+{0x011351, 0},
+{0x01135D, 5},
+{0x011362, 0},
+{0x011400, 5},
+{0x011435, 0},
+{0x011447, 5},
+{0x01144B, 0},
+{0x01145F, 5},
+{0x011462, 0},
+{0x011480, 5},
+{0x0114B0, 0},
+{0x0114C4, 5},
+{0x0114C6, 0},
+{0x0114C7, 5},
+{0x0114C8, 0},
+{0x011580, 5},
+{0x0115AF, 0},
+{0x0115D8, 5},
+{0x0115DC, 0},
+{0x011600, 5},
+{0x011630, 0},
+{0x011644, 5},
+{0x011645, 0},
+{0x011680, 5},
+{0x0116AB, 0},
+{0x0116B8, 5},
+{0x0116B9, 0},
+{0x011700, 5},
+{0x01171B, 0},
+{0x011740, 5},
+{0x011747, 0},
+{0x011800, 5},
+{0x01182C, 0},
+{0x0118A0, 1},
+{0x0118C0, 2},
+{0x0118E0, 0},
+{0x0118FF, 5},
+{0x011907, 0},
+{0x011909, 5},
+{0x01190A, 0},
+{0x01190C, 5},
+{0x011914, 0},
+{0x011915, 5},
+{0x011917, 0},
+{0x011918, 5},
+{0x011930, 0},
+{0x01193F, 5},
+{0x011940, 0},
+{0x011941, 5},
+{0x011942, 0},
+{0x0119A0, 5},
+{0x0119A8, 0},
+{0x0119AA, 5},
+{0x0119D1, 0},
+{0x0119E1, 5},
+{0x0119E2, 0},
+{0x0119E3, 5},
+{0x0119E4, 0},
+{0x011A00, 5},
+{0x011A01, 0},
+{0x011A0B, 5},
+{0x011A33, 0},
+{0x011A3A, 5},
+{0x011A3B, 0},
+{0x011A50, 5},
+{0x011A51, 0},
+{0x011A5C, 5},
+{0x011A8A, 0},
+{0x011A9D, 5},
+{0x011A9E, 0},
+{0x011AB0, 5},
+{0x011AF9, 0},
+{0x011C00, 5},
+{0x011C09, 0},
+{0x011C0A, 5},
+{0x011C2F, 0},
+{0x011C40, 5},
+{0x011C41, 0},
+{0x011C72, 5},
+{0x011C90, 0},
+{0x011D00, 5},
+{0x011D07, 0},
+{0x011D08, 5},
+{0x011D0A, 0},
+{0x011D0B, 5},
+{0x011D31, 0},
+{0x011D46, 5},
+{0x011D47, 0},
+{0x011D60, 5},
+{0x011D66, 0},
+{0x011D67, 5},
+{0x011D69, 0},
+{0x011D6A, 5},
+{0x011D8A, 0},
+{0x011D98, 5},
+{0x011D99, 0},
+{0x011EE0, 5},
+{0x011EF3, 0},
+{0x011FB0, 5},
+{0x011FB1, 0},
+{0x012000, 5},
+{0x01239A, 0},
+{0x012480, 5},
+{0x012544, 0},
+{0x012F90, 5},
+{0x012FF1, 0},
+{0x013000, 5},
+{0x01342F, 0},
+{0x014400, 5},
+{0x014647, 0},
+{0x016800, 5},
+{0x016A39, 0},
+{0x016A40, 5},
+{0x016A5F, 0},
+{0x016A70, 5},
+{0x016ABF, 0},
+{0x016AD0, 5},
+{0x016AEE, 0},
+{0x016B00, 5},
+{0x016B30, 0},
+{0x016B40, 4},
+{0x016B44, 0},
+{0x016B63, 5},
+{0x016B78, 0},
+{0x016B7D, 5},
+{0x016B90, 0},
+{0x016E40, 1},
+{0x016E60, 2},
+{0x016E80, 0},
+{0x016F00, 5},
+{0x016F4B, 0},
+{0x016F50, 5},
+{0x016F51, 0},
+{0x016F93, 4},
+{0x016FA0, 0},
+{0x016FE0, 4},
+{0x016FE2, 0},
+{0x016FE3, 4},
+{0x016FE4, 0},
+{0x017000, 5},
+{0x0187F8, 0},
+{0x018800, 5},
+{0x018CD6, 0},
+{0x018D00, 5},
+{0x018D09, 0},
+{0x01AFF0, 4},
+{0x01AFF4, 0},
+{0x01AFF5, 4},
+{0x01AFFC, 0},
+{0x01AFFD, 4},
+{0x01AFFF, 0},
+{0x01B000, 5},
+{0x01B123, 0},
+{0x01B150, 5},
+{0x01B153, 0},
+{0x01B164, 5},
+{0x01B168, 0},
+{0x01B170, 5},
+{0x01B2FC, 0},
+{0x01BC00, 5},
+{0x01BC6B, 0},
+{0x01BC70, 5},
+{0x01BC7D, 0},
+{0x01BC80, 5},
+{0x01BC89, 0},
+{0x01BC90, 5},
+{0x01BC9A, 0},
+{0x01D400, 1},
+{0x01D41A, 2},
+{0x01D434, 1},
+{0x01D44E, 2},
+{0x01D455, 0},
+{0x01D456, 2},
+{0x01D468, 1},
+{0x01D482, 2},
+{0x01D49C, 1},
+{0x01D49D, 0},
+{0x01D49E, 1},
+{0x01D4A0, 0},
+{0x01D4A2, 1},
+{0x01D4A3, 0},
+{0x01D4A5, 1},
+{0x01D4A7, 0},
+{0x01D4A9, 1},
+{0x01D4AD, 0},
+{0x01D4AE, 1},
+{0x01D4B6, 2},
+{0x01D4BA, 0},
+{0x01D4BB, 2},
+{0x01D4BC, 0},
+{0x01D4BD, 2},
+{0x01D4C4, 0},
+{0x01D4C5, 2},
+{0x01D4D0, 1},
+{0x01D4EA, 2},
+{0x01D504, 1},
+{0x01D506, 0},
+{0x01D507, 1},
+{0x01D50B, 0},
+{0x01D50D, 1},
+{0x01D515, 0},
+{0x01D516, 1},
+{0x01D51D, 0},
+{0x01D51E, 2},
+{0x01D538, 1},
+{0x01D53A, 0},
+{0x01D53B, 1},
+{0x01D53F, 0},
+{0x01D540, 1},
+{0x01D545, 0},
+{0x01D546, 1},
+{0x01D547, 0},
+{0x01D54A, 1},
+{0x01D551, 0},
+{0x01D552, 2},
+{0x01D56C, 1},
+{0x01D586, 2},
+{0x01D5A0, 1},
+{0x01D5BA, 2},
+{0x01D5D4, 1},
+{0x01D5EE, 2},
+{0x01D608, 1},
+{0x01D622, 2},
+{0x01D63C, 1},
+{0x01D656, 2},
+{0x01D670, 1},
+{0x01D68A, 2},
+{0x01D6A6, 0},
+{0x01D6A8, 1},
+{0x01D6C1, 0},
+{0x01D6C2, 2},
+{0x01D6DB, 0},
+{0x01D6DC, 2},
+{0x01D6E2, 1},
+{0x01D6FB, 0},
+{0x01D6FC, 2},
+{0x01D715, 0},
+{0x01D716, 2},
+{0x01D71C, 1},
+{0x01D735, 0},
+{0x01D736, 2},
+{0x01D74F, 0},
+{0x01D750, 2},
+{0x01D756, 1},
+{0x01D76F, 0},
+{0x01D770, 2},
+{0x01D789, 0},
+{0x01D78A, 2},
+{0x01D790, 1},
+{0x01D7A9, 0},
+{0x01D7AA, 2},
+{0x01D7C3, 0},
+{0x01D7C4, 2},
+{0x01D7CA, 1},
+{0x01D7CB, 2},
+{0x01D7CC, 0},
+{0x01DF00, 2},
+{0x01DF0A, 5},
+{0x01DF0B, 2},
+{0x01DF1F, 0},
+{0x01E100, 5},
+{0x01E12D, 0},
+{0x01E137, 4},
+{0x01E13E, 0},
+{0x01E14E, 5},
+{0x01E14F, 0},
+{0x01E290, 5},
+{0x01E2AE, 0},
+{0x01E2C0, 5},
+{0x01E2EC, 0},
+{0x01E7E0, 5},
+{0x01E7E7, 0},
+{0x01E7E8, 5},
+{0x01E7EC, 0},
+{0x01E7ED, 5},
+{0x01E7EF, 0},
+{0x01E7F0, 5},
+{0x01E7FF, 0},
+{0x01E800, 5},
+{0x01E8C5, 0},
+{0x01E900, 1},
+{0x01E922, 2},
+{0x01E944, 0},
+{0x01E94B, 4},
+{0x01E94C, 0},
+{0x01EE00, 5},
+{0x01EE04, 0},
+{0x01EE05, 5},
+{0x01EE20, 0},
+{0x01EE21, 5},
+{0x01EE23, 0},
+{0x01EE24, 5},
+{0x01EE25, 0},
+{0x01EE27, 5},
+{0x01EE28, 0},
+{0x01EE29, 5},
+{0x01EE33, 0},
+{0x01EE34, 5},
+{0x01EE38, 0},
+{0x01EE39, 5},
+{0x01EE3A, 0},
+{0x01EE3B, 5},
+{0x01EE3C, 0},
+{0x01EE42, 5},
+{0x01EE43, 0},
+{0x01EE47, 5},
+{0x01EE48, 0},
+{0x01EE49, 5},
+{0x01EE4A, 0},
+{0x01EE4B, 5},
+{0x01EE4C, 0},
+{0x01EE4D, 5},
+{0x01EE50, 0},
+{0x01EE51, 5},
+{0x01EE53, 0},
+{0x01EE54, 5},
+{0x01EE55, 0},
+{0x01EE57, 5},
+{0x01EE58, 0},
+{0x01EE59, 5},
+{0x01EE5A, 0},
+{0x01EE5B, 5},
+{0x01EE5C, 0},
+{0x01EE5D, 5},
+{0x01EE5E, 0},
+{0x01EE5F, 5},
+{0x01EE60, 0},
+{0x01EE61, 5},
+{0x01EE63, 0},
+{0x01EE64, 5},
+{0x01EE65, 0},
+{0x01EE67, 5},
+{0x01EE6B, 0},
+{0x01EE6C, 5},
+{0x01EE73, 0},
+{0x01EE74, 5},
+{0x01EE78, 0},
+{0x01EE79, 5},
+{0x01EE7D, 0},
+{0x01EE7E, 5},
+{0x01EE7F, 0},
+{0x01EE80, 5},
+{0x01EE8A, 0},
+{0x01EE8B, 5},
+{0x01EE9C, 0},
+{0x01EEA1, 5},
+{0x01EEA4, 0},
+{0x01EEA5, 5},
+{0x01EEAA, 0},
+{0x01EEAB, 5},
+{0x01EEBC, 0},
+{0x020000, 5},
+{0x02A6E0, 0},
+{0x02A700, 5},
+{0x02B739, 0},
+{0x02B740, 5},
+{0x02B81E, 0},
+{0x02B820, 5},
+{0x02CEA2, 0},
+{0x02CEB0, 5},
+{0x02EBE1, 0},
+{0x02F800, 5},
+{0x02FA1E, 0},
+{0x030000, 5},
+{0x03134B, 0},
+{0x110000, 0},
+};
+
+} // namespace nanotokenizer
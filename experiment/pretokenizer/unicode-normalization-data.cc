@@ -0,0 +1,7749 @@
+// generated with gen-unicode-normalization.py. DO NOT EDIT.
+// Unicode 14.0.0. 3828 records, 258 unique blocks, 147896 bytes total.
+
+#include "unicode-data.hh"
+
+namespace nanotokenizer {
+
+const uint16_t unicode_norm_stage1[17408] = {
+0,0,1,2,3,4,5,6,7,0,8,9,10,11,12,13,
+14,15,16,17,0,0,18,19,20,21,0,22,23,24,0,25,
+26,27,28,29,30,31,32,33,34,35,36,37,32,38,39,40,
+36,41,36,42,43,44,0,45,46,47,48,49,50,51,52,53,
+54,0,55,56,0,57,58,59,0,0,0,0,0,60,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,61,0,0,62,
+0,0,63,0,64,0,0,0,65,66,67,68,69,70,71,72,
+73,0,0,74,75,76,77,78,79,80,81,82,83,84,85,86,
+87,88,89,90,91,92,93,94,95,96,97,98,99,0,0,0,
+0,100,101,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,103,104,0,105,0,0,0,0,
+0,106,0,107,0,108,0,109,0,0,110,111,112,113,114,115,
+116,117,118,119,120,121,122,0,123,124,125,126,127,128,129,130,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,131,132,133,0,134,0,135,
+136,0,0,137,138,139,140,141,0,0,142,143,0,144,0,145,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,147,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,148,149,150,151,152,153,154,155,156,157,158,159,
+160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,
+0,0,0,0,0,0,0,176,0,0,0,177,0,178,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,0,
+0,0,0,0,0,0,0,0,180,0,0,181,0,0,0,0,
+0,0,0,0,182,0,0,0,0,0,183,0,0,184,185,0,
+0,186,187,0,188,140,0,189,190,0,0,191,192,193,0,0,
+0,194,195,196,0,0,197,198,199,0,200,0,201,0,0,0,
+202,0,0,0,203,204,0,205,206,207,208,0,0,0,0,0,
+199,0,0,0,0,209,210,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,211,212,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,213,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,214,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,215,216,217,0,218,0,0,0,0,0,0,
+219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+235,0,0,0,212,0,0,0,0,0,236,237,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,238,0,239,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,240,241,242,0,0,0,0,0,
+0,0,0,0,243,244,245,0,246,247,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+249,250,251,252,253,254,255,256,257,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const uint16_t unicode_norm_stage2[16512] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,2,0,3,0,0,0,0,4,
+0,0,5,6,7,8,0,0,9,10,11,0,12,13,14,0,
+15,16,17,18,19,20,0,21,22,23,24,25,26,27,28,29,
+0,30,31,32,33,34,35,0,0,36,37,38,39,40,0,0,
+41,42,43,44,45,46,0,47,48,49,50,51,52,53,54,55,
+0,56,57,58,59,60,61,0,0,62,63,64,65,66,0,67,
+68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,
+0,0,84,85,86,87,88,89,90,91,92,93,94,95,96,97,
+98,99,100,101,102,103,0,0,104,105,106,107,108,109,110,111,
+112,0,113,114,115,116,117,118,0,119,120,121,122,123,124,125,
+126,0,0,127,128,129,130,131,132,133,0,0,134,135,136,137,
+138,139,0,0,140,141,142,143,144,145,146,147,148,149,150,151,
+152,153,154,155,156,157,0,0,158,159,160,161,162,163,164,165,
+166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+182,183,0,0,0,0,0,0,0,0,0,0,0,0,0,184,
+185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,186,187,188,189,190,191,192,193,194,195,196,197,
+198,199,200,201,202,203,204,205,206,207,208,209,210,0,211,212,
+213,214,215,216,0,0,217,218,219,220,221,222,223,224,225,226,
+227,228,229,230,231,232,0,0,233,234,235,236,237,238,239,240,
+241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,256,
+257,258,259,260,261,262,263,264,265,266,267,268,0,0,269,270,
+0,0,0,0,0,0,271,272,273,274,275,276,277,278,279,280,
+281,282,283,284,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+285,286,287,288,289,290,291,292,293,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,294,295,296,297,298,299,0,0,
+300,301,181,302,303,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+304,304,304,304,304,305,304,304,304,304,304,304,304,305,305,304,
+305,304,305,304,304,306,307,307,307,307,306,308,307,307,307,307,
+307,309,309,310,310,310,310,311,311,307,307,307,307,310,310,307,
+310,310,307,307,312,312,312,312,313,307,307,307,307,305,305,305,
+314,315,304,316,317,318,305,307,307,307,305,305,305,307,307,0,
+305,305,305,307,307,307,307,305,306,307,307,305,319,320,320,319,
+320,320,319,305,305,305,305,305,305,305,305,305,305,305,305,305,
+0,0,0,0,321,0,0,0,0,0,322,0,0,0,323,0,
+0,0,0,0,7,324,325,326,327,328,329,0,330,0,331,332,
+333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,334,335,336,337,338,339,
+340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,341,342,343,344,345,0,
+346,347,348,349,350,351,352,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+353,354,355,0,356,357,0,0,0,358,0,0,0,0,0,0,
+359,360,0,361,0,0,0,362,0,0,0,0,363,364,365,0,
+0,0,0,0,0,0,0,0,0,366,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,367,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+368,369,0,370,0,0,0,371,0,0,0,0,372,373,374,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,375,376,0,0,0,0,0,0,0,0,
+0,0,0,305,305,305,305,305,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,377,378,0,0,0,0,0,0,0,0,0,0,0,0,0,
+379,380,381,382,0,0,383,384,0,0,385,386,387,388,389,390,
+0,0,391,392,393,394,395,396,0,0,397,398,399,400,401,402,
+403,404,405,406,407,408,0,0,409,410,0,0,0,0,0,0,
+0,0,0,0,0,0,0,411,0,0,0,0,0,0,0,0,
+0,307,305,305,305,305,307,305,305,305,412,307,305,305,305,305,
+305,305,307,307,307,307,307,307,305,305,307,305,305,412,413,305,
+414,415,416,417,418,419,420,421,422,423,423,424,425,426,0,427,
+0,428,429,0,305,307,0,422,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,305,305,305,305,305,305,305,430,431,432,0,0,0,0,0,
+0,0,433,434,435,436,437,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,438,439,440,430,431,
+432,441,442,304,304,310,307,305,305,305,305,305,307,305,305,307,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+443,0,0,0,0,444,445,446,447,0,0,0,0,0,0,0,
+448,0,449,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,450,0,0,305,305,305,305,305,305,305,0,0,305,
+305,305,305,307,305,0,0,305,305,0,307,305,305,307,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,451,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,307,305,305,307,305,305,307,307,307,305,307,307,305,307,305,
+305,305,307,305,307,305,307,305,307,305,305,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,305,305,305,305,305,
+305,305,307,305,0,0,0,0,0,0,0,0,0,307,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,305,305,305,305,0,305,305,305,305,305,
+305,305,305,305,0,305,305,305,0,305,305,305,305,305,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,307,307,307,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,305,307,307,307,305,305,305,305,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,305,305,305,305,305,307,
+307,307,307,307,305,305,305,305,305,305,305,305,305,305,305,305,
+305,305,0,307,305,305,307,305,305,307,305,305,305,307,307,307,
+438,439,440,305,305,305,307,305,305,307,307,305,305,305,305,305,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,452,0,0,0,0,0,0,
+0,453,0,0,454,0,0,0,0,0,0,0,455,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,456,0,0,
+0,305,307,305,305,0,0,0,457,458,459,460,461,462,463,464,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,465,0,466,0,
+0,0,0,0,0,0,0,0,0,0,0,467,468,456,0,0,
+0,0,0,0,0,0,0,466,0,0,0,0,469,470,0,471,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,305,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,472,0,0,473,0,0,0,0,0,465,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,456,0,0,
+0,0,0,0,0,0,0,0,0,474,475,476,0,0,477,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,465,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,456,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,478,0,0,479,480,456,0,0,
+0,0,0,0,0,0,466,466,0,0,0,0,481,482,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,483,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,466,0,
+0,0,0,0,0,0,0,0,0,0,484,485,486,456,0,0,
+0,0,0,0,0,0,0,466,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,487,0,0,0,0,456,0,0,
+0,0,0,0,0,488,489,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+490,0,466,0,0,0,0,491,492,0,493,494,0,456,0,0,
+0,0,0,0,0,466,466,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,456,456,0,466,0,
+0,0,0,0,0,0,0,0,0,0,495,496,497,456,0,0,
+0,0,0,0,0,0,0,466,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,498,0,0,0,0,466,
+0,0,0,0,0,0,0,0,0,0,499,0,500,501,502,466,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,503,0,0,0,0,504,504,456,0,0,0,0,0,
+0,0,0,0,0,0,0,0,505,505,505,505,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,506,0,0,0,0,507,507,456,0,0,0,0,0,
+0,0,0,0,0,0,0,0,508,508,508,508,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,509,510,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,511,0,0,0,
+0,0,0,0,0,0,0,0,307,307,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,307,0,307,0,512,0,0,0,0,0,0,
+0,0,0,513,0,0,0,0,0,0,0,0,0,514,0,0,
+0,0,515,0,0,0,0,516,0,0,0,0,517,0,0,0,
+0,0,0,0,0,0,0,0,0,518,0,0,0,0,0,0,
+0,519,520,521,522,523,524,525,526,527,520,520,520,520,0,0,
+520,528,305,305,456,0,305,305,0,0,0,0,0,0,0,0,
+0,0,0,529,0,0,0,0,0,0,0,0,0,530,0,0,
+0,0,531,0,0,0,0,532,0,0,0,0,533,0,0,0,
+0,0,0,0,0,0,0,0,0,534,0,0,0,0,0,0,
+0,0,0,0,0,0,307,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,535,0,0,0,0,0,0,0,466,0,
+0,0,0,0,0,0,0,465,0,456,456,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,307,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,536,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+466,466,466,466,466,466,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,466,466,466,466,466,466,466,466,
+466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,466,
+466,466,466,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,305,305,305,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,456,456,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,456,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,456,0,0,0,0,0,0,0,0,0,0,305,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,413,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,412,305,307,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,305,307,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+456,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,305,305,305,305,305,305,305,305,0,0,307,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,305,305,305,305,307,307,307,307,307,307,305,305,307,0,307,
+307,305,305,307,307,305,305,305,305,305,307,305,305,305,305,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,537,0,538,0,539,0,540,0,541,0,
+0,0,542,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,465,466,0,0,0,0,0,543,0,544,0,0,
+545,546,0,547,456,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,305,307,305,305,305,
+305,305,305,305,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,456,456,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,465,0,0,0,0,0,0,0,0,0,
+0,0,456,456,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,465,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,305,305,0,312,307,307,307,307,307,305,305,307,307,307,307,
+305,0,312,312,312,312,312,312,312,0,0,0,0,307,0,0,
+0,0,0,0,305,0,0,0,305,305,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,548,549,550,0,
+551,552,553,554,555,556,557,558,559,560,561,0,562,563,564,565,
+566,567,568,3,569,570,571,572,573,574,575,576,577,578,0,579,
+580,581,11,582,583,584,585,586,587,588,589,590,591,346,592,593,
+351,594,595,288,587,590,346,592,354,351,594,0,0,0,0,0,
+0,0,0,0,0,0,0,0,596,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,597,598,599,600,577,
+601,602,603,604,605,606,607,608,609,610,611,612,613,614,615,616,
+617,618,619,620,621,622,623,624,625,626,627,628,629,630,631,347,
+305,305,307,305,305,305,305,305,305,305,307,305,305,320,632,307,
+309,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+305,305,305,305,305,305,306,413,413,307,633,305,319,307,305,307,
+634,635,636,637,638,639,640,641,642,643,644,645,646,647,648,649,
+650,651,652,653,654,655,656,657,658,659,660,661,662,663,664,665,
+666,667,668,669,670,671,672,673,674,675,676,677,678,679,680,681,
+682,683,684,685,686,687,688,689,690,691,692,693,694,695,696,697,
+698,699,700,701,702,703,704,705,706,707,708,709,710,711,712,713,
+714,715,716,717,718,719,720,721,722,723,724,725,726,727,728,729,
+730,731,732,733,734,735,736,737,738,739,740,741,742,743,744,745,
+746,747,748,749,750,751,752,753,754,755,756,757,758,759,760,761,
+762,763,764,765,766,767,768,769,770,771,772,773,774,775,776,777,
+778,779,780,781,782,783,784,785,786,787,788,789,0,0,0,0,
+790,791,792,793,794,795,796,797,798,799,800,801,802,803,804,805,
+806,807,808,809,810,811,812,813,814,815,816,817,818,819,820,821,
+822,823,824,825,826,827,828,829,830,831,832,833,834,835,836,837,
+838,839,840,841,842,843,844,845,846,847,848,849,850,851,852,853,
+854,855,856,857,858,859,860,861,862,863,864,865,866,867,868,869,
+870,871,872,873,874,875,876,877,878,879,0,0,0,0,0,0,
+880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,
+896,897,898,899,900,901,0,0,902,903,904,905,906,907,0,0,
+908,909,910,911,912,913,914,915,916,917,918,919,920,921,922,923,
+924,925,926,927,928,929,930,931,932,933,934,935,936,937,938,939,
+940,941,942,943,944,945,0,0,946,947,948,949,950,951,0,0,
+952,953,954,955,956,957,958,959,0,960,0,961,0,962,0,963,
+964,965,966,967,968,969,970,971,972,973,974,975,976,977,978,979,
+980,981,982,983,984,985,986,987,988,989,990,991,992,993,0,0,
+994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,
+1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,
+1026,1027,1028,1029,1030,1031,1032,1033,1034,1035,1036,1037,1038,1039,1040,1041,
+1042,1043,1044,1045,1046,0,1047,1048,1049,1050,1051,1052,1053,1054,1055,1054,
+1056,1057,1058,1059,1060,0,1061,1062,1063,1064,1065,1066,1067,1068,1069,1070,
+1071,1072,1073,1074,0,0,1075,1076,1077,1078,1079,1080,0,1081,1082,1083,
+1084,1085,1086,1087,1088,1089,1090,1091,1092,1093,1094,1095,1096,1097,1098,1099,
+0,0,1100,1101,1102,0,1103,1104,1105,1106,1107,1108,1109,1110,1111,0,
+1112,1113,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+0,1114,0,0,0,0,0,1115,0,0,0,0,0,0,0,0,
+0,0,0,0,1116,1117,1118,0,0,0,0,0,0,0,0,1,
+0,0,0,1119,1120,0,1121,1122,0,0,0,0,1123,0,1124,0,
+0,0,0,0,0,0,0,1125,1126,1127,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1128,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1129,595,0,0,1130,1131,1132,1133,1134,1135,1136,1137,1138,1139,1140,1141,
+1129,10,5,6,1130,1131,1132,1133,1134,1135,1136,1137,1138,1139,1140,0,
+3,574,11,302,575,285,579,301,580,1141,585,181,586,0,0,0,
+0,0,0,0,0,0,0,0,1142,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,305,312,312,305,305,305,305,312,312,312,305,305,0,0,0,
+0,305,0,0,0,312,312,305,307,305,312,312,307,307,307,307,
+305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1143,1144,1145,1146,0,1147,1148,1149,0,1150,578,555,555,555,285,1151,
+556,556,559,301,0,561,1152,0,0,564,1153,565,565,565,0,0,
+1154,1155,1156,0,1157,0,1158,0,1157,0,1159,1160,550,1145,0,574,
+552,1161,0,560,11,1162,1163,1164,1165,595,0,1166,352,592,1167,1168,
+1169,0,0,0,0,551,573,574,595,287,0,0,0,0,0,0,
+1170,1171,1172,1173,1174,1175,1176,1177,1178,1179,1180,1181,1182,1183,1184,1185,
+556,1186,1187,1188,1189,1190,1191,1192,1193,1194,1195,1196,559,1145,551,560,
+595,1197,1198,1199,590,1200,1201,1202,1203,302,1204,1205,301,598,573,580,
+0,0,0,0,0,0,0,0,0,1206,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1207,1208,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1209,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1210,1211,1212,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1213,0,0,0,0,1214,0,0,1215,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1216,0,1217,0,0,0,0,0,1218,1219,0,1220,
+1221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1222,0,0,1223,0,0,1224,0,1225,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1226,0,1227,0,0,0,0,0,0,0,0,0,0,1228,1229,1230,
+1231,1232,0,0,1233,1234,0,0,1235,1236,0,0,0,0,0,0,
+1237,1238,0,0,1239,1240,0,0,1241,1242,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1243,1244,1245,1246,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1247,1248,1249,1250,0,0,0,0,0,0,1251,1252,1253,1254,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1255,1256,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+10,5,6,1130,1131,1132,1133,1134,1135,1257,1258,1259,1260,1261,1262,1263,
+1264,1265,1266,1267,1268,1269,1270,1271,1272,1273,1274,1275,1276,1277,1278,1279,
+1280,1281,1282,1283,1284,1285,1286,1287,1288,1289,1290,1291,1292,1293,1294,1295,
+1296,1297,1298,1299,1300,1301,1302,1303,1304,1305,1306,1307,1308,1309,1310,1311,
+1312,1313,1314,1315,1316,1317,1318,1319,1320,1321,1322,1323,1324,1325,1326,1327,
+1328,1329,1330,1331,1332,1333,548,550,1145,551,552,1161,554,555,556,557,
+558,559,560,561,562,564,1153,565,1334,566,567,1189,568,1194,1335,1157,
+3,572,598,573,574,601,578,285,595,287,579,301,580,1141,11,585,
+1336,288,181,586,587,590,292,302,293,628,1129,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1337,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1338,1339,1340,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1341,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,287,1189,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,305,
+305,305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1342,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,456,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1343,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1344,0,0,0,0,0,0,0,0,0,0,0,0,
+1345,1346,1347,1348,1349,1350,1351,1352,1353,1354,1355,1356,1357,1358,1359,1360,
+1361,1362,1363,1364,1365,1366,1367,1368,1369,1370,1371,1372,1373,1374,1375,1376,
+1377,1378,1379,1380,1381,1382,1383,1384,1385,1386,1387,1388,1389,1390,1391,1392,
+1393,1394,1395,1396,1397,1398,1399,1400,1401,1402,1403,1404,1405,1406,1407,1408,
+1409,1410,1411,1412,1413,1414,1415,1416,1417,1418,1419,1420,1421,1422,1423,1424,
+1425,1426,1427,1428,1429,1430,1431,1432,1433,1434,1435,1436,1437,1438,1439,1440,
+1441,1442,1443,1444,1445,1446,1447,1448,1449,1450,1451,1452,1453,1454,1455,1456,
+1457,1458,1459,1460,1461,1462,1463,1464,1465,1466,1467,1468,1469,1470,1471,1472,
+1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1485,1486,1487,1488,
+1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1499,1500,1501,1502,1503,1504,
+1505,1506,1507,1508,1509,1510,1511,1512,1513,1514,1515,1516,1517,1518,1519,1520,
+1521,1522,1523,1524,1525,1526,1527,1528,1529,1530,1531,1532,1533,1534,1535,1536,
+1537,1538,1539,1540,1541,1542,1543,1544,1545,1546,1547,1548,1549,1550,1551,1552,
+1553,1554,1555,1556,1557,1558,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,633,413,306,412,1559,1559,
+0,0,0,0,0,0,1560,0,1368,1561,1562,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1563,0,1564,0,
+1565,0,1566,0,1567,0,1568,0,1569,0,1570,0,1571,0,1572,0,
+1573,0,1574,0,0,1575,0,1576,0,1577,0,0,0,0,0,0,
+1578,1579,0,1580,1581,0,1582,1583,0,1584,1585,0,1586,1587,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1588,0,0,0,0,1589,1589,1590,1591,0,1592,1593,
+0,0,0,0,0,0,0,0,0,0,0,0,1594,0,1595,0,
+1596,0,1597,0,1598,0,1599,0,1600,0,1601,0,1602,0,1603,0,
+1604,0,1605,0,0,1606,0,1607,0,1608,0,0,0,0,0,0,
+1609,1610,0,1611,1612,0,1613,1614,0,1615,1616,0,1617,1618,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1619,0,0,1620,1621,1622,1623,0,0,0,1624,1625,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1626,1627,1628,1629,1630,1631,1632,1633,1634,1635,1636,1637,1638,1639,1640,
+1641,1642,1643,1644,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,
+1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,
+1673,1674,1675,1676,1677,1678,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,
+1689,1690,1691,1692,1693,1694,1695,1696,1697,1698,1699,1700,1701,1702,1703,1704,
+1705,1706,1707,1708,1709,1710,1711,1712,1713,1714,1715,1716,1717,1718,1719,0,
+0,0,1345,1351,1720,1721,1722,1723,1724,1725,1349,1726,1727,1728,1729,1353,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1745,
+1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,0,
+1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,
+1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1791,1792,
+1793,1794,1795,1796,1797,1798,1411,1799,0,0,0,0,0,0,0,0,
+1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,
+1626,1629,1632,1634,1642,1643,1646,1648,1649,1651,1652,1653,1654,1655,1816,1817,
+1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,0,
+1345,1351,1720,1721,1833,1834,1835,1356,1836,1368,1418,1430,1429,1419,1511,1376,
+1416,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1382,1847,1848,1849,1850,
+1851,1852,1853,1854,1722,1723,1724,1855,1856,1857,1858,1859,1860,1861,1862,1863,
+1864,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,
+1880,1881,1882,1883,1884,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,
+1896,1897,1898,1899,1900,1901,1902,1903,1904,1905,1906,1907,1908,1909,1910,1911,
+1912,1913,1914,1915,1916,1917,1918,1919,1920,1921,1922,1923,1924,1925,1926,1927,
+1928,1929,1930,1931,1932,1933,1934,1935,1936,1937,1938,1939,1940,1941,1942,1943,
+1944,1945,1946,1947,1948,1949,1950,1951,1952,1953,1954,1955,1956,1957,1958,1959,
+1960,1961,1962,1963,1964,1965,1966,1967,1968,1969,1970,1971,1972,1973,1974,1975,
+1976,1977,1978,1979,1980,1981,1982,1983,1984,1985,1986,1987,1988,1989,1990,1991,
+1992,1993,1994,1995,1996,1997,1998,1999,2000,2001,2002,2003,2004,2005,2006,2007,
+2008,2009,2010,2011,2012,2013,2014,2015,2016,2017,2018,2019,2020,2021,2022,2023,
+2024,2025,2026,2027,2028,2029,2030,2031,2032,2033,2034,2035,2036,2037,2038,2039,
+2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2050,2051,2052,2053,2054,2055,
+2056,2057,2058,2059,2060,2061,2062,2063,2064,2065,2066,2067,2068,2069,2070,2071,
+2072,2073,2074,2075,2076,2077,2078,2079,2080,2081,2082,2083,2084,2085,2086,2087,
+2088,2089,2090,2091,2092,2093,2094,2095,2096,2097,2098,2099,2100,2101,2102,2103,
+2104,2105,2106,2107,2108,2109,2110,2111,2112,2113,2114,2115,2116,2117,2118,2119,
+2120,2121,2122,2123,2124,2125,2126,2127,2128,2129,2130,2131,2132,2133,2134,2135,
+2136,2137,2138,2139,2140,2141,2142,2143,2144,2145,2146,2147,2148,2149,2150,2151,
+2152,2153,2154,2155,2156,2157,2158,2159,2160,2161,2162,2163,2164,2165,2166,2167,
+2168,2169,2170,2171,2172,2173,2174,2175,2176,2177,2178,2179,2180,2181,2182,2183,
+2184,2185,2186,2187,2188,2189,2190,2191,2192,2193,2194,2195,2196,2197,2198,2199,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,305,
+0,0,0,0,305,305,305,305,305,305,305,305,305,305,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2200,2201,305,305,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1145,1161,1153,0,0,0,2203,2204,0,0,0,0,0,0,
+0,0,0,0,0,0,456,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,456,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,456,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,305,
+305,305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,307,307,307,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,456,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,465,0,0,0,0,0,0,0,0,0,0,0,0,
+456,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,0,305,305,307,0,0,305,305,0,0,0,0,0,305,305,
+0,305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,456,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2205,2206,2207,2208,
+0,0,0,0,0,0,0,0,0,2209,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,456,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,
+2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,
+2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,
+2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,
+2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,
+2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,2210,
+2210,2210,2210,2210,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2211,2212,2213,2214,2215,2216,2217,2218,2218,2219,2220,2221,2222,2223,2224,2225,
+2226,2227,2228,2229,2230,2231,2232,2233,2234,2235,2236,2237,2238,2239,2240,2241,
+2242,2243,2244,2245,2246,2247,2248,2249,2250,2251,2252,2253,2254,2255,2256,2257,
+2258,2259,2260,2261,2262,2263,2264,2265,2266,2267,2268,2269,2270,2271,2272,2273,
+2274,2275,2276,2277,2278,2279,2280,2281,2282,2283,2284,2285,2286,2287,2288,2289,
+2290,2291,2292,2293,2294,2295,2296,2297,2298,2299,2300,2301,2230,2302,2303,2304,
+2305,2306,2307,2308,2309,2310,2311,2312,2313,2314,2315,2316,2317,2318,2319,2320,
+2321,2322,2323,2324,2325,2326,2327,2328,2329,2330,2331,2332,2333,2334,2335,2336,
+2337,2338,2339,2340,2341,2342,2343,2344,2345,2346,2347,2348,2349,2350,2351,2352,
+2353,2354,2355,2356,2357,2358,2359,2360,2361,2362,2363,2364,2365,2366,2367,2368,
+2369,2320,2370,2371,2372,2373,2374,2375,2376,2377,2304,2378,2379,2380,2381,2382,
+2383,2384,2385,2386,2387,2388,2389,2390,2391,2392,2393,2394,2395,2396,2397,2230,
+2398,2399,2400,2401,2402,2403,2404,2405,2406,2407,2408,2409,2410,2411,2412,2413,
+2414,2415,2416,2417,2418,2419,2420,2421,2422,2423,2424,2306,2425,2426,2427,2428,
+2429,2430,2431,2432,2433,2434,2435,2436,2437,2438,2439,2440,2441,2442,2443,2444,
+2445,2446,2447,2448,2449,2450,2451,2452,2453,2454,2455,2456,2457,2458,2459,2460,
+2461,2462,2463,2464,2465,2466,2467,2468,2469,2470,2471,2472,2473,2474,0,0,
+2475,0,2476,0,0,2477,2478,2479,2480,2481,2482,2483,2484,2485,2486,0,
+2487,0,2488,0,0,2489,2490,0,0,0,2491,2492,2493,2494,2495,2496,
+2497,2498,2499,2500,2501,2502,2503,2504,2505,2506,2507,2508,2509,2510,2511,2512,
+2513,2514,2515,2516,2517,2518,2519,2520,2521,2522,2523,2524,2525,2526,2527,2528,
+2529,2530,2531,2532,2533,2534,2535,2359,2536,2537,2538,2539,2540,2541,2541,2542,
+2543,2544,2545,2546,2547,2548,2549,2489,2550,2551,2552,2553,2554,2555,0,0,
+2556,2557,2558,2559,2560,2561,2562,2563,2503,2564,2565,2566,2475,2567,2568,2569,
+2570,2571,2572,2573,2574,2575,2576,2577,2578,2512,2579,2513,2580,2581,2582,2583,
+2584,2476,2251,2585,2586,2587,2321,2408,2588,2589,2520,2590,2521,2591,2592,2593,
+2478,2594,2595,2596,2597,2598,2479,2599,2600,2601,2602,2603,2604,2535,2605,2606,
+2359,2607,2539,2608,2609,2610,2611,2612,2544,2613,2488,2614,2545,2302,2615,2546,
+2616,2548,2617,2618,2619,2620,2621,2550,2484,2622,2551,2623,2552,2624,2218,2625,
+2626,2627,2628,2629,2630,2631,2632,2633,2634,2635,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2636,2637,2638,2639,2640,2641,2641,0,0,0,0,0,0,0,0,0,
+0,0,0,2642,2643,2644,2645,2646,0,0,0,0,0,2647,2648,2649,
+2650,1162,1165,2651,2652,2653,2654,2655,2656,1136,2657,2658,2659,2660,2661,2662,
+2663,2664,2665,2666,2667,2668,2669,0,2670,2671,2672,2673,2674,0,2675,0,
+2676,2677,0,2678,2679,0,2680,2681,2682,2683,2684,2685,2686,2687,2688,2689,
+2690,2690,2691,2691,2691,2691,2692,2692,2692,2692,2693,2693,2693,2693,2694,2694,
+2694,2694,2695,2695,2695,2695,2696,2696,2696,2696,2697,2697,2697,2697,2698,2698,
+2698,2698,2699,2699,2699,2699,2700,2700,2700,2700,2701,2701,2701,2701,2702,2702,
+2702,2702,2703,2703,2704,2704,2705,2705,2706,2706,2707,2707,2708,2708,2709,2709,
+2709,2709,2710,2710,2710,2710,2711,2711,2711,2711,2712,2712,2712,2712,2713,2713,
+2714,2714,2714,2714,2715,2715,2716,2716,2716,2716,2717,2717,2717,2717,2718,2718,
+2719,2719,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2720,2720,2720,2720,2721,2721,2722,2722,2723,2723,446,2724,2724,
+2725,2725,2726,2726,2727,2727,2727,2727,2728,2728,2729,2729,2730,2730,2731,2731,
+2732,2732,2733,2733,2734,2734,2735,2735,2735,2736,2736,2736,2737,2737,2737,2737,
+2738,2739,2740,2736,2741,2742,2743,2744,2745,2746,2747,2748,2749,2750,2751,2752,
+2753,2754,2755,2756,2757,2758,2759,2760,2761,2762,2763,2764,2765,2766,2767,2768,
+2769,2770,2771,2772,2773,2774,2775,2776,2777,2778,2779,2780,2781,2782,2783,2784,
+2785,2786,2787,2788,2789,2790,2791,2792,2793,2794,2795,2796,2797,2798,2799,2800,
+2801,2802,2803,2804,2805,2806,2807,2808,2809,2810,2811,2812,2813,2814,2815,2816,
+2817,2818,2819,2820,2821,2822,2823,2824,2825,2826,2827,2828,2829,2830,2831,2832,
+2833,2834,2835,2836,2837,2838,2740,2839,2736,2741,2840,2841,2745,2842,2746,2747,
+2843,2844,2751,2845,2752,2753,2846,2847,2755,2848,2756,2757,2786,2787,2790,2791,
+2792,2796,2797,2798,2799,2803,2804,2805,2849,2809,2850,2851,2815,2852,2816,2817,
+2830,2853,2854,2825,2855,2826,2827,2738,2739,2856,2740,2857,2742,2743,2744,2745,
+2858,2748,2749,2750,2751,2859,2755,2758,2759,2760,2761,2762,2764,2765,2766,2767,
+2768,2769,2860,2770,2771,2772,2773,2774,2775,2777,2778,2779,2780,2781,2782,2783,
+2784,2785,2788,2789,2793,2794,2795,2796,2797,2800,2801,2802,2803,2861,2806,2807,
+2808,2809,2812,2813,2814,2815,2862,2818,2819,2863,2822,2823,2824,2825,2864,2740,
+2857,2745,2858,2751,2859,2755,2865,2768,2866,2867,2868,2796,2797,2803,2815,2862,
+2825,2864,2869,2870,2871,2872,2873,2874,2875,2876,2877,2878,2879,2880,2881,2882,
+2883,2884,2885,2886,2887,2888,2889,2890,2891,2892,2893,2894,2867,2895,2896,2897,
+2898,2872,2873,2874,2875,2876,2877,2878,2879,2880,2881,2882,2883,2884,2885,2886,
+2887,2888,2889,2890,2891,2892,2893,2894,2867,2895,2896,2897,2898,2892,2893,2894,
+2867,2866,2868,2776,2765,2766,2767,2892,2893,2894,2776,2777,2899,2899,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2900,2901,2901,2902,2903,2904,2905,2906,2907,2907,2908,2909,2910,2911,2912,2913,
+2913,2914,2915,2915,2916,2916,2917,2918,2918,2919,2920,2920,2921,2921,2922,2923,
+2923,2924,2924,2925,2926,2927,2928,2928,2929,2930,2931,2932,2933,2933,2934,2935,
+2936,2937,2938,2939,2939,2940,2940,2941,2941,2942,2943,2944,2945,2946,2947,2948,
+0,0,2949,2950,2951,2952,2953,2954,2954,2955,2956,2957,2958,2958,2959,2960,
+2961,2962,2963,2964,2965,2966,2967,2968,2969,2970,2971,2972,2973,2974,2975,2976,
+2977,2978,2979,2980,2934,2936,2981,2982,2983,2984,2985,2986,2985,2983,2987,2988,
+2989,2990,2991,2986,2927,2917,2992,2993,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2994,2995,2996,2997,2998,2999,3000,3001,3002,3003,3004,3005,3006,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3007,3008,3009,3010,3011,3012,3013,3014,3015,1118,0,0,0,0,0,0,
+305,305,305,305,305,305,305,307,307,307,307,307,307,307,305,305,
+1117,3016,3017,3018,3018,1139,1140,3019,3020,3021,3022,3023,3024,3025,3026,3027,
+3028,3029,3030,3031,3032,0,0,3033,3034,1124,1124,1124,1124,3018,3018,3018,
+3007,3008,1116,0,3011,3010,3013,3012,3016,1139,1140,3019,3020,3021,3022,3035,
+3036,3037,1136,3038,3039,3040,1138,0,3041,3042,3043,3044,0,0,0,0,
+3045,3046,3047,0,3048,0,3049,3050,3051,3052,3053,3054,3055,3056,3057,3058,
+3059,3060,3060,3061,3061,3062,3062,3063,3063,3064,3064,3064,3064,3065,3065,3066,
+3066,3066,3066,3067,3067,3068,3068,3068,3068,3069,3069,3069,3069,3070,3070,3070,
+3070,3071,3071,3071,3071,3072,3072,3072,3072,3073,3073,3074,3074,3075,3075,3076,
+3076,3077,3077,3077,3077,3078,3078,3078,3078,3079,3079,3079,3079,3080,3080,3080,
+3080,3081,3081,3081,3081,3082,3082,3082,3082,3083,3083,3083,3083,3084,3084,3084,
+3084,3085,3085,3085,3085,3086,3086,3086,3086,3087,3087,3087,3087,3088,3088,3088,
+3088,3089,3089,3089,3089,3090,3090,3090,3090,3091,3091,3091,3091,3092,3092,2728,
+2728,3093,3093,3093,3093,3094,3094,3095,3095,3096,3096,3097,3097,0,0,0,
+0,3012,3098,3035,3042,3043,3036,3099,1139,1140,3037,1136,3007,3038,1116,3100,
+1129,10,5,6,1130,1131,1132,1133,1134,1135,3010,3011,3039,1138,3040,3013,
+3044,548,550,1145,551,552,1161,554,555,556,557,558,559,560,561,562,
+564,1153,565,1334,566,567,1189,568,1194,1335,1157,3033,3041,3034,3101,3018,
+3102,3,572,598,573,574,601,578,285,595,287,579,301,580,1141,11,
+585,1336,288,181,586,587,590,292,302,293,628,3019,3103,3020,3104,3105,
+3106,3009,3029,3030,3008,3107,1942,3108,3109,3110,3111,3112,3113,3114,3115,3116,
+3117,1896,1897,1898,1899,1900,1901,1902,1903,1904,1905,1906,1907,1908,1909,1910,
+1911,1912,1913,1914,1915,1916,1917,1918,1919,1920,1921,1922,1923,1924,1925,1926,
+1927,1928,1929,1930,1931,1932,1933,1934,1935,1936,1937,1938,1939,3118,3119,3120,
+1677,1626,1627,1628,1629,1630,1631,1632,1633,1634,1635,1636,1637,1638,1639,1640,
+1641,1642,1643,1644,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,0,
+0,0,1656,1657,1658,1659,1660,1661,0,0,1662,1663,1664,1665,1666,1667,
+0,0,1668,1669,1670,1671,1672,1673,0,0,1674,1675,1676,0,0,0,
+3121,3122,3123,4,3124,3125,3126,0,3127,3128,3129,3130,3131,3132,3133,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,307,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,305,305,305,305,305,0,0,0,0,0,
+0,3134,3135,3136,3137,3138,0,3139,3140,3141,3142,3143,3144,3145,3146,3147,
+3148,3149,3150,3151,3152,1151,3153,3154,3155,3156,3157,3158,3159,3160,3161,3162,
+3163,3164,3165,3166,3167,1336,3168,3169,3170,3171,3172,3173,3174,3175,3176,3177,
+3178,0,3179,3180,3181,3182,3183,3184,3185,3186,3187,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,307,0,305,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,305,312,307,0,0,0,0,456,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,305,307,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,305,305,305,305,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,305,305,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,307,307,305,305,305,307,305,307,307,307,
+307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,305,307,305,307,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,456,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+456,0,0,0,0,0,0,0,0,0,0,0,0,0,0,456,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,3188,0,3189,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,3190,0,0,0,0,
+0,0,0,0,0,0,0,0,0,456,455,0,0,0,0,0,
+305,305,305,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,466,0,0,0,0,0,0,3191,3192,
+0,0,0,456,456,0,0,0,0,0,0,0,0,0,0,0,
+456,0,0,0,0,0,0,0,0,0,465,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,456,465,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,465,456,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,465,465,0,466,0,
+0,0,0,0,0,0,0,0,0,0,0,3193,3194,456,0,0,
+0,0,0,0,0,0,0,466,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,305,305,305,305,305,305,305,0,0,0,
+305,305,305,305,305,0,0,0,0,0,0,0,0,0,0,0,
+0,0,456,0,0,0,465,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,305,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+466,0,0,0,0,0,0,0,0,0,466,3195,3196,466,3197,0,
+0,0,456,465,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,466,
+0,0,0,0,0,0,0,0,0,0,3198,3199,0,0,0,456,
+465,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,456,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,456,465,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,456,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,456,465,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+466,0,0,0,0,0,0,0,3200,0,0,0,0,456,456,0,
+0,0,0,465,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+456,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,456,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,456,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,456,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,465,0,456,456,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,456,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+312,312,312,312,312,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+305,305,305,305,305,305,305,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3201,3201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,312,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,3202,3203,
+3204,3205,3206,3207,3208,512,512,312,312,312,0,0,0,3209,512,512,
+512,512,512,0,0,0,0,0,0,0,0,307,307,307,307,307,
+307,307,307,0,0,305,305,305,305,305,307,307,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,305,305,305,305,0,0,
+0,0,0,0,0,0,0,0,0,0,0,3210,3211,3212,3213,3214,
+3215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,305,305,305,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+548,550,1145,551,552,1161,554,555,556,557,558,559,560,561,562,564,
+1153,565,1334,566,567,1189,568,1194,1335,1157,3,572,598,573,574,601,
+578,285,595,287,579,301,580,1141,11,585,1336,288,181,586,587,590,
+292,302,293,628,548,550,1145,551,552,1161,554,555,556,557,558,559,
+560,561,562,564,1153,565,1334,566,567,1189,568,1194,1335,1157,3,572,
+598,573,574,601,578,0,595,287,579,301,580,1141,11,585,1336,288,
+181,586,587,590,292,302,293,628,548,550,1145,551,552,1161,554,555,
+556,557,558,559,560,561,562,564,1153,565,1334,566,567,1189,568,1194,
+1335,1157,3,572,598,573,574,601,578,285,595,287,579,301,580,1141,
+11,585,1336,288,181,586,587,590,292,302,293,628,548,0,1145,551,
+0,0,554,0,0,557,558,0,0,561,562,564,1153,0,1334,566,
+567,1189,568,1194,1335,1157,3,572,598,573,0,601,0,285,595,287,
+579,301,580,1141,0,585,1336,288,181,586,587,590,292,302,293,628,
+548,550,1145,551,552,1161,554,555,556,557,558,559,560,561,562,564,
+1153,565,1334,566,567,1189,568,1194,1335,1157,3,572,598,573,574,601,
+578,285,595,287,579,301,580,1141,11,585,1336,288,181,586,587,590,
+292,302,293,628,548,550,0,551,552,1161,554,0,0,557,558,559,
+560,561,562,564,1153,0,1334,566,567,1189,568,1194,1335,0,3,572,
+598,573,574,601,578,285,595,287,579,301,580,1141,11,585,1336,288,
+181,586,587,590,292,302,293,628,548,550,0,551,552,1161,554,0,
+556,557,558,559,560,0,562,0,0,0,1334,566,567,1189,568,1194,
+1335,0,3,572,598,573,574,601,578,285,595,287,579,301,580,1141,
+11,585,1336,288,181,586,587,590,292,302,293,628,548,550,1145,551,
+552,1161,554,555,556,557,558,559,560,561,562,564,1153,565,1334,566,
+567,1189,568,1194,1335,1157,3,572,598,573,574,601,578,285,595,287,
+579,301,580,1141,11,585,1336,288,181,586,587,590,292,302,293,628,
+548,550,1145,551,552,1161,554,555,556,557,558,559,560,561,562,564,
+1153,565,1334,566,567,1189,568,1194,1335,1157,3,572,598,573,574,601,
+578,285,595,287,579,301,580,1141,11,585,1336,288,181,586,587,590,
+292,302,293,628,548,550,1145,551,552,1161,554,555,556,557,558,559,
+560,561,562,564,1153,565,1334,566,567,1189,568,1194,1335,1157,3,572,
+598,573,574,601,578,285,595,287,579,301,580,1141,11,585,1336,288,
+181,586,587,590,292,302,293,628,548,550,1145,551,552,1161,554,555,
+556,557,558,559,560,561,562,564,1153,565,1334,566,567,1189,568,1194,
+1335,1157,3,572,598,573,574,601,578,285,595,287,579,301,580,1141,
+11,585,1336,288,181,586,587,590,292,302,293,628,548,550,1145,551,
+552,1161,554,555,556,557,558,559,560,561,562,564,1153,565,1334,566,
+567,1189,568,1194,1335,1157,3,572,598,573,574,601,578,285,595,287,
+579,301,580,1141,11,585,1336,288,181,586,587,590,292,302,293,628,
+548,550,1145,551,552,1161,554,555,556,557,558,559,560,561,562,564,
+1153,565,1334,566,567,1189,568,1194,1335,1157,3,572,598,573,574,601,
+578,285,595,287,579,301,580,1141,11,585,1336,288,181,586,587,590,
+292,302,293,628,3216,3217,0,0,3218,3219,1167,3220,3221,3222,3223,356,
+3224,3225,3226,3227,3228,3229,3230,1168,3231,356,358,3232,348,3233,3234,3235,
+3236,3237,3238,346,592,593,357,3239,3240,347,3241,353,3242,8,3243,3244,
+3245,352,354,355,3246,3247,3248,351,594,3249,3250,3251,357,347,353,351,
+354,352,3218,3219,1167,3220,3221,3222,3223,356,3224,3225,3226,3227,3228,3229,
+3230,1168,3231,356,358,3232,348,3233,3234,3235,3236,3237,3238,346,592,593,
+357,3239,3240,347,3241,353,3242,8,3243,3244,3245,352,354,355,3246,3247,
+3248,351,594,3249,3250,3251,357,347,353,351,354,352,3218,3219,1167,3220,
+3221,3222,3223,356,3224,3225,3226,3227,3228,3229,3230,1168,3231,356,358,3232,
+348,3233,3234,3235,3236,3237,3238,346,592,593,357,3239,3240,347,3241,353,
+3242,8,3243,3244,3245,352,354,355,3246,3247,3248,351,594,3249,3250,3251,
+357,347,353,351,354,352,3218,3219,1167,3220,3221,3222,3223,356,3224,3225,
+3226,3227,3228,3229,3230,1168,3231,356,358,3232,348,3233,3234,3235,3236,3237,
+3238,346,592,593,357,3239,3240,347,3241,353,3242,8,3243,3244,3245,352,
+354,355,3246,3247,3248,351,594,3249,3250,3251,357,347,353,351,354,352,
+3218,3219,1167,3220,3221,3222,3223,356,3224,3225,3226,3227,3228,3229,3230,1168,
+3231,356,358,3232,348,3233,3234,3235,3236,3237,3238,346,592,593,357,3239,
+3240,347,3241,353,3242,8,3243,3244,3245,352,354,355,3246,3247,3248,351,
+594,3249,3250,3251,357,347,353,351,354,352,3252,3253,0,0,1129,10,
+5,6,1130,1131,1132,1133,1134,1135,1129,10,5,6,1130,1131,1132,1133,
+1134,1135,1129,10,5,6,1130,1131,1132,1133,1134,1135,1129,10,5,6,
+1130,1131,1132,1133,1134,1135,1129,10,5,6,1130,1131,1132,1133,1134,1135,
+305,305,305,305,305,305,305,0,305,305,305,305,305,305,305,305,
+305,305,305,305,305,305,305,305,305,0,0,305,305,305,305,305,
+305,305,0,305,305,0,305,305,305,305,305,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,305,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,305,305,305,305,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+307,307,307,307,307,307,307,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,305,305,305,305,305,305,465,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3065,3066,3070,3073,0,3092,3076,3071,3081,3093,3087,3088,3089,3090,3077,3083,
+3085,3079,3086,3075,3078,3068,3069,3072,3074,3080,3082,3084,3254,2713,3255,3256,
+0,3066,3070,0,3091,0,0,3071,0,3093,3087,3088,3089,3090,3077,3083,
+3085,3079,3086,0,3078,3068,3069,3072,0,3080,0,3084,0,0,0,0,
+0,0,3070,0,0,0,0,3071,0,3093,0,3088,0,3090,3077,3083,
+0,3079,3086,0,3078,0,0,3072,0,3080,0,3084,0,2713,0,3256,
+0,3066,3070,0,3091,0,0,3071,3081,3093,3087,0,3089,3090,3077,3083,
+3085,3079,3086,0,3078,3068,3069,3072,0,3080,3082,3084,3254,0,3255,0,
+3065,3066,3070,3073,3091,3092,3076,3071,3081,3093,0,3088,3089,3090,3077,3083,
+3085,3079,3086,3075,3078,3068,3069,3072,3074,3080,3082,3084,0,0,0,0,
+0,3066,3070,3073,0,3092,3076,3071,3081,3093,0,3088,3089,3090,3077,3083,
+3085,3079,3086,3075,3078,3068,3069,3072,3074,3080,3082,3084,0,0,0,0,
+3257,3258,3259,3260,3261,3262,3263,3264,3265,3266,3267,0,0,0,0,0,
+3268,3269,3270,3271,3272,3273,3274,3275,3276,3277,3278,3279,3280,3281,3282,3283,
+3284,3285,3286,3287,3288,3289,3290,3291,3292,3293,3294,1145,565,3295,3296,0,
+548,550,1145,551,552,1161,554,555,556,557,558,559,560,561,562,564,
+1153,565,1334,566,567,1189,568,1194,1335,1157,3297,2129,3298,3299,3300,3301,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,3302,3303,3304,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3306,3307,1906,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1408,3308,3309,3310,1351,3311,3312,1728,3313,3314,3315,3316,3317,3318,3319,3320,
+3321,3322,1444,3323,3324,3325,3326,3327,3328,1345,1720,3329,1855,1723,1856,3330,
+1500,3331,3332,3333,3334,3335,1838,1418,3336,3337,3338,3339,0,0,0,0,
+3340,3341,3342,3343,3344,3345,3346,3347,3348,0,0,0,0,0,0,0,
+3349,3350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1129,10,5,6,1130,1131,1132,1133,1134,1135,0,0,0,0,0,0,
+3351,3352,3353,3354,3355,2497,3356,3357,3358,3359,2498,3360,3361,3362,2499,3363,
+3364,3365,3366,3367,3368,3369,3370,3371,3372,3373,3374,2557,3375,3376,3377,3378,
+3379,3380,3381,3382,3383,2562,2500,2501,2563,3384,3385,2308,3386,2502,3387,3388,
+3389,3390,3390,3390,3391,3392,3393,3394,3395,3396,3397,3398,3399,3400,3401,3402,
+3403,3404,3405,3406,3407,3408,3408,2565,3409,3410,3411,3412,2504,3413,3414,3415,
+2461,3416,3417,3418,3419,3420,3421,3422,3423,3424,3425,3426,3427,3428,3429,3430,
+3431,3432,3433,3434,3435,3436,3437,3438,3439,3440,3441,3441,3442,3443,3444,2304,
+3445,3446,3447,3448,3449,3450,3451,3452,2509,3453,3454,3455,3456,3457,3458,3459,
+3460,3461,3462,3463,3464,3465,3466,3467,3468,3469,3470,3471,3472,3473,2250,3474,
+3475,3476,3476,3477,3478,3478,3479,3480,3481,3482,3483,3484,3485,3486,3487,3488,
+3489,3490,3491,2510,3492,3493,3494,3495,2577,3495,3496,2512,3497,3498,3499,3500,
+2513,2223,3501,3502,3503,3504,3505,3506,3507,3508,3509,3510,3511,3512,3513,3514,
+3515,3516,3517,3518,3519,3520,3521,3522,2514,3523,3524,3525,3526,3527,3528,2516,
+3529,3530,3531,3532,3533,3534,3535,3536,2251,2585,3537,3538,3539,3540,3541,3542,
+3543,3544,2517,3545,3546,3547,3548,2628,3549,3550,3551,3552,3553,3554,3555,3556,
+3557,3558,3559,3560,3561,2321,3562,3563,3564,3565,3566,3567,3568,3569,3570,3571,
+3572,2518,2408,3573,3574,3575,3576,3577,3578,3579,3580,2589,3581,3582,3583,3584,
+3585,3586,3587,3588,2590,3589,3590,3591,3592,3593,3594,3595,3596,3597,3598,3599,
+3600,2592,3601,3602,3603,3604,3605,3606,3607,3608,3609,3610,3611,3611,3612,3613,
+2594,3614,3615,3616,3617,3618,3619,3620,2307,3621,3622,3623,3624,3625,3626,3627,
+2600,3628,3629,3630,3631,3632,3633,3633,2601,2630,3634,3635,3636,3637,3638,2269,
+2603,3639,3640,2529,3641,3642,2483,3643,3644,2533,3645,3646,3647,3648,3648,3649,
+3650,3651,3652,3653,3654,3655,3656,3657,3658,3659,3660,3661,3662,3663,3664,3665,
+3666,3667,3668,3669,3670,3671,3672,3673,3674,3675,2539,3676,3677,3678,3679,3680,
+3681,3682,3683,3684,3685,3686,3687,3688,3689,3690,3691,3477,3692,3693,3694,3695,
+3696,3697,3698,3699,3700,3701,3702,3703,2325,3704,3705,3706,3707,3708,3709,2542,
+3710,3711,3712,3713,3714,3715,3716,3717,3718,3719,3720,3721,3722,3723,3724,3725,
+3726,3727,3728,3729,2264,3730,3731,3732,3733,3734,3735,2610,3736,3737,3738,3739,
+3740,3741,3742,3743,3744,3745,3746,3747,3748,3749,3750,3751,3752,3753,3754,3755,
+2615,2616,3756,3757,3758,3759,3760,3761,3762,3763,3764,3765,3766,3767,3768,2617,
+3769,3770,3771,3772,3773,3774,3775,3776,3777,3778,3779,3780,3781,3782,3783,3784,
+3785,3786,3787,3788,3789,3790,3791,3792,3793,3794,3795,3796,3797,3798,2623,2623,
+3799,3800,3801,3802,3803,3804,3805,3806,3807,3808,2624,3809,3810,3811,3812,3813,
+3814,3815,3816,3817,3818,3819,3820,3821,3822,3823,3824,3825,3826,3827,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const unicode_norm_record unicode_norm_records[3828] = {  // ccc, qc, boundary, d_len, kd_len, d_offset, kd_offset
+{0, 0x00, 0xF, 0, 0, 0, 0},
+{0, 0x50, 0xB, 0, 1, 0, 0},
+{0, 0x50, 0xB, 0, 2, 0, 1},
+{0, 0x50, 0xB, 0, 1, 0, 3},
+{0, 0x50, 0xB, 0, 2, 0, 4},
+{0, 0x50, 0xB, 0, 1, 0, 6},
+{0, 0x50, 0xB, 0, 1, 0, 7},
+{0, 0x50, 0xB, 0, 2, 0, 8},
+{0, 0x50, 0xB, 0, 1, 0, 10},
+{0, 0x50, 0xB, 0, 2, 0, 11},
+{0, 0x50, 0xB, 0, 1, 0, 13},
+{0, 0x50, 0xB, 0, 1, 0, 14},
+{0, 0x50, 0xB, 0, 3, 0, 15},
+{0, 0x50, 0xB, 0, 3, 0, 18},
+{0, 0x50, 0xB, 0, 3, 0, 21},
+{0, 0x44, 0xF, 2, 2, 24, 24},
+{0, 0x44, 0xF, 2, 2, 26, 26},
+{0, 0x44, 0xF, 2, 2, 28, 28},
+{0, 0x44, 0xF, 2, 2, 30, 30},
+{0, 0x44, 0xF, 2, 2, 32, 32},
+{0, 0x44, 0xF, 2, 2, 34, 34},
+{0, 0x44, 0xF, 2, 2, 36, 36},
+{0, 0x44, 0xF, 2, 2, 38, 38},
+{0, 0x44, 0xF, 2, 2, 40, 40},
+{0, 0x44, 0xF, 2, 2, 42, 42},
+{0, 0x44, 0xF, 2, 2, 44, 44},
+{0, 0x44, 0xF, 2, 2, 46, 46},
+{0, 0x44, 0xF, 2, 2, 48, 48},
+{0, 0x44, 0xF, 2, 2, 50, 50},
+{0, 0x44, 0xF, 2, 2, 52, 52},
+{0, 0x44, 0xF, 2, 2, 54, 54},
+{0, 0x44, 0xF, 2, 2, 56, 56},
+{0, 0x44, 0xF, 2, 2, 58, 58},
+{0, 0x44, 0xF, 2, 2, 60, 60},
+{0, 0x44, 0xF, 2, 2, 62, 62},
+{0, 0x44, 0xF, 2, 2, 64, 64},
+{0, 0x44, 0xF, 2, 2, 66, 66},
+{0, 0x44, 0xF, 2, 2, 68, 68},
+{0, 0x44, 0xF, 2, 2, 70, 70},
+{0, 0x44, 0xF, 2, 2, 72, 72},
+{0, 0x44, 0xF, 2, 2, 74, 74},
+{0, 0x44, 0xF, 2, 2, 76, 76},
+{0, 0x44, 0xF, 2, 2, 78, 78},
+{0, 0x44, 0xF, 2, 2, 80, 80},
+{0, 0x44, 0xF, 2, 2, 82, 82},
+{0, 0x44, 0xF, 2, 2, 84, 84},
+{0, 0x44, 0xF, 2, 2, 86, 86},
+{0, 0x44, 0xF, 2, 2, 88, 88},
+{0, 0x44, 0xF, 2, 2, 90, 90},
+{0, 0x44, 0xF, 2, 2, 92, 92},
+{0, 0x44, 0xF, 2, 2, 94, 94},
+{0, 0x44, 0xF, 2, 2, 96, 96},
+{0, 0x44, 0xF, 2, 2, 98, 98},
+{0, 0x44, 0xF, 2, 2, 100, 100},
+{0, 0x44, 0xF, 2, 2, 102, 102},
+{0, 0x44, 0xF, 2, 2, 104, 104},
+{0, 0x44, 0xF, 2, 2, 106, 106},
+{0, 0x44, 0xF, 2, 2, 108, 108},
+{0, 0x44, 0xF, 2, 2, 110, 110},
+{0, 0x44, 0xF, 2, 2, 112, 112},
+{0, 0x44, 0xF, 2, 2, 114, 114},
+{0, 0x44, 0xF, 2, 2, 116, 116},
+{0, 0x44, 0xF, 2, 2, 118, 118},
+{0, 0x44, 0xF, 2, 2, 120, 120},
+{0, 0x44, 0xF, 2, 2, 122, 122},
+{0, 0x44, 0xF, 2, 2, 124, 124},
+{0, 0x44, 0xF, 2, 2, 126, 126},
+{0, 0x44, 0xF, 2, 2, 128, 128},
+{0, 0x44, 0xF, 2, 2, 130, 130},
+{0, 0x44, 0xF, 2, 2, 132, 132},
+{0, 0x44, 0xF, 2, 2, 134, 134},
+{0, 0x44, 0xF, 2, 2, 136, 136},
+{0, 0x44, 0xF, 2, 2, 138, 138},
+{0, 0x44, 0xF, 2, 2, 140, 140},
+{0, 0x44, 0xF, 2, 2, 142, 142},
+{0, 0x44, 0xF, 2, 2, 144, 144},
+{0, 0x44, 0xF, 2, 2, 146, 146},
+{0, 0x44, 0xF, 2, 2, 148, 148},
+{0, 0x44, 0xF, 2, 2, 150, 150},
+{0, 0x44, 0xF, 2, 2, 152, 152},
+{0, 0x44, 0xF, 2, 2, 154, 154},
+{0, 0x44, 0xF, 2, 2, 156, 156},
+{0, 0x44, 0xF, 2, 2, 158, 158},
+{0, 0x44, 0xF, 2, 2, 160, 160},
+{0, 0x44, 0xF, 2, 2, 162, 162},
+{0, 0x44, 0xF, 2, 2, 164, 164},
+{0, 0x44, 0xF, 2, 2, 166, 166},
+{0, 0x44, 0xF, 2, 2, 168, 168},
+{0, 0x44, 0xF, 2, 2, 170, 170},
+{0, 0x44, 0xF, 2, 2, 172, 172},
+{0, 0x44, 0xF, 2, 2, 174, 174},
+{0, 0x44, 0xF, 2, 2, 176, 176},
+{0, 0x44, 0xF, 2, 2, 178, 178},
+{0, 0x44, 0xF, 2, 2, 180, 180},
+{0, 0x44, 0xF, 2, 2, 182, 182},
+{0, 0x44, 0xF, 2, 2, 184, 184},
+{0, 0x44, 0xF, 2, 2, 186, 186},
+{0, 0x44, 0xF, 2, 2, 188, 188},
+{0, 0x44, 0xF, 2, 2, 190, 190},
+{0, 0x44, 0xF, 2, 2, 192, 192},
+{0, 0x44, 0xF, 2, 2, 194, 194},
+{0, 0x44, 0xF, 2, 2, 196, 196},
+{0, 0x44, 0xF, 2, 2, 198, 198},
+{0, 0x44, 0xF, 2, 2, 200, 200},
+{0, 0x44, 0xF, 2, 2, 202, 202},
+{0, 0x44, 0xF, 2, 2, 204, 204},
+{0, 0x44, 0xF, 2, 2, 206, 206},
+{0, 0x44, 0xF, 2, 2, 208, 208},
+{0, 0x44, 0xF, 2, 2, 210, 210},
+{0, 0x44, 0xF, 2, 2, 212, 212},
+{0, 0x44, 0xF, 2, 2, 214, 214},
+{0, 0x44, 0xF, 2, 2, 216, 216},
+{0, 0x44, 0xF, 2, 2, 218, 218},
+{0, 0x50, 0xB, 0, 2, 0, 220},
+{0, 0x50, 0xB, 0, 2, 0, 222},
+{0, 0x44, 0xF, 2, 2, 224, 224},
+{0, 0x44, 0xF, 2, 2, 226, 226},
+{0, 0x44, 0xF, 2, 2, 228, 228},
+{0, 0x44, 0xF, 2, 2, 230, 230},
+{0, 0x44, 0xF, 2, 2, 232, 232},
+{0, 0x44, 0xF, 2, 2, 234, 234},
+{0, 0x44, 0xF, 2, 2, 236, 236},
+{0, 0x44, 0xF, 2, 2, 238, 238},
+{0, 0x44, 0xF, 2, 2, 240, 240},
+{0, 0x44, 0xF, 2, 2, 242, 242},
+{0, 0x50, 0xB, 0, 2, 0, 244},
+{0, 0x50, 0xB, 0, 2, 0, 246},
+{0, 0x44, 0xF, 2, 2, 248, 248},
+{0, 0x44, 0xF, 2, 2, 250, 250},
+{0, 0x44, 0xF, 2, 2, 252, 252},
+{0, 0x44, 0xF, 2, 2, 254, 254},
+{0, 0x44, 0xF, 2, 2, 256, 256},
+{0, 0x44, 0xF, 2, 2, 258, 258},
+{0, 0x50, 0xB, 0, 2, 0, 260},
+{0, 0x44, 0xF, 2, 2, 262, 262},
+{0, 0x44, 0xF, 2, 2, 264, 264},
+{0, 0x44, 0xF, 2, 2, 266, 266},
+{0, 0x44, 0xF, 2, 2, 268, 268},
+{0, 0x44, 0xF, 2, 2, 270, 270},
+{0, 0x44, 0xF, 2, 2, 272, 272},
+{0, 0x44, 0xF, 2, 2, 274, 274},
+{0, 0x44, 0xF, 2, 2, 276, 276},
+{0, 0x44, 0xF, 2, 2, 278, 278},
+{0, 0x44, 0xF, 2, 2, 280, 280},
+{0, 0x44, 0xF, 2, 2, 282, 282},
+{0, 0x44, 0xF, 2, 2, 284, 284},
+{0, 0x44, 0xF, 2, 2, 286, 286},
+{0, 0x44, 0xF, 2, 2, 288, 288},
+{0, 0x44, 0xF, 2, 2, 290, 290},
+{0, 0x44, 0xF, 2, 2, 292, 292},
+{0, 0x44, 0xF, 2, 2, 294, 294},
+{0, 0x44, 0xF, 2, 2, 296, 296},
+{0, 0x44, 0xF, 2, 2, 298, 298},
+{0, 0x44, 0xF, 2, 2, 300, 300},
+{0, 0x44, 0xF, 2, 2, 302, 302},
+{0, 0x44, 0xF, 2, 2, 304, 304},
+{0, 0x44, 0xF, 2, 2, 306, 306},
+{0, 0x44, 0xF, 2, 2, 308, 308},
+{0, 0x44, 0xF, 2, 2, 310, 310},
+{0, 0x44, 0xF, 2, 2, 312, 312},
+{0, 0x44, 0xF, 2, 2, 314, 314},
+{0, 0x44, 0xF, 2, 2, 316, 316},
+{0, 0x44, 0xF, 2, 2, 318, 318},
+{0, 0x44, 0xF, 2, 2, 320, 320},
+{0, 0x44, 0xF, 2, 2, 322, 322},
+{0, 0x44, 0xF, 2, 2, 324, 324},
+{0, 0x44, 0xF, 2, 2, 326, 326},
+{0, 0x44, 0xF, 2, 2, 328, 328},
+{0, 0x44, 0xF, 2, 2, 330, 330},
+{0, 0x44, 0xF, 2, 2, 332, 332},
+{0, 0x44, 0xF, 2, 2, 334, 334},
+{0, 0x44, 0xF, 2, 2, 336, 336},
+{0, 0x44, 0xF, 2, 2, 338, 338},
+{0, 0x44, 0xF, 2, 2, 340, 340},
+{0, 0x44, 0xF, 2, 2, 342, 342},
+{0, 0x44, 0xF, 2, 2, 344, 344},
+{0, 0x44, 0xF, 2, 2, 346, 346},
+{0, 0x44, 0xF, 2, 2, 348, 348},
+{0, 0x44, 0xF, 2, 2, 350, 350},
+{0, 0x44, 0xF, 2, 2, 352, 352},
+{0, 0x44, 0xF, 2, 2, 354, 354},
+{0, 0x50, 0xB, 0, 1, 0, 356},
+{0, 0x44, 0xF, 2, 2, 357, 357},
+{0, 0x44, 0xF, 2, 2, 359, 359},
+{0, 0x44, 0xF, 2, 2, 361, 361},
+{0, 0x44, 0xF, 2, 2, 363, 363},
+{0, 0x50, 0xB, 0, 3, 0, 365},
+{0, 0x50, 0xB, 0, 3, 0, 368},
+{0, 0x50, 0xB, 0, 3, 0, 371},
+{0, 0x50, 0xB, 0, 2, 0, 374},
+{0, 0x50, 0xB, 0, 2, 0, 376},
+{0, 0x50, 0xB, 0, 2, 0, 378},
+{0, 0x50, 0xB, 0, 2, 0, 380},
+{0, 0x50, 0xB, 0, 2, 0, 382},
+{0, 0x50, 0xB, 0, 2, 0, 384},
+{0, 0x44, 0xF, 2, 2, 386, 386},
+{0, 0x44, 0xF, 2, 2, 388, 388},
+{0, 0x44, 0xF, 2, 2, 390, 390},
+{0, 0x44, 0xF, 2, 2, 392, 392},
+{0, 0x44, 0xF, 2, 2, 394, 394},
+{0, 0x44, 0xF, 2, 2, 396, 396},
+{0, 0x44, 0xF, 2, 2, 398, 398},
+{0, 0x44, 0xF, 2, 2, 400, 400},
+{0, 0x44, 0xF, 3, 3, 402, 402},
+{0, 0x44, 0xF, 3, 3, 405, 405},
+{0, 0x44, 0xF, 3, 3, 408, 408},
+{0, 0x44, 0xF, 3, 3, 411, 411},
+{0, 0x44, 0xF, 3, 3, 414, 414},
+{0, 0x44, 0xF, 3, 3, 417, 417},
+{0, 0x44, 0xF, 3, 3, 420, 420},
+{0, 0x44, 0xF, 3, 3, 423, 423},
+{0, 0x44, 0xF, 3, 3, 426, 426},
+{0, 0x44, 0xF, 3, 3, 429, 429},
+{0, 0x44, 0xF, 3, 3, 432, 432},
+{0, 0x44, 0xF, 3, 3, 435, 435},
+{0, 0x44, 0xF, 2, 2, 438, 438},
+{0, 0x44, 0xF, 2, 2, 440, 440},
+{0, 0x44, 0xF, 2, 2, 442, 442},
+{0, 0x44, 0xF, 2, 2, 444, 444},
+{0, 0x44, 0xF, 2, 2, 446, 446},
+{0, 0x44, 0xF, 2, 2, 448, 448},
+{0, 0x44, 0xF, 2, 2, 450, 450},
+{0, 0x44, 0xF, 2, 2, 452, 452},
+{0, 0x44, 0xF, 3, 3, 454, 454},
+{0, 0x44, 0xF, 3, 3, 457, 457},
+{0, 0x44, 0xF, 2, 2, 460, 460},
+{0, 0x44, 0xF, 2, 2, 462, 462},
+{0, 0x44, 0xF, 2, 2, 464, 464},
+{0, 0x50, 0xB, 0, 2, 0, 466},
+{0, 0x50, 0xB, 0, 2, 0, 468},
+{0, 0x50, 0xB, 0, 2, 0, 470},
+{0, 0x44, 0xF, 2, 2, 472, 472},
+{0, 0x44, 0xF, 2, 2, 474, 474},
+{0, 0x44, 0xF, 2, 2, 476, 476},
+{0, 0x44, 0xF, 2, 2, 478, 478},
+{0, 0x44, 0xF, 3, 3, 480, 480},
+{0, 0x44, 0xF, 3, 3, 483, 483},
+{0, 0x44, 0xF, 2, 2, 486, 486},
+{0, 0x44, 0xF, 2, 2, 488, 488},
+{0, 0x44, 0xF, 2, 2, 490, 490},
+{0, 0x44, 0xF, 2, 2, 492, 492},
+{0, 0x44, 0xF, 2, 2, 494, 494},
+{0, 0x44, 0xF, 2, 2, 496, 496},
+{0, 0x44, 0xF, 2, 2, 498, 498},
+{0, 0x44, 0xF, 2, 2, 500, 500},
+{0, 0x44, 0xF, 2, 2, 502, 502},
+{0, 0x44, 0xF, 2, 2, 504, 504},
+{0, 0x44, 0xF, 2, 2, 506, 506},
+{0, 0x44, 0xF, 2, 2, 508, 508},
+{0, 0x44, 0xF, 2, 2, 510, 510},
+{0, 0x44, 0xF, 2, 2, 512, 512},
+{0, 0x44, 0xF, 2, 2, 514, 514},
+{0, 0x44, 0xF, 2, 2, 516, 516},
+{0, 0x44, 0xF, 2, 2, 518, 518},
+{0, 0x44, 0xF, 2, 2, 520, 520},
+{0, 0x44, 0xF, 2, 2, 522, 522},
+{0, 0x44, 0xF, 2, 2, 524, 524},
+{0, 0x44, 0xF, 2, 2, 526, 526},
+{0, 0x44, 0xF, 2, 2, 528, 528},
+{0, 0x44, 0xF, 2, 2, 530, 530},
+{0, 0x44, 0xF, 2, 2, 532, 532},
+{0, 0x44, 0xF, 2, 2, 534, 534},
+{0, 0x44, 0xF, 2, 2, 536, 536},
+{0, 0x44, 0xF, 2, 2, 538, 538},
+{0, 0x44, 0xF, 2, 2, 540, 540},
+{0, 0x44, 0xF, 2, 2, 542, 542},
+{0, 0x44, 0xF, 2, 2, 544, 544},
+{0, 0x44, 0xF, 2, 2, 546, 546},
+{0, 0x44, 0xF, 2, 2, 548, 548},
+{0, 0x44, 0xF, 2, 2, 550, 550},
+{0, 0x44, 0xF, 2, 2, 552, 552},
+{0, 0x44, 0xF, 2, 2, 554, 554},
+{0, 0x44, 0xF, 2, 2, 556, 556},
+{0, 0x44, 0xF, 2, 2, 558, 558},
+{0, 0x44, 0xF, 2, 2, 560, 560},
+{0, 0x44, 0xF, 3, 3, 562, 562},
+{0, 0x44, 0xF, 3, 3, 565, 565},
+{0, 0x44, 0xF, 3, 3, 568, 568},
+{0, 0x44, 0xF, 3, 3, 571, 571},
+{0, 0x44, 0xF, 2, 2, 574, 574},
+{0, 0x44, 0xF, 2, 2, 576, 576},
+{0, 0x44, 0xF, 3, 3, 578, 578},
+{0, 0x44, 0xF, 3, 3, 581, 581},
+{0, 0x44, 0xF, 2, 2, 584, 584},
+{0, 0x44, 0xF, 2, 2, 586, 586},
+{0, 0x50, 0xB, 0, 1, 0, 588},
+{0, 0x50, 0xB, 0, 1, 0, 589},
+{0, 0x50, 0xB, 0, 1, 0, 590},
+{0, 0x50, 0xB, 0, 1, 0, 591},
+{0, 0x50, 0xB, 0, 1, 0, 592},
+{0, 0x50, 0xB, 0, 1, 0, 593},
+{0, 0x50, 0xB, 0, 1, 0, 594},
+{0, 0x50, 0xB, 0, 1, 0, 595},
+{0, 0x50, 0xB, 0, 1, 0, 596},
+{0, 0x50, 0xB, 0, 2, 0, 597},
+{0, 0x50, 0xB, 0, 2, 0, 599},
+{0, 0x50, 0xB, 0, 2, 0, 601},
+{0, 0x50, 0xB, 0, 2, 0, 603},
+{0, 0x50, 0xB, 0, 2, 0, 605},
+{0, 0x50, 0xB, 0, 2, 0, 607},
+{0, 0x50, 0xB, 0, 1, 0, 609},
+{0, 0x50, 0xB, 0, 1, 0, 610},
+{0, 0x50, 0xB, 0, 1, 0, 611},
+{0, 0x50, 0xB, 0, 1, 0, 612},
+{230, 0x22, 0x0, 0, 0, 0, 0},
+{230, 0x00, 0x0, 0, 0, 0, 0},
+{232, 0x00, 0x0, 0, 0, 0, 0},
+{220, 0x00, 0x0, 0, 0, 0, 0},
+{216, 0x22, 0x0, 0, 0, 0, 0},
+{202, 0x00, 0x0, 0, 0, 0, 0},
+{220, 0x22, 0x0, 0, 0, 0, 0},
+{202, 0x22, 0x0, 0, 0, 0, 0},
+{1, 0x00, 0x0, 0, 0, 0, 0},
+{1, 0x22, 0x0, 0, 0, 0, 0},
+{230, 0x55, 0x0, 1, 1, 613, 613},
+{230, 0x55, 0x0, 1, 1, 614, 614},
+{230, 0x55, 0x0, 1, 1, 615, 615},
+{230, 0x55, 0x0, 2, 2, 616, 616},
+{240, 0x22, 0x0, 0, 0, 0, 0},
+{233, 0x00, 0x0, 0, 0, 0, 0},
+{234, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x55, 0xA, 1, 1, 618, 618},
+{0, 0x50, 0xB, 0, 2, 0, 619},
+{0, 0x55, 0xA, 1, 1, 621, 621},
+{0, 0x54, 0xB, 2, 3, 622, 624},
+{0, 0x44, 0xF, 2, 2, 627, 627},
+{0, 0x55, 0xA, 1, 1, 629, 629},
+{0, 0x44, 0xF, 2, 2, 630, 630},
+{0, 0x44, 0xF, 2, 2, 632, 632},
+{0, 0x44, 0xF, 2, 2, 634, 634},
+{0, 0x44, 0xF, 2, 2, 636, 636},
+{0, 0x44, 0xF, 2, 2, 638, 638},
+{0, 0x44, 0xF, 2, 2, 640, 640},
+{0, 0x44, 0xF, 3, 3, 642, 642},
+{0, 0x44, 0xF, 2, 2, 645, 645},
+{0, 0x44, 0xF, 2, 2, 647, 647},
+{0, 0x44, 0xF, 2, 2, 649, 649},
+{0, 0x44, 0xF, 2, 2, 651, 651},
+{0, 0x44, 0xF, 2, 2, 653, 653},
+{0, 0x44, 0xF, 2, 2, 655, 655},
+{0, 0x44, 0xF, 3, 3, 657, 657},
+{0, 0x44, 0xF, 2, 2, 660, 660},
+{0, 0x44, 0xF, 2, 2, 662, 662},
+{0, 0x44, 0xF, 2, 2, 664, 664},
+{0, 0x44, 0xF, 2, 2, 666, 666},
+{0, 0x44, 0xF, 2, 2, 668, 668},
+{0, 0x50, 0xB, 0, 1, 0, 670},
+{0, 0x50, 0xB, 0, 1, 0, 671},
+{0, 0x50, 0xB, 0, 1, 0, 672},
+{0, 0x54, 0xB, 2, 2, 673, 638},
+{0, 0x54, 0xB, 2, 2, 675, 647},
+{0, 0x50, 0xB, 0, 1, 0, 677},
+{0, 0x50, 0xB, 0, 1, 0, 678},
+{0, 0x50, 0xB, 0, 1, 0, 679},
+{0, 0x50, 0xB, 0, 1, 0, 680},
+{0, 0x50, 0xB, 0, 1, 0, 681},
+{0, 0x50, 0xB, 0, 1, 0, 682},
+{0, 0x50, 0xB, 0, 1, 0, 683},
+{0, 0x50, 0xB, 0, 1, 0, 684},
+{0, 0x44, 0xF, 2, 2, 685, 685},
+{0, 0x44, 0xF, 2, 2, 687, 687},
+{0, 0x44, 0xF, 2, 2, 689, 689},
+{0, 0x44, 0xF, 2, 2, 691, 691},
+{0, 0x44, 0xF, 2, 2, 693, 693},
+{0, 0x44, 0xF, 2, 2, 695, 695},
+{0, 0x44, 0xF, 2, 2, 697, 697},
+{0, 0x44, 0xF, 2, 2, 699, 699},
+{0, 0x44, 0xF, 2, 2, 701, 701},
+{0, 0x44, 0xF, 2, 2, 703, 703},
+{0, 0x44, 0xF, 2, 2, 705, 705},
+{0, 0x44, 0xF, 2, 2, 707, 707},
+{0, 0x44, 0xF, 2, 2, 709, 709},
+{0, 0x44, 0xF, 2, 2, 711, 711},
+{0, 0x44, 0xF, 2, 2, 713, 713},
+{0, 0x44, 0xF, 2, 2, 715, 715},
+{0, 0x44, 0xF, 2, 2, 717, 717},
+{0, 0x44, 0xF, 2, 2, 719, 719},
+{0, 0x44, 0xF, 2, 2, 721, 721},
+{0, 0x44, 0xF, 2, 2, 723, 723},
+{0, 0x44, 0xF, 2, 2, 725, 725},
+{0, 0x44, 0xF, 2, 2, 727, 727},
+{0, 0x44, 0xF, 2, 2, 729, 729},
+{0, 0x44, 0xF, 2, 2, 731, 731},
+{0, 0x44, 0xF, 2, 2, 733, 733},
+{0, 0x44, 0xF, 2, 2, 735, 735},
+{0, 0x44, 0xF, 2, 2, 737, 737},
+{0, 0x44, 0xF, 2, 2, 739, 739},
+{0, 0x44, 0xF, 2, 2, 741, 741},
+{0, 0x44, 0xF, 2, 2, 743, 743},
+{0, 0x44, 0xF, 2, 2, 745, 745},
+{0, 0x44, 0xF, 2, 2, 747, 747},
+{0, 0x44, 0xF, 2, 2, 749, 749},
+{0, 0x44, 0xF, 2, 2, 751, 751},
+{0, 0x44, 0xF, 2, 2, 753, 753},
+{0, 0x44, 0xF, 2, 2, 755, 755},
+{0, 0x44, 0xF, 2, 2, 757, 757},
+{0, 0x44, 0xF, 2, 2, 759, 759},
+{0, 0x44, 0xF, 2, 2, 761, 761},
+{0, 0x44, 0xF, 2, 2, 763, 763},
+{0, 0x44, 0xF, 2, 2, 765, 765},
+{0, 0x44, 0xF, 2, 2, 767, 767},
+{0, 0x44, 0xF, 2, 2, 769, 769},
+{0, 0x44, 0xF, 2, 2, 771, 771},
+{0, 0x44, 0xF, 2, 2, 773, 773},
+{0, 0x44, 0xF, 2, 2, 775, 775},
+{0, 0x44, 0xF, 2, 2, 777, 777},
+{0, 0x44, 0xF, 2, 2, 779, 779},
+{0, 0x44, 0xF, 2, 2, 781, 781},
+{0, 0x44, 0xF, 2, 2, 783, 783},
+{0, 0x44, 0xF, 2, 2, 785, 785},
+{0, 0x44, 0xF, 2, 2, 787, 787},
+{0, 0x50, 0xB, 0, 2, 0, 789},
+{222, 0x00, 0x0, 0, 0, 0, 0},
+{228, 0x00, 0x0, 0, 0, 0, 0},
+{10, 0x00, 0x0, 0, 0, 0, 0},
+{11, 0x00, 0x0, 0, 0, 0, 0},
+{12, 0x00, 0x0, 0, 0, 0, 0},
+{13, 0x00, 0x0, 0, 0, 0, 0},
+{14, 0x00, 0x0, 0, 0, 0, 0},
+{15, 0x00, 0x0, 0, 0, 0, 0},
+{16, 0x00, 0x0, 0, 0, 0, 0},
+{17, 0x00, 0x0, 0, 0, 0, 0},
+{18, 0x00, 0x0, 0, 0, 0, 0},
+{19, 0x00, 0x0, 0, 0, 0, 0},
+{20, 0x00, 0x0, 0, 0, 0, 0},
+{21, 0x00, 0x0, 0, 0, 0, 0},
+{22, 0x00, 0x0, 0, 0, 0, 0},
+{23, 0x00, 0x0, 0, 0, 0, 0},
+{24, 0x00, 0x0, 0, 0, 0, 0},
+{25, 0x00, 0x0, 0, 0, 0, 0},
+{30, 0x00, 0x0, 0, 0, 0, 0},
+{31, 0x00, 0x0, 0, 0, 0, 0},
+{32, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x44, 0xF, 2, 2, 791, 791},
+{0, 0x44, 0xF, 2, 2, 793, 793},
+{0, 0x44, 0xF, 2, 2, 795, 795},
+{0, 0x44, 0xF, 2, 2, 797, 797},
+{0, 0x44, 0xF, 2, 2, 799, 799},
+{27, 0x00, 0x0, 0, 0, 0, 0},
+{28, 0x00, 0x0, 0, 0, 0, 0},
+{29, 0x00, 0x0, 0, 0, 0, 0},
+{33, 0x00, 0x0, 0, 0, 0, 0},
+{34, 0x00, 0x0, 0, 0, 0, 0},
+{35, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x50, 0xB, 0, 2, 0, 801},
+{0, 0x50, 0xB, 0, 2, 0, 803},
+{0, 0x50, 0xB, 0, 2, 0, 805},
+{0, 0x50, 0xB, 0, 2, 0, 807},
+{0, 0x44, 0xF, 2, 2, 809, 809},
+{0, 0x44, 0xF, 2, 2, 811, 811},
+{0, 0x44, 0xF, 2, 2, 813, 813},
+{36, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x44, 0xF, 2, 2, 815, 815},
+{0, 0x44, 0xF, 2, 2, 817, 817},
+{0, 0x44, 0xF, 2, 2, 819, 819},
+{7, 0x22, 0x0, 0, 0, 0, 0},
+{9, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x55, 0xA, 2, 2, 821, 821},
+{0, 0x55, 0xA, 2, 2, 823, 823},
+{0, 0x55, 0xA, 2, 2, 825, 825},
+{0, 0x55, 0xA, 2, 2, 827, 827},
+{0, 0x55, 0xA, 2, 2, 829, 829},
+{0, 0x55, 0xA, 2, 2, 831, 831},
+{0, 0x55, 0xA, 2, 2, 833, 833},
+{0, 0x55, 0xA, 2, 2, 835, 835},
+{7, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x22, 0xA, 0, 0, 0, 0},
+{0, 0x44, 0xF, 2, 2, 837, 837},
+{0, 0x44, 0xF, 2, 2, 839, 839},
+{0, 0x55, 0xA, 2, 2, 841, 841},
+{0, 0x55, 0xA, 2, 2, 843, 843},
+{0, 0x55, 0xA, 2, 2, 845, 845},
+{0, 0x55, 0xA, 2, 2, 847, 847},
+{0, 0x55, 0xA, 2, 2, 849, 849},
+{0, 0x55, 0xA, 2, 2, 851, 851},
+{0, 0x55, 0xA, 2, 2, 853, 853},
+{0, 0x55, 0xA, 2, 2, 855, 855},
+{0, 0x55, 0xA, 2, 2, 857, 857},
+{0, 0x44, 0xF, 2, 2, 859, 859},
+{0, 0x44, 0xF, 2, 2, 861, 861},
+{0, 0x44, 0xF, 2, 2, 863, 863},
+{0, 0x55, 0xA, 2, 2, 865, 865},
+{0, 0x55, 0xA, 2, 2, 867, 867},
+{0, 0x44, 0xF, 2, 2, 869, 869},
+{0, 0x44, 0xF, 2, 2, 871, 871},
+{0, 0x44, 0xF, 2, 2, 873, 873},
+{0, 0x44, 0xF, 2, 2, 875, 875},
+{0, 0x44, 0xF, 2, 2, 877, 877},
+{84, 0x00, 0x0, 0, 0, 0, 0},
+{91, 0x22, 0x0, 0, 0, 0, 0},
+{0, 0x44, 0xF, 2, 2, 879, 879},
+{0, 0x44, 0xF, 2, 2, 881, 881},
+{0, 0x44, 0xF, 2, 2, 883, 883},
+{0, 0x44, 0xF, 2, 2, 885, 885},
+{0, 0x44, 0xF, 3, 3, 887, 887},
+{0, 0x44, 0xF, 2, 2, 890, 890},
+{0, 0x44, 0xF, 2, 2, 892, 892},
+{0, 0x44, 0xF, 2, 2, 894, 894},
+{9, 0x22, 0x0, 0, 0, 0, 0},
+{0, 0x44, 0xF, 2, 2, 896, 896},
+{0, 0x44, 0xF, 2, 2, 898, 898},
+{0, 0x44, 0xF, 3, 3, 900, 900},
+{0, 0x44, 0xF, 2, 2, 903, 903},
+{0, 0x50, 0xB, 0, 2, 0, 905},
+{103, 0x00, 0x0, 0, 0, 0, 0},
+{107, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x50, 0xB, 0, 2, 0, 907},
+{118, 0x00, 0x0, 0, 0, 0, 0},
+{122, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x50, 0xB, 0, 2, 0, 909},
+{0, 0x50, 0xB, 0, 2, 0, 911},
+{0, 0x50, 0xB, 0, 1, 0, 913},
+{216, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x55, 0xA, 2, 2, 914, 914},
+{0, 0x55, 0xA, 2, 2, 916, 916},
+{0, 0x55, 0xA, 2, 2, 918, 918},
+{0, 0x55, 0xA, 2, 2, 920, 920},
+{0, 0x55, 0xA, 2, 2, 922, 922},
+{0, 0x55, 0xA, 2, 2, 924, 924},
+{129, 0x00, 0x0, 0, 0, 0, 0},
+{130, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x55, 0x0, 2, 2, 926, 926},
+{132, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x55, 0x0, 2, 2, 928, 928},
+{0, 0x55, 0xA, 2, 2, 930, 930},
+{0, 0x50, 0xB, 0, 3, 0, 932},
+{0, 0x55, 0xA, 2, 2, 935, 935},
+{0, 0x50, 0xB, 0, 3, 0, 937},
+{0, 0x55, 0x0, 2, 2, 940, 940},
+{0, 0x55, 0xA, 2, 2, 942, 942},
+{0, 0x55, 0xA, 2, 2, 944, 944},
+{0, 0x55, 0xA, 2, 2, 946, 946},
+{0, 0x55, 0xA, 2, 2, 948, 948},
+{0, 0x55, 0xA, 2, 2, 950, 950},
+{0, 0x55, 0xA, 2, 2, 952, 952},
+{0, 0x44, 0xF, 2, 2, 954, 954},
+{0, 0x50, 0xB, 0, 1, 0, 956},
+{0, 0x44, 0xF, 2, 2, 957, 957},
+{0, 0x44, 0xF, 2, 2, 959, 959},
+{0, 0x44, 0xF, 2, 2, 961, 961},
+{0, 0x44, 0xF, 2, 2, 963, 963},
+{0, 0x44, 0xF, 2, 2, 965, 965},
+{0, 0x44, 0xF, 2, 2, 967, 967},
+{0, 0x44, 0xF, 2, 2, 969, 969},
+{0, 0x44, 0xF, 2, 2, 971, 971},
+{0, 0x44, 0xF, 2, 2, 973, 973},
+{0, 0x44, 0xF, 2, 2, 975, 975},
+{0, 0x44, 0xF, 2, 2, 977, 977},
+{0, 0x50, 0xB, 0, 1, 0, 979},
+{0, 0x50, 0xB, 0, 1, 0, 980},
+{0, 0x50, 0xB, 0, 1, 0, 981},
+{0, 0x50, 0xB, 0, 1, 0, 982},
+{0, 0x50, 0xB, 0, 1, 0, 983},
+{0, 0x50, 0xB, 0, 1, 0, 984},
+{0, 0x50, 0xB, 0, 1, 0, 985},
+{0, 0x50, 0xB, 0, 1, 0, 986},
+{0, 0x50, 0xB, 0, 1, 0, 987},
+{0, 0x50, 0xB, 0, 1, 0, 988},
+{0, 0x50, 0xB, 0, 1, 0, 989},
+{0, 0x50, 0xB, 0, 1, 0, 990},
+{0, 0x50, 0xB, 0, 1, 0, 991},
+{0, 0x50, 0xB, 0, 1, 0, 992},
+{0, 0x50, 0xB, 0, 1, 0, 993},
+{0, 0x50, 0xB, 0, 1, 0, 994},
+{0, 0x50, 0xB, 0, 1, 0, 995},
+{0, 0x50, 0xB, 0, 1, 0, 996},
+{0, 0x50, 0xB, 0, 1, 0, 997},
+{0, 0x50, 0xB, 0, 1, 0, 998},
+{0, 0x50, 0xB, 0, 1, 0, 999},
+{0, 0x50, 0xB, 0, 1, 0, 1000},
+{0, 0x50, 0xB, 0, 1, 0, 1001},
+{0, 0x50, 0xB, 0, 1, 0, 1002},
+{0, 0x50, 0xB, 0, 1, 0, 1003},
+{0, 0x50, 0xB, 0, 1, 0, 1004},
+{0, 0x50, 0xB, 0, 1, 0, 1005},
+{0, 0x50, 0xB, 0, 1, 0, 1006},
+{0, 0x50, 0xB, 0, 1, 0, 1007},
+{0, 0x50, 0xB, 0, 1, 0, 1008},
+{0, 0x50, 0xB, 0, 1, 0, 1009},
+{0, 0x50, 0xB, 0, 1, 0, 1010},
+{0, 0x50, 0xB, 0, 1, 0, 1011},
+{0, 0x50, 0xB, 0, 1, 0, 1012},
+{0, 0x50, 0xB, 0, 1, 0, 1013},
+{0, 0x50, 0xB, 0, 1, 0, 1014},
+{0, 0x50, 0xB, 0, 1, 0, 1015},
+{0, 0x50, 0xB, 0, 1, 0, 1016},
+{0, 0x50, 0xB, 0, 1, 0, 1017},
+{0, 0x50, 0xB, 0, 1, 0, 1018},
+{0, 0x50, 0xB, 0, 1, 0, 1019},
+{0, 0x50, 0xB, 0, 1, 0, 1020},
+{0, 0x50, 0xB, 0, 1, 0, 1021},
+{0, 0x50, 0xB, 0, 1, 0, 1022},
+{0, 0x50, 0xB, 0, 1, 0, 1023},
+{0, 0x50, 0xB, 0, 1, 0, 1024},
+{0, 0x50, 0xB, 0, 1, 0, 1025},
+{0, 0x50, 0xB, 0, 1, 0, 1026},
+{0, 0x50, 0xB, 0, 1, 0, 1027},
+{0, 0x50, 0xB, 0, 1, 0, 1028},
+{0, 0x50, 0xB, 0, 1, 0, 1029},
+{0, 0x50, 0xB, 0, 1, 0, 1030},
+{0, 0x50, 0xB, 0, 1, 0, 1031},
+{0, 0x50, 0xB, 0, 1, 0, 1032},
+{0, 0x50, 0xB, 0, 1, 0, 1033},
+{0, 0x50, 0xB, 0, 1, 0, 1034},
+{0, 0x50, 0xB, 0, 1, 0, 1035},
+{0, 0x50, 0xB, 0, 1, 0, 1036},
+{0, 0x50, 0xB, 0, 1, 0, 1037},
+{0, 0x50, 0xB, 0, 1, 0, 1038},
+{0, 0x50, 0xB, 0, 1, 0, 1039},
+{0, 0x50, 0xB, 0, 1, 0, 1040},
+{0, 0x50, 0xB, 0, 1, 0, 1041},
+{0, 0x50, 0xB, 0, 1, 0, 1042},
+{0, 0x50, 0xB, 0, 1, 0, 1043},
+{0, 0x50, 0xB, 0, 1, 0, 1044},
+{0, 0x50, 0xB, 0, 1, 0, 1045},
+{0, 0x50, 0xB, 0, 1, 0, 1046},
+{0, 0x50, 0xB, 0, 1, 0, 1047},
+{0, 0x50, 0xB, 0, 1, 0, 1048},
+{0, 0x50, 0xB, 0, 1, 0, 1049},
+{0, 0x50, 0xB, 0, 1, 0, 1050},
+{0, 0x50, 0xB, 0, 1, 0, 1051},
+{0, 0x50, 0xB, 0, 1, 0, 1052},
+{0, 0x50, 0xB, 0, 1, 0, 1053},
+{0, 0x50, 0xB, 0, 1, 0, 1054},
+{0, 0x50, 0xB, 0, 1, 0, 1055},
+{0, 0x50, 0xB, 0, 1, 0, 1056},
+{0, 0x50, 0xB, 0, 1, 0, 1057},
+{0, 0x50, 0xB, 0, 1, 0, 1058},
+{0, 0x50, 0xB, 0, 1, 0, 1059},
+{0, 0x50, 0xB, 0, 1, 0, 1060},
+{0, 0x50, 0xB, 0, 1, 0, 1061},
+{0, 0x50, 0xB, 0, 1, 0, 1062},
+{214, 0x00, 0x0, 0, 0, 0, 0},
+{218, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x44, 0xF, 2, 2, 1063, 1063},
+{0, 0x44, 0xF, 2, 2, 1065, 1065},
+{0, 0x44, 0xF, 2, 2, 1067, 1067},
+{0, 0x44, 0xF, 2, 2, 1069, 1069},
+{0, 0x44, 0xF, 2, 2, 1071, 1071},
+{0, 0x44, 0xF, 2, 2, 1073, 1073},
+{0, 0x44, 0xF, 2, 2, 1075, 1075},
+{0, 0x44, 0xF, 2, 2, 1077, 1077},
+{0, 0x44, 0xF, 3, 3, 1079, 1079},
+{0, 0x44, 0xF, 3, 3, 1082, 1082},
+{0, 0x44, 0xF, 2, 2, 1085, 1085},
+{0, 0x44, 0xF, 2, 2, 1087, 1087},
+{0, 0x44, 0xF, 2, 2, 1089, 1089},
+{0, 0x44, 0xF, 2, 2, 1091, 1091},
+{0, 0x44, 0xF, 2, 2, 1093, 1093},
+{0, 0x44, 0xF, 2, 2, 1095, 1095},
+{0, 0x44, 0xF, 2, 2, 1097, 1097},
+{0, 0x44, 0xF, 2, 2, 1099, 1099},
+{0, 0x44, 0xF, 2, 2, 1101, 1101},
+{0, 0x44, 0xF, 2, 2, 1103, 1103},
+{0, 0x44, 0xF, 3, 3, 1105, 1105},
+{0, 0x44, 0xF, 3, 3, 1108, 1108},
+{0, 0x44, 0xF, 3, 3, 1111, 1111},
+{0, 0x44, 0xF, 3, 3, 1114, 1114},
+{0, 0x44, 0xF, 2, 2, 1117, 1117},
+{0, 0x44, 0xF, 2, 2, 1119, 1119},
+{0, 0x44, 0xF, 2, 2, 1121, 1121},
+{0, 0x44, 0xF, 2, 2, 1123, 1123},
+{0, 0x44, 0xF, 3, 3, 1125, 1125},
+{0, 0x44, 0xF, 3, 3, 1128, 1128},
+{0, 0x44, 0xF, 2, 2, 1131, 1131},
+{0, 0x44, 0xF, 2, 2, 1133, 1133},
+{0, 0x44, 0xF, 2, 2, 1135, 1135},
+{0, 0x44, 0xF, 2, 2, 1137, 1137},
+{0, 0x44, 0xF, 2, 2, 1139, 1139},
+{0, 0x44, 0xF, 2, 2, 1141, 1141},
+{0, 0x44, 0xF, 2, 2, 1143, 1143},
+{0, 0x44, 0xF, 2, 2, 1145, 1145},
+{0, 0x44, 0xF, 2, 2, 1147, 1147},
+{0, 0x44, 0xF, 2, 2, 1149, 1149},
+{0, 0x44, 0xF, 2, 2, 1151, 1151},
+{0, 0x44, 0xF, 2, 2, 1153, 1153},
+{0, 0x44, 0xF, 2, 2, 1155, 1155},
+{0, 0x44, 0xF, 2, 2, 1157, 1157},
+{0, 0x44, 0xF, 2, 2, 1159, 1159},
+{0, 0x44, 0xF, 2, 2, 1161, 1161},
+{0, 0x44, 0xF, 3, 3, 1163, 1163},
+{0, 0x44, 0xF, 3, 3, 1166, 1166},
+{0, 0x44, 0xF, 2, 2, 1169, 1169},
+{0, 0x44, 0xF, 2, 2, 1171, 1171},
+{0, 0x44, 0xF, 2, 2, 1173, 1173},
+{0, 0x44, 0xF, 2, 2, 1175, 1175},
+{0, 0x44, 0xF, 2, 2, 1177, 1177},
+{0, 0x44, 0xF, 2, 2, 1179, 1179},
+{0, 0x44, 0xF, 2, 2, 1181, 1181},
+{0, 0x44, 0xF, 2, 2, 1183, 1183},
+{0, 0x44, 0xF, 3, 3, 1185, 1185},
+{0, 0x44, 0xF, 3, 3, 1188, 1188},
+{0, 0x44, 0xF, 2, 2, 1191, 1191},
+{0, 0x44, 0xF, 2, 2, 1193, 1193},
+{0, 0x44, 0xF, 2, 2, 1195, 1195},
+{0, 0x44, 0xF, 2, 2, 1197, 1197},
+{0, 0x44, 0xF, 2, 2, 1199, 1199},
+{0, 0x44, 0xF, 2, 2, 1201, 1201},
+{0, 0x44, 0xF, 2, 2, 1203, 1203},
+{0, 0x44, 0xF, 2, 2, 1205, 1205},
+{0, 0x44, 0xF, 2, 2, 1207, 1207},
+{0, 0x44, 0xF, 2, 2, 1209, 1209},
+{0, 0x44, 0xF, 2, 2, 1211, 1211},
+{0, 0x44, 0xF, 2, 2, 1213, 1213},
+{0, 0x44, 0xF, 2, 2, 1215, 1215},
+{0, 0x44, 0xF, 2, 2, 1217, 1217},
+{0, 0x44, 0xF, 2, 2, 1219, 1219},
+{0, 0x44, 0xF, 2, 2, 1221, 1221},
+{0, 0x44, 0xF, 2, 2, 1223, 1223},
+{0, 0x44, 0xF, 2, 2, 1225, 1225},
+{0, 0x44, 0xF, 3, 3, 1227, 1227},
+{0, 0x44, 0xF, 3, 3, 1230, 1230},
+{0, 0x44, 0xF, 3, 3, 1233, 1233},
+{0, 0x44, 0xF, 3, 3, 1236, 1236},
+{0, 0x44, 0xF, 3, 3, 1239, 1239},
+{0, 0x44, 0xF, 3, 3, 1242, 1242},
+{0, 0x44, 0xF, 3, 3, 1245, 1245},
+{0, 0x44, 0xF, 3, 3, 1248, 1248},
+{0, 0x44, 0xF, 2, 2, 1251, 1251},
+{0, 0x44, 0xF, 2, 2, 1253, 1253},
+{0, 0x44, 0xF, 2, 2, 1255, 1255},
+{0, 0x44, 0xF, 2, 2, 1257, 1257},
+{0, 0x44, 0xF, 2, 2, 1259, 1259},
+{0, 0x44, 0xF, 2, 2, 1261, 1261},
+{0, 0x44, 0xF, 2, 2, 1263, 1263},
+{0, 0x44, 0xF, 2, 2, 1265, 1265},
+{0, 0x44, 0xF, 3, 3, 1267, 1267},
+{0, 0x44, 0xF, 3, 3, 1270, 1270},
+{0, 0x44, 0xF, 2, 2, 1273, 1273},
+{0, 0x44, 0xF, 2, 2, 1275, 1275},
+{0, 0x44, 0xF, 2, 2, 1277, 1277},
+{0, 0x44, 0xF, 2, 2, 1279, 1279},
+{0, 0x44, 0xF, 2, 2, 1281, 1281},
+{0, 0x44, 0xF, 2, 2, 1283, 1283},
+{0, 0x44, 0xF, 3, 3, 1285, 1285},
+{0, 0x44, 0xF, 3, 3, 1288, 1288},
+{0, 0x44, 0xF, 3, 3, 1291, 1291},
+{0, 0x44, 0xF, 3, 3, 1294, 1294},
+{0, 0x44, 0xF, 3, 3, 1297, 1297},
+{0, 0x44, 0xF, 3, 3, 1300, 1300},
+{0, 0x44, 0xF, 2, 2, 1303, 1303},
+{0, 0x44, 0xF, 2, 2, 1305, 1305},
+{0, 0x44, 0xF, 2, 2, 1307, 1307},
+{0, 0x44, 0xF, 2, 2, 1309, 1309},
+{0, 0x44, 0xF, 2, 2, 1311, 1311},
+{0, 0x44, 0xF, 2, 2, 1313, 1313},
+{0, 0x44, 0xF, 2, 2, 1315, 1315},
+{0, 0x44, 0xF, 2, 2, 1317, 1317},
+{0, 0x44, 0xF, 2, 2, 1319, 1319},
+{0, 0x44, 0xF, 2, 2, 1321, 1321},
+{0, 0x44, 0xF, 2, 2, 1323, 1323},
+{0, 0x44, 0xF, 2, 2, 1325, 1325},
+{0, 0x44, 0xF, 2, 2, 1327, 1327},
+{0, 0x44, 0xF, 2, 2, 1329, 1329},
+{0, 0x44, 0xF, 3, 3, 1331, 1331},
+{0, 0x44, 0xF, 3, 3, 1334, 1334},
+{0, 0x44, 0xF, 3, 3, 1337, 1337},
+{0, 0x44, 0xF, 3, 3, 1340, 1340},
+{0, 0x44, 0xF, 2, 2, 1343, 1343},
+{0, 0x44, 0xF, 2, 2, 1345, 1345},
+{0, 0x44, 0xF, 2, 2, 1347, 1347},
+{0, 0x44, 0xF, 2, 2, 1349, 1349},
+{0, 0x44, 0xF, 2, 2, 1351, 1351},
+{0, 0x44, 0xF, 2, 2, 1353, 1353},
+{0, 0x44, 0xF, 2, 2, 1355, 1355},
+{0, 0x44, 0xF, 2, 2, 1357, 1357},
+{0, 0x44, 0xF, 2, 2, 1359, 1359},
+{0, 0x44, 0xF, 2, 2, 1361, 1361},
+{0, 0x44, 0xF, 2, 2, 1363, 1363},
+{0, 0x44, 0xF, 2, 2, 1365, 1365},
+{0, 0x44, 0xF, 2, 2, 1367, 1367},
+{0, 0x44, 0xF, 2, 2, 1369, 1369},
+{0, 0x44, 0xF, 2, 2, 1371, 1371},
+{0, 0x44, 0xF, 2, 2, 1373, 1373},
+{0, 0x44, 0xF, 2, 2, 1375, 1375},
+{0, 0x44, 0xF, 2, 2, 1377, 1377},
+{0, 0x44, 0xF, 2, 2, 1379, 1379},
+{0, 0x44, 0xF, 2, 2, 1381, 1381},
+{0, 0x44, 0xF, 2, 2, 1383, 1383},
+{0, 0x44, 0xF, 2, 2, 1385, 1385},
+{0, 0x44, 0xF, 2, 2, 1387, 1387},
+{0, 0x44, 0xF, 2, 2, 1389, 1389},
+{0, 0x44, 0xF, 2, 2, 1391, 1391},
+{0, 0x44, 0xF, 2, 2, 1393, 1393},
+{0, 0x44, 0xF, 2, 2, 1395, 1395},
+{0, 0x44, 0xF, 2, 2, 1397, 1397},
+{0, 0x44, 0xF, 2, 2, 1399, 1399},
+{0, 0x44, 0xF, 2, 2, 1401, 1401},
+{0, 0x50, 0xB, 0, 2, 0, 1403},
+{0, 0x54, 0xB, 2, 2, 1405, 1279},
+{0, 0x44, 0xF, 2, 2, 1407, 1407},
+{0, 0x44, 0xF, 2, 2, 1409, 1409},
+{0, 0x44, 0xF, 2, 2, 1411, 1411},
+{0, 0x44, 0xF, 2, 2, 1413, 1413},
+{0, 0x44, 0xF, 3, 3, 1415, 1415},
+{0, 0x44, 0xF, 3, 3, 1418, 1418},
+{0, 0x44, 0xF, 3, 3, 1421, 1421},
+{0, 0x44, 0xF, 3, 3, 1424, 1424},
+{0, 0x44, 0xF, 3, 3, 1427, 1427},
+{0, 0x44, 0xF, 3, 3, 1430, 1430},
+{0, 0x44, 0xF, 3, 3, 1433, 1433},
+{0, 0x44, 0xF, 3, 3, 1436, 1436},
+{0, 0x44, 0xF, 3, 3, 1439, 1439},
+{0, 0x44, 0xF, 3, 3, 1442, 1442},
+{0, 0x44, 0xF, 3, 3, 1445, 1445},
+{0, 0x44, 0xF, 3, 3, 1448, 1448},
+{0, 0x44, 0xF, 3, 3, 1451, 1451},
+{0, 0x44, 0xF, 3, 3, 1454, 1454},
+{0, 0x44, 0xF, 3, 3, 1457, 1457},
+{0, 0x44, 0xF, 3, 3, 1460, 1460},
+{0, 0x44, 0xF, 3, 3, 1463, 1463},
+{0, 0x44, 0xF, 3, 3, 1466, 1466},
+{0, 0x44, 0xF, 3, 3, 1469, 1469},
+{0, 0x44, 0xF, 3, 3, 1472, 1472},
+{0, 0x44, 0xF, 2, 2, 1475, 1475},
+{0, 0x44, 0xF, 2, 2, 1477, 1477},
+{0, 0x44, 0xF, 2, 2, 1479, 1479},
+{0, 0x44, 0xF, 2, 2, 1481, 1481},
+{0, 0x44, 0xF, 2, 2, 1483, 1483},
+{0, 0x44, 0xF, 2, 2, 1485, 1485},
+{0, 0x44, 0xF, 3, 3, 1487, 1487},
+{0, 0x44, 0xF, 3, 3, 1490, 1490},
+{0, 0x44, 0xF, 3, 3, 1493, 1493},
+{0, 0x44, 0xF, 3, 3, 1496, 1496},
+{0, 0x44, 0xF, 3, 3, 1499, 1499},
+{0, 0x44, 0xF, 3, 3, 1502, 1502},
+{0, 0x44, 0xF, 3, 3, 1505, 1505},
+{0, 0x44, 0xF, 3, 3, 1508, 1508},
+{0, 0x44, 0xF, 3, 3, 1511, 1511},
+{0, 0x44, 0xF, 3, 3, 1514, 1514},
+{0, 0x44, 0xF, 2, 2, 1517, 1517},
+{0, 0x44, 0xF, 2, 2, 1519, 1519},
+{0, 0x44, 0xF, 2, 2, 1521, 1521},
+{0, 0x44, 0xF, 2, 2, 1523, 1523},
+{0, 0x44, 0xF, 2, 2, 1525, 1525},
+{0, 0x44, 0xF, 2, 2, 1527, 1527},
+{0, 0x44, 0xF, 2, 2, 1529, 1529},
+{0, 0x44, 0xF, 2, 2, 1531, 1531},
+{0, 0x44, 0xF, 3, 3, 1533, 1533},
+{0, 0x44, 0xF, 3, 3, 1536, 1536},
+{0, 0x44, 0xF, 3, 3, 1539, 1539},
+{0, 0x44, 0xF, 3, 3, 1542, 1542},
+{0, 0x44, 0xF, 3, 3, 1545, 1545},
+{0, 0x44, 0xF, 3, 3, 1548, 1548},
+{0, 0x44, 0xF, 3, 3, 1551, 1551},
+{0, 0x44, 0xF, 3, 3, 1554, 1554},
+{0, 0x44, 0xF, 3, 3, 1557, 1557},
+{0, 0x44, 0xF, 3, 3, 1560, 1560},
+{0, 0x44, 0xF, 3, 3, 1563, 1563},
+{0, 0x44, 0xF, 3, 3, 1566, 1566},
+{0, 0x44, 0xF, 3, 3, 1569, 1569},
+{0, 0x44, 0xF, 3, 3, 1572, 1572},
+{0, 0x44, 0xF, 3, 3, 1575, 1575},
+{0, 0x44, 0xF, 3, 3, 1578, 1578},
+{0, 0x44, 0xF, 3, 3, 1581, 1581},
+{0, 0x44, 0xF, 3, 3, 1584, 1584},
+{0, 0x44, 0xF, 3, 3, 1587, 1587},
+{0, 0x44, 0xF, 3, 3, 1590, 1590},
+{0, 0x44, 0xF, 2, 2, 1593, 1593},
+{0, 0x44, 0xF, 2, 2, 1595, 1595},
+{0, 0x44, 0xF, 2, 2, 1597, 1597},
+{0, 0x44, 0xF, 2, 2, 1599, 1599},
+{0, 0x44, 0xF, 3, 3, 1601, 1601},
+{0, 0x44, 0xF, 3, 3, 1604, 1604},
+{0, 0x44, 0xF, 3, 3, 1607, 1607},
+{0, 0x44, 0xF, 3, 3, 1610, 1610},
+{0, 0x44, 0xF, 3, 3, 1613, 1613},
+{0, 0x44, 0xF, 3, 3, 1616, 1616},
+{0, 0x44, 0xF, 3, 3, 1619, 1619},
+{0, 0x44, 0xF, 3, 3, 1622, 1622},
+{0, 0x44, 0xF, 3, 3, 1625, 1625},
+{0, 0x44, 0xF, 3, 3, 1628, 1628},
+{0, 0x44, 0xF, 2, 2, 1631, 1631},
+{0, 0x44, 0xF, 2, 2, 1633, 1633},
+{0, 0x44, 0xF, 2, 2, 1635, 1635},
+{0, 0x44, 0xF, 2, 2, 1637, 1637},
+{0, 0x44, 0xF, 2, 2, 1639, 1639},
+{0, 0x44, 0xF, 2, 2, 1641, 1641},
+{0, 0x44, 0xF, 2, 2, 1643, 1643},
+{0, 0x44, 0xF, 2, 2, 1645, 1645},
+{0, 0x44, 0xF, 2, 2, 1647, 1647},
+{0, 0x44, 0xF, 2, 2, 1649, 1649},
+{0, 0x44, 0xF, 3, 3, 1651, 1651},
+{0, 0x44, 0xF, 3, 3, 1654, 1654},
+{0, 0x44, 0xF, 3, 3, 1657, 1657},
+{0, 0x44, 0xF, 3, 3, 1660, 1660},
+{0, 0x44, 0xF, 3, 3, 1663, 1663},
+{0, 0x44, 0xF, 3, 3, 1666, 1666},
+{0, 0x44, 0xF, 2, 2, 1669, 1669},
+{0, 0x44, 0xF, 2, 2, 1671, 1671},
+{0, 0x44, 0xF, 3, 3, 1673, 1673},
+{0, 0x44, 0xF, 3, 3, 1676, 1676},
+{0, 0x44, 0xF, 3, 3, 1679, 1679},
+{0, 0x44, 0xF, 3, 3, 1682, 1682},
+{0, 0x44, 0xF, 3, 3, 1685, 1685},
+{0, 0x44, 0xF, 3, 3, 1688, 1688},
+{0, 0x44, 0xF, 2, 2, 1691, 1691},
+{0, 0x44, 0xF, 2, 2, 1693, 1693},
+{0, 0x44, 0xF, 3, 3, 1695, 1695},
+{0, 0x44, 0xF, 3, 3, 1698, 1698},
+{0, 0x44, 0xF, 3, 3, 1701, 1701},
+{0, 0x44, 0xF, 3, 3, 1704, 1704},
+{0, 0x44, 0xF, 2, 2, 1707, 1707},
+{0, 0x44, 0xF, 2, 2, 1709, 1709},
+{0, 0x44, 0xF, 3, 3, 1711, 1711},
+{0, 0x44, 0xF, 3, 3, 1714, 1714},
+{0, 0x44, 0xF, 3, 3, 1717, 1717},
+{0, 0x44, 0xF, 3, 3, 1720, 1720},
+{0, 0x44, 0xF, 2, 2, 1723, 1723},
+{0, 0x44, 0xF, 2, 2, 1725, 1725},
+{0, 0x44, 0xF, 3, 3, 1727, 1727},
+{0, 0x44, 0xF, 3, 3, 1730, 1730},
+{0, 0x44, 0xF, 3, 3, 1733, 1733},
+{0, 0x44, 0xF, 3, 3, 1736, 1736},
+{0, 0x44, 0xF, 3, 3, 1739, 1739},
+{0, 0x44, 0xF, 3, 3, 1742, 1742},
+{0, 0x44, 0xF, 2, 2, 1745, 1745},
+{0, 0x44, 0xF, 2, 2, 1747, 1747},
+{0, 0x44, 0xF, 3, 3, 1749, 1749},
+{0, 0x44, 0xF, 3, 3, 1752, 1752},
+{0, 0x44, 0xF, 3, 3, 1755, 1755},
+{0, 0x44, 0xF, 3, 3, 1758, 1758},
+{0, 0x44, 0xF, 3, 3, 1761, 1761},
+{0, 0x44, 0xF, 3, 3, 1764, 1764},
+{0, 0x44, 0xF, 2, 2, 1767, 1767},
+{0, 0x44, 0xF, 2, 2, 1769, 1769},
+{0, 0x44, 0xF, 3, 3, 1771, 1771},
+{0, 0x44, 0xF, 3, 3, 1774, 1774},
+{0, 0x44, 0xF, 3, 3, 1777, 1777},
+{0, 0x44, 0xF, 3, 3, 1780, 1780},
+{0, 0x44, 0xF, 3, 3, 1783, 1783},
+{0, 0x44, 0xF, 3, 3, 1786, 1786},
+{0, 0x44, 0xF, 2, 2, 1789, 1789},
+{0, 0x44, 0xF, 2, 2, 1791, 1791},
+{0, 0x44, 0xF, 3, 3, 1793, 1793},
+{0, 0x44, 0xF, 3, 3, 1796, 1796},
+{0, 0x44, 0xF, 3, 3, 1799, 1799},
+{0, 0x44, 0xF, 3, 3, 1802, 1802},
+{0, 0x44, 0xF, 3, 3, 1805, 1805},
+{0, 0x44, 0xF, 3, 3, 1808, 1808},
+{0, 0x44, 0xF, 2, 2, 1811, 1811},
+{0, 0x44, 0xF, 2, 2, 1813, 1813},
+{0, 0x44, 0xF, 3, 3, 1815, 1815},
+{0, 0x44, 0xF, 3, 3, 1818, 1818},
+{0, 0x44, 0xF, 3, 3, 1821, 1821},
+{0, 0x44, 0xF, 3, 3, 1824, 1824},
+{0, 0x44, 0xF, 2, 2, 1827, 1827},
+{0, 0x44, 0xF, 2, 2, 1829, 1829},
+{0, 0x44, 0xF, 3, 3, 1831, 1831},
+{0, 0x44, 0xF, 3, 3, 1834, 1834},
+{0, 0x44, 0xF, 3, 3, 1837, 1837},
+{0, 0x44, 0xF, 3, 3, 1840, 1840},
+{0, 0x44, 0xF, 2, 2, 1843, 1843},
+{0, 0x44, 0xF, 2, 2, 1845, 1845},
+{0, 0x44, 0xF, 3, 3, 1847, 1847},
+{0, 0x44, 0xF, 3, 3, 1850, 1850},
+{0, 0x44, 0xF, 3, 3, 1853, 1853},
+{0, 0x44, 0xF, 3, 3, 1856, 1856},
+{0, 0x44, 0xF, 3, 3, 1859, 1859},
+{0, 0x44, 0xF, 3, 3, 1862, 1862},
+{0, 0x44, 0xF, 2, 2, 1865, 1865},
+{0, 0x44, 0xF, 3, 3, 1867, 1867},
+{0, 0x44, 0xF, 3, 3, 1870, 1870},
+{0, 0x44, 0xF, 3, 3, 1873, 1873},
+{0, 0x44, 0xF, 2, 2, 1876, 1876},
+{0, 0x44, 0xF, 2, 2, 1878, 1878},
+{0, 0x44, 0xF, 3, 3, 1880, 1880},
+{0, 0x44, 0xF, 3, 3, 1883, 1883},
+{0, 0x44, 0xF, 3, 3, 1886, 1886},
+{0, 0x44, 0xF, 3, 3, 1889, 1889},
+{0, 0x44, 0xF, 3, 3, 1892, 1892},
+{0, 0x44, 0xF, 3, 3, 1895, 1895},
+{0, 0x44, 0xF, 2, 2, 1898, 1898},
+{0, 0x44, 0xF, 2, 2, 1900, 1900},
+{0, 0x44, 0xF, 3, 3, 1902, 1902},
+{0, 0x44, 0xF, 3, 3, 1905, 1905},
+{0, 0x44, 0xF, 3, 3, 1908, 1908},
+{0, 0x44, 0xF, 3, 3, 1911, 1911},
+{0, 0x44, 0xF, 3, 3, 1914, 1914},
+{0, 0x44, 0xF, 3, 3, 1917, 1917},
+{0, 0x44, 0xF, 2, 2, 1920, 1920},
+{0, 0x55, 0xA, 2, 2, 649, 649},
+{0, 0x44, 0xF, 2, 2, 1922, 1922},
+{0, 0x55, 0xA, 2, 2, 651, 651},
+{0, 0x44, 0xF, 2, 2, 1924, 1924},
+{0, 0x55, 0xA, 2, 2, 653, 653},
+{0, 0x44, 0xF, 2, 2, 1926, 1926},
+{0, 0x55, 0xA, 2, 2, 655, 655},
+{0, 0x44, 0xF, 2, 2, 1928, 1928},
+{0, 0x55, 0xA, 2, 2, 664, 664},
+{0, 0x44, 0xF, 2, 2, 1930, 1930},
+{0, 0x55, 0xA, 2, 2, 666, 666},
+{0, 0x44, 0xF, 2, 2, 1932, 1932},
+{0, 0x55, 0xA, 2, 2, 668, 668},
+{0, 0x44, 0xF, 3, 3, 1934, 1934},
+{0, 0x44, 0xF, 3, 3, 1937, 1937},
+{0, 0x44, 0xF, 4, 4, 1940, 1940},
+{0, 0x44, 0xF, 4, 4, 1944, 1944},
+{0, 0x44, 0xF, 4, 4, 1948, 1948},
+{0, 0x44, 0xF, 4, 4, 1952, 1952},
+{0, 0x44, 0xF, 4, 4, 1956, 1956},
+{0, 0x44, 0xF, 4, 4, 1960, 1960},
+{0, 0x44, 0xF, 3, 3, 1964, 1964},
+{0, 0x44, 0xF, 3, 3, 1967, 1967},
+{0, 0x44, 0xF, 4, 4, 1970, 1970},
+{0, 0x44, 0xF, 4, 4, 1974, 1974},
+{0, 0x44, 0xF, 4, 4, 1978, 1978},
+{0, 0x44, 0xF, 4, 4, 1982, 1982},
+{0, 0x44, 0xF, 4, 4, 1986, 1986},
+{0, 0x44, 0xF, 4, 4, 1990, 1990},
+{0, 0x44, 0xF, 3, 3, 1994, 1994},
+{0, 0x44, 0xF, 3, 3, 1997, 1997},
+{0, 0x44, 0xF, 4, 4, 2000, 2000},
+{0, 0x44, 0xF, 4, 4, 2004, 2004},
+{0, 0x44, 0xF, 4, 4, 2008, 2008},
+{0, 0x44, 0xF, 4, 4, 2012, 2012},
+{0, 0x44, 0xF, 4, 4, 2016, 2016},
+{0, 0x44, 0xF, 4, 4, 2020, 2020},
+{0, 0x44, 0xF, 3, 3, 2024, 2024},
+{0, 0x44, 0xF, 3, 3, 2027, 2027},
+{0, 0x44, 0xF, 4, 4, 2030, 2030},
+{0, 0x44, 0xF, 4, 4, 2034, 2034},
+{0, 0x44, 0xF, 4, 4, 2038, 2038},
+{0, 0x44, 0xF, 4, 4, 2042, 2042},
+{0, 0x44, 0xF, 4, 4, 2046, 2046},
+{0, 0x44, 0xF, 4, 4, 2050, 2050},
+{0, 0x44, 0xF, 3, 3, 2054, 2054},
+{0, 0x44, 0xF, 3, 3, 2057, 2057},
+{0, 0x44, 0xF, 4, 4, 2060, 2060},
+{0, 0x44, 0xF, 4, 4, 2064, 2064},
+{0, 0x44, 0xF, 4, 4, 2068, 2068},
+{0, 0x44, 0xF, 4, 4, 2072, 2072},
+{0, 0x44, 0xF, 4, 4, 2076, 2076},
+{0, 0x44, 0xF, 4, 4, 2080, 2080},
+{0, 0x44, 0xF, 3, 3, 2084, 2084},
+{0, 0x44, 0xF, 3, 3, 2087, 2087},
+{0, 0x44, 0xF, 4, 4, 2090, 2090},
+{0, 0x44, 0xF, 4, 4, 2094, 2094},
+{0, 0x44, 0xF, 4, 4, 2098, 2098},
+{0, 0x44, 0xF, 4, 4, 2102, 2102},
+{0, 0x44, 0xF, 4, 4, 2106, 2106},
+{0, 0x44, 0xF, 4, 4, 2110, 2110},
+{0, 0x44, 0xF, 2, 2, 2114, 2114},
+{0, 0x44, 0xF, 2, 2, 2116, 2116},
+{0, 0x44, 0xF, 3, 3, 2118, 2118},
+{0, 0x44, 0xF, 2, 2, 2121, 2121},
+{0, 0x44, 0xF, 3, 3, 2123, 2123},
+{0, 0x44, 0xF, 2, 2, 2126, 2126},
+{0, 0x44, 0xF, 3, 3, 2128, 2128},
+{0, 0x44, 0xF, 2, 2, 2131, 2131},
+{0, 0x44, 0xF, 2, 2, 2133, 2133},
+{0, 0x44, 0xF, 2, 2, 2135, 2135},
+{0, 0x55, 0xA, 2, 2, 627, 627},
+{0, 0x44, 0xF, 2, 2, 2137, 2137},
+{0, 0x50, 0xB, 0, 2, 0, 2139},
+{0, 0x55, 0xA, 1, 1, 2141, 2141},
+{0, 0x50, 0xB, 0, 2, 0, 2142},
+{0, 0x54, 0xB, 2, 3, 2144, 2146},
+{0, 0x44, 0xF, 3, 3, 2149, 2149},
+{0, 0x44, 0xF, 2, 2, 2152, 2152},
+{0, 0x44, 0xF, 3, 3, 2154, 2154},
+{0, 0x44, 0xF, 2, 2, 2157, 2157},
+{0, 0x44, 0xF, 3, 3, 2159, 2159},
+{0, 0x44, 0xF, 2, 2, 2162, 2162},
+{0, 0x55, 0xA, 2, 2, 630, 630},
+{0, 0x44, 0xF, 2, 2, 2164, 2164},
+{0, 0x55, 0xA, 2, 2, 632, 632},
+{0, 0x44, 0xF, 2, 2, 2166, 2166},
+{0, 0x54, 0xB, 2, 3, 2168, 2170},
+{0, 0x54, 0xB, 2, 3, 2173, 2175},
+{0, 0x54, 0xB, 2, 3, 2178, 2180},
+{0, 0x44, 0xF, 2, 2, 2183, 2183},
+{0, 0x44, 0xF, 2, 2, 2185, 2185},
+{0, 0x44, 0xF, 3, 3, 2187, 2187},
+{0, 0x55, 0xA, 3, 3, 642, 642},
+{0, 0x44, 0xF, 2, 2, 2190, 2190},
+{0, 0x44, 0xF, 3, 3, 2192, 2192},
+{0, 0x44, 0xF, 2, 2, 2195, 2195},
+{0, 0x44, 0xF, 2, 2, 2197, 2197},
+{0, 0x44, 0xF, 2, 2, 2199, 2199},
+{0, 0x55, 0xA, 2, 2, 634, 634},
+{0, 0x54, 0xB, 2, 3, 2201, 2203},
+{0, 0x54, 0xB, 2, 3, 2206, 2208},
+{0, 0x54, 0xB, 2, 3, 2211, 2213},
+{0, 0x44, 0xF, 2, 2, 2216, 2216},
+{0, 0x44, 0xF, 2, 2, 2218, 2218},
+{0, 0x44, 0xF, 3, 3, 2220, 2220},
+{0, 0x55, 0xA, 3, 3, 657, 657},
+{0, 0x44, 0xF, 2, 2, 2223, 2223},
+{0, 0x44, 0xF, 2, 2, 2225, 2225},
+{0, 0x44, 0xF, 2, 2, 2227, 2227},
+{0, 0x44, 0xF, 3, 3, 2229, 2229},
+{0, 0x44, 0xF, 2, 2, 2232, 2232},
+{0, 0x44, 0xF, 2, 2, 2234, 2234},
+{0, 0x44, 0xF, 2, 2, 2236, 2236},
+{0, 0x55, 0xA, 2, 2, 638, 638},
+{0, 0x44, 0xF, 2, 2, 2238, 2238},
+{0, 0x54, 0xB, 2, 3, 2240, 2242},
+{0, 0x55, 0xA, 2, 3, 622, 624},
+{0, 0x55, 0xA, 1, 1, 2245, 2245},
+{0, 0x44, 0xF, 3, 3, 2246, 2246},
+{0, 0x44, 0xF, 2, 2, 2249, 2249},
+{0, 0x44, 0xF, 3, 3, 2251, 2251},
+{0, 0x44, 0xF, 2, 2, 2254, 2254},
+{0, 0x44, 0xF, 3, 3, 2256, 2256},
+{0, 0x44, 0xF, 2, 2, 2259, 2259},
+{0, 0x55, 0xA, 2, 2, 636, 636},
+{0, 0x44, 0xF, 2, 2, 2261, 2261},
+{0, 0x55, 0xA, 2, 2, 640, 640},
+{0, 0x44, 0xF, 2, 2, 2263, 2263},
+{0, 0x55, 0xA, 1, 2, 2265, 8},
+{0, 0x50, 0xB, 0, 2, 0, 2266},
+{0, 0x55, 0xA, 1, 1, 2268, 0},
+{0, 0x55, 0xA, 1, 1, 2269, 0},
+{0, 0x50, 0xB, 0, 1, 0, 2270},
+{0, 0x50, 0xB, 0, 2, 0, 2271},
+{0, 0x50, 0xB, 0, 1, 0, 2273},
+{0, 0x50, 0xB, 0, 2, 0, 2274},
+{0, 0x50, 0xB, 0, 3, 0, 2276},
+{0, 0x50, 0xB, 0, 2, 0, 2279},
+{0, 0x50, 0xB, 0, 3, 0, 2281},
+{0, 0x50, 0xB, 0, 2, 0, 2284},
+{0, 0x50, 0xB, 0, 3, 0, 2286},
+{0, 0x50, 0xB, 0, 2, 0, 2289},
+{0, 0x50, 0xB, 0, 2, 0, 2291},
+{0, 0x50, 0xB, 0, 2, 0, 2293},
+{0, 0x50, 0xB, 0, 2, 0, 2295},
+{0, 0x50, 0xB, 0, 2, 0, 2297},
+{0, 0x50, 0xB, 0, 4, 0, 2299},
+{0, 0x50, 0xB, 0, 1, 0, 2303},
+{0, 0x50, 0xB, 0, 1, 0, 2304},
+{0, 0x50, 0xB, 0, 1, 0, 2305},
+{0, 0x50, 0xB, 0, 1, 0, 2306},
+{0, 0x50, 0xB, 0, 1, 0, 2307},
+{0, 0x50, 0xB, 0, 1, 0, 2308},
+{0, 0x50, 0xB, 0, 1, 0, 2309},
+{0, 0x50, 0xB, 0, 1, 0, 2310},
+{0, 0x50, 0xB, 0, 1, 0, 2311},
+{0, 0x50, 0xB, 0, 1, 0, 2312},
+{0, 0x50, 0xB, 0, 1, 0, 2313},
+{0, 0x50, 0xB, 0, 1, 0, 2314},
+{0, 0x50, 0xB, 0, 1, 0, 2315},
+{0, 0x50, 0xB, 0, 2, 0, 2316},
+{0, 0x50, 0xB, 0, 3, 0, 2318},
+{0, 0x50, 0xB, 0, 3, 0, 2321},
+{0, 0x50, 0xB, 0, 1, 0, 2324},
+{0, 0x50, 0xB, 0, 2, 0, 2325},
+{0, 0x50, 0xB, 0, 3, 0, 2327},
+{0, 0x50, 0xB, 0, 3, 0, 2330},
+{0, 0x50, 0xB, 0, 1, 0, 2333},
+{0, 0x50, 0xB, 0, 2, 0, 2334},
+{0, 0x50, 0xB, 0, 1, 0, 2336},
+{0, 0x50, 0xB, 0, 2, 0, 2337},
+{0, 0x50, 0xB, 0, 1, 0, 2339},
+{0, 0x50, 0xB, 0, 2, 0, 2340},
+{0, 0x50, 0xB, 0, 3, 0, 2342},
+{0, 0x50, 0xB, 0, 2, 0, 2345},
+{0, 0x50, 0xB, 0, 1, 0, 2347},
+{0, 0x55, 0xA, 1, 1, 2348, 2348},
+{0, 0x55, 0xA, 1, 1, 989, 989},
+{0, 0x55, 0xA, 2, 2, 34, 34},
+{0, 0x50, 0xB, 0, 1, 0, 2349},
+{0, 0x50, 0xB, 0, 1, 0, 2350},
+{0, 0x50, 0xB, 0, 1, 0, 2351},
+{0, 0x50, 0xB, 0, 1, 0, 2352},
+{0, 0x50, 0xB, 0, 1, 0, 2353},
+{0, 0x50, 0xB, 0, 3, 0, 2354},
+{0, 0x50, 0xB, 0, 1, 0, 2357},
+{0, 0x50, 0xB, 0, 1, 0, 2358},
+{0, 0x50, 0xB, 0, 1, 0, 2359},
+{0, 0x50, 0xB, 0, 3, 0, 2360},
+{0, 0x50, 0xB, 0, 3, 0, 2363},
+{0, 0x50, 0xB, 0, 4, 0, 2366},
+{0, 0x50, 0xB, 0, 3, 0, 2370},
+{0, 0x50, 0xB, 0, 3, 0, 2373},
+{0, 0x50, 0xB, 0, 3, 0, 2376},
+{0, 0x50, 0xB, 0, 3, 0, 2379},
+{0, 0x50, 0xB, 0, 3, 0, 2382},
+{0, 0x50, 0xB, 0, 3, 0, 2385},
+{0, 0x50, 0xB, 0, 3, 0, 2388},
+{0, 0x50, 0xB, 0, 3, 0, 2391},
+{0, 0x50, 0xB, 0, 3, 0, 2394},
+{0, 0x50, 0xB, 0, 3, 0, 2397},
+{0, 0x50, 0xB, 0, 3, 0, 2400},
+{0, 0x50, 0xB, 0, 3, 0, 2403},
+{0, 0x50, 0xB, 0, 2, 0, 2406},
+{0, 0x50, 0xB, 0, 2, 0, 2408},
+{0, 0x50, 0xB, 0, 3, 0, 2410},
+{0, 0x50, 0xB, 0, 2, 0, 2413},
+{0, 0x50, 0xB, 0, 1, 0, 2415},
+{0, 0x50, 0xB, 0, 2, 0, 2416},
+{0, 0x50, 0xB, 0, 3, 0, 2418},
+{0, 0x50, 0xB, 0, 4, 0, 2421},
+{0, 0x50, 0xB, 0, 2, 0, 2425},
+{0, 0x50, 0xB, 0, 1, 0, 2427},
+{0, 0x50, 0xB, 0, 2, 0, 2428},
+{0, 0x50, 0xB, 0, 3, 0, 2430},
+{0, 0x50, 0xB, 0, 2, 0, 2433},
+{0, 0x50, 0xB, 0, 3, 0, 2435},
+{0, 0x50, 0xB, 0, 2, 0, 2438},
+{0, 0x50, 0xB, 0, 2, 0, 2440},
+{0, 0x50, 0xB, 0, 3, 0, 2442},
+{0, 0x50, 0xB, 0, 4, 0, 2445},
+{0, 0x50, 0xB, 0, 2, 0, 2449},
+{0, 0x50, 0xB, 0, 2, 0, 2451},
+{0, 0x50, 0xB, 0, 3, 0, 2453},
+{0, 0x50, 0xB, 0, 3, 0, 2456},
+{0, 0x44, 0xF, 2, 2, 2459, 2459},
+{0, 0x44, 0xF, 2, 2, 2461, 2461},
+{0, 0x44, 0xF, 2, 2, 2463, 2463},
+{0, 0x44, 0xF, 2, 2, 2465, 2465},
+{0, 0x44, 0xF, 2, 2, 2467, 2467},
+{0, 0x44, 0xF, 2, 2, 2469, 2469},
+{0, 0x44, 0xF, 2, 2, 2471, 2471},
+{0, 0x44, 0xF, 2, 2, 2473, 2473},
+{0, 0x44, 0xF, 2, 2, 2475, 2475},
+{0, 0x44, 0xF, 2, 2, 2477, 2477},
+{0, 0x44, 0xF, 2, 2, 2479, 2479},
+{0, 0x50, 0xB, 0, 2, 0, 2481},
+{0, 0x50, 0xB, 0, 3, 0, 2483},
+{0, 0x50, 0xB, 0, 2, 0, 2486},
+{0, 0x50, 0xB, 0, 3, 0, 2488},
+{0, 0x44, 0xF, 2, 2, 2491, 2491},
+{0, 0x44, 0xF, 2, 2, 2493, 2493},
+{0, 0x44, 0xF, 2, 2, 2495, 2495},
+{0, 0x44, 0xF, 2, 2, 2497, 2497},
+{0, 0x44, 0xF, 2, 2, 2499, 2499},
+{0, 0x44, 0xF, 2, 2, 2501, 2501},
+{0, 0x44, 0xF, 2, 2, 2503, 2503},
+{0, 0x44, 0xF, 2, 2, 2505, 2505},
+{0, 0x44, 0xF, 2, 2, 2507, 2507},
+{0, 0x44, 0xF, 2, 2, 2509, 2509},
+{0, 0x44, 0xF, 2, 2, 2511, 2511},
+{0, 0x44, 0xF, 2, 2, 2513, 2513},
+{0, 0x44, 0xF, 2, 2, 2515, 2515},
+{0, 0x44, 0xF, 2, 2, 2517, 2517},
+{0, 0x44, 0xF, 2, 2, 2519, 2519},
+{0, 0x44, 0xF, 2, 2, 2521, 2521},
+{0, 0x44, 0xF, 2, 2, 2523, 2523},
+{0, 0x44, 0xF, 2, 2, 2525, 2525},
+{0, 0x44, 0xF, 2, 2, 2527, 2527},
+{0, 0x44, 0xF, 2, 2, 2529, 2529},
+{0, 0x44, 0xF, 2, 2, 2531, 2531},
+{0, 0x44, 0xF, 2, 2, 2533, 2533},
+{0, 0x44, 0xF, 2, 2, 2535, 2535},
+{0, 0x44, 0xF, 2, 2, 2537, 2537},
+{0, 0x44, 0xF, 2, 2, 2539, 2539},
+{0, 0x44, 0xF, 2, 2, 2541, 2541},
+{0, 0x44, 0xF, 2, 2, 2543, 2543},
+{0, 0x44, 0xF, 2, 2, 2545, 2545},
+{0, 0x44, 0xF, 2, 2, 2547, 2547},
+{0, 0x44, 0xF, 2, 2, 2549, 2549},
+{0, 0x44, 0xF, 2, 2, 2551, 2551},
+{0, 0x44, 0xF, 2, 2, 2553, 2553},
+{0, 0x44, 0xF, 2, 2, 2555, 2555},
+{0, 0x55, 0xA, 1, 1, 2557, 2557},
+{0, 0x55, 0xA, 1, 1, 2558, 2558},
+{0, 0x50, 0xB, 0, 2, 0, 2559},
+{0, 0x50, 0xB, 0, 2, 0, 2561},
+{0, 0x50, 0xB, 0, 2, 0, 2563},
+{0, 0x50, 0xB, 0, 2, 0, 2565},
+{0, 0x50, 0xB, 0, 2, 0, 2567},
+{0, 0x50, 0xB, 0, 2, 0, 2569},
+{0, 0x50, 0xB, 0, 2, 0, 2571},
+{0, 0x50, 0xB, 0, 2, 0, 2573},
+{0, 0x50, 0xB, 0, 2, 0, 2575},
+{0, 0x50, 0xB, 0, 2, 0, 2577},
+{0, 0x50, 0xB, 0, 2, 0, 2579},
+{0, 0x50, 0xB, 0, 3, 0, 2581},
+{0, 0x50, 0xB, 0, 3, 0, 2584},
+{0, 0x50, 0xB, 0, 3, 0, 2587},
+{0, 0x50, 0xB, 0, 3, 0, 2590},
+{0, 0x50, 0xB, 0, 3, 0, 2593},
+{0, 0x50, 0xB, 0, 3, 0, 2596},
+{0, 0x50, 0xB, 0, 3, 0, 2599},
+{0, 0x50, 0xB, 0, 3, 0, 2602},
+{0, 0x50, 0xB, 0, 3, 0, 2605},
+{0, 0x50, 0xB, 0, 4, 0, 2608},
+{0, 0x50, 0xB, 0, 4, 0, 2612},
+{0, 0x50, 0xB, 0, 4, 0, 2616},
+{0, 0x50, 0xB, 0, 4, 0, 2620},
+{0, 0x50, 0xB, 0, 4, 0, 2624},
+{0, 0x50, 0xB, 0, 4, 0, 2628},
+{0, 0x50, 0xB, 0, 4, 0, 2632},
+{0, 0x50, 0xB, 0, 4, 0, 2636},
+{0, 0x50, 0xB, 0, 4, 0, 2640},
+{0, 0x50, 0xB, 0, 4, 0, 2644},
+{0, 0x50, 0xB, 0, 4, 0, 2648},
+{0, 0x50, 0xB, 0, 2, 0, 2652},
+{0, 0x50, 0xB, 0, 2, 0, 2654},
+{0, 0x50, 0xB, 0, 2, 0, 2656},
+{0, 0x50, 0xB, 0, 2, 0, 2658},
+{0, 0x50, 0xB, 0, 2, 0, 2660},
+{0, 0x50, 0xB, 0, 2, 0, 2662},
+{0, 0x50, 0xB, 0, 2, 0, 2664},
+{0, 0x50, 0xB, 0, 2, 0, 2666},
+{0, 0x50, 0xB, 0, 2, 0, 2668},
+{0, 0x50, 0xB, 0, 3, 0, 2670},
+{0, 0x50, 0xB, 0, 3, 0, 2673},
+{0, 0x50, 0xB, 0, 3, 0, 2676},
+{0, 0x50, 0xB, 0, 3, 0, 2679},
+{0, 0x50, 0xB, 0, 3, 0, 2682},
+{0, 0x50, 0xB, 0, 3, 0, 2685},
+{0, 0x50, 0xB, 0, 3, 0, 2688},
+{0, 0x50, 0xB, 0, 3, 0, 2691},
+{0, 0x50, 0xB, 0, 3, 0, 2694},
+{0, 0x50, 0xB, 0, 3, 0, 2697},
+{0, 0x50, 0xB, 0, 3, 0, 2700},
+{0, 0x50, 0xB, 0, 3, 0, 2703},
+{0, 0x50, 0xB, 0, 3, 0, 2706},
+{0, 0x50, 0xB, 0, 3, 0, 2709},
+{0, 0x50, 0xB, 0, 3, 0, 2712},
+{0, 0x50, 0xB, 0, 3, 0, 2715},
+{0, 0x50, 0xB, 0, 3, 0, 2718},
+{0, 0x50, 0xB, 0, 3, 0, 2721},
+{0, 0x50, 0xB, 0, 3, 0, 2724},
+{0, 0x50, 0xB, 0, 3, 0, 2727},
+{0, 0x50, 0xB, 0, 3, 0, 2730},
+{0, 0x50, 0xB, 0, 3, 0, 2733},
+{0, 0x50, 0xB, 0, 3, 0, 2736},
+{0, 0x50, 0xB, 0, 3, 0, 2739},
+{0, 0x50, 0xB, 0, 3, 0, 2742},
+{0, 0x50, 0xB, 0, 3, 0, 2745},
+{0, 0x50, 0xB, 0, 3, 0, 2748},
+{0, 0x50, 0xB, 0, 3, 0, 2751},
+{0, 0x50, 0xB, 0, 3, 0, 2754},
+{0, 0x50, 0xB, 0, 3, 0, 2757},
+{0, 0x50, 0xB, 0, 3, 0, 2760},
+{0, 0x50, 0xB, 0, 3, 0, 2763},
+{0, 0x50, 0xB, 0, 3, 0, 2766},
+{0, 0x50, 0xB, 0, 3, 0, 2769},
+{0, 0x50, 0xB, 0, 3, 0, 2772},
+{0, 0x50, 0xB, 0, 3, 0, 2775},
+{0, 0x50, 0xB, 0, 3, 0, 2778},
+{0, 0x50, 0xB, 0, 1, 0, 2781},
+{0, 0x50, 0xB, 0, 1, 0, 2782},
+{0, 0x50, 0xB, 0, 1, 0, 2783},
+{0, 0x50, 0xB, 0, 4, 0, 2784},
+{0, 0x50, 0xB, 0, 3, 0, 2788},
+{0, 0x50, 0xB, 0, 2, 0, 2791},
+{0, 0x50, 0xB, 0, 3, 0, 2793},
+{0, 0x55, 0xA, 2, 2, 2796, 2796},
+{0, 0x50, 0xB, 0, 1, 0, 2798},
+{0, 0x50, 0xB, 0, 1, 0, 2799},
+{0, 0x50, 0xB, 0, 1, 0, 2800},
+{0, 0x50, 0xB, 0, 1, 0, 2801},
+{0, 0x50, 0xB, 0, 1, 0, 2802},
+{0, 0x50, 0xB, 0, 1, 0, 2803},
+{0, 0x50, 0xB, 0, 1, 0, 2804},
+{0, 0x50, 0xB, 0, 1, 0, 2805},
+{0, 0x50, 0xB, 0, 1, 0, 2806},
+{0, 0x50, 0xB, 0, 1, 0, 2807},
+{0, 0x50, 0xB, 0, 1, 0, 2808},
+{0, 0x50, 0xB, 0, 1, 0, 2809},
+{0, 0x50, 0xB, 0, 1, 0, 2810},
+{0, 0x50, 0xB, 0, 1, 0, 2811},
+{0, 0x50, 0xB, 0, 1, 0, 2812},
+{0, 0x50, 0xB, 0, 1, 0, 2813},
+{0, 0x50, 0xB, 0, 1, 0, 2814},
+{0, 0x50, 0xB, 0, 1, 0, 2815},
+{0, 0x50, 0xB, 0, 1, 0, 2816},
+{0, 0x50, 0xB, 0, 1, 0, 2817},
+{0, 0x50, 0xB, 0, 1, 0, 2818},
+{0, 0x50, 0xB, 0, 1, 0, 2819},
+{0, 0x50, 0xB, 0, 1, 0, 2820},
+{0, 0x50, 0xB, 0, 1, 0, 2821},
+{0, 0x50, 0xB, 0, 1, 0, 2822},
+{0, 0x50, 0xB, 0, 1, 0, 2823},
+{0, 0x50, 0xB, 0, 1, 0, 2824},
+{0, 0x50, 0xB, 0, 1, 0, 2825},
+{0, 0x50, 0xB, 0, 1, 0, 2826},
+{0, 0x50, 0xB, 0, 1, 0, 2827},
+{0, 0x50, 0xB, 0, 1, 0, 2828},
+{0, 0x50, 0xB, 0, 1, 0, 2829},
+{0, 0x50, 0xB, 0, 1, 0, 2830},
+{0, 0x50, 0xB, 0, 1, 0, 2831},
+{0, 0x50, 0xB, 0, 1, 0, 2832},
+{0, 0x50, 0xB, 0, 1, 0, 2833},
+{0, 0x50, 0xB, 0, 1, 0, 2834},
+{0, 0x50, 0xB, 0, 1, 0, 2835},
+{0, 0x50, 0xB, 0, 1, 0, 2836},
+{0, 0x50, 0xB, 0, 1, 0, 2837},
+{0, 0x50, 0xB, 0, 1, 0, 2838},
+{0, 0x50, 0xB, 0, 1, 0, 2839},
+{0, 0x50, 0xB, 0, 1, 0, 2840},
+{0, 0x50, 0xB, 0, 1, 0, 2841},
+{0, 0x50, 0xB, 0, 1, 0, 2842},
+{0, 0x50, 0xB, 0, 1, 0, 2843},
+{0, 0x50, 0xB, 0, 1, 0, 2844},
+{0, 0x50, 0xB, 0, 1, 0, 2845},
+{0, 0x50, 0xB, 0, 1, 0, 2846},
+{0, 0x50, 0xB, 0, 1, 0, 2847},
+{0, 0x50, 0xB, 0, 1, 0, 2848},
+{0, 0x50, 0xB, 0, 1, 0, 2849},
+{0, 0x50, 0xB, 0, 1, 0, 2850},
+{0, 0x50, 0xB, 0, 1, 0, 2851},
+{0, 0x50, 0xB, 0, 1, 0, 2852},
+{0, 0x50, 0xB, 0, 1, 0, 2853},
+{0, 0x50, 0xB, 0, 1, 0, 2854},
+{0, 0x50, 0xB, 0, 1, 0, 2855},
+{0, 0x50, 0xB, 0, 1, 0, 2856},
+{0, 0x50, 0xB, 0, 1, 0, 2857},
+{0, 0x50, 0xB, 0, 1, 0, 2858},
+{0, 0x50, 0xB, 0, 1, 0, 2859},
+{0, 0x50, 0xB, 0, 1, 0, 2860},
+{0, 0x50, 0xB, 0, 1, 0, 2861},
+{0, 0x50, 0xB, 0, 1, 0, 2862},
+{0, 0x50, 0xB, 0, 1, 0, 2863},
+{0, 0x50, 0xB, 0, 1, 0, 2864},
+{0, 0x50, 0xB, 0, 1, 0, 2865},
+{0, 0x50, 0xB, 0, 1, 0, 2866},
+{0, 0x50, 0xB, 0, 1, 0, 2867},
+{0, 0x50, 0xB, 0, 1, 0, 2868},
+{0, 0x50, 0xB, 0, 1, 0, 2869},
+{0, 0x50, 0xB, 0, 1, 0, 2870},
+{0, 0x50, 0xB, 0, 1, 0, 2871},
+{0, 0x50, 0xB, 0, 1, 0, 2872},
+{0, 0x50, 0xB, 0, 1, 0, 2873},
+{0, 0x50, 0xB, 0, 1, 0, 2874},
+{0, 0x50, 0xB, 0, 1, 0, 2875},
+{0, 0x50, 0xB, 0, 1, 0, 2876},
+{0, 0x50, 0xB, 0, 1, 0, 2877},
+{0, 0x50, 0xB, 0, 1, 0, 2878},
+{0, 0x50, 0xB, 0, 1, 0, 2879},
+{0, 0x50, 0xB, 0, 1, 0, 2880},
+{0, 0x50, 0xB, 0, 1, 0, 2881},
+{0, 0x50, 0xB, 0, 1, 0, 2882},
+{0, 0x50, 0xB, 0, 1, 0, 2883},
+{0, 0x50, 0xB, 0, 1, 0, 2884},
+{0, 0x50, 0xB, 0, 1, 0, 2885},
+{0, 0x50, 0xB, 0, 1, 0, 2886},
+{0, 0x50, 0xB, 0, 1, 0, 2887},
+{0, 0x50, 0xB, 0, 1, 0, 2888},
+{0, 0x50, 0xB, 0, 1, 0, 2889},
+{0, 0x50, 0xB, 0, 1, 0, 2890},
+{0, 0x50, 0xB, 0, 1, 0, 2891},
+{0, 0x50, 0xB, 0, 1, 0, 2892},
+{0, 0x50, 0xB, 0, 1, 0, 2893},
+{0, 0x50, 0xB, 0, 1, 0, 2894},
+{0, 0x50, 0xB, 0, 1, 0, 2895},
+{0, 0x50, 0xB, 0, 1, 0, 2896},
+{0, 0x50, 0xB, 0, 1, 0, 2897},
+{0, 0x50, 0xB, 0, 1, 0, 2898},
+{0, 0x50, 0xB, 0, 1, 0, 2899},
+{0, 0x50, 0xB, 0, 1, 0, 2900},
+{0, 0x50, 0xB, 0, 1, 0, 2901},
+{0, 0x50, 0xB, 0, 1, 0, 2902},
+{0, 0x50, 0xB, 0, 1, 0, 2903},
+{0, 0x50, 0xB, 0, 1, 0, 2904},
+{0, 0x50, 0xB, 0, 1, 0, 2905},
+{0, 0x50, 0xB, 0, 1, 0, 2906},
+{0, 0x50, 0xB, 0, 1, 0, 2907},
+{0, 0x50, 0xB, 0, 1, 0, 2908},
+{0, 0x50, 0xB, 0, 1, 0, 2909},
+{0, 0x50, 0xB, 0, 1, 0, 2910},
+{0, 0x50, 0xB, 0, 1, 0, 2911},
+{0, 0x50, 0xB, 0, 1, 0, 2912},
+{0, 0x50, 0xB, 0, 1, 0, 2913},
+{0, 0x50, 0xB, 0, 1, 0, 2914},
+{0, 0x50, 0xB, 0, 1, 0, 2915},
+{0, 0x50, 0xB, 0, 1, 0, 2916},
+{0, 0x50, 0xB, 0, 1, 0, 2917},
+{0, 0x50, 0xB, 0, 1, 0, 2918},
+{0, 0x50, 0xB, 0, 1, 0, 2919},
+{0, 0x50, 0xB, 0, 1, 0, 2920},
+{0, 0x50, 0xB, 0, 1, 0, 2921},
+{0, 0x50, 0xB, 0, 1, 0, 2922},
+{0, 0x50, 0xB, 0, 1, 0, 2923},
+{0, 0x50, 0xB, 0, 1, 0, 2924},
+{0, 0x50, 0xB, 0, 1, 0, 2925},
+{0, 0x50, 0xB, 0, 1, 0, 2926},
+{0, 0x50, 0xB, 0, 1, 0, 2927},
+{0, 0x50, 0xB, 0, 1, 0, 2928},
+{0, 0x50, 0xB, 0, 1, 0, 2929},
+{0, 0x50, 0xB, 0, 1, 0, 2930},
+{0, 0x50, 0xB, 0, 1, 0, 2931},
+{0, 0x50, 0xB, 0, 1, 0, 2932},
+{0, 0x50, 0xB, 0, 1, 0, 2933},
+{0, 0x50, 0xB, 0, 1, 0, 2934},
+{0, 0x50, 0xB, 0, 1, 0, 2935},
+{0, 0x50, 0xB, 0, 1, 0, 2936},
+{0, 0x50, 0xB, 0, 1, 0, 2937},
+{0, 0x50, 0xB, 0, 1, 0, 2938},
+{0, 0x50, 0xB, 0, 1, 0, 2939},
+{0, 0x50, 0xB, 0, 1, 0, 2940},
+{0, 0x50, 0xB, 0, 1, 0, 2941},
+{0, 0x50, 0xB, 0, 1, 0, 2942},
+{0, 0x50, 0xB, 0, 1, 0, 2943},
+{0, 0x50, 0xB, 0, 1, 0, 2944},
+{0, 0x50, 0xB, 0, 1, 0, 2945},
+{0, 0x50, 0xB, 0, 1, 0, 2946},
+{0, 0x50, 0xB, 0, 1, 0, 2947},
+{0, 0x50, 0xB, 0, 1, 0, 2948},
+{0, 0x50, 0xB, 0, 1, 0, 2949},
+{0, 0x50, 0xB, 0, 1, 0, 2950},
+{0, 0x50, 0xB, 0, 1, 0, 2951},
+{0, 0x50, 0xB, 0, 1, 0, 2952},
+{0, 0x50, 0xB, 0, 1, 0, 2953},
+{0, 0x50, 0xB, 0, 1, 0, 2954},
+{0, 0x50, 0xB, 0, 1, 0, 2955},
+{0, 0x50, 0xB, 0, 1, 0, 2956},
+{0, 0x50, 0xB, 0, 1, 0, 2957},
+{0, 0x50, 0xB, 0, 1, 0, 2958},
+{0, 0x50, 0xB, 0, 1, 0, 2959},
+{0, 0x50, 0xB, 0, 1, 0, 2960},
+{0, 0x50, 0xB, 0, 1, 0, 2961},
+{0, 0x50, 0xB, 0, 1, 0, 2962},
+{0, 0x50, 0xB, 0, 1, 0, 2963},
+{0, 0x50, 0xB, 0, 1, 0, 2964},
+{0, 0x50, 0xB, 0, 1, 0, 2965},
+{0, 0x50, 0xB, 0, 1, 0, 2966},
+{0, 0x50, 0xB, 0, 1, 0, 2967},
+{0, 0x50, 0xB, 0, 1, 0, 2968},
+{0, 0x50, 0xB, 0, 1, 0, 2969},
+{0, 0x50, 0xB, 0, 1, 0, 2970},
+{0, 0x50, 0xB, 0, 1, 0, 2971},
+{0, 0x50, 0xB, 0, 1, 0, 2972},
+{0, 0x50, 0xB, 0, 1, 0, 2973},
+{0, 0x50, 0xB, 0, 1, 0, 2974},
+{0, 0x50, 0xB, 0, 1, 0, 2975},
+{0, 0x50, 0xB, 0, 1, 0, 2976},
+{0, 0x50, 0xB, 0, 1, 0, 2977},
+{0, 0x50, 0xB, 0, 1, 0, 2978},
+{0, 0x50, 0xB, 0, 1, 0, 2979},
+{0, 0x50, 0xB, 0, 1, 0, 2980},
+{0, 0x50, 0xB, 0, 1, 0, 2981},
+{0, 0x50, 0xB, 0, 1, 0, 2982},
+{0, 0x50, 0xB, 0, 1, 0, 2983},
+{0, 0x50, 0xB, 0, 1, 0, 2984},
+{0, 0x50, 0xB, 0, 1, 0, 2985},
+{0, 0x50, 0xB, 0, 1, 0, 2986},
+{0, 0x50, 0xB, 0, 1, 0, 2987},
+{0, 0x50, 0xB, 0, 1, 0, 2988},
+{0, 0x50, 0xB, 0, 1, 0, 2989},
+{0, 0x50, 0xB, 0, 1, 0, 2990},
+{0, 0x50, 0xB, 0, 1, 0, 2991},
+{0, 0x50, 0xB, 0, 1, 0, 2992},
+{0, 0x50, 0xB, 0, 1, 0, 2993},
+{0, 0x50, 0xB, 0, 1, 0, 2994},
+{0, 0x50, 0xB, 0, 1, 0, 2995},
+{0, 0x50, 0xB, 0, 1, 0, 2996},
+{0, 0x50, 0xB, 0, 1, 0, 2997},
+{0, 0x50, 0xB, 0, 1, 0, 2998},
+{0, 0x50, 0xB, 0, 1, 0, 2999},
+{0, 0x50, 0xB, 0, 1, 0, 3000},
+{0, 0x50, 0xB, 0, 1, 0, 3001},
+{0, 0x50, 0xB, 0, 1, 0, 3002},
+{0, 0x50, 0xB, 0, 1, 0, 3003},
+{0, 0x50, 0xB, 0, 1, 0, 3004},
+{0, 0x50, 0xB, 0, 1, 0, 3005},
+{0, 0x50, 0xB, 0, 1, 0, 3006},
+{0, 0x50, 0xB, 0, 1, 0, 3007},
+{0, 0x50, 0xB, 0, 1, 0, 3008},
+{0, 0x50, 0xB, 0, 1, 0, 3009},
+{0, 0x50, 0xB, 0, 1, 0, 3010},
+{0, 0x50, 0xB, 0, 1, 0, 3011},
+{0, 0x50, 0xB, 0, 1, 0, 3012},
+{0, 0x50, 0xB, 0, 1, 0, 3013},
+{0, 0x50, 0xB, 0, 1, 0, 3014},
+{224, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x50, 0xB, 0, 1, 0, 3015},
+{0, 0x50, 0xB, 0, 1, 0, 3016},
+{0, 0x50, 0xB, 0, 1, 0, 3017},
+{0, 0x44, 0xF, 2, 2, 3018, 3018},
+{0, 0x44, 0xF, 2, 2, 3020, 3020},
+{0, 0x44, 0xF, 2, 2, 3022, 3022},
+{0, 0x44, 0xF, 2, 2, 3024, 3024},
+{0, 0x44, 0xF, 2, 2, 3026, 3026},
+{0, 0x44, 0xF, 2, 2, 3028, 3028},
+{0, 0x44, 0xF, 2, 2, 3030, 3030},
+{0, 0x44, 0xF, 2, 2, 3032, 3032},
+{0, 0x44, 0xF, 2, 2, 3034, 3034},
+{0, 0x44, 0xF, 2, 2, 3036, 3036},
+{0, 0x44, 0xF, 2, 2, 3038, 3038},
+{0, 0x44, 0xF, 2, 2, 3040, 3040},
+{0, 0x44, 0xF, 2, 2, 3042, 3042},
+{0, 0x44, 0xF, 2, 2, 3044, 3044},
+{0, 0x44, 0xF, 2, 2, 3046, 3046},
+{0, 0x44, 0xF, 2, 2, 3048, 3048},
+{0, 0x44, 0xF, 2, 2, 3050, 3050},
+{0, 0x44, 0xF, 2, 2, 3052, 3052},
+{0, 0x44, 0xF, 2, 2, 3054, 3054},
+{0, 0x44, 0xF, 2, 2, 3056, 3056},
+{0, 0x44, 0xF, 2, 2, 3058, 3058},
+{0, 0x44, 0xF, 2, 2, 3060, 3060},
+{0, 0x44, 0xF, 2, 2, 3062, 3062},
+{0, 0x44, 0xF, 2, 2, 3064, 3064},
+{0, 0x44, 0xF, 2, 2, 3066, 3066},
+{0, 0x44, 0xF, 2, 2, 3068, 3068},
+{8, 0x22, 0x0, 0, 0, 0, 0},
+{0, 0x50, 0xB, 0, 2, 0, 3070},
+{0, 0x50, 0xB, 0, 2, 0, 3072},
+{0, 0x44, 0xF, 2, 2, 3074, 3074},
+{0, 0x50, 0xB, 0, 2, 0, 3076},
+{0, 0x44, 0xF, 2, 2, 3078, 3078},
+{0, 0x44, 0xF, 2, 2, 3080, 3080},
+{0, 0x44, 0xF, 2, 2, 3082, 3082},
+{0, 0x44, 0xF, 2, 2, 3084, 3084},
+{0, 0x44, 0xF, 2, 2, 3086, 3086},
+{0, 0x44, 0xF, 2, 2, 3088, 3088},
+{0, 0x44, 0xF, 2, 2, 3090, 3090},
+{0, 0x44, 0xF, 2, 2, 3092, 3092},
+{0, 0x44, 0xF, 2, 2, 3094, 3094},
+{0, 0x44, 0xF, 2, 2, 3096, 3096},
+{0, 0x44, 0xF, 2, 2, 3098, 3098},
+{0, 0x44, 0xF, 2, 2, 3100, 3100},
+{0, 0x44, 0xF, 2, 2, 3102, 3102},
+{0, 0x44, 0xF, 2, 2, 3104, 3104},
+{0, 0x44, 0xF, 2, 2, 3106, 3106},
+{0, 0x44, 0xF, 2, 2, 3108, 3108},
+{0, 0x44, 0xF, 2, 2, 3110, 3110},
+{0, 0x44, 0xF, 2, 2, 3112, 3112},
+{0, 0x44, 0xF, 2, 2, 3114, 3114},
+{0, 0x44, 0xF, 2, 2, 3116, 3116},
+{0, 0x44, 0xF, 2, 2, 3118, 3118},
+{0, 0x44, 0xF, 2, 2, 3120, 3120},
+{0, 0x44, 0xF, 2, 2, 3122, 3122},
+{0, 0x44, 0xF, 2, 2, 3124, 3124},
+{0, 0x44, 0xF, 2, 2, 3126, 3126},
+{0, 0x44, 0xF, 2, 2, 3128, 3128},
+{0, 0x44, 0xF, 2, 2, 3130, 3130},
+{0, 0x44, 0xF, 2, 2, 3132, 3132},
+{0, 0x44, 0xF, 2, 2, 3134, 3134},
+{0, 0x44, 0xF, 2, 2, 3136, 3136},
+{0, 0x44, 0xF, 2, 2, 3138, 3138},
+{0, 0x50, 0xB, 0, 2, 0, 3140},
+{0, 0x50, 0xB, 0, 1, 0, 3142},
+{0, 0x50, 0xB, 0, 1, 0, 3143},
+{0, 0x50, 0xB, 0, 1, 0, 3144},
+{0, 0x50, 0xB, 0, 1, 0, 3145},
+{0, 0x50, 0xB, 0, 1, 0, 3146},
+{0, 0x50, 0xB, 0, 1, 0, 3147},
+{0, 0x50, 0xB, 0, 1, 0, 3148},
+{0, 0x50, 0xB, 0, 1, 0, 3149},
+{0, 0x50, 0xB, 0, 1, 0, 3150},
+{0, 0x50, 0xB, 0, 1, 0, 3151},
+{0, 0x50, 0xB, 0, 1, 0, 3152},
+{0, 0x50, 0xB, 0, 1, 0, 3153},
+{0, 0x50, 0xB, 0, 1, 0, 3154},
+{0, 0x50, 0xB, 0, 1, 0, 3155},
+{0, 0x50, 0xB, 0, 1, 0, 3156},
+{0, 0x50, 0xB, 0, 1, 0, 3157},
+{0, 0x50, 0xB, 0, 1, 0, 3158},
+{0, 0x50, 0xB, 0, 1, 0, 3159},
+{0, 0x50, 0xB, 0, 1, 0, 3160},
+{0, 0x50, 0xB, 0, 1, 0, 3161},
+{0, 0x50, 0xB, 0, 1, 0, 3162},
+{0, 0x50, 0xB, 0, 1, 0, 3163},
+{0, 0x50, 0xB, 0, 1, 0, 3164},
+{0, 0x50, 0xB, 0, 1, 0, 3165},
+{0, 0x50, 0xB, 0, 1, 0, 3166},
+{0, 0x50, 0xB, 0, 1, 0, 3167},
+{0, 0x50, 0xB, 0, 1, 0, 3168},
+{0, 0x50, 0xB, 0, 1, 0, 3169},
+{0, 0x50, 0xB, 0, 1, 0, 3170},
+{0, 0x50, 0xB, 0, 1, 0, 3171},
+{0, 0x50, 0xB, 0, 1, 0, 3172},
+{0, 0x50, 0xB, 0, 1, 0, 3173},
+{0, 0x50, 0xB, 0, 1, 0, 3174},
+{0, 0x50, 0xB, 0, 1, 0, 3175},
+{0, 0x50, 0xB, 0, 1, 0, 3176},
+{0, 0x50, 0xB, 0, 1, 0, 3177},
+{0, 0x50, 0xB, 0, 1, 0, 3178},
+{0, 0x50, 0xB, 0, 1, 0, 3179},
+{0, 0x50, 0xB, 0, 1, 0, 3180},
+{0, 0x50, 0xB, 0, 1, 0, 3181},
+{0, 0x50, 0xB, 0, 1, 0, 3182},
+{0, 0x50, 0xB, 0, 1, 0, 3183},
+{0, 0x50, 0xB, 0, 1, 0, 3184},
+{0, 0x50, 0xB, 0, 1, 0, 3185},
+{0, 0x50, 0xB, 0, 1, 0, 3186},
+{0, 0x50, 0xB, 0, 1, 0, 3187},
+{0, 0x50, 0xB, 0, 1, 0, 3188},
+{0, 0x50, 0xB, 0, 1, 0, 3189},
+{0, 0x50, 0xB, 0, 1, 0, 3190},
+{0, 0x50, 0xB, 0, 1, 0, 3191},
+{0, 0x50, 0xB, 0, 1, 0, 3192},
+{0, 0x50, 0xB, 0, 1, 0, 3193},
+{0, 0x50, 0xB, 0, 1, 0, 3194},
+{0, 0x50, 0xB, 0, 1, 0, 3195},
+{0, 0x50, 0xB, 0, 1, 0, 3196},
+{0, 0x50, 0xB, 0, 1, 0, 3197},
+{0, 0x50, 0xB, 0, 1, 0, 3198},
+{0, 0x50, 0xB, 0, 1, 0, 3199},
+{0, 0x50, 0xB, 0, 1, 0, 3200},
+{0, 0x50, 0xB, 0, 1, 0, 3201},
+{0, 0x50, 0xB, 0, 1, 0, 3202},
+{0, 0x50, 0xB, 0, 1, 0, 3203},
+{0, 0x50, 0xB, 0, 1, 0, 3204},
+{0, 0x50, 0xB, 0, 1, 0, 3205},
+{0, 0x50, 0xB, 0, 1, 0, 3206},
+{0, 0x50, 0xB, 0, 1, 0, 3207},
+{0, 0x50, 0xB, 0, 1, 0, 3208},
+{0, 0x50, 0xB, 0, 1, 0, 3209},
+{0, 0x50, 0xB, 0, 1, 0, 3210},
+{0, 0x50, 0xB, 0, 1, 0, 3211},
+{0, 0x50, 0xB, 0, 1, 0, 3212},
+{0, 0x50, 0xB, 0, 1, 0, 3213},
+{0, 0x50, 0xB, 0, 1, 0, 3214},
+{0, 0x50, 0xB, 0, 1, 0, 3215},
+{0, 0x50, 0xB, 0, 1, 0, 3216},
+{0, 0x50, 0xB, 0, 1, 0, 3217},
+{0, 0x50, 0xB, 0, 1, 0, 3218},
+{0, 0x50, 0xB, 0, 1, 0, 3219},
+{0, 0x50, 0xB, 0, 1, 0, 3220},
+{0, 0x50, 0xB, 0, 1, 0, 3221},
+{0, 0x50, 0xB, 0, 1, 0, 3222},
+{0, 0x50, 0xB, 0, 1, 0, 3223},
+{0, 0x50, 0xB, 0, 1, 0, 3224},
+{0, 0x50, 0xB, 0, 1, 0, 3225},
+{0, 0x50, 0xB, 0, 1, 0, 3226},
+{0, 0x50, 0xB, 0, 1, 0, 3227},
+{0, 0x50, 0xB, 0, 1, 0, 3228},
+{0, 0x50, 0xB, 0, 1, 0, 3229},
+{0, 0x50, 0xB, 0, 1, 0, 3230},
+{0, 0x50, 0xB, 0, 1, 0, 3231},
+{0, 0x50, 0xB, 0, 1, 0, 3232},
+{0, 0x50, 0xB, 0, 1, 0, 3233},
+{0, 0x50, 0xB, 0, 1, 0, 3234},
+{0, 0x50, 0xB, 0, 1, 0, 3235},
+{0, 0x50, 0xB, 0, 1, 0, 3236},
+{0, 0x50, 0xB, 0, 1, 0, 3237},
+{0, 0x50, 0xB, 0, 1, 0, 3238},
+{0, 0x50, 0xB, 0, 1, 0, 3239},
+{0, 0x50, 0xB, 0, 1, 0, 3240},
+{0, 0x50, 0xB, 0, 1, 0, 3241},
+{0, 0x50, 0xB, 0, 1, 0, 3242},
+{0, 0x50, 0xB, 0, 1, 0, 3243},
+{0, 0x50, 0xB, 0, 1, 0, 3244},
+{0, 0x50, 0xB, 0, 1, 0, 3245},
+{0, 0x50, 0xB, 0, 3, 0, 3246},
+{0, 0x50, 0xB, 0, 3, 0, 3249},
+{0, 0x50, 0xB, 0, 3, 0, 3252},
+{0, 0x50, 0xB, 0, 3, 0, 3255},
+{0, 0x50, 0xB, 0, 3, 0, 3258},
+{0, 0x50, 0xB, 0, 3, 0, 3261},
+{0, 0x50, 0xB, 0, 3, 0, 3264},
+{0, 0x50, 0xB, 0, 3, 0, 3267},
+{0, 0x50, 0xB, 0, 3, 0, 3270},
+{0, 0x50, 0xB, 0, 3, 0, 3273},
+{0, 0x50, 0xB, 0, 3, 0, 3276},
+{0, 0x50, 0xB, 0, 3, 0, 3279},
+{0, 0x50, 0xB, 0, 3, 0, 3282},
+{0, 0x50, 0xB, 0, 3, 0, 3285},
+{0, 0x50, 0xB, 0, 4, 0, 3288},
+{0, 0x50, 0xB, 0, 4, 0, 3292},
+{0, 0x50, 0xB, 0, 4, 0, 3296},
+{0, 0x50, 0xB, 0, 4, 0, 3300},
+{0, 0x50, 0xB, 0, 4, 0, 3304},
+{0, 0x50, 0xB, 0, 4, 0, 3308},
+{0, 0x50, 0xB, 0, 4, 0, 3312},
+{0, 0x50, 0xB, 0, 4, 0, 3316},
+{0, 0x50, 0xB, 0, 4, 0, 3320},
+{0, 0x50, 0xB, 0, 4, 0, 3324},
+{0, 0x50, 0xB, 0, 4, 0, 3328},
+{0, 0x50, 0xB, 0, 4, 0, 3332},
+{0, 0x50, 0xB, 0, 4, 0, 3336},
+{0, 0x50, 0xB, 0, 4, 0, 3340},
+{0, 0x50, 0xB, 0, 4, 0, 3344},
+{0, 0x50, 0xB, 0, 7, 0, 3348},
+{0, 0x50, 0xB, 0, 6, 0, 3355},
+{0, 0x50, 0xB, 0, 3, 0, 3361},
+{0, 0x50, 0xB, 0, 3, 0, 3364},
+{0, 0x50, 0xB, 0, 3, 0, 3367},
+{0, 0x50, 0xB, 0, 3, 0, 3370},
+{0, 0x50, 0xB, 0, 3, 0, 3373},
+{0, 0x50, 0xB, 0, 3, 0, 3376},
+{0, 0x50, 0xB, 0, 3, 0, 3379},
+{0, 0x50, 0xB, 0, 3, 0, 3382},
+{0, 0x50, 0xB, 0, 3, 0, 3385},
+{0, 0x50, 0xB, 0, 3, 0, 3388},
+{0, 0x50, 0xB, 0, 3, 0, 3391},
+{0, 0x50, 0xB, 0, 3, 0, 3394},
+{0, 0x50, 0xB, 0, 3, 0, 3397},
+{0, 0x50, 0xB, 0, 3, 0, 3400},
+{0, 0x50, 0xB, 0, 3, 0, 3403},
+{0, 0x50, 0xB, 0, 3, 0, 3406},
+{0, 0x50, 0xB, 0, 3, 0, 3409},
+{0, 0x50, 0xB, 0, 3, 0, 3412},
+{0, 0x50, 0xB, 0, 3, 0, 3415},
+{0, 0x50, 0xB, 0, 3, 0, 3418},
+{0, 0x50, 0xB, 0, 3, 0, 3421},
+{0, 0x50, 0xB, 0, 3, 0, 3424},
+{0, 0x50, 0xB, 0, 3, 0, 3427},
+{0, 0x50, 0xB, 0, 3, 0, 3430},
+{0, 0x50, 0xB, 0, 3, 0, 3433},
+{0, 0x50, 0xB, 0, 3, 0, 3436},
+{0, 0x50, 0xB, 0, 3, 0, 3439},
+{0, 0x50, 0xB, 0, 3, 0, 3442},
+{0, 0x50, 0xB, 0, 3, 0, 3445},
+{0, 0x50, 0xB, 0, 3, 0, 3448},
+{0, 0x50, 0xB, 0, 3, 0, 3451},
+{0, 0x50, 0xB, 0, 3, 0, 3454},
+{0, 0x50, 0xB, 0, 3, 0, 3457},
+{0, 0x50, 0xB, 0, 3, 0, 3460},
+{0, 0x50, 0xB, 0, 3, 0, 3463},
+{0, 0x50, 0xB, 0, 3, 0, 3466},
+{0, 0x50, 0xB, 0, 1, 0, 3469},
+{0, 0x50, 0xB, 0, 1, 0, 3470},
+{0, 0x50, 0xB, 0, 1, 0, 3471},
+{0, 0x50, 0xB, 0, 3, 0, 3472},
+{0, 0x50, 0xB, 0, 2, 0, 3475},
+{0, 0x50, 0xB, 0, 2, 0, 3477},
+{0, 0x50, 0xB, 0, 2, 0, 3479},
+{0, 0x50, 0xB, 0, 2, 0, 3481},
+{0, 0x50, 0xB, 0, 2, 0, 3483},
+{0, 0x50, 0xB, 0, 2, 0, 3485},
+{0, 0x50, 0xB, 0, 2, 0, 3487},
+{0, 0x50, 0xB, 0, 2, 0, 3489},
+{0, 0x50, 0xB, 0, 2, 0, 3491},
+{0, 0x50, 0xB, 0, 2, 0, 3493},
+{0, 0x50, 0xB, 0, 2, 0, 3495},
+{0, 0x50, 0xB, 0, 2, 0, 3497},
+{0, 0x50, 0xB, 0, 2, 0, 3499},
+{0, 0x50, 0xB, 0, 2, 0, 3501},
+{0, 0x50, 0xB, 0, 2, 0, 3503},
+{0, 0x50, 0xB, 0, 2, 0, 3505},
+{0, 0x50, 0xB, 0, 2, 0, 3507},
+{0, 0x50, 0xB, 0, 2, 0, 3509},
+{0, 0x50, 0xB, 0, 2, 0, 3511},
+{0, 0x50, 0xB, 0, 2, 0, 3513},
+{0, 0x50, 0xB, 0, 2, 0, 3515},
+{0, 0x50, 0xB, 0, 2, 0, 3517},
+{0, 0x50, 0xB, 0, 2, 0, 3519},
+{0, 0x50, 0xB, 0, 2, 0, 3521},
+{0, 0x50, 0xB, 0, 2, 0, 3523},
+{0, 0x50, 0xB, 0, 2, 0, 3525},
+{0, 0x50, 0xB, 0, 2, 0, 3527},
+{0, 0x50, 0xB, 0, 2, 0, 3529},
+{0, 0x50, 0xB, 0, 2, 0, 3531},
+{0, 0x50, 0xB, 0, 5, 0, 3533},
+{0, 0x50, 0xB, 0, 4, 0, 3538},
+{0, 0x50, 0xB, 0, 2, 0, 3542},
+{0, 0x50, 0xB, 0, 1, 0, 3544},
+{0, 0x50, 0xB, 0, 1, 0, 3545},
+{0, 0x50, 0xB, 0, 1, 0, 3546},
+{0, 0x50, 0xB, 0, 1, 0, 3547},
+{0, 0x50, 0xB, 0, 1, 0, 3548},
+{0, 0x50, 0xB, 0, 1, 0, 3549},
+{0, 0x50, 0xB, 0, 1, 0, 3550},
+{0, 0x50, 0xB, 0, 1, 0, 3551},
+{0, 0x50, 0xB, 0, 1, 0, 3552},
+{0, 0x50, 0xB, 0, 1, 0, 3553},
+{0, 0x50, 0xB, 0, 1, 0, 3554},
+{0, 0x50, 0xB, 0, 1, 0, 3555},
+{0, 0x50, 0xB, 0, 1, 0, 3556},
+{0, 0x50, 0xB, 0, 1, 0, 3557},
+{0, 0x50, 0xB, 0, 1, 0, 3558},
+{0, 0x50, 0xB, 0, 1, 0, 3559},
+{0, 0x50, 0xB, 0, 1, 0, 3560},
+{0, 0x50, 0xB, 0, 1, 0, 3561},
+{0, 0x50, 0xB, 0, 1, 0, 3562},
+{0, 0x50, 0xB, 0, 1, 0, 3563},
+{0, 0x50, 0xB, 0, 1, 0, 3564},
+{0, 0x50, 0xB, 0, 1, 0, 3565},
+{0, 0x50, 0xB, 0, 1, 0, 3566},
+{0, 0x50, 0xB, 0, 1, 0, 3567},
+{0, 0x50, 0xB, 0, 1, 0, 3568},
+{0, 0x50, 0xB, 0, 1, 0, 3569},
+{0, 0x50, 0xB, 0, 1, 0, 3570},
+{0, 0x50, 0xB, 0, 1, 0, 3571},
+{0, 0x50, 0xB, 0, 1, 0, 3572},
+{0, 0x50, 0xB, 0, 1, 0, 3573},
+{0, 0x50, 0xB, 0, 1, 0, 3574},
+{0, 0x50, 0xB, 0, 1, 0, 3575},
+{0, 0x50, 0xB, 0, 2, 0, 3576},
+{0, 0x50, 0xB, 0, 2, 0, 3578},
+{0, 0x50, 0xB, 0, 2, 0, 3580},
+{0, 0x50, 0xB, 0, 2, 0, 3582},
+{0, 0x50, 0xB, 0, 2, 0, 3584},
+{0, 0x50, 0xB, 0, 2, 0, 3586},
+{0, 0x50, 0xB, 0, 2, 0, 3588},
+{0, 0x50, 0xB, 0, 2, 0, 3590},
+{0, 0x50, 0xB, 0, 2, 0, 3592},
+{0, 0x50, 0xB, 0, 2, 0, 3594},
+{0, 0x50, 0xB, 0, 2, 0, 3596},
+{0, 0x50, 0xB, 0, 2, 0, 3598},
+{0, 0x50, 0xB, 0, 2, 0, 3600},
+{0, 0x50, 0xB, 0, 2, 0, 3602},
+{0, 0x50, 0xB, 0, 2, 0, 3604},
+{0, 0x50, 0xB, 0, 2, 0, 3606},
+{0, 0x50, 0xB, 0, 2, 0, 3608},
+{0, 0x50, 0xB, 0, 2, 0, 3610},
+{0, 0x50, 0xB, 0, 2, 0, 3612},
+{0, 0x50, 0xB, 0, 2, 0, 3614},
+{0, 0x50, 0xB, 0, 2, 0, 3616},
+{0, 0x50, 0xB, 0, 2, 0, 3618},
+{0, 0x50, 0xB, 0, 2, 0, 3620},
+{0, 0x50, 0xB, 0, 2, 0, 3622},
+{0, 0x50, 0xB, 0, 3, 0, 3624},
+{0, 0x50, 0xB, 0, 3, 0, 3627},
+{0, 0x50, 0xB, 0, 3, 0, 3630},
+{0, 0x50, 0xB, 0, 2, 0, 3633},
+{0, 0x50, 0xB, 0, 3, 0, 3635},
+{0, 0x50, 0xB, 0, 2, 0, 3638},
+{0, 0x50, 0xB, 0, 3, 0, 3640},
+{0, 0x50, 0xB, 0, 1, 0, 3643},
+{0, 0x50, 0xB, 0, 1, 0, 3644},
+{0, 0x50, 0xB, 0, 1, 0, 3645},
+{0, 0x50, 0xB, 0, 1, 0, 3646},
+{0, 0x50, 0xB, 0, 1, 0, 3647},
+{0, 0x50, 0xB, 0, 1, 0, 3648},
+{0, 0x50, 0xB, 0, 1, 0, 3649},
+{0, 0x50, 0xB, 0, 1, 0, 3650},
+{0, 0x50, 0xB, 0, 1, 0, 3651},
+{0, 0x50, 0xB, 0, 1, 0, 3652},
+{0, 0x50, 0xB, 0, 1, 0, 3653},
+{0, 0x50, 0xB, 0, 1, 0, 3654},
+{0, 0x50, 0xB, 0, 1, 0, 3655},
+{0, 0x50, 0xB, 0, 1, 0, 3656},
+{0, 0x50, 0xB, 0, 1, 0, 3657},
+{0, 0x50, 0xB, 0, 1, 0, 3658},
+{0, 0x50, 0xB, 0, 1, 0, 3659},
+{0, 0x50, 0xB, 0, 1, 0, 3660},
+{0, 0x50, 0xB, 0, 1, 0, 3661},
+{0, 0x50, 0xB, 0, 1, 0, 3662},
+{0, 0x50, 0xB, 0, 1, 0, 3663},
+{0, 0x50, 0xB, 0, 1, 0, 3664},
+{0, 0x50, 0xB, 0, 1, 0, 3665},
+{0, 0x50, 0xB, 0, 1, 0, 3666},
+{0, 0x50, 0xB, 0, 1, 0, 3667},
+{0, 0x50, 0xB, 0, 1, 0, 3668},
+{0, 0x50, 0xB, 0, 1, 0, 3669},
+{0, 0x50, 0xB, 0, 1, 0, 3670},
+{0, 0x50, 0xB, 0, 1, 0, 3671},
+{0, 0x50, 0xB, 0, 1, 0, 3672},
+{0, 0x50, 0xB, 0, 1, 0, 3673},
+{0, 0x50, 0xB, 0, 1, 0, 3674},
+{0, 0x50, 0xB, 0, 1, 0, 3675},
+{0, 0x50, 0xB, 0, 1, 0, 3676},
+{0, 0x50, 0xB, 0, 1, 0, 3677},
+{0, 0x50, 0xB, 0, 1, 0, 3678},
+{0, 0x50, 0xB, 0, 1, 0, 3679},
+{0, 0x50, 0xB, 0, 1, 0, 3680},
+{0, 0x50, 0xB, 0, 1, 0, 3681},
+{0, 0x50, 0xB, 0, 1, 0, 3682},
+{0, 0x50, 0xB, 0, 1, 0, 3683},
+{0, 0x50, 0xB, 0, 1, 0, 3684},
+{0, 0x50, 0xB, 0, 1, 0, 3685},
+{0, 0x50, 0xB, 0, 1, 0, 3686},
+{0, 0x50, 0xB, 0, 1, 0, 3687},
+{0, 0x50, 0xB, 0, 1, 0, 3688},
+{0, 0x50, 0xB, 0, 1, 0, 3689},
+{0, 0x50, 0xB, 0, 2, 0, 3690},
+{0, 0x50, 0xB, 0, 5, 0, 3692},
+{0, 0x50, 0xB, 0, 4, 0, 3697},
+{0, 0x50, 0xB, 0, 5, 0, 3701},
+{0, 0x50, 0xB, 0, 3, 0, 3706},
+{0, 0x50, 0xB, 0, 5, 0, 3709},
+{0, 0x50, 0xB, 0, 3, 0, 3714},
+{0, 0x50, 0xB, 0, 3, 0, 3717},
+{0, 0x50, 0xB, 0, 6, 0, 3720},
+{0, 0x50, 0xB, 0, 4, 0, 3726},
+{0, 0x50, 0xB, 0, 3, 0, 3730},
+{0, 0x50, 0xB, 0, 3, 0, 3733},
+{0, 0x50, 0xB, 0, 3, 0, 3736},
+{0, 0x50, 0xB, 0, 4, 0, 3739},
+{0, 0x50, 0xB, 0, 4, 0, 3743},
+{0, 0x50, 0xB, 0, 4, 0, 3747},
+{0, 0x50, 0xB, 0, 4, 0, 3751},
+{0, 0x50, 0xB, 0, 4, 0, 3755},
+{0, 0x50, 0xB, 0, 4, 0, 3759},
+{0, 0x50, 0xB, 0, 4, 0, 3763},
+{0, 0x50, 0xB, 0, 6, 0, 3767},
+{0, 0x50, 0xB, 0, 2, 0, 3773},
+{0, 0x50, 0xB, 0, 6, 0, 3775},
+{0, 0x50, 0xB, 0, 6, 0, 3781},
+{0, 0x50, 0xB, 0, 5, 0, 3787},
+{0, 0x50, 0xB, 0, 4, 0, 3792},
+{0, 0x50, 0xB, 0, 6, 0, 3796},
+{0, 0x50, 0xB, 0, 6, 0, 3802},
+{0, 0x50, 0xB, 0, 4, 0, 3808},
+{0, 0x50, 0xB, 0, 3, 0, 3812},
+{0, 0x50, 0xB, 0, 3, 0, 3815},
+{0, 0x50, 0xB, 0, 4, 0, 3818},
+{0, 0x50, 0xB, 0, 4, 0, 3822},
+{0, 0x50, 0xB, 0, 5, 0, 3826},
+{0, 0x50, 0xB, 0, 5, 0, 3831},
+{0, 0x50, 0xB, 0, 3, 0, 3836},
+{0, 0x50, 0xB, 0, 3, 0, 3839},
+{0, 0x50, 0xB, 0, 4, 0, 3842},
+{0, 0x50, 0xB, 0, 3, 0, 3846},
+{0, 0x50, 0xB, 0, 3, 0, 3849},
+{0, 0x50, 0xB, 0, 2, 0, 3852},
+{0, 0x50, 0xB, 0, 2, 0, 3854},
+{0, 0x50, 0xB, 0, 3, 0, 3856},
+{0, 0x50, 0xB, 0, 3, 0, 3859},
+{0, 0x50, 0xB, 0, 6, 0, 3862},
+{0, 0x50, 0xB, 0, 4, 0, 3868},
+{0, 0x50, 0xB, 0, 5, 0, 3872},
+{0, 0x50, 0xB, 0, 6, 0, 3877},
+{0, 0x50, 0xB, 0, 4, 0, 3883},
+{0, 0x50, 0xB, 0, 3, 0, 3887},
+{0, 0x50, 0xB, 0, 3, 0, 3890},
+{0, 0x50, 0xB, 0, 6, 0, 3893},
+{0, 0x50, 0xB, 0, 4, 0, 3899},
+{0, 0x50, 0xB, 0, 6, 0, 3903},
+{0, 0x50, 0xB, 0, 3, 0, 3909},
+{0, 0x50, 0xB, 0, 5, 0, 3912},
+{0, 0x50, 0xB, 0, 3, 0, 3917},
+{0, 0x50, 0xB, 0, 4, 0, 3920},
+{0, 0x50, 0xB, 0, 3, 0, 3924},
+{0, 0x50, 0xB, 0, 4, 0, 3927},
+{0, 0x50, 0xB, 0, 5, 0, 3931},
+{0, 0x50, 0xB, 0, 4, 0, 3936},
+{0, 0x50, 0xB, 0, 5, 0, 3940},
+{0, 0x50, 0xB, 0, 4, 0, 3945},
+{0, 0x50, 0xB, 0, 2, 0, 3949},
+{0, 0x50, 0xB, 0, 5, 0, 3951},
+{0, 0x50, 0xB, 0, 3, 0, 3956},
+{0, 0x50, 0xB, 0, 3, 0, 3959},
+{0, 0x50, 0xB, 0, 4, 0, 3962},
+{0, 0x50, 0xB, 0, 3, 0, 3966},
+{0, 0x50, 0xB, 0, 3, 0, 3969},
+{0, 0x50, 0xB, 0, 3, 0, 3972},
+{0, 0x50, 0xB, 0, 5, 0, 3975},
+{0, 0x50, 0xB, 0, 4, 0, 3980},
+{0, 0x50, 0xB, 0, 2, 0, 3984},
+{0, 0x50, 0xB, 0, 6, 0, 3986},
+{0, 0x50, 0xB, 0, 3, 0, 3992},
+{0, 0x50, 0xB, 0, 5, 0, 3995},
+{0, 0x50, 0xB, 0, 4, 0, 4000},
+{0, 0x50, 0xB, 0, 4, 0, 4004},
+{0, 0x50, 0xB, 0, 3, 0, 4008},
+{0, 0x50, 0xB, 0, 3, 0, 4011},
+{0, 0x50, 0xB, 0, 4, 0, 4014},
+{0, 0x50, 0xB, 0, 2, 0, 4018},
+{0, 0x50, 0xB, 0, 4, 0, 4020},
+{0, 0x50, 0xB, 0, 5, 0, 4024},
+{0, 0x50, 0xB, 0, 2, 0, 4029},
+{0, 0x50, 0xB, 0, 6, 0, 4031},
+{0, 0x50, 0xB, 0, 3, 0, 4037},
+{0, 0x50, 0xB, 0, 2, 0, 4040},
+{0, 0x50, 0xB, 0, 2, 0, 4042},
+{0, 0x50, 0xB, 0, 2, 0, 4044},
+{0, 0x50, 0xB, 0, 2, 0, 4046},
+{0, 0x50, 0xB, 0, 2, 0, 4048},
+{0, 0x50, 0xB, 0, 2, 0, 4050},
+{0, 0x50, 0xB, 0, 2, 0, 4052},
+{0, 0x50, 0xB, 0, 2, 0, 4054},
+{0, 0x50, 0xB, 0, 2, 0, 4056},
+{0, 0x50, 0xB, 0, 2, 0, 4058},
+{0, 0x50, 0xB, 0, 3, 0, 4060},
+{0, 0x50, 0xB, 0, 3, 0, 4063},
+{0, 0x50, 0xB, 0, 3, 0, 4066},
+{0, 0x50, 0xB, 0, 3, 0, 4069},
+{0, 0x50, 0xB, 0, 3, 0, 4072},
+{0, 0x50, 0xB, 0, 3, 0, 4075},
+{0, 0x50, 0xB, 0, 3, 0, 4078},
+{0, 0x50, 0xB, 0, 3, 0, 4081},
+{0, 0x50, 0xB, 0, 3, 0, 4084},
+{0, 0x50, 0xB, 0, 3, 0, 4087},
+{0, 0x50, 0xB, 0, 3, 0, 4090},
+{0, 0x50, 0xB, 0, 3, 0, 4093},
+{0, 0x50, 0xB, 0, 3, 0, 4096},
+{0, 0x50, 0xB, 0, 3, 0, 4099},
+{0, 0x50, 0xB, 0, 3, 0, 4102},
+{0, 0x50, 0xB, 0, 3, 0, 4105},
+{0, 0x50, 0xB, 0, 2, 0, 4108},
+{0, 0x50, 0xB, 0, 2, 0, 4110},
+{0, 0x50, 0xB, 0, 3, 0, 4112},
+{0, 0x50, 0xB, 0, 2, 0, 4115},
+{0, 0x50, 0xB, 0, 2, 0, 4117},
+{0, 0x50, 0xB, 0, 2, 0, 4119},
+{0, 0x50, 0xB, 0, 3, 0, 4121},
+{0, 0x50, 0xB, 0, 3, 0, 4124},
+{0, 0x50, 0xB, 0, 2, 0, 4127},
+{0, 0x50, 0xB, 0, 2, 0, 4129},
+{0, 0x50, 0xB, 0, 2, 0, 4131},
+{0, 0x50, 0xB, 0, 2, 0, 4133},
+{0, 0x50, 0xB, 0, 2, 0, 4135},
+{0, 0x50, 0xB, 0, 4, 0, 4137},
+{0, 0x50, 0xB, 0, 2, 0, 4141},
+{0, 0x50, 0xB, 0, 2, 0, 4143},
+{0, 0x50, 0xB, 0, 2, 0, 4145},
+{0, 0x50, 0xB, 0, 2, 0, 4147},
+{0, 0x50, 0xB, 0, 2, 0, 4149},
+{0, 0x50, 0xB, 0, 2, 0, 4151},
+{0, 0x50, 0xB, 0, 2, 0, 4153},
+{0, 0x50, 0xB, 0, 2, 0, 4155},
+{0, 0x50, 0xB, 0, 3, 0, 4157},
+{0, 0x50, 0xB, 0, 4, 0, 4160},
+{0, 0x50, 0xB, 0, 2, 0, 4164},
+{0, 0x50, 0xB, 0, 2, 0, 4166},
+{0, 0x50, 0xB, 0, 2, 0, 4168},
+{0, 0x50, 0xB, 0, 2, 0, 4170},
+{0, 0x50, 0xB, 0, 2, 0, 4172},
+{0, 0x50, 0xB, 0, 2, 0, 4174},
+{0, 0x50, 0xB, 0, 2, 0, 4176},
+{0, 0x50, 0xB, 0, 3, 0, 4178},
+{0, 0x50, 0xB, 0, 3, 0, 4181},
+{0, 0x50, 0xB, 0, 3, 0, 4184},
+{0, 0x50, 0xB, 0, 3, 0, 4187},
+{0, 0x50, 0xB, 0, 2, 0, 4190},
+{0, 0x50, 0xB, 0, 2, 0, 4192},
+{0, 0x50, 0xB, 0, 2, 0, 4194},
+{0, 0x50, 0xB, 0, 2, 0, 4196},
+{0, 0x50, 0xB, 0, 2, 0, 4198},
+{0, 0x50, 0xB, 0, 2, 0, 4200},
+{0, 0x50, 0xB, 0, 2, 0, 4202},
+{0, 0x50, 0xB, 0, 2, 0, 4204},
+{0, 0x50, 0xB, 0, 2, 0, 4206},
+{0, 0x50, 0xB, 0, 2, 0, 4208},
+{0, 0x50, 0xB, 0, 3, 0, 4210},
+{0, 0x50, 0xB, 0, 3, 0, 4213},
+{0, 0x50, 0xB, 0, 2, 0, 4216},
+{0, 0x50, 0xB, 0, 3, 0, 4218},
+{0, 0x50, 0xB, 0, 3, 0, 4221},
+{0, 0x50, 0xB, 0, 3, 0, 4224},
+{0, 0x50, 0xB, 0, 2, 0, 4227},
+{0, 0x50, 0xB, 0, 3, 0, 4229},
+{0, 0x50, 0xB, 0, 3, 0, 4232},
+{0, 0x50, 0xB, 0, 4, 0, 4235},
+{0, 0x50, 0xB, 0, 2, 0, 4239},
+{0, 0x50, 0xB, 0, 3, 0, 4241},
+{0, 0x50, 0xB, 0, 3, 0, 4244},
+{0, 0x50, 0xB, 0, 3, 0, 4247},
+{0, 0x50, 0xB, 0, 3, 0, 4250},
+{0, 0x50, 0xB, 0, 5, 0, 4253},
+{0, 0x50, 0xB, 0, 6, 0, 4258},
+{0, 0x50, 0xB, 0, 2, 0, 4264},
+{0, 0x50, 0xB, 0, 2, 0, 4266},
+{0, 0x50, 0xB, 0, 2, 0, 4268},
+{0, 0x50, 0xB, 0, 2, 0, 4270},
+{0, 0x50, 0xB, 0, 2, 0, 4272},
+{0, 0x50, 0xB, 0, 2, 0, 4274},
+{0, 0x50, 0xB, 0, 2, 0, 4276},
+{0, 0x50, 0xB, 0, 2, 0, 4278},
+{0, 0x50, 0xB, 0, 2, 0, 4280},
+{0, 0x50, 0xB, 0, 2, 0, 4282},
+{0, 0x50, 0xB, 0, 2, 0, 4284},
+{0, 0x50, 0xB, 0, 2, 0, 4286},
+{0, 0x50, 0xB, 0, 2, 0, 4288},
+{0, 0x50, 0xB, 0, 2, 0, 4290},
+{0, 0x50, 0xB, 0, 2, 0, 4292},
+{0, 0x50, 0xB, 0, 2, 0, 4294},
+{0, 0x50, 0xB, 0, 2, 0, 4296},
+{0, 0x50, 0xB, 0, 2, 0, 4298},
+{0, 0x50, 0xB, 0, 4, 0, 4300},
+{0, 0x50, 0xB, 0, 2, 0, 4304},
+{0, 0x50, 0xB, 0, 2, 0, 4306},
+{0, 0x50, 0xB, 0, 2, 0, 4308},
+{0, 0x50, 0xB, 0, 4, 0, 4310},
+{0, 0x50, 0xB, 0, 3, 0, 4314},
+{0, 0x50, 0xB, 0, 2, 0, 4317},
+{0, 0x50, 0xB, 0, 2, 0, 4319},
+{0, 0x50, 0xB, 0, 2, 0, 4321},
+{0, 0x50, 0xB, 0, 2, 0, 4323},
+{0, 0x50, 0xB, 0, 2, 0, 4325},
+{0, 0x50, 0xB, 0, 2, 0, 4327},
+{0, 0x50, 0xB, 0, 2, 0, 4329},
+{0, 0x50, 0xB, 0, 2, 0, 4331},
+{0, 0x50, 0xB, 0, 2, 0, 4333},
+{0, 0x50, 0xB, 0, 2, 0, 4335},
+{0, 0x50, 0xB, 0, 3, 0, 4337},
+{0, 0x50, 0xB, 0, 2, 0, 4340},
+{0, 0x50, 0xB, 0, 2, 0, 4342},
+{0, 0x50, 0xB, 0, 3, 0, 4344},
+{0, 0x50, 0xB, 0, 3, 0, 4347},
+{0, 0x50, 0xB, 0, 2, 0, 4350},
+{0, 0x50, 0xB, 0, 4, 0, 4352},
+{0, 0x50, 0xB, 0, 3, 0, 4356},
+{0, 0x50, 0xB, 0, 2, 0, 4359},
+{0, 0x50, 0xB, 0, 2, 0, 4361},
+{0, 0x50, 0xB, 0, 2, 0, 4363},
+{0, 0x50, 0xB, 0, 2, 0, 4365},
+{0, 0x50, 0xB, 0, 3, 0, 4367},
+{0, 0x50, 0xB, 0, 3, 0, 4370},
+{0, 0x50, 0xB, 0, 2, 0, 4373},
+{0, 0x50, 0xB, 0, 2, 0, 4375},
+{0, 0x50, 0xB, 0, 2, 0, 4377},
+{0, 0x50, 0xB, 0, 2, 0, 4379},
+{0, 0x50, 0xB, 0, 2, 0, 4381},
+{0, 0x50, 0xB, 0, 2, 0, 4383},
+{0, 0x50, 0xB, 0, 2, 0, 4385},
+{0, 0x50, 0xB, 0, 2, 0, 4387},
+{0, 0x50, 0xB, 0, 2, 0, 4389},
+{0, 0x50, 0xB, 0, 3, 0, 4391},
+{0, 0x50, 0xB, 0, 3, 0, 4394},
+{0, 0x50, 0xB, 0, 3, 0, 4397},
+{0, 0x50, 0xB, 0, 3, 0, 4400},
+{0, 0x50, 0xB, 0, 3, 0, 4403},
+{0, 0x50, 0xB, 0, 3, 0, 4406},
+{0, 0x50, 0xB, 0, 3, 0, 4409},
+{0, 0x50, 0xB, 0, 3, 0, 4412},
+{0, 0x50, 0xB, 0, 3, 0, 4415},
+{0, 0x50, 0xB, 0, 3, 0, 4418},
+{0, 0x50, 0xB, 0, 3, 0, 4421},
+{0, 0x50, 0xB, 0, 3, 0, 4424},
+{0, 0x50, 0xB, 0, 3, 0, 4427},
+{0, 0x50, 0xB, 0, 3, 0, 4430},
+{0, 0x50, 0xB, 0, 3, 0, 4433},
+{0, 0x50, 0xB, 0, 3, 0, 4436},
+{0, 0x50, 0xB, 0, 3, 0, 4439},
+{0, 0x50, 0xB, 0, 3, 0, 4442},
+{0, 0x50, 0xB, 0, 3, 0, 4445},
+{0, 0x50, 0xB, 0, 3, 0, 4448},
+{0, 0x50, 0xB, 0, 3, 0, 4451},
+{0, 0x50, 0xB, 0, 3, 0, 4454},
+{0, 0x50, 0xB, 0, 3, 0, 4457},
+{0, 0x50, 0xB, 0, 1, 0, 4460},
+{0, 0x50, 0xB, 0, 1, 0, 4461},
+{0, 0x50, 0xB, 0, 1, 0, 4462},
+{0, 0x50, 0xB, 0, 1, 0, 4463},
+{0, 0x50, 0xB, 0, 1, 0, 4464},
+{0, 0x50, 0xB, 0, 1, 0, 4465},
+{0, 0x50, 0xB, 0, 1, 0, 4466},
+{0, 0x50, 0xB, 0, 1, 0, 4467},
+{0, 0x50, 0xB, 0, 1, 0, 4468},
+{0, 0x50, 0xB, 0, 1, 0, 4469},
+{0, 0x44, 0xF, 0, 0, 0, 0},
+{0, 0x55, 0xA, 1, 1, 4470, 4470},
+{0, 0x55, 0xA, 1, 1, 4471, 4471},
+{0, 0x55, 0xA, 1, 1, 2959, 2959},
+{0, 0x55, 0xA, 1, 1, 4472, 4472},
+{0, 0x55, 0xA, 1, 1, 4473, 4473},
+{0, 0x55, 0xA, 1, 1, 4474, 4474},
+{0, 0x55, 0xA, 1, 1, 4475, 4475},
+{0, 0x55, 0xA, 1, 1, 3013, 3013},
+{0, 0x55, 0xA, 1, 1, 4476, 4476},
+{0, 0x55, 0xA, 1, 1, 2967, 2967},
+{0, 0x55, 0xA, 1, 1, 4477, 4477},
+{0, 0x55, 0xA, 1, 1, 4478, 4478},
+{0, 0x55, 0xA, 1, 1, 4479, 4479},
+{0, 0x55, 0xA, 1, 1, 4480, 4480},
+{0, 0x55, 0xA, 1, 1, 4481, 4481},
+{0, 0x55, 0xA, 1, 1, 4482, 4482},
+{0, 0x55, 0xA, 1, 1, 4483, 4483},
+{0, 0x55, 0xA, 1, 1, 4484, 4484},
+{0, 0x55, 0xA, 1, 1, 4485, 4485},
+{0, 0x55, 0xA, 1, 1, 4486, 4486},
+{0, 0x55, 0xA, 1, 1, 4487, 4487},
+{0, 0x55, 0xA, 1, 1, 4488, 4488},
+{0, 0x55, 0xA, 1, 1, 4489, 4489},
+{0, 0x55, 0xA, 1, 1, 4490, 4490},
+{0, 0x55, 0xA, 1, 1, 4491, 4491},
+{0, 0x55, 0xA, 1, 1, 4492, 4492},
+{0, 0x55, 0xA, 1, 1, 4493, 4493},
+{0, 0x55, 0xA, 1, 1, 4494, 4494},
+{0, 0x55, 0xA, 1, 1, 4495, 4495},
+{0, 0x55, 0xA, 1, 1, 4496, 4496},
+{0, 0x55, 0xA, 1, 1, 4497, 4497},
+{0, 0x55, 0xA, 1, 1, 4498, 4498},
+{0, 0x55, 0xA, 1, 1, 4499, 4499},
+{0, 0x55, 0xA, 1, 1, 4500, 4500},
+{0, 0x55, 0xA, 1, 1, 4501, 4501},
+{0, 0x55, 0xA, 1, 1, 4502, 4502},
+{0, 0x55, 0xA, 1, 1, 4503, 4503},
+{0, 0x55, 0xA, 1, 1, 4504, 4504},
+{0, 0x55, 0xA, 1, 1, 4505, 4505},
+{0, 0x55, 0xA, 1, 1, 4506, 4506},
+{0, 0x55, 0xA, 1, 1, 4507, 4507},
+{0, 0x55, 0xA, 1, 1, 4508, 4508},
+{0, 0x55, 0xA, 1, 1, 4509, 4509},
+{0, 0x55, 0xA, 1, 1, 4510, 4510},
+{0, 0x55, 0xA, 1, 1, 4511, 4511},
+{0, 0x55, 0xA, 1, 1, 4512, 4512},
+{0, 0x55, 0xA, 1, 1, 4513, 4513},
+{0, 0x55, 0xA, 1, 1, 4514, 4514},
+{0, 0x55, 0xA, 1, 1, 4515, 4515},
+{0, 0x55, 0xA, 1, 1, 4516, 4516},
+{0, 0x55, 0xA, 1, 1, 4517, 4517},
+{0, 0x55, 0xA, 1, 1, 2925, 2925},
+{0, 0x55, 0xA, 1, 1, 4518, 4518},
+{0, 0x55, 0xA, 1, 1, 4519, 4519},
+{0, 0x55, 0xA, 1, 1, 4520, 4520},
+{0, 0x55, 0xA, 1, 1, 4521, 4521},
+{0, 0x55, 0xA, 1, 1, 4522, 4522},
+{0, 0x55, 0xA, 1, 1, 4523, 4523},
+{0, 0x55, 0xA, 1, 1, 4524, 4524},
+{0, 0x55, 0xA, 1, 1, 4525, 4525},
+{0, 0x55, 0xA, 1, 1, 4526, 4526},
+{0, 0x55, 0xA, 1, 1, 4527, 4527},
+{0, 0x55, 0xA, 1, 1, 4528, 4528},
+{0, 0x55, 0xA, 1, 1, 2998, 2998},
+{0, 0x55, 0xA, 1, 1, 4529, 4529},
+{0, 0x55, 0xA, 1, 1, 4530, 4530},
+{0, 0x55, 0xA, 1, 1, 4531, 4531},
+{0, 0x55, 0xA, 1, 1, 4532, 4532},
+{0, 0x55, 0xA, 1, 1, 4533, 4533},
+{0, 0x55, 0xA, 1, 1, 4534, 4534},
+{0, 0x55, 0xA, 1, 1, 4535, 4535},
+{0, 0x55, 0xA, 1, 1, 4536, 4536},
+{0, 0x55, 0xA, 1, 1, 4537, 4537},
+{0, 0x55, 0xA, 1, 1, 4538, 4538},
+{0, 0x55, 0xA, 1, 1, 4539, 4539},
+{0, 0x55, 0xA, 1, 1, 4540, 4540},
+{0, 0x55, 0xA, 1, 1, 4541, 4541},
+{0, 0x55, 0xA, 1, 1, 4542, 4542},
+{0, 0x55, 0xA, 1, 1, 4543, 4543},
+{0, 0x55, 0xA, 1, 1, 4544, 4544},
+{0, 0x55, 0xA, 1, 1, 4545, 4545},
+{0, 0x55, 0xA, 1, 1, 4546, 4546},
+{0, 0x55, 0xA, 1, 1, 4547, 4547},
+{0, 0x55, 0xA, 1, 1, 4548, 4548},
+{0, 0x55, 0xA, 1, 1, 4549, 4549},
+{0, 0x55, 0xA, 1, 1, 4550, 4550},
+{0, 0x55, 0xA, 1, 1, 4551, 4551},
+{0, 0x55, 0xA, 1, 1, 4552, 4552},
+{0, 0x55, 0xA, 1, 1, 4553, 4553},
+{0, 0x55, 0xA, 1, 1, 4554, 4554},
+{0, 0x55, 0xA, 1, 1, 4555, 4555},
+{0, 0x55, 0xA, 1, 1, 4556, 4556},
+{0, 0x55, 0xA, 1, 1, 4557, 4557},
+{0, 0x55, 0xA, 1, 1, 4558, 4558},
+{0, 0x55, 0xA, 1, 1, 4559, 4559},
+{0, 0x55, 0xA, 1, 1, 4560, 4560},
+{0, 0x55, 0xA, 1, 1, 4561, 4561},
+{0, 0x55, 0xA, 1, 1, 4562, 4562},
+{0, 0x55, 0xA, 1, 1, 4563, 4563},
+{0, 0x55, 0xA, 1, 1, 4564, 4564},
+{0, 0x55, 0xA, 1, 1, 4565, 4565},
+{0, 0x55, 0xA, 1, 1, 4566, 4566},
+{0, 0x55, 0xA, 1, 1, 4567, 4567},
+{0, 0x55, 0xA, 1, 1, 4568, 4568},
+{0, 0x55, 0xA, 1, 1, 4569, 4569},
+{0, 0x55, 0xA, 1, 1, 4570, 4570},
+{0, 0x55, 0xA, 1, 1, 4571, 4571},
+{0, 0x55, 0xA, 1, 1, 4572, 4572},
+{0, 0x55, 0xA, 1, 1, 4573, 4573},
+{0, 0x55, 0xA, 1, 1, 4574, 4574},
+{0, 0x55, 0xA, 1, 1, 4575, 4575},
+{0, 0x55, 0xA, 1, 1, 2961, 2961},
+{0, 0x55, 0xA, 1, 1, 4576, 4576},
+{0, 0x55, 0xA, 1, 1, 4577, 4577},
+{0, 0x55, 0xA, 1, 1, 4578, 4578},
+{0, 0x55, 0xA, 1, 1, 4579, 4579},
+{0, 0x55, 0xA, 1, 1, 4580, 4580},
+{0, 0x55, 0xA, 1, 1, 4581, 4581},
+{0, 0x55, 0xA, 1, 1, 4582, 4582},
+{0, 0x55, 0xA, 1, 1, 4583, 4583},
+{0, 0x55, 0xA, 1, 1, 4584, 4584},
+{0, 0x55, 0xA, 1, 1, 4585, 4585},
+{0, 0x55, 0xA, 1, 1, 4586, 4586},
+{0, 0x55, 0xA, 1, 1, 4587, 4587},
+{0, 0x55, 0xA, 1, 1, 4588, 4588},
+{0, 0x55, 0xA, 1, 1, 4589, 4589},
+{0, 0x55, 0xA, 1, 1, 4590, 4590},
+{0, 0x55, 0xA, 1, 1, 2838, 2838},
+{0, 0x55, 0xA, 1, 1, 4591, 4591},
+{0, 0x55, 0xA, 1, 1, 4592, 4592},
+{0, 0x55, 0xA, 1, 1, 4593, 4593},
+{0, 0x55, 0xA, 1, 1, 4594, 4594},
+{0, 0x55, 0xA, 1, 1, 4595, 4595},
+{0, 0x55, 0xA, 1, 1, 4596, 4596},
+{0, 0x55, 0xA, 1, 1, 4597, 4597},
+{0, 0x55, 0xA, 1, 1, 4598, 4598},
+{0, 0x55, 0xA, 1, 1, 2819, 2819},
+{0, 0x55, 0xA, 1, 1, 4599, 4599},
+{0, 0x55, 0xA, 1, 1, 4600, 4600},
+{0, 0x55, 0xA, 1, 1, 4601, 4601},
+{0, 0x55, 0xA, 1, 1, 4602, 4602},
+{0, 0x55, 0xA, 1, 1, 4603, 4603},
+{0, 0x55, 0xA, 1, 1, 4604, 4604},
+{0, 0x55, 0xA, 1, 1, 4605, 4605},
+{0, 0x55, 0xA, 1, 1, 4606, 4606},
+{0, 0x55, 0xA, 1, 1, 4607, 4607},
+{0, 0x55, 0xA, 1, 1, 4608, 4608},
+{0, 0x55, 0xA, 1, 1, 4609, 4609},
+{0, 0x55, 0xA, 1, 1, 4610, 4610},
+{0, 0x55, 0xA, 1, 1, 4611, 4611},
+{0, 0x55, 0xA, 1, 1, 4612, 4612},
+{0, 0x55, 0xA, 1, 1, 4613, 4613},
+{0, 0x55, 0xA, 1, 1, 4614, 4614},
+{0, 0x55, 0xA, 1, 1, 4615, 4615},
+{0, 0x55, 0xA, 1, 1, 4616, 4616},
+{0, 0x55, 0xA, 1, 1, 4617, 4617},
+{0, 0x55, 0xA, 1, 1, 4618, 4618},
+{0, 0x55, 0xA, 1, 1, 4619, 4619},
+{0, 0x55, 0xA, 1, 1, 4620, 4620},
+{0, 0x55, 0xA, 1, 1, 4621, 4621},
+{0, 0x55, 0xA, 1, 1, 4622, 4622},
+{0, 0x55, 0xA, 1, 1, 4623, 4623},
+{0, 0x55, 0xA, 1, 1, 4624, 4624},
+{0, 0x55, 0xA, 1, 1, 4625, 4625},
+{0, 0x55, 0xA, 1, 1, 4626, 4626},
+{0, 0x55, 0xA, 1, 1, 4627, 4627},
+{0, 0x55, 0xA, 1, 1, 4628, 4628},
+{0, 0x55, 0xA, 1, 1, 4629, 4629},
+{0, 0x55, 0xA, 1, 1, 4630, 4630},
+{0, 0x55, 0xA, 1, 1, 4631, 4631},
+{0, 0x55, 0xA, 1, 1, 4632, 4632},
+{0, 0x55, 0xA, 1, 1, 4633, 4633},
+{0, 0x55, 0xA, 1, 1, 4634, 4634},
+{0, 0x55, 0xA, 1, 1, 4635, 4635},
+{0, 0x55, 0xA, 1, 1, 4636, 4636},
+{0, 0x55, 0xA, 1, 1, 4637, 4637},
+{0, 0x55, 0xA, 1, 1, 4638, 4638},
+{0, 0x55, 0xA, 1, 1, 4639, 4639},
+{0, 0x55, 0xA, 1, 1, 4640, 4640},
+{0, 0x55, 0xA, 1, 1, 4641, 4641},
+{0, 0x55, 0xA, 1, 1, 4642, 4642},
+{0, 0x55, 0xA, 1, 1, 4643, 4643},
+{0, 0x55, 0xA, 1, 1, 4644, 4644},
+{0, 0x55, 0xA, 1, 1, 4645, 4645},
+{0, 0x55, 0xA, 1, 1, 4646, 4646},
+{0, 0x55, 0xA, 1, 1, 4647, 4647},
+{0, 0x55, 0xA, 1, 1, 4648, 4648},
+{0, 0x55, 0xA, 1, 1, 4649, 4649},
+{0, 0x55, 0xA, 1, 1, 4650, 4650},
+{0, 0x55, 0xA, 1, 1, 4651, 4651},
+{0, 0x55, 0xA, 1, 1, 4652, 4652},
+{0, 0x55, 0xA, 1, 1, 3012, 3012},
+{0, 0x55, 0xA, 1, 1, 4653, 4653},
+{0, 0x55, 0xA, 1, 1, 4654, 4654},
+{0, 0x55, 0xA, 1, 1, 4655, 4655},
+{0, 0x55, 0xA, 1, 1, 4656, 4656},
+{0, 0x55, 0xA, 1, 1, 4657, 4657},
+{0, 0x55, 0xA, 1, 1, 4658, 4658},
+{0, 0x55, 0xA, 1, 1, 4659, 4659},
+{0, 0x55, 0xA, 1, 1, 4660, 4660},
+{0, 0x55, 0xA, 1, 1, 4661, 4661},
+{0, 0x55, 0xA, 1, 1, 4662, 4662},
+{0, 0x55, 0xA, 1, 1, 4663, 4663},
+{0, 0x55, 0xA, 1, 1, 4664, 4664},
+{0, 0x55, 0xA, 1, 1, 3545, 3545},
+{0, 0x55, 0xA, 1, 1, 4665, 4665},
+{0, 0x55, 0xA, 1, 1, 4666, 4666},
+{0, 0x55, 0xA, 1, 1, 4667, 4667},
+{0, 0x55, 0xA, 1, 1, 4668, 4668},
+{0, 0x55, 0xA, 1, 1, 4669, 4669},
+{0, 0x55, 0xA, 1, 1, 4670, 4670},
+{0, 0x55, 0xA, 1, 1, 4671, 4671},
+{0, 0x55, 0xA, 1, 1, 4672, 4672},
+{0, 0x55, 0xA, 1, 1, 4673, 4673},
+{0, 0x55, 0xA, 1, 1, 4674, 4674},
+{0, 0x55, 0xA, 1, 1, 4675, 4675},
+{0, 0x55, 0xA, 1, 1, 4676, 4676},
+{0, 0x55, 0xA, 1, 1, 4677, 4677},
+{0, 0x55, 0xA, 1, 1, 4678, 4678},
+{0, 0x55, 0xA, 1, 1, 4679, 4679},
+{0, 0x55, 0xA, 1, 1, 4680, 4680},
+{0, 0x55, 0xA, 1, 1, 4681, 4681},
+{0, 0x55, 0xA, 1, 1, 4682, 4682},
+{0, 0x55, 0xA, 1, 1, 4683, 4683},
+{0, 0x55, 0xA, 1, 1, 4684, 4684},
+{0, 0x55, 0xA, 1, 1, 4685, 4685},
+{0, 0x55, 0xA, 1, 1, 4686, 4686},
+{0, 0x55, 0xA, 1, 1, 2966, 2966},
+{0, 0x55, 0xA, 1, 1, 4687, 4687},
+{0, 0x55, 0xA, 1, 1, 4688, 4688},
+{0, 0x55, 0xA, 1, 1, 4689, 4689},
+{0, 0x55, 0xA, 1, 1, 4690, 4690},
+{0, 0x55, 0xA, 1, 1, 4691, 4691},
+{0, 0x55, 0xA, 1, 1, 4692, 4692},
+{0, 0x55, 0xA, 1, 1, 4693, 4693},
+{0, 0x55, 0xA, 1, 1, 4694, 4694},
+{0, 0x55, 0xA, 1, 1, 4695, 4695},
+{0, 0x55, 0xA, 1, 1, 4696, 4696},
+{0, 0x55, 0xA, 1, 1, 4697, 4697},
+{0, 0x55, 0xA, 1, 1, 4698, 4698},
+{0, 0x55, 0xA, 1, 1, 4699, 4699},
+{0, 0x55, 0xA, 1, 1, 2917, 2917},
+{0, 0x55, 0xA, 1, 1, 4700, 4700},
+{0, 0x55, 0xA, 1, 1, 4701, 4701},
+{0, 0x55, 0xA, 1, 1, 4702, 4702},
+{0, 0x55, 0xA, 1, 1, 4703, 4703},
+{0, 0x55, 0xA, 1, 1, 4704, 4704},
+{0, 0x55, 0xA, 1, 1, 4705, 4705},
+{0, 0x55, 0xA, 1, 1, 4706, 4706},
+{0, 0x55, 0xA, 1, 1, 4707, 4707},
+{0, 0x55, 0xA, 1, 1, 4708, 4708},
+{0, 0x55, 0xA, 1, 1, 4709, 4709},
+{0, 0x55, 0xA, 1, 1, 4710, 4710},
+{0, 0x55, 0xA, 1, 1, 4711, 4711},
+{0, 0x55, 0xA, 1, 1, 4712, 4712},
+{0, 0x55, 0xA, 1, 1, 4713, 4713},
+{0, 0x55, 0xA, 1, 1, 4714, 4714},
+{0, 0x55, 0xA, 1, 1, 4715, 4715},
+{0, 0x55, 0xA, 1, 1, 2944, 2944},
+{0, 0x55, 0xA, 1, 1, 4716, 4716},
+{0, 0x55, 0xA, 1, 1, 2947, 2947},
+{0, 0x55, 0xA, 1, 1, 4717, 4717},
+{0, 0x55, 0xA, 1, 1, 4718, 4718},
+{0, 0x55, 0xA, 1, 1, 4719, 4719},
+{0, 0x55, 0xA, 1, 1, 4720, 4720},
+{0, 0x55, 0xA, 1, 1, 4721, 4721},
+{0, 0x55, 0xA, 1, 1, 4722, 4722},
+{0, 0x55, 0xA, 1, 1, 4723, 4723},
+{0, 0x55, 0xA, 1, 1, 4724, 4724},
+{0, 0x55, 0xA, 1, 1, 4725, 4725},
+{0, 0x55, 0xA, 1, 1, 4726, 4726},
+{0, 0x55, 0xA, 1, 1, 4727, 4727},
+{0, 0x55, 0xA, 1, 1, 4728, 4728},
+{0, 0x55, 0xA, 1, 1, 4729, 4729},
+{0, 0x55, 0xA, 1, 1, 4730, 4730},
+{0, 0x55, 0xA, 1, 1, 2924, 2924},
+{0, 0x55, 0xA, 1, 1, 4731, 4731},
+{0, 0x55, 0xA, 1, 1, 4732, 4732},
+{0, 0x55, 0xA, 1, 1, 4733, 4733},
+{0, 0x55, 0xA, 1, 1, 4734, 4734},
+{0, 0x55, 0xA, 1, 1, 4735, 4735},
+{0, 0x55, 0xA, 1, 1, 4736, 4736},
+{0, 0x55, 0xA, 1, 1, 4737, 4737},
+{0, 0x55, 0xA, 1, 1, 4738, 4738},
+{0, 0x55, 0xA, 1, 1, 4739, 4739},
+{0, 0x55, 0xA, 1, 1, 4740, 4740},
+{0, 0x55, 0xA, 1, 1, 4741, 4741},
+{0, 0x55, 0xA, 1, 1, 4742, 4742},
+{0, 0x55, 0xA, 1, 1, 4743, 4743},
+{0, 0x55, 0xA, 1, 1, 4744, 4744},
+{0, 0x55, 0xA, 1, 1, 4745, 4745},
+{0, 0x55, 0xA, 1, 1, 4746, 4746},
+{0, 0x55, 0xA, 1, 1, 4747, 4747},
+{0, 0x55, 0xA, 1, 1, 4748, 4748},
+{0, 0x55, 0xA, 1, 1, 4749, 4749},
+{0, 0x55, 0xA, 1, 1, 4750, 4750},
+{0, 0x55, 0xA, 1, 1, 4751, 4751},
+{0, 0x55, 0xA, 1, 1, 4752, 4752},
+{0, 0x55, 0xA, 1, 1, 2845, 2845},
+{0, 0x55, 0xA, 1, 1, 4753, 4753},
+{0, 0x55, 0xA, 1, 1, 4754, 4754},
+{0, 0x55, 0xA, 1, 1, 4755, 4755},
+{0, 0x55, 0xA, 1, 1, 4756, 4756},
+{0, 0x55, 0xA, 1, 1, 4757, 4757},
+{0, 0x55, 0xA, 1, 1, 4758, 4758},
+{0, 0x55, 0xA, 1, 1, 4759, 4759},
+{0, 0x55, 0xA, 1, 1, 4760, 4760},
+{0, 0x55, 0xA, 1, 1, 4761, 4761},
+{0, 0x55, 0xA, 1, 1, 4762, 4762},
+{0, 0x55, 0xA, 1, 1, 4763, 4763},
+{0, 0x55, 0xA, 1, 1, 4764, 4764},
+{0, 0x55, 0xA, 1, 1, 4765, 4765},
+{0, 0x55, 0xA, 1, 1, 4766, 4766},
+{0, 0x55, 0xA, 1, 1, 4767, 4767},
+{0, 0x55, 0xA, 1, 1, 3550, 3550},
+{0, 0x55, 0xA, 1, 1, 4768, 4768},
+{0, 0x55, 0xA, 1, 1, 4769, 4769},
+{0, 0x55, 0xA, 1, 1, 4770, 4770},
+{0, 0x55, 0xA, 1, 1, 4771, 4771},
+{0, 0x55, 0xA, 1, 1, 3554, 3554},
+{0, 0x55, 0xA, 1, 1, 4772, 4772},
+{0, 0x55, 0xA, 1, 1, 4773, 4773},
+{0, 0x55, 0xA, 1, 1, 4774, 4774},
+{0, 0x55, 0xA, 1, 1, 4775, 4775},
+{0, 0x55, 0xA, 1, 1, 4776, 4776},
+{0, 0x55, 0xA, 1, 1, 4777, 4777},
+{0, 0x55, 0xA, 1, 1, 4778, 4778},
+{0, 0x55, 0xA, 1, 1, 4779, 4779},
+{0, 0x55, 0xA, 1, 1, 4780, 4780},
+{0, 0x55, 0xA, 1, 1, 4781, 4781},
+{0, 0x55, 0xA, 1, 1, 4782, 4782},
+{0, 0x55, 0xA, 1, 1, 4783, 4783},
+{0, 0x55, 0xA, 1, 1, 4784, 4784},
+{0, 0x55, 0xA, 1, 1, 4785, 4785},
+{0, 0x55, 0xA, 1, 1, 4786, 4786},
+{0, 0x55, 0xA, 1, 1, 4787, 4787},
+{0, 0x55, 0xA, 1, 1, 4788, 4788},
+{0, 0x55, 0xA, 1, 1, 4789, 4789},
+{0, 0x55, 0xA, 1, 1, 4790, 4790},
+{0, 0x55, 0xA, 1, 1, 4791, 4791},
+{0, 0x55, 0xA, 1, 1, 4792, 4792},
+{0, 0x55, 0xA, 1, 1, 4793, 4793},
+{0, 0x55, 0xA, 1, 1, 4794, 4794},
+{0, 0x55, 0xA, 1, 1, 4795, 4795},
+{0, 0x55, 0xA, 1, 1, 4796, 4796},
+{0, 0x55, 0xA, 1, 1, 4797, 4797},
+{0, 0x55, 0xA, 1, 1, 4798, 4798},
+{0, 0x55, 0xA, 1, 1, 4799, 4799},
+{0, 0x55, 0xA, 1, 1, 4800, 4800},
+{0, 0x55, 0xA, 1, 1, 4801, 4801},
+{0, 0x55, 0xA, 1, 1, 4802, 4802},
+{0, 0x55, 0xA, 1, 1, 4803, 4803},
+{0, 0x55, 0xA, 1, 1, 4804, 4804},
+{0, 0x55, 0xA, 1, 1, 4805, 4805},
+{0, 0x55, 0xA, 1, 1, 4806, 4806},
+{0, 0x55, 0xA, 1, 1, 4807, 4807},
+{0, 0x55, 0xA, 1, 1, 4808, 4808},
+{0, 0x55, 0xA, 1, 1, 4809, 4809},
+{0, 0x55, 0xA, 1, 1, 4810, 4810},
+{0, 0x55, 0xA, 1, 1, 4811, 4811},
+{0, 0x55, 0xA, 1, 1, 4812, 4812},
+{0, 0x55, 0xA, 1, 1, 4813, 4813},
+{0, 0x55, 0xA, 1, 1, 4814, 4814},
+{0, 0x55, 0xA, 1, 1, 4815, 4815},
+{0, 0x55, 0xA, 1, 1, 4816, 4816},
+{0, 0x55, 0xA, 1, 1, 4817, 4817},
+{0, 0x55, 0xA, 1, 1, 4818, 4818},
+{0, 0x55, 0xA, 1, 1, 4819, 4819},
+{0, 0x55, 0xA, 1, 1, 4820, 4820},
+{0, 0x55, 0xA, 1, 1, 4821, 4821},
+{0, 0x55, 0xA, 1, 1, 4822, 4822},
+{0, 0x55, 0xA, 1, 1, 4823, 4823},
+{0, 0x55, 0xA, 1, 1, 4824, 4824},
+{0, 0x55, 0xA, 1, 1, 4825, 4825},
+{0, 0x55, 0xA, 1, 1, 4826, 4826},
+{0, 0x55, 0xA, 1, 1, 4827, 4827},
+{0, 0x55, 0xA, 1, 1, 2878, 2878},
+{0, 0x55, 0xA, 1, 1, 4828, 4828},
+{0, 0x55, 0xA, 1, 1, 4829, 4829},
+{0, 0x55, 0xA, 1, 1, 4830, 4830},
+{0, 0x55, 0xA, 1, 1, 4831, 4831},
+{0, 0x55, 0xA, 1, 1, 4832, 4832},
+{0, 0x55, 0xA, 1, 1, 4833, 4833},
+{0, 0x55, 0xA, 1, 1, 4834, 4834},
+{0, 0x55, 0xA, 1, 1, 4835, 4835},
+{0, 0x55, 0xA, 1, 1, 4836, 4836},
+{0, 0x55, 0xA, 1, 1, 4837, 4837},
+{0, 0x55, 0xA, 1, 1, 4838, 4838},
+{0, 0x55, 0xA, 1, 1, 4839, 4839},
+{0, 0x55, 0xA, 1, 1, 4840, 4840},
+{0, 0x55, 0xA, 1, 1, 4841, 4841},
+{0, 0x55, 0xA, 1, 1, 4842, 4842},
+{0, 0x55, 0xA, 1, 1, 4843, 4843},
+{0, 0x55, 0xA, 1, 1, 4844, 4844},
+{0, 0x55, 0xA, 1, 1, 4845, 4845},
+{0, 0x55, 0xA, 1, 1, 4846, 4846},
+{0, 0x55, 0xA, 1, 1, 4847, 4847},
+{0, 0x55, 0xA, 1, 1, 4848, 4848},
+{0, 0x55, 0xA, 1, 1, 4849, 4849},
+{0, 0x55, 0xA, 1, 1, 4850, 4850},
+{0, 0x55, 0xA, 1, 1, 4851, 4851},
+{0, 0x55, 0xA, 1, 1, 4852, 4852},
+{0, 0x55, 0xA, 1, 1, 4853, 4853},
+{0, 0x55, 0xA, 1, 1, 4854, 4854},
+{0, 0x55, 0xA, 1, 1, 4855, 4855},
+{0, 0x55, 0xA, 1, 1, 4856, 4856},
+{0, 0x55, 0xA, 1, 1, 4857, 4857},
+{0, 0x55, 0xA, 1, 1, 4858, 4858},
+{0, 0x55, 0xA, 1, 1, 4859, 4859},
+{0, 0x55, 0xA, 1, 1, 4860, 4860},
+{0, 0x55, 0xA, 1, 1, 4861, 4861},
+{0, 0x55, 0xA, 1, 1, 4862, 4862},
+{0, 0x55, 0xA, 1, 1, 4863, 4863},
+{0, 0x55, 0xA, 1, 1, 4864, 4864},
+{0, 0x55, 0xA, 1, 1, 4865, 4865},
+{0, 0x55, 0xA, 1, 1, 4866, 4866},
+{0, 0x55, 0xA, 1, 1, 4867, 4867},
+{0, 0x55, 0xA, 1, 1, 4868, 4868},
+{0, 0x55, 0xA, 1, 1, 4869, 4869},
+{0, 0x55, 0xA, 1, 1, 4870, 4870},
+{0, 0x55, 0xA, 1, 1, 4871, 4871},
+{0, 0x55, 0xA, 1, 1, 4872, 4872},
+{0, 0x55, 0xA, 1, 1, 4873, 4873},
+{0, 0x55, 0xA, 1, 1, 4874, 4874},
+{0, 0x55, 0xA, 1, 1, 4875, 4875},
+{0, 0x50, 0xB, 0, 2, 0, 4876},
+{0, 0x50, 0xB, 0, 2, 0, 4878},
+{0, 0x50, 0xB, 0, 2, 0, 4880},
+{0, 0x50, 0xB, 0, 3, 0, 4882},
+{0, 0x50, 0xB, 0, 3, 0, 4885},
+{0, 0x50, 0xB, 0, 2, 0, 4888},
+{0, 0x50, 0xB, 0, 2, 0, 4890},
+{0, 0x50, 0xB, 0, 2, 0, 4892},
+{0, 0x50, 0xB, 0, 2, 0, 4894},
+{0, 0x50, 0xB, 0, 2, 0, 4896},
+{0, 0x50, 0xB, 0, 2, 0, 4898},
+{0, 0x55, 0xA, 2, 2, 4900, 4900},
+{26, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x55, 0xA, 2, 2, 4902, 4902},
+{0, 0x50, 0xB, 0, 1, 0, 4904},
+{0, 0x50, 0xB, 0, 1, 0, 4905},
+{0, 0x50, 0xB, 0, 1, 0, 4906},
+{0, 0x50, 0xB, 0, 1, 0, 4907},
+{0, 0x50, 0xB, 0, 1, 0, 4908},
+{0, 0x50, 0xB, 0, 1, 0, 4909},
+{0, 0x50, 0xB, 0, 1, 0, 4910},
+{0, 0x55, 0xA, 2, 2, 4911, 4911},
+{0, 0x55, 0xA, 2, 2, 4913, 4913},
+{0, 0x55, 0xA, 3, 3, 4915, 4915},
+{0, 0x55, 0xA, 3, 3, 4918, 4918},
+{0, 0x55, 0xA, 2, 2, 4921, 4921},
+{0, 0x55, 0xA, 2, 2, 4923, 4923},
+{0, 0x55, 0xA, 2, 2, 4925, 4925},
+{0, 0x55, 0xA, 2, 2, 4927, 4927},
+{0, 0x55, 0xA, 2, 2, 4929, 4929},
+{0, 0x55, 0xA, 2, 2, 4931, 4931},
+{0, 0x55, 0xA, 2, 2, 4933, 4933},
+{0, 0x55, 0xA, 2, 2, 4935, 4935},
+{0, 0x55, 0xA, 2, 2, 4937, 4937},
+{0, 0x55, 0xA, 2, 2, 4939, 4939},
+{0, 0x55, 0xA, 2, 2, 4941, 4941},
+{0, 0x55, 0xA, 2, 2, 4943, 4943},
+{0, 0x55, 0xA, 2, 2, 4945, 4945},
+{0, 0x55, 0xA, 2, 2, 4947, 4947},
+{0, 0x55, 0xA, 2, 2, 4949, 4949},
+{0, 0x55, 0xA, 2, 2, 4951, 4951},
+{0, 0x55, 0xA, 2, 2, 4953, 4953},
+{0, 0x55, 0xA, 2, 2, 4955, 4955},
+{0, 0x55, 0xA, 2, 2, 4957, 4957},
+{0, 0x55, 0xA, 2, 2, 4959, 4959},
+{0, 0x55, 0xA, 2, 2, 4961, 4961},
+{0, 0x55, 0xA, 2, 2, 4963, 4963},
+{0, 0x55, 0xA, 2, 2, 4965, 4965},
+{0, 0x55, 0xA, 2, 2, 4967, 4967},
+{0, 0x55, 0xA, 2, 2, 4969, 4969},
+{0, 0x55, 0xA, 2, 2, 4971, 4971},
+{0, 0x55, 0xA, 2, 2, 4973, 4973},
+{0, 0x55, 0xA, 2, 2, 4975, 4975},
+{0, 0x50, 0xB, 0, 2, 0, 4977},
+{0, 0x50, 0xB, 0, 1, 0, 4979},
+{0, 0x50, 0xB, 0, 1, 0, 4980},
+{0, 0x50, 0xB, 0, 1, 0, 4981},
+{0, 0x50, 0xB, 0, 1, 0, 4982},
+{0, 0x50, 0xB, 0, 1, 0, 4983},
+{0, 0x50, 0xB, 0, 1, 0, 4984},
+{0, 0x50, 0xB, 0, 1, 0, 4985},
+{0, 0x50, 0xB, 0, 1, 0, 4986},
+{0, 0x50, 0xB, 0, 1, 0, 4987},
+{0, 0x50, 0xB, 0, 1, 0, 4988},
+{0, 0x50, 0xB, 0, 1, 0, 4989},
+{0, 0x50, 0xB, 0, 1, 0, 4990},
+{0, 0x50, 0xB, 0, 1, 0, 4991},
+{0, 0x50, 0xB, 0, 1, 0, 4992},
+{0, 0x50, 0xB, 0, 1, 0, 4993},
+{0, 0x50, 0xB, 0, 1, 0, 4994},
+{0, 0x50, 0xB, 0, 1, 0, 4995},
+{0, 0x50, 0xB, 0, 1, 0, 4996},
+{0, 0x50, 0xB, 0, 1, 0, 4997},
+{0, 0x50, 0xB, 0, 1, 0, 4998},
+{0, 0x50, 0xB, 0, 1, 0, 4999},
+{0, 0x50, 0xB, 0, 1, 0, 5000},
+{0, 0x50, 0xB, 0, 1, 0, 5001},
+{0, 0x50, 0xB, 0, 1, 0, 5002},
+{0, 0x50, 0xB, 0, 1, 0, 5003},
+{0, 0x50, 0xB, 0, 2, 0, 809},
+{0, 0x50, 0xB, 0, 1, 0, 5004},
+{0, 0x50, 0xB, 0, 1, 0, 5005},
+{0, 0x50, 0xB, 0, 1, 0, 5006},
+{0, 0x50, 0xB, 0, 2, 0, 813},
+{0, 0x50, 0xB, 0, 1, 0, 5007},
+{0, 0x50, 0xB, 0, 1, 0, 5008},
+{0, 0x50, 0xB, 0, 1, 0, 5009},
+{0, 0x50, 0xB, 0, 1, 0, 5010},
+{0, 0x50, 0xB, 0, 1, 0, 5011},
+{0, 0x50, 0xB, 0, 1, 0, 5012},
+{0, 0x50, 0xB, 0, 1, 0, 5013},
+{0, 0x50, 0xB, 0, 1, 0, 5014},
+{0, 0x50, 0xB, 0, 1, 0, 5015},
+{0, 0x50, 0xB, 0, 3, 0, 5016},
+{0, 0x50, 0xB, 0, 3, 0, 5019},
+{0, 0x50, 0xB, 0, 3, 0, 5022},
+{0, 0x50, 0xB, 0, 3, 0, 5025},
+{0, 0x50, 0xB, 0, 3, 0, 5028},
+{0, 0x50, 0xB, 0, 3, 0, 5031},
+{0, 0x50, 0xB, 0, 3, 0, 5034},
+{0, 0x50, 0xB, 0, 3, 0, 5037},
+{0, 0x50, 0xB, 0, 1, 0, 5040},
+{0, 0x50, 0xB, 0, 3, 0, 5041},
+{0, 0x50, 0xB, 0, 3, 0, 5044},
+{0, 0x50, 0xB, 0, 3, 0, 5047},
+{0, 0x50, 0xB, 0, 3, 0, 5050},
+{0, 0x50, 0xB, 0, 2, 0, 5053},
+{0, 0x50, 0xB, 0, 2, 0, 5055},
+{0, 0x50, 0xB, 0, 2, 0, 5057},
+{0, 0x50, 0xB, 0, 2, 0, 5059},
+{0, 0x50, 0xB, 0, 2, 0, 5061},
+{0, 0x50, 0xB, 0, 2, 0, 5063},
+{0, 0x50, 0xB, 0, 2, 0, 5065},
+{0, 0x50, 0xB, 0, 2, 0, 5067},
+{0, 0x50, 0xB, 0, 2, 0, 5069},
+{0, 0x50, 0xB, 0, 2, 0, 5071},
+{0, 0x50, 0xB, 0, 2, 0, 5073},
+{0, 0x50, 0xB, 0, 2, 0, 5075},
+{0, 0x50, 0xB, 0, 2, 0, 5077},
+{0, 0x50, 0xB, 0, 2, 0, 5079},
+{0, 0x50, 0xB, 0, 2, 0, 5081},
+{0, 0x50, 0xB, 0, 2, 0, 5083},
+{0, 0x50, 0xB, 0, 2, 0, 5085},
+{0, 0x50, 0xB, 0, 2, 0, 5087},
+{0, 0x50, 0xB, 0, 2, 0, 5089},
+{0, 0x50, 0xB, 0, 2, 0, 5091},
+{0, 0x50, 0xB, 0, 2, 0, 5093},
+{0, 0x50, 0xB, 0, 2, 0, 5095},
+{0, 0x50, 0xB, 0, 2, 0, 5097},
+{0, 0x50, 0xB, 0, 2, 0, 5099},
+{0, 0x50, 0xB, 0, 2, 0, 5101},
+{0, 0x50, 0xB, 0, 2, 0, 5103},
+{0, 0x50, 0xB, 0, 2, 0, 5105},
+{0, 0x50, 0xB, 0, 2, 0, 5107},
+{0, 0x50, 0xB, 0, 2, 0, 5109},
+{0, 0x50, 0xB, 0, 2, 0, 5111},
+{0, 0x50, 0xB, 0, 2, 0, 5113},
+{0, 0x50, 0xB, 0, 2, 0, 5115},
+{0, 0x50, 0xB, 0, 2, 0, 5117},
+{0, 0x50, 0xB, 0, 2, 0, 5119},
+{0, 0x50, 0xB, 0, 2, 0, 5121},
+{0, 0x50, 0xB, 0, 2, 0, 5123},
+{0, 0x50, 0xB, 0, 2, 0, 5125},
+{0, 0x50, 0xB, 0, 2, 0, 5127},
+{0, 0x50, 0xB, 0, 2, 0, 5129},
+{0, 0x50, 0xB, 0, 2, 0, 5131},
+{0, 0x50, 0xB, 0, 2, 0, 5133},
+{0, 0x50, 0xB, 0, 2, 0, 5135},
+{0, 0x50, 0xB, 0, 2, 0, 5137},
+{0, 0x50, 0xB, 0, 2, 0, 5139},
+{0, 0x50, 0xB, 0, 2, 0, 5141},
+{0, 0x50, 0xB, 0, 2, 0, 5143},
+{0, 0x50, 0xB, 0, 2, 0, 5145},
+{0, 0x50, 0xB, 0, 2, 0, 5147},
+{0, 0x50, 0xB, 0, 2, 0, 5149},
+{0, 0x50, 0xB, 0, 2, 0, 5151},
+{0, 0x50, 0xB, 0, 2, 0, 5153},
+{0, 0x50, 0xB, 0, 2, 0, 5155},
+{0, 0x50, 0xB, 0, 2, 0, 5157},
+{0, 0x50, 0xB, 0, 2, 0, 5159},
+{0, 0x50, 0xB, 0, 2, 0, 5161},
+{0, 0x50, 0xB, 0, 2, 0, 5163},
+{0, 0x50, 0xB, 0, 2, 0, 5165},
+{0, 0x50, 0xB, 0, 2, 0, 5167},
+{0, 0x50, 0xB, 0, 2, 0, 5169},
+{0, 0x50, 0xB, 0, 2, 0, 5171},
+{0, 0x50, 0xB, 0, 2, 0, 5173},
+{0, 0x50, 0xB, 0, 2, 0, 5175},
+{0, 0x50, 0xB, 0, 2, 0, 5177},
+{0, 0x50, 0xB, 0, 2, 0, 5179},
+{0, 0x50, 0xB, 0, 2, 0, 5181},
+{0, 0x50, 0xB, 0, 2, 0, 5183},
+{0, 0x50, 0xB, 0, 2, 0, 5185},
+{0, 0x50, 0xB, 0, 2, 0, 5187},
+{0, 0x50, 0xB, 0, 2, 0, 5189},
+{0, 0x50, 0xB, 0, 2, 0, 5191},
+{0, 0x50, 0xB, 0, 2, 0, 5193},
+{0, 0x50, 0xB, 0, 2, 0, 5195},
+{0, 0x50, 0xB, 0, 2, 0, 5197},
+{0, 0x50, 0xB, 0, 2, 0, 5199},
+{0, 0x50, 0xB, 0, 2, 0, 5201},
+{0, 0x50, 0xB, 0, 2, 0, 5203},
+{0, 0x50, 0xB, 0, 2, 0, 5205},
+{0, 0x50, 0xB, 0, 2, 0, 5207},
+{0, 0x50, 0xB, 0, 2, 0, 5209},
+{0, 0x50, 0xB, 0, 2, 0, 5211},
+{0, 0x50, 0xB, 0, 2, 0, 5213},
+{0, 0x50, 0xB, 0, 2, 0, 5215},
+{0, 0x50, 0xB, 0, 2, 0, 5217},
+{0, 0x50, 0xB, 0, 2, 0, 5219},
+{0, 0x50, 0xB, 0, 2, 0, 5221},
+{0, 0x50, 0xB, 0, 2, 0, 5223},
+{0, 0x50, 0xB, 0, 2, 0, 5225},
+{0, 0x50, 0xB, 0, 2, 0, 5227},
+{0, 0x50, 0xB, 0, 2, 0, 5229},
+{0, 0x50, 0xB, 0, 3, 0, 5231},
+{0, 0x50, 0xB, 0, 3, 0, 5234},
+{0, 0x50, 0xB, 0, 3, 0, 5237},
+{0, 0x50, 0xB, 0, 3, 0, 5240},
+{0, 0x50, 0xB, 0, 3, 0, 5243},
+{0, 0x50, 0xB, 0, 3, 0, 5246},
+{0, 0x50, 0xB, 0, 3, 0, 5249},
+{0, 0x50, 0xB, 0, 3, 0, 5252},
+{0, 0x50, 0xB, 0, 3, 0, 5255},
+{0, 0x50, 0xB, 0, 2, 0, 5258},
+{0, 0x50, 0xB, 0, 2, 0, 5260},
+{0, 0x50, 0xB, 0, 2, 0, 5262},
+{0, 0x50, 0xB, 0, 2, 0, 5264},
+{0, 0x50, 0xB, 0, 2, 0, 5266},
+{0, 0x50, 0xB, 0, 2, 0, 5268},
+{0, 0x50, 0xB, 0, 2, 0, 5270},
+{0, 0x50, 0xB, 0, 2, 0, 5272},
+{0, 0x50, 0xB, 0, 2, 0, 5274},
+{0, 0x50, 0xB, 0, 2, 0, 5276},
+{0, 0x50, 0xB, 0, 2, 0, 5278},
+{0, 0x50, 0xB, 0, 2, 0, 5280},
+{0, 0x50, 0xB, 0, 2, 0, 5282},
+{0, 0x50, 0xB, 0, 2, 0, 5284},
+{0, 0x50, 0xB, 0, 2, 0, 5286},
+{0, 0x50, 0xB, 0, 2, 0, 5288},
+{0, 0x50, 0xB, 0, 3, 0, 5290},
+{0, 0x50, 0xB, 0, 3, 0, 5293},
+{0, 0x50, 0xB, 0, 2, 0, 5296},
+{0, 0x50, 0xB, 0, 2, 0, 5298},
+{0, 0x50, 0xB, 0, 2, 0, 5300},
+{0, 0x50, 0xB, 0, 2, 0, 5302},
+{0, 0x50, 0xB, 0, 2, 0, 5304},
+{0, 0x50, 0xB, 0, 2, 0, 5306},
+{0, 0x50, 0xB, 0, 2, 0, 5308},
+{0, 0x50, 0xB, 0, 2, 0, 5310},
+{0, 0x50, 0xB, 0, 2, 0, 5312},
+{0, 0x50, 0xB, 0, 2, 0, 5314},
+{0, 0x50, 0xB, 0, 2, 0, 5316},
+{0, 0x50, 0xB, 0, 3, 0, 5318},
+{0, 0x50, 0xB, 0, 3, 0, 5321},
+{0, 0x50, 0xB, 0, 3, 0, 5324},
+{0, 0x50, 0xB, 0, 2, 0, 5327},
+{0, 0x50, 0xB, 0, 2, 0, 5329},
+{0, 0x50, 0xB, 0, 2, 0, 5331},
+{0, 0x50, 0xB, 0, 2, 0, 5333},
+{0, 0x50, 0xB, 0, 2, 0, 5335},
+{0, 0x50, 0xB, 0, 2, 0, 5337},
+{0, 0x50, 0xB, 0, 2, 0, 5339},
+{0, 0x50, 0xB, 0, 2, 0, 5341},
+{0, 0x50, 0xB, 0, 2, 0, 5343},
+{0, 0x50, 0xB, 0, 2, 0, 5345},
+{0, 0x50, 0xB, 0, 2, 0, 5347},
+{0, 0x50, 0xB, 0, 2, 0, 5349},
+{0, 0x50, 0xB, 0, 2, 0, 5351},
+{0, 0x50, 0xB, 0, 2, 0, 5353},
+{0, 0x50, 0xB, 0, 2, 0, 5355},
+{0, 0x50, 0xB, 0, 2, 0, 5357},
+{0, 0x50, 0xB, 0, 2, 0, 5359},
+{0, 0x50, 0xB, 0, 2, 0, 5361},
+{0, 0x50, 0xB, 0, 2, 0, 5363},
+{0, 0x50, 0xB, 0, 2, 0, 5365},
+{0, 0x50, 0xB, 0, 2, 0, 5367},
+{0, 0x50, 0xB, 0, 2, 0, 5369},
+{0, 0x50, 0xB, 0, 2, 0, 5371},
+{0, 0x50, 0xB, 0, 2, 0, 5373},
+{0, 0x50, 0xB, 0, 2, 0, 5375},
+{0, 0x50, 0xB, 0, 2, 0, 5377},
+{0, 0x50, 0xB, 0, 2, 0, 5379},
+{0, 0x50, 0xB, 0, 2, 0, 5381},
+{0, 0x50, 0xB, 0, 3, 0, 5383},
+{0, 0x50, 0xB, 0, 3, 0, 5386},
+{0, 0x50, 0xB, 0, 3, 0, 5389},
+{0, 0x50, 0xB, 0, 3, 0, 5392},
+{0, 0x50, 0xB, 0, 3, 0, 5395},
+{0, 0x50, 0xB, 0, 3, 0, 5398},
+{0, 0x50, 0xB, 0, 3, 0, 5401},
+{0, 0x50, 0xB, 0, 3, 0, 5404},
+{0, 0x50, 0xB, 0, 3, 0, 5407},
+{0, 0x50, 0xB, 0, 3, 0, 5410},
+{0, 0x50, 0xB, 0, 3, 0, 5413},
+{0, 0x50, 0xB, 0, 3, 0, 5416},
+{0, 0x50, 0xB, 0, 3, 0, 5419},
+{0, 0x50, 0xB, 0, 3, 0, 5422},
+{0, 0x50, 0xB, 0, 3, 0, 5425},
+{0, 0x50, 0xB, 0, 3, 0, 5428},
+{0, 0x50, 0xB, 0, 3, 0, 5431},
+{0, 0x50, 0xB, 0, 3, 0, 5434},
+{0, 0x50, 0xB, 0, 3, 0, 5437},
+{0, 0x50, 0xB, 0, 3, 0, 5440},
+{0, 0x50, 0xB, 0, 3, 0, 5443},
+{0, 0x50, 0xB, 0, 3, 0, 5446},
+{0, 0x50, 0xB, 0, 3, 0, 5449},
+{0, 0x50, 0xB, 0, 3, 0, 5452},
+{0, 0x50, 0xB, 0, 3, 0, 5455},
+{0, 0x50, 0xB, 0, 3, 0, 5458},
+{0, 0x50, 0xB, 0, 3, 0, 5461},
+{0, 0x50, 0xB, 0, 3, 0, 5464},
+{0, 0x50, 0xB, 0, 3, 0, 5467},
+{0, 0x50, 0xB, 0, 3, 0, 5470},
+{0, 0x50, 0xB, 0, 3, 0, 5473},
+{0, 0x50, 0xB, 0, 3, 0, 5476},
+{0, 0x50, 0xB, 0, 3, 0, 5479},
+{0, 0x50, 0xB, 0, 3, 0, 5482},
+{0, 0x50, 0xB, 0, 3, 0, 5485},
+{0, 0x50, 0xB, 0, 3, 0, 5488},
+{0, 0x50, 0xB, 0, 3, 0, 5491},
+{0, 0x50, 0xB, 0, 3, 0, 5494},
+{0, 0x50, 0xB, 0, 3, 0, 5497},
+{0, 0x50, 0xB, 0, 3, 0, 5500},
+{0, 0x50, 0xB, 0, 3, 0, 5503},
+{0, 0x50, 0xB, 0, 3, 0, 5506},
+{0, 0x50, 0xB, 0, 3, 0, 5509},
+{0, 0x50, 0xB, 0, 3, 0, 5512},
+{0, 0x50, 0xB, 0, 3, 0, 5515},
+{0, 0x50, 0xB, 0, 3, 0, 5518},
+{0, 0x50, 0xB, 0, 3, 0, 5521},
+{0, 0x50, 0xB, 0, 3, 0, 5524},
+{0, 0x50, 0xB, 0, 3, 0, 5527},
+{0, 0x50, 0xB, 0, 3, 0, 5530},
+{0, 0x50, 0xB, 0, 3, 0, 5533},
+{0, 0x50, 0xB, 0, 3, 0, 5536},
+{0, 0x50, 0xB, 0, 3, 0, 5539},
+{0, 0x50, 0xB, 0, 3, 0, 5542},
+{0, 0x50, 0xB, 0, 3, 0, 5545},
+{0, 0x50, 0xB, 0, 3, 0, 5548},
+{0, 0x50, 0xB, 0, 3, 0, 5551},
+{0, 0x50, 0xB, 0, 3, 0, 5554},
+{0, 0x50, 0xB, 0, 3, 0, 5557},
+{0, 0x50, 0xB, 0, 3, 0, 5560},
+{0, 0x50, 0xB, 0, 3, 0, 5563},
+{0, 0x50, 0xB, 0, 3, 0, 5566},
+{0, 0x50, 0xB, 0, 3, 0, 5569},
+{0, 0x50, 0xB, 0, 3, 0, 5572},
+{0, 0x50, 0xB, 0, 3, 0, 5575},
+{0, 0x50, 0xB, 0, 3, 0, 5578},
+{0, 0x50, 0xB, 0, 3, 0, 5581},
+{0, 0x50, 0xB, 0, 3, 0, 5584},
+{0, 0x50, 0xB, 0, 3, 0, 5587},
+{0, 0x50, 0xB, 0, 3, 0, 5590},
+{0, 0x50, 0xB, 0, 3, 0, 5593},
+{0, 0x50, 0xB, 0, 3, 0, 5596},
+{0, 0x50, 0xB, 0, 3, 0, 5599},
+{0, 0x50, 0xB, 0, 3, 0, 5602},
+{0, 0x50, 0xB, 0, 3, 0, 5605},
+{0, 0x50, 0xB, 0, 3, 0, 5608},
+{0, 0x50, 0xB, 0, 3, 0, 5611},
+{0, 0x50, 0xB, 0, 3, 0, 5614},
+{0, 0x50, 0xB, 0, 3, 0, 5617},
+{0, 0x50, 0xB, 0, 3, 0, 5620},
+{0, 0x50, 0xB, 0, 3, 0, 5623},
+{0, 0x50, 0xB, 0, 3, 0, 5626},
+{0, 0x50, 0xB, 0, 3, 0, 5629},
+{0, 0x50, 0xB, 0, 3, 0, 5632},
+{0, 0x50, 0xB, 0, 3, 0, 5635},
+{0, 0x50, 0xB, 0, 3, 0, 5638},
+{0, 0x50, 0xB, 0, 3, 0, 5641},
+{0, 0x50, 0xB, 0, 3, 0, 5644},
+{0, 0x50, 0xB, 0, 3, 0, 5647},
+{0, 0x50, 0xB, 0, 3, 0, 5650},
+{0, 0x50, 0xB, 0, 3, 0, 5653},
+{0, 0x50, 0xB, 0, 3, 0, 5656},
+{0, 0x50, 0xB, 0, 3, 0, 5659},
+{0, 0x50, 0xB, 0, 3, 0, 5662},
+{0, 0x50, 0xB, 0, 3, 0, 5665},
+{0, 0x50, 0xB, 0, 3, 0, 5668},
+{0, 0x50, 0xB, 0, 4, 0, 5671},
+{0, 0x50, 0xB, 0, 4, 0, 5675},
+{0, 0x50, 0xB, 0, 4, 0, 5679},
+{0, 0x50, 0xB, 0, 4, 0, 5683},
+{0, 0x50, 0xB, 0, 4, 0, 5687},
+{0, 0x50, 0xB, 0, 4, 0, 5691},
+{0, 0x50, 0xB, 0, 4, 0, 5695},
+{0, 0x50, 0xB, 0, 3, 0, 5699},
+{0, 0x50, 0xB, 0, 18, 0, 5702},
+{0, 0x50, 0xB, 0, 8, 0, 5720},
+{0, 0x50, 0xB, 0, 4, 0, 5728},
+{0, 0x50, 0xB, 0, 1, 0, 5732},
+{0, 0x50, 0xB, 0, 1, 0, 5733},
+{0, 0x50, 0xB, 0, 1, 0, 5734},
+{0, 0x50, 0xB, 0, 1, 0, 5735},
+{0, 0x50, 0xB, 0, 1, 0, 621},
+{0, 0x50, 0xB, 0, 1, 0, 5736},
+{0, 0x50, 0xB, 0, 1, 0, 5737},
+{0, 0x50, 0xB, 0, 1, 0, 5738},
+{0, 0x50, 0xB, 0, 1, 0, 5739},
+{0, 0x50, 0xB, 0, 1, 0, 5740},
+{0, 0x50, 0xB, 0, 1, 0, 5741},
+{0, 0x50, 0xB, 0, 1, 0, 5742},
+{0, 0x50, 0xB, 0, 1, 0, 5743},
+{0, 0x50, 0xB, 0, 1, 0, 5744},
+{0, 0x50, 0xB, 0, 1, 0, 5745},
+{0, 0x50, 0xB, 0, 1, 0, 5746},
+{0, 0x50, 0xB, 0, 1, 0, 5747},
+{0, 0x50, 0xB, 0, 1, 0, 5748},
+{0, 0x50, 0xB, 0, 1, 0, 5749},
+{0, 0x50, 0xB, 0, 1, 0, 5750},
+{0, 0x50, 0xB, 0, 1, 0, 2557},
+{0, 0x50, 0xB, 0, 1, 0, 2558},
+{0, 0x50, 0xB, 0, 1, 0, 5751},
+{0, 0x50, 0xB, 0, 1, 0, 5752},
+{0, 0x50, 0xB, 0, 1, 0, 5753},
+{0, 0x50, 0xB, 0, 1, 0, 5754},
+{0, 0x50, 0xB, 0, 1, 0, 5755},
+{0, 0x50, 0xB, 0, 1, 0, 5756},
+{0, 0x50, 0xB, 0, 1, 0, 5757},
+{0, 0x50, 0xB, 0, 1, 0, 5758},
+{0, 0x50, 0xB, 0, 1, 0, 5759},
+{0, 0x50, 0xB, 0, 1, 0, 5760},
+{0, 0x50, 0xB, 0, 1, 0, 5761},
+{0, 0x50, 0xB, 0, 1, 0, 5762},
+{0, 0x50, 0xB, 0, 1, 0, 5763},
+{0, 0x50, 0xB, 0, 1, 0, 5764},
+{0, 0x50, 0xB, 0, 1, 0, 5765},
+{0, 0x50, 0xB, 0, 1, 0, 5766},
+{0, 0x50, 0xB, 0, 2, 0, 5767},
+{0, 0x50, 0xB, 0, 2, 0, 5769},
+{0, 0x50, 0xB, 0, 2, 0, 5771},
+{0, 0x50, 0xB, 0, 2, 0, 5773},
+{0, 0x50, 0xB, 0, 2, 0, 5775},
+{0, 0x50, 0xB, 0, 2, 0, 5777},
+{0, 0x50, 0xB, 0, 2, 0, 5779},
+{0, 0x50, 0xB, 0, 2, 0, 5781},
+{0, 0x50, 0xB, 0, 2, 0, 5783},
+{0, 0x50, 0xB, 0, 2, 0, 5785},
+{0, 0x50, 0xB, 0, 2, 0, 5787},
+{0, 0x50, 0xB, 0, 2, 0, 5789},
+{0, 0x50, 0xB, 0, 2, 0, 5791},
+{0, 0x50, 0xB, 0, 2, 0, 5793},
+{0, 0x50, 0xB, 0, 1, 0, 5795},
+{0, 0x50, 0xB, 0, 2, 0, 791},
+{0, 0x50, 0xB, 0, 2, 0, 793},
+{0, 0x50, 0xB, 0, 2, 0, 795},
+{0, 0x50, 0xB, 0, 2, 0, 797},
+{0, 0x50, 0xB, 0, 2, 0, 799},
+{0, 0x50, 0xB, 0, 1, 0, 5796},
+{0, 0x50, 0xB, 0, 1, 0, 5797},
+{0, 0x50, 0xB, 0, 1, 0, 5798},
+{0, 0x50, 0xB, 0, 1, 0, 5799},
+{0, 0x50, 0xB, 0, 1, 0, 5800},
+{0, 0x50, 0xB, 0, 1, 0, 5801},
+{0, 0x50, 0xB, 0, 1, 0, 5802},
+{0, 0x50, 0xB, 0, 1, 0, 5803},
+{0, 0x50, 0xB, 0, 1, 0, 5804},
+{0, 0x50, 0xB, 0, 1, 0, 5805},
+{0, 0x50, 0xB, 0, 1, 0, 5806},
+{0, 0x50, 0xB, 0, 1, 0, 5807},
+{0, 0x50, 0xB, 0, 1, 0, 5808},
+{0, 0x50, 0xB, 0, 1, 0, 5809},
+{0, 0x50, 0xB, 0, 1, 0, 5810},
+{0, 0x50, 0xB, 0, 1, 0, 5811},
+{0, 0x50, 0xB, 0, 1, 0, 5812},
+{0, 0x50, 0xB, 0, 1, 0, 5813},
+{0, 0x50, 0xB, 0, 1, 0, 5814},
+{0, 0x50, 0xB, 0, 1, 0, 5815},
+{0, 0x50, 0xB, 0, 1, 0, 5816},
+{0, 0x50, 0xB, 0, 1, 0, 5817},
+{0, 0x50, 0xB, 0, 1, 0, 5818},
+{0, 0x50, 0xB, 0, 1, 0, 5819},
+{0, 0x50, 0xB, 0, 1, 0, 5820},
+{0, 0x50, 0xB, 0, 1, 0, 5821},
+{0, 0x50, 0xB, 0, 1, 0, 5822},
+{0, 0x50, 0xB, 0, 1, 0, 5823},
+{0, 0x50, 0xB, 0, 1, 0, 5824},
+{0, 0x50, 0xB, 0, 3, 0, 5825},
+{0, 0x50, 0xB, 0, 3, 0, 5828},
+{0, 0x50, 0xB, 0, 3, 0, 5831},
+{0, 0x50, 0xB, 0, 2, 0, 5834},
+{0, 0x50, 0xB, 0, 1, 0, 5836},
+{0, 0x50, 0xB, 0, 1, 0, 5837},
+{0, 0x50, 0xB, 0, 1, 0, 5838},
+{0, 0x50, 0xB, 0, 1, 0, 5839},
+{0, 0x50, 0xB, 0, 1, 0, 2245},
+{0, 0x50, 0xB, 0, 1, 0, 5840},
+{0, 0x50, 0xB, 0, 1, 0, 5841},
+{0, 0x50, 0xB, 0, 1, 0, 5842},
+{0, 0x50, 0xB, 0, 1, 0, 5843},
+{0, 0x50, 0xB, 0, 1, 0, 5844},
+{0, 0x50, 0xB, 0, 1, 0, 5845},
+{0, 0x50, 0xB, 0, 1, 0, 5846},
+{0, 0x50, 0xB, 0, 1, 0, 5847},
+{0, 0x50, 0xB, 0, 1, 0, 5848},
+{0, 0x50, 0xB, 0, 1, 0, 5849},
+{0, 0x50, 0xB, 0, 1, 0, 5850},
+{0, 0x50, 0xB, 0, 1, 0, 5851},
+{0, 0x50, 0xB, 0, 1, 0, 5852},
+{0, 0x50, 0xB, 0, 1, 0, 5853},
+{0, 0x50, 0xB, 0, 1, 0, 5854},
+{0, 0x50, 0xB, 0, 1, 0, 5855},
+{0, 0x50, 0x3, 0, 1, 0, 5856},
+{0, 0x50, 0x3, 0, 1, 0, 5857},
+{0, 0x50, 0xB, 0, 1, 0, 5858},
+{0, 0x50, 0xB, 0, 1, 0, 5859},
+{0, 0x50, 0xB, 0, 1, 0, 5860},
+{0, 0x50, 0xB, 0, 1, 0, 5861},
+{0, 0x50, 0xB, 0, 1, 0, 5862},
+{0, 0x50, 0xB, 0, 1, 0, 5863},
+{0, 0x50, 0xB, 0, 1, 0, 5864},
+{0, 0x50, 0xB, 0, 1, 0, 5865},
+{0, 0x50, 0xB, 0, 1, 0, 5866},
+{0, 0x50, 0xB, 0, 1, 0, 5867},
+{0, 0x50, 0xB, 0, 1, 0, 5868},
+{0, 0x50, 0xB, 0, 1, 0, 5869},
+{0, 0x50, 0xB, 0, 1, 0, 5870},
+{0, 0x50, 0xB, 0, 1, 0, 5871},
+{0, 0x50, 0xB, 0, 1, 0, 5872},
+{0, 0x50, 0xB, 0, 1, 0, 5873},
+{0, 0x50, 0xB, 0, 1, 0, 5874},
+{0, 0x50, 0xB, 0, 1, 0, 5875},
+{0, 0x50, 0xB, 0, 1, 0, 5876},
+{0, 0x50, 0xB, 0, 1, 0, 5877},
+{0, 0x50, 0xB, 0, 1, 0, 5878},
+{0, 0x50, 0xB, 0, 1, 0, 5879},
+{0, 0x50, 0xB, 0, 1, 0, 5880},
+{0, 0x50, 0xB, 0, 1, 0, 5881},
+{0, 0x50, 0xB, 0, 1, 0, 5882},
+{0, 0x50, 0xB, 0, 1, 0, 5883},
+{0, 0x50, 0xB, 0, 1, 0, 5884},
+{0, 0x50, 0xB, 0, 1, 0, 5885},
+{0, 0x50, 0xB, 0, 1, 0, 5886},
+{0, 0x50, 0xB, 0, 1, 0, 5887},
+{0, 0x50, 0xB, 0, 1, 0, 5888},
+{0, 0x50, 0xB, 0, 1, 0, 5889},
+{0, 0x50, 0xB, 0, 1, 0, 5890},
+{0, 0x50, 0xB, 0, 1, 0, 5891},
+{0, 0x50, 0xB, 0, 1, 0, 5892},
+{0, 0x50, 0xB, 0, 1, 0, 5893},
+{0, 0x50, 0xB, 0, 1, 0, 5894},
+{0, 0x50, 0xB, 0, 1, 0, 5895},
+{0, 0x50, 0xB, 0, 1, 0, 5896},
+{0, 0x50, 0xB, 0, 1, 0, 5897},
+{0, 0x50, 0xB, 0, 1, 0, 5898},
+{0, 0x50, 0xB, 0, 1, 0, 5899},
+{0, 0x50, 0xB, 0, 1, 0, 5900},
+{0, 0x50, 0xB, 0, 1, 0, 5901},
+{0, 0x50, 0xB, 0, 1, 0, 5902},
+{0, 0x50, 0xB, 0, 1, 0, 5903},
+{0, 0x50, 0xB, 0, 1, 0, 5904},
+{0, 0x50, 0xB, 0, 1, 0, 5905},
+{0, 0x50, 0xB, 0, 1, 0, 5906},
+{0, 0x50, 0xB, 0, 1, 0, 5907},
+{0, 0x50, 0xB, 0, 1, 0, 5908},
+{0, 0x50, 0xB, 0, 1, 0, 5909},
+{0, 0x50, 0xB, 0, 1, 0, 5910},
+{0, 0x50, 0xB, 0, 1, 0, 5911},
+{0, 0x50, 0xB, 0, 1, 0, 5912},
+{0, 0x50, 0xB, 0, 1, 0, 5913},
+{0, 0x50, 0xB, 0, 1, 0, 5914},
+{0, 0x50, 0xB, 0, 1, 0, 5915},
+{0, 0x50, 0xB, 0, 1, 0, 5916},
+{0, 0x50, 0xB, 0, 1, 0, 5917},
+{0, 0x50, 0xB, 0, 1, 0, 5918},
+{0, 0x50, 0xB, 0, 1, 0, 5919},
+{0, 0x50, 0xB, 0, 1, 0, 5920},
+{0, 0x50, 0xB, 0, 1, 0, 5921},
+{0, 0x50, 0xB, 0, 1, 0, 5922},
+{0, 0x50, 0xB, 0, 1, 0, 5923},
+{0, 0x50, 0xB, 0, 1, 0, 5924},
+{0, 0x44, 0xF, 2, 2, 5925, 5925},
+{0, 0x44, 0xF, 2, 2, 5927, 5927},
+{0, 0x44, 0xF, 2, 2, 5929, 5929},
+{0, 0x44, 0xF, 2, 2, 5931, 5931},
+{0, 0x44, 0xF, 2, 2, 5933, 5933},
+{0, 0x44, 0xF, 2, 2, 5935, 5935},
+{0, 0x44, 0xF, 2, 2, 5937, 5937},
+{0, 0x44, 0xF, 2, 2, 5939, 5939},
+{0, 0x44, 0xF, 2, 2, 5941, 5941},
+{0, 0x44, 0xF, 2, 2, 5943, 5943},
+{0, 0x44, 0xF, 2, 2, 5945, 5945},
+{0, 0x44, 0xF, 2, 2, 5947, 5947},
+{0, 0x44, 0xF, 2, 2, 5949, 5949},
+{6, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x55, 0xA, 2, 2, 5951, 5951},
+{0, 0x55, 0xA, 2, 2, 5953, 5953},
+{0, 0x55, 0xA, 3, 3, 5955, 5955},
+{0, 0x55, 0xA, 3, 3, 5958, 5958},
+{0, 0x55, 0xA, 3, 3, 5961, 5961},
+{0, 0x55, 0xA, 3, 3, 5964, 5964},
+{0, 0x55, 0xA, 3, 3, 5967, 5967},
+{226, 0x00, 0x0, 0, 0, 0, 0},
+{0, 0x55, 0xA, 2, 2, 5970, 5970},
+{0, 0x55, 0xA, 2, 2, 5972, 5972},
+{0, 0x55, 0xA, 3, 3, 5974, 5974},
+{0, 0x55, 0xA, 3, 3, 5977, 5977},
+{0, 0x55, 0xA, 3, 3, 5980, 5980},
+{0, 0x55, 0xA, 3, 3, 5983, 5983},
+{0, 0x50, 0xB, 0, 1, 0, 5986},
+{0, 0x50, 0xB, 0, 1, 0, 5987},
+{0, 0x50, 0xB, 0, 1, 0, 5988},
+{0, 0x50, 0xB, 0, 1, 0, 5989},
+{0, 0x50, 0xB, 0, 1, 0, 5990},
+{0, 0x50, 0xB, 0, 1, 0, 5991},
+{0, 0x50, 0xB, 0, 1, 0, 5992},
+{0, 0x50, 0xB, 0, 1, 0, 5993},
+{0, 0x50, 0xB, 0, 1, 0, 5994},
+{0, 0x50, 0xB, 0, 1, 0, 5995},
+{0, 0x50, 0xB, 0, 1, 0, 5996},
+{0, 0x50, 0xB, 0, 1, 0, 5997},
+{0, 0x50, 0xB, 0, 1, 0, 5998},
+{0, 0x50, 0xB, 0, 1, 0, 5999},
+{0, 0x50, 0xB, 0, 1, 0, 6000},
+{0, 0x50, 0xB, 0, 1, 0, 6001},
+{0, 0x50, 0xB, 0, 1, 0, 6002},
+{0, 0x50, 0xB, 0, 1, 0, 6003},
+{0, 0x50, 0xB, 0, 1, 0, 6004},
+{0, 0x50, 0xB, 0, 1, 0, 6005},
+{0, 0x50, 0xB, 0, 1, 0, 2348},
+{0, 0x50, 0xB, 0, 1, 0, 6006},
+{0, 0x50, 0xB, 0, 1, 0, 6007},
+{0, 0x50, 0xB, 0, 1, 0, 6008},
+{0, 0x50, 0xB, 0, 1, 0, 6009},
+{0, 0x50, 0xB, 0, 1, 0, 2141},
+{0, 0x50, 0xB, 0, 1, 0, 6010},
+{0, 0x50, 0xB, 0, 1, 0, 6011},
+{0, 0x50, 0xB, 0, 1, 0, 6012},
+{0, 0x50, 0xB, 0, 1, 0, 6013},
+{0, 0x50, 0xB, 0, 1, 0, 6014},
+{0, 0x50, 0xB, 0, 1, 0, 6015},
+{0, 0x50, 0xB, 0, 1, 0, 6016},
+{0, 0x50, 0xB, 0, 1, 0, 6017},
+{0, 0x50, 0xB, 0, 1, 0, 6018},
+{0, 0x50, 0xB, 0, 1, 0, 6019},
+{0, 0x50, 0xB, 0, 1, 0, 6020},
+{0, 0x50, 0xB, 0, 1, 0, 6021},
+{0, 0x50, 0xB, 0, 1, 0, 6022},
+{0, 0x50, 0xB, 0, 1, 0, 6023},
+{0, 0x50, 0xB, 0, 1, 0, 6024},
+{0, 0x50, 0xB, 0, 2, 0, 6025},
+{0, 0x50, 0xB, 0, 2, 0, 6027},
+{0, 0x50, 0xB, 0, 2, 0, 6029},
+{0, 0x50, 0xB, 0, 2, 0, 6031},
+{0, 0x50, 0xB, 0, 2, 0, 6033},
+{0, 0x50, 0xB, 0, 2, 0, 6035},
+{0, 0x50, 0xB, 0, 2, 0, 6037},
+{0, 0x50, 0xB, 0, 2, 0, 6039},
+{0, 0x50, 0xB, 0, 2, 0, 6041},
+{0, 0x50, 0xB, 0, 2, 0, 6043},
+{0, 0x50, 0xB, 0, 2, 0, 6045},
+{0, 0x50, 0xB, 0, 3, 0, 6047},
+{0, 0x50, 0xB, 0, 3, 0, 6050},
+{0, 0x50, 0xB, 0, 3, 0, 6053},
+{0, 0x50, 0xB, 0, 3, 0, 6056},
+{0, 0x50, 0xB, 0, 3, 0, 6059},
+{0, 0x50, 0xB, 0, 3, 0, 6062},
+{0, 0x50, 0xB, 0, 3, 0, 6065},
+{0, 0x50, 0xB, 0, 3, 0, 6068},
+{0, 0x50, 0xB, 0, 3, 0, 6071},
+{0, 0x50, 0xB, 0, 3, 0, 6074},
+{0, 0x50, 0xB, 0, 3, 0, 6077},
+{0, 0x50, 0xB, 0, 3, 0, 6080},
+{0, 0x50, 0xB, 0, 3, 0, 6083},
+{0, 0x50, 0xB, 0, 3, 0, 6086},
+{0, 0x50, 0xB, 0, 3, 0, 6089},
+{0, 0x50, 0xB, 0, 3, 0, 6092},
+{0, 0x50, 0xB, 0, 3, 0, 6095},
+{0, 0x50, 0xB, 0, 3, 0, 6098},
+{0, 0x50, 0xB, 0, 3, 0, 6101},
+{0, 0x50, 0xB, 0, 3, 0, 6104},
+{0, 0x50, 0xB, 0, 3, 0, 6107},
+{0, 0x50, 0xB, 0, 3, 0, 6110},
+{0, 0x50, 0xB, 0, 3, 0, 6113},
+{0, 0x50, 0xB, 0, 3, 0, 6116},
+{0, 0x50, 0xB, 0, 3, 0, 6119},
+{0, 0x50, 0xB, 0, 3, 0, 6122},
+{0, 0x50, 0xB, 0, 3, 0, 6125},
+{0, 0x50, 0xB, 0, 2, 0, 6128},
+{0, 0x50, 0xB, 0, 2, 0, 6130},
+{0, 0x50, 0xB, 0, 2, 0, 6132},
+{0, 0x50, 0xB, 0, 2, 0, 6134},
+{0, 0x50, 0xB, 0, 2, 0, 6136},
+{0, 0x50, 0xB, 0, 3, 0, 6138},
+{0, 0x50, 0xB, 0, 2, 0, 6141},
+{0, 0x50, 0xB, 0, 2, 0, 6143},
+{0, 0x50, 0xB, 0, 2, 0, 6145},
+{0, 0x50, 0xB, 0, 2, 0, 6147},
+{0, 0x50, 0xB, 0, 2, 0, 6149},
+{0, 0x50, 0xB, 0, 2, 0, 6151},
+{0, 0x50, 0xB, 0, 2, 0, 6153},
+{0, 0x50, 0xB, 0, 1, 0, 6155},
+{0, 0x50, 0xB, 0, 1, 0, 6156},
+{0, 0x50, 0xB, 0, 2, 0, 3104},
+{0, 0x50, 0xB, 0, 1, 0, 6157},
+{0, 0x50, 0xB, 0, 1, 0, 6158},
+{0, 0x50, 0xB, 0, 1, 0, 6159},
+{0, 0x50, 0xB, 0, 1, 0, 6160},
+{0, 0x50, 0xB, 0, 1, 0, 6161},
+{0, 0x50, 0xB, 0, 1, 0, 4648},
+{0, 0x50, 0xB, 0, 1, 0, 6162},
+{0, 0x50, 0xB, 0, 1, 0, 6163},
+{0, 0x50, 0xB, 0, 1, 0, 6164},
+{0, 0x50, 0xB, 0, 1, 0, 6165},
+{0, 0x50, 0xB, 0, 1, 0, 6166},
+{0, 0x50, 0xB, 0, 1, 0, 6167},
+{0, 0x50, 0xB, 0, 1, 0, 6168},
+{0, 0x50, 0xB, 0, 1, 0, 6169},
+{0, 0x50, 0xB, 0, 1, 0, 6170},
+{0, 0x50, 0xB, 0, 1, 0, 6171},
+{0, 0x50, 0xB, 0, 1, 0, 6172},
+{0, 0x50, 0xB, 0, 1, 0, 6173},
+{0, 0x50, 0xB, 0, 1, 0, 6174},
+{0, 0x50, 0xB, 0, 1, 0, 6175},
+{0, 0x50, 0xB, 0, 1, 0, 6176},
+{0, 0x50, 0xB, 0, 1, 0, 6177},
+{0, 0x50, 0xB, 0, 1, 0, 6178},
+{0, 0x50, 0xB, 0, 1, 0, 6179},
+{0, 0x50, 0xB, 0, 1, 0, 6180},
+{0, 0x50, 0xB, 0, 1, 0, 6181},
+{0, 0x50, 0xB, 0, 1, 0, 6182},
+{0, 0x50, 0xB, 0, 1, 0, 6183},
+{0, 0x50, 0xB, 0, 1, 0, 6184},
+{0, 0x50, 0xB, 0, 3, 0, 6185},
+{0, 0x50, 0xB, 0, 3, 0, 6188},
+{0, 0x50, 0xB, 0, 3, 0, 6191},
+{0, 0x50, 0xB, 0, 3, 0, 6194},
+{0, 0x50, 0xB, 0, 3, 0, 6197},
+{0, 0x50, 0xB, 0, 3, 0, 6200},
+{0, 0x50, 0xB, 0, 3, 0, 6203},
+{0, 0x50, 0xB, 0, 3, 0, 6206},
+{0, 0x50, 0xB, 0, 3, 0, 6209},
+{0, 0x50, 0xB, 0, 1, 0, 6212},
+{0, 0x50, 0xB, 0, 1, 0, 6213},
+{0, 0x55, 0xA, 1, 1, 6214, 6214},
+{0, 0x55, 0xA, 1, 1, 6215, 6215},
+{0, 0x55, 0xA, 1, 1, 6216, 6216},
+{0, 0x55, 0xA, 1, 1, 6217, 6217},
+{0, 0x55, 0xA, 1, 1, 6218, 6218},
+{0, 0x55, 0xA, 1, 1, 6219, 6219},
+{0, 0x55, 0xA, 1, 1, 6220, 6220},
+{0, 0x55, 0xA, 1, 1, 6221, 6221},
+{0, 0x55, 0xA, 1, 1, 6222, 6222},
+{0, 0x55, 0xA, 1, 1, 6223, 6223},
+{0, 0x55, 0xA, 1, 1, 6224, 6224},
+{0, 0x55, 0xA, 1, 1, 6225, 6225},
+{0, 0x55, 0xA, 1, 1, 6226, 6226},
+{0, 0x55, 0xA, 1, 1, 6227, 6227},
+{0, 0x55, 0xA, 1, 1, 6228, 6228},
+{0, 0x55, 0xA, 1, 1, 6229, 6229},
+{0, 0x55, 0xA, 1, 1, 6230, 6230},
+{0, 0x55, 0xA, 1, 1, 6231, 6231},
+{0, 0x55, 0xA, 1, 1, 6164, 6164},
+{0, 0x55, 0xA, 1, 1, 6232, 6232},
+{0, 0x55, 0xA, 1, 1, 6233, 6233},
+{0, 0x55, 0xA, 1, 1, 6234, 6234},
+{0, 0x55, 0xA, 1, 1, 6235, 6235},
+{0, 0x55, 0xA, 1, 1, 6236, 6236},
+{0, 0x55, 0xA, 1, 1, 6237, 6237},
+{0, 0x55, 0xA, 1, 1, 2817, 2817},
+{0, 0x55, 0xA, 1, 1, 6238, 6238},
+{0, 0x55, 0xA, 1, 1, 6239, 6239},
+{0, 0x55, 0xA, 1, 1, 6240, 6240},
+{0, 0x55, 0xA, 1, 1, 6241, 6241},
+{0, 0x55, 0xA, 1, 1, 6182, 6182},
+{0, 0x55, 0xA, 1, 1, 6242, 6242},
+{0, 0x55, 0xA, 1, 1, 6243, 6243},
+{0, 0x55, 0xA, 1, 1, 6244, 6244},
+{0, 0x55, 0xA, 1, 1, 6245, 6245},
+{0, 0x55, 0xA, 1, 1, 6246, 6246},
+{0, 0x55, 0xA, 1, 1, 6247, 6247},
+{0, 0x55, 0xA, 1, 1, 6248, 6248},
+{0, 0x55, 0xA, 1, 1, 6249, 6249},
+{0, 0x55, 0xA, 1, 1, 6250, 6250},
+{0, 0x55, 0xA, 1, 1, 6251, 6251},
+{0, 0x55, 0xA, 1, 1, 6252, 6252},
+{0, 0x55, 0xA, 1, 1, 6253, 6253},
+{0, 0x55, 0xA, 1, 1, 6254, 6254},
+{0, 0x55, 0xA, 1, 1, 6255, 6255},
+{0, 0x55, 0xA, 1, 1, 6256, 6256},
+{0, 0x55, 0xA, 1, 1, 6257, 6257},
+{0, 0x55, 0xA, 1, 1, 6258, 6258},
+{0, 0x55, 0xA, 1, 1, 6259, 6259},
+{0, 0x55, 0xA, 1, 1, 6260, 6260},
+{0, 0x55, 0xA, 1, 1, 6261, 6261},
+{0, 0x55, 0xA, 1, 1, 6262, 6262},
+{0, 0x55, 0xA, 1, 1, 6263, 6263},
+{0, 0x55, 0xA, 1, 1, 6264, 6264},
+{0, 0x55, 0xA, 1, 1, 6265, 6265},
+{0, 0x55, 0xA, 1, 1, 6266, 6266},
+{0, 0x55, 0xA, 1, 1, 6267, 6267},
+{0, 0x55, 0xA, 1, 1, 6268, 6268},
+{0, 0x55, 0xA, 1, 1, 6269, 6269},
+{0, 0x55, 0xA, 1, 1, 6270, 6270},
+{0, 0x55, 0xA, 1, 1, 6271, 6271},
+{0, 0x55, 0xA, 1, 1, 6272, 6272},
+{0, 0x55, 0xA, 1, 1, 6273, 6273},
+{0, 0x55, 0xA, 1, 1, 6274, 6274},
+{0, 0x55, 0xA, 1, 1, 6275, 6275},
+{0, 0x55, 0xA, 1, 1, 6276, 6276},
+{0, 0x55, 0xA, 1, 1, 6277, 6277},
+{0, 0x55, 0xA, 1, 1, 6278, 6278},
+{0, 0x55, 0xA, 1, 1, 6279, 6279},
+{0, 0x55, 0xA, 1, 1, 6280, 6280},
+{0, 0x55, 0xA, 1, 1, 6281, 6281},
+{0, 0x55, 0xA, 1, 1, 6282, 6282},
+{0, 0x55, 0xA, 1, 1, 6283, 6283},
+{0, 0x55, 0xA, 1, 1, 6284, 6284},
+{0, 0x55, 0xA, 1, 1, 6285, 6285},
+{0, 0x55, 0xA, 1, 1, 6286, 6286},
+{0, 0x55, 0xA, 1, 1, 6287, 6287},
+{0, 0x55, 0xA, 1, 1, 6157, 6157},
+{0, 0x55, 0xA, 1, 1, 6288, 6288},
+{0, 0x55, 0xA, 1, 1, 6289, 6289},
+{0, 0x55, 0xA, 1, 1, 6290, 6290},
+{0, 0x55, 0xA, 1, 1, 6291, 6291},
+{0, 0x55, 0xA, 1, 1, 6292, 6292},
+{0, 0x55, 0xA, 1, 1, 6293, 6293},
+{0, 0x55, 0xA, 1, 1, 6294, 6294},
+{0, 0x55, 0xA, 1, 1, 6295, 6295},
+{0, 0x55, 0xA, 1, 1, 6296, 6296},
+{0, 0x55, 0xA, 1, 1, 6297, 6297},
+{0, 0x55, 0xA, 1, 1, 6298, 6298},
+{0, 0x55, 0xA, 1, 1, 6299, 6299},
+{0, 0x55, 0xA, 1, 1, 6300, 6300},
+{0, 0x55, 0xA, 1, 1, 6301, 6301},
+{0, 0x55, 0xA, 1, 1, 6302, 6302},
+{0, 0x55, 0xA, 1, 1, 6303, 6303},
+{0, 0x55, 0xA, 1, 1, 6304, 6304},
+{0, 0x55, 0xA, 1, 1, 6305, 6305},
+{0, 0x55, 0xA, 1, 1, 6306, 6306},
+{0, 0x55, 0xA, 1, 1, 6307, 6307},
+{0, 0x55, 0xA, 1, 1, 6308, 6308},
+{0, 0x55, 0xA, 1, 1, 2843, 2843},
+{0, 0x55, 0xA, 1, 1, 6309, 6309},
+{0, 0x55, 0xA, 1, 1, 6310, 6310},
+{0, 0x55, 0xA, 1, 1, 6311, 6311},
+{0, 0x55, 0xA, 1, 1, 6312, 6312},
+{0, 0x55, 0xA, 1, 1, 6313, 6313},
+{0, 0x55, 0xA, 1, 1, 6314, 6314},
+{0, 0x55, 0xA, 1, 1, 6315, 6315},
+{0, 0x55, 0xA, 1, 1, 6316, 6316},
+{0, 0x55, 0xA, 1, 1, 6317, 6317},
+{0, 0x55, 0xA, 1, 1, 6318, 6318},
+{0, 0x55, 0xA, 1, 1, 6319, 6319},
+{0, 0x55, 0xA, 1, 1, 6320, 6320},
+{0, 0x55, 0xA, 1, 1, 6321, 6321},
+{0, 0x55, 0xA, 1, 1, 6322, 6322},
+{0, 0x55, 0xA, 1, 1, 6323, 6323},
+{0, 0x55, 0xA, 1, 1, 6324, 6324},
+{0, 0x55, 0xA, 1, 1, 6325, 6325},
+{0, 0x55, 0xA, 1, 1, 6326, 6326},
+{0, 0x55, 0xA, 1, 1, 6327, 6327},
+{0, 0x55, 0xA, 1, 1, 6328, 6328},
+{0, 0x55, 0xA, 1, 1, 6329, 6329},
+{0, 0x55, 0xA, 1, 1, 6330, 6330},
+{0, 0x55, 0xA, 1, 1, 6331, 6331},
+{0, 0x55, 0xA, 1, 1, 6332, 6332},
+{0, 0x55, 0xA, 1, 1, 2855, 2855},
+{0, 0x55, 0xA, 1, 1, 6333, 6333},
+{0, 0x55, 0xA, 1, 1, 6334, 6334},
+{0, 0x55, 0xA, 1, 1, 6335, 6335},
+{0, 0x55, 0xA, 1, 1, 6336, 6336},
+{0, 0x55, 0xA, 1, 1, 6337, 6337},
+{0, 0x55, 0xA, 1, 1, 6338, 6338},
+{0, 0x55, 0xA, 1, 1, 6339, 6339},
+{0, 0x55, 0xA, 1, 1, 6340, 6340},
+{0, 0x55, 0xA, 1, 1, 6341, 6341},
+{0, 0x55, 0xA, 1, 1, 6342, 6342},
+{0, 0x55, 0xA, 1, 1, 6343, 6343},
+{0, 0x55, 0xA, 1, 1, 6344, 6344},
+{0, 0x55, 0xA, 1, 1, 6345, 6345},
+{0, 0x55, 0xA, 1, 1, 6346, 6346},
+{0, 0x55, 0xA, 1, 1, 6347, 6347},
+{0, 0x55, 0xA, 1, 1, 6348, 6348},
+{0, 0x55, 0xA, 1, 1, 6349, 6349},
+{0, 0x55, 0xA, 1, 1, 6350, 6350},
+{0, 0x55, 0xA, 1, 1, 6351, 6351},
+{0, 0x55, 0xA, 1, 1, 6352, 6352},
+{0, 0x55, 0xA, 1, 1, 6353, 6353},
+{0, 0x55, 0xA, 1, 1, 6354, 6354},
+{0, 0x55, 0xA, 1, 1, 6355, 6355},
+{0, 0x55, 0xA, 1, 1, 6356, 6356},
+{0, 0x55, 0xA, 1, 1, 6357, 6357},
+{0, 0x55, 0xA, 1, 1, 6358, 6358},
+{0, 0x55, 0xA, 1, 1, 6359, 6359},
+{0, 0x55, 0xA, 1, 1, 6360, 6360},
+{0, 0x55, 0xA, 1, 1, 6361, 6361},
+{0, 0x55, 0xA, 1, 1, 6362, 6362},
+{0, 0x55, 0xA, 1, 1, 6363, 6363},
+{0, 0x55, 0xA, 1, 1, 6364, 6364},
+{0, 0x55, 0xA, 1, 1, 6365, 6365},
+{0, 0x55, 0xA, 1, 1, 6366, 6366},
+{0, 0x55, 0xA, 1, 1, 6367, 6367},
+{0, 0x55, 0xA, 1, 1, 6368, 6368},
+{0, 0x55, 0xA, 1, 1, 6369, 6369},
+{0, 0x55, 0xA, 1, 1, 6370, 6370},
+{0, 0x55, 0xA, 1, 1, 6371, 6371},
+{0, 0x55, 0xA, 1, 1, 6372, 6372},
+{0, 0x55, 0xA, 1, 1, 6373, 6373},
+{0, 0x55, 0xA, 1, 1, 6374, 6374},
+{0, 0x55, 0xA, 1, 1, 6375, 6375},
+{0, 0x55, 0xA, 1, 1, 6376, 6376},
+{0, 0x55, 0xA, 1, 1, 6377, 6377},
+{0, 0x55, 0xA, 1, 1, 6378, 6378},
+{0, 0x55, 0xA, 1, 1, 6379, 6379},
+{0, 0x55, 0xA, 1, 1, 6380, 6380},
+{0, 0x55, 0xA, 1, 1, 6381, 6381},
+{0, 0x55, 0xA, 1, 1, 6382, 6382},
+{0, 0x55, 0xA, 1, 1, 6383, 6383},
+{0, 0x55, 0xA, 1, 1, 6384, 6384},
+{0, 0x55, 0xA, 1, 1, 6385, 6385},
+{0, 0x55, 0xA, 1, 1, 6386, 6386},
+{0, 0x55, 0xA, 1, 1, 6387, 6387},
+{0, 0x55, 0xA, 1, 1, 6388, 6388},
+{0, 0x55, 0xA, 1, 1, 6389, 6389},
+{0, 0x55, 0xA, 1, 1, 6390, 6390},
+{0, 0x55, 0xA, 1, 1, 6391, 6391},
+{0, 0x55, 0xA, 1, 1, 6392, 6392},
+{0, 0x55, 0xA, 1, 1, 6393, 6393},
+{0, 0x55, 0xA, 1, 1, 6394, 6394},
+{0, 0x55, 0xA, 1, 1, 6395, 6395},
+{0, 0x55, 0xA, 1, 1, 6396, 6396},
+{0, 0x55, 0xA, 1, 1, 6397, 6397},
+{0, 0x55, 0xA, 1, 1, 6398, 6398},
+{0, 0x55, 0xA, 1, 1, 6399, 6399},
+{0, 0x55, 0xA, 1, 1, 6400, 6400},
+{0, 0x55, 0xA, 1, 1, 6401, 6401},
+{0, 0x55, 0xA, 1, 1, 6402, 6402},
+{0, 0x55, 0xA, 1, 1, 6403, 6403},
+{0, 0x55, 0xA, 1, 1, 6404, 6404},
+{0, 0x55, 0xA, 1, 1, 6405, 6405},
+{0, 0x55, 0xA, 1, 1, 6406, 6406},
+{0, 0x55, 0xA, 1, 1, 6407, 6407},
+{0, 0x55, 0xA, 1, 1, 6408, 6408},
+{0, 0x55, 0xA, 1, 1, 6409, 6409},
+{0, 0x55, 0xA, 1, 1, 6410, 6410},
+{0, 0x55, 0xA, 1, 1, 6411, 6411},
+{0, 0x55, 0xA, 1, 1, 6412, 6412},
+{0, 0x55, 0xA, 1, 1, 6413, 6413},
+{0, 0x55, 0xA, 1, 1, 6414, 6414},
+{0, 0x55, 0xA, 1, 1, 6415, 6415},
+{0, 0x55, 0xA, 1, 1, 6416, 6416},
+{0, 0x55, 0xA, 1, 1, 6417, 6417},
+{0, 0x55, 0xA, 1, 1, 6418, 6418},
+{0, 0x55, 0xA, 1, 1, 6419, 6419},
+{0, 0x55, 0xA, 1, 1, 6420, 6420},
+{0, 0x55, 0xA, 1, 1, 6421, 6421},
+{0, 0x55, 0xA, 1, 1, 6422, 6422},
+{0, 0x55, 0xA, 1, 1, 6423, 6423},
+{0, 0x55, 0xA, 1, 1, 6424, 6424},
+{0, 0x55, 0xA, 1, 1, 6425, 6425},
+{0, 0x55, 0xA, 1, 1, 6426, 6426},
+{0, 0x55, 0xA, 1, 1, 6427, 6427},
+{0, 0x55, 0xA, 1, 1, 6428, 6428},
+{0, 0x55, 0xA, 1, 1, 6429, 6429},
+{0, 0x55, 0xA, 1, 1, 6430, 6430},
+{0, 0x55, 0xA, 1, 1, 6431, 6431},
+{0, 0x55, 0xA, 1, 1, 6432, 6432},
+{0, 0x55, 0xA, 1, 1, 6433, 6433},
+{0, 0x55, 0xA, 1, 1, 6434, 6434},
+{0, 0x55, 0xA, 1, 1, 6435, 6435},
+{0, 0x55, 0xA, 1, 1, 6436, 6436},
+{0, 0x55, 0xA, 1, 1, 6437, 6437},
+{0, 0x55, 0xA, 1, 1, 6438, 6438},
+{0, 0x55, 0xA, 1, 1, 6439, 6439},
+{0, 0x55, 0xA, 1, 1, 6440, 6440},
+{0, 0x55, 0xA, 1, 1, 6441, 6441},
+{0, 0x55, 0xA, 1, 1, 6442, 6442},
+{0, 0x55, 0xA, 1, 1, 6443, 6443},
+{0, 0x55, 0xA, 1, 1, 6444, 6444},
+{0, 0x55, 0xA, 1, 1, 6445, 6445},
+{0, 0x55, 0xA, 1, 1, 6446, 6446},
+{0, 0x55, 0xA, 1, 1, 6447, 6447},
+{0, 0x55, 0xA, 1, 1, 6448, 6448},
+{0, 0x55, 0xA, 1, 1, 6449, 6449},
+{0, 0x55, 0xA, 1, 1, 6450, 6450},
+{0, 0x55, 0xA, 1, 1, 6451, 6451},
+{0, 0x55, 0xA, 1, 1, 6452, 6452},
+{0, 0x55, 0xA, 1, 1, 6453, 6453},
+{0, 0x55, 0xA, 1, 1, 6454, 6454},
+{0, 0x55, 0xA, 1, 1, 6455, 6455},
+{0, 0x55, 0xA, 1, 1, 6456, 6456},
+{0, 0x55, 0xA, 1, 1, 6457, 6457},
+{0, 0x55, 0xA, 1, 1, 6458, 6458},
+{0, 0x55, 0xA, 1, 1, 6459, 6459},
+{0, 0x55, 0xA, 1, 1, 6460, 6460},
+{0, 0x55, 0xA, 1, 1, 6461, 6461},
+{0, 0x55, 0xA, 1, 1, 6462, 6462},
+{0, 0x55, 0xA, 1, 1, 6463, 6463},
+{0, 0x55, 0xA, 1, 1, 6464, 6464},
+{0, 0x55, 0xA, 1, 1, 6465, 6465},
+{0, 0x55, 0xA, 1, 1, 6466, 6466},
+{0, 0x55, 0xA, 1, 1, 6467, 6467},
+{0, 0x55, 0xA, 1, 1, 6468, 6468},
+{0, 0x55, 0xA, 1, 1, 6469, 6469},
+{0, 0x55, 0xA, 1, 1, 6470, 6470},
+{0, 0x55, 0xA, 1, 1, 6471, 6471},
+{0, 0x55, 0xA, 1, 1, 6472, 6472},
+{0, 0x55, 0xA, 1, 1, 6473, 6473},
+{0, 0x55, 0xA, 1, 1, 6474, 6474},
+{0, 0x55, 0xA, 1, 1, 6475, 6475},
+{0, 0x55, 0xA, 1, 1, 6476, 6476},
+{0, 0x55, 0xA, 1, 1, 6477, 6477},
+{0, 0x55, 0xA, 1, 1, 6478, 6478},
+{0, 0x55, 0xA, 1, 1, 6479, 6479},
+{0, 0x55, 0xA, 1, 1, 6480, 6480},
+{0, 0x55, 0xA, 1, 1, 6481, 6481},
+{0, 0x55, 0xA, 1, 1, 6482, 6482},
+{0, 0x55, 0xA, 1, 1, 6483, 6483},
+{0, 0x55, 0xA, 1, 1, 6484, 6484},
+{0, 0x55, 0xA, 1, 1, 6485, 6485},
+{0, 0x55, 0xA, 1, 1, 6486, 6486},
+{0, 0x55, 0xA, 1, 1, 6487, 6487},
+{0, 0x55, 0xA, 1, 1, 6488, 6488},
+{0, 0x55, 0xA, 1, 1, 6489, 6489},
+{0, 0x55, 0xA, 1, 1, 6490, 6490},
+{0, 0x55, 0xA, 1, 1, 6491, 6491},
+{0, 0x55, 0xA, 1, 1, 6492, 6492},
+{0, 0x55, 0xA, 1, 1, 6493, 6493},
+{0, 0x55, 0xA, 1, 1, 6494, 6494},
+{0, 0x55, 0xA, 1, 1, 6495, 6495},
+{0, 0x55, 0xA, 1, 1, 6496, 6496},
+{0, 0x55, 0xA, 1, 1, 6497, 6497},
+{0, 0x55, 0xA, 1, 1, 6498, 6498},
+{0, 0x55, 0xA, 1, 1, 6499, 6499},
+{0, 0x55, 0xA, 1, 1, 6500, 6500},
+{0, 0x55, 0xA, 1, 1, 6501, 6501},
+{0, 0x55, 0xA, 1, 1, 6502, 6502},
+{0, 0x55, 0xA, 1, 1, 6503, 6503},
+{0, 0x55, 0xA, 1, 1, 6504, 6504},
+{0, 0x55, 0xA, 1, 1, 6505, 6505},
+{0, 0x55, 0xA, 1, 1, 6506, 6506},
+{0, 0x55, 0xA, 1, 1, 6507, 6507},
+{0, 0x55, 0xA, 1, 1, 6508, 6508},
+{0, 0x55, 0xA, 1, 1, 6509, 6509},
+{0, 0x55, 0xA, 1, 1, 6510, 6510},
+{0, 0x55, 0xA, 1, 1, 6511, 6511},
+{0, 0x55, 0xA, 1, 1, 6512, 6512},
+{0, 0x55, 0xA, 1, 1, 6513, 6513},
+{0, 0x55, 0xA, 1, 1, 6514, 6514},
+{0, 0x55, 0xA, 1, 1, 6515, 6515},
+{0, 0x55, 0xA, 1, 1, 6516, 6516},
+{0, 0x55, 0xA, 1, 1, 6517, 6517},
+{0, 0x55, 0xA, 1, 1, 6518, 6518},
+{0, 0x55, 0xA, 1, 1, 6519, 6519},
+{0, 0x55, 0xA, 1, 1, 6520, 6520},
+{0, 0x55, 0xA, 1, 1, 6521, 6521},
+{0, 0x55, 0xA, 1, 1, 6522, 6522},
+{0, 0x55, 0xA, 1, 1, 6523, 6523},
+{0, 0x55, 0xA, 1, 1, 6524, 6524},
+{0, 0x55, 0xA, 1, 1, 6525, 6525},
+{0, 0x55, 0xA, 1, 1, 6526, 6526},
+{0, 0x55, 0xA, 1, 1, 6527, 6527},
+{0, 0x55, 0xA, 1, 1, 6528, 6528},
+{0, 0x55, 0xA, 1, 1, 6529, 6529},
+{0, 0x55, 0xA, 1, 1, 6530, 6530},
+{0, 0x55, 0xA, 1, 1, 6531, 6531},
+{0, 0x55, 0xA, 1, 1, 6532, 6532},
+{0, 0x55, 0xA, 1, 1, 6533, 6533},
+{0, 0x55, 0xA, 1, 1, 6534, 6534},
+{0, 0x55, 0xA, 1, 1, 6535, 6535},
+{0, 0x55, 0xA, 1, 1, 6536, 6536},
+{0, 0x55, 0xA, 1, 1, 6537, 6537},
+{0, 0x55, 0xA, 1, 1, 6538, 6538},
+{0, 0x55, 0xA, 1, 1, 6539, 6539},
+{0, 0x55, 0xA, 1, 1, 6540, 6540},
+{0, 0x55, 0xA, 1, 1, 6541, 6541},
+{0, 0x55, 0xA, 1, 1, 6542, 6542},
+{0, 0x55, 0xA, 1, 1, 6543, 6543},
+{0, 0x55, 0xA, 1, 1, 6544, 6544},
+{0, 0x55, 0xA, 1, 1, 6545, 6545},
+{0, 0x55, 0xA, 1, 1, 6546, 6546},
+{0, 0x55, 0xA, 1, 1, 6547, 6547},
+{0, 0x55, 0xA, 1, 1, 6548, 6548},
+{0, 0x55, 0xA, 1, 1, 6549, 6549},
+{0, 0x55, 0xA, 1, 1, 6550, 6550},
+{0, 0x55, 0xA, 1, 1, 6551, 6551},
+{0, 0x55, 0xA, 1, 1, 6552, 6552},
+{0, 0x55, 0xA, 1, 1, 6553, 6553},
+{0, 0x55, 0xA, 1, 1, 6554, 6554},
+{0, 0x55, 0xA, 1, 1, 6555, 6555},
+{0, 0x55, 0xA, 1, 1, 6556, 6556},
+{0, 0x55, 0xA, 1, 1, 6557, 6557},
+{0, 0x55, 0xA, 1, 1, 6558, 6558},
+{0, 0x55, 0xA, 1, 1, 6559, 6559},
+{0, 0x55, 0xA, 1, 1, 6560, 6560},
+{0, 0x55, 0xA, 1, 1, 6561, 6561},
+{0, 0x55, 0xA, 1, 1, 6562, 6562},
+{0, 0x55, 0xA, 1, 1, 6563, 6563},
+{0, 0x55, 0xA, 1, 1, 6564, 6564},
+{0, 0x55, 0xA, 1, 1, 6565, 6565},
+{0, 0x55, 0xA, 1, 1, 6566, 6566},
+{0, 0x55, 0xA, 1, 1, 6567, 6567},
+{0, 0x55, 0xA, 1, 1, 6568, 6568},
+{0, 0x55, 0xA, 1, 1, 6569, 6569},
+{0, 0x55, 0xA, 1, 1, 6570, 6570},
+{0, 0x55, 0xA, 1, 1, 6571, 6571},
+{0, 0x55, 0xA, 1, 1, 6572, 6572},
+{0, 0x55, 0xA, 1, 1, 6573, 6573},
+{0, 0x55, 0xA, 1, 1, 6574, 6574},
+{0, 0x55, 0xA, 1, 1, 6575, 6575},
+{0, 0x55, 0xA, 1, 1, 6576, 6576},
+{0, 0x55, 0xA, 1, 1, 6577, 6577},
+{0, 0x55, 0xA, 1, 1, 6578, 6578},
+{0, 0x55, 0xA, 1, 1, 6579, 6579},
+{0, 0x55, 0xA, 1, 1, 6580, 6580},
+{0, 0x55, 0xA, 1, 1, 6581, 6581},
+{0, 0x55, 0xA, 1, 1, 6582, 6582},
+{0, 0x55, 0xA, 1, 1, 6583, 6583},
+{0, 0x55, 0xA, 1, 1, 6584, 6584},
+{0, 0x55, 0xA, 1, 1, 6585, 6585},
+{0, 0x55, 0xA, 1, 1, 6586, 6586},
+{0, 0x55, 0xA, 1, 1, 6587, 6587},
+{0, 0x55, 0xA, 1, 1, 6588, 6588},
+{0, 0x55, 0xA, 1, 1, 6589, 6589},
+{0, 0x55, 0xA, 1, 1, 6590, 6590},
+{0, 0x55, 0xA, 1, 1, 6591, 6591},
+{0, 0x55, 0xA, 1, 1, 6592, 6592},
+{0, 0x55, 0xA, 1, 1, 6593, 6593},
+{0, 0x55, 0xA, 1, 1, 6594, 6594},
+{0, 0x55, 0xA, 1, 1, 6595, 6595},
+{0, 0x55, 0xA, 1, 1, 6596, 6596},
+{0, 0x55, 0xA, 1, 1, 6597, 6597},
+{0, 0x55, 0xA, 1, 1, 6598, 6598},
+{0, 0x55, 0xA, 1, 1, 6599, 6599},
+{0, 0x55, 0xA, 1, 1, 6600, 6600},
+{0, 0x55, 0xA, 1, 1, 2945, 2945},
+{0, 0x55, 0xA, 1, 1, 6601, 6601},
+{0, 0x55, 0xA, 1, 1, 6602, 6602},
+{0, 0x55, 0xA, 1, 1, 6603, 6603},
+{0, 0x55, 0xA, 1, 1, 6604, 6604},
+{0, 0x55, 0xA, 1, 1, 6605, 6605},
+{0, 0x55, 0xA, 1, 1, 6606, 6606},
+{0, 0x55, 0xA, 1, 1, 6607, 6607},
+{0, 0x55, 0xA, 1, 1, 6608, 6608},
+{0, 0x55, 0xA, 1, 1, 6609, 6609},
+{0, 0x55, 0xA, 1, 1, 6610, 6610},
+{0, 0x55, 0xA, 1, 1, 6611, 6611},
+{0, 0x55, 0xA, 1, 1, 2952, 2952},
+{0, 0x55, 0xA, 1, 1, 6612, 6612},
+{0, 0x55, 0xA, 1, 1, 6613, 6613},
+{0, 0x55, 0xA, 1, 1, 6614, 6614},
+{0, 0x55, 0xA, 1, 1, 6615, 6615},
+{0, 0x55, 0xA, 1, 1, 6616, 6616},
+{0, 0x55, 0xA, 1, 1, 6617, 6617},
+{0, 0x55, 0xA, 1, 1, 6618, 6618},
+{0, 0x55, 0xA, 1, 1, 6619, 6619},
+{0, 0x55, 0xA, 1, 1, 6620, 6620},
+{0, 0x55, 0xA, 1, 1, 6621, 6621},
+{0, 0x55, 0xA, 1, 1, 6622, 6622},
+{0, 0x55, 0xA, 1, 1, 6623, 6623},
+{0, 0x55, 0xA, 1, 1, 6624, 6624},
+{0, 0x55, 0xA, 1, 1, 6625, 6625},
+{0, 0x55, 0xA, 1, 1, 6626, 6626},
+{0, 0x55, 0xA, 1, 1, 6627, 6627},
+{0, 0x55, 0xA, 1, 1, 6628, 6628},
+{0, 0x55, 0xA, 1, 1, 6629, 6629},
+{0, 0x55, 0xA, 1, 1, 6630, 6630},
+{0, 0x55, 0xA, 1, 1, 6631, 6631},
+{0, 0x55, 0xA, 1, 1, 6632, 6632},
+{0, 0x55, 0xA, 1, 1, 6633, 6633},
+{0, 0x55, 0xA, 1, 1, 6634, 6634},
+{0, 0x55, 0xA, 1, 1, 6635, 6635},
+{0, 0x55, 0xA, 1, 1, 6636, 6636},
+{0, 0x55, 0xA, 1, 1, 6637, 6637},
+{0, 0x55, 0xA, 1, 1, 6638, 6638},
+{0, 0x55, 0xA, 1, 1, 6639, 6639},
+{0, 0x55, 0xA, 1, 1, 6640, 6640},
+{0, 0x55, 0xA, 1, 1, 6641, 6641},
+{0, 0x55, 0xA, 1, 1, 6642, 6642},
+{0, 0x55, 0xA, 1, 1, 6643, 6643},
+{0, 0x55, 0xA, 1, 1, 6644, 6644},
+{0, 0x55, 0xA, 1, 1, 6645, 6645},
+{0, 0x55, 0xA, 1, 1, 6646, 6646},
+{0, 0x55, 0xA, 1, 1, 6647, 6647},
+{0, 0x55, 0xA, 1, 1, 6648, 6648},
+{0, 0x55, 0xA, 1, 1, 6649, 6649},
+{0, 0x55, 0xA, 1, 1, 6650, 6650},
+{0, 0x55, 0xA, 1, 1, 6651, 6651},
+{0, 0x55, 0xA, 1, 1, 6652, 6652},
+{0, 0x55, 0xA, 1, 1, 6653, 6653},
+{0, 0x55, 0xA, 1, 1, 6654, 6654},
+{0, 0x55, 0xA, 1, 1, 6655, 6655},
+{0, 0x55, 0xA, 1, 1, 6656, 6656},
+{0, 0x55, 0xA, 1, 1, 6657, 6657},
+{0, 0x55, 0xA, 1, 1, 6658, 6658},
+{0, 0x55, 0xA, 1, 1, 6659, 6659},
+{0, 0x55, 0xA, 1, 1, 6660, 6660},
+{0, 0x55, 0xA, 1, 1, 6661, 6661},
+{0, 0x55, 0xA, 1, 1, 6662, 6662},
+{0, 0x55, 0xA, 1, 1, 6663, 6663},
+{0, 0x55, 0xA, 1, 1, 6664, 6664},
+{0, 0x55, 0xA, 1, 1, 6665, 6665},
+{0, 0x55, 0xA, 1, 1, 6666, 6666},
+{0, 0x55, 0xA, 1, 1, 6667, 6667},
+{0, 0x55, 0xA, 1, 1, 6668, 6668},
+{0, 0x55, 0xA, 1, 1, 6669, 6669},
+{0, 0x55, 0xA, 1, 1, 6670, 6670},
+{0, 0x55, 0xA, 1, 1, 6671, 6671},
+{0, 0x55, 0xA, 1, 1, 6672, 6672},
+{0, 0x55, 0xA, 1, 1, 6673, 6673},
+{0, 0x55, 0xA, 1, 1, 3000, 3000},
+{0, 0x55, 0xA, 1, 1, 6674, 6674},
+{0, 0x55, 0xA, 1, 1, 3004, 3004},
+{0, 0x55, 0xA, 1, 1, 6675, 6675},
+{0, 0x55, 0xA, 1, 1, 6676, 6676},
+{0, 0x55, 0xA, 1, 1, 6677, 6677},
+{0, 0x55, 0xA, 1, 1, 6678, 6678},
+{0, 0x55, 0xA, 1, 1, 3009, 3009},
+{0, 0x55, 0xA, 1, 1, 6679, 6679},
+};
+
+const uint32_t unicode_norm_decomp[6680] = {
+0x000020,0x000020,0x000308,0x000061,0x000020,0x000304,0x000032,0x000033,
+0x000020,0x000301,0x0003BC,0x000020,0x000327,0x000031,0x00006F,0x000031,
+0x002044,0x000034,0x000031,0x002044,0x000032,0x000033,0x002044,0x000034,
+0x000041,0x000300,0x000041,0x000301,0x000041,0x000302,0x000041,0x000303,
+0x000041,0x000308,0x000041,0x00030A,0x000043,0x000327,0x000045,0x000300,
+0x000045,0x000301,0x000045,0x000302,0x000045,0x000308,0x000049,0x000300,
+0x000049,0x000301,0x000049,0x000302,0x000049,0x000308,0x00004E,0x000303,
+0x00004F,0x000300,0x00004F,0x000301,0x00004F,0x000302,0x00004F,0x000303,
+0x00004F,0x000308,0x000055,0x000300,0x000055,0x000301,0x000055,0x000302,
+0x000055,0x000308,0x000059,0x000301,0x000061,0x000300,0x000061,0x000301,
+0x000061,0x000302,0x000061,0x000303,0x000061,0x000308,0x000061,0x00030A,
+0x000063,0x000327,0x000065,0x000300,0x000065,0x000301,0x000065,0x000302,
+0x000065,0x000308,0x000069,0x000300,0x000069,0x000301,0x000069,0x000302,
+0x000069,0x000308,0x00006E,0x000303,0x00006F,0x000300,0x00006F,0x000301,
+0x00006F,0x000302,0x00006F,0x000303,0x00006F,0x000308,0x000075,0x000300,
+0x000075,0x000301,0x000075,0x000302,0x000075,0x000308,0x000079,0x000301,
+0x000079,0x000308,0x000041,0x000304,0x000061,0x000304,0x000041,0x000306,
+0x000061,0x000306,0x000041,0x000328,0x000061,0x000328,0x000043,0x000301,
+0x000063,0x000301,0x000043,0x000302,0x000063,0x000302,0x000043,0x000307,
+0x000063,0x000307,0x000043,0x00030C,0x000063,0x00030C,0x000044,0x00030C,
+0x000064,0x00030C,0x000045,0x000304,0x000065,0x000304,0x000045,0x000306,
+0x000065,0x000306,0x000045,0x000307,0x000065,0x000307,0x000045,0x000328,
+0x000065,0x000328,0x000045,0x00030C,0x000065,0x00030C,0x000047,0x000302,
+0x000067,0x000302,0x000047,0x000306,0x000067,0x000306,0x000047,0x000307,
+0x000067,0x000307,0x000047,0x000327,0x000067,0x000327,0x000048,0x000302,
+0x000068,0x000302,0x000049,0x000303,0x000069,0x000303,0x000049,0x000304,
+0x000069,0x000304,0x000049,0x000306,0x000069,0x000306,0x000049,0x000328,
+0x000069,0x000328,0x000049,0x000307,0x000049,0x00004A,0x000069,0x00006A,
+0x00004A,0x000302,0x00006A,0x000302,0x00004B,0x000327,0x00006B,0x000327,
+0x00004C,0x000301,0x00006C,0x000301,0x00004C,0x000327,0x00006C,0x000327,
+0x00004C,0x00030C,0x00006C,0x00030C,0x00004C,0x0000B7,0x00006C,0x0000B7,
+0x00004E,0x000301,0x00006E,0x000301,0x00004E,0x000327,0x00006E,0x000327,
+0x00004E,0x00030C,0x00006E,0x00030C,0x0002BC,0x00006E,0x00004F,0x000304,
+0x00006F,0x000304,0x00004F,0x000306,0x00006F,0x000306,0x00004F,0x00030B,
+0x00006F,0x00030B,0x000052,0x000301,0x000072,0x000301,0x000052,0x000327,
+0x000072,0x000327,0x000052,0x00030C,0x000072,0x00030C,0x000053,0x000301,
+0x000073,0x000301,0x000053,0x000302,0x000073,0x000302,0x000053,0x000327,
+0x000073,0x000327,0x000053,0x00030C,0x000073,0x00030C,0x000054,0x000327,
+0x000074,0x000327,0x000054,0x00030C,0x000074,0x00030C,0x000055,0x000303,
+0x000075,0x000303,0x000055,0x000304,0x000075,0x000304,0x000055,0x000306,
+0x000075,0x000306,0x000055,0x00030A,0x000075,0x00030A,0x000055,0x00030B,
+0x000075,0x00030B,0x000055,0x000328,0x000075,0x000328,0x000057,0x000302,
+0x000077,0x000302,0x000059,0x000302,0x000079,0x000302,0x000059,0x000308,
+0x00005A,0x000301,0x00007A,0x000301,0x00005A,0x000307,0x00007A,0x000307,
+0x00005A,0x00030C,0x00007A,0x00030C,0x000073,0x00004F,0x00031B,0x00006F,
+0x00031B,0x000055,0x00031B,0x000075,0x00031B,0x000044,0x00005A,0x00030C,
+0x000044,0x00007A,0x00030C,0x000064,0x00007A,0x00030C,0x00004C,0x00004A,
+0x00004C,0x00006A,0x00006C,0x00006A,0x00004E,0x00004A,0x00004E,0x00006A,
+0x00006E,0x00006A,0x000041,0x00030C,0x000061,0x00030C,0x000049,0x00030C,
+0x000069,0x00030C,0x00004F,0x00030C,0x00006F,0x00030C,0x000055,0x00030C,
+0x000075,0x00030C,0x000055,0x000308,0x000304,0x000075,0x000308,0x000304,
+0x000055,0x000308,0x000301,0x000075,0x000308,0x000301,0x000055,0x000308,
+0x00030C,0x000075,0x000308,0x00030C,0x000055,0x000308,0x000300,0x000075,
+0x000308,0x000300,0x000041,0x000308,0x000304,0x000061,0x000308,0x000304,
+0x000041,0x000307,0x000304,0x000061,0x000307,0x000304,0x0000C6,0x000304,
+0x0000E6,0x000304,0x000047,0x00030C,0x000067,0x00030C,0x00004B,0x00030C,
+0x00006B,0x00030C,0x00004F,0x000328,0x00006F,0x000328,0x00004F,0x000328,
+0x000304,0x00006F,0x000328,0x000304,0x0001B7,0x00030C,0x000292,0x00030C,
+0x00006A,0x00030C,0x000044,0x00005A,0x000044,0x00007A,0x000064,0x00007A,
+0x000047,0x000301,0x000067,0x000301,0x00004E,0x000300,0x00006E,0x000300,
+0x000041,0x00030A,0x000301,0x000061,0x00030A,0x000301,0x0000C6,0x000301,
+0x0000E6,0x000301,0x0000D8,0x000301,0x0000F8,0x000301,0x000041,0x00030F,
+0x000061,0x00030F,0x000041,0x000311,0x000061,0x000311,0x000045,0x00030F,
+0x000065,0x00030F,0x000045,0x000311,0x000065,0x000311,0x000049,0x00030F,
+0x000069,0x00030F,0x000049,0x000311,0x000069,0x000311,0x00004F,0x00030F,
+0x00006F,0x00030F,0x00004F,0x000311,0x00006F,0x000311,0x000052,0x00030F,
+0x000072,0x00030F,0x000052,0x000311,0x000072,0x000311,0x000055,0x00030F,
+0x000075,0x00030F,0x000055,0x000311,0x000075,0x000311,0x000053,0x000326,
+0x000073,0x000326,0x000054,0x000326,0x000074,0x000326,0x000048,0x00030C,
+0x000068,0x00030C,0x000041,0x000307,0x000061,0x000307,0x000045,0x000327,
+0x000065,0x000327,0x00004F,0x000308,0x000304,0x00006F,0x000308,0x000304,
+0x00004F,0x000303,0x000304,0x00006F,0x000303,0x000304,0x00004F,0x000307,
+0x00006F,0x000307,0x00004F,0x000307,0x000304,0x00006F,0x000307,0x000304,
+0x000059,0x000304,0x000079,0x000304,0x000068,0x000266,0x00006A,0x000072,
+0x000279,0x00027B,0x000281,0x000077,0x000079,0x000020,0x000306,0x000020,
+0x000307,0x000020,0x00030A,0x000020,0x000328,0x000020,0x000303,0x000020,
+0x00030B,0x000263,0x00006C,0x000078,0x000295,0x000300,0x000301,0x000313,
+0x000308,0x000301,0x0002B9,0x000020,0x000345,0x00003B,0x0000A8,0x000301,
+0x000020,0x000308,0x000301,0x000391,0x000301,0x0000B7,0x000395,0x000301,
+0x000397,0x000301,0x000399,0x000301,0x00039F,0x000301,0x0003A5,0x000301,
+0x0003A9,0x000301,0x0003B9,0x000308,0x000301,0x000399,0x000308,0x0003A5,
+0x000308,0x0003B1,0x000301,0x0003B5,0x000301,0x0003B7,0x000301,0x0003B9,
+0x000301,0x0003C5,0x000308,0x000301,0x0003B9,0x000308,0x0003C5,0x000308,
+0x0003BF,0x000301,0x0003C5,0x000301,0x0003C9,0x000301,0x0003B2,0x0003B8,
+0x0003A5,0x0003D2,0x000301,0x0003D2,0x000308,0x0003C6,0x0003C0,0x0003BA,
+0x0003C1,0x0003C2,0x000398,0x0003B5,0x0003A3,0x000415,0x000300,0x000415,
+0x000308,0x000413,0x000301,0x000406,0x000308,0x00041A,0x000301,0x000418,
+0x000300,0x000423,0x000306,0x000418,0x000306,0x000438,0x000306,0x000435,
+0x000300,0x000435,0x000308,0x000433,0x000301,0x000456,0x000308,0x00043A,
+0x000301,0x000438,0x000300,0x000443,0x000306,0x000474,0x00030F,0x000475,
+0x00030F,0x000416,0x000306,0x000436,0x000306,0x000410,0x000306,0x000430,
+0x000306,0x000410,0x000308,0x000430,0x000308,0x000415,0x000306,0x000435,
+0x000306,0x0004D8,0x000308,0x0004D9,0x000308,0x000416,0x000308,0x000436,
+0x000308,0x000417,0x000308,0x000437,0x000308,0x000418,0x000304,0x000438,
+0x000304,0x000418,0x000308,0x000438,0x000308,0x00041E,0x000308,0x00043E,
+0x000308,0x0004E8,0x000308,0x0004E9,0x000308,0x00042D,0x000308,0x00044D,
+0x000308,0x000423,0x000304,0x000443,0x000304,0x000423,0x000308,0x000443,
+0x000308,0x000423,0x00030B,0x000443,0x00030B,0x000427,0x000308,0x000447,
+0x000308,0x00042B,0x000308,0x00044B,0x000308,0x000565,0x000582,0x000627,
+0x000653,0x000627,0x000654,0x000648,0x000654,0x000627,0x000655,0x00064A,
+0x000654,0x000627,0x000674,0x000648,0x000674,0x0006C7,0x000674,0x00064A,
+0x000674,0x0006D5,0x000654,0x0006C1,0x000654,0x0006D2,0x000654,0x000928,
+0x00093C,0x000930,0x00093C,0x000933,0x00093C,0x000915,0x00093C,0x000916,
+0x00093C,0x000917,0x00093C,0x00091C,0x00093C,0x000921,0x00093C,0x000922,
+0x00093C,0x00092B,0x00093C,0x00092F,0x00093C,0x0009C7,0x0009BE,0x0009C7,
+0x0009D7,0x0009A1,0x0009BC,0x0009A2,0x0009BC,0x0009AF,0x0009BC,0x000A32,
+0x000A3C,0x000A38,0x000A3C,0x000A16,0x000A3C,0x000A17,0x000A3C,0x000A1C,
+0x000A3C,0x000A2B,0x000A3C,0x000B47,0x000B56,0x000B47,0x000B3E,0x000B47,
+0x000B57,0x000B21,0x000B3C,0x000B22,0x000B3C,0x000B92,0x000BD7,0x000BC6,
+0x000BBE,0x000BC7,0x000BBE,0x000BC6,0x000BD7,0x000C46,0x000C56,0x000CBF,
+0x000CD5,0x000CC6,0x000CD5,0x000CC6,0x000CD6,0x000CC6,0x000CC2,0x000CC6,
+0x000CC2,0x000CD5,0x000D46,0x000D3E,0x000D47,0x000D3E,0x000D46,0x000D57,
+0x000DD9,0x000DCA,0x000DD9,0x000DCF,0x000DD9,0x000DCF,0x000DCA,0x000DD9,
+0x000DDF,0x000E4D,0x000E32,0x000ECD,0x000EB2,0x000EAB,0x000E99,0x000EAB,
+0x000EA1,0x000F0B,0x000F42,0x000FB7,0x000F4C,0x000FB7,0x000F51,0x000FB7,
+0x000F56,0x000FB7,0x000F5B,0x000FB7,0x000F40,0x000FB5,0x000F71,0x000F72,
+0x000F71,0x000F74,0x000FB2,0x000F80,0x000FB2,0x000F71,0x000F80,0x000FB3,
+0x000F80,0x000FB3,0x000F71,0x000F80,0x000F71,0x000F80,0x000F92,0x000FB7,
+0x000F9C,0x000FB7,0x000FA1,0x000FB7,0x000FA6,0x000FB7,0x000FAB,0x000FB7,
+0x000F90,0x000FB5,0x001025,0x00102E,0x0010DC,0x001B05,0x001B35,0x001B07,
+0x001B35,0x001B09,0x001B35,0x001B0B,0x001B35,0x001B0D,0x001B35,0x001B11,
+0x001B35,0x001B3A,0x001B35,0x001B3C,0x001B35,0x001B3E,0x001B35,0x001B3F,
+0x001B35,0x001B42,0x001B35,0x000041,0x0000C6,0x000042,0x000044,0x000045,
+0x00018E,0x000047,0x000048,0x000049,0x00004A,0x00004B,0x00004C,0x00004D,
+0x00004E,0x00004F,0x000222,0x000050,0x000052,0x000054,0x000055,0x000057,
+0x000250,0x000251,0x001D02,0x000062,0x000064,0x000065,0x000259,0x00025B,
+0x00025C,0x000067,0x00006B,0x00006D,0x00014B,0x000254,0x001D16,0x001D17,
+0x000070,0x000074,0x000075,0x001D1D,0x00026F,0x000076,0x001D25,0x0003B3,
+0x0003B4,0x0003C7,0x000069,0x00043D,0x000252,0x000063,0x000255,0x0000F0,
+0x000066,0x00025F,0x000261,0x000265,0x000268,0x000269,0x00026A,0x001D7B,
+0x00029D,0x00026D,0x001D85,0x00029F,0x000271,0x000270,0x000272,0x000273,
+0x000274,0x000275,0x000278,0x000282,0x000283,0x0001AB,0x000289,0x00028A,
+0x001D1C,0x00028B,0x00028C,0x00007A,0x000290,0x000291,0x000292,0x000041,
+0x000325,0x000061,0x000325,0x000042,0x000307,0x000062,0x000307,0x000042,
+0x000323,0x000062,0x000323,0x000042,0x000331,0x000062,0x000331,0x000043,
+0x000327,0x000301,0x000063,0x000327,0x000301,0x000044,0x000307,0x000064,
+0x000307,0x000044,0x000323,0x000064,0x000323,0x000044,0x000331,0x000064,
+0x000331,0x000044,0x000327,0x000064,0x000327,0x000044,0x00032D,0x000064,
+0x00032D,0x000045,0x000304,0x000300,0x000065,0x000304,0x000300,0x000045,
+0x000304,0x000301,0x000065,0x000304,0x000301,0x000045,0x00032D,0x000065,
+0x00032D,0x000045,0x000330,0x000065,0x000330,0x000045,0x000327,0x000306,
+0x000065,0x000327,0x000306,0x000046,0x000307,0x000066,0x000307,0x000047,
+0x000304,0x000067,0x000304,0x000048,0x000307,0x000068,0x000307,0x000048,
+0x000323,0x000068,0x000323,0x000048,0x000308,0x000068,0x000308,0x000048,
+0x000327,0x000068,0x000327,0x000048,0x00032E,0x000068,0x00032E,0x000049,
+0x000330,0x000069,0x000330,0x000049,0x000308,0x000301,0x000069,0x000308,
+0x000301,0x00004B,0x000301,0x00006B,0x000301,0x00004B,0x000323,0x00006B,
+0x000323,0x00004B,0x000331,0x00006B,0x000331,0x00004C,0x000323,0x00006C,
+0x000323,0x00004C,0x000323,0x000304,0x00006C,0x000323,0x000304,0x00004C,
+0x000331,0x00006C,0x000331,0x00004C,0x00032D,0x00006C,0x00032D,0x00004D,
+0x000301,0x00006D,0x000301,0x00004D,0x000307,0x00006D,0x000307,0x00004D,
+0x000323,0x00006D,0x000323,0x00004E,0x000307,0x00006E,0x000307,0x00004E,
+0x000323,0x00006E,0x000323,0x00004E,0x000331,0x00006E,0x000331,0x00004E,
+0x00032D,0x00006E,0x00032D,0x00004F,0x000303,0x000301,0x00006F,0x000303,
+0x000301,0x00004F,0x000303,0x000308,0x00006F,0x000303,0x000308,0x00004F,
+0x000304,0x000300,0x00006F,0x000304,0x000300,0x00004F,0x000304,0x000301,
+0x00006F,0x000304,0x000301,0x000050,0x000301,0x000070,0x000301,0x000050,
+0x000307,0x000070,0x000307,0x000052,0x000307,0x000072,0x000307,0x000052,
+0x000323,0x000072,0x000323,0x000052,0x000323,0x000304,0x000072,0x000323,
+0x000304,0x000052,0x000331,0x000072,0x000331,0x000053,0x000307,0x000073,
+0x000307,0x000053,0x000323,0x000073,0x000323,0x000053,0x000301,0x000307,
+0x000073,0x000301,0x000307,0x000053,0x00030C,0x000307,0x000073,0x00030C,
+0x000307,0x000053,0x000323,0x000307,0x000073,0x000323,0x000307,0x000054,
+0x000307,0x000074,0x000307,0x000054,0x000323,0x000074,0x000323,0x000054,
+0x000331,0x000074,0x000331,0x000054,0x00032D,0x000074,0x00032D,0x000055,
+0x000324,0x000075,0x000324,0x000055,0x000330,0x000075,0x000330,0x000055,
+0x00032D,0x000075,0x00032D,0x000055,0x000303,0x000301,0x000075,0x000303,
+0x000301,0x000055,0x000304,0x000308,0x000075,0x000304,0x000308,0x000056,
+0x000303,0x000076,0x000303,0x000056,0x000323,0x000076,0x000323,0x000057,
+0x000300,0x000077,0x000300,0x000057,0x000301,0x000077,0x000301,0x000057,
+0x000308,0x000077,0x000308,0x000057,0x000307,0x000077,0x000307,0x000057,
+0x000323,0x000077,0x000323,0x000058,0x000307,0x000078,0x000307,0x000058,
+0x000308,0x000078,0x000308,0x000059,0x000307,0x000079,0x000307,0x00005A,
+0x000302,0x00007A,0x000302,0x00005A,0x000323,0x00007A,0x000323,0x00005A,
+0x000331,0x00007A,0x000331,0x000068,0x000331,0x000074,0x000308,0x000077,
+0x00030A,0x000079,0x00030A,0x000061,0x0002BE,0x00017F,0x000307,0x000041,
+0x000323,0x000061,0x000323,0x000041,0x000309,0x000061,0x000309,0x000041,
+0x000302,0x000301,0x000061,0x000302,0x000301,0x000041,0x000302,0x000300,
+0x000061,0x000302,0x000300,0x000041,0x000302,0x000309,0x000061,0x000302,
+0x000309,0x000041,0x000302,0x000303,0x000061,0x000302,0x000303,0x000041,
+0x000323,0x000302,0x000061,0x000323,0x000302,0x000041,0x000306,0x000301,
+0x000061,0x000306,0x000301,0x000041,0x000306,0x000300,0x000061,0x000306,
+0x000300,0x000041,0x000306,0x000309,0x000061,0x000306,0x000309,0x000041,
+0x000306,0x000303,0x000061,0x000306,0x000303,0x000041,0x000323,0x000306,
+0x000061,0x000323,0x000306,0x000045,0x000323,0x000065,0x000323,0x000045,
+0x000309,0x000065,0x000309,0x000045,0x000303,0x000065,0x000303,0x000045,
+0x000302,0x000301,0x000065,0x000302,0x000301,0x000045,0x000302,0x000300,
+0x000065,0x000302,0x000300,0x000045,0x000302,0x000309,0x000065,0x000302,
+0x000309,0x000045,0x000302,0x000303,0x000065,0x000302,0x000303,0x000045,
+0x000323,0x000302,0x000065,0x000323,0x000302,0x000049,0x000309,0x000069,
+0x000309,0x000049,0x000323,0x000069,0x000323,0x00004F,0x000323,0x00006F,
+0x000323,0x00004F,0x000309,0x00006F,0x000309,0x00004F,0x000302,0x000301,
+0x00006F,0x000302,0x000301,0x00004F,0x000302,0x000300,0x00006F,0x000302,
+0x000300,0x00004F,0x000302,0x000309,0x00006F,0x000302,0x000309,0x00004F,
+0x000302,0x000303,0x00006F,0x000302,0x000303,0x00004F,0x000323,0x000302,
+0x00006F,0x000323,0x000302,0x00004F,0x00031B,0x000301,0x00006F,0x00031B,
+0x000301,0x00004F,0x00031B,0x000300,0x00006F,0x00031B,0x000300,0x00004F,
+0x00031B,0x000309,0x00006F,0x00031B,0x000309,0x00004F,0x00031B,0x000303,
+0x00006F,0x00031B,0x000303,0x00004F,0x00031B,0x000323,0x00006F,0x00031B,
+0x000323,0x000055,0x000323,0x000075,0x000323,0x000055,0x000309,0x000075,
+0x000309,0x000055,0x00031B,0x000301,0x000075,0x00031B,0x000301,0x000055,
+0x00031B,0x000300,0x000075,0x00031B,0x000300,0x000055,0x00031B,0x000309,
+0x000075,0x00031B,0x000309,0x000055,0x00031B,0x000303,0x000075,0x00031B,
+0x000303,0x000055,0x00031B,0x000323,0x000075,0x00031B,0x000323,0x000059,
+0x000300,0x000079,0x000300,0x000059,0x000323,0x000079,0x000323,0x000059,
+0x000309,0x000079,0x000309,0x000059,0x000303,0x000079,0x000303,0x0003B1,
+0x000313,0x0003B1,0x000314,0x0003B1,0x000313,0x000300,0x0003B1,0x000314,
+0x000300,0x0003B1,0x000313,0x000301,0x0003B1,0x000314,0x000301,0x0003B1,
+0x000313,0x000342,0x0003B1,0x000314,0x000342,0x000391,0x000313,0x000391,
+0x000314,0x000391,0x000313,0x000300,0x000391,0x000314,0x000300,0x000391,
+0x000313,0x000301,0x000391,0x000314,0x000301,0x000391,0x000313,0x000342,
+0x000391,0x000314,0x000342,0x0003B5,0x000313,0x0003B5,0x000314,0x0003B5,
+0x000313,0x000300,0x0003B5,0x000314,0x000300,0x0003B5,0x000313,0x000301,
+0x0003B5,0x000314,0x000301,0x000395,0x000313,0x000395,0x000314,0x000395,
+0x000313,0x000300,0x000395,0x000314,0x000300,0x000395,0x000313,0x000301,
+0x000395,0x000314,0x000301,0x0003B7,0x000313,0x0003B7,0x000314,0x0003B7,
+0x000313,0x000300,0x0003B7,0x000314,0x000300,0x0003B7,0x000313,0x000301,
+0x0003B7,0x000314,0x000301,0x0003B7,0x000313,0x000342,0x0003B7,0x000314,
+0x000342,0x000397,0x000313,0x000397,0x000314,0x000397,0x000313,0x000300,
+0x000397,0x000314,0x000300,0x000397,0x000313,0x000301,0x000397,0x000314,
+0x000301,0x000397,0x000313,0x000342,0x000397,0x000314,0x000342,0x0003B9,
+0x000313,0x0003B9,0x000314,0x0003B9,0x000313,0x000300,0x0003B9,0x000314,
+0x000300,0x0003B9,0x000313,0x000301,0x0003B9,0x000314,0x000301,0x0003B9,
+0x000313,0x000342,0x0003B9,0x000314,0x000342,0x000399,0x000313,0x000399,
+0x000314,0x000399,0x000313,0x000300,0x000399,0x000314,0x000300,0x000399,
+0x000313,0x000301,0x000399,0x000314,0x000301,0x000399,0x000313,0x000342,
+0x000399,0x000314,0x000342,0x0003BF,0x000313,0x0003BF,0x000314,0x0003BF,
+0x000313,0x000300,0x0003BF,0x000314,0x000300,0x0003BF,0x000313,0x000301,
+0x0003BF,0x000314,0x000301,0x00039F,0x000313,0x00039F,0x000314,0x00039F,
+0x000313,0x000300,0x00039F,0x000314,0x000300,0x00039F,0x000313,0x000301,
+0x00039F,0x000314,0x000301,0x0003C5,0x000313,0x0003C5,0x000314,0x0003C5,
+0x000313,0x000300,0x0003C5,0x000314,0x000300,0x0003C5,0x000313,0x000301,
+0x0003C5,0x000314,0x000301,0x0003C5,0x000313,0x000342,0x0003C5,0x000314,
+0x000342,0x0003A5,0x000314,0x0003A5,0x000314,0x000300,0x0003A5,0x000314,
+0x000301,0x0003A5,0x000314,0x000342,0x0003C9,0x000313,0x0003C9,0x000314,
+0x0003C9,0x000313,0x000300,0x0003C9,0x000314,0x000300,0x0003C9,0x000313,
+0x000301,0x0003C9,0x000314,0x000301,0x0003C9,0x000313,0x000342,0x0003C9,
+0x000314,0x000342,0x0003A9,0x000313,0x0003A9,0x000314,0x0003A9,0x000313,
+0x000300,0x0003A9,0x000314,0x000300,0x0003A9,0x000313,0x000301,0x0003A9,
+0x000314,0x000301,0x0003A9,0x000313,0x000342,0x0003A9,0x000314,0x000342,
+0x0003B1,0x000300,0x0003B5,0x000300,0x0003B7,0x000300,0x0003B9,0x000300,
+0x0003BF,0x000300,0x0003C5,0x000300,0x0003C9,0x000300,0x0003B1,0x000313,
+0x000345,0x0003B1,0x000314,0x000345,0x0003B1,0x000313,0x000300,0x000345,
+0x0003B1,0x000314,0x000300,0x000345,0x0003B1,0x000313,0x000301,0x000345,
+0x0003B1,0x000314,0x000301,0x000345,0x0003B1,0x000313,0x000342,0x000345,
+0x0003B1,0x000314,0x000342,0x000345,0x000391,0x000313,0x000345,0x000391,
+0x000314,0x000345,0x000391,0x000313,0x000300,0x000345,0x000391,0x000314,
+0x000300,0x000345,0x000391,0x000313,0x000301,0x000345,0x000391,0x000314,
+0x000301,0x000345,0x000391,0x000313,0x000342,0x000345,0x000391,0x000314,
+0x000342,0x000345,0x0003B7,0x000313,0x000345,0x0003B7,0x000314,0x000345,
+0x0003B7,0x000313,0x000300,0x000345,0x0003B7,0x000314,0x000300,0x000345,
+0x0003B7,0x000313,0x000301,0x000345,0x0003B7,0x000314,0x000301,0x000345,
+0x0003B7,0x000313,0x000342,0x000345,0x0003B7,0x000314,0x000342,0x000345,
+0x000397,0x000313,0x000345,0x000397,0x000314,0x000345,0x000397,0x000313,
+0x000300,0x000345,0x000397,0x000314,0x000300,0x000345,0x000397,0x000313,
+0x000301,0x000345,0x000397,0x000314,0x000301,0x000345,0x000397,0x000313,
+0x000342,0x000345,0x000397,0x000314,0x000342,0x000345,0x0003C9,0x000313,
+0x000345,0x0003C9,0x000314,0x000345,0x0003C9,0x000313,0x000300,0x000345,
+0x0003C9,0x000314,0x000300,0x000345,0x0003C9,0x000313,0x000301,0x000345,
+0x0003C9,0x000314,0x000301,0x000345,0x0003C9,0x000313,0x000342,0x000345,
+0x0003C9,0x000314,0x000342,0x000345,0x0003A9,0x000313,0x000345,0x0003A9,
+0x000314,0x000345,0x0003A9,0x000313,0x000300,0x000345,0x0003A9,0x000314,
+0x000300,0x000345,0x0003A9,0x000313,0x000301,0x000345,0x0003A9,0x000314,
+0x000301,0x000345,0x0003A9,0x000313,0x000342,0x000345,0x0003A9,0x000314,
+0x000342,0x000345,0x0003B1,0x000306,0x0003B1,0x000304,0x0003B1,0x000300,
+0x000345,0x0003B1,0x000345,0x0003B1,0x000301,0x000345,0x0003B1,0x000342,
+0x0003B1,0x000342,0x000345,0x000391,0x000306,0x000391,0x000304,0x000391,
+0x000300,0x000391,0x000345,0x000020,0x000313,0x0003B9,0x000020,0x000342,
+0x0000A8,0x000342,0x000020,0x000308,0x000342,0x0003B7,0x000300,0x000345,
+0x0003B7,0x000345,0x0003B7,0x000301,0x000345,0x0003B7,0x000342,0x0003B7,
+0x000342,0x000345,0x000395,0x000300,0x000397,0x000300,0x000397,0x000345,
+0x001FBF,0x000300,0x000020,0x000313,0x000300,0x001FBF,0x000301,0x000020,
+0x000313,0x000301,0x001FBF,0x000342,0x000020,0x000313,0x000342,0x0003B9,
+0x000306,0x0003B9,0x000304,0x0003B9,0x000308,0x000300,0x0003B9,0x000342,
+0x0003B9,0x000308,0x000342,0x000399,0x000306,0x000399,0x000304,0x000399,
+0x000300,0x001FFE,0x000300,0x000020,0x000314,0x000300,0x001FFE,0x000301,
+0x000020,0x000314,0x000301,0x001FFE,0x000342,0x000020,0x000314,0x000342,
+0x0003C5,0x000306,0x0003C5,0x000304,0x0003C5,0x000308,0x000300,0x0003C1,
+0x000313,0x0003C1,0x000314,0x0003C5,0x000342,0x0003C5,0x000308,0x000342,
+0x0003A5,0x000306,0x0003A5,0x000304,0x0003A5,0x000300,0x0003A1,0x000314,
+0x0000A8,0x000300,0x000020,0x000308,0x000300,0x000060,0x0003C9,0x000300,
+0x000345,0x0003C9,0x000345,0x0003C9,0x000301,0x000345,0x0003C9,0x000342,
+0x0003C9,0x000342,0x000345,0x00039F,0x000300,0x0003A9,0x000300,0x0003A9,
+0x000345,0x0000B4,0x000020,0x000314,0x002002,0x002003,0x002010,0x000020,
+0x000333,0x00002E,0x00002E,0x00002E,0x00002E,0x00002E,0x00002E,0x002032,
+0x002032,0x002032,0x002032,0x002032,0x002035,0x002035,0x002035,0x002035,
+0x002035,0x000021,0x000021,0x000020,0x000305,0x00003F,0x00003F,0x00003F,
+0x000021,0x000021,0x00003F,0x002032,0x002032,0x002032,0x002032,0x000030,
+0x000034,0x000035,0x000036,0x000037,0x000038,0x000039,0x00002B,0x002212,
+0x00003D,0x000028,0x000029,0x00006E,0x000052,0x000073,0x000061,0x00002F,
+0x000063,0x000061,0x00002F,0x000073,0x000043,0x0000B0,0x000043,0x000063,
+0x00002F,0x00006F,0x000063,0x00002F,0x000075,0x000190,0x0000B0,0x000046,
+0x000127,0x00004E,0x00006F,0x000051,0x000053,0x00004D,0x000054,0x000045,
+0x00004C,0x000054,0x00004D,0x00005A,0x0003A9,0x000046,0x0005D0,0x0005D1,
+0x0005D2,0x0005D3,0x000046,0x000041,0x000058,0x000393,0x0003A0,0x002211,
+0x000031,0x002044,0x000037,0x000031,0x002044,0x000039,0x000031,0x002044,
+0x000031,0x000030,0x000031,0x002044,0x000033,0x000032,0x002044,0x000033,
+0x000031,0x002044,0x000035,0x000032,0x002044,0x000035,0x000033,0x002044,
+0x000035,0x000034,0x002044,0x000035,0x000031,0x002044,0x000036,0x000035,
+0x002044,0x000036,0x000031,0x002044,0x000038,0x000033,0x002044,0x000038,
+0x000035,0x002044,0x000038,0x000037,0x002044,0x000038,0x000031,0x002044,
+0x000049,0x000049,0x000049,0x000049,0x000049,0x000049,0x000056,0x000056,
+0x000056,0x000049,0x000056,0x000049,0x000049,0x000056,0x000049,0x000049,
+0x000049,0x000049,0x000058,0x000058,0x000058,0x000049,0x000058,0x000049,
+0x000049,0x000069,0x000069,0x000069,0x000069,0x000069,0x000069,0x000076,
+0x000076,0x000069,0x000076,0x000069,0x000069,0x000076,0x000069,0x000069,
+0x000069,0x000069,0x000078,0x000078,0x000069,0x000078,0x000069,0x000069,
+0x000030,0x002044,0x000033,0x002190,0x000338,0x002192,0x000338,0x002194,
+0x000338,0x0021D0,0x000338,0x0021D4,0x000338,0x0021D2,0x000338,0x002203,
+0x000338,0x002208,0x000338,0x00220B,0x000338,0x002223,0x000338,0x002225,
+0x000338,0x00222B,0x00222B,0x00222B,0x00222B,0x00222B,0x00222E,0x00222E,
+0x00222E,0x00222E,0x00222E,0x00223C,0x000338,0x002243,0x000338,0x002245,
+0x000338,0x002248,0x000338,0x00003D,0x000338,0x002261,0x000338,0x00224D,
+0x000338,0x00003C,0x000338,0x00003E,0x000338,0x002264,0x000338,0x002265,
+0x000338,0x002272,0x000338,0x002273,0x000338,0x002276,0x000338,0x002277,
+0x000338,0x00227A,0x000338,0x00227B,0x000338,0x002282,0x000338,0x002283,
+0x000338,0x002286,0x000338,0x002287,0x000338,0x0022A2,0x000338,0x0022A8,
+0x000338,0x0022A9,0x000338,0x0022AB,0x000338,0x00227C,0x000338,0x00227D,
+0x000338,0x002291,0x000338,0x002292,0x000338,0x0022B2,0x000338,0x0022B3,
+0x000338,0x0022B4,0x000338,0x0022B5,0x000338,0x003008,0x003009,0x000031,
+0x000030,0x000031,0x000031,0x000031,0x000032,0x000031,0x000033,0x000031,
+0x000034,0x000031,0x000035,0x000031,0x000036,0x000031,0x000037,0x000031,
+0x000038,0x000031,0x000039,0x000032,0x000030,0x000028,0x000031,0x000029,
+0x000028,0x000032,0x000029,0x000028,0x000033,0x000029,0x000028,0x000034,
+0x000029,0x000028,0x000035,0x000029,0x000028,0x000036,0x000029,0x000028,
+0x000037,0x000029,0x000028,0x000038,0x000029,0x000028,0x000039,0x000029,
+0x000028,0x000031,0x000030,0x000029,0x000028,0x000031,0x000031,0x000029,
+0x000028,0x000031,0x000032,0x000029,0x000028,0x000031,0x000033,0x000029,
+0x000028,0x000031,0x000034,0x000029,0x000028,0x000031,0x000035,0x000029,
+0x000028,0x000031,0x000036,0x000029,0x000028,0x000031,0x000037,0x000029,
+0x000028,0x000031,0x000038,0x000029,0x000028,0x000031,0x000039,0x000029,
+0x000028,0x000032,0x000030,0x000029,0x000031,0x00002E,0x000032,0x00002E,
+0x000033,0x00002E,0x000034,0x00002E,0x000035,0x00002E,0x000036,0x00002E,
+0x000037,0x00002E,0x000038,0x00002E,0x000039,0x00002E,0x000031,0x000030,
+0x00002E,0x000031,0x000031,0x00002E,0x000031,0x000032,0x00002E,0x000031,
+0x000033,0x00002E,0x000031,0x000034,0x00002E,0x000031,0x000035,0x00002E,
+0x000031,0x000036,0x00002E,0x000031,0x000037,0x00002E,0x000031,0x000038,
+0x00002E,0x000031,0x000039,0x00002E,0x000032,0x000030,0x00002E,0x000028,
+0x000061,0x000029,0x000028,0x000062,0x000029,0x000028,0x000063,0x000029,
+0x000028,0x000064,0x000029,0x000028,0x000065,0x000029,0x000028,0x000066,
+0x000029,0x000028,0x000067,0x000029,0x000028,0x000068,0x000029,0x000028,
+0x000069,0x000029,0x000028,0x00006A,0x000029,0x000028,0x00006B,0x000029,
+0x000028,0x00006C,0x000029,0x000028,0x00006D,0x000029,0x000028,0x00006E,
+0x000029,0x000028,0x00006F,0x000029,0x000028,0x000070,0x000029,0x000028,
+0x000071,0x000029,0x000028,0x000072,0x000029,0x000028,0x000073,0x000029,
+0x000028,0x000074,0x000029,0x000028,0x000075,0x000029,0x000028,0x000076,
+0x000029,0x000028,0x000077,0x000029,0x000028,0x000078,0x000029,0x000028,
+0x000079,0x000029,0x000028,0x00007A,0x000029,0x000053,0x000059,0x000071,
+0x00222B,0x00222B,0x00222B,0x00222B,0x00003A,0x00003A,0x00003D,0x00003D,
+0x00003D,0x00003D,0x00003D,0x00003D,0x002ADD,0x000338,0x002D61,0x006BCD,
+0x009F9F,0x004E00,0x004E28,0x004E36,0x004E3F,0x004E59,0x004E85,0x004E8C,
+0x004EA0,0x004EBA,0x00513F,0x005165,0x00516B,0x005182,0x005196,0x0051AB,
+0x0051E0,0x0051F5,0x005200,0x00529B,0x0052F9,0x005315,0x00531A,0x005338,
+0x005341,0x00535C,0x005369,0x005382,0x0053B6,0x0053C8,0x0053E3,0x0056D7,
+0x00571F,0x0058EB,0x005902,0x00590A,0x005915,0x005927,0x005973,0x005B50,
+0x005B80,0x005BF8,0x005C0F,0x005C22,0x005C38,0x005C6E,0x005C71,0x005DDB,
+0x005DE5,0x005DF1,0x005DFE,0x005E72,0x005E7A,0x005E7F,0x005EF4,0x005EFE,
+0x005F0B,0x005F13,0x005F50,0x005F61,0x005F73,0x005FC3,0x006208,0x006236,
+0x00624B,0x00652F,0x006534,0x006587,0x006597,0x0065A4,0x0065B9,0x0065E0,
+0x0065E5,0x0066F0,0x006708,0x006728,0x006B20,0x006B62,0x006B79,0x006BB3,
+0x006BCB,0x006BD4,0x006BDB,0x006C0F,0x006C14,0x006C34,0x00706B,0x00722A,
+0x007236,0x00723B,0x00723F,0x007247,0x007259,0x00725B,0x0072AC,0x007384,
+0x007389,0x0074DC,0x0074E6,0x007518,0x00751F,0x007528,0x007530,0x00758B,
+0x007592,0x007676,0x00767D,0x0076AE,0x0076BF,0x0076EE,0x0077DB,0x0077E2,
+0x0077F3,0x00793A,0x0079B8,0x0079BE,0x007A74,0x007ACB,0x007AF9,0x007C73,
+0x007CF8,0x007F36,0x007F51,0x007F8A,0x007FBD,0x008001,0x00800C,0x008012,
+0x008033,0x00807F,0x008089,0x0081E3,0x0081EA,0x0081F3,0x0081FC,0x00820C,
+0x00821B,0x00821F,0x00826E,0x008272,0x008278,0x00864D,0x00866B,0x008840,
+0x00884C,0x008863,0x00897E,0x00898B,0x0089D2,0x008A00,0x008C37,0x008C46,
+0x008C55,0x008C78,0x008C9D,0x008D64,0x008D70,0x008DB3,0x008EAB,0x008ECA,
+0x008F9B,0x008FB0,0x008FB5,0x009091,0x009149,0x0091C6,0x0091CC,0x0091D1,
+0x009577,0x009580,0x00961C,0x0096B6,0x0096B9,0x0096E8,0x009751,0x00975E,
+0x009762,0x009769,0x0097CB,0x0097ED,0x0097F3,0x009801,0x0098A8,0x0098DB,
+0x0098DF,0x009996,0x009999,0x0099AC,0x009AA8,0x009AD8,0x009ADF,0x009B25,
+0x009B2F,0x009B32,0x009B3C,0x009B5A,0x009CE5,0x009E75,0x009E7F,0x009EA5,
+0x009EBB,0x009EC3,0x009ECD,0x009ED1,0x009EF9,0x009EFD,0x009F0E,0x009F13,
+0x009F20,0x009F3B,0x009F4A,0x009F52,0x009F8D,0x009F9C,0x009FA0,0x003012,
+0x005344,0x005345,0x00304B,0x003099,0x00304D,0x003099,0x00304F,0x003099,
+0x003051,0x003099,0x003053,0x003099,0x003055,0x003099,0x003057,0x003099,
+0x003059,0x003099,0x00305B,0x003099,0x00305D,0x003099,0x00305F,0x003099,
+0x003061,0x003099,0x003064,0x003099,0x003066,0x003099,0x003068,0x003099,
+0x00306F,0x003099,0x00306F,0x00309A,0x003072,0x003099,0x003072,0x00309A,
+0x003075,0x003099,0x003075,0x00309A,0x003078,0x003099,0x003078,0x00309A,
+0x00307B,0x003099,0x00307B,0x00309A,0x003046,0x003099,0x000020,0x003099,
+0x000020,0x00309A,0x00309D,0x003099,0x003088,0x00308A,0x0030AB,0x003099,
+0x0030AD,0x003099,0x0030AF,0x003099,0x0030B1,0x003099,0x0030B3,0x003099,
+0x0030B5,0x003099,0x0030B7,0x003099,0x0030B9,0x003099,0x0030BB,0x003099,
+0x0030BD,0x003099,0x0030BF,0x003099,0x0030C1,0x003099,0x0030C4,0x003099,
+0x0030C6,0x003099,0x0030C8,0x003099,0x0030CF,0x003099,0x0030CF,0x00309A,
+0x0030D2,0x003099,0x0030D2,0x00309A,0x0030D5,0x003099,0x0030D5,0x00309A,
+0x0030D8,0x003099,0x0030D8,0x00309A,0x0030DB,0x003099,0x0030DB,0x00309A,
+0x0030A6,0x003099,0x0030EF,0x003099,0x0030F0,0x003099,0x0030F1,0x003099,
+0x0030F2,0x003099,0x0030FD,0x003099,0x0030B3,0x0030C8,0x001100,0x001101,
+0x0011AA,0x001102,0x0011AC,0x0011AD,0x001103,0x001104,0x001105,0x0011B0,
+0x0011B1,0x0011B2,0x0011B3,0x0011B4,0x0011B5,0x00111A,0x001106,0x001107,
+0x001108,0x001121,0x001109,0x00110A,0x00110B,0x00110C,0x00110D,0x00110E,
+0x00110F,0x001110,0x001111,0x001112,0x001161,0x001162,0x001163,0x001164,
+0x001165,0x001166,0x001167,0x001168,0x001169,0x00116A,0x00116B,0x00116C,
+0x00116D,0x00116E,0x00116F,0x001170,0x001171,0x001172,0x001173,0x001174,
+0x001175,0x001160,0x001114,0x001115,0x0011C7,0x0011C8,0x0011CC,0x0011CE,
+0x0011D3,0x0011D7,0x0011D9,0x00111C,0x0011DD,0x0011DF,0x00111D,0x00111E,
+0x001120,0x001122,0x001123,0x001127,0x001129,0x00112B,0x00112C,0x00112D,
+0x00112E,0x00112F,0x001132,0x001136,0x001140,0x001147,0x00114C,0x0011F1,
+0x0011F2,0x001157,0x001158,0x001159,0x001184,0x001185,0x001188,0x001191,
+0x001192,0x001194,0x00119E,0x0011A1,0x004E09,0x0056DB,0x004E0A,0x004E2D,
+0x004E0B,0x007532,0x004E19,0x004E01,0x005929,0x005730,0x000028,0x001100,
+0x000029,0x000028,0x001102,0x000029,0x000028,0x001103,0x000029,0x000028,
+0x001105,0x000029,0x000028,0x001106,0x000029,0x000028,0x001107,0x000029,
+0x000028,0x001109,0x000029,0x000028,0x00110B,0x000029,0x000028,0x00110C,
+0x000029,0x000028,0x00110E,0x000029,0x000028,0x00110F,0x000029,0x000028,
+0x001110,0x000029,0x000028,0x001111,0x000029,0x000028,0x001112,0x000029,
+0x000028,0x001100,0x001161,0x000029,0x000028,0x001102,0x001161,0x000029,
+0x000028,0x001103,0x001161,0x000029,0x000028,0x001105,0x001161,0x000029,
+0x000028,0x001106,0x001161,0x000029,0x000028,0x001107,0x001161,0x000029,
+0x000028,0x001109,0x001161,0x000029,0x000028,0x00110B,0x001161,0x000029,
+0x000028,0x00110C,0x001161,0x000029,0x000028,0x00110E,0x001161,0x000029,
+0x000028,0x00110F,0x001161,0x000029,0x000028,0x001110,0x001161,0x000029,
+0x000028,0x001111,0x001161,0x000029,0x000028,0x001112,0x001161,0x000029,
+0x000028,0x00110C,0x00116E,0x000029,0x000028,0x00110B,0x001169,0x00110C,
+0x001165,0x0011AB,0x000029,0x000028,0x00110B,0x001169,0x001112,0x00116E,
+0x000029,0x000028,0x004E00,0x000029,0x000028,0x004E8C,0x000029,0x000028,
+0x004E09,0x000029,0x000028,0x0056DB,0x000029,0x000028,0x004E94,0x000029,
+0x000028,0x00516D,0x000029,0x000028,0x004E03,0x000029,0x000028,0x00516B,
+0x000029,0x000028,0x004E5D,0x000029,0x000028,0x005341,0x000029,0x000028,
+0x006708,0x000029,0x000028,0x00706B,0x000029,0x000028,0x006C34,0x000029,
+0x000028,0x006728,0x000029,0x000028,0x0091D1,0x000029,0x000028,0x00571F,
+0x000029,0x000028,0x0065E5,0x000029,0x000028,0x00682A,0x000029,0x000028,
+0x006709,0x000029,0x000028,0x00793E,0x000029,0x000028,0x00540D,0x000029,
+0x000028,0x007279,0x000029,0x000028,0x008CA1,0x000029,0x000028,0x00795D,
+0x000029,0x000028,0x0052B4,0x000029,0x000028,0x004EE3,0x000029,0x000028,
+0x00547C,0x000029,0x000028,0x005B66,0x000029,0x000028,0x0076E3,0x000029,
+0x000028,0x004F01,0x000029,0x000028,0x008CC7,0x000029,0x000028,0x005354,
+0x000029,0x000028,0x00796D,0x000029,0x000028,0x004F11,0x000029,0x000028,
+0x0081EA,0x000029,0x000028,0x0081F3,0x000029,0x00554F,0x005E7C,0x007B8F,
+0x000050,0x000054,0x000045,0x000032,0x000031,0x000032,0x000032,0x000032,
+0x000033,0x000032,0x000034,0x000032,0x000035,0x000032,0x000036,0x000032,
+0x000037,0x000032,0x000038,0x000032,0x000039,0x000033,0x000030,0x000033,
+0x000031,0x000033,0x000032,0x000033,0x000033,0x000033,0x000034,0x000033,
+0x000035,0x001100,0x001161,0x001102,0x001161,0x001103,0x001161,0x001105,
+0x001161,0x001106,0x001161,0x001107,0x001161,0x001109,0x001161,0x00110B,
+0x001161,0x00110C,0x001161,0x00110E,0x001161,0x00110F,0x001161,0x001110,
+0x001161,0x001111,0x001161,0x001112,0x001161,0x00110E,0x001161,0x0011B7,
+0x001100,0x001169,0x00110C,0x00116E,0x00110B,0x001174,0x00110B,0x00116E,
+0x004E94,0x00516D,0x004E03,0x004E5D,0x00682A,0x006709,0x00793E,0x00540D,
+0x007279,0x008CA1,0x00795D,0x0052B4,0x0079D8,0x007537,0x009069,0x00512A,
+0x005370,0x006CE8,0x009805,0x004F11,0x005199,0x006B63,0x005DE6,0x0053F3,
+0x00533B,0x005B97,0x005B66,0x0076E3,0x004F01,0x008CC7,0x005354,0x00591C,
+0x000033,0x000036,0x000033,0x000037,0x000033,0x000038,0x000033,0x000039,
+0x000034,0x000030,0x000034,0x000031,0x000034,0x000032,0x000034,0x000033,
+0x000034,0x000034,0x000034,0x000035,0x000034,0x000036,0x000034,0x000037,
+0x000034,0x000038,0x000034,0x000039,0x000035,0x000030,0x000031,0x006708,
+0x000032,0x006708,0x000033,0x006708,0x000034,0x006708,0x000035,0x006708,
+0x000036,0x006708,0x000037,0x006708,0x000038,0x006708,0x000039,0x006708,
+0x000031,0x000030,0x006708,0x000031,0x000031,0x006708,0x000031,0x000032,
+0x006708,0x000048,0x000067,0x000065,0x000072,0x000067,0x000065,0x000056,
+0x00004C,0x000054,0x000044,0x0030A2,0x0030A4,0x0030A6,0x0030A8,0x0030AA,
+0x0030AB,0x0030AD,0x0030AF,0x0030B1,0x0030B3,0x0030B5,0x0030B7,0x0030B9,
+0x0030BB,0x0030BD,0x0030BF,0x0030C1,0x0030C4,0x0030C6,0x0030C8,0x0030CA,
+0x0030CB,0x0030CC,0x0030CD,0x0030CE,0x0030CF,0x0030D2,0x0030D5,0x0030D8,
+0x0030DB,0x0030DE,0x0030DF,0x0030E0,0x0030E1,0x0030E2,0x0030E4,0x0030E6,
+0x0030E8,0x0030E9,0x0030EA,0x0030EB,0x0030EC,0x0030ED,0x0030EF,0x0030F0,
+0x0030F1,0x0030F2,0x004EE4,0x00548C,0x0030A2,0x0030CF,0x00309A,0x0030FC,
+0x0030C8,0x0030A2,0x0030EB,0x0030D5,0x0030A1,0x0030A2,0x0030F3,0x0030D8,
+0x00309A,0x0030A2,0x0030A2,0x0030FC,0x0030EB,0x0030A4,0x0030CB,0x0030F3,
+0x0030AF,0x003099,0x0030A4,0x0030F3,0x0030C1,0x0030A6,0x0030A9,0x0030F3,
+0x0030A8,0x0030B9,0x0030AF,0x0030FC,0x0030C8,0x003099,0x0030A8,0x0030FC,
+0x0030AB,0x0030FC,0x0030AA,0x0030F3,0x0030B9,0x0030AA,0x0030FC,0x0030E0,
+0x0030AB,0x0030A4,0x0030EA,0x0030AB,0x0030E9,0x0030C3,0x0030C8,0x0030AB,
+0x0030ED,0x0030EA,0x0030FC,0x0030AB,0x003099,0x0030ED,0x0030F3,0x0030AB,
+0x003099,0x0030F3,0x0030DE,0x0030AD,0x003099,0x0030AB,0x003099,0x0030AD,
+0x003099,0x0030CB,0x0030FC,0x0030AD,0x0030E5,0x0030EA,0x0030FC,0x0030AD,
+0x003099,0x0030EB,0x0030BF,0x003099,0x0030FC,0x0030AD,0x0030ED,0x0030AD,
+0x0030ED,0x0030AF,0x003099,0x0030E9,0x0030E0,0x0030AD,0x0030ED,0x0030E1,
+0x0030FC,0x0030C8,0x0030EB,0x0030AD,0x0030ED,0x0030EF,0x0030C3,0x0030C8,
+0x0030AF,0x003099,0x0030E9,0x0030E0,0x0030AF,0x003099,0x0030E9,0x0030E0,
+0x0030C8,0x0030F3,0x0030AF,0x0030EB,0x0030BB,0x003099,0x0030A4,0x0030ED,
+0x0030AF,0x0030ED,0x0030FC,0x0030CD,0x0030B1,0x0030FC,0x0030B9,0x0030B3,
+0x0030EB,0x0030CA,0x0030B3,0x0030FC,0x0030DB,0x00309A,0x0030B5,0x0030A4,
+0x0030AF,0x0030EB,0x0030B5,0x0030F3,0x0030C1,0x0030FC,0x0030E0,0x0030B7,
+0x0030EA,0x0030F3,0x0030AF,0x003099,0x0030BB,0x0030F3,0x0030C1,0x0030BB,
+0x0030F3,0x0030C8,0x0030BF,0x003099,0x0030FC,0x0030B9,0x0030C6,0x003099,
+0x0030B7,0x0030C8,0x003099,0x0030EB,0x0030C8,0x0030F3,0x0030CA,0x0030CE,
+0x0030CE,0x0030C3,0x0030C8,0x0030CF,0x0030A4,0x0030C4,0x0030CF,0x00309A,
+0x0030FC,0x0030BB,0x0030F3,0x0030C8,0x0030CF,0x00309A,0x0030FC,0x0030C4,
+0x0030CF,0x003099,0x0030FC,0x0030EC,0x0030EB,0x0030D2,0x00309A,0x0030A2,
+0x0030B9,0x0030C8,0x0030EB,0x0030D2,0x00309A,0x0030AF,0x0030EB,0x0030D2,
+0x00309A,0x0030B3,0x0030D2,0x003099,0x0030EB,0x0030D5,0x0030A1,0x0030E9,
+0x0030C3,0x0030C8,0x003099,0x0030D5,0x0030A3,0x0030FC,0x0030C8,0x0030D5,
+0x003099,0x0030C3,0x0030B7,0x0030A7,0x0030EB,0x0030D5,0x0030E9,0x0030F3,
+0x0030D8,0x0030AF,0x0030BF,0x0030FC,0x0030EB,0x0030D8,0x00309A,0x0030BD,
+0x0030D8,0x00309A,0x0030CB,0x0030D2,0x0030D8,0x0030EB,0x0030C4,0x0030D8,
+0x00309A,0x0030F3,0x0030B9,0x0030D8,0x00309A,0x0030FC,0x0030B7,0x003099,
+0x0030D8,0x003099,0x0030FC,0x0030BF,0x0030DB,0x00309A,0x0030A4,0x0030F3,
+0x0030C8,0x0030DB,0x003099,0x0030EB,0x0030C8,0x0030DB,0x0030F3,0x0030DB,
+0x00309A,0x0030F3,0x0030C8,0x003099,0x0030DB,0x0030FC,0x0030EB,0x0030DB,
+0x0030FC,0x0030F3,0x0030DE,0x0030A4,0x0030AF,0x0030ED,0x0030DE,0x0030A4,
+0x0030EB,0x0030DE,0x0030C3,0x0030CF,0x0030DE,0x0030EB,0x0030AF,0x0030DE,
+0x0030F3,0x0030B7,0x0030E7,0x0030F3,0x0030DF,0x0030AF,0x0030ED,0x0030F3,
+0x0030DF,0x0030EA,0x0030DF,0x0030EA,0x0030CF,0x003099,0x0030FC,0x0030EB,
+0x0030E1,0x0030AB,0x003099,0x0030E1,0x0030AB,0x003099,0x0030C8,0x0030F3,
+0x0030E1,0x0030FC,0x0030C8,0x0030EB,0x0030E4,0x0030FC,0x0030C8,0x003099,
+0x0030E4,0x0030FC,0x0030EB,0x0030E6,0x0030A2,0x0030F3,0x0030EA,0x0030C3,
+0x0030C8,0x0030EB,0x0030EA,0x0030E9,0x0030EB,0x0030D2,0x00309A,0x0030FC,
+0x0030EB,0x0030FC,0x0030D5,0x003099,0x0030EB,0x0030EC,0x0030E0,0x0030EC,
+0x0030F3,0x0030C8,0x0030B1,0x003099,0x0030F3,0x0030EF,0x0030C3,0x0030C8,
+0x000030,0x0070B9,0x000031,0x0070B9,0x000032,0x0070B9,0x000033,0x0070B9,
+0x000034,0x0070B9,0x000035,0x0070B9,0x000036,0x0070B9,0x000037,0x0070B9,
+0x000038,0x0070B9,0x000039,0x0070B9,0x000031,0x000030,0x0070B9,0x000031,
+0x000031,0x0070B9,0x000031,0x000032,0x0070B9,0x000031,0x000033,0x0070B9,
+0x000031,0x000034,0x0070B9,0x000031,0x000035,0x0070B9,0x000031,0x000036,
+0x0070B9,0x000031,0x000037,0x0070B9,0x000031,0x000038,0x0070B9,0x000031,
+0x000039,0x0070B9,0x000032,0x000030,0x0070B9,0x000032,0x000031,0x0070B9,
+0x000032,0x000032,0x0070B9,0x000032,0x000033,0x0070B9,0x000032,0x000034,
+0x0070B9,0x000068,0x000050,0x000061,0x000064,0x000061,0x000041,0x000055,
+0x000062,0x000061,0x000072,0x00006F,0x000056,0x000070,0x000063,0x000064,
+0x00006D,0x000064,0x00006D,0x000032,0x000064,0x00006D,0x000033,0x000049,
+0x000055,0x005E73,0x006210,0x00662D,0x00548C,0x005927,0x006B63,0x00660E,
+0x006CBB,0x00682A,0x005F0F,0x004F1A,0x00793E,0x000070,0x000041,0x00006E,
+0x000041,0x0003BC,0x000041,0x00006D,0x000041,0x00006B,0x000041,0x00004B,
+0x000042,0x00004D,0x000042,0x000047,0x000042,0x000063,0x000061,0x00006C,
+0x00006B,0x000063,0x000061,0x00006C,0x000070,0x000046,0x00006E,0x000046,
+0x0003BC,0x000046,0x0003BC,0x000067,0x00006D,0x000067,0x00006B,0x000067,
+0x000048,0x00007A,0x00006B,0x000048,0x00007A,0x00004D,0x000048,0x00007A,
+0x000047,0x000048,0x00007A,0x000054,0x000048,0x00007A,0x0003BC,0x00006C,
+0x00006D,0x00006C,0x000064,0x00006C,0x00006B,0x00006C,0x000066,0x00006D,
+0x00006E,0x00006D,0x0003BC,0x00006D,0x00006D,0x00006D,0x000063,0x00006D,
+0x00006B,0x00006D,0x00006D,0x00006D,0x000032,0x000063,0x00006D,0x000032,
+0x00006D,0x000032,0x00006B,0x00006D,0x000032,0x00006D,0x00006D,0x000033,
+0x000063,0x00006D,0x000033,0x00006D,0x000033,0x00006B,0x00006D,0x000033,
+0x00006D,0x002215,0x000073,0x00006D,0x002215,0x000073,0x000032,0x000050,
+0x000061,0x00006B,0x000050,0x000061,0x00004D,0x000050,0x000061,0x000047,
+0x000050,0x000061,0x000072,0x000061,0x000064,0x000072,0x000061,0x000064,
+0x002215,0x000073,0x000072,0x000061,0x000064,0x002215,0x000073,0x000032,
+0x000070,0x000073,0x00006E,0x000073,0x0003BC,0x000073,0x00006D,0x000073,
+0x000070,0x000056,0x00006E,0x000056,0x0003BC,0x000056,0x00006D,0x000056,
+0x00006B,0x000056,0x00004D,0x000056,0x000070,0x000057,0x00006E,0x000057,
+0x0003BC,0x000057,0x00006D,0x000057,0x00006B,0x000057,0x00004D,0x000057,
+0x00006B,0x0003A9,0x00004D,0x0003A9,0x000061,0x00002E,0x00006D,0x00002E,
+0x000042,0x000071,0x000063,0x000063,0x000063,0x000064,0x000043,0x002215,
+0x00006B,0x000067,0x000043,0x00006F,0x00002E,0x000064,0x000042,0x000047,
+0x000079,0x000068,0x000061,0x000048,0x000050,0x000069,0x00006E,0x00004B,
+0x00004B,0x00004B,0x00004D,0x00006B,0x000074,0x00006C,0x00006D,0x00006C,
+0x00006E,0x00006C,0x00006F,0x000067,0x00006C,0x000078,0x00006D,0x000062,
+0x00006D,0x000069,0x00006C,0x00006D,0x00006F,0x00006C,0x000050,0x000048,
+0x000070,0x00002E,0x00006D,0x00002E,0x000050,0x000050,0x00004D,0x000050,
+0x000052,0x000073,0x000072,0x000053,0x000076,0x000057,0x000062,0x000056,
+0x002215,0x00006D,0x000041,0x002215,0x00006D,0x000031,0x0065E5,0x000032,
+0x0065E5,0x000033,0x0065E5,0x000034,0x0065E5,0x000035,0x0065E5,0x000036,
+0x0065E5,0x000037,0x0065E5,0x000038,0x0065E5,0x000039,0x0065E5,0x000031,
+0x000030,0x0065E5,0x000031,0x000031,0x0065E5,0x000031,0x000032,0x0065E5,
+0x000031,0x000033,0x0065E5,0x000031,0x000034,0x0065E5,0x000031,0x000035,
+0x0065E5,0x000031,0x000036,0x0065E5,0x000031,0x000037,0x0065E5,0x000031,
+0x000038,0x0065E5,0x000031,0x000039,0x0065E5,0x000032,0x000030,0x0065E5,
+0x000032,0x000031,0x0065E5,0x000032,0x000032,0x0065E5,0x000032,0x000033,
+0x0065E5,0x000032,0x000034,0x0065E5,0x000032,0x000035,0x0065E5,0x000032,
+0x000036,0x0065E5,0x000032,0x000037,0x0065E5,0x000032,0x000038,0x0065E5,
+0x000032,0x000039,0x0065E5,0x000033,0x000030,0x0065E5,0x000033,0x000031,
+0x0065E5,0x000067,0x000061,0x00006C,0x00044A,0x00044C,0x00A76F,0x000126,
+0x000153,0x00A727,0x00AB37,0x00026B,0x00AB52,0x00028D,0x008C48,0x0066F4,
+0x008CC8,0x006ED1,0x004E32,0x0053E5,0x005951,0x005587,0x005948,0x0061F6,
+0x007669,0x007F85,0x00863F,0x0087BA,0x0088F8,0x00908F,0x006A02,0x006D1B,
+0x0070D9,0x0073DE,0x00843D,0x00916A,0x0099F1,0x004E82,0x005375,0x006B04,
+0x00721B,0x00862D,0x009E1E,0x005D50,0x006FEB,0x0085CD,0x008964,0x0062C9,
+0x0081D8,0x00881F,0x005ECA,0x006717,0x006D6A,0x0072FC,0x0090CE,0x004F86,
+0x0051B7,0x0052DE,0x0064C4,0x006AD3,0x007210,0x0076E7,0x008606,0x00865C,
+0x008DEF,0x009732,0x009B6F,0x009DFA,0x00788C,0x00797F,0x007DA0,0x0083C9,
+0x009304,0x008AD6,0x0058DF,0x005F04,0x007C60,0x00807E,0x007262,0x0078CA,
+0x008CC2,0x0096F7,0x0058D8,0x005C62,0x006A13,0x006DDA,0x006F0F,0x007D2F,
+0x007E37,0x00964B,0x0052D2,0x00808B,0x0051DC,0x0051CC,0x007A1C,0x007DBE,
+0x0083F1,0x009675,0x008B80,0x0062CF,0x008AFE,0x004E39,0x005BE7,0x006012,
+0x007387,0x007570,0x005317,0x0078FB,0x004FBF,0x005FA9,0x004E0D,0x006CCC,
+0x006578,0x007D22,0x0053C3,0x00585E,0x007701,0x008449,0x008AAA,0x006BBA,
+0x006C88,0x0062FE,0x0082E5,0x0063A0,0x007565,0x004EAE,0x005169,0x0051C9,
+0x006881,0x007CE7,0x00826F,0x008AD2,0x0091CF,0x0052F5,0x005442,0x005EEC,
+0x0065C5,0x006FFE,0x00792A,0x0095AD,0x009A6A,0x009E97,0x009ECE,0x0066C6,
+0x006B77,0x008F62,0x005E74,0x006190,0x006200,0x00649A,0x006F23,0x007149,
+0x007489,0x0079CA,0x007DF4,0x00806F,0x008F26,0x0084EE,0x009023,0x00934A,
+0x005217,0x0052A3,0x0054BD,0x0070C8,0x0088C2,0x005EC9,0x005FF5,0x00637B,
+0x006BAE,0x007C3E,0x007375,0x004EE4,0x0056F9,0x005DBA,0x00601C,0x0073B2,
+0x007469,0x007F9A,0x008046,0x009234,0x0096F6,0x009748,0x009818,0x004F8B,
+0x0079AE,0x0091B4,0x0096B8,0x0060E1,0x004E86,0x0050DA,0x005BEE,0x005C3F,
+0x006599,0x0071CE,0x007642,0x0084FC,0x00907C,0x006688,0x00962E,0x005289,
+0x00677B,0x0067F3,0x006D41,0x006E9C,0x007409,0x007559,0x00786B,0x007D10,
+0x00985E,0x00622E,0x009678,0x00502B,0x005D19,0x006DEA,0x008F2A,0x005F8B,
+0x006144,0x006817,0x009686,0x005229,0x00540F,0x005C65,0x006613,0x00674E,
+0x0068A8,0x006CE5,0x007406,0x0075E2,0x007F79,0x0088CF,0x0088E1,0x0096E2,
+0x00533F,0x006EBA,0x00541D,0x0071D0,0x007498,0x0085FA,0x0096A3,0x009C57,
+0x009E9F,0x006797,0x006DCB,0x0081E8,0x007B20,0x007C92,0x0072C0,0x007099,
+0x008B58,0x004EC0,0x008336,0x00523A,0x005207,0x005EA6,0x0062D3,0x007CD6,
+0x005B85,0x006D1E,0x0066B4,0x008F3B,0x00964D,0x005ED3,0x005140,0x0055C0,
+0x00585A,0x006674,0x0051DE,0x00732A,0x0076CA,0x00793C,0x00795E,0x007965,
+0x00798F,0x009756,0x007CBE,0x008612,0x008AF8,0x009038,0x0090FD,0x0098EF,
+0x0098FC,0x009928,0x009DB4,0x0090DE,0x0096B7,0x004FAE,0x0050E7,0x00514D,
+0x0052C9,0x0052E4,0x005351,0x00559D,0x005606,0x005668,0x005840,0x0058A8,
+0x005C64,0x006094,0x006168,0x00618E,0x0061F2,0x00654F,0x0065E2,0x006691,
+0x006885,0x006D77,0x006E1A,0x006F22,0x00716E,0x00722B,0x007422,0x007891,
+0x007949,0x007948,0x007950,0x007956,0x00798D,0x00798E,0x007A40,0x007A81,
+0x007BC0,0x007E09,0x007E41,0x007F72,0x008005,0x0081ED,0x008279,0x008457,
+0x008910,0x008996,0x008B01,0x008B39,0x008CD3,0x008D08,0x008FB6,0x0096E3,
+0x0097FF,0x00983B,0x006075,0x0242EE,0x008218,0x004E26,0x0051B5,0x005168,
+0x004F80,0x005145,0x005180,0x0052C7,0x0052FA,0x005555,0x005599,0x0055E2,
+0x0058B3,0x005944,0x005954,0x005A62,0x005B28,0x005ED2,0x005ED9,0x005F69,
+0x005FAD,0x0060D8,0x00614E,0x006108,0x006160,0x006234,0x0063C4,0x00641C,
+0x006452,0x006556,0x00671B,0x006756,0x006EDB,0x006ECB,0x00701E,0x0077A7,
+0x007235,0x0072AF,0x007471,0x007506,0x00753B,0x00761D,0x00761F,0x0076DB,
+0x0076F4,0x00774A,0x007740,0x0078CC,0x007AB1,0x007C7B,0x007D5B,0x007F3E,
+0x008352,0x0083EF,0x008779,0x008941,0x008986,0x008ABF,0x008ACB,0x008AED,
+0x008B8A,0x008F38,0x009072,0x009199,0x009276,0x00967C,0x0097DB,0x00980B,
+0x009B12,0x02284A,0x022844,0x0233D5,0x003B9D,0x004018,0x004039,0x025249,
+0x025CD0,0x027ED3,0x009F43,0x009F8E,0x000066,0x000066,0x000066,0x000069,
+0x000066,0x00006C,0x000066,0x000066,0x000069,0x000066,0x000066,0x00006C,
+0x000073,0x000074,0x000574,0x000576,0x000574,0x000565,0x000574,0x00056B,
+0x00057E,0x000576,0x000574,0x00056D,0x0005D9,0x0005B4,0x0005F2,0x0005B7,
+0x0005E2,0x0005D4,0x0005DB,0x0005DC,0x0005DD,0x0005E8,0x0005EA,0x0005E9,
+0x0005C1,0x0005E9,0x0005C2,0x0005E9,0x0005BC,0x0005C1,0x0005E9,0x0005BC,
+0x0005C2,0x0005D0,0x0005B7,0x0005D0,0x0005B8,0x0005D0,0x0005BC,0x0005D1,
+0x0005BC,0x0005D2,0x0005BC,0x0005D3,0x0005BC,0x0005D4,0x0005BC,0x0005D5,
+0x0005BC,0x0005D6,0x0005BC,0x0005D8,0x0005BC,0x0005D9,0x0005BC,0x0005DA,
+0x0005BC,0x0005DB,0x0005BC,0x0005DC,0x0005BC,0x0005DE,0x0005BC,0x0005E0,
+0x0005BC,0x0005E1,0x0005BC,0x0005E3,0x0005BC,0x0005E4,0x0005BC,0x0005E6,
+0x0005BC,0x0005E7,0x0005BC,0x0005E8,0x0005BC,0x0005E9,0x0005BC,0x0005EA,
+0x0005BC,0x0005D5,0x0005B9,0x0005D1,0x0005BF,0x0005DB,0x0005BF,0x0005E4,
+0x0005BF,0x0005D0,0x0005DC,0x000671,0x00067B,0x00067E,0x000680,0x00067A,
+0x00067F,0x000679,0x0006A4,0x0006A6,0x000684,0x000683,0x000686,0x000687,
+0x00068D,0x00068C,0x00068E,0x000688,0x000698,0x000691,0x0006A9,0x0006AF,
+0x0006B3,0x0006B1,0x0006BA,0x0006BB,0x0006C1,0x0006BE,0x0006D2,0x0006AD,
+0x0006C7,0x0006C6,0x0006C8,0x0006CB,0x0006C5,0x0006C9,0x0006D0,0x000649,
+0x00064A,0x000654,0x000627,0x00064A,0x000654,0x0006D5,0x00064A,0x000654,
+0x000648,0x00064A,0x000654,0x0006C7,0x00064A,0x000654,0x0006C6,0x00064A,
+0x000654,0x0006C8,0x00064A,0x000654,0x0006D0,0x00064A,0x000654,0x000649,
+0x0006CC,0x00064A,0x000654,0x00062C,0x00064A,0x000654,0x00062D,0x00064A,
+0x000654,0x000645,0x00064A,0x000654,0x00064A,0x000628,0x00062C,0x000628,
+0x00062D,0x000628,0x00062E,0x000628,0x000645,0x000628,0x000649,0x000628,
+0x00064A,0x00062A,0x00062C,0x00062A,0x00062D,0x00062A,0x00062E,0x00062A,
+0x000645,0x00062A,0x000649,0x00062A,0x00064A,0x00062B,0x00062C,0x00062B,
+0x000645,0x00062B,0x000649,0x00062B,0x00064A,0x00062C,0x00062D,0x00062C,
+0x000645,0x00062D,0x00062C,0x00062D,0x000645,0x00062E,0x00062C,0x00062E,
+0x00062D,0x00062E,0x000645,0x000633,0x00062C,0x000633,0x00062D,0x000633,
+0x00062E,0x000633,0x000645,0x000635,0x00062D,0x000635,0x000645,0x000636,
+0x00062C,0x000636,0x00062D,0x000636,0x00062E,0x000636,0x000645,0x000637,
+0x00062D,0x000637,0x000645,0x000638,0x000645,0x000639,0x00062C,0x000639,
+0x000645,0x00063A,0x00062C,0x00063A,0x000645,0x000641,0x00062C,0x000641,
+0x00062D,0x000641,0x00062E,0x000641,0x000645,0x000641,0x000649,0x000641,
+0x00064A,0x000642,0x00062D,0x000642,0x000645,0x000642,0x000649,0x000642,
+0x00064A,0x000643,0x000627,0x000643,0x00062C,0x000643,0x00062D,0x000643,
+0x00062E,0x000643,0x000644,0x000643,0x000645,0x000643,0x000649,0x000643,
+0x00064A,0x000644,0x00062C,0x000644,0x00062D,0x000644,0x00062E,0x000644,
+0x000645,0x000644,0x000649,0x000644,0x00064A,0x000645,0x00062C,0x000645,
+0x00062D,0x000645,0x00062E,0x000645,0x000645,0x000645,0x000649,0x000645,
+0x00064A,0x000646,0x00062C,0x000646,0x00062D,0x000646,0x00062E,0x000646,
+0x000645,0x000646,0x000649,0x000646,0x00064A,0x000647,0x00062C,0x000647,
+0x000645,0x000647,0x000649,0x000647,0x00064A,0x00064A,0x00062C,0x00064A,
+0x00062D,0x00064A,0x00062E,0x00064A,0x000645,0x00064A,0x000649,0x00064A,
+0x00064A,0x000630,0x000670,0x000631,0x000670,0x000649,0x000670,0x000020,
+0x00064C,0x000651,0x000020,0x00064D,0x000651,0x000020,0x00064E,0x000651,
+0x000020,0x00064F,0x000651,0x000020,0x000650,0x000651,0x000020,0x000651,
+0x000670,0x00064A,0x000654,0x000631,0x00064A,0x000654,0x000632,0x00064A,
+0x000654,0x000646,0x000628,0x000631,0x000628,0x000632,0x000628,0x000646,
+0x00062A,0x000631,0x00062A,0x000632,0x00062A,0x000646,0x00062B,0x000631,
+0x00062B,0x000632,0x00062B,0x000646,0x000645,0x000627,0x000646,0x000631,
+0x000646,0x000632,0x000646,0x000646,0x00064A,0x000631,0x00064A,0x000632,
+0x00064A,0x000646,0x00064A,0x000654,0x00062E,0x00064A,0x000654,0x000647,
+0x000628,0x000647,0x00062A,0x000647,0x000635,0x00062E,0x000644,0x000647,
+0x000646,0x000647,0x000647,0x000670,0x00064A,0x000647,0x00062B,0x000647,
+0x000633,0x000647,0x000634,0x000645,0x000634,0x000647,0x000640,0x00064E,
+0x000651,0x000640,0x00064F,0x000651,0x000640,0x000650,0x000651,0x000637,
+0x000649,0x000637,0x00064A,0x000639,0x000649,0x000639,0x00064A,0x00063A,
+0x000649,0x00063A,0x00064A,0x000633,0x000649,0x000633,0x00064A,0x000634,
+0x000649,0x000634,0x00064A,0x00062D,0x000649,0x00062D,0x00064A,0x00062C,
+0x000649,0x00062C,0x00064A,0x00062E,0x000649,0x00062E,0x00064A,0x000635,
+0x000649,0x000635,0x00064A,0x000636,0x000649,0x000636,0x00064A,0x000634,
+0x00062C,0x000634,0x00062D,0x000634,0x00062E,0x000634,0x000631,0x000633,
+0x000631,0x000635,0x000631,0x000636,0x000631,0x000627,0x00064B,0x00062A,
+0x00062C,0x000645,0x00062A,0x00062D,0x00062C,0x00062A,0x00062D,0x000645,
+0x00062A,0x00062E,0x000645,0x00062A,0x000645,0x00062C,0x00062A,0x000645,
+0x00062D,0x00062A,0x000645,0x00062E,0x00062C,0x000645,0x00062D,0x00062D,
+0x000645,0x00064A,0x00062D,0x000645,0x000649,0x000633,0x00062D,0x00062C,
+0x000633,0x00062C,0x00062D,0x000633,0x00062C,0x000649,0x000633,0x000645,
+0x00062D,0x000633,0x000645,0x00062C,0x000633,0x000645,0x000645,0x000635,
+0x00062D,0x00062D,0x000635,0x000645,0x000645,0x000634,0x00062D,0x000645,
+0x000634,0x00062C,0x00064A,0x000634,0x000645,0x00062E,0x000634,0x000645,
+0x000645,0x000636,0x00062D,0x000649,0x000636,0x00062E,0x000645,0x000637,
+0x000645,0x00062D,0x000637,0x000645,0x000645,0x000637,0x000645,0x00064A,
+0x000639,0x00062C,0x000645,0x000639,0x000645,0x000645,0x000639,0x000645,
+0x000649,0x00063A,0x000645,0x000645,0x00063A,0x000645,0x00064A,0x00063A,
+0x000645,0x000649,0x000641,0x00062E,0x000645,0x000642,0x000645,0x00062D,
+0x000642,0x000645,0x000645,0x000644,0x00062D,0x000645,0x000644,0x00062D,
+0x00064A,0x000644,0x00062D,0x000649,0x000644,0x00062C,0x00062C,0x000644,
+0x00062E,0x000645,0x000644,0x000645,0x00062D,0x000645,0x00062D,0x00062C,
+0x000645,0x00062D,0x000645,0x000645,0x00062D,0x00064A,0x000645,0x00062C,
+0x00062D,0x000645,0x00062C,0x000645,0x000645,0x00062E,0x00062C,0x000645,
+0x00062E,0x000645,0x000645,0x00062C,0x00062E,0x000647,0x000645,0x00062C,
+0x000647,0x000645,0x000645,0x000646,0x00062D,0x000645,0x000646,0x00062D,
+0x000649,0x000646,0x00062C,0x000645,0x000646,0x00062C,0x000649,0x000646,
+0x000645,0x00064A,0x000646,0x000645,0x000649,0x00064A,0x000645,0x000645,
+0x000628,0x00062E,0x00064A,0x00062A,0x00062C,0x00064A,0x00062A,0x00062C,
+0x000649,0x00062A,0x00062E,0x00064A,0x00062A,0x00062E,0x000649,0x00062A,
+0x000645,0x00064A,0x00062A,0x000645,0x000649,0x00062C,0x000645,0x00064A,
+0x00062C,0x00062D,0x000649,0x00062C,0x000645,0x000649,0x000633,0x00062E,
+0x000649,0x000635,0x00062D,0x00064A,0x000634,0x00062D,0x00064A,0x000636,
+0x00062D,0x00064A,0x000644,0x00062C,0x00064A,0x000644,0x000645,0x00064A,
+0x00064A,0x00062D,0x00064A,0x00064A,0x00062C,0x00064A,0x00064A,0x000645,
+0x00064A,0x000645,0x000645,0x00064A,0x000642,0x000645,0x00064A,0x000646,
+0x00062D,0x00064A,0x000639,0x000645,0x00064A,0x000643,0x000645,0x00064A,
+0x000646,0x00062C,0x00062D,0x000645,0x00062E,0x00064A,0x000644,0x00062C,
+0x000645,0x000643,0x000645,0x000645,0x00062C,0x00062D,0x00064A,0x00062D,
+0x00062C,0x00064A,0x000645,0x00062C,0x00064A,0x000641,0x000645,0x00064A,
+0x000628,0x00062D,0x00064A,0x000633,0x00062E,0x00064A,0x000646,0x00062C,
+0x00064A,0x000635,0x000644,0x0006D2,0x000642,0x000644,0x0006D2,0x000627,
+0x000644,0x000644,0x000647,0x000627,0x000643,0x000628,0x000631,0x000645,
+0x00062D,0x000645,0x00062F,0x000635,0x000644,0x000639,0x000645,0x000631,
+0x000633,0x000648,0x000644,0x000639,0x000644,0x00064A,0x000647,0x000648,
+0x000633,0x000644,0x000645,0x000635,0x000644,0x000649,0x000635,0x000644,
+0x000649,0x000020,0x000627,0x000644,0x000644,0x000647,0x000020,0x000639,
+0x000644,0x00064A,0x000647,0x000020,0x000648,0x000633,0x000644,0x000645,
+0x00062C,0x000644,0x000020,0x00062C,0x000644,0x000627,0x000644,0x000647,
+0x000631,0x0006CC,0x000627,0x000644,0x00002C,0x003001,0x003002,0x00003A,
+0x000021,0x00003F,0x003016,0x003017,0x002014,0x002013,0x00005F,0x00007B,
+0x00007D,0x003014,0x003015,0x003010,0x003011,0x00300A,0x00300B,0x00300C,
+0x00300D,0x00300E,0x00300F,0x00005B,0x00005D,0x000023,0x000026,0x00002A,
+0x00002D,0x00003C,0x00003E,0x00005C,0x000024,0x000025,0x000040,0x000020,
+0x00064B,0x000640,0x00064B,0x000020,0x00064C,0x000020,0x00064D,0x000020,
+0x00064E,0x000640,0x00064E,0x000020,0x00064F,0x000640,0x00064F,0x000020,
+0x000650,0x000640,0x000650,0x000020,0x000651,0x000640,0x000651,0x000020,
+0x000652,0x000640,0x000652,0x000621,0x000627,0x000628,0x000629,0x00062A,
+0x00062B,0x00062C,0x00062D,0x00062E,0x00062F,0x000630,0x000631,0x000632,
+0x000633,0x000634,0x000635,0x000636,0x000637,0x000638,0x000639,0x00063A,
+0x000641,0x000642,0x000643,0x000644,0x000645,0x000646,0x000647,0x000648,
+0x00064A,0x000644,0x000627,0x000653,0x000644,0x000627,0x000654,0x000644,
+0x000627,0x000655,0x000644,0x000627,0x000022,0x000027,0x00002F,0x00005E,
+0x00007C,0x00007E,0x002985,0x002986,0x0030FB,0x0030A1,0x0030A3,0x0030A5,
+0x0030A7,0x0030A9,0x0030E3,0x0030E5,0x0030E7,0x0030C3,0x0030FC,0x0030F3,
+0x003099,0x00309A,0x0000A2,0x0000A3,0x0000AC,0x0000A6,0x0000A5,0x0020A9,
+0x002502,0x002190,0x002191,0x002192,0x002193,0x0025A0,0x0025CB,0x0002D0,
+0x0002D1,0x0000E6,0x000299,0x000253,0x0002A3,0x00AB66,0x0002A5,0x0002A4,
+0x000256,0x000257,0x001D91,0x000258,0x00025E,0x0002A9,0x000264,0x000262,
+0x000260,0x00029B,0x00029C,0x000267,0x000284,0x0002AA,0x0002AB,0x00026C,
+0x01DF04,0x00A78E,0x00026E,0x01DF05,0x00028E,0x01DF06,0x0000F8,0x000276,
+0x000277,0x00027A,0x01DF08,0x00027D,0x00027E,0x000280,0x0002A8,0x0002A6,
+0x00AB67,0x0002A7,0x000288,0x002C71,0x00028F,0x0002A1,0x0002A2,0x000298,
+0x0001C0,0x0001C1,0x0001C2,0x01DF0A,0x01DF1E,0x011099,0x0110BA,0x01109B,
+0x0110BA,0x0110A5,0x0110BA,0x011131,0x011127,0x011132,0x011127,0x011347,
+0x01133E,0x011347,0x011357,0x0114B9,0x0114BA,0x0114B9,0x0114B0,0x0114B9,
+0x0114BD,0x0115B8,0x0115AF,0x0115B9,0x0115AF,0x011935,0x011930,0x01D157,
+0x01D165,0x01D158,0x01D165,0x01D158,0x01D165,0x01D16E,0x01D158,0x01D165,
+0x01D16F,0x01D158,0x01D165,0x01D170,0x01D158,0x01D165,0x01D171,0x01D158,
+0x01D165,0x01D172,0x01D1B9,0x01D165,0x01D1BA,0x01D165,0x01D1B9,0x01D165,
+0x01D16E,0x01D1BA,0x01D165,0x01D16E,0x01D1B9,0x01D165,0x01D16F,0x01D1BA,
+0x01D165,0x01D16F,0x000131,0x000237,0x000391,0x000392,0x000394,0x000395,
+0x000396,0x000397,0x000399,0x00039A,0x00039B,0x00039C,0x00039D,0x00039E,
+0x00039F,0x0003A1,0x0003A4,0x0003A6,0x0003A7,0x0003A8,0x002207,0x0003B1,
+0x0003B6,0x0003B7,0x0003BB,0x0003BD,0x0003BE,0x0003BF,0x0003C3,0x0003C4,
+0x0003C5,0x0003C8,0x0003C9,0x002202,0x0003DC,0x0003DD,0x00066E,0x0006A1,
+0x00066F,0x000030,0x00002E,0x000030,0x00002C,0x000031,0x00002C,0x000032,
+0x00002C,0x000033,0x00002C,0x000034,0x00002C,0x000035,0x00002C,0x000036,
+0x00002C,0x000037,0x00002C,0x000038,0x00002C,0x000039,0x00002C,0x000028,
+0x000041,0x000029,0x000028,0x000042,0x000029,0x000028,0x000043,0x000029,
+0x000028,0x000044,0x000029,0x000028,0x000045,0x000029,0x000028,0x000046,
+0x000029,0x000028,0x000047,0x000029,0x000028,0x000048,0x000029,0x000028,
+0x000049,0x000029,0x000028,0x00004A,0x000029,0x000028,0x00004B,0x000029,
+0x000028,0x00004C,0x000029,0x000028,0x00004D,0x000029,0x000028,0x00004E,
+0x000029,0x000028,0x00004F,0x000029,0x000028,0x000050,0x000029,0x000028,
+0x000051,0x000029,0x000028,0x000052,0x000029,0x000028,0x000053,0x000029,
+0x000028,0x000054,0x000029,0x000028,0x000055,0x000029,0x000028,0x000056,
+0x000029,0x000028,0x000057,0x000029,0x000028,0x000058,0x000029,0x000028,
+0x000059,0x000029,0x000028,0x00005A,0x000029,0x003014,0x000053,0x003015,
+0x000043,0x000044,0x000057,0x00005A,0x000048,0x000056,0x000053,0x000044,
+0x000053,0x000053,0x000050,0x000050,0x000056,0x000057,0x000043,0x00004D,
+0x000043,0x00004D,0x000044,0x00004D,0x000052,0x000044,0x00004A,0x00307B,
+0x00304B,0x0030B3,0x0030B3,0x005B57,0x0053CC,0x00591A,0x0089E3,0x004EA4,
+0x006620,0x007121,0x00524D,0x005F8C,0x00518D,0x0065B0,0x00521D,0x007D42,
+0x008CA9,0x0058F0,0x005439,0x006F14,0x006295,0x006355,0x00904A,0x006307,
+0x006253,0x007981,0x007A7A,0x005408,0x006E80,0x007533,0x005272,0x0055B6,
+0x00914D,0x003014,0x00672C,0x003015,0x003014,0x004E09,0x003015,0x003014,
+0x004E8C,0x003015,0x003014,0x005B89,0x003015,0x003014,0x0070B9,0x003015,
+0x003014,0x006253,0x003015,0x003014,0x0076D7,0x003015,0x003014,0x0052DD,
+0x003015,0x003014,0x006557,0x003015,0x005F97,0x0053EF,0x004E3D,0x004E38,
+0x004E41,0x020122,0x004F60,0x004FBB,0x005002,0x00507A,0x005099,0x0050CF,
+0x00349E,0x02063A,0x005154,0x005164,0x005177,0x02051C,0x0034B9,0x005167,
+0x02054B,0x005197,0x0051A4,0x004ECC,0x0051AC,0x0291DF,0x005203,0x0034DF,
+0x00523B,0x005246,0x005277,0x003515,0x005305,0x005306,0x005349,0x00535A,
+0x005373,0x00537D,0x00537F,0x020A2C,0x007070,0x0053CA,0x0053DF,0x020B63,
+0x0053EB,0x0053F1,0x005406,0x00549E,0x005438,0x005448,0x005468,0x0054A2,
+0x0054F6,0x005510,0x005553,0x005563,0x005584,0x0055AB,0x0055B3,0x0055C2,
+0x005716,0x005717,0x005651,0x005674,0x0058EE,0x0057CE,0x0057F4,0x00580D,
+0x00578B,0x005832,0x005831,0x0058AC,0x0214E4,0x0058F2,0x0058F7,0x005906,
+0x005922,0x005962,0x0216A8,0x0216EA,0x0059EC,0x005A1B,0x005A27,0x0059D8,
+0x005A66,0x0036EE,0x0036FC,0x005B08,0x005B3E,0x0219C8,0x005BC3,0x005BD8,
+0x005BF3,0x021B18,0x005BFF,0x005C06,0x005F53,0x003781,0x005C60,0x005CC0,
+0x005C8D,0x021DE4,0x005D43,0x021DE6,0x005D6E,0x005D6B,0x005D7C,0x005DE1,
+0x005DE2,0x00382F,0x005DFD,0x005E28,0x005E3D,0x005E69,0x003862,0x022183,
+0x00387C,0x005EB0,0x005EB3,0x005EB6,0x02A392,0x022331,0x008201,0x005F22,
+0x0038C7,0x0232B8,0x0261DA,0x005F62,0x005F6B,0x0038E3,0x005F9A,0x005FCD,
+0x005FD7,0x005FF9,0x006081,0x00393A,0x00391C,0x0226D4,0x0060C7,0x006148,
+0x00614C,0x00617A,0x0061B2,0x0061A4,0x0061AF,0x0061DE,0x006210,0x00621B,
+0x00625D,0x0062B1,0x0062D4,0x006350,0x022B0C,0x00633D,0x0062FC,0x006368,
+0x006383,0x0063E4,0x022BF1,0x006422,0x0063C5,0x0063A9,0x003A2E,0x006469,
+0x00647E,0x00649D,0x006477,0x003A6C,0x00656C,0x02300A,0x0065E3,0x0066F8,
+0x006649,0x003B19,0x003B08,0x003AE4,0x005192,0x005195,0x006700,0x00669C,
+0x0080AD,0x0043D9,0x006721,0x00675E,0x006753,0x0233C3,0x003B49,0x0067FA,
+0x006785,0x006852,0x02346D,0x00688E,0x00681F,0x006914,0x006942,0x0069A3,
+0x0069EA,0x006AA8,0x0236A3,0x006ADB,0x003C18,0x006B21,0x0238A7,0x006B54,
+0x003C4E,0x006B72,0x006B9F,0x006BBB,0x023A8D,0x021D0B,0x023AFA,0x006C4E,
+0x023CBC,0x006CBF,0x006CCD,0x006C67,0x006D16,0x006D3E,0x006D69,0x006D78,
+0x006D85,0x023D1E,0x006D34,0x006E2F,0x006E6E,0x003D33,0x006EC7,0x023ED1,
+0x006DF9,0x006F6E,0x023F5E,0x023F8E,0x006FC6,0x007039,0x00701B,0x003D96,
+0x00704A,0x00707D,0x007077,0x0070AD,0x020525,0x007145,0x024263,0x00719C,
+0x0243AB,0x007228,0x007250,0x024608,0x007280,0x007295,0x024735,0x024814,
+0x00737A,0x00738B,0x003EAC,0x0073A5,0x003EB8,0x007447,0x00745C,0x007485,
+0x0074CA,0x003F1B,0x007524,0x024C36,0x00753E,0x024C92,0x02219F,0x007610,
+0x024FA1,0x024FB8,0x025044,0x003FFC,0x004008,0x0250F3,0x0250F2,0x025119,
+0x025133,0x00771E,0x00771F,0x00778B,0x004046,0x004096,0x02541D,0x00784E,
+0x0040E3,0x025626,0x02569A,0x0256C5,0x0079EB,0x00412F,0x007A4A,0x007A4F,
+0x02597C,0x025AA7,0x007AEE,0x004202,0x025BAB,0x007BC6,0x007BC9,0x004227,
+0x025C80,0x007CD2,0x0042A0,0x007CE8,0x007CE3,0x007D00,0x025F86,0x007D63,
+0x004301,0x007DC7,0x007E02,0x007E45,0x004334,0x026228,0x026247,0x004359,
+0x0262D9,0x007F7A,0x02633E,0x007F95,0x007FFA,0x0264DA,0x026523,0x008060,
+0x0265A8,0x008070,0x02335F,0x0043D5,0x0080B2,0x008103,0x00440B,0x00813E,
+0x005AB5,0x0267A7,0x0267B5,0x023393,0x02339C,0x008204,0x008F9E,0x00446B,
+0x008291,0x00828B,0x00829D,0x0052B3,0x0082B1,0x0082B3,0x0082BD,0x0082E6,
+0x026B3C,0x00831D,0x008363,0x0083AD,0x008323,0x0083BD,0x0083E7,0x008353,
+0x0083CA,0x0083CC,0x0083DC,0x026C36,0x026D6B,0x026CD5,0x00452B,0x0084F1,
+0x0084F3,0x008516,0x0273CA,0x008564,0x026F2C,0x00455D,0x004561,0x026FB1,
+0x0270D2,0x00456B,0x008650,0x008667,0x008669,0x0086A9,0x008688,0x00870E,
+0x0086E2,0x008728,0x00876B,0x008786,0x0045D7,0x0087E1,0x008801,0x0045F9,
+0x008860,0x027667,0x0088D7,0x0088DE,0x004635,0x0088FA,0x0034BB,0x0278AE,
+0x027966,0x0046BE,0x0046C7,0x008AA0,0x027CA8,0x008CAB,0x008CC1,0x008D1B,
+0x008D77,0x027F2F,0x020804,0x008DCB,0x008DBC,0x008DF0,0x0208DE,0x008ED4,
+0x0285D2,0x0285ED,0x009094,0x0090F1,0x009111,0x02872E,0x00911B,0x009238,
+0x0092D7,0x0092D8,0x00927C,0x0093F9,0x009415,0x028BFA,0x00958B,0x004995,
+0x0095B7,0x028D77,0x0049E6,0x0096C3,0x005DB2,0x009723,0x029145,0x02921A,
+0x004A6E,0x004A76,0x0097E0,0x02940A,0x004AB2,0x029496,0x009829,0x0295B6,
+0x0098E2,0x004B33,0x009929,0x0099A7,0x0099C2,0x0099FE,0x004BCE,0x029B30,
+0x009C40,0x009CFD,0x004CCE,0x004CED,0x009D67,0x02A0CE,0x004CF8,0x02A105,
+0x02A20E,0x02A291,0x004D56,0x009EFE,0x009F05,0x009F0F,0x009F16,0x02A600,
+};
+
+const uint32_t unicode_norm_num_composites = 941;
+
+const unicode_norm_composite unicode_norm_composites[941] = {  // (first << 21) | second, composite
+{0x00007800338ULL, 0x00226E},
+{0x00007A00338ULL, 0x002260},
+{0x00007C00338ULL, 0x00226F},
+{0x00008200300ULL, 0x0000C0},
+{0x00008200301ULL, 0x0000C1},
+{0x00008200302ULL, 0x0000C2},
+{0x00008200303ULL, 0x0000C3},
+{0x00008200304ULL, 0x000100},
+{0x00008200306ULL, 0x000102},
+{0x00008200307ULL, 0x000226},
+{0x00008200308ULL, 0x0000C4},
+{0x00008200309ULL, 0x001EA2},
+{0x0000820030AULL, 0x0000C5},
+{0x0000820030CULL, 0x0001CD},
+{0x0000820030FULL, 0x000200},
+{0x00008200311ULL, 0x000202},
+{0x00008200323ULL, 0x001EA0},
+{0x00008200325ULL, 0x001E00},
+{0x00008200328ULL, 0x000104},
+{0x00008400307ULL, 0x001E02},
+{0x00008400323ULL, 0x001E04},
+{0x00008400331ULL, 0x001E06},
+{0x00008600301ULL, 0x000106},
+{0x00008600302ULL, 0x000108},
+{0x00008600307ULL, 0x00010A},
+{0x0000860030CULL, 0x00010C},
+{0x00008600327ULL, 0x0000C7},
+{0x00008800307ULL, 0x001E0A},
+{0x0000880030CULL, 0x00010E},
+{0x00008800323ULL, 0x001E0C},
+{0x00008800327ULL, 0x001E10},
+{0x0000880032DULL, 0x001E12},
+{0x00008800331ULL, 0x001E0E},
+{0x00008A00300ULL, 0x0000C8},
+{0x00008A00301ULL, 0x0000C9},
+{0x00008A00302ULL, 0x0000CA},
+{0x00008A00303ULL, 0x001EBC},
+{0x00008A00304ULL, 0x000112},
+{0x00008A00306ULL, 0x000114},
+{0x00008A00307ULL, 0x000116},
+{0x00008A00308ULL, 0x0000CB},
+{0x00008A00309ULL, 0x001EBA},
+{0x00008A0030CULL, 0x00011A},
+{0x00008A0030FULL, 0x000204},
+{0x00008A00311ULL, 0x000206},
+{0x00008A00323ULL, 0x001EB8},
+{0x00008A00327ULL, 0x000228},
+{0x00008A00328ULL, 0x000118},
+{0x00008A0032DULL, 0x001E18},
+{0x00008A00330ULL, 0x001E1A},
+{0x00008C00307ULL, 0x001E1E},
+{0x00008E00301ULL, 0x0001F4},
+{0x00008E00302ULL, 0x00011C},
+{0x00008E00304ULL, 0x001E20},
+{0x00008E00306ULL, 0x00011E},
+{0x00008E00307ULL, 0x000120},
+{0x00008E0030CULL, 0x0001E6},
+{0x00008E00327ULL, 0x000122},
+{0x00009000302ULL, 0x000124},
+{0x00009000307ULL, 0x001E22},
+{0x00009000308ULL, 0x001E26},
+{0x0000900030CULL, 0x00021E},
+{0x00009000323ULL, 0x001E24},
+{0x00009000327ULL, 0x001E28},
+{0x0000900032EULL, 0x001E2A},
+{0x00009200300ULL, 0x0000CC},
+{0x00009200301ULL, 0x0000CD},
+{0x00009200302ULL, 0x0000CE},
+{0x00009200303ULL, 0x000128},
+{0x00009200304ULL, 0x00012A},
+{0x00009200306ULL, 0x00012C},
+{0x00009200307ULL, 0x000130},
+{0x00009200308ULL, 0x0000CF},
+{0x00009200309ULL, 0x001EC8},
+{0x0000920030CULL, 0x0001CF},
+{0x0000920030FULL, 0x000208},
+{0x00009200311ULL, 0x00020A},
+{0x00009200323ULL, 0x001ECA},
+{0x00009200328ULL, 0x00012E},
+{0x00009200330ULL, 0x001E2C},
+{0x00009400302ULL, 0x000134},
+{0x00009600301ULL, 0x001E30},
+{0x0000960030CULL, 0x0001E8},
+{0x00009600323ULL, 0x001E32},
+{0x00009600327ULL, 0x000136},
+{0x00009600331ULL, 0x001E34},
+{0x00009800301ULL, 0x000139},
+{0x0000980030CULL, 0x00013D},
+{0x00009800323ULL, 0x001E36},
+{0x00009800327ULL, 0x00013B},
+{0x0000980032DULL, 0x001E3C},
+{0x00009800331ULL, 0x001E3A},
+{0x00009A00301ULL, 0x001E3E},
+{0x00009A00307ULL, 0x001E40},
+{0x00009A00323ULL, 0x001E42},
+{0x00009C00300ULL, 0x0001F8},
+{0x00009C00301ULL, 0x000143},
+{0x00009C00303ULL, 0x0000D1},
+{0x00009C00307ULL, 0x001E44},
+{0x00009C0030CULL, 0x000147},
+{0x00009C00323ULL, 0x001E46},
+{0x00009C00327ULL, 0x000145},
+{0x00009C0032DULL, 0x001E4A},
+{0x00009C00331ULL, 0x001E48},
+{0x00009E00300ULL, 0x0000D2},
+{0x00009E00301ULL, 0x0000D3},
+{0x00009E00302ULL, 0x0000D4},
+{0x00009E00303ULL, 0x0000D5},
+{0x00009E00304ULL, 0x00014C},
+{0x00009E00306ULL, 0x00014E},
+{0x00009E00307ULL, 0x00022E},
+{0x00009E00308ULL, 0x0000D6},
+{0x00009E00309ULL, 0x001ECE},
+{0x00009E0030BULL, 0x000150},
+{0x00009E0030CULL, 0x0001D1},
+{0x00009E0030FULL, 0x00020C},
+{0x00009E00311ULL, 0x00020E},
+{0x00009E0031BULL, 0x0001A0},
+{0x00009E00323ULL, 0x001ECC},
+{0x00009E00328ULL, 0x0001EA},
+{0x0000A000301ULL, 0x001E54},
+{0x0000A000307ULL, 0x001E56},
+{0x0000A400301ULL, 0x000154},
+{0x0000A400307ULL, 0x001E58},
+{0x0000A40030CULL, 0x000158},
+{0x0000A40030FULL, 0x000210},
+{0x0000A400311ULL, 0x000212},
+{0x0000A400323ULL, 0x001E5A},
+{0x0000A400327ULL, 0x000156},
+{0x0000A400331ULL, 0x001E5E},
+{0x0000A600301ULL, 0x00015A},
+{0x0000A600302ULL, 0x00015C},
+{0x0000A600307ULL, 0x001E60},
+{0x0000A60030CULL, 0x000160},
+{0x0000A600323ULL, 0x001E62},
+{0x0000A600326ULL, 0x000218},
+{0x0000A600327ULL, 0x00015E},
+{0x0000A800307ULL, 0x001E6A},
+{0x0000A80030CULL, 0x000164},
+{0x0000A800323ULL, 0x001E6C},
+{0x0000A800326ULL, 0x00021A},
+{0x0000A800327ULL, 0x000162},
+{0x0000A80032DULL, 0x001E70},
+{0x0000A800331ULL, 0x001E6E},
+{0x0000AA00300ULL, 0x0000D9},
+{0x0000AA00301ULL, 0x0000DA},
+{0x0000AA00302ULL, 0x0000DB},
+{0x0000AA00303ULL, 0x000168},
+{0x0000AA00304ULL, 0x00016A},
+{0x0000AA00306ULL, 0x00016C},
+{0x0000AA00308ULL, 0x0000DC},
+{0x0000AA00309ULL, 0x001EE6},
+{0x0000AA0030AULL, 0x00016E},
+{0x0000AA0030BULL, 0x000170},
+{0x0000AA0030CULL, 0x0001D3},
+{0x0000AA0030FULL, 0x000214},
+{0x0000AA00311ULL, 0x000216},
+{0x0000AA0031BULL, 0x0001AF},
+{0x0000AA00323ULL, 0x001EE4},
+{0x0000AA00324ULL, 0x001E72},
+{0x0000AA00328ULL, 0x000172},
+{0x0000AA0032DULL, 0x001E76},
+{0x0000AA00330ULL, 0x001E74},
+{0x0000AC00303ULL, 0x001E7C},
+{0x0000AC00323ULL, 0x001E7E},
+{0x0000AE00300ULL, 0x001E80},
+{0x0000AE00301ULL, 0x001E82},
+{0x0000AE00302ULL, 0x000174},
+{0x0000AE00307ULL, 0x001E86},
+{0x0000AE00308ULL, 0x001E84},
+{0x0000AE00323ULL, 0x001E88},
+{0x0000B000307ULL, 0x001E8A},
+{0x0000B000308ULL, 0x001E8C},
+{0x0000B200300ULL, 0x001EF2},
+{0x0000B200301ULL, 0x0000DD},
+{0x0000B200302ULL, 0x000176},
+{0x0000B200303ULL, 0x001EF8},
+{0x0000B200304ULL, 0x000232},
+{0x0000B200307ULL, 0x001E8E},
+{0x0000B200308ULL, 0x000178},
+{0x0000B200309ULL, 0x001EF6},
+{0x0000B200323ULL, 0x001EF4},
+{0x0000B400301ULL, 0x000179},
+{0x0000B400302ULL, 0x001E90},
+{0x0000B400307ULL, 0x00017B},
+{0x0000B40030CULL, 0x00017D},
+{0x0000B400323ULL, 0x001E92},
+{0x0000B400331ULL, 0x001E94},
+{0x0000C200300ULL, 0x0000E0},
+{0x0000C200301ULL, 0x0000E1},
+{0x0000C200302ULL, 0x0000E2},
+{0x0000C200303ULL, 0x0000E3},
+{0x0000C200304ULL, 0x000101},
+{0x0000C200306ULL, 0x000103},
+{0x0000C200307ULL, 0x000227},
+{0x0000C200308ULL, 0x0000E4},
+{0x0000C200309ULL, 0x001EA3},
+{0x0000C20030AULL, 0x0000E5},
+{0x0000C20030CULL, 0x0001CE},
+{0x0000C20030FULL, 0x000201},
+{0x0000C200311ULL, 0x000203},
+{0x0000C200323ULL, 0x001EA1},
+{0x0000C200325ULL, 0x001E01},
+{0x0000C200328ULL, 0x000105},
+{0x0000C400307ULL, 0x001E03},
+{0x0000C400323ULL, 0x001E05},
+{0x0000C400331ULL, 0x001E07},
+{0x0000C600301ULL, 0x000107},
+{0x0000C600302ULL, 0x000109},
+{0x0000C600307ULL, 0x00010B},
+{0x0000C60030CULL, 0x00010D},
+{0x0000C600327ULL, 0x0000E7},
+{0x0000C800307ULL, 0x001E0B},
+{0x0000C80030CULL, 0x00010F},
+{0x0000C800323ULL, 0x001E0D},
+{0x0000C800327ULL, 0x001E11},
+{0x0000C80032DULL, 0x001E13},
+{0x0000C800331ULL, 0x001E0F},
+{0x0000CA00300ULL, 0x0000E8},
+{0x0000CA00301ULL, 0x0000E9},
+{0x0000CA00302ULL, 0x0000EA},
+{0x0000CA00303ULL, 0x001EBD},
+{0x0000CA00304ULL, 0x000113},
+{0x0000CA00306ULL, 0x000115},
+{0x0000CA00307ULL, 0x000117},
+{0x0000CA00308ULL, 0x0000EB},
+{0x0000CA00309ULL, 0x001EBB},
+{0x0000CA0030CULL, 0x00011B},
+{0x0000CA0030FULL, 0x000205},
+{0x0000CA00311ULL, 0x000207},
+{0x0000CA00323ULL, 0x001EB9},
+{0x0000CA00327ULL, 0x000229},
+{0x0000CA00328ULL, 0x000119},
+{0x0000CA0032DULL, 0x001E19},
+{0x0000CA00330ULL, 0x001E1B},
+{0x0000CC00307ULL, 0x001E1F},
+{0x0000CE00301ULL, 0x0001F5},
+{0x0000CE00302ULL, 0x00011D},
+{0x0000CE00304ULL, 0x001E21},
+{0x0000CE00306ULL, 0x00011F},
+{0x0000CE00307ULL, 0x000121},
+{0x0000CE0030CULL, 0x0001E7},
+{0x0000CE00327ULL, 0x000123},
+{0x0000D000302ULL, 0x000125},
+{0x0000D000307ULL, 0x001E23},
+{0x0000D000308ULL, 0x001E27},
+{0x0000D00030CULL, 0x00021F},
+{0x0000D000323ULL, 0x001E25},
+{0x0000D000327ULL, 0x001E29},
+{0x0000D00032EULL, 0x001E2B},
+{0x0000D000331ULL, 0x001E96},
+{0x0000D200300ULL, 0x0000EC},
+{0x0000D200301ULL, 0x0000ED},
+{0x0000D200302ULL, 0x0000EE},
+{0x0000D200303ULL, 0x000129},
+{0x0000D200304ULL, 0x00012B},
+{0x0000D200306ULL, 0x00012D},
+{0x0000D200308ULL, 0x0000EF},
+{0x0000D200309ULL, 0x001EC9},
+{0x0000D20030CULL, 0x0001D0},
+{0x0000D20030FULL, 0x000209},
+{0x0000D200311ULL, 0x00020B},
+{0x0000D200323ULL, 0x001ECB},
+{0x0000D200328ULL, 0x00012F},
+{0x0000D200330ULL, 0x001E2D},
+{0x0000D400302ULL, 0x000135},
+{0x0000D40030CULL, 0x0001F0},
+{0x0000D600301ULL, 0x001E31},
+{0x0000D60030CULL, 0x0001E9},
+{0x0000D600323ULL, 0x001E33},
+{0x0000D600327ULL, 0x000137},
+{0x0000D600331ULL, 0x001E35},
+{0x0000D800301ULL, 0x00013A},
+{0x0000D80030CULL, 0x00013E},
+{0x0000D800323ULL, 0x001E37},
+{0x0000D800327ULL, 0x00013C},
+{0x0000D80032DULL, 0x001E3D},
+{0x0000D800331ULL, 0x001E3B},
+{0x0000DA00301ULL, 0x001E3F},
+{0x0000DA00307ULL, 0x001E41},
+{0x0000DA00323ULL, 0x001E43},
+{0x0000DC00300ULL, 0x0001F9},
+{0x0000DC00301ULL, 0x000144},
+{0x0000DC00303ULL, 0x0000F1},
+{0x0000DC00307ULL, 0x001E45},
+{0x0000DC0030CULL, 0x000148},
+{0x0000DC00323ULL, 0x001E47},
+{0x0000DC00327ULL, 0x000146},
+{0x0000DC0032DULL, 0x001E4B},
+{0x0000DC00331ULL, 0x001E49},
+{0x0000DE00300ULL, 0x0000F2},
+{0x0000DE00301ULL, 0x0000F3},
+{0x0000DE00302ULL, 0x0000F4},
+{0x0000DE00303ULL, 0x0000F5},
+{0x0000DE00304ULL, 0x00014D},
+{0x0000DE00306ULL, 0x00014F},
+{0x0000DE00307ULL, 0x00022F},
+{0x0000DE00308ULL, 0x0000F6},
+{0x0000DE00309ULL, 0x001ECF},
+{0x0000DE0030BULL, 0x000151},
+{0x0000DE0030CULL, 0x0001D2},
+{0x0000DE0030FULL, 0x00020D},
+{0x0000DE00311ULL, 0x00020F},
+{0x0000DE0031BULL, 0x0001A1},
+{0x0000DE00323ULL, 0x001ECD},
+{0x0000DE00328ULL, 0x0001EB},
+{0x0000E000301ULL, 0x001E55},
+{0x0000E000307ULL, 0x001E57},
+{0x0000E400301ULL, 0x000155},
+{0x0000E400307ULL, 0x001E59},
+{0x0000E40030CULL, 0x000159},
+{0x0000E40030FULL, 0x000211},
+{0x0000E400311ULL, 0x000213},
+{0x0000E400323ULL, 0x001E5B},
+{0x0000E400327ULL, 0x000157},
+{0x0000E400331ULL, 0x001E5F},
+{0x0000E600301ULL, 0x00015B},
+{0x0000E600302ULL, 0x00015D},
+{0x0000E600307ULL, 0x001E61},
+{0x0000E60030CULL, 0x000161},
+{0x0000E600323ULL, 0x001E63},
+{0x0000E600326ULL, 0x000219},
+{0x0000E600327ULL, 0x00015F},
+{0x0000E800307ULL, 0x001E6B},
+{0x0000E800308ULL, 0x001E97},
+{0x0000E80030CULL, 0x000165},
+{0x0000E800323ULL, 0x001E6D},
+{0x0000E800326ULL, 0x00021B},
+{0x0000E800327ULL, 0x000163},
+{0x0000E80032DULL, 0x001E71},
+{0x0000E800331ULL, 0x001E6F},
+{0x0000EA00300ULL, 0x0000F9},
+{0x0000EA00301ULL, 0x0000FA},
+{0x0000EA00302ULL, 0x0000FB},
+{0x0000EA00303ULL, 0x000169},
+{0x0000EA00304ULL, 0x00016B},
+{0x0000EA00306ULL, 0x00016D},
+{0x0000EA00308ULL, 0x0000FC},
+{0x0000EA00309ULL, 0x001EE7},
+{0x0000EA0030AULL, 0x00016F},
+{0x0000EA0030BULL, 0x000171},
+{0x0000EA0030CULL, 0x0001D4},
+{0x0000EA0030FULL, 0x000215},
+{0x0000EA00311ULL, 0x000217},
+{0x0000EA0031BULL, 0x0001B0},
+{0x0000EA00323ULL, 0x001EE5},
+{0x0000EA00324ULL, 0x001E73},
+{0x0000EA00328ULL, 0x000173},
+{0x0000EA0032DULL, 0x001E77},
+{0x0000EA00330ULL, 0x001E75},
+{0x0000EC00303ULL, 0x001E7D},
+{0x0000EC00323ULL, 0x001E7F},
+{0x0000EE00300ULL, 0x001E81},
+{0x0000EE00301ULL, 0x001E83},
+{0x0000EE00302ULL, 0x000175},
+{0x0000EE00307ULL, 0x001E87},
+{0x0000EE00308ULL, 0x001E85},
+{0x0000EE0030AULL, 0x001E98},
+{0x0000EE00323ULL, 0x001E89},
+{0x0000F000307ULL, 0x001E8B},
+{0x0000F000308ULL, 0x001E8D},
+{0x0000F200300ULL, 0x001EF3},
+{0x0000F200301ULL, 0x0000FD},
+{0x0000F200302ULL, 0x000177},
+{0x0000F200303ULL, 0x001EF9},
+{0x0000F200304ULL, 0x000233},
+{0x0000F200307ULL, 0x001E8F},
+{0x0000F200308ULL, 0x0000FF},
+{0x0000F200309ULL, 0x001EF7},
+{0x0000F20030AULL, 0x001E99},
+{0x0000F200323ULL, 0x001EF5},
+{0x0000F400301ULL, 0x00017A},
+{0x0000F400302ULL, 0x001E91},
+{0x0000F400307ULL, 0x00017C},
+{0x0000F40030CULL, 0x00017E},
+{0x0000F400323ULL, 0x001E93},
+{0x0000F400331ULL, 0x001E95},
+{0x00015000300ULL, 0x001FED},
+{0x00015000301ULL, 0x000385},
+{0x00015000342ULL, 0x001FC1},
+{0x00018400300ULL, 0x001EA6},
+{0x00018400301ULL, 0x001EA4},
+{0x00018400303ULL, 0x001EAA},
+{0x00018400309ULL, 0x001EA8},
+{0x00018800304ULL, 0x0001DE},
+{0x00018A00301ULL, 0x0001FA},
+{0x00018C00301ULL, 0x0001FC},
+{0x00018C00304ULL, 0x0001E2},
+{0x00018E00301ULL, 0x001E08},
+{0x00019400300ULL, 0x001EC0},
+{0x00019400301ULL, 0x001EBE},
+{0x00019400303ULL, 0x001EC4},
+{0x00019400309ULL, 0x001EC2},
+{0x00019E00301ULL, 0x001E2E},
+{0x0001A800300ULL, 0x001ED2},
+{0x0001A800301ULL, 0x001ED0},
+{0x0001A800303ULL, 0x001ED6},
+{0x0001A800309ULL, 0x001ED4},
+{0x0001AA00301ULL, 0x001E4C},
+{0x0001AA00304ULL, 0x00022C},
+{0x0001AA00308ULL, 0x001E4E},
+{0x0001AC00304ULL, 0x00022A},
+{0x0001B000301ULL, 0x0001FE},
+{0x0001B800300ULL, 0x0001DB},
+{0x0001B800301ULL, 0x0001D7},
+{0x0001B800304ULL, 0x0001D5},
+{0x0001B80030CULL, 0x0001D9},
+{0x0001C400300ULL, 0x001EA7},
+{0x0001C400301ULL, 0x001EA5},
+{0x0001C400303ULL, 0x001EAB},
+{0x0001C400309ULL, 0x001EA9},
+{0x0001C800304ULL, 0x0001DF},
+{0x0001CA00301ULL, 0x0001FB},
+{0x0001CC00301ULL, 0x0001FD},
+{0x0001CC00304ULL, 0x0001E3},
+{0x0001CE00301ULL, 0x001E09},
+{0x0001D400300ULL, 0x001EC1},
+{0x0001D400301ULL, 0x001EBF},
+{0x0001D400303ULL, 0x001EC5},
+{0x0001D400309ULL, 0x001EC3},
+{0x0001DE00301ULL, 0x001E2F},
+{0x0001E800300ULL, 0x001ED3},
+{0x0001E800301ULL, 0x001ED1},
+{0x0001E800303ULL, 0x001ED7},
+{0x0001E800309ULL, 0x001ED5},
+{0x0001EA00301ULL, 0x001E4D},
+{0x0001EA00304ULL, 0x00022D},
+{0x0001EA00308ULL, 0x001E4F},
+{0x0001EC00304ULL, 0x00022B},
+{0x0001F000301ULL, 0x0001FF},
+{0x0001F800300ULL, 0x0001DC},
+{0x0001F800301ULL, 0x0001D8},
+{0x0001F800304ULL, 0x0001D6},
+{0x0001F80030CULL, 0x0001DA},
+{0x00020400300ULL, 0x001EB0},
+{0x00020400301ULL, 0x001EAE},
+{0x00020400303ULL, 0x001EB4},
+{0x00020400309ULL, 0x001EB2},
+{0x00020600300ULL, 0x001EB1},
+{0x00020600301ULL, 0x001EAF},
+{0x00020600303ULL, 0x001EB5},
+{0x00020600309ULL, 0x001EB3},
+{0x00022400300ULL, 0x001E14},
+{0x00022400301ULL, 0x001E16},
+{0x00022600300ULL, 0x001E15},
+{0x00022600301ULL, 0x001E17},
+{0x00029800300ULL, 0x001E50},
+{0x00029800301ULL, 0x001E52},
+{0x00029A00300ULL, 0x001E51},
+{0x00029A00301ULL, 0x001E53},
+{0x0002B400307ULL, 0x001E64},
+{0x0002B600307ULL, 0x001E65},
+{0x0002C000307ULL, 0x001E66},
+{0x0002C200307ULL, 0x001E67},
+{0x0002D000301ULL, 0x001E78},
+{0x0002D200301ULL, 0x001E79},
+{0x0002D400308ULL, 0x001E7A},
+{0x0002D600308ULL, 0x001E7B},
+{0x0002FE00307ULL, 0x001E9B},
+{0x00034000300ULL, 0x001EDC},
+{0x00034000301ULL, 0x001EDA},
+{0x00034000303ULL, 0x001EE0},
+{0x00034000309ULL, 0x001EDE},
+{0x00034000323ULL, 0x001EE2},
+{0x00034200300ULL, 0x001EDD},
+{0x00034200301ULL, 0x001EDB},
+{0x00034200303ULL, 0x001EE1},
+{0x00034200309ULL, 0x001EDF},
+{0x00034200323ULL, 0x001EE3},
+{0x00035E00300ULL, 0x001EEA},
+{0x00035E00301ULL, 0x001EE8},
+{0x00035E00303ULL, 0x001EEE},
+{0x00035E00309ULL, 0x001EEC},
+{0x00035E00323ULL, 0x001EF0},
+{0x00036000300ULL, 0x001EEB},
+{0x00036000301ULL, 0x001EE9},
+{0x00036000303ULL, 0x001EEF},
+{0x00036000309ULL, 0x001EED},
+{0x00036000323ULL, 0x001EF1},
+{0x00036E0030CULL, 0x0001EE},
+{0x0003D400304ULL, 0x0001EC},
+{0x0003D600304ULL, 0x0001ED},
+{0x00044C00304ULL, 0x0001E0},
+{0x00044E00304ULL, 0x0001E1},
+{0x00045000306ULL, 0x001E1C},
+{0x00045200306ULL, 0x001E1D},
+{0x00045C00304ULL, 0x000230},
+{0x00045E00304ULL, 0x000231},
+{0x0005240030CULL, 0x0001EF},
+{0x00072200300ULL, 0x001FBA},
+{0x00072200301ULL, 0x000386},
+{0x00072200304ULL, 0x001FB9},
+{0x00072200306ULL, 0x001FB8},
+{0x00072200313ULL, 0x001F08},
+{0x00072200314ULL, 0x001F09},
+{0x00072200345ULL, 0x001FBC},
+{0x00072A00300ULL, 0x001FC8},
+{0x00072A00301ULL, 0x000388},
+{0x00072A00313ULL, 0x001F18},
+{0x00072A00314ULL, 0x001F19},
+{0x00072E00300ULL, 0x001FCA},
+{0x00072E00301ULL, 0x000389},
+{0x00072E00313ULL, 0x001F28},
+{0x00072E00314ULL, 0x001F29},
+{0x00072E00345ULL, 0x001FCC},
+{0x00073200300ULL, 0x001FDA},
+{0x00073200301ULL, 0x00038A},
+{0x00073200304ULL, 0x001FD9},
+{0x00073200306ULL, 0x001FD8},
+{0x00073200308ULL, 0x0003AA},
+{0x00073200313ULL, 0x001F38},
+{0x00073200314ULL, 0x001F39},
+{0x00073E00300ULL, 0x001FF8},
+{0x00073E00301ULL, 0x00038C},
+{0x00073E00313ULL, 0x001F48},
+{0x00073E00314ULL, 0x001F49},
+{0x00074200314ULL, 0x001FEC},
+{0x00074A00300ULL, 0x001FEA},
+{0x00074A00301ULL, 0x00038E},
+{0x00074A00304ULL, 0x001FE9},
+{0x00074A00306ULL, 0x001FE8},
+{0x00074A00308ULL, 0x0003AB},
+{0x00074A00314ULL, 0x001F59},
+{0x00075200300ULL, 0x001FFA},
+{0x00075200301ULL, 0x00038F},
+{0x00075200313ULL, 0x001F68},
+{0x00075200314ULL, 0x001F69},
+{0x00075200345ULL, 0x001FFC},
+{0x00075800345ULL, 0x001FB4},
+{0x00075C00345ULL, 0x001FC4},
+{0x00076200300ULL, 0x001F70},
+{0x00076200301ULL, 0x0003AC},
+{0x00076200304ULL, 0x001FB1},
+{0x00076200306ULL, 0x001FB0},
+{0x00076200313ULL, 0x001F00},
+{0x00076200314ULL, 0x001F01},
+{0x00076200342ULL, 0x001FB6},
+{0x00076200345ULL, 0x001FB3},
+{0x00076A00300ULL, 0x001F72},
+{0x00076A00301ULL, 0x0003AD},
+{0x00076A00313ULL, 0x001F10},
+{0x00076A00314ULL, 0x001F11},
+{0x00076E00300ULL, 0x001F74},
+{0x00076E00301ULL, 0x0003AE},
+{0x00076E00313ULL, 0x001F20},
+{0x00076E00314ULL, 0x001F21},
+{0x00076E00342ULL, 0x001FC6},
+{0x00076E00345ULL, 0x001FC3},
+{0x00077200300ULL, 0x001F76},
+{0x00077200301ULL, 0x0003AF},
+{0x00077200304ULL, 0x001FD1},
+{0x00077200306ULL, 0x001FD0},
+{0x00077200308ULL, 0x0003CA},
+{0x00077200313ULL, 0x001F30},
+{0x00077200314ULL, 0x001F31},
+{0x00077200342ULL, 0x001FD6},
+{0x00077E00300ULL, 0x001F78},
+{0x00077E00301ULL, 0x0003CC},
+{0x00077E00313ULL, 0x001F40},
+{0x00077E00314ULL, 0x001F41},
+{0x00078200313ULL, 0x001FE4},
+{0x00078200314ULL, 0x001FE5},
+{0x00078A00300ULL, 0x001F7A},
+{0x00078A00301ULL, 0x0003CD},
+{0x00078A00304ULL, 0x001FE1},
+{0x00078A00306ULL, 0x001FE0},
+{0x00078A00308ULL, 0x0003CB},
+{0x00078A00313ULL, 0x001F50},
+{0x00078A00314ULL, 0x001F51},
+{0x00078A00342ULL, 0x001FE6},
+{0x00079200300ULL, 0x001F7C},
+{0x00079200301ULL, 0x0003CE},
+{0x00079200313ULL, 0x001F60},
+{0x00079200314ULL, 0x001F61},
+{0x00079200342ULL, 0x001FF6},
+{0x00079200345ULL, 0x001FF3},
+{0x00079400300ULL, 0x001FD2},
+{0x00079400301ULL, 0x000390},
+{0x00079400342ULL, 0x001FD7},
+{0x00079600300ULL, 0x001FE2},
+{0x00079600301ULL, 0x0003B0},
+{0x00079600342ULL, 0x001FE7},
+{0x00079C00345ULL, 0x001FF4},
+{0x0007A400301ULL, 0x0003D3},
+{0x0007A400308ULL, 0x0003D4},
+{0x00080C00308ULL, 0x000407},
+{0x00082000306ULL, 0x0004D0},
+{0x00082000308ULL, 0x0004D2},
+{0x00082600301ULL, 0x000403},
+{0x00082A00300ULL, 0x000400},
+{0x00082A00306ULL, 0x0004D6},
+{0x00082A00308ULL, 0x000401},
+{0x00082C00306ULL, 0x0004C1},
+{0x00082C00308ULL, 0x0004DC},
+{0x00082E00308ULL, 0x0004DE},
+{0x00083000300ULL, 0x00040D},
+{0x00083000304ULL, 0x0004E2},
+{0x00083000306ULL, 0x000419},
+{0x00083000308ULL, 0x0004E4},
+{0x00083400301ULL, 0x00040C},
+{0x00083C00308ULL, 0x0004E6},
+{0x00084600304ULL, 0x0004EE},
+{0x00084600306ULL, 0x00040E},
+{0x00084600308ULL, 0x0004F0},
+{0x0008460030BULL, 0x0004F2},
+{0x00084E00308ULL, 0x0004F4},
+{0x00085600308ULL, 0x0004F8},
+{0x00085A00308ULL, 0x0004EC},
+{0x00086000306ULL, 0x0004D1},
+{0x00086000308ULL, 0x0004D3},
+{0x00086600301ULL, 0x000453},
+{0x00086A00300ULL, 0x000450},
+{0x00086A00306ULL, 0x0004D7},
+{0x00086A00308ULL, 0x000451},
+{0x00086C00306ULL, 0x0004C2},
+{0x00086C00308ULL, 0x0004DD},
+{0x00086E00308ULL, 0x0004DF},
+{0x00087000300ULL, 0x00045D},
+{0x00087000304ULL, 0x0004E3},
+{0x00087000306ULL, 0x000439},
+{0x00087000308ULL, 0x0004E5},
+{0x00087400301ULL, 0x00045C},
+{0x00087C00308ULL, 0x0004E7},
+{0x00088600304ULL, 0x0004EF},
+{0x00088600306ULL, 0x00045E},
+{0x00088600308ULL, 0x0004F1},
+{0x0008860030BULL, 0x0004F3},
+{0x00088E00308ULL, 0x0004F5},
+{0x00089600308ULL, 0x0004F9},
+{0x00089A00308ULL, 0x0004ED},
+{0x0008AC00308ULL, 0x000457},
+{0x0008E80030FULL, 0x000476},
+{0x0008EA0030FULL, 0x000477},
+{0x0009B000308ULL, 0x0004DA},
+{0x0009B200308ULL, 0x0004DB},
+{0x0009D000308ULL, 0x0004EA},
+{0x0009D200308ULL, 0x0004EB},
+{0x000C4E00653ULL, 0x000622},
+{0x000C4E00654ULL, 0x000623},
+{0x000C4E00655ULL, 0x000625},
+{0x000C9000654ULL, 0x000624},
+{0x000C9400654ULL, 0x000626},
+{0x000D8200654ULL, 0x0006C2},
+{0x000DA400654ULL, 0x0006D3},
+{0x000DAA00654ULL, 0x0006C0},
+{0x0012500093CULL, 0x000929},
+{0x0012600093CULL, 0x000931},
+{0x0012660093CULL, 0x000934},
+{0x00138E009BEULL, 0x0009CB},
+{0x00138E009D7ULL, 0x0009CC},
+{0x00168E00B3EULL, 0x000B4B},
+{0x00168E00B56ULL, 0x000B48},
+{0x00168E00B57ULL, 0x000B4C},
+{0x00172400BD7ULL, 0x000B94},
+{0x00178C00BBEULL, 0x000BCA},
+{0x00178C00BD7ULL, 0x000BCC},
+{0x00178E00BBEULL, 0x000BCB},
+{0x00188C00C56ULL, 0x000C48},
+{0x00197E00CD5ULL, 0x000CC0},
+{0x00198C00CC2ULL, 0x000CCA},
+{0x00198C00CD5ULL, 0x000CC7},
+{0x00198C00CD6ULL, 0x000CC8},
+{0x00199400CD5ULL, 0x000CCB},
+{0x001A8C00D3EULL, 0x000D4A},
+{0x001A8C00D57ULL, 0x000D4C},
+{0x001A8E00D3EULL, 0x000D4B},
+{0x001BB200DCAULL, 0x000DDA},
+{0x001BB200DCFULL, 0x000DDC},
+{0x001BB200DDFULL, 0x000DDE},
+{0x001BB800DCAULL, 0x000DDD},
+{0x00204A0102EULL, 0x001026},
+{0x00360A01B35ULL, 0x001B06},
+{0x00360E01B35ULL, 0x001B08},
+{0x00361201B35ULL, 0x001B0A},
+{0x00361601B35ULL, 0x001B0C},
+{0x00361A01B35ULL, 0x001B0E},
+{0x00362201B35ULL, 0x001B12},
+{0x00367401B35ULL, 0x001B3B},
+{0x00367801B35ULL, 0x001B3D},
+{0x00367C01B35ULL, 0x001B40},
+{0x00367E01B35ULL, 0x001B41},
+{0x00368401B35ULL, 0x001B43},
+{0x003C6C00304ULL, 0x001E38},
+{0x003C6E00304ULL, 0x001E39},
+{0x003CB400304ULL, 0x001E5C},
+{0x003CB600304ULL, 0x001E5D},
+{0x003CC400307ULL, 0x001E68},
+{0x003CC600307ULL, 0x001E69},
+{0x003D4000302ULL, 0x001EAC},
+{0x003D4000306ULL, 0x001EB6},
+{0x003D4200302ULL, 0x001EAD},
+{0x003D4200306ULL, 0x001EB7},
+{0x003D7000302ULL, 0x001EC6},
+{0x003D7200302ULL, 0x001EC7},
+{0x003D9800302ULL, 0x001ED8},
+{0x003D9A00302ULL, 0x001ED9},
+{0x003E0000300ULL, 0x001F02},
+{0x003E0000301ULL, 0x001F04},
+{0x003E0000342ULL, 0x001F06},
+{0x003E0000345ULL, 0x001F80},
+{0x003E0200300ULL, 0x001F03},
+{0x003E0200301ULL, 0x001F05},
+{0x003E0200342ULL, 0x001F07},
+{0x003E0200345ULL, 0x001F81},
+{0x003E0400345ULL, 0x001F82},
+{0x003E0600345ULL, 0x001F83},
+{0x003E0800345ULL, 0x001F84},
+{0x003E0A00345ULL, 0x001F85},
+{0x003E0C00345ULL, 0x001F86},
+{0x003E0E00345ULL, 0x001F87},
+{0x003E1000300ULL, 0x001F0A},
+{0x003E1000301ULL, 0x001F0C},
+{0x003E1000342ULL, 0x001F0E},
+{0x003E1000345ULL, 0x001F88},
+{0x003E1200300ULL, 0x001F0B},
+{0x003E1200301ULL, 0x001F0D},
+{0x003E1200342ULL, 0x001F0F},
+{0x003E1200345ULL, 0x001F89},
+{0x003E1400345ULL, 0x001F8A},
+{0x003E1600345ULL, 0x001F8B},
+{0x003E1800345ULL, 0x001F8C},
+{0x003E1A00345ULL, 0x001F8D},
+{0x003E1C00345ULL, 0x001F8E},
+{0x003E1E00345ULL, 0x001F8F},
+{0x003E2000300ULL, 0x001F12},
+{0x003E2000301ULL, 0x001F14},
+{0x003E2200300ULL, 0x001F13},
+{0x003E2200301ULL, 0x001F15},
+{0x003E3000300ULL, 0x001F1A},
+{0x003E3000301ULL, 0x001F1C},
+{0x003E3200300ULL, 0x001F1B},
+{0x003E3200301ULL, 0x001F1D},
+{0x003E4000300ULL, 0x001F22},
+{0x003E4000301ULL, 0x001F24},
+{0x003E4000342ULL, 0x001F26},
+{0x003E4000345ULL, 0x001F90},
+{0x003E4200300ULL, 0x001F23},
+{0x003E4200301ULL, 0x001F25},
+{0x003E4200342ULL, 0x001F27},
+{0x003E4200345ULL, 0x001F91},
+{0x003E4400345ULL, 0x001F92},
+{0x003E4600345ULL, 0x001F93},
+{0x003E4800345ULL, 0x001F94},
+{0x003E4A00345ULL, 0x001F95},
+{0x003E4C00345ULL, 0x001F96},
+{0x003E4E00345ULL, 0x001F97},
+{0x003E5000300ULL, 0x001F2A},
+{0x003E5000301ULL, 0x001F2C},
+{0x003E5000342ULL, 0x001F2E},
+{0x003E5000345ULL, 0x001F98},
+{0x003E5200300ULL, 0x001F2B},
+{0x003E5200301ULL, 0x001F2D},
+{0x003E5200342ULL, 0x001F2F},
+{0x003E5200345ULL, 0x001F99},
+{0x003E5400345ULL, 0x001F9A},
+{0x003E5600345ULL, 0x001F9B},
+{0x003E5800345ULL, 0x001F9C},
+{0x003E5A00345ULL, 0x001F9D},
+{0x003E5C00345ULL, 0x001F9E},
+{0x003E5E00345ULL, 0x001F9F},
+{0x003E6000300ULL, 0x001F32},
+{0x003E6000301ULL, 0x001F34},
+{0x003E6000342ULL, 0x001F36},
+{0x003E6200300ULL, 0x001F33},
+{0x003E6200301ULL, 0x001F35},
+{0x003E6200342ULL, 0x001F37},
+{0x003E7000300ULL, 0x001F3A},
+{0x003E7000301ULL, 0x001F3C},
+{0x003E7000342ULL, 0x001F3E},
+{0x003E7200300ULL, 0x001F3B},
+{0x003E7200301ULL, 0x001F3D},
+{0x003E7200342ULL, 0x001F3F},
+{0x003E8000300ULL, 0x001F42},
+{0x003E8000301ULL, 0x001F44},
+{0x003E8200300ULL, 0x001F43},
+{0x003E8200301ULL, 0x001F45},
+{0x003E9000300ULL, 0x001F4A},
+{0x003E9000301ULL, 0x001F4C},
+{0x003E9200300ULL, 0x001F4B},
+{0x003E9200301ULL, 0x001F4D},
+{0x003EA000300ULL, 0x001F52},
+{0x003EA000301ULL, 0x001F54},
+{0x003EA000342ULL, 0x001F56},
+{0x003EA200300ULL, 0x001F53},
+{0x003EA200301ULL, 0x001F55},
+{0x003EA200342ULL, 0x001F57},
+{0x003EB200300ULL, 0x001F5B},
+{0x003EB200301ULL, 0x001F5D},
+{0x003EB200342ULL, 0x001F5F},
+{0x003EC000300ULL, 0x001F62},
+{0x003EC000301ULL, 0x001F64},
+{0x003EC000342ULL, 0x001F66},
+{0x003EC000345ULL, 0x001FA0},
+{0x003EC200300ULL, 0x001F63},
+{0x003EC200301ULL, 0x001F65},
+{0x003EC200342ULL, 0x001F67},
+{0x003EC200345ULL, 0x001FA1},
+{0x003EC400345ULL, 0x001FA2},
+{0x003EC600345ULL, 0x001FA3},
+{0x003EC800345ULL, 0x001FA4},
+{0x003ECA00345ULL, 0x001FA5},
+{0x003ECC00345ULL, 0x001FA6},
+{0x003ECE00345ULL, 0x001FA7},
+{0x003ED000300ULL, 0x001F6A},
+{0x003ED000301ULL, 0x001F6C},
+{0x003ED000342ULL, 0x001F6E},
+{0x003ED000345ULL, 0x001FA8},
+{0x003ED200300ULL, 0x001F6B},
+{0x003ED200301ULL, 0x001F6D},
+{0x003ED200342ULL, 0x001F6F},
+{0x003ED200345ULL, 0x001FA9},
+{0x003ED400345ULL, 0x001FAA},
+{0x003ED600345ULL, 0x001FAB},
+{0x003ED800345ULL, 0x001FAC},
+{0x003EDA00345ULL, 0x001FAD},
+{0x003EDC00345ULL, 0x001FAE},
+{0x003EDE00345ULL, 0x001FAF},
+{0x003EE000345ULL, 0x001FB2},
+{0x003EE800345ULL, 0x001FC2},
+{0x003EF800345ULL, 0x001FF2},
+{0x003F6C00345ULL, 0x001FB7},
+{0x003F7E00300ULL, 0x001FCD},
+{0x003F7E00301ULL, 0x001FCE},
+{0x003F7E00342ULL, 0x001FCF},
+{0x003F8C00345ULL, 0x001FC7},
+{0x003FEC00345ULL, 0x001FF7},
+{0x003FFC00300ULL, 0x001FDD},
+{0x003FFC00301ULL, 0x001FDE},
+{0x003FFC00342ULL, 0x001FDF},
+{0x00432000338ULL, 0x00219A},
+{0x00432400338ULL, 0x00219B},
+{0x00432800338ULL, 0x0021AE},
+{0x0043A000338ULL, 0x0021CD},
+{0x0043A400338ULL, 0x0021CF},
+{0x0043A800338ULL, 0x0021CE},
+{0x00440600338ULL, 0x002204},
+{0x00441000338ULL, 0x002209},
+{0x00441600338ULL, 0x00220C},
+{0x00444600338ULL, 0x002224},
+{0x00444A00338ULL, 0x002226},
+{0x00447800338ULL, 0x002241},
+{0x00448600338ULL, 0x002244},
+{0x00448A00338ULL, 0x002247},
+{0x00449000338ULL, 0x002249},
+{0x00449A00338ULL, 0x00226D},
+{0x0044C200338ULL, 0x002262},
+{0x0044C800338ULL, 0x002270},
+{0x0044CA00338ULL, 0x002271},
+{0x0044E400338ULL, 0x002274},
+{0x0044E600338ULL, 0x002275},
+{0x0044EC00338ULL, 0x002278},
+{0x0044EE00338ULL, 0x002279},
+{0x0044F400338ULL, 0x002280},
+{0x0044F600338ULL, 0x002281},
+{0x0044F800338ULL, 0x0022E0},
+{0x0044FA00338ULL, 0x0022E1},
+{0x00450400338ULL, 0x002284},
+{0x00450600338ULL, 0x002285},
+{0x00450C00338ULL, 0x002288},
+{0x00450E00338ULL, 0x002289},
+{0x00452200338ULL, 0x0022E2},
+{0x00452400338ULL, 0x0022E3},
+{0x00454400338ULL, 0x0022AC},
+{0x00455000338ULL, 0x0022AD},
+{0x00455200338ULL, 0x0022AE},
+{0x00455600338ULL, 0x0022AF},
+{0x00456400338ULL, 0x0022EA},
+{0x00456600338ULL, 0x0022EB},
+{0x00456800338ULL, 0x0022EC},
+{0x00456A00338ULL, 0x0022ED},
+{0x00608C03099ULL, 0x003094},
+{0x00609603099ULL, 0x00304C},
+{0x00609A03099ULL, 0x00304E},
+{0x00609E03099ULL, 0x003050},
+{0x0060A203099ULL, 0x003052},
+{0x0060A603099ULL, 0x003054},
+{0x0060AA03099ULL, 0x003056},
+{0x0060AE03099ULL, 0x003058},
+{0x0060B203099ULL, 0x00305A},
+{0x0060B603099ULL, 0x00305C},
+{0x0060BA03099ULL, 0x00305E},
+{0x0060BE03099ULL, 0x003060},
+{0x0060C203099ULL, 0x003062},
+{0x0060C803099ULL, 0x003065},
+{0x0060CC03099ULL, 0x003067},
+{0x0060D003099ULL, 0x003069},
+{0x0060DE03099ULL, 0x003070},
+{0x0060DE0309AULL, 0x003071},
+{0x0060E403099ULL, 0x003073},
+{0x0060E40309AULL, 0x003074},
+{0x0060EA03099ULL, 0x003076},
+{0x0060EA0309AULL, 0x003077},
+{0x0060F003099ULL, 0x003079},
+{0x0060F00309AULL, 0x00307A},
+{0x0060F603099ULL, 0x00307C},
+{0x0060F60309AULL, 0x00307D},
+{0x00613A03099ULL, 0x00309E},
+{0x00614C03099ULL, 0x0030F4},
+{0x00615603099ULL, 0x0030AC},
+{0x00615A03099ULL, 0x0030AE},
+{0x00615E03099ULL, 0x0030B0},
+{0x00616203099ULL, 0x0030B2},
+{0x00616603099ULL, 0x0030B4},
+{0x00616A03099ULL, 0x0030B6},
+{0x00616E03099ULL, 0x0030B8},
+{0x00617203099ULL, 0x0030BA},
+{0x00617603099ULL, 0x0030BC},
+{0x00617A03099ULL, 0x0030BE},
+{0x00617E03099ULL, 0x0030C0},
+{0x00618203099ULL, 0x0030C2},
+{0x00618803099ULL, 0x0030C5},
+{0x00618C03099ULL, 0x0030C7},
+{0x00619003099ULL, 0x0030C9},
+{0x00619E03099ULL, 0x0030D0},
+{0x00619E0309AULL, 0x0030D1},
+{0x0061A403099ULL, 0x0030D3},
+{0x0061A40309AULL, 0x0030D4},
+{0x0061AA03099ULL, 0x0030D6},
+{0x0061AA0309AULL, 0x0030D7},
+{0x0061B003099ULL, 0x0030D9},
+{0x0061B00309AULL, 0x0030DA},
+{0x0061B603099ULL, 0x0030DC},
+{0x0061B60309AULL, 0x0030DD},
+{0x0061DE03099ULL, 0x0030F7},
+{0x0061E003099ULL, 0x0030F8},
+{0x0061E203099ULL, 0x0030F9},
+{0x0061E403099ULL, 0x0030FA},
+{0x0061FA03099ULL, 0x0030FE},
+{0x022132110BAULL, 0x01109A},
+{0x022136110BAULL, 0x01109C},
+{0x02214A110BAULL, 0x0110AB},
+{0x02226211127ULL, 0x01112E},
+{0x02226411127ULL, 0x01112F},
+{0x02268E1133EULL, 0x01134B},
+{0x02268E11357ULL, 0x01134C},
+{0x022972114B0ULL, 0x0114BC},
+{0x022972114BAULL, 0x0114BB},
+{0x022972114BDULL, 0x0114BE},
+{0x022B70115AFULL, 0x0115BA},
+{0x022B72115AFULL, 0x0115BB},
+{0x02326A11930ULL, 0x011938},
+};
+
+} // namespace nanotokenizer
@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: MIT
+// Copyright 2024-Present Light Transport Entertainment Inc.
+#include "unicode-normalization.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "unicode-data.hh"
+#include "unicode-util.hh"
+
+namespace nanotokenizer {
+
+namespace {
+
+// Hangul syllables(Unicode 3.12)
+const uint32_t HANGUL_S_BASE = 0xAC00;
+const uint32_t HANGUL_L_BASE = 0x1100;
+const uint32_t HANGUL_V_BASE = 0x1161;
+const uint32_t HANGUL_T_BASE = 0x11A7;
+const uint32_t HANGUL_L_COUNT = 19;
+const uint32_t HANGUL_V_COUNT = 21;
+const uint32_t HANGUL_T_COUNT = 28;
+const uint32_t HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+const uint32_t HANGUL_S_COUNT = HANGUL_L_COUNT * HANGUL_N_COUNT;
+
+struct norm_char {
+    uint32_t cpt;
+    uint32_t ccc;
+};
+
+static thread_local std::vector<norm_char> tls_buffer;
+
+inline const unicode_norm_record & norm_record(uint32_t cpt) {
+    if (cpt >= MAX_CODEPOINTS) {
+        return unicode_norm_records[0];
+    }
+    const uint32_t block = unicode_norm_stage1[cpt >> UNICODE_FLAGS_BLOCK_BITS];
+    return unicode_norm_records[unicode_norm_stage2[(block << UNICODE_FLAGS_BLOCK_BITS) | (cpt & UNICODE_FLAGS_BLOCK_MASK)]];
+}
+
+inline unicode_quick_check norm_qc(const unicode_norm_record & rec, unicode_normalization_form form) {
+    return unicode_quick_check((rec.qc >> (2 * int(form))) & 3);
+}
+
+inline bool norm_boundary(const unicode_norm_record & rec, unicode_normalization_form form) {
+    return (rec.boundary >> int(form)) & 1;
+}
+
+inline bool is_composing(unicode_normalization_form form) {
+    return form == UNICODE_NFC || form == UNICODE_NFKC;
+}
+
+inline bool is_compat(unicode_normalization_form form) {
+    return form == UNICODE_NFKC || form == UNICODE_NFKD;
+}
+
+// Length of the run of ASCII bytes at `text`.
+inline size_t ascii_run(const char * text, size_t size) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t v;
+        memcpy(&v, text + i, 8);
+        if (v & 0x8080808080808080ULL) {
+            break;
+        }
+    }
+    while (i < size && !(text[i] & 0x80)) {
+        i++;
+    }
+    return i;
+}
+
+// Decode one codepoint. ~0u for invalid UTF-8(one byte is consumed).
+inline uint32_t decode(const char * text, size_t size, size_t & offset) {
+    const uint32_t cpt = unicode_cpt_from_utf8(text, size, offset);
+    return cpt < MAX_CODEPOINTS ? cpt : ~0u;
+}
+
+void decompose(unicode_normalization_form form, uint32_t cpt, std::vector<norm_char> & buf) {
+    if (cpt - HANGUL_S_BASE < HANGUL_S_COUNT) {
+        const uint32_t s = cpt - HANGUL_S_BASE;
+        buf.push_back({HANGUL_L_BASE + s / HANGUL_N_COUNT, 0});
+        buf.push_back({HANGUL_V_BASE + (s % HANGUL_N_COUNT) / HANGUL_T_COUNT, 0});
+        if (s % HANGUL_T_COUNT) {
+            buf.push_back({HANGUL_T_BASE + s % HANGUL_T_COUNT, 0});
+        }
+        return;
+    }
+
+    const unicode_norm_record & rec = norm_record(cpt);
+    const uint32_t len = is_compat(form) ? rec.kd_len : rec.d_len;
+    if (len == 0) {
+        buf.push_back({cpt, rec.ccc});
+        return;
+    }
+    const uint32_t * d = unicode_norm_decomp + (is_compat(form) ? rec.kd_offset : rec.d_offset);
+    for (uint32_t i = 0; i < len; i++) {
+        buf.push_back({d[i], norm_record(d[i]).ccc});
+    }
+}
+
+// Stable sort of each run of non-starters by combining class.
+void canonical_order(std::vector<norm_char> & buf) {
+    for (size_t i = 1; i < buf.size(); i++) {
+        const norm_char c = buf[i];
+        if (c.ccc == 0) {
+            continue;
+        }
+        size_t j = i;
+        while (j > 0 && buf[j - 1].ccc > c.ccc) {
+            buf[j] = buf[j - 1];
+            j--;
+        }
+        buf[j] = c;
+    }
+}
+
+// Primary composite of `first` + `second`, or 0.
+uint32_t compose_pair(uint32_t first, uint32_t second) {
+    if (first - HANGUL_L_BASE < HANGUL_L_COUNT && second - HANGUL_V_BASE < HANGUL_V_COUNT) {
+        return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + (second - HANGUL_V_BASE)) * HANGUL_T_COUNT;
+    }
+    if (first - HANGUL_S_BASE < HANGUL_S_COUNT && (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0 &&
+        second - HANGUL_T_BASE - 1 < HANGUL_T_COUNT - 1) {
+        return first + (second - HANGUL_T_BASE);
+    }
+
+    const uint64_t key = (uint64_t(first) << 21) | second;
+    const unicode_norm_composite * begin = unicode_norm_composites;
+    const unicode_norm_composite * end = unicode_norm_composites + unicode_norm_num_composites;
+    const unicode_norm_composite * it = std::lower_bound(begin, end, key,
+        [](const unicode_norm_composite & c, uint64_t k) { return c.key < k; });
+    return (it != end && it->key == key) ? it->composite : 0;
+}
+
+// Canonical composition of a canonically ordered buffer.
+void compose(std::vector<norm_char> & buf) {
+    if (buf.empty()) {
+        return;
+    }
+    size_t starter = 0;
+    // ccc of the last kept character after the starter. 0: adjacent to the
+    // starter, 256: no starter yet.
+    uint32_t last_ccc = buf[0].ccc == 0 ? 0 : 256;
+    size_t n = 1;
+    for (size_t i = 1; i < buf.size(); i++) {
+        const norm_char c = buf[i];
+        if (last_ccc == 0 || (last_ccc < c.ccc && last_ccc != 256)) {
+            const uint32_t composite = compose_pair(buf[starter].cpt, c.cpt);
+            if (composite) {
+                buf[starter].cpt = composite;
+                continue;
+            }
+        }
+        if (c.ccc == 0) {
+            starter = n;
+        }
+        last_ccc = c.ccc;
+        buf[n++] = c;
+    }
+    buf.resize(n);
+}
+
+void flush_buffer(unicode_normalization_form form, std::vector<norm_char> & buf, std::string & out) {
+    canonical_order(buf);
+    if (is_composing(form)) {
+        compose(buf);
+    }
+    char utf8[4];
+    for (const norm_char & c : buf) {
+        out.append(utf8, unicode_cpt_to_utf8(c.cpt, utf8));
+    }
+    buf.clear();
+}
+
+// Full normalization of text that needs it.
+void normalize_segment(unicode_normalization_form form, const char * text, size_t size, std::string & out) {
+    std::vector<norm_char> & buf = tls_buffer;
+    buf.clear();
+    size_t i = 0;
+    while (i < size) {
+        const size_t start = i;
+        const uint32_t cpt = decode(text, size, i);
+        if (cpt == ~0u) {
+            flush_buffer(form, buf, out);
+            out.append(text + start, i - start);  // invalid UTF-8: keep as is
+            continue;
+        }
+        decompose(form, cpt, buf);
+    }
+    flush_buffer(form, buf, out);
+}
+
+} // namespace
+
+unicode_quick_check unicode_normalization_quick_check(unicode_normalization_form form, const char * text, size_t size) {
+    unicode_quick_check result = UNICODE_QC_YES;
+    uint32_t last_ccc = 0;
+    size_t i = 0;
+    while (i < size) {
+        const size_t n = ascii_run(text + i, size - i);
+        if (n) {
+            i += n;
+            last_ccc = 0;
+            continue;
+        }
+        const uint32_t cpt = decode(text, size, i);
+        if (cpt == ~0u) {
+            last_ccc = 0;
+            continue;
+        }
+        const unicode_norm_record & rec = norm_record(cpt);
+        if (rec.ccc != 0 && last_ccc > rec.ccc) {
+            return UNICODE_QC_NO;
+        }
+        const unicode_quick_check qc = norm_qc(rec, form);
+        if (qc == UNICODE_QC_NO) {
+            return UNICODE_QC_NO;
+        }
+        if (qc == UNICODE_QC_MAYBE) {
+            result = UNICODE_QC_MAYBE;
+        }
+        last_ccc = rec.ccc;
+    }
+    return result;
+}
+
+bool unicode_is_normalized(unicode_normalization_form form, const char * text, size_t size) {
+    const unicode_quick_check qc = unicode_normalization_quick_check(form, text, size);
+    if (qc != UNICODE_QC_MAYBE) {
+        return qc == UNICODE_QC_YES;
+    }
+    std::string normalized;
+    unicode_normalize(form, text, size, normalized);
+    return normalized.size() == size && memcmp(normalized.data(), text, size) == 0;
+}
+
+void unicode_normalize(unicode_normalization_form form, const char * text, size_t size, std::string & out) {
+    out.reserve(out.size() + size);
+
+    size_t copied = 0;    // text before this is in `out`
+    size_t boundary = 0;  // last normalization boundary >= `copied`
+    uint32_t last_ccc = 0;
+    size_t i = 0;
+    while (i < size) {
+        // ASCII is normalized in every form and each byte is a boundary.
+        const size_t n = ascii_run(text + i, size - i);
+        if (n) {
+            i += n;
+            boundary = i - 1;
+            last_ccc = 0;
+            continue;
+        }
+
+        const size_t start = i;
+        const uint32_t cpt = decode(text, size, i);
+        if (cpt == ~0u) {
+            boundary = start;
+            last_ccc = 0;
+            continue;
+        }
+        const unicode_norm_record & rec = norm_record(cpt);
+        if ((rec.ccc == 0 || last_ccc <= rec.ccc) && norm_qc(rec, form) == UNICODE_QC_YES) {
+            if (norm_boundary(rec, form)) {
+                boundary = start;
+            }
+            last_ccc = rec.ccc;
+            continue;
+        }
+
+        // Normalize from the last boundary up to the next one.
+        size_t end = i;
+        while (end < size) {
+            size_t next = end;
+            const uint32_t c = decode(text, size, next);
+            if (c == ~0u || norm_boundary(norm_record(c), form)) {
+                break;
+            }
+            end = next;
+        }
+        out.append(text + copied, boundary - copied);
+        normalize_segment(form, text + boundary, end - boundary, out);
+        copied = boundary = i = end;
+        last_ccc = 0;
+    }
+    out.append(text + copied, size - copied);
+}
+
+std::string unicode_normalize(unicode_normalization_form form, const std::string & text) {
+    std::string out;
+    unicode_normalize(form, text.data(), text.size(), out);
+    return out;
+}
+
+void unicode_normalizer::push(const char * text, size_t size, std::string & out) {
+    // Find the last boundary. An incomplete UTF-8 sequence at the end does
+    // not decode, so it is held back as well.
+    size_t split = size;
+    for (size_t p = size; p > 0; ) {
+        p--;
+        const uint8_t c = uint8_t(text[p]);
+        if ((c & 0xC0) == 0x80) {
+            continue;
+        }
+        if (c < 0x80) {
+            split = p;
+            break;
+        }
+        size_t next = p;
+        const uint32_t cpt = decode(text, size, next);
+        if (cpt != ~0u && norm_boundary(norm_record(cpt), _form)) {
+            split = p;
+            break;
+        }
+    }
+
+    if (split == size) {
+        _pending.append(text, size);  // no boundary yet
+        return;
+    }
+
+    if (_pending.empty()) {
+        unicode_normalize(_form, text, split, out);
+    } else {
+        _pending.append(text, split);
+        unicode_normalize(_form, _pending.data(), _pending.size(), out);
+    }
+    _pending.assign(text + split, size - split);
+}
+
+void unicode_normalizer::flush(std::string & out) {
+    unicode_normalize(_form, _pending.data(), _pending.size(), out);
+    _pending.clear();
+}
+
+} // namespace nanotokenizer
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MIT
+// Copyright 2024-Present Light Transport Entertainment Inc.
+//
+// Unicode normalization(NFC, NFD, NFKC, NFKD; UAX #15).
+// Tables are generated by gen-unicode-normalization.py.
+//
+// Text is processed in segments between normalization boundaries. Segments
+// that pass the quick check(the common case: ASCII, or text that is already
+// normalized) are copied as is; only the other segments are decomposed,
+// reordered and composed.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace nanotokenizer {
+
+enum unicode_normalization_form {
+    UNICODE_NFC  = 0,
+    UNICODE_NFD  = 1,
+    UNICODE_NFKC = 2,
+    UNICODE_NFKD = 3,
+};
+
+enum unicode_quick_check {
+    UNICODE_QC_YES   = 0,
+    UNICODE_QC_NO    = 1,
+    UNICODE_QC_MAYBE = 2,
+};
+
+// Quick check of UAX #15. MAYBE only for NFC/NFKC.
+unicode_quick_check unicode_normalization_quick_check(unicode_normalization_form form, const char * text, size_t size);
+
+bool unicode_is_normalized(unicode_normalization_form form, const char * text, size_t size);
+
+// Normalize `text` and append the result to `out`. Invalid UTF-8 bytes are
+// kept as is.
+void unicode_normalize(unicode_normalization_form form, const char * text, size_t size, std::string & out);
+
+std::string unicode_normalize(unicode_normalization_form form, const std::string & text);
+
+// Streaming normalizer, e.g. as a stage ahead of the pretokenizer.
+//
+// `push` appends the normalized text up to the last normalization boundary
+// of the input seen so far and keeps the rest(and an incomplete UTF-8
+// sequence at the end) until the next `push` or `flush`. The concatenated
+// output equals `unicode_normalize` of the concatenated input.
+class unicode_normalizer {
+  public:
+    explicit unicode_normalizer(unicode_normalization_form form) : _form(form) {}
+
+    void push(const char * text, size_t size, std::string & out);
+
+    // Normalize and output the held back text.
+    void flush(std::string & out);
+
+    void reset() { _pending.clear(); }
+
+    unicode_normalization_form form() const { return _form; }
+
+    // Bytes held back.
+    size_t pending_size() const { return _pending.size(); }
+
+  private:
+    unicode_normalization_form _form;
+    std::string _pending;
+};
+
+} // namespace nanotokenizer
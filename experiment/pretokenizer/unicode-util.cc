@@ -13,9 +13,10 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <map>
 //#include <regex>
-//#include <stdexcept>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -42,8 +43,9 @@ static std::string unicode_cpts_to_utf8(const std::vector<uint32_t> & cps) {
 }
 #endif
 
-uint32_t unicode_cpt_from_utf8(const std::string & utf8, size_t & offset) {
-    assert(offset < utf8.size());
+uint32_t unicode_cpt_from_utf8(const char * utf8, const size_t size, size_t & offset) {
+    assert(offset < size);
+    // Invalid sequence: consume one byte and return ~0u so callers always make progress.
     if (!(utf8[offset + 0] & 0x80)) {
         auto result = utf8[offset + 0];
         offset += 1;
@@ -51,10 +53,12 @@ uint32_t unicode_cpt_from_utf8(const std::string & utf8, size_t & offset) {
     }
     if (!(utf8[offset + 0] & 0x40)) {
         //throw std::invalid_argument("invalid character");
+        offset += 1;
         return ~0u;
     }
     if (!(utf8[offset + 0] & 0x20)) {
-        if (offset + 1 >= utf8.size() || ! ((utf8[offset + 1] & 0xc0) == 0x80)) {
+        if (offset + 1 >= size || ! ((utf8[offset + 1] & 0xc0) == 0x80)) {
+            offset += 1;
             return ~0u;
             //throw std::invalid_argument("invalid character");
         }
@@ -63,8 +67,9 @@ uint32_t unicode_cpt_from_utf8(const std::string & utf8, size_t & offset) {
         return result;
     }
     if (!(utf8[offset + 0] & 0x10)) {
-        if (offset + 2 >= utf8.size() || ! ((utf8[offset + 1] & 0xc0) == 0x80) || ! ((utf8[offset + 2] & 0xc0) == 0x80)) {
+        if (offset + 2 >= size || ! ((utf8[offset + 1] & 0xc0) == 0x80) || ! ((utf8[offset + 2] & 0xc0) == 0x80)) {
             //throw std::invalid_argument("invalid character");
+            offset += 1;
             return ~0u;
         }
         auto result = ((utf8[offset + 0] & 0x0f) << 12) | ((utf8[offset + 1] & 0x3f) << 6) | (utf8[offset + 2] & 0x3f);
@@ -72,19 +77,24 @@ uint32_t unicode_cpt_from_utf8(const std::string & utf8, size_t & offset) {
         return result;
     }
     if (!(utf8[offset + 0] & 0x08)) {
-        if (offset + 3 >= utf8.size() || ! ((utf8[offset + 1] & 0xc0) == 0x80) || ! ((utf8[offset + 2] & 0xc0) == 0x80) || !((utf8[offset + 3] & 0xc0) == 0x80)) {
+        if (offset + 3 >= size || ! ((utf8[offset + 1] & 0xc0) == 0x80) || ! ((utf8[offset + 2] & 0xc0) == 0x80) || !((utf8[offset + 3] & 0xc0) == 0x80)) {
             //throw std::invalid_argument("invalid character");
+            offset += 1;
             return ~0u;
         }
         auto result = ((utf8[offset + 0] & 0x07) << 18) | ((utf8[offset + 1] & 0x3f) << 12) | ((utf8[offset + 2] & 0x3f) << 6) | (utf8[offset + 3] & 0x3f);
         offset += 4;
-        //return result;
-        return ~0u;
+        return result;
     }
     //throw std::invalid_argument("failed to convert utf8 to codepoint");
+    offset += 1;
     return ~0u;
 }
 
+uint32_t unicode_cpt_from_utf8(const std::string & utf8, size_t & offset) {
+    return unicode_cpt_from_utf8(utf8.data(), utf8.size(), offset);
+}
+
 //static std::vector<uint16_t> unicode_cpt_to_utf16(uint32_t cp) {
 //    std::vector<uint16_t> result;
 //    if (/* 0x0000 <= cp && */ cp <= 0xffff) {
@@ -134,84 +144,60 @@ uint32_t unicode_cpt_from_utf8(const std::string & utf8, size_t & offset) {
 //    return result;
 //}
 
-static std::vector<codepoint_flags> unicode_cpt_flags_array() {
-    std::vector<codepoint_flags> cpt_flags(MAX_CODEPOINTS, codepoint_flags::UNDEFINED);
-
-    assert (unicode_ranges_flags.begin()[0].first == 0);
-    assert (unicode_ranges_flags.begin()[unicode_ranges_flags.size()-1].first == MAX_CODEPOINTS);
-    for (size_t i = 1; i < unicode_ranges_flags.size(); ++i) {
-        const auto range_ini = unicode_ranges_flags.begin()[i-1];  // codepoint_ini, flags
-        const auto range_end = unicode_ranges_flags.begin()[i];    // codepoint_end, flags
-        for (uint32_t cpt = range_ini.first; cpt < range_end.first; ++cpt) {
-            cpt_flags[cpt] = range_ini.second;
-        }
-    }
-
-    for (auto cpt : unicode_set_whitespace) {
-        cpt_flags[cpt].is_whitespace = true;
-    }
-
-    for (auto p : unicode_map_lowercase) {
-        cpt_flags[p.second].is_lowercase = true;
-    }
-
-    for (auto p : unicode_map_uppercase) {
-        cpt_flags[p.second].is_uppercase = true;
-    }
-
-    for (auto &range : unicode_ranges_nfd) {  // start, last, nfd
-        cpt_flags[range.nfd].is_nfd = true;
-    }
-
-    return cpt_flags;
-}
-
-static std::unordered_map<uint8_t, std::string> unicode_byte_to_utf8_map() {
-    std::unordered_map<uint8_t, std::string> map;
-    for (int ch = 0x21; ch <= 0x7E; ++ch) {  // u'!' to u'~'
-        assert(0 <= ch && ch < 256);
-        map[ch] = unicode_cpt_to_utf8(ch);
-    }
-    for (int ch = 0xA1; ch <= 0xAC; ++ch) {  // u'¡' to u'¬'
-        assert(0 <= ch && ch < 256);
-        map[ch] = unicode_cpt_to_utf8(ch);
-    }
-    for (int ch = 0xAE; ch <= 0xFF; ++ch) {  // u'®' to u'ÿ'
-        assert(0 <= ch && ch < 256);
-        map[ch] = unicode_cpt_to_utf8(ch);
-    }
-    auto n = 0;
-    for (int ch = 0; ch < 256; ++ch) {
-        if (map.find(ch) == map.end()) {
-            map[ch] = unicode_cpt_to_utf8(256 + n);
-            ++n;
-        }
-    }
-    return map;
-}
-
-static std::unordered_map<std::string, uint8_t> unicode_utf8_to_byte_map() {
-    std::unordered_map<std::string, uint8_t> map;
-    for (int ch = 0x21; ch <= 0x7E; ++ch) {  // u'!' to u'~'
-        assert(0 <= ch && ch < 256);
-        map[unicode_cpt_to_utf8(ch)] = ch;
-    }
-    for (int ch = 0xA1; ch <= 0xAC; ++ch) {  // u'¡' to u'¬'
-        assert(0 <= ch && ch < 256);
-        map[unicode_cpt_to_utf8(ch)] = ch;
-    }
-    for (int ch = 0xAE; ch <= 0xFF; ++ch) {  // u'®' to u'ÿ'
-        assert(0 <= ch && ch < 256);
-        map[unicode_cpt_to_utf8(ch)] = ch;
-    }
-    auto n = 0;
-    for (int ch = 0; ch < 256; ++ch) {
-        if (map.find(unicode_cpt_to_utf8(ch)) == map.end()) {
-            map[unicode_cpt_to_utf8(256 + n)] = ch;
-            ++n;
-        }
-    }
-    return map;
+//
+// byte-level BPE mapping(GPT-2 `bytes_to_unicode`)
+//
+// Printable Latin-1 bytes(0x21-0x7E, 0xA1-0xAC, 0xAE-0xFF) map to themselves,
+// the other 68 bytes to U+0100-U+0143 in byte order.
+
+// {UTF-8 length, UTF-8 bytes} of the mapped codepoint of each byte.
+static const uint8_t unicode_byte_bpe_utf8[256][3] = {
+    {2, 0xc4, 0x80}, {2, 0xc4, 0x81}, {2, 0xc4, 0x82}, {2, 0xc4, 0x83}, {2, 0xc4, 0x84}, {2, 0xc4, 0x85}, {2, 0xc4, 0x86}, {2, 0xc4, 0x87},
+    {2, 0xc4, 0x88}, {2, 0xc4, 0x89}, {2, 0xc4, 0x8a}, {2, 0xc4, 0x8b}, {2, 0xc4, 0x8c}, {2, 0xc4, 0x8d}, {2, 0xc4, 0x8e}, {2, 0xc4, 0x8f},
+    {2, 0xc4, 0x90}, {2, 0xc4, 0x91}, {2, 0xc4, 0x92}, {2, 0xc4, 0x93}, {2, 0xc4, 0x94}, {2, 0xc4, 0x95}, {2, 0xc4, 0x96}, {2, 0xc4, 0x97},
+    {2, 0xc4, 0x98}, {2, 0xc4, 0x99}, {2, 0xc4, 0x9a}, {2, 0xc4, 0x9b}, {2, 0xc4, 0x9c}, {2, 0xc4, 0x9d}, {2, 0xc4, 0x9e}, {2, 0xc4, 0x9f},
+    {2, 0xc4, 0xa0}, {1, 0x21, 0x00}, {1, 0x22, 0x00}, {1, 0x23, 0x00}, {1, 0x24, 0x00}, {1, 0x25, 0x00}, {1, 0x26, 0x00}, {1, 0x27, 0x00},
+    {1, 0x28, 0x00}, {1, 0x29, 0x00}, {1, 0x2a, 0x00}, {1, 0x2b, 0x00}, {1, 0x2c, 0x00}, {1, 0x2d, 0x00}, {1, 0x2e, 0x00}, {1, 0x2f, 0x00},
+    {1, 0x30, 0x00}, {1, 0x31, 0x00}, {1, 0x32, 0x00}, {1, 0x33, 0x00}, {1, 0x34, 0x00}, {1, 0x35, 0x00}, {1, 0x36, 0x00}, {1, 0x37, 0x00},
+    {1, 0x38, 0x00}, {1, 0x39, 0x00}, {1, 0x3a, 0x00}, {1, 0x3b, 0x00}, {1, 0x3c, 0x00}, {1, 0x3d, 0x00}, {1, 0x3e, 0x00}, {1, 0x3f, 0x00},
+    {1, 0x40, 0x00}, {1, 0x41, 0x00}, {1, 0x42, 0x00}, {1, 0x43, 0x00}, {1, 0x44, 0x00}, {1, 0x45, 0x00}, {1, 0x46, 0x00}, {1, 0x47, 0x00},
+    {1, 0x48, 0x00}, {1, 0x49, 0x00}, {1, 0x4a, 0x00}, {1, 0x4b, 0x00}, {1, 0x4c, 0x00}, {1, 0x4d, 0x00}, {1, 0x4e, 0x00}, {1, 0x4f, 0x00},
+    {1, 0x50, 0x00}, {1, 0x51, 0x00}, {1, 0x52, 0x00}, {1, 0x53, 0x00}, {1, 0x54, 0x00}, {1, 0x55, 0x00}, {1, 0x56, 0x00}, {1, 0x57, 0x00},
+    {1, 0x58, 0x00}, {1, 0x59, 0x00}, {1, 0x5a, 0x00}, {1, 0x5b, 0x00}, {1, 0x5c, 0x00}, {1, 0x5d, 0x00}, {1, 0x5e, 0x00}, {1, 0x5f, 0x00},
+    {1, 0x60, 0x00}, {1, 0x61, 0x00}, {1, 0x62, 0x00}, {1, 0x63, 0x00}, {1, 0x64, 0x00}, {1, 0x65, 0x00}, {1, 0x66, 0x00}, {1, 0x67, 0x00},
+    {1, 0x68, 0x00}, {1, 0x69, 0x00}, {1, 0x6a, 0x00}, {1, 0x6b, 0x00}, {1, 0x6c, 0x00}, {1, 0x6d, 0x00}, {1, 0x6e, 0x00}, {1, 0x6f, 0x00},
+    {1, 0x70, 0x00}, {1, 0x71, 0x00}, {1, 0x72, 0x00}, {1, 0x73, 0x00}, {1, 0x74, 0x00}, {1, 0x75, 0x00}, {1, 0x76, 0x00}, {1, 0x77, 0x00},
+    {1, 0x78, 0x00}, {1, 0x79, 0x00}, {1, 0x7a, 0x00}, {1, 0x7b, 0x00}, {1, 0x7c, 0x00}, {1, 0x7d, 0x00}, {1, 0x7e, 0x00}, {2, 0xc4, 0xa1},
+    {2, 0xc4, 0xa2}, {2, 0xc4, 0xa3}, {2, 0xc4, 0xa4}, {2, 0xc4, 0xa5}, {2, 0xc4, 0xa6}, {2, 0xc4, 0xa7}, {2, 0xc4, 0xa8}, {2, 0xc4, 0xa9},
+    {2, 0xc4, 0xaa}, {2, 0xc4, 0xab}, {2, 0xc4, 0xac}, {2, 0xc4, 0xad}, {2, 0xc4, 0xae}, {2, 0xc4, 0xaf}, {2, 0xc4, 0xb0}, {2, 0xc4, 0xb1},
+    {2, 0xc4, 0xb2}, {2, 0xc4, 0xb3}, {2, 0xc4, 0xb4}, {2, 0xc4, 0xb5}, {2, 0xc4, 0xb6}, {2, 0xc4, 0xb7}, {2, 0xc4, 0xb8}, {2, 0xc4, 0xb9},
+    {2, 0xc4, 0xba}, {2, 0xc4, 0xbb}, {2, 0xc4, 0xbc}, {2, 0xc4, 0xbd}, {2, 0xc4, 0xbe}, {2, 0xc4, 0xbf}, {2, 0xc5, 0x80}, {2, 0xc5, 0x81},
+    {2, 0xc5, 0x82}, {2, 0xc2, 0xa1}, {2, 0xc2, 0xa2}, {2, 0xc2, 0xa3}, {2, 0xc2, 0xa4}, {2, 0xc2, 0xa5}, {2, 0xc2, 0xa6}, {2, 0xc2, 0xa7},
+    {2, 0xc2, 0xa8}, {2, 0xc2, 0xa9}, {2, 0xc2, 0xaa}, {2, 0xc2, 0xab}, {2, 0xc2, 0xac}, {2, 0xc5, 0x83}, {2, 0xc2, 0xae}, {2, 0xc2, 0xaf},
+    {2, 0xc2, 0xb0}, {2, 0xc2, 0xb1}, {2, 0xc2, 0xb2}, {2, 0xc2, 0xb3}, {2, 0xc2, 0xb4}, {2, 0xc2, 0xb5}, {2, 0xc2, 0xb6}, {2, 0xc2, 0xb7},
+    {2, 0xc2, 0xb8}, {2, 0xc2, 0xb9}, {2, 0xc2, 0xba}, {2, 0xc2, 0xbb}, {2, 0xc2, 0xbc}, {2, 0xc2, 0xbd}, {2, 0xc2, 0xbe}, {2, 0xc2, 0xbf},
+    {2, 0xc3, 0x80}, {2, 0xc3, 0x81}, {2, 0xc3, 0x82}, {2, 0xc3, 0x83}, {2, 0xc3, 0x84}, {2, 0xc3, 0x85}, {2, 0xc3, 0x86}, {2, 0xc3, 0x87},
+    {2, 0xc3, 0x88}, {2, 0xc3, 0x89}, {2, 0xc3, 0x8a}, {2, 0xc3, 0x8b}, {2, 0xc3, 0x8c}, {2, 0xc3, 0x8d}, {2, 0xc3, 0x8e}, {2, 0xc3, 0x8f},
+    {2, 0xc3, 0x90}, {2, 0xc3, 0x91}, {2, 0xc3, 0x92}, {2, 0xc3, 0x93}, {2, 0xc3, 0x94}, {2, 0xc3, 0x95}, {2, 0xc3, 0x96}, {2, 0xc3, 0x97},
+    {2, 0xc3, 0x98}, {2, 0xc3, 0x99}, {2, 0xc3, 0x9a}, {2, 0xc3, 0x9b}, {2, 0xc3, 0x9c}, {2, 0xc3, 0x9d}, {2, 0xc3, 0x9e}, {2, 0xc3, 0x9f},
+    {2, 0xc3, 0xa0}, {2, 0xc3, 0xa1}, {2, 0xc3, 0xa2}, {2, 0xc3, 0xa3}, {2, 0xc3, 0xa4}, {2, 0xc3, 0xa5}, {2, 0xc3, 0xa6}, {2, 0xc3, 0xa7},
+    {2, 0xc3, 0xa8}, {2, 0xc3, 0xa9}, {2, 0xc3, 0xaa}, {2, 0xc3, 0xab}, {2, 0xc3, 0xac}, {2, 0xc3, 0xad}, {2, 0xc3, 0xae}, {2, 0xc3, 0xaf},
+    {2, 0xc3, 0xb0}, {2, 0xc3, 0xb1}, {2, 0xc3, 0xb2}, {2, 0xc3, 0xb3}, {2, 0xc3, 0xb4}, {2, 0xc3, 0xb5}, {2, 0xc3, 0xb6}, {2, 0xc3, 0xb7},
+    {2, 0xc3, 0xb8}, {2, 0xc3, 0xb9}, {2, 0xc3, 0xba}, {2, 0xc3, 0xbb}, {2, 0xc3, 0xbc}, {2, 0xc3, 0xbd}, {2, 0xc3, 0xbe}, {2, 0xc3, 0xbf},
+};
+
+// byte of U+0100-U+0143
+static const uint8_t unicode_bpe_cpt_to_byte_hi[0x44] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x7f, 0x80, 0x81,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d,
+    0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xad,
+};
+
+static inline bool unicode_bpe_cpt_is_identity(uint32_t cpt) {
+    return (0x21 <= cpt && cpt <= 0x7E) || (0xA1 <= cpt && cpt <= 0xAC) || (0xAE <= cpt && cpt <= 0xFF);
 }
 
 #if 0
@@ -276,19 +262,104 @@ std::string unicode_cpt_to_utf8(uint32_t cp) {
     return std::string();
 }
 
+size_t unicode_cpt_to_utf8(uint32_t cp, char * out) {
+    if (cp <= 0x7f) {
+        out[0] = char(cp);
+        return 1;
+    }
+    if (cp <= 0x7ff) {
+        out[0] = char(0xc0 | (cp >> 6));
+        out[1] = char(0x80 | (cp & 0x3f));
+        return 2;
+    }
+    if (cp <= 0xffff) {
+        out[0] = char(0xe0 | (cp >> 12));
+        out[1] = char(0x80 | ((cp >> 6) & 0x3f));
+        out[2] = char(0x80 | (cp & 0x3f));
+        return 3;
+    }
+    if (cp <= 0x10ffff) {
+        out[0] = char(0xf0 | (cp >> 18));
+        out[1] = char(0x80 | ((cp >> 12) & 0x3f));
+        out[2] = char(0x80 | ((cp >> 6) & 0x3f));
+        out[3] = char(0x80 | (cp & 0x3f));
+        return 4;
+    }
+    return 0;
+}
+
+// two-stage delta table lookup. see gen-unicode-flags-table.cc
+static inline uint32_t unicode_cpt_map(const uint16_t * stage1, const int32_t * stage2, uint32_t cp) {
+    if (cp >= MAX_CODEPOINTS) {
+        return cp;
+    }
+    const uint32_t block = stage1[cp >> UNICODE_FLAGS_BLOCK_BITS];
+    return uint32_t(int32_t(cp) + stage2[(block << UNICODE_FLAGS_BLOCK_BITS) | (cp & UNICODE_FLAGS_BLOCK_MASK)]);
+}
+
+uint32_t unicode_cpt_nfd(uint32_t cp) {
+    return unicode_cpt_map(unicode_nfd_stage1, unicode_nfd_stage2, cp);
+}
+
 std::vector<uint32_t> unicode_cpts_normalize_nfd(const std::vector<uint32_t> & cpts) {
-    auto comp = [] (const uint32_t cpt, const range_nfd & range) {
-        return cpt < range.first;
-    };
     std::vector<uint32_t> result(cpts.size());
     for (size_t i = 0; i < cpts.size(); ++i) {
-        const uint32_t cpt = cpts[i];
-        auto it = std::upper_bound(unicode_ranges_nfd.begin(), unicode_ranges_nfd.end(), cpt, comp) - 1;
-        result[i] = (it->first <= cpt && cpt <= it->last) ? it->nfd : cpt;
+        result[i] = unicode_cpt_nfd(cpts[i]);
     }
     return result;
 }
 
+void unicode_normalize_utf8(const char * text, size_t size, int mode, std::string & out) {
+    const bool lower = (mode & UNICODE_NORMALIZE_LOWERCASE) != 0;
+    const bool nfd = (mode & UNICODE_NORMALIZE_NFD) != 0;
+
+    out.reserve(out.size() + size);
+    size_t i = 0;
+    while (i < size) {
+        // ASCII run: NFD is the identity and lowercase is A-Z only.
+        size_t j = i;
+        for (; j + 8 <= size; j += 8) {
+            uint64_t v;
+            memcpy(&v, text + j, 8);
+            if (v & 0x8080808080808080ULL) {
+                break;
+            }
+        }
+        while (j < size && !(text[j] & 0x80)) {
+            j++;
+        }
+        if (j > i) {
+            const size_t base = out.size();
+            out.append(text + i, j - i);
+            if (lower) {
+                for (size_t k = base; k < out.size(); k++) {
+                    const uint8_t c = uint8_t(out[k]);
+                    out[k] = char(c + ((uint8_t(c - 'A') < 26) ? 32 : 0));
+                }
+            }
+            i = j;
+            if (i == size) {
+                break;
+            }
+        }
+
+        const size_t start = i;
+        uint32_t cpt = unicode_cpt_from_utf8(text, size, i);
+        if (cpt >= MAX_CODEPOINTS) {
+            out.append(text + start, i - start);  // invalid UTF-8: keep as is
+            continue;
+        }
+        if (nfd) {
+            cpt = unicode_cpt_nfd(cpt);
+        }
+        if (lower) {
+            cpt = unicode_tolower(cpt);
+        }
+        char buf[4];
+        out.append(buf, unicode_cpt_to_utf8(cpt, buf));
+    }
+}
+
 std::vector<uint32_t> unicode_cpts_from_utf8(const std::string & utf8) {
     std::vector<uint32_t> result;
     result.reserve(utf8.size());
@@ -300,9 +371,12 @@ std::vector<uint32_t> unicode_cpts_from_utf8(const std::string & utf8) {
 }
 
 codepoint_flags unicode_cpt_flags(const uint32_t cp) {
-    static const codepoint_flags undef(codepoint_flags::UNDEFINED);
-    static const auto cpt_flags = unicode_cpt_flags_array();
-    return cp < cpt_flags.size() ? cpt_flags[cp] : undef;
+    // two-stage table lookup. see gen-unicode-flags-table.cc
+    if (cp >= MAX_CODEPOINTS) {
+        return codepoint_flags(codepoint_flags::UNDEFINED);
+    }
+    const uint32_t block = unicode_flags_stage1[cp >> UNICODE_FLAGS_BLOCK_BITS];
+    return codepoint_flags(unicode_flags_stage2[(block << UNICODE_FLAGS_BLOCK_BITS) | (cp & UNICODE_FLAGS_BLOCK_MASK)]);
 }
 
 codepoint_flags unicode_cpt_flags(const std::string & utf8) {
@@ -315,25 +389,89 @@ codepoint_flags unicode_cpt_flags(const std::string & utf8) {
 }
 
 std::string unicode_byte_to_utf8(uint8_t byte) {
-    static std::unordered_map<uint8_t, std::string> map = unicode_byte_to_utf8_map();
-    return map.at(byte);
+    const uint8_t * e = unicode_byte_bpe_utf8[byte];
+    return std::string(reinterpret_cast<const char *>(e + 1), e[0]);
 }
 
 uint8_t unicode_utf8_to_byte(const std::string & utf8) {
-    static std::unordered_map<std::string, uint8_t> map = unicode_utf8_to_byte_map();
-    return map.at(utf8);
+    size_t offset = 0;
+    const int byte = utf8.empty() ? -1 : unicode_bpe_cpt_to_byte(unicode_cpt_from_utf8(utf8, offset));
+    if (byte < 0 || offset != utf8.size()) {
+        throw std::out_of_range("unicode_utf8_to_byte");
+    }
+    return uint8_t(byte);
 }
 
-uint32_t unicode_tolower(uint32_t cp) {
-    // binary search
-    auto it = std::lower_bound(unicode_map_lowercase.begin(), unicode_map_lowercase.end(), cp,
-        [](const std::pair<uint32_t, uint32_t> & pair, uint32_t value) {
-            return pair.first < value;
-        });
-    if (it != unicode_map_lowercase.end() && it->first == cp) {
-        return it->second;
+int unicode_bpe_cpt_to_byte(uint32_t cpt) {
+    if (unicode_bpe_cpt_is_identity(cpt)) {
+        return int(cpt);
+    }
+    if (0x100 <= cpt && cpt < 0x144) {
+        return unicode_bpe_cpt_to_byte_hi[cpt - 0x100];
+    }
+    return -1;
+}
+
+size_t unicode_bytes_to_bpe_chars(const char * bytes, size_t size, char * out) {
+    size_t n = 0;
+    for (size_t i = 0; i < size; i++) {
+        // always copy 2 bytes, advance by the actual length.
+        const uint8_t * e = unicode_byte_bpe_utf8[uint8_t(bytes[i])];
+        out[n] = char(e[1]);
+        out[n + 1] = char(e[2]);
+        n += e[0];
     }
-    return cp;  // Return the original code point if no lowercase mapping is found
+    return n;
+}
+
+void unicode_bytes_to_bpe_chars(const char * bytes, size_t size, std::string & out) {
+    const size_t base = out.size();
+    out.resize(base + 2 * size);
+    out.resize(base + unicode_bytes_to_bpe_chars(bytes, size, &out[base]));
+}
+
+bool unicode_bpe_chars_to_bytes(const char * chars, size_t size, char * out, size_t & out_len) {
+    // mapped codepoints are U+0021-U+0143: 1-byte, or 2-byte with lead 0xC2-0xC5.
+    size_t n = 0;
+    size_t i = 0;
+    while (i < size) {
+        const uint8_t c = uint8_t(chars[i]);
+        if (c < 0x80) {
+            if (!unicode_bpe_cpt_is_identity(c)) {
+                return false;
+            }
+            out[n++] = char(c);
+            i += 1;
+            continue;
+        }
+        if (c < 0xC2 || c > 0xC5 || i + 1 >= size || (uint8_t(chars[i + 1]) & 0xC0) != 0x80) {
+            return false;
+        }
+        const int byte = unicode_bpe_cpt_to_byte((uint32_t(c & 0x1F) << 6) | (uint8_t(chars[i + 1]) & 0x3F));
+        if (byte < 0) {
+            return false;
+        }
+        out[n++] = char(byte);
+        i += 2;
+    }
+    out_len = n;
+    return true;
+}
+
+bool unicode_bpe_chars_to_bytes(const char * chars, size_t size, std::string & out) {
+    const size_t base = out.size();
+    out.resize(base + size);
+    size_t n = 0;
+    if (!unicode_bpe_chars_to_bytes(chars, size, &out[base], n)) {
+        out.resize(base);
+        return false;
+    }
+    out.resize(base + n);
+    return true;
+}
+
+uint32_t unicode_tolower(uint32_t cp) {
+    return unicode_cpt_map(unicode_lower_stage1, unicode_lower_stage2, cp);
 }
 
 #if 0
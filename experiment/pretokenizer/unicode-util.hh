@@ -23,6 +23,15 @@ struct codepoint_flags {
         MASK_CATEGORIES = 0x00FF,
     };
 
+    // `letter_type` values(0: not a letter)
+    enum {
+        LETTER_UPPERCASE = 1,  // regex: \p{Lu}
+        LETTER_LOWERCASE = 2,  // regex: \p{Ll}
+        LETTER_TITLECASE = 3,  // regex: \p{Lt}
+        LETTER_MODIFIER  = 4,  // regex: \p{Lm}
+        LETTER_OTHER     = 5,  // regex: \p{Lo}
+    };
+
     // codepoint type
     uint16_t is_undefined   : 1;
     uint16_t is_number      : 1;  // regex: \p{N}
@@ -37,6 +46,7 @@ struct codepoint_flags {
     uint16_t is_lowercase   : 1;
     uint16_t is_uppercase   : 1;
     uint16_t is_nfd         : 1;
+    uint16_t letter_type    : 3;  // LETTER_*, regex: \p{Lu} etc.
 
     // decode from uint16
     inline codepoint_flags(const uint16_t flags=0) {
@@ -55,16 +65,44 @@ struct codepoint_flags {
 size_t unicode_len_utf8(char src);
 
 std::string unicode_cpt_to_utf8(uint32_t cp);
+size_t unicode_cpt_to_utf8(uint32_t cp, char * out);  // 4 bytes. returns the length, 0 for invalid `cp`
 uint32_t unicode_cpt_from_utf8(const std::string & utf8, size_t & offset);
+uint32_t unicode_cpt_from_utf8(const char * utf8, size_t size, size_t & offset);
 std::vector<uint32_t> unicode_cpts_from_utf8(const std::string & utf8);
 
+uint32_t unicode_cpt_nfd(uint32_t cp);
 std::vector<uint32_t> unicode_cpts_normalize_nfd(const std::vector<uint32_t> & cpts);
 
+enum {
+    UNICODE_NORMALIZE_LOWERCASE = 1,
+    UNICODE_NORMALIZE_NFD       = 2,
+};
+
+// Apply `mode`(UNICODE_NORMALIZE_* bits, NFD first) to every codepoint of
+// `text` and append the result to `out`. ASCII runs are copied(and
+// lowercased) without decoding. Invalid UTF-8 bytes are kept as is.
+void unicode_normalize_utf8(const char * text, size_t size, int mode, std::string & out);
+
 codepoint_flags unicode_cpt_flags(const uint32_t cp);
 codepoint_flags unicode_cpt_flags(const std::string & utf8);
 
+// Byte-level BPE(GPT-2 `bytes_to_unicode`) mapping. Every byte maps to a
+// codepoint in U+0021-U+0143(1 or 2 UTF-8 bytes).
 std::string unicode_byte_to_utf8(uint8_t byte);
-uint8_t unicode_utf8_to_byte(const std::string & utf8);
+uint8_t unicode_utf8_to_byte(const std::string & utf8);  // throws std::out_of_range
+
+// Byte of a mapped codepoint, or -1.
+int unicode_bpe_cpt_to_byte(uint32_t cpt);
+
+// Map every byte of `bytes`. `out` needs room for 2 * `size` bytes.
+// Returns the number of bytes written.
+size_t unicode_bytes_to_bpe_chars(const char * bytes, size_t size, char * out);
+void unicode_bytes_to_bpe_chars(const char * bytes, size_t size, std::string & out);  // appends
+
+// Inverse of the above. `out` needs room for `size` bytes. Returns false
+// when `chars` contains a codepoint that is not a mapped byte.
+bool unicode_bpe_chars_to_bytes(const char * chars, size_t size, char * out, size_t & out_len);
+bool unicode_bpe_chars_to_bytes(const char * chars, size_t size, std::string & out);  // appends
 
 uint32_t unicode_tolower(uint32_t cp);
 
@@ -707,6 +707,18 @@ class array_bucket {
     return buffer_ptr - m_buffer;
   }
 
+ public:
+  /**
+   * Bytes allocated for m_buffer, END_OF_BUCKET included. O(n) as size().
+   */
+  std::size_t memory_usage() const noexcept {
+    if (m_buffer == nullptr) {
+      return 0;
+    }
+
+    return size() * sizeof(CharT) + sizeof(END_OF_BUCKET);
+  }
+
  private:
   static const key_size_type END_OF_BUCKET =
       std::numeric_limits<key_size_type>::max();
@@ -730,6 +742,10 @@ class value_container {
 
   void shrink_to_fit() { m_values.shrink_to_fit(); }
 
+  std::size_t values_memory_usage() const noexcept {
+    return m_values.capacity() * sizeof(T);
+  }
+
   friend void swap(value_container& lhs, value_container& rhs) {
     lhs.m_values.swap(rhs.m_values);
   }
@@ -749,6 +765,8 @@ class value_container<void> {
   void shrink_to_fit() {}
 
   void reserve(std::size_t /*new_cap*/) {}
+
+  std::size_t values_memory_usage() const noexcept { return 0; }
 };
 
 /**
@@ -1057,6 +1075,18 @@ class array_hash : private value_container<T>,
 
   size_type max_key_size() const noexcept { return MAX_KEY_SIZE; }
 
+  /**
+   * Heap bytes held: the bucket array, the bucket buffers and the values.
+   */
+  size_type memory_usage() const noexcept {
+    size_type bytes = m_buckets_data.capacity() * sizeof(array_bucket);
+    for (const array_bucket& bucket : m_buckets_data) {
+      bytes += bucket.memory_usage();
+    }
+
+    return bytes + value_container<T>::values_memory_usage();
+  }
+
   void shrink_to_fit() {
     clear_old_erased_values();
     value_container<T>::shrink_to_fit();
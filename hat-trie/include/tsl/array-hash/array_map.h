@@ -164,6 +164,11 @@ class array_map {
   size_type max_key_size() const noexcept { return m_ht.max_key_size(); }
   void shrink_to_fit() { m_ht.shrink_to_fit(); }
 
+  /**
+   * Heap bytes held: the bucket array, the bucket buffers and the values.
+   */
+  size_type memory_usage() const noexcept { return m_ht.memory_usage(); }
+
   /*
    * Modifiers
    */
@@ -429,6 +429,11 @@ class htrie_hash {
       return m_children.end();
     }
 
+    const std::array<std::unique_ptr<anode>, ALPHABET_SIZE>& children()
+        const noexcept {
+      return m_children;
+    }
+
     void set_child(CharT for_char, std::unique_ptr<anode> child) noexcept {
       if (child != nullptr) {
         child->m_child_of_char = for_char;
@@ -971,6 +976,19 @@ class htrie_hash {
     return array_hash_type::MAX_KEY_SIZE;
   }
 
+  /**
+   * Heap bytes held by the trie nodes (with their value nodes) and by the hash
+   * nodes (with their buckets and values).
+   */
+  void memory_usage(size_type& trie_node_bytes,
+                    size_type& hash_node_bytes) const noexcept {
+    trie_node_bytes = 0;
+    hash_node_bytes = 0;
+    if (m_root != nullptr) {
+      memory_usage_impl(*m_root, trie_node_bytes, hash_node_bytes);
+    }
+  }
+
   void shrink_to_fit() {
     auto first = begin();
     auto last = end();
@@ -1039,6 +1057,26 @@ class htrie_hash {
     }
   }
 
+  static void memory_usage_impl(const anode& node, size_type& trie_node_bytes,
+                                size_type& hash_node_bytes) noexcept {
+    if (node.is_hash_node()) {
+      hash_node_bytes +=
+          sizeof(hash_node) + node.as_hash_node().array_hash().memory_usage();
+      return;
+    }
+
+    const trie_node& tnode = node.as_trie_node();
+    trie_node_bytes += sizeof(trie_node);
+    if (tnode.val_node() != nullptr) {
+      trie_node_bytes += sizeof(value_node);
+    }
+    for (const auto& child : tnode.children()) {
+      if (child != nullptr) {
+        memory_usage_impl(*child, trie_node_bytes, hash_node_bytes);
+      }
+    }
+  }
+
   size_type erase_prefix(const CharT* prefix, size_type prefix_size) {
     if (m_root == nullptr) {
       return 0;
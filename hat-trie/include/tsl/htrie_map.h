@@ -143,6 +143,14 @@ class htrie_map {
    */
   void shrink_to_fit() { m_ht.shrink_to_fit(); }
 
+  /**
+   * Heap bytes held by the trie nodes and by the hash nodes of the map.
+   */
+  void memory_usage(size_type& trie_node_bytes,
+                    size_type& hash_node_bytes) const noexcept {
+    m_ht.memory_usage(trie_node_bytes, hash_node_bytes);
+  }
+
   /*
    * Modifiers
    */
@@ -0,0 +1,593 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "vocab_store.hh"
+
+namespace nanotokenizer {
+
+namespace louds_detail {
+
+inline uint32_t popcount64(uint64_t x) {
+#if defined(_MSC_VER)
+  return uint32_t(__popcnt64(x));
+#else
+  return uint32_t(__builtin_popcountll(x));
+#endif
+}
+
+inline uint32_t ctz64(uint64_t x) {
+#if defined(_MSC_VER)
+  unsigned long idx;
+  _BitScanForward64(&idx, x);
+  return uint32_t(idx);
+#else
+  return uint32_t(__builtin_ctzll(x));
+#endif
+}
+
+// kSelectInByte[b][k]: position of the `k`-th set bit of byte `b`.
+struct SelectInByteTable {
+  uint8_t pos[256][8];
+  SelectInByteTable() {
+    for (int b = 0; b < 256; b++) {
+      int k = 0;
+      for (int i = 0; i < 8; i++) {
+        if ((b >> i) & 1) {
+          pos[b][k++] = uint8_t(i);
+        }
+      }
+    }
+  }
+};
+
+// Position of the `k`-th(0-based) set bit of `x`. `x` has more than `k` set
+// bits.
+inline uint32_t select_in_word(uint64_t x, uint32_t k) {
+  static const SelectInByteTable table;
+  uint32_t shift = 0;
+  for (;; shift += 8) {
+    const uint32_t c = popcount64((x >> shift) & 0xFF);
+    if (k < c) {
+      break;
+    }
+    k -= c;
+  }
+  return shift + table.pos[(x >> shift) & 0xFF][k];
+}
+
+} // namespace louds_detail
+
+// Bit vector with rank and select.
+//
+// Ones are counted per 512-bit block(`_ranks`) for rank. The position of
+// every 64th one and zero is sampled, so select scans a few words from its
+// sample.
+class SuccinctBitVector {
+ public:
+  void push_back(bool bit) {
+    if ((_size % 64) == 0) {
+      _words.push_back(0);
+    }
+    if (bit) {
+      _words.back() |= uint64_t(1) << (_size % 64);
+    }
+    _size++;
+  }
+
+  // Build the rank and select directories. Call after the last `push_back`.
+  void build() {
+    _words.shrink_to_fit();
+    const size_t num_blocks = (_words.size() + kWordsPerBlock - 1) / kWordsPerBlock;
+    _ranks.assign(num_blocks + 1, 0);
+    _select0_samples.clear();
+    _select1_samples.clear();
+
+    size_t ones = 0;
+    for (size_t i = 0; i < _size; i++) {
+      if ((i % kBlockBits) == 0) {
+        _ranks[i / kBlockBits] = uint32_t(ones);
+      }
+      if ((*this)[i]) {
+        if ((ones % kSelectSample) == 0) {
+          _select1_samples.push_back(uint32_t(i));
+        }
+        ones++;
+      } else if (((i - ones) % kSelectSample) == 0) {
+        _select0_samples.push_back(uint32_t(i));
+      }
+    }
+    _ranks[num_blocks] = uint32_t(ones);
+    _num_ones = ones;
+    _ranks.shrink_to_fit();
+    _select0_samples.shrink_to_fit();
+    _select1_samples.shrink_to_fit();
+  }
+
+  bool operator[](size_t i) const { return (_words[i / 64] >> (i % 64)) & 1; }
+
+  size_t size() const { return _size; }
+  size_t num_ones() const { return _num_ones; }
+
+  // Ones in [0, i).
+  size_t rank1(size_t i) const {
+    const size_t b = i / kBlockBits;
+    size_t r = _ranks[b];
+    for (size_t w = b * kWordsPerBlock; w < i / 64; w++) {
+      r += louds_detail::popcount64(_words[w]);
+    }
+    if (i % 64) {
+      r += louds_detail::popcount64(_words[i / 64] & ((uint64_t(1) << (i % 64)) - 1));
+    }
+    return r;
+  }
+
+  size_t rank0(size_t i) const { return i - rank1(i); }
+
+  // Position of the `k`-th(0-based) one.
+  size_t select1(size_t k) const {
+    const size_t pos = _select1_samples[k / kSelectSample];
+    k %= kSelectSample;
+    size_t w = pos / 64;
+    uint64_t word = _words[w] & (~uint64_t(0) << (pos % 64));
+    for (;;) {
+      const uint32_t c = louds_detail::popcount64(word);
+      if (k < c) {
+        return w * 64 + louds_detail::select_in_word(word, uint32_t(k));
+      }
+      k -= c;
+      word = _words[++w];
+    }
+  }
+
+  // Position of the `k`-th(0-based) zero.
+  size_t select0(size_t k) const {
+    const size_t pos = _select0_samples[k / kSelectSample];
+    k %= kSelectSample;
+    size_t w = pos / 64;
+    uint64_t word = ~_words[w] & (~uint64_t(0) << (pos % 64));
+    for (;;) {
+      const uint32_t c = louds_detail::popcount64(word);
+      if (k < c) {
+        return w * 64 + louds_detail::select_in_word(word, uint32_t(k));
+      }
+      k -= c;
+      word = ~_words[++w];
+    }
+  }
+
+  // First zero at or after `i`. There must be one.
+  size_t next_zero(size_t i) const {
+    size_t w = i / 64;
+    uint64_t zeros = ~_words[w] & (~uint64_t(0) << (i % 64));
+    while (!zeros) {
+      zeros = ~_words[++w];
+    }
+    return w * 64 + louds_detail::ctz64(zeros);
+  }
+
+  size_t memory_usage() const {
+    return _words.capacity() * sizeof(uint64_t) +
+           (_ranks.capacity() + _select0_samples.capacity() + _select1_samples.capacity()) * sizeof(uint32_t);
+  }
+
+ private:
+  static constexpr size_t kWordsPerBlock = 8;
+  static constexpr size_t kBlockBits = kWordsPerBlock * 64;
+  static constexpr size_t kSelectSample = 64;
+
+  std::vector<uint64_t> _words;
+  size_t _size{0};
+  size_t _num_ones{0};
+  std::vector<uint32_t> _ranks;            // ones before each block
+  std::vector<uint32_t> _select0_samples;  // position of every kSelectSample-th zero
+  std::vector<uint32_t> _select1_samples;  // position of every kSelectSample-th one
+};
+
+// Array of unsigned integers packed with the bit width of the largest one.
+class PackedArray {
+ public:
+  void build(const std::vector<uint32_t> &values) {
+    uint32_t max_value = 0;
+    for (uint32_t v : values) {
+      max_value = (std::max)(max_value, v);
+    }
+    _width = 1;
+    while ((_width < 32) && (max_value >> _width)) {
+      _width++;
+    }
+    _size = values.size();
+    _words.assign((_size * _width + 63) / 64 + 1, 0);
+    for (size_t i = 0; i < _size; i++) {
+      const size_t pos = i * _width;
+      _words[pos / 64] |= uint64_t(values[i]) << (pos % 64);
+      if ((pos % 64) + _width > 64) {
+        _words[pos / 64 + 1] |= uint64_t(values[i]) >> (64 - (pos % 64));
+      }
+    }
+  }
+
+  uint32_t operator[](size_t i) const {
+    const size_t pos = i * _width;
+    uint64_t v = _words[pos / 64] >> (pos % 64);
+    if ((pos % 64) + _width > 64) {
+      v |= _words[pos / 64 + 1] << (64 - (pos % 64));
+    }
+    return uint32_t(v & ((uint64_t(1) << _width) - 1));
+  }
+
+  size_t size() const { return _size; }
+  size_t memory_usage() const { return _words.capacity() * sizeof(uint64_t); }
+
+ private:
+  std::vector<uint64_t> _words;
+  size_t _size{0};
+  uint32_t _width{1};
+};
+
+// Read-only succinct trie over byte strings, in the spirit of MARISA.
+//
+// - Topology: LOUDS bit vector(`1` per child, `0` closing each node, in BFS
+//   order, after a `10` super root). Node k is the k-th one; its children
+//   are the run after the k-th zero, so first child = select0(k) - k and
+//   parent = select1(k) - k - 1.
+// - `_labels[k]`: byte on the edge into node k. Siblings are sorted.
+// - Tail: a path that leads to a single token and branches no more is cut
+//   off and its bytes stored in `_tail`(suffixes shared, ends marked in
+//   `_tail_end`).
+// - `_terminal`: nodes ending a token(including tail nodes). The token id
+//   is looked up by rank in `_ids`; `_id_to_node` maps back for
+//   id -> string reconstruction by walking to the root.
+//
+// No pointers and no update metadata. Lookups cost a select per edge, so
+// it is slower than the double array tries; it is several times smaller.
+class LoudsTrie {
+ public:
+  // Longest token in bytes above the tail. Tokens with a deeper trie path
+  // are rejected by `build`.
+  static constexpr size_t kMaxDepth = 1024;
+
+  // Build from the non-empty tokens of `vocab`.
+  bool build(const VocabStore &vocab, std::string &err) {
+    clear();
+
+    std::vector<Word> words;
+    for (int id = 0; id < int(vocab.id_end()); id++) {
+      if (vocab.has(id) && vocab.length(id) > 0) {
+        words.push_back({vocab.data(id), vocab.length(id), uint32_t(id)});
+        _max_token_length = (std::max)(_max_token_length, vocab.length(id));
+      }
+    }
+    std::sort(words.begin(), words.end(), [](const Word &a, const Word &b) {
+      const int c = memcmp(a.data, b.data, (std::min)(a.size, b.size));
+      return (c != 0) ? (c < 0) : (a.size < b.size);
+    });
+
+    // BFS over ranges of `words` sharing a prefix of `depth` bytes. Node k
+    // is queue[k].
+    struct Range {
+      uint32_t lo, hi, depth;
+    };
+    std::vector<Range> queue;
+    queue.push_back({0, uint32_t(words.size()), 0});
+    _louds.push_back(true);
+    _louds.push_back(false);
+    std::vector<uint8_t> labels(1, 0);
+    std::vector<uint32_t> ids;
+    struct Tail {
+      const char *data;
+      uint32_t size;
+    };
+    std::vector<Tail> tails;
+
+    for (size_t k = 0; k < queue.size(); k++) {
+      uint32_t lo = queue[k].lo;
+      const uint32_t hi = queue[k].hi;
+      const uint32_t depth = queue[k].depth;
+      if (depth > kMaxDepth) {
+        err += "Token too long for LoudsTrie.\n";
+        return false;
+      }
+
+      bool terminal = false;
+      bool has_tail = false;
+      if ((lo < hi) && (words[lo].size == depth)) {
+        terminal = true;
+        ids.push_back(words[lo].id);
+        lo++;
+      } else if ((k > 0) && (hi - lo == 1)) {
+        terminal = true;
+        has_tail = true;
+        ids.push_back(words[lo].id);
+        tails.push_back({words[lo].data + depth, uint32_t(words[lo].size - depth)});
+        lo = hi;
+      }
+      _terminal.push_back(terminal);
+      _has_tail.push_back(has_tail);
+
+      while (lo < hi) {
+        const char label = words[lo].data[depth];
+        uint32_t end = lo + 1;
+        while ((end < hi) && (words[end].data[depth] == label)) {
+          end++;
+        }
+        queue.push_back({lo, end, depth + 1});
+        labels.push_back(uint8_t(label));
+        _louds.push_back(true);
+        lo = end;
+      }
+      _louds.push_back(false);
+    }
+    _num_nodes = queue.size();
+    std::vector<Range>().swap(queue);
+
+    _louds.build();
+    _terminal.build();
+    _has_tail.build();
+    _labels.swap(labels);
+    _labels.shrink_to_fit();
+    _ids.build(ids);
+
+    // id -> node(absent: _num_nodes).
+    std::vector<uint32_t> id_to_node(vocab.id_end(), uint32_t(_num_nodes));
+    for (size_t t = 0; t < ids.size(); t++) {
+      id_to_node[ids[t]] = uint32_t(_terminal.select1(t));
+    }
+    _id_to_node.build(id_to_node);
+
+    // select0 of the shallow nodes every walk starts with.
+    _shallow_select0.resize((std::min)(_num_nodes, kShallowNodes));
+    for (size_t k = 0; k < _shallow_select0.size(); k++) {
+      _shallow_select0[k] = uint32_t(_louds.select0(k));
+    }
+
+    build_tails(tails);
+    return true;
+  }
+
+  void clear() {
+    _louds = SuccinctBitVector();
+    _terminal = SuccinctBitVector();
+    _has_tail = SuccinctBitVector();
+    _labels.clear();
+    _ids = PackedArray();
+    _id_to_node = PackedArray();
+    _tail.clear();
+    _tail_end = SuccinctBitVector();
+    _tail_offsets = PackedArray();
+    _shallow_select0.clear();
+    _num_nodes = 0;
+    _max_token_length = 0;
+  }
+
+  size_t num_nodes() const { return _num_nodes; }
+  size_t max_token_length() const { return _max_token_length; }
+
+  // Longest token that is a prefix of `s[0, len)`. Returns its length(0:
+  // none) and stores its id to `id`.
+  size_t find_longest_prefix_length(const char *s, size_t len, int &id) const {
+    if (_num_nodes == 0) {
+      return 0;
+    }
+    size_t best = 0;
+    uint32_t node = 0;
+    for (size_t i = 0; i < len;) {
+      node = find_child(node, uint8_t(s[i]));
+      if (node == kNoNode) {
+        break;
+      }
+      i++;
+      if (_has_tail[node]) {
+        const size_t tail_len = match_tail(tail_offset(node), s + i, len - i);
+        if (tail_len) {
+          best = i + tail_len;
+          id = int(_ids[_terminal.rank1(node)]);
+        }
+        break;
+      }
+      if (_terminal[node]) {
+        best = i;
+        id = int(_ids[_terminal.rank1(node)]);
+      }
+    }
+    return best;
+  }
+
+  // Id of the token `s[0, len)`, -1 when not in the trie.
+  int find_exact(const char *s, size_t len) const {
+    int id = -1;
+    return (find_longest_prefix_length(s, len, id) == len && len > 0) ? id : -1;
+  }
+
+  bool has(int id) const {
+    return (id >= 0) && (size_t(id) < _id_to_node.size()) &&
+           (_id_to_node[size_t(id)] < _num_nodes);
+  }
+
+  // Byte length of the token `id`. `has(id)` must be true.
+  size_t token_length(int id) const {
+    uint32_t node = _id_to_node[size_t(id)];
+    size_t len = _has_tail[node] ? tail_length(tail_offset(node)) : 0;
+    for (; node != 0; node = parent(node)) {
+      len++;
+    }
+    return len;
+  }
+
+  // Write the token `id` to `out`(at least `token_length(id)` bytes).
+  // Returns the number of bytes written. `has(id)` must be true.
+  size_t copy_token(int id, char *out) const {
+    char path[kMaxDepth];
+    size_t depth = 0;
+    const uint32_t leaf = _id_to_node[size_t(id)];
+    for (uint32_t node = leaf; node != 0; node = parent(node)) {
+      path[depth++] = char(_labels[node]);
+    }
+    for (size_t i = 0; i < depth; i++) {
+      out[i] = path[depth - 1 - i];
+    }
+    if (!_has_tail[leaf]) {
+      return depth;
+    }
+    size_t offset = tail_offset(leaf);
+    size_t len = depth;
+    do {
+      out[len++] = _tail[offset];
+    } while (!_tail_end[offset++]);
+    return len;
+  }
+
+  std::string token(int id) const {
+    std::string s(token_length(id), '\0');
+    copy_token(id, &s[0]);
+    return s;
+  }
+
+  size_t louds_bytes() const {
+    return _louds.memory_usage() + _shallow_select0.capacity() * sizeof(uint32_t);
+  }
+  size_t label_bytes() const { return _labels.capacity(); }
+  size_t terminal_bytes() const {
+    return _terminal.memory_usage() + _ids.memory_usage() + _id_to_node.memory_usage();
+  }
+  size_t tail_bytes() const {
+    return _has_tail.memory_usage() + _tail.capacity() + _tail_end.memory_usage() + _tail_offsets.memory_usage();
+  }
+  size_t memory_usage() const {
+    return louds_bytes() + label_bytes() + terminal_bytes() + tail_bytes();
+  }
+
+ private:
+  static constexpr uint32_t kNoNode = 0xFFFFFFFFu;
+
+  // Nodes(in BFS order, so the root and the shallowest) whose select0 is
+  // precomputed. 16 KB; about 1.5x faster longest-prefix walks.
+  static constexpr size_t kShallowNodes = 4096;
+
+  struct Word {
+    const char *data;
+    size_t size;
+    uint32_t id;
+  };
+
+  uint32_t find_child(uint32_t node, uint8_t label) const {
+    // children: the run of ones after the `node`-th zero.
+    const size_t begin = ((node < _shallow_select0.size()) ? _shallow_select0[node] : _louds.select0(node)) + 1;
+    const size_t end = _louds.next_zero(begin);
+    const uint32_t first = uint32_t(begin - node - 1);
+    const uint8_t *lb = _labels.data() + first;
+    const uint8_t *le = lb + (end - begin);
+    if (end - begin <= 16) {
+      for (const uint8_t *p = lb; p != le; p++) {
+        if (*p >= label) {
+          return (*p == label) ? first + uint32_t(p - lb) : kNoNode;
+        }
+      }
+      return kNoNode;
+    }
+    const uint8_t *p = std::lower_bound(lb, le, label);
+    return (p != le && *p == label) ? first + uint32_t(p - lb) : kNoNode;
+  }
+
+  uint32_t parent(uint32_t node) const {
+    return uint32_t(_louds.select1(node) - node - 1);
+  }
+
+  size_t tail_offset(uint32_t node) const {
+    return _tail_offsets[_has_tail.rank1(node)];
+  }
+
+  size_t tail_length(size_t offset) const {
+    size_t len = 1;
+    while (!_tail_end[offset++]) {
+      len++;
+    }
+    return len;
+  }
+
+  // Length of the tail at `offset` when `s[0, len)` starts with it, else 0.
+  size_t match_tail(size_t offset, const char *s, size_t len) const {
+    for (size_t i = 0; i < len; i++) {
+      if (s[i] != _tail[offset + i]) {
+        return 0;
+      }
+      if (_tail_end[offset + i]) {
+        return i + 1;
+      }
+    }
+    return 0;
+  }
+
+  // Store tails(in node order) so that a tail which is a suffix of another
+  // shares its bytes.
+  template <class Tail>
+  void build_tails(const std::vector<Tail> &tails) {
+    std::vector<uint32_t> order(tails.size());
+    for (size_t i = 0; i < order.size(); i++) {
+      order[i] = uint32_t(i);
+    }
+    // reverse lexicographic order, longer first: a suffix follows the
+    // tails it is a suffix of.
+    std::sort(order.begin(), order.end(), [&tails](uint32_t a, uint32_t b) {
+      const Tail &ta = tails[a];
+      const Tail &tb = tails[b];
+      for (uint32_t i = 1; i <= ta.size && i <= tb.size; i++) {
+        const uint8_t ca = uint8_t(ta.data[ta.size - i]);
+        const uint8_t cb = uint8_t(tb.data[tb.size - i]);
+        if (ca != cb) {
+          return ca > cb;
+        }
+      }
+      return ta.size > tb.size;
+    });
+
+    std::vector<uint32_t> offsets(tails.size());
+    std::vector<bool> ends;
+    const Tail *last = nullptr;
+    size_t last_offset = 0;
+    for (uint32_t t : order) {
+      const Tail &tail = tails[t];
+      if (last && (last->size >= tail.size) &&
+          (memcmp(last->data + last->size - tail.size, tail.data, tail.size) == 0)) {
+        offsets[t] = uint32_t(last_offset + last->size - tail.size);
+        continue;
+      }
+      last = &tail;
+      last_offset = _tail.size();
+      offsets[t] = uint32_t(last_offset);
+      _tail.insert(_tail.end(), tail.data, tail.data + tail.size);
+      ends.resize(_tail.size(), false);
+      ends.back() = true;
+    }
+    _tail.shrink_to_fit();
+    for (size_t i = 0; i < ends.size(); i++) {
+      _tail_end.push_back(ends[i]);
+    }
+    _tail_offsets.build(offsets);
+  }
+
+  SuccinctBitVector _louds;
+  SuccinctBitVector _terminal;  // per node
+  SuccinctBitVector _has_tail;  // per node
+  std::vector<uint8_t> _labels;  // per node
+  PackedArray _ids;              // per terminal node
+  PackedArray _id_to_node;       // per token id
+  std::vector<char> _tail;
+  SuccinctBitVector _tail_end;   // per tail byte
+  PackedArray _tail_offsets;     // per tail node
+  std::vector<uint32_t> _shallow_select0;  // first kShallowNodes nodes
+  size_t _num_nodes{0};
+  size_t _max_token_length{0};
+};
+
+} // namespace nanotokenizer
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace nanotokenizer {
+
+// Bytes held by a tokenizer instance, broken down by component(trie nodes,
+// vocab strings, ...). Returned by the backends' `memory_usage()`.
+// Heap memory is counted by capacity; "instance" is the object itself.
+struct MemoryUsage {
+  struct Component {
+    std::string name;
+    size_t bytes;
+  };
+  std::vector<Component> components;
+
+  void add(const char *name, size_t bytes) {
+    components.push_back({name, bytes});
+  }
+
+  size_t total() const {
+    size_t bytes = 0;
+    for (const auto &c : components) {
+      bytes += c.bytes;
+    }
+    return bytes;
+  }
+
+  // One "name: bytes" line per component, then the total.
+  std::string str() const {
+    std::string s;
+    for (const auto &c : components) {
+      s += "  " + c.name + ": " + std::to_string(c.bytes) + "\n";
+    }
+    s += "  total: " + std::to_string(total()) + "\n";
+    return s;
+  }
+};
+
+} // namespace nanotokenizer
@@ -0,0 +1,1049 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <unordered_map>
+
+#define MINIJSON_IMPLEMENTATION
+#include "minijson.h"
+
+//
+#include "rwkv_world_tokenizer_cedar.hh"
+#include "rwkv_world_tokenizer_hat.hh"
+#include "rwkv_world_tokenizer_hybrid.hh"
+#include "rwkv_world_tokenizer_louds.hh"
+#include "rwkv_world_tokenizer_trie.hh"
+#include "decode_batch.hh"
+#include "special_tokens.hh"
+#include "vocab_store.hh"
+#include "workspace.hh"
+
+// Count heap allocations and live bytes(for the Workspace and trie load
+// checks). The requested size is kept in a header in front of each block,
+// as the VocabStore and LOUDS checks compare exact byte counts.
+// The operators stay out of line: inlined into a caller, GCC sees the
+// header arithmetic on a `new` result and warns(-Warray-bounds,
+// -Wmismatched-new-delete).
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+static std::atomic<size_t> g_num_allocs{0};
+static std::atomic<size_t> g_live_bytes{0};
+
+static const size_t kAllocHeader = 16;
+
+BENCH_NOINLINE void *operator new(size_t size) {
+  g_num_allocs.fetch_add(1, std::memory_order_relaxed);
+  g_live_bytes.fetch_add(size, std::memory_order_relaxed);
+  char *p = static_cast<char *>(std::malloc(size + kAllocHeader));
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  memcpy(p, &size, sizeof(size));
+  return p + kAllocHeader;
+}
+
+BENCH_NOINLINE void operator delete(void *p) noexcept {
+  if (!p) {
+    return;
+  }
+  char *base = static_cast<char *>(p) - kAllocHeader;
+  size_t size;
+  memcpy(&size, base, sizeof(size));
+  g_live_bytes.fetch_sub(size, std::memory_order_relaxed);
+  std::free(base);
+}
+
+BENCH_NOINLINE void operator delete(void *p, size_t) noexcept {
+  operator delete(p);
+}
+
+static bool load_vocab_json(const std::string &filename,
+                            std::map<std::string, int> &str_to_id_map) {
+  std::ifstream ifs(filename);
+  if (!ifs) {
+    std::cerr << "file not found or open file failed: " << filename << "\n";
+    return false;
+  }
+
+  std::stringstream buf;
+  buf << ifs.rdbuf();
+  std::string s = buf.str();
+
+  const char *p = s.c_str();
+
+  minijson::value v;
+  minijson::error e = minijson::parse(p, v);
+  if (e != minijson::no_error) {
+    std::cerr << minijson::errstr(e) << "\n";
+    return false;
+  }
+
+  const auto *po = v.as<minijson::object>();
+  if (!po) {
+    std::cerr << "Invalid JSON. Root element must be object: " << filename
+              << "\n";
+    return false;
+  }
+
+  for (size_t i = 0; i < po->size(); i++) {
+    std::string key = po->keys()[i];
+
+    minijson::value num_v;
+    if (!po->at(key, &num_v)) {
+      return false;
+    }
+    const auto *pv = num_v.as<minijson::number>();
+    if (!pv) {
+      return false;
+    }
+    str_to_id_map[key] = int(*pv);
+  }
+
+  return true;
+}
+
+static std::string make_corpus(size_t nbytes) {
+  const char *samples[] = {
+      "The quick brown fox jumps over the lazy dog. ",
+      "In the beginning was the Word, and the Word was with God. ",
+      u8"吾輩は猫である。名前はまだ無い。",
+      "    return EXIT_SUCCESS;\n",
+      "1234567890, 3.14159265358979\n",
+      u8"Привет, мир! 🤩 ",
+  };
+  const size_t nsamples = sizeof(samples) / sizeof(samples[0]);
+
+  std::string s;
+  for (size_t i = 0; s.size() < nbytes; i++) {
+    s += samples[(i * 7) % nsamples];
+  }
+  return s;
+}
+
+// Reference: repeatedly take the earliest `std::string::find` hit over all
+// special tokens(longest on ties). Hits are cached per token.
+static void partition_naive(const std::string &text,
+                            const std::vector<std::string> &tokens,
+                            const std::vector<int> &ids,
+                            std::vector<nanotokenizer::TextSegment> &segments) {
+  segments.clear();
+  std::vector<size_t> next(tokens.size());  // cached find() result per token
+  for (size_t t = 0; t < tokens.size(); t++) {
+    next[t] = text.find(tokens[t]);
+  }
+  size_t pos = 0;
+  while (pos < text.size()) {
+    size_t best = std::string::npos;
+    size_t best_len = 0;
+    int best_id = -1;
+    for (size_t t = 0; t < tokens.size(); t++) {
+      if (next[t] != std::string::npos && next[t] < pos) {
+        next[t] = text.find(tokens[t], pos);
+      }
+      const size_t p = next[t];
+      if (p < best || (p == best && p != std::string::npos && tokens[t].size() > best_len)) {
+        best = p;
+        best_len = tokens[t].size();
+        best_id = ids[t];
+      }
+    }
+    if (best == std::string::npos) {
+      break;
+    }
+    if (best > pos) {
+      segments.push_back({pos, best - pos, -1});
+    }
+    segments.push_back({best, best_len, best_id});
+    pos = best + best_len;
+  }
+  if (pos < text.size()) {
+    segments.push_back({pos, text.size() - pos, -1});
+  }
+}
+
+static double elapsed_sec(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// Reference: the former TrieTree layout, one heap node with a hash map of
+// children per vocab prefix.
+struct PointerTrieTree {
+  std::unordered_map<int, std::unique_ptr<PointerTrieTree>> children;
+  std::string word;
+  int token_id{-1};
+
+  PointerTrieTree() = default;
+  PointerTrieTree(const std::unordered_map<std::string, int> &word2id) {
+    for (auto &pair : word2id) {
+      add_word(pair.first, pair.second, 0);
+    }
+  }
+
+  size_t find_longest_prefix_length(const char *s, size_t s_offset,
+                                    size_t s_len, int &id) const {
+    size_t best = 0;
+    const PointerTrieTree *node = this;
+    for (size_t i = s_offset; i < s_len; ++i) {
+      auto it = node->children.find(s[i]);
+      if (it == node->children.end()) {
+        break;
+      }
+      node = it->second.get();
+      if (node->token_id >= 0) {
+        best = node->word.size();
+        id = node->token_id;
+      }
+    }
+    return best;
+  }
+
+ private:
+  void add_word(const std::string &w, int id, size_t idx) {
+    if (idx == w.size()) {
+      word = w;
+      token_id = id;
+      return;
+    }
+    auto &child = children[w[idx]];
+    if (!child) {
+      child.reset(new PointerTrieTree());
+    }
+    child->add_word(w, id, idx + 1);
+  }
+  std::stringstream _err_ss;
+};
+
+// Build and destroy `Trie` from `word2id`(best of 3); report time,
+// allocations and bytes held.
+template <class Trie>
+static void measure_trie_load(const char *name,
+                              const std::unordered_map<std::string, int> &word2id,
+                              double &build_sec, double &destroy_sec,
+                              size_t &allocs, size_t &bytes) {
+  build_sec = destroy_sec = 1e30;
+  for (int i = 0; i < 3; i++) {
+    const size_t allocs_start = g_num_allocs.load();
+    const size_t bytes_start = g_live_bytes.load();
+    auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<Trie> trie(new Trie(word2id));
+    build_sec = (std::min)(build_sec, elapsed_sec(start));
+    allocs = g_num_allocs.load() - allocs_start;
+    bytes = g_live_bytes.load() - bytes_start;
+
+    start = std::chrono::steady_clock::now();
+    trie.reset();
+    destroy_sec = (std::min)(destroy_sec, elapsed_sec(start));
+  }
+  std::cout << "  " << name << ": build " << build_sec * 1000.0
+            << " ms, destroy " << destroy_sec * 1000.0 << " ms, " << allocs
+            << " allocs, " << bytes / 1024 << " KB\n";
+}
+
+// Encode `texts` with a warmed-up Workspace: ids must match
+// `encode(text, std::vector<int> &)` and no allocation may happen.
+template <class Tokenizer>
+static bool check_workspace(const char *name, Tokenizer &tokenizer,
+                            const std::vector<std::string> &texts) {
+  nanotokenizer::Workspace ws;
+  std::vector<int> ids;
+  for (const auto &text : texts) {
+    if (!tokenizer.encode(text, ws) || !tokenizer.encode(text, ids) ||
+        ws.ids != ids) {
+      std::cerr << name << ": Workspace encode mismatch.\n";
+      return false;
+    }
+  }
+
+  const size_t nrepeat = 4;
+  const size_t allocs = g_num_allocs.load();
+  auto start = std::chrono::steady_clock::now();
+  size_t nbytes = 0;
+  for (size_t i = 0; i < nrepeat; i++) {
+    for (const auto &text : texts) {
+      if (!tokenizer.encode(text, ws)) {
+        std::cerr << name << ": encode failed.\n";
+        return false;
+      }
+      nbytes += text.size();
+    }
+  }
+  const double ws_sec = elapsed_sec(start);
+  const size_t ws_allocs = g_num_allocs.load() - allocs;
+
+  const size_t legacy_allocs_start = g_num_allocs.load();
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < nrepeat; i++) {
+    for (const auto &text : texts) {
+      std::vector<int> out;
+      if (!tokenizer.encode(text, out)) {
+        std::cerr << name << ": encode failed.\n";
+        return false;
+      }
+    }
+  }
+  const double legacy_sec = elapsed_sec(start);
+  const size_t legacy_allocs = g_num_allocs.load() - legacy_allocs_start;
+
+  const double mb = double(nbytes) / (1024.0 * 1024.0);
+  std::cout << "  " << name << ": vector " << mb / legacy_sec << " MB/s ("
+            << legacy_allocs << " allocs), workspace " << mb / ws_sec
+            << " MB/s (" << ws_allocs << " allocs, " << ws.memory_usage() / 1024
+            << " KB)\n";
+  if (ws_allocs != 0) {
+    std::cerr << name << ": Workspace encode allocated after warm-up.\n";
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  std::string vocab_json_filename = "rwkv_vocab_v20230424.json";
+
+  if (argc > 1) {
+    vocab_json_filename = argv[1];
+  }
+
+  std::map<std::string, int> str_to_id_map;
+  if (!load_vocab_json(vocab_json_filename, str_to_id_map)) {
+    return -1;
+  }
+
+  const std::string corpus = make_corpus(4 * 1024 * 1024);
+
+  // decode: vocab id maps vs fixed-slot table(single pass). About 2.4x on
+  // the 4 MB corpus(e.g. 512 vs 1225 MB/s).
+  {
+    nanotokenizer::CedarTrieTokenizer tokenizer(false);
+
+    std::string err;
+    if (!tokenizer.load_vocab(str_to_id_map, err)) {
+      std::cerr << "Load vocab failed: " << err << "\n";
+      return -1;
+    }
+
+    std::vector<int> ids;
+    if (!tokenizer.encode(corpus, ids)) {
+      std::cerr << "encode failed.\n";
+      return -1;
+    }
+
+    // Same vocab without the slot table: `decode` goes through the id maps.
+    nanotokenizer::CedarTrieTokenizer map_tokenizer(false);
+    if (!map_tokenizer.load_vocab(str_to_id_map, err)) {
+      std::cerr << "Load vocab failed: " << err << "\n";
+      return -1;
+    }
+
+    if (!tokenizer.build_slot_decode_table()) {
+      std::cerr << "build_slot_decode_table failed.\n";
+      return -1;
+    }
+
+    // Interleaved, best of `nrepeat`: timings on a shared host drift.
+    const size_t nrepeat = 10;
+    std::string map_out, out;
+    double map_sec = 1e30, slot_sec = 1e30;
+    for (size_t i = 0; i < nrepeat; i++) {
+      auto start = std::chrono::steady_clock::now();
+      if (!map_tokenizer.decode(ids, map_out)) {
+        std::cerr << "decode failed.\n";
+        return -1;
+      }
+      map_sec = (std::min)(map_sec, elapsed_sec(start));
+
+      start = std::chrono::steady_clock::now();
+      if (!tokenizer.decode(ids, out)) {
+        std::cerr << "decode failed.\n";
+        return -1;
+      }
+      slot_sec = (std::min)(slot_sec, elapsed_sec(start));
+    }
+    if (map_out != corpus) {
+      std::cerr << "decode(map) mismatch.\n";
+      return -1;
+    }
+    if (out != corpus) {
+      std::cerr << "decode(slot) mismatch.\n";
+      return -1;
+    }
+
+    const double mb = double(corpus.size()) / (1024.0 * 1024.0);
+    std::cout << "decode: " << ids.size() << " ids, " << corpus.size()
+              << " bytes\n";
+    std::cout << "  id_to_str_map : " << mb / map_sec << " MB/s\n";
+    std::cout << "  slot table    : " << mb / slot_sec << " MB/s ("
+              << map_sec / slot_sec << "x)\n";
+
+    // batch decode: split ids into ragged sequences.
+    std::vector<size_t> id_offsets{0};
+    for (size_t i = 0; id_offsets.back() < ids.size(); i++) {
+      size_t seqlen = 64 + (i * 37) % 512;
+      size_t end = id_offsets.back() + seqlen;
+      // Do not split a UTF-8 byte fallback sequence.
+      while (end < ids.size() && (ids[end] > 128) && (ids[end] < 193)) {
+        end++;
+      }
+      id_offsets.push_back((std::min)(end, ids.size()));
+    }
+    const size_t nseq = id_offsets.size() - 1;
+
+    std::vector<std::string> outs(nseq);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nrepeat; i++) {
+      for (size_t s = 0; s < nseq; s++) {
+        std::vector<int> seq(ids.begin() + id_offsets[s],
+                             ids.begin() + id_offsets[s + 1]);
+        if (!tokenizer.decode(seq, outs[s])) {
+          std::cerr << "decode failed.\n";
+          return -1;
+        }
+      }
+    }
+    double serial_sec = elapsed_sec(start);
+
+    std::vector<size_t> out_offsets;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nrepeat; i++) {
+      if (!nanotokenizer::decode_batch(tokenizer, ids.data(), id_offsets.data(),
+                                       nseq, out_offsets, out)) {
+        std::cerr << "decode_batch failed.\n";
+        return -1;
+      }
+    }
+    double batch_sec = elapsed_sec(start);
+    if (out != corpus) {
+      std::cerr << "decode_batch mismatch.\n";
+      return -1;
+    }
+
+    std::cout << "decode_batch: " << nseq << " sequences, "
+              << std::thread::hardware_concurrency() << " threads\n";
+    std::cout << "  per-sequence decode : " << mb * nrepeat / serial_sec << " MB/s\n";
+    std::cout << "  decode_batch        : " << mb * nrepeat / batch_sec << " MB/s ("
+              << serial_sec / batch_sec << "x)\n";
+  }
+
+  // special-token partition: trie + first-byte prefilter vs find() loop
+  {
+    const std::vector<std::string> tokens = {
+        "<|endoftext|>", "<|im_start|>", "<|im_end|>", "<|im_start|>system",
+        "<|im_start|>user", "<|im_start|>assistant", "<|fim_prefix|>",
+        "<|fim_middle|>", "<|fim_suffix|>", "<|tool_call|>",
+    };
+    std::vector<int> ids;
+    nanotokenizer::SpecialTokenMatcher matcher;
+    std::string err;
+    for (size_t t = 0; t < tokens.size(); t++) {
+      ids.push_back(65500 + int(t));
+      if (!matcher.add(tokens[t], ids.back(), err)) {
+        std::cerr << err;
+        return -1;
+      }
+    }
+    matcher.build();
+
+    // chat transcript: a turn every ~2 KB, plus some near misses.
+    std::string prompt;
+    for (size_t i = 0; prompt.size() < corpus.size(); i++) {
+      prompt += tokens[4 + (i % 2)];
+      prompt += "\n";
+      size_t begin = (i * 2048) % (corpus.size() - 4096);
+      size_t end = begin + 2048;
+      // do not cut a UTF-8 character.
+      while ((corpus[begin] & 0xC0) == 0x80) {
+        begin++;
+      }
+      while ((corpus[end] & 0xC0) == 0x80) {
+        end++;
+      }
+      prompt += corpus.substr(begin, end - begin);
+      prompt += "<|im_end|>\n<|im_en <| a < b |>";
+    }
+
+    const size_t nrepeat = 10;
+    std::vector<nanotokenizer::TextSegment> segments;
+    std::vector<nanotokenizer::TextSegment> naive_segments;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nrepeat; i++) {
+      matcher.partition(prompt.data(), prompt.size(), segments);
+    }
+    double matcher_sec = elapsed_sec(start);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nrepeat; i++) {
+      partition_naive(prompt, tokens, ids, naive_segments);
+    }
+    double naive_sec = elapsed_sec(start);
+
+    bool same = segments.size() == naive_segments.size();
+    for (size_t i = 0; same && i < segments.size(); i++) {
+      same = segments[i].offset == naive_segments[i].offset &&
+             segments[i].length == naive_segments[i].length &&
+             segments[i].special_id == naive_segments[i].special_id;
+    }
+    if (!same) {
+      std::cerr << "special-token partition mismatch.\n";
+      return -1;
+    }
+
+    const double mb = double(prompt.size() * nrepeat) / (1024.0 * 1024.0);
+    std::cout << "special tokens: " << tokens.size() << " tokens, "
+              << segments.size() << " segments, " << prompt.size()
+              << " bytes\n";
+    std::cout << "  find() loop : " << mb / naive_sec << " MB/s\n";
+    std::cout << "  matcher     : " << mb / matcher_sec << " MB/s ("
+              << naive_sec / matcher_sec << "x)\n";
+
+    // plain segments go to the backend.
+    nanotokenizer::CedarTrieTokenizer tokenizer(false);
+    if (!tokenizer.load_vocab(str_to_id_map, err)) {
+      std::cerr << "Load vocab failed: " << err << "\n";
+      return -1;
+    }
+    std::vector<int> out_ids;
+    if (!nanotokenizer::encode_with_special_tokens(
+            matcher, prompt, out_ids,
+            [&tokenizer](const std::string &plain, std::vector<int> &plain_ids) {
+              return tokenizer.encode(plain, plain_ids);
+            })) {
+      std::cerr << "encode_with_special_tokens failed.\n";
+      return -1;
+    }
+    size_t nspecial = 0;
+    for (const int id : out_ids) {
+      nspecial += (id >= 65500) ? 1 : 0;
+    }
+    size_t expected_special = 0;
+    for (const auto &seg : segments) {
+      expected_special += (seg.special_id >= 0) ? 1 : 0;
+    }
+    if (nspecial != expected_special) {
+      std::cerr << "special token ids missing from encoded output.\n";
+      return -1;
+    }
+  }
+
+  // TrieTree load: flat node array vs heap node per prefix.
+  {
+    std::unordered_map<std::string, int> word2id;
+    for (const auto &it : str_to_id_map) {
+      if (!it.first.empty() && !((it.second > 127) && (it.second < 257))) {
+        word2id[it.first] = it.second;
+      }
+    }
+    std::cout << "trie load: " << word2id.size() << " words\n";
+
+    double ptr_build, ptr_destroy, flat_build, flat_destroy;
+    size_t ptr_allocs, ptr_bytes, flat_allocs, flat_bytes;
+    measure_trie_load<PointerTrieTree>("pointer nodes", word2id, ptr_build,
+                                       ptr_destroy, ptr_allocs, ptr_bytes);
+    measure_trie_load<nanotokenizer::TrieTree>("flat nodes   ", word2id,
+                                               flat_build, flat_destroy,
+                                               flat_allocs, flat_bytes);
+    std::cout << "  build " << ptr_build / flat_build << "x, destroy "
+              << ptr_destroy / flat_destroy << "x, memory "
+              << double(ptr_bytes) / double(flat_bytes) << "x smaller\n";
+
+    // longest match must agree at every position.
+    std::unique_ptr<PointerTrieTree> ptr_trie(new PointerTrieTree(word2id));
+    std::unique_ptr<nanotokenizer::TrieTree> flat_trie(
+        new nanotokenizer::TrieTree(word2id));
+    for (size_t i = 0; i < 256 * 1024; i++) {
+      int ptr_id = -1;
+      int flat_id = -1;
+      const size_t ptr_len = ptr_trie->find_longest_prefix_length(
+          corpus.data(), i, corpus.size(), ptr_id);
+      const size_t flat_len = flat_trie->find_longest_prefix_length(
+          corpus.data(), i, corpus.size(), flat_id);
+      if (ptr_len != flat_len || (ptr_len && ptr_id != flat_id)) {
+        std::cerr << "TrieTree longest match mismatch at " << i << ".\n";
+        return -1;
+      }
+    }
+  }
+
+  // Vocab storage: one VocabStore per backend instead of a token -> id and
+  // an id -> token map next to the trie.
+  {
+    auto live_bytes_of = [](const std::function<void()> &fn) {
+      const size_t bytes_start = g_live_bytes.load();
+      fn();
+      return g_live_bytes.load() - bytes_start;
+    };
+
+    std::unique_ptr<std::unordered_map<std::string, int>> str_to_id;
+    std::unique_ptr<std::unordered_map<int, std::string>> id_to_str;
+    const size_t maps_bytes = live_bytes_of([&]() {
+      str_to_id.reset(new std::unordered_map<std::string, int>());
+      id_to_str.reset(new std::unordered_map<int, std::string>());
+      for (const auto &it : str_to_id_map) {
+        (*str_to_id)[it.first] = it.second;
+        (*id_to_str)[it.second] = it.first;
+      }
+    });
+    str_to_id.reset();
+    id_to_str.reset();
+
+    nanotokenizer::VocabStore vocab;
+    std::string err;
+    const size_t store_bytes = live_bytes_of([&]() {
+      vocab.build(str_to_id_map,
+                  [](const std::string &, int) { return true; }, err);
+    });
+    std::cout << "vocab storage: " << str_to_id_map.size() << " tokens\n";
+    std::cout << "  two maps(before): " << maps_bytes / 1024 << " KB\n";
+    std::cout << "  VocabStore      : " << store_bytes / 1024 << " KB ("
+              << double(maps_bytes) / double(store_bytes) << "x smaller)\n";
+    if (vocab.memory_usage() != store_bytes) {
+      std::cerr << "VocabStore::memory_usage mismatch: "
+                << vocab.memory_usage() << " vs " << store_bytes << "\n";
+      return -1;
+    }
+
+    std::unique_ptr<nanotokenizer::TrieTokenizer> trie;
+    std::unique_ptr<nanotokenizer::HatTrieTokenizer> hat;
+    std::unique_ptr<nanotokenizer::CedarTrieTokenizer> cedar;
+    std::unique_ptr<nanotokenizer::CedarTrieTokenizer> icedar;
+    bool ok = true;
+    const size_t trie_bytes = live_bytes_of([&]() {
+      trie.reset(new nanotokenizer::TrieTokenizer());
+      ok &= trie->load_vocab(str_to_id_map, err);
+    });
+    const size_t hat_bytes = live_bytes_of([&]() {
+      hat.reset(new nanotokenizer::HatTrieTokenizer());
+      ok &= hat->load_vocab(str_to_id_map, err);
+    });
+    const size_t cedar_bytes = live_bytes_of([&]() {
+      cedar.reset(new nanotokenizer::CedarTrieTokenizer(false));
+      ok &= cedar->load_vocab(str_to_id_map, err);
+    });
+    const size_t icedar_bytes = live_bytes_of([&]() {
+      icedar.reset(new nanotokenizer::CedarTrieTokenizer(true));
+      ok &= icedar->load_vocab(str_to_id_map, err);
+    });
+    if (!ok) {
+      std::cerr << "Load vocab failed: " << err << "\n";
+      return -1;
+    }
+    std::cout << "  loaded trie            : " << trie_bytes / 1024 << " KB\n";
+    std::cout << "  loaded hat-trie        : " << hat_bytes / 1024 << " KB\n";
+    std::cout << "  loaded cedar           : " << cedar_bytes / 1024 << " KB\n";
+    std::cout << "  loaded cedar(codepoint): " << icedar_bytes / 1024 << " KB\n";
+
+    // memory_usage() must account for what the allocator saw. hat-trie's
+    // bucket buffers and the byte cedar's arrays come from std::malloc and
+    // bypass the counting operator new, so there the report can only be
+    // checked to cover the measured bytes.
+    auto check_usage = [](const char *name,
+                          const nanotokenizer::MemoryUsage &usage,
+                          size_t measured, bool all_new) {
+      const double ratio = double(usage.total()) / double(measured);
+      std::cout << "  memory_usage " << name << ": " << usage.total() / 1024
+                << " KB (" << ratio * 100.0 << "% of operator new bytes)\n";
+      if ((ratio < (all_new ? 0.95 : 1.0)) || (all_new && ratio > 1.05)) {
+        std::cerr << "memory_usage of " << name << " is off:\n" << usage.str();
+        return false;
+      }
+      return true;
+    };
+    if (!check_usage("trie", trie->memory_usage(), trie_bytes, true) ||
+        !check_usage("hat-trie", hat->memory_usage(), hat_bytes, false) ||
+        !check_usage("cedar", cedar->memory_usage(), cedar_bytes, false) ||
+        !check_usage("cedar(codepoint)", icedar->memory_usage(), icedar_bytes,
+                     true)) {
+      return -1;
+    }
+
+    // token <-> id through the shared storage.
+    for (const auto &it : str_to_id_map) {
+      if (it.first.empty() || ((it.second > 126) && (it.second < 257))) {
+        continue;
+      }
+      if (trie->TokenToId(it.first) != it.second ||
+          hat->TokenToId(it.first) != it.second ||
+          cedar->TokenToId(it.first) != it.second ||
+          icedar->TokenToId(it.first) != it.second) {
+        std::cerr << "TokenToId mismatch for id " << it.second << "\n";
+        return -1;
+      }
+      if (trie->IdToToken(it.second) != it.first ||
+          hat->IdToToken(it.second) != it.first ||
+          cedar->IdToToken(it.second) != it.first ||
+          icedar->IdToToken(it.second) != it.first) {
+        std::cerr << "IdToToken mismatch for id " << it.second << "\n";
+        return -1;
+      }
+    }
+    if (trie->TokenToId("\xff\xfe no such token") != -1 ||
+        hat->TokenToId("\xff\xfe no such token") != -1 ||
+        cedar->TokenToId("\xff\xfe no such token") != -1 ||
+        icedar->TokenToId("\xff\xfe no such token") != -1) {
+      std::cerr << "TokenToId found a token not in the vocab.\n";
+      return -1;
+    }
+  }
+
+  // Succinct trie(LOUDS + tail) vs cedar double array: memory and speed.
+  {
+    std::string err;
+    std::unique_ptr<nanotokenizer::CedarTrieTokenizer> cedar;
+    std::unique_ptr<nanotokenizer::LoudsTrieTokenizer> louds;
+    double cedar_load_sec, louds_load_sec;
+    size_t cedar_bytes = g_live_bytes.load();
+    auto start = std::chrono::steady_clock::now();
+    cedar.reset(new nanotokenizer::CedarTrieTokenizer(false));
+    bool ok = cedar->load_vocab(str_to_id_map, err);
+    cedar_load_sec = elapsed_sec(start);
+    cedar_bytes = g_live_bytes.load() - cedar_bytes;
+    size_t louds_bytes = g_live_bytes.load();
+    start = std::chrono::steady_clock::now();
+    louds.reset(new nanotokenizer::LoudsTrieTokenizer());
+    ok = ok && louds->load_vocab(str_to_id_map, err);
+    louds_load_sec = elapsed_sec(start);
+    louds_bytes = g_live_bytes.load() - louds_bytes;
+    if (!ok) {
+      std::cerr << "Load vocab failed: " << err << "\n";
+      return -1;
+    }
+    if (louds->memory_usage().total() != louds_bytes) {
+      std::cerr << "LoudsTrieTokenizer memory_usage mismatch: "
+                << louds->memory_usage().total() << " vs " << louds_bytes
+                << "\n" << louds->memory_usage().str();
+      return -1;
+    }
+
+    // same ids as cedar, and back to the text.
+    std::vector<int> cedar_ids, louds_ids;
+    const size_t nrepeat = 3;
+    double cedar_enc = 1e30, louds_enc = 1e30;
+    for (size_t i = 0; i < nrepeat; i++) {
+      start = std::chrono::steady_clock::now();
+      ok = cedar->encode(corpus, cedar_ids);
+      cedar_enc = (std::min)(cedar_enc, elapsed_sec(start));
+      start = std::chrono::steady_clock::now();
+      ok = ok && louds->encode(corpus, louds_ids);
+      louds_enc = (std::min)(louds_enc, elapsed_sec(start));
+      if (!ok) {
+        std::cerr << "encode failed.\n";
+        return -1;
+      }
+    }
+    if (cedar_ids != louds_ids) {
+      std::cerr << "LoudsTrieTokenizer ids differ from cedar.\n";
+      return -1;
+    }
+
+    std::string out;
+    double cedar_dec = 1e30, louds_dec = 1e30;
+    for (size_t i = 0; i < nrepeat; i++) {
+      start = std::chrono::steady_clock::now();
+      ok = cedar->decode(cedar_ids, out) && (out == corpus);
+      cedar_dec = (std::min)(cedar_dec, elapsed_sec(start));
+      start = std::chrono::steady_clock::now();
+      ok = ok && louds->decode(louds_ids, out) && (out == corpus);
+      louds_dec = (std::min)(louds_dec, elapsed_sec(start));
+      if (!ok) {
+        std::cerr << "decode failed or mismatch.\n";
+        return -1;
+      }
+    }
+    size_t len = 0;
+    if (!louds->decoded_length(louds_ids.data(), louds_ids.size(), len) ||
+        len != corpus.size() ||
+        !louds->decode_into(louds_ids.data(), louds_ids.size(), &out[0], len,
+                            len) ||
+        out != corpus) {
+      std::cerr << "LoudsTrieTokenizer decode_into mismatch.\n";
+      return -1;
+    }
+
+    for (const auto &it : str_to_id_map) {
+      if (it.first.empty() || ((it.second > 127) && (it.second < 257))) {
+        continue;
+      }
+      if (louds->TokenToId(it.first) != it.second ||
+          louds->IdToToken(it.second) != it.first) {
+        std::cerr << "LoudsTrieTokenizer token <-> id mismatch for id "
+                  << it.second << "\n";
+        return -1;
+      }
+    }
+
+    const double mb = double(corpus.size()) / (1024.0 * 1024.0);
+    std::cout << "louds vs cedar: " << corpus.size() << " bytes\n";
+    std::cout << "  cedar: " << cedar->memory_usage().total() / 1024
+              << " KB, load " << cedar_load_sec * 1000.0 << " ms, encode "
+              << mb / cedar_enc << " MB/s, decode " << mb / cedar_dec
+              << " MB/s\n";
+    std::cout << "  louds: " << louds_bytes / 1024 << " KB, load "
+              << louds_load_sec * 1000.0 << " ms, encode " << mb / louds_enc
+              << " MB/s, decode " << mb / louds_dec << " MB/s\n";
+    std::cout << "  memory " << double(cedar->memory_usage().total()) /
+                                    double(louds_bytes)
+              << "x smaller, encode " << cedar_enc / louds_enc
+              << "x, decode " << cedar_dec / louds_dec << "x\n";
+  }
+
+  // Frozen cedar: update-only arrays released after load.
+  {
+    // `variant`: 0 = as loaded, 1 = frozen, 2 = frozen into huge pages.
+    auto run = [&](bool use_codepoint, int variant, std::vector<int> &ids,
+                   double &enc_sec, size_t &bytes) {
+      std::string err;
+      nanotokenizer::CedarTrieTokenizer tokenizer(use_codepoint);
+      if (!tokenizer.load_vocab(str_to_id_map, err)) {
+        std::cerr << "Load vocab failed: " << err << "\n";
+        return false;
+      }
+      if ((variant > 0) && !tokenizer.freeze(/* use_huge_pages */ variant == 2)) {
+        std::cout << "  (huge page mapping failed; frozen on the heap)\n";
+      }
+      if (variant > 0) {
+        for (const auto &c : tokenizer.memory_usage().components) {
+          if ((c.name.find("ninfo") != std::string::npos ||
+               c.name.find("blocks") != std::string::npos) &&
+              c.bytes != 0) {
+            std::cerr << "frozen cedar still holds " << c.name << "\n";
+            return false;
+          }
+        }
+      }
+      bytes = tokenizer.memory_usage().total();
+
+      enc_sec = 1e30;
+      for (size_t i = 0; i < 3; i++) {
+        auto start = std::chrono::steady_clock::now();
+        if (!tokenizer.encode(corpus, ids)) {
+          std::cerr << "encode failed.\n";
+          return false;
+        }
+        enc_sec = (std::min)(enc_sec, elapsed_sec(start));
+      }
+      for (const auto &it : str_to_id_map) {
+        if (it.first.empty() || ((it.second > 127) && (it.second < 257))) {
+          continue;
+        }
+        if (tokenizer.TokenToId(it.first) != it.second) {
+          std::cerr << "frozen cedar TokenToId mismatch for id " << it.second
+                    << "\n";
+          return false;
+        }
+      }
+      return true;
+    };
+
+    const double mb = double(corpus.size()) / (1024.0 * 1024.0);
+    std::cout << "frozen cedar: " << corpus.size() << " bytes\n";
+    const char *names[] = {"loaded", "frozen", "frozen, huge pages"};
+    std::vector<int> byte_ids;
+    for (bool use_codepoint : {false, true}) {
+      std::vector<int> base_ids;
+      for (int variant = 0; variant < (use_codepoint ? 2 : 3); variant++) {
+        std::vector<int> ids;
+        double enc_sec;
+        size_t bytes;
+        if (!run(use_codepoint, variant, ids, enc_sec, bytes)) {
+          return -1;
+        }
+        if (variant == 0) {
+          base_ids = ids;
+        } else if (ids != base_ids) {
+          std::cerr << "frozen cedar ids differ.\n";
+          return -1;
+        }
+        // codepoint mode(labels from CodepointAlphabet, incl. U+1F929 in
+        // the corpus) matches the same tokens as byte mode.
+        if (!use_codepoint) {
+          byte_ids = ids;
+        } else if (ids != byte_ids) {
+          std::cerr << "cedar codepoint ids differ from byte mode.\n";
+          return -1;
+        }
+        std::cout << "  " << (use_codepoint ? "codepoint" : "byte") << ", "
+                  << names[variant] << ": " << bytes / 1024 << " KB, encode "
+                  << mb / enc_sec << " MB/s\n";
+      }
+    }
+  }
+
+  // Hybrid traversal(ASCII by byte, other characters by codepoint label) vs
+  // both cedar modes on English, Japanese and mixed text.
+  {
+    std::string err;
+    nanotokenizer::CedarTrieTokenizer cedar(false);
+    nanotokenizer::CedarTrieTokenizer icedar(true);
+    nanotokenizer::HybridCedarTokenizer hybrid;
+    if (!cedar.load_vocab(str_to_id_map, err) ||
+        !icedar.load_vocab(str_to_id_map, err) ||
+        !hybrid.load_vocab(str_to_id_map, err)) {
+      std::cerr << "Load vocab failed: " << err << "\n";
+      return -1;
+    }
+    cedar.freeze();
+    icedar.freeze();
+    hybrid.freeze();
+
+    auto repeat = [](const char *text, size_t nbytes) {
+      std::string s;
+      while (s.size() < nbytes) {
+        s += text;
+      }
+      return s;
+    };
+    const size_t nbytes = 4 * 1024 * 1024;
+    const std::string english = repeat(
+        "The quick brown fox jumps over the lazy dog. It was the best of "
+        "times, it was the worst of times. ", nbytes);
+    const std::string japanese = repeat(
+        u8"吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。",
+        nbytes);
+    const std::string mixed = repeat(
+        u8"Tokyo(東京) is the capital of Japan. 吾輩は猫である。 "
+        u8"The cat says にゃん 🤩. ", nbytes);
+    struct Text {
+      const char *name;
+      const std::string *str;
+    };
+    const Text texts[] = {{"english", &english}, {"japanese", &japanese},
+                          {"mixed", &mixed}, {"corpus", &corpus}};
+
+    // Timings swing a lot between rounds on a shared machine, so the ratio
+    // to byte mode is the median of per-round ratios.
+    std::cout << "hybrid vs cedar(MB/s, hybrid speedup over byte mode):\n";
+    for (const Text &text : texts) {
+      std::vector<int> byte_ids, cp_ids, hybrid_ids;
+      double byte_sec = 1e30, cp_sec = 1e30, hybrid_sec = 1e30;
+      std::vector<double> ratios;
+      for (size_t i = 0; i < 9; i++) {
+        auto start = std::chrono::steady_clock::now();
+        bool ok = cedar.encode(*text.str, byte_ids);
+        const double byte_round = elapsed_sec(start);
+        start = std::chrono::steady_clock::now();
+        ok = ok && icedar.encode(*text.str, cp_ids);
+        cp_sec = (std::min)(cp_sec, elapsed_sec(start));
+        start = std::chrono::steady_clock::now();
+        ok = ok && hybrid.encode(*text.str, hybrid_ids);
+        const double hybrid_round = elapsed_sec(start);
+        if (!ok) {
+          std::cerr << "encode failed.\n";
+          return -1;
+        }
+        byte_sec = (std::min)(byte_sec, byte_round);
+        hybrid_sec = (std::min)(hybrid_sec, hybrid_round);
+        ratios.push_back(byte_round / hybrid_round);
+      }
+      std::sort(ratios.begin(), ratios.end());
+      if ((hybrid_ids != byte_ids) || (cp_ids != byte_ids)) {
+        std::cerr << "HybridCedarTokenizer ids differ on " << text.name
+                  << " text.\n";
+        return -1;
+      }
+      std::string out;
+      if (!hybrid.decode(hybrid_ids, out) || (out != *text.str)) {
+        std::cerr << "HybridCedarTokenizer decode mismatch.\n";
+        return -1;
+      }
+
+      const double mb = double(text.str->size()) / (1024.0 * 1024.0);
+      std::cout << "  " << text.name << ": byte " << mb / byte_sec
+                << ", codepoint " << mb / cp_sec << ", hybrid "
+                << mb / hybrid_sec << "(" << ratios[ratios.size() / 2]
+                << "x)\n";
+    }
+
+    for (const auto &it : str_to_id_map) {
+      if (it.first.empty() || ((it.second > 127) && (it.second < 257))) {
+        continue;
+      }
+      if (hybrid.TokenToId(it.first) != it.second ||
+          hybrid.IdToToken(it.second) != it.first) {
+        std::cerr << "HybridCedarTokenizer token <-> id mismatch for id "
+                  << it.second << "\n";
+        return -1;
+      }
+    }
+    std::cout << "  memory: byte " << cedar.memory_usage().total() / 1024
+              << " KB, codepoint " << icedar.memory_usage().total() / 1024
+              << " KB, hybrid " << hybrid.memory_usage().total() / 1024
+              << " KB\n";
+  }
+
+  // Workspace: no allocation once warmed up.
+  {
+    // documents of mixed sizes, cut at UTF-8 character boundaries.
+    std::vector<std::string> texts;
+    for (size_t begin = 0, i = 0; begin < 512 * 1024; i++) {
+      size_t end = (std::min)(begin + 1024 + (i * 7919) % (64 * 1024), corpus.size());
+      while (end < corpus.size() && (corpus[end] & 0xC0) == 0x80) {
+        end++;
+      }
+      texts.push_back(corpus.substr(begin, end - begin));
+      begin = end;
+    }
+
+    std::cout << "workspace: " << texts.size() << " documents\n";
+    std::string err;
+
+    nanotokenizer::TrieTokenizer trie;
+    nanotokenizer::HatTrieTokenizer hat;
+    nanotokenizer::CedarTrieTokenizer cedar(false);
+    nanotokenizer::CedarTrieTokenizer icedar(true);
+    if (!trie.load_vocab(str_to_id_map, err) ||
+        !hat.load_vocab(str_to_id_map, err) ||
+        !cedar.load_vocab(str_to_id_map, err) ||
+        !icedar.load_vocab(str_to_id_map, err)) {
+      std::cerr << "Load vocab failed: " << err << "\n";
+      return -1;
+    }
+    if (!check_workspace("trie", trie, texts) ||
+        !check_workspace("hat-trie", hat, texts) ||
+        !check_workspace("cedar", cedar, texts) ||
+        !check_workspace("cedar(codepoint)", icedar, texts)) {
+      return -1;
+    }
+
+    // special tokens + plain text through one workspace.
+    nanotokenizer::SpecialTokenMatcher matcher;
+    if (!matcher.add("<|endoftext|>", 0, err)) {
+      std::cerr << err;
+      return -1;
+    }
+    matcher.build();
+    const std::string doc = texts[0] + "<|endoftext|>" + texts[1];
+    nanotokenizer::Workspace ws;
+    auto encode_plain = [&cedar](const char *text, size_t size,
+                                 nanotokenizer::Workspace &w) {
+      return cedar.encode_append(text, size, w);
+    };
+    size_t allocs = 0;
+    for (size_t i = 0; i < 3; i++) {
+      if (i == 2) {
+        allocs = g_num_allocs.load();
+      }
+      if (!nanotokenizer::encode_with_special_tokens(matcher, doc.data(),
+                                                     doc.size(), ws,
+                                                     encode_plain)) {
+        std::cerr << "encode_with_special_tokens(Workspace) failed.\n";
+        return -1;
+      }
+    }
+    if (g_num_allocs.load() != allocs) {
+      std::cerr << "encode_with_special_tokens(Workspace) allocated after "
+                   "warm-up.\n";
+      return -1;
+    }
+    std::cout << "  special tokens: 0 allocs\n";
+  }
+
+  return EXIT_SUCCESS;
+}
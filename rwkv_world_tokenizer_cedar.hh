@@ -2,36 +2,45 @@
 // Copyright 2024 - Present, Light Transport Entertainment, Inc.
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <unordered_map>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 #include "cedar.h"
 #include "ccedar_core.h"
+#include "codepoint_alphabet.hh"
+#include "memory_usage.hh"
+#include "slot_decode_table.hh"
+#include "vocab_store.hh"
+#include "workspace.hh"
 
 namespace nanotokenizer {
 
 // Trie tokenizer based on ccedar
 class CedarTrieTokenizer {
  public:
-  static constexpr size_t MAX_KEY_BITS = 16;  // 65536
+  // Label bits of the codepoint trie. Codepoints are remapped to dense
+  // labels(see CodepointAlphabet): with 8 bits, ASCII and the 128 most
+  // frequent other codepoints take one label, the rest two.
+  static constexpr size_t MAX_KEY_BITS = 8;
 
   using trie_t = cedar::da<int>; // Key = UTF-8 bytes
-  using itrie_t = ccedar::da<int, int, MAX_KEY_BITS>; // Key = UTF codepoint(int value)
+  using itrie_t = ccedar::da<int, int, MAX_KEY_BITS>; // Key = CodepointAlphabet labels
 
   CedarTrieTokenizer() = default;
   CedarTrieTokenizer(bool use_codepoint = false) : _use_codepoint(use_codepoint) {}
   ~CedarTrieTokenizer() {
-    // free memory in cedar
-    if (_use_codepoint) {
-      _ida.clear(/* reuse */false);
-    } else {
-      _cda.clear(/* reuse */ false);
-      if (_cda.array()) {  // work around for _array is not free'ed in ccedar
-        std::free(const_cast<void *>(_cda.array()));
-      }
-    }
+    // free memory in cedar. The huge page array is not owned by `_cda`.
+    _ida.clear(/* reuse */false);
+    _cda.clear(/* reuse */ false);
+    release_huge_pages();
   }
 
   bool load_vocab(const std::map<std::string, int> &str_to_id_map, std::string &err) {
@@ -47,21 +56,52 @@ class CedarTrieTokenizer {
       } else if ((it.second > 127) && (it.second < 257)) {
         // reserved for UTF-8 byte fallbacl
         continue;
-      } else {
-        _id_to_str_map[it.second] = it.first;
       }
       max_id = (std::max)(max_id, it.second);
-
-      _str_to_id_map[it.first] = it.second;
     }
 
     if (max_id > 65535) {
       err += "Vocab ID exceeds 65535\n";
       return false;
     }
+
+    // id -> token. token -> id is answered by the trie.
+    auto keep = [](const std::string &token, int id) {
+      return !token.empty() && !((id > 127) && (id < 257));
+    };
+    if (!_vocab.build(str_to_id_map, keep, err)) {
+      return false;
+    }
     _utf8_id_offset = 1;  // ASCII character is +1'ed in RWKV world vocab
 
+    if (_frozen) {
+      // start over from updatable tries.
+      _cda.clear();
+      _ida.clear();
+      release_huge_pages();
+      _frozen = false;
+    }
+
     if (_use_codepoint) {
+      // alphabet: codepoints of the tokens, frequent ones first.
+      std::unordered_map<uint32_t, size_t> counts;
+      for (const auto &it : str_to_id_map) {
+        const char *str = it.first.c_str();
+        const size_t slen = strlen(str);
+        int charlen{0};
+        for (size_t i = 0; i < slen; i += size_t(charlen)) {
+          const uint32_t code = to_codepoint(str + i, charlen);
+          if (charlen == 0) {
+            break;  // not UTF-8: never matched in codepoint mode
+          }
+          counts[code]++;
+        }
+      }
+      if (!_alphabet.build(counts, int(MAX_KEY_BITS), err)) {
+        return false;
+      }
+
+      std::vector<int> ikey;
       for (const auto &it : str_to_id_map) {
         const char *str = it.first.c_str();
         const size_t slen = strlen(str);
@@ -71,18 +111,15 @@ class CedarTrieTokenizer {
           continue;
         }
 
-        // UTF-8 string to int(unicode) array
-        std::vector<int> ikey;
-
-        int charlen{0};
-        for (size_t i = 0; i < slen; i += charlen) {
-          int code = to_codepoint(it.first.c_str() + i, charlen);
-          ikey.push_back(code);
+        // UTF-8 string to labels
+        if (!to_labels(str, slen, ikey)) {
+          continue;
         }
 
         _ida.update(ikey.data(), ikey.size(), it.second);
       }
     } else {
+      _alphabet.clear();
       for (const auto &it : str_to_id_map) {
         const char *str = it.first.c_str();
         const size_t slen = strlen(str);
@@ -99,20 +136,250 @@ class CedarTrieTokenizer {
     return true;
   }
 
+  // Make the tries read-only: drop the sibling lists(ninfo) and block
+  // management arrays cedar keeps for insertion, trim the node array to the
+  // used blocks and release the trie the mode does not use.
+  // With `use_huge_pages`, the byte trie's node array is moved into a
+  // 2 MB aligned, read-only mapping advised for transparent huge pages
+  // (Linux only). Returns false when that mapping fails; the tries are
+  // frozen on the heap in that case.
+  // Call after `load_vocab`. `load_vocab` again rebuilds from scratch.
+  bool freeze(bool use_huge_pages = false) {
+    if (_use_codepoint) {
+      _ida.freeze();
+      _cda.clear(/* reuse */ false);
+    } else {
+      _cda.freeze();
+      _ida.clear(/* reuse */ false);
+      _ida.freeze();  // releases what clear() keeps
+    }
+    _frozen = true;
+
+    if (use_huge_pages && !_use_codepoint && !_huge_array) {
+      return relocate_to_huge_pages();
+    }
+    return true;
+  }
+
+  bool frozen() const { return _frozen; }
+
+  // Bytes of the huge page mapping holding the byte trie, or 0.
+  size_t huge_page_bytes() const { return _huge_array_bytes; }
+
   bool encode(const std::string &s, std::vector<int> &output_ids) {
+    output_ids.clear();
+    return encode_utf8(s.c_str(), s.size(), output_ids);
+  }
 
-    std::vector<int> dst;
+  // Encode into `ws.ids`. See `Workspace`.
+  bool encode(const std::string &s, Workspace &ws) {
+    ws.reset();
+    return encode_append(s.data(), s.size(), ws);
+  }
 
-    if (s.empty()) {
+  // Append ids of `s` to `ws.ids`. Temporaries(the decoded codepoints in
+  // codepoint mode) live in the arena of `ws`.
+  bool encode_append(const char *s, size_t s_len, Workspace &ws) {
+    if (s_len == 0) {
       return true;
     }
+    if (_use_codepoint) {
+      return encode_codepoints(s, s_len, ws);
+    }
+    return encode_utf8(s, s_len, ws.ids);
+  }
 
-    const size_t s_len = s.size();
+  // Build fixed-slot decode table(see SlotDecodeTable).
+  // Once built, `decoded_length`/`decode_into`/`decode` use it.
+  // Call after `load_vocab`.
+  bool build_slot_decode_table() {
+    return _slot_table.build(_vocab, 1, 256 + _utf8_id_offset, _utf8_id_offset);
+  }
 
+  // Number of bytes `decode_into` writes for `input_ids`.
+  // Returns false when `input_ids` contains an unknown id or a broken UTF-8
+  // byte sequence.
+  bool decoded_length(const int *input_ids, size_t n, size_t &len) const {
+    if (!_slot_table.empty()) {
+      return _slot_table.decoded_length(input_ids, n, len);
+    }
+
+    len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(input_ids, i, n, _utf8_id_offset);
+        if (char_len == 0) {
+          std::cerr << "utf8 reconstruct failed.\n";
+          return false;
+        }
+        i += char_len - 1;
+        len += char_len;
+        continue;
+      }
+
+      if (!_vocab.has(input_ids[i])) {
+        std::cerr << "id not found: " << input_ids[i] << "\n";
+        return false;
+      }
+      len += _vocab.length(input_ids[i]);
+    }
+    return true;
+  }
+
+  // Decode `input_ids` into `out` without allocating.
+  // `cap` must be at least `decoded_length(input_ids, n)`. The number of bytes
+  // written is stored to `out_len`. No null terminator is appended.
+  bool decode_into(const int *input_ids, size_t n, char *out, size_t cap, size_t &out_len) const {
+    if (!_slot_table.empty()) {
+      return _slot_table.decode_into(input_ids, n, out, cap, out_len);
+    }
+
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(input_ids, i, n, _utf8_id_offset);
+        if ((char_len == 0) || ((len + char_len) > cap)) {
+          return false;
+        }
+        for (size_t c = 0; c < char_len; c++) {
+          out[len++] = char(uint8_t(input_ids[i + c] - _utf8_id_offset));
+        }
+        i += char_len - 1;
+        continue;
+      }
+
+      if (!_vocab.has(input_ids[i])) {
+        return false;
+      }
+      const size_t token_len = _vocab.length(input_ids[i]);
+      if ((len + token_len) > cap) {
+        return false;
+      }
+      memcpy(out + len, _vocab.data(input_ids[i]), token_len);
+      len += token_len;
+    }
+    out_len = len;
+    return true;
+  }
+
+  bool decode(const std::vector<int> &input_ids, std::string &output_str) {
+    if (!_slot_table.empty()) {
+      return _slot_table.decode(input_ids.data(), input_ids.size(), output_str);
+    }
+
+    // pass 1: compute exact output size. pass 2: copy tokens.
+    size_t len{0};
+    if (!decoded_length(input_ids.data(), input_ids.size(), len)) {
+      return false;
+    }
+
+    output_str.resize(len);
+    if (len == 0) {
+      return true;
+    }
+    return decode_into(input_ids.data(), input_ids.size(), &output_str[0], len, len);
+  }
+
+  std::string str_from_id(int id) {
+    if (_vocab.has(id)) {
+      return _vocab.token(id);
+    }
+    if (id > 0 && id < 257) {  // ASCII or UTF-8 byte
+      return "[[byte]]";
+    }
+    return std::string();
+  }
+
+  // Token of `id`, or an empty string.
+  std::string IdToToken(int id) const {
+    return _vocab.has(id) ? _vocab.token(id) : std::string();
+  }
+
+  // Exact match in the trie. -1 when `token` is not in the vocab.
+  int TokenToId(const std::string &token) {
+    if (token.empty()) {
+      return -1;
+    }
+    if (memchr(token.data(), 0, token.size())) {
+      // Not in the trie(keys end at NUL, see `load_vocab`). "\0" is encoded
+      // with its byte fallback id.
+      return (token.size() == 1) ? _utf8_id_offset : -1;
+    }
+    int id;
+    if (_use_codepoint) {
+      std::vector<int> ikey;
+      if (!to_labels(token.data(), token.size(), ikey)) {
+        return -1;
+      }
+      id = _ida.exactMatchSearch<int>(ikey.data(), ikey.size());
+    } else {
+      id = _cda.exactMatchSearch<int>(token.data(), token.size());
+    }
+    return (id < 0) ? -1 : id;
+  }
+
+  // Bytes held by this tokenizer, by component. Both tries exist, the one
+  // not used by the mode holds only its initial block.
+  MemoryUsage memory_usage() const {
+    MemoryUsage usage;
+    usage.add("instance", sizeof(*this));
+    usage.add("byte trie array", _huge_array ? _huge_array_bytes : _cda.array_bytes());
+    usage.add("byte trie ninfo", _cda.ninfo_bytes());
+    usage.add("byte trie blocks", _cda.block_bytes());
+    usage.add("codepoint trie array", _ida.array_bytes());
+    usage.add("codepoint trie ninfo", _ida.ninfo_bytes());
+    usage.add("codepoint trie blocks", _ida.block_bytes());
+    usage.add("codepoint alphabet", _alphabet.memory_usage());
+    usage.add("vocab strings", _vocab.string_bytes());
+    usage.add("vocab offsets", _vocab.offset_bytes());
+    usage.add("slot decode table", _slot_table.memory_usage());
+    return usage;
+  }
+
+ private:
+  itrie_t _ida; // int key
+  trie_t _cda; // char key
+  CodepointAlphabet _alphabet;  // codepoint -> `_ida` labels
+
+  // Follow the packed labels(see CodepointAlphabet) of one codepoint in
+  // `_ida`. One label, the common case, is the packed code itself.
+  int traverse_labels(const int &labels, size_t &from, size_t &pos) const {
+    if (labels < 0x10000) {
+      return _ida.traverse(&labels, from, pos, /* len */1);
+    }
+    int lab[2];
+    CodepointAlphabet::labels(uint32_t(labels), lab);
+    return _ida.traverse(lab, from, pos, /* len */2);
+  }
+
+  // Labels of UTF-8 string `s` to `ikey`. false when `s` is not UTF-8 or
+  // has a codepoint outside the alphabet(then it is not in the vocab).
+  bool to_labels(const char *s, const size_t s_len, std::vector<int> &ikey) {
+    ikey.clear();
+    int charlen{0};
+    for (size_t i = 0; i < s_len; i += size_t(charlen)) {
+      const uint32_t code = to_codepoint(s + i, charlen);
+      if ((charlen == 0) || (i + size_t(charlen) > s_len)) {
+        return false;
+      }
+      const uint32_t labels = _alphabet.code(code);
+      if (labels == 0) {
+        return false;
+      }
+      int lab[2];
+      const uint32_t n = CodepointAlphabet::labels(labels, lab);
+      ikey.insert(ikey.end(), lab, lab + n);
+    }
+    return true;
+  }
+
+  // Longest match from each position, UTF-8 byte fallback otherwise.
+  // Appends to `dst`.
+  bool encode_utf8(const char *s, const size_t s_len, std::vector<int> &dst) {
     for (size_t i = 0; i < s_len;) {
 
       uint32_t char_len = utf8_len(s[i]);
-      if (char_len == 0) {
+      if (char_len == 0 || i + char_len > s_len) {
         // Found invalid UTF-8 string.
         return false;
       }
@@ -122,9 +389,9 @@ class CedarTrieTokenizer {
 
       int ret;
       if (_use_codepoint) {
-        ret = _ilongestPrefixSearch(s.c_str(), i, s_len, token_id, key_size);
+        ret = _ilongestPrefixSearch(s, i, s_len, token_id, key_size);
       } else {
-        ret = _longestPrefixSearch(s.c_str(), i, s_len, token_id, key_size);
+        ret = _longestPrefixSearch(s, i, s_len, token_id, key_size);
       }
 
       if (ret) {
@@ -142,57 +409,76 @@ class CedarTrieTokenizer {
         i += char_len;
       }
     }
-
-    output_ids = dst;
     return true;
   }
 
-  bool decode(const std::vector<int> &input_ids, std::string &output_str) {
-    std::string dst;
-
-    for (size_t i = 0; i < input_ids.size(); i++) {
-      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
-        std::string u8char;
-        if (!utf8_char_from_ids(input_ids.data(), i, input_ids.size(),
-                                u8char, _utf8_id_offset)) {
-          std::cerr << "utf8 reconstruct failed.\n";
-          return false;
+  // Codepoint mode with the input decoded once into the arena, instead of
+  // decoding each character again for every match that reads over it.
+  // Same ids as `encode_utf8`.
+  bool encode_codepoints(const char *s, const size_t s_len, Workspace &ws) {
+    // cpt[j]: packed labels(0: not in the alphabet, -1: invalid),
+    // offset[j]: its byte offset.
+    int *cpt = ws.alloc<int>(s_len + 1);
+    uint32_t *offset = ws.alloc<uint32_t>(s_len + 1);
+    size_t n = 0;
+    for (size_t i = 0; i < s_len; n++) {
+      const uint32_t char_len = utf8_len(s[i]);
+      if (char_len == 0 || i + char_len > s_len) {
+        return false;
+      }
+      int len;
+      const uint32_t code = to_codepoint(s + i, len);
+      cpt[n] = (len == 0) ? -1 : int(_alphabet.code(code));
+      offset[n] = uint32_t(i);
+      i += char_len;
+    }
+    offset[n] = uint32_t(s_len);
+
+    for (size_t j = 0; j < n;) {
+      // longest prefix(see `_ilongestPrefixSearch`)
+      size_t prev_from{0};
+      int prev_n{-1};
+      size_t from{0};
+      for (size_t k = j; k < n; k++) {
+        if (cpt[k] < 0) {
+          prev_n = -1;  // invalid: no match
+          break;
         }
-
-        i += u8char.size() - 1;
-
-        dst += u8char;
-
-        continue;
+        if (cpt[k] == 0) {
+          break;  // no token has this codepoint
+        }
+        size_t pos = 0;
+        int r = traverse_labels(cpt[k], from, /* inout */pos);
+        if (r == trie_t::CEDAR_NO_VALUE) {
+          continue;
+        }
+        if (r == trie_t::CEDAR_NO_PATH) {
+          break;
+        }
+        prev_n = r;
+        if (prev_from == from) {
+          break;
+        }
+        prev_from = from;
       }
 
-      if (!_id_to_str_map.count(input_ids[i])) {
-        std::cerr << "id not found: " << input_ids[i] << "\n";
-        return false;
+      if ((prev_n > 0) && _vocab.has(prev_n)) {
+        ws.ids.push_back(prev_n);
+        const size_t end = offset[j] + _vocab.length(prev_n);
+        while (offset[j] < end) {
+          j++;
+        }
+      } else {
+        // UTF-8 byte fallback
+        for (size_t i = offset[j]; i < offset[j + 1]; i++) {
+          ws.ids.push_back(int(uint8_t(s[i])) + _utf8_id_offset);
+        }
+        j++;
       }
-
-      dst += _id_to_str_map[input_ids[i]];
     }
-
-    output_str = dst;
-
     return true;
   }
 
-  std::string str_from_id(int id) {
-    if (_id_to_str_map.count(id)) {
-      return _id_to_str_map.at(id);
-    }
-    if (id > 0 && id < 257) {  // ASCII or UTF-8 byte
-      return "[[byte]]";
-    }
-    return std::string();
-  }
-
- private:
-  itrie_t _ida; // int key
-  trie_t _cda; // char key
-
   bool _longestPrefixSearch(const char *s, const size_t s_offset, const size_t s_len, int &found_id, uint32_t &keylen) {
 
     size_t prev_from{0};
@@ -219,9 +505,9 @@ class CedarTrieTokenizer {
       prev_from = from;
     }
 
-    if ((prev_n > 0) && _id_to_str_map.count(prev_n)) {
+    if ((prev_n > 0) && _vocab.has(prev_n)) {
       found_id = prev_n;
-      keylen = uint32_t(_id_to_str_map.at(prev_n).size());
+      keylen = uint32_t(_vocab.length(prev_n));
       return true;
     }
 
@@ -245,8 +531,13 @@ class CedarTrieTokenizer {
         return false;
       }
 
-      // process codepoint value each.
-      int n = _ida.traverse(&code, from, /* inout */pos, /* len */1);
+      const int labels = int(_alphabet.code(uint32_t(code)));
+      if (labels == 0) {
+        break;  // no token has this codepoint
+      }
+
+      // process the label(s) of a codepoint each.
+      int n = traverse_labels(labels, from, pos);
 
       if (n == trie_t::CEDAR_NO_VALUE) {
         continue;
@@ -265,9 +556,9 @@ class CedarTrieTokenizer {
       prev_from = from;
     }
 
-    if ((prev_n > 0) && _id_to_str_map.count(prev_n)) {
+    if ((prev_n > 0) && _vocab.has(prev_n)) {
       found_id = prev_n;
-      keylen = uint32_t(_id_to_str_map.at(prev_n).size());
+      keylen = uint32_t(_vocab.length(prev_n));
       return true;
     }
 
@@ -275,13 +566,67 @@ class CedarTrieTokenizer {
   }
 
   bool _use_codepoint{false}; // Use Unicode codepoint to represent string instead of UTF-8 byte?
-  std::unordered_map<std::string, int> _str_to_id_map;
-  std::unordered_map<int, std::string> _id_to_str_map;
+  VocabStore _vocab;  // id -> token
+  SlotDecodeTable _slot_table;
 
   int _utf8_id_offset{1};  // ASCII character is +1'ed in RWKV world vocab
   int _empty_char_id{3319};
 
-  inline uint32_t utf8_len(const uint8_t c) {
+  bool _frozen{false};
+  void *_huge_array{nullptr};  // mapping holding `_cda`'s node array
+  size_t _huge_array_bytes{0};
+
+  // Copy the node array of `_cda` into a 2 MB aligned anonymous mapping,
+  // advise huge pages and make it read-only. `_cda` reads it via
+  // `set_array`, which does not take ownership.
+  bool relocate_to_huge_pages() {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+    const size_t num_nodes = _cda.size();
+    const size_t bytes = num_nodes * _cda.unit_size();
+    const size_t mapped = (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+
+    // over-allocate one huge page and trim both ends to align.
+    void *p = mmap(nullptr, mapped + kHugePageSize, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+      return false;
+    }
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(p);
+    const uintptr_t aligned = (addr + kHugePageSize - 1) & ~uintptr_t(kHugePageSize - 1);
+    if (aligned > addr) {
+      munmap(p, aligned - addr);
+    }
+    if (addr + kHugePageSize > aligned) {
+      munmap(reinterpret_cast<void *>(aligned + mapped), addr + kHugePageSize - aligned);
+    }
+    void *array = reinterpret_cast<void *>(aligned);
+
+    // advisory only: the array works on regular pages as well.
+    madvise(array, mapped, MADV_HUGEPAGE);
+    memcpy(array, _cda.array(), bytes);
+    mprotect(array, mapped, PROT_READ);
+
+    _cda.set_array(array, num_nodes);  // frees the heap array
+    _huge_array = array;
+    _huge_array_bytes = mapped;
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  void release_huge_pages() {
+#if defined(__linux__)
+    if (_huge_array) {
+      munmap(_huge_array, _huge_array_bytes);
+    }
+#endif
+    _huge_array = nullptr;
+    _huge_array_bytes = 0;
+  }
+
+  inline uint32_t utf8_len(const uint8_t c) const {
     if (c <= 127) {
       // ascii
       return 1;
@@ -297,41 +642,37 @@ class CedarTrieTokenizer {
     return 0;
   }
 
-  // Reconstruct UTF-8 bytes from int sequence(UTF-8 encoded)
-  inline bool utf8_char_from_ids(const int *addr, size_t loc, size_t n,
-                                 std::string &str, int id_offset = 1) {
+  // Byte length of the UTF-8 character reconstructed from byte fallback ids
+  // starting at `loc`. Returns 0 when the ids do not form a valid sequence.
+  inline uint32_t utf8_len_from_ids(const int *addr, size_t loc, size_t n,
+                                    int id_offset = 1) const {
     if (loc >= n) {
-      return false;
+      return 0;
     }
 
     int start_c = addr[loc] - id_offset;
     if ((start_c < 0) || (start_c > 255)) {
-      return false;
+      return 0;
     }
 
     uint32_t len = utf8_len(uint8_t(start_c));
 
     if (len == 0) {
-      return false;
+      return 0;
     }
 
     if ((loc + len) > n) {
-      return false;
+      return 0;
     }
 
-    str = "";
-    std::vector<uint8_t> buf;
-    for (size_t i = 0; i < len; i++) {
+    for (size_t i = 1; i < len; i++) {
       int ic = addr[loc + i] - id_offset;
       if ((ic < 0) || (ic > 255)) {
-        return false;
+        return 0;
       }
-      buf.push_back(uint8_t(ic));
     }
 
-    str = std::string(reinterpret_cast<const char *>(buf.data()), buf.size());
-
-    return true;
+    return len;
   }
 
   inline std::string extract_utf8_char(const std::string &str, uint32_t start_i,
@@ -423,7 +764,7 @@ class CedarTrieTokenizer {
       unsigned char s2 = static_cast<unsigned char>(s[2]);
       unsigned char s3 = static_cast<unsigned char>(s[3]);
       if (((s0 & 0xf8) == 0xf0) && ((s1 & 0xc0) == 0x80) &&
-          ((s2 & 0xc0) == 0x80) && ((s2 & 0xc0) == 0x80)) {
+          ((s2 & 0xc0) == 0x80) && ((s3 & 0xc0) == 0x80)) {
         code = (uint32_t(s0 & 0x7) << 18) | (uint32_t(s1 & 0x3f) << 12) |
                (uint32_t(s2 & 0x3f) << 6) | uint32_t(s3 & 0x3f);
       } else {
@@ -8,6 +8,8 @@
 #include "rwkv_world_tokenizer_trie.hh"
 #include "rwkv_world_tokenizer_hat.hh"
 #include "rwkv_world_tokenizer_cedar.hh"
+#include "rwkv_world_tokenizer_louds.hh"
+#include "special_tokens.hh"
 
 int main(int argc, char **argv) {
   std::string vocab_json_filename = "rwkv_vocab_v20230424.json";
@@ -97,6 +99,8 @@ int main(int argc, char **argv) {
                 << "\n";
       return -1;
     }
+    std::cout << "memory usage(trie) in bytes:\n"
+              << tokenizer.memory_usage().str();
 
     // encode UTF-8 string
     std::string input_str = u8"吾輩は猫である。🤩";
@@ -143,6 +147,8 @@ int main(int argc, char **argv) {
                 << "\n";
       return -1;
     }
+    std::cout << "memory usage(hat-trie) in bytes:\n"
+              << tokenizer.memory_usage().str();
 
     // encode UTF-8 string
     std::string input_str = u8"吾輩は猫である。🤩";
@@ -180,6 +186,52 @@ int main(int argc, char **argv) {
   }
 
 
+  // LOUDS(succinct trie)
+  {
+    nanotokenizer::LoudsTrieTokenizer tokenizer;
+
+    std::string err;
+    if (!tokenizer.load_vocab(str_to_id_map, err)) {
+      std::cerr << "Load vocab failed: " << vocab_json_filename << " err = " << err
+                << "\n";
+      return -1;
+    }
+    std::cout << "memory usage(louds) in bytes:\n"
+              << tokenizer.memory_usage().str();
+
+    // encode UTF-8 string
+    std::string input_str = u8"吾輩は猫である。🤩";
+    // HACK
+    size_t nrepeat = 2;
+
+    for (size_t i = 0; i < nrepeat; i++) {
+      input_str += "名前はまだない。にゃん。";
+    }
+
+    std::vector<int> output_ids;
+
+    if (!tokenizer.encode(input_str, output_ids)) {
+      std::cerr << "encode failed.\n";
+      return -1;
+    }
+
+    std::cout << "[";
+    for (size_t i = 0; i < output_ids.size(); i++) {
+      if (i > 0) {
+        std::cout << ", ";
+      }
+      std::cout << tokenizer.IdToToken(output_ids[i]) << " : " << output_ids[i];
+    }
+    std::cout << "]\n";
+
+    std::string output_str;
+    if (!tokenizer.decode(output_ids, output_str)) {
+      std::cerr << "decode failed.\n";
+      return -1;
+    }
+    std::cout << "decoded: " << output_str << "\n";
+  }
+
   // cedar
   {
     bool use_codepoint{false};
@@ -195,6 +247,14 @@ int main(int argc, char **argv) {
                 << "\n";
       return -1;
     }
+    std::cout << "memory usage(cedar" << (use_codepoint ? ", codepoint" : "")
+              << ") in bytes:\n"
+              << tokenizer.memory_usage().str();
+
+    // no more inserts: release cedar's update-only arrays.
+    tokenizer.freeze();
+    std::cout << "memory usage(cedar, frozen) in bytes:\n"
+              << tokenizer.memory_usage().str();
 
     // encode UTF-8 string
     std::string input_str = u8"吾輩は猫である。🤩";
@@ -226,6 +286,33 @@ int main(int argc, char **argv) {
       return -1;
     }
     std::cout << "decoded: " << output_str << "\n";
+
+    // special tokens are carved out before encoding. id 0 is <|endoftext|>
+    // in RWKV world.
+    nanotokenizer::SpecialTokenMatcher special_tokens;
+    if (!special_tokens.add("<|endoftext|>", 0, err)) {
+      std::cerr << err;
+      return -1;
+    }
+    special_tokens.build();
+
+    std::vector<int> chat_ids;
+    if (!nanotokenizer::encode_with_special_tokens(
+            special_tokens, u8"吾輩は猫である。<|endoftext|>名前はまだない。", chat_ids,
+            [&tokenizer](const std::string &plain, std::vector<int> &ids) {
+              return tokenizer.encode(plain, ids);
+            })) {
+      std::cerr << "Failed to encode\n";
+      return -1;
+    }
+    std::cout << "with special tokens: [";
+    for (size_t i = 0; i < chat_ids.size(); i++) {
+      if (i > 0) {
+        std::cout << ", ";
+      }
+      std::cout << chat_ids[i];
+    }
+    std::cout << "]\n";
   }
 
   return EXIT_SUCCESS;
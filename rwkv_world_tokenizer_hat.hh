@@ -2,12 +2,17 @@
 // Copyright 2024 - Present, Light Transport Entertainment, Inc.
 #pragma once
 
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <unordered_map>
 
 #include "hat-trie/include/tsl/htrie_map.h"
+#include "memory_usage.hh"
+#include "slot_decode_table.hh"
+#include "vocab_store.hh"
+#include "workspace.hh"
 
 namespace nanotokenizer {
 
@@ -29,34 +34,177 @@ class HatTrieTokenizer {
       if ((it.second >= 127) && (it.second <= 256)) {
         continue;
       }
-      _str_to_id_map[it.first] = it.second;
-      _id_to_str_map[it.second] = it.first;
       max_id = (std::max)(max_id, it.second);
     }
 
-    for (const auto &it : str_to_id_map) {
-      _trie_map[it.first] = it.second;
-    }
-
     if (max_id > 65535) {
       err += "Max vocab id exceeds 65535\n";
       return false;
     }
+
+    // id -> token. token -> id is answered by the trie.
+    auto keep = [](const std::string &, int id) {
+      return !((id >= 127) && (id <= 256));
+    };
+    if (!_vocab.build(str_to_id_map, keep, err)) {
+      return false;
+    }
+
+    for (const auto &it : str_to_id_map) {
+      _trie_map[it.first] = it.second;
+    }
     _utf8_id_offset = 1;  // ASCII character is +1'ed in RWKV world vocab
 
     return true;
   }
 
   bool encode(const std::string &_input_str, std::vector<int> &output_ids) {
-    std::vector<int> dst;
+    if (_input_str.empty()) {
+      // empty input
+      return false;
+    }
+    output_ids.clear();
+    return encode_utf8(_input_str.data(), _input_str.size(), output_ids);
+  }
 
-    const size_t s_len = _input_str.size();
+  // Encode into `ws.ids`. See `Workspace`.
+  bool encode(const std::string &s, Workspace &ws) {
+    ws.reset();
+    if (s.empty()) {
+      return false;
+    }
+    return encode_append(s.data(), s.size(), ws);
+  }
 
-    if (s_len == 0) {
-      // empty input
+  // Append ids of `s` to `ws.ids`.
+  bool encode_append(const char *s, size_t s_len, Workspace &ws) {
+    return encode_utf8(s, s_len, ws.ids);
+  }
+
+  // Build fixed-slot decode table(see SlotDecodeTable).
+  // Once built, `decoded_length`/`decode_into`/`decode` use it.
+  // Call after `load_vocab`.
+  bool build_slot_decode_table() {
+    return _slot_table.build(_vocab, 1, 256 + _utf8_id_offset, _utf8_id_offset);
+  }
+
+  // Number of bytes `decode_into` writes for `input_ids`.
+  // Returns false when `input_ids` contains an unknown id or a broken UTF-8
+  // byte sequence.
+  bool decoded_length(const int *input_ids, size_t n, size_t &len) const {
+    if (!_slot_table.empty()) {
+      return _slot_table.decoded_length(input_ids, n, len);
+    }
+
+    len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(input_ids, i, n, _utf8_id_offset);
+        if (char_len == 0) {
+          std::cerr << "utf8 reconstruct failed.\n";
+          return false;
+        }
+        i += char_len - 1;
+        len += char_len;
+        continue;
+      }
+
+      if (!_vocab.has(input_ids[i])) {
+        std::cerr << "id not found: " << input_ids[i] << "\n";
+        return false;
+      }
+      len += _vocab.length(input_ids[i]);
+    }
+    return true;
+  }
+
+  // Decode `input_ids` into `out` without allocating.
+  // `cap` must be at least `decoded_length(input_ids, n)`. The number of bytes
+  // written is stored to `out_len`. No null terminator is appended.
+  bool decode_into(const int *input_ids, size_t n, char *out, size_t cap, size_t &out_len) const {
+    if (!_slot_table.empty()) {
+      return _slot_table.decode_into(input_ids, n, out, cap, out_len);
+    }
+
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(input_ids, i, n, _utf8_id_offset);
+        if ((char_len == 0) || ((len + char_len) > cap)) {
+          return false;
+        }
+        for (size_t c = 0; c < char_len; c++) {
+          out[len++] = char(uint8_t(input_ids[i + c] - _utf8_id_offset));
+        }
+        i += char_len - 1;
+        continue;
+      }
+
+      if (!_vocab.has(input_ids[i])) {
+        return false;
+      }
+      const size_t token_len = _vocab.length(input_ids[i]);
+      if ((len + token_len) > cap) {
+        return false;
+      }
+      memcpy(out + len, _vocab.data(input_ids[i]), token_len);
+      len += token_len;
+    }
+    out_len = len;
+    return true;
+  }
+
+  bool decode(const std::vector<int> input_ids, std::string &output_str) {
+    if (!_slot_table.empty()) {
+      return _slot_table.decode(input_ids.data(), input_ids.size(), output_str);
+    }
+
+    // pass 1: compute exact output size. pass 2: copy tokens.
+    size_t len{0};
+    if (!decoded_length(input_ids.data(), input_ids.size(), len)) {
       return false;
     }
 
+    output_str.resize(len);
+    if (len == 0) {
+      return true;
+    }
+    return decode_into(input_ids.data(), input_ids.size(), &output_str[0], len, len);
+  }
+
+  // Token of `id`, or an empty string.
+  std::string IdToToken(int id) const {
+    return _vocab.has(id) ? _vocab.token(id) : std::string();
+  }
+
+  // Exact match in the trie. -1 when `token` is not in the vocab.
+  int TokenToId(const std::string &token) const {
+    auto it = _trie_map.find(token);
+    return (it == _trie_map.cend()) ? -1 : it.value();
+  }
+
+  // Bytes held by this tokenizer, by component. Hash nodes are the hat-trie's
+  // leaf buckets(key suffixes and values); trie nodes are its 256-way inner
+  // nodes.
+  MemoryUsage memory_usage() const {
+    size_t trie_node_bytes = 0;
+    size_t hash_node_bytes = 0;
+    _trie_map.memory_usage(trie_node_bytes, hash_node_bytes);
+
+    MemoryUsage usage;
+    usage.add("instance", sizeof(*this));
+    usage.add("trie nodes", trie_node_bytes);
+    usage.add("hash nodes", hash_node_bytes);
+    usage.add("vocab strings", _vocab.string_bytes());
+    usage.add("vocab offsets", _vocab.offset_bytes());
+    usage.add("slot decode table", _slot_table.memory_usage());
+    return usage;
+  }
+
+ private:
+  // Appends to `dst`.
+  bool encode_utf8(const char *_input_str, const size_t s_len, std::vector<int> &dst) {
+
     size_t char_idx = 0;
     int prev_id = -1;  // Track previously matched result.
     size_t key_size = 0;
@@ -113,52 +261,18 @@ class HatTrieTokenizer {
       dst.push_back(prev_id);
     }
 
-    output_ids = dst;
     return true;
   }
 
-  bool decode(const std::vector<int> input_ids, std::string &output_str) {
-    std::string dst;
-
-    for (size_t i = 0; i < input_ids.size(); i++) {
-      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
-        std::string u8char;
-        if (!utf8_char_from_ids(input_ids.data(), i, input_ids.size(),
-                                u8char, _utf8_id_offset)) {
-          std::cerr << "utf8 reconstruct failed.\n";
-          return false;
-        }
-
-        i += u8char.size() - 1;
-
-        dst += u8char;
-
-        continue;
-      }
-
-      if (!_id_to_str_map.count(input_ids[i])) {
-        std::cerr << "id not found: " << input_ids[i] << "\n";
-        return false;
-      }
-
-      dst += _id_to_str_map[input_ids[i]];
-    }
-
-    output_str = dst;
-
-    return true;
-  }
-
- private:
   // We can use uint16_t as value type.
   tsl::htrie_map<char, int> _trie_map;
 
-  std::unordered_map<std::string, int> _str_to_id_map;
-  std::unordered_map<int, std::string> _id_to_str_map;
+  VocabStore _vocab;  // id -> token
+  SlotDecodeTable _slot_table;
 
   int _utf8_id_offset{1};  // ASCII character is +1'ed in RWKV world vocab
 
-  inline uint32_t utf8_len(const uint8_t c) {
+  inline uint32_t utf8_len(const uint8_t c) const {
     if (c <= 127) {
       // ascii
       return 1;
@@ -174,41 +288,37 @@ class HatTrieTokenizer {
     return 0;
   }
 
-  // Reconstruct UTF-8 bytes from int sequence(UTF-8 encoded)
-  inline bool utf8_char_from_ids(const int *addr, size_t loc, size_t n,
-                                 std::string &str, int id_offset = 1) {
+  // Byte length of the UTF-8 character reconstructed from byte fallback ids
+  // starting at `loc`. Returns 0 when the ids do not form a valid sequence.
+  inline uint32_t utf8_len_from_ids(const int *addr, size_t loc, size_t n,
+                                    int id_offset = 1) const {
     if (loc >= n) {
-      return false;
+      return 0;
     }
 
     int start_c = addr[loc] - id_offset;
     if ((start_c < 0) || (start_c > 255)) {
-      return false;
+      return 0;
     }
 
     uint32_t len = utf8_len(uint8_t(start_c));
 
     if (len == 0) {
-      return false;
+      return 0;
     }
 
     if ((loc + len) > n) {
-      return false;
+      return 0;
     }
 
-    str = "";
-    std::vector<uint8_t> buf;
-    for (size_t i = 0; i < len; i++) {
+    for (size_t i = 1; i < len; i++) {
       int ic = addr[loc + i] - id_offset;
       if ((ic < 0) || (ic > 255)) {
-        return false;
+        return 0;
       }
-      buf.push_back(uint8_t(ic));
     }
 
-    str = std::string(reinterpret_cast<const char *>(buf.data()), buf.size());
-
-    return true;
+    return len;
   }
 
   inline std::string extract_utf8_char(const std::string &str, uint32_t start_i,
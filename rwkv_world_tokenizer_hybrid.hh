@@ -0,0 +1,482 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ccedar_core.h"
+#include "codepoint_alphabet.hh"
+#include "memory_usage.hh"
+#include "slot_decode_table.hh"
+#include "vocab_store.hh"
+#include "workspace.hh"
+
+namespace nanotokenizer {
+
+// Cedar tokenizer walking one trie per character: an ASCII byte is its own
+// label, a multi-byte character is decoded once and takes its
+// CodepointAlphabet label(s). Japanese text costs one step per character
+// instead of three(CedarTrieTokenizer byte mode), ASCII needs no codepoint
+// decoding(codepoint mode). Same ids as CedarTrieTokenizer.
+// Up to 65535 vocab id
+// - token id 0 is not allowed
+// - token ids in [128, 256] are reserved for UTF-8 byte fallback(+1'ed)
+class HybridCedarTokenizer {
+ public:
+  // 10 bits: kana and most of the frequent kanji take one label, the rest
+  // two. Wider labels grow the trie for little gain. See CedarTrieTokenizer.
+  static constexpr size_t MAX_KEY_BITS = 10;
+
+  using trie_t = ccedar::da<int, int, MAX_KEY_BITS>;  // Key = bytes/labels
+
+  bool load_vocab(const std::map<std::string, int> &str_to_id_map, std::string &err) {
+
+    int max_id{0};
+    for (const auto &it : str_to_id_map) {
+      if (it.first.empty()) {
+        continue;
+      } else if (it.second == 0) {
+        err += "Vocab ID 0 is not allowed.\n";
+        return false;
+      }
+      max_id = (std::max)(max_id, it.second);
+    }
+
+    if (max_id > 65535) {
+      err += "Vocab ID exceeds 65535\n";
+      return false;
+    }
+
+    // id -> token. token -> id is answered by the trie.
+    auto keep = [](const std::string &token, int id) {
+      return !token.empty() && !((id > 127) && (id < 257));
+    };
+    if (!_vocab.build(str_to_id_map, keep, err)) {
+      return false;
+    }
+    _utf8_id_offset = 1;  // ASCII character is +1'ed in RWKV world vocab
+
+    // alphabet: multi-byte characters of the tokens, frequent ones first.
+    std::unordered_map<uint32_t, size_t> counts;
+    for (const auto &it : str_to_id_map) {
+      if (!keep(it.first, it.second)) {
+        continue;
+      }
+      const char *s = it.first.data();
+      const size_t s_len = it.first.size();
+      for (size_t i = 0; i < s_len;) {
+        uint32_t char_len;
+        const uint32_t code = decode_char(s + i, s_len - i, char_len);
+        if (char_len == 0) {
+          break;  // not UTF-8: never matched
+        }
+        if (char_len > 1) {
+          counts[code]++;
+        }
+        i += char_len;
+      }
+    }
+    if (!_alphabet.build(counts, int(MAX_KEY_BITS), err)) {
+      return false;
+    }
+
+    _trie.clear();
+    std::vector<int> ikey;
+    for (const auto &it : str_to_id_map) {
+      if (!keep(it.first, it.second)) {
+        continue;
+      }
+      if (!to_labels(it.first.data(), it.first.size(), ikey)) {
+        continue;
+      }
+      _trie.update(ikey.data(), ikey.size(), it.second);
+    }
+
+    return true;
+  }
+
+  // Release the trie's update-only arrays. See `CedarTrieTokenizer::freeze`.
+  void freeze() { _trie.freeze(); }
+
+  bool encode(const std::string &s, std::vector<int> &output_ids) {
+    output_ids.clear();
+    return encode_utf8(s.data(), s.size(), output_ids);
+  }
+
+  // Encode into `ws.ids`. See `Workspace`.
+  bool encode(const std::string &s, Workspace &ws) {
+    ws.reset();
+    return encode_append(s.data(), s.size(), ws);
+  }
+
+  // Append ids of `s` to `ws.ids`.
+  bool encode_append(const char *s, size_t s_len, Workspace &ws) {
+    return encode_utf8(s, s_len, ws.ids);
+  }
+
+  // Build fixed-slot decode table(see SlotDecodeTable).
+  // Once built, `decoded_length`/`decode_into`/`decode` use it.
+  // Call after `load_vocab`.
+  bool build_slot_decode_table() {
+    return _slot_table.build(_vocab, 1, 256 + _utf8_id_offset, _utf8_id_offset);
+  }
+
+  // Number of bytes `decode_into` writes for `input_ids`.
+  // Returns false when `input_ids` contains an unknown id or a broken UTF-8
+  // byte sequence.
+  bool decoded_length(const int *input_ids, size_t n, size_t &len) const {
+    if (!_slot_table.empty()) {
+      return _slot_table.decoded_length(input_ids, n, len);
+    }
+
+    len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(input_ids, i, n, _utf8_id_offset);
+        if (char_len == 0) {
+          return false;
+        }
+        i += char_len - 1;
+        len += char_len;
+        continue;
+      }
+
+      if (!_vocab.has(input_ids[i])) {
+        return false;
+      }
+      len += _vocab.length(input_ids[i]);
+    }
+    return true;
+  }
+
+  // Decode `input_ids` into `out` without allocating.
+  // `cap` must be at least `decoded_length(input_ids, n)`. The number of bytes
+  // written is stored to `out_len`. No null terminator is appended.
+  bool decode_into(const int *input_ids, size_t n, char *out, size_t cap, size_t &out_len) const {
+    if (!_slot_table.empty()) {
+      return _slot_table.decode_into(input_ids, n, out, cap, out_len);
+    }
+
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(input_ids, i, n, _utf8_id_offset);
+        if ((char_len == 0) || ((len + char_len) > cap)) {
+          return false;
+        }
+        for (size_t c = 0; c < char_len; c++) {
+          out[len++] = char(uint8_t(input_ids[i + c] - _utf8_id_offset));
+        }
+        i += char_len - 1;
+        continue;
+      }
+
+      if (!_vocab.has(input_ids[i])) {
+        return false;
+      }
+      const size_t token_len = _vocab.length(input_ids[i]);
+      if ((len + token_len) > cap) {
+        return false;
+      }
+      memcpy(out + len, _vocab.data(input_ids[i]), token_len);
+      len += token_len;
+    }
+    out_len = len;
+    return true;
+  }
+
+  bool decode(const std::vector<int> &input_ids, std::string &output_str) {
+    if (!_slot_table.empty()) {
+      return _slot_table.decode(input_ids.data(), input_ids.size(), output_str);
+    }
+
+    // pass 1: compute exact output size. pass 2: copy tokens.
+    size_t len{0};
+    if (!decoded_length(input_ids.data(), input_ids.size(), len)) {
+      return false;
+    }
+
+    output_str.resize(len);
+    if (len == 0) {
+      return true;
+    }
+    return decode_into(input_ids.data(), input_ids.size(), &output_str[0], len, len);
+  }
+
+  // Token of `id`, or an empty string.
+  std::string IdToToken(int id) const {
+    return _vocab.has(id) ? _vocab.token(id) : std::string();
+  }
+
+  // Exact match in the trie. -1 when `token` is not in the vocab.
+  int TokenToId(const std::string &token) const {
+    if (token.empty()) {
+      return -1;
+    }
+    if (memchr(token.data(), 0, token.size())) {
+      // "\0" is encoded with its byte fallback id, as in CedarTrieTokenizer.
+      return (token.size() == 1) ? _utf8_id_offset : -1;
+    }
+    std::vector<int> ikey;
+    if (!to_labels(token.data(), token.size(), ikey)) {
+      return -1;
+    }
+    const int id = _trie.exactMatchSearch<int>(ikey.data(), ikey.size());
+    return (id < 0) ? -1 : id;
+  }
+
+  // Bytes held by this tokenizer, by component.
+  MemoryUsage memory_usage() const {
+    MemoryUsage usage;
+    usage.add("instance", sizeof(*this));
+    usage.add("trie array", _trie.array_bytes());
+    usage.add("trie ninfo", _trie.ninfo_bytes());
+    usage.add("trie blocks", _trie.block_bytes());
+    usage.add("alphabet", _alphabet.memory_usage());
+    usage.add("vocab strings", _vocab.string_bytes());
+    usage.add("vocab offsets", _vocab.offset_bytes());
+    usage.add("slot decode table", _slot_table.memory_usage());
+    return usage;
+  }
+
+ private:
+  // Multi-byte character ahead of the current position, decoded.
+  struct CharLabels {
+    uint32_t labels;  // packed alphabet labels, 0: no path
+    uint32_t char_len;
+  };
+  // Multi-byte characters kept for the next walks. Characters further ahead
+  // are decoded without being kept.
+  static constexpr size_t kRingSize = 64;
+
+  // Longest match from each position, UTF-8 byte fallback otherwise.
+  // Appends to `dst`.
+  //
+  // A walk from `i` reads the characters the previous walk already read past
+  // its match. `ring` keeps the multi-byte ones from `i` on, in order, so each
+  // is decoded and looked up once instead of once per walk that reaches it.
+  // An ASCII byte is its own label and skips the ring.
+  bool encode_utf8(const char *s, const size_t s_len, std::vector<int> &dst) const {
+    CharLabels ring[kRingSize];
+    size_t head = 0;   // ring index of the first multi-byte character from `i`
+    size_t count = 0;  // multi-byte characters from `i` in the ring
+    for (size_t i = 0; i < s_len;) {
+      uint32_t char_len = utf8_len(uint8_t(s[i]));
+      if (char_len == 0 || i + char_len > s_len) {
+        // Found invalid UTF-8 string.
+        return false;
+      }
+
+      int token_id = -1;
+      size_t token_len = 0;
+      size_t token_multibyte = 0;  // multi-byte characters in the match
+      size_t from = 0;
+      size_t m = 0;  // multi-byte characters walked
+      for (size_t j = i; j < s_len;) {
+        uint32_t labels = uint8_t(s[j]);
+        uint32_t step_len = 1;
+        if (labels >= 0x80) {
+          CharLabels c;
+          if (m < count) {
+            c = ring[(head + m) % kRingSize];
+          } else {
+            c.labels = char_labels(s + j, s_len - j, c.char_len);
+            if (count < kRingSize) {
+              ring[(head + count) % kRingSize] = c;
+              count++;
+            }
+          }
+          m++;
+          labels = c.labels;
+          step_len = c.char_len;
+        }
+        if (labels == 0) {
+          break;  // NUL, invalid, or in no token
+        }
+        const int n = traverse_labels(labels, from);
+        if (n == trie_t::CEDAR_NO_PATH) {
+          break;
+        }
+        j += step_len;
+        if (n != trie_t::CEDAR_NO_VALUE) {
+          token_id = n;
+          token_len = j - i;
+          token_multibyte = m;
+        }
+      }
+
+      if (token_id > 0) {
+        dst.push_back(token_id);
+        i += token_len;
+      } else {
+        // UTF-8 byte fallback
+        for (size_t c = 0; c < char_len; c++) {
+          dst.push_back(int(uint8_t(s[i + c])) + _utf8_id_offset);
+        }
+        i += char_len;
+        token_multibyte = (char_len > 1) ? 1 : 0;
+      }
+      const size_t consumed = (std::min)(token_multibyte, count);
+      head = (head + consumed) % kRingSize;
+      count -= consumed;
+    }
+    return true;
+  }
+
+  // Packed labels of the multi-byte character at `s`(at most `n` bytes). Its
+  // byte length goes to `char_len`. 0 when there is no path(invalid, or in
+  // no token).
+  uint32_t char_labels(const char *s, size_t n, uint32_t &char_len) const {
+    const uint32_t code = decode_char(s, n, char_len);
+    return (char_len == 0) ? 0 : _alphabet.code(code);
+  }
+
+  // Follow packed `labels`(> 0) from node `from`. Returns the value of the
+  // reached node, `trie_t::CEDAR_NO_VALUE` or `trie_t::CEDAR_NO_PATH`.
+  int traverse_labels(uint32_t labels, size_t &from) const {
+    size_t pos = 0;
+    if (labels < 0x10000) {
+      const int label = int(labels);
+      return _trie.traverse(&label, from, pos, /* len */1);
+    }
+    int lab[2];
+    CodepointAlphabet::labels(labels, lab);
+    return _trie.traverse(lab, from, pos, /* len */2);
+  }
+
+  // Labels of UTF-8 string `s` to `ikey`. false when `s` is not UTF-8 or
+  // has a character outside the alphabet(then it is not in the vocab).
+  bool to_labels(const char *s, const size_t s_len, std::vector<int> &ikey) const {
+    ikey.clear();
+    for (size_t i = 0; i < s_len;) {
+      uint32_t char_len;
+      const uint32_t code = decode_char(s + i, s_len - i, char_len);
+      const uint32_t labels = (char_len == 0) ? 0 : _alphabet.code(code);
+      if (labels == 0) {
+        return false;
+      }
+      int lab[2];
+      const uint32_t nlab = CodepointAlphabet::labels(labels, lab);
+      ikey.insert(ikey.end(), lab, lab + nlab);
+      i += char_len;
+    }
+    return true;
+  }
+
+  // Codepoint of the UTF-8 character at `s`(at most `n` bytes). `char_len`
+  // is 0 for a broken or overlong sequence, so that each codepoint has one
+  // spelling(as in the byte trie).
+  static uint32_t decode_char(const char *s, size_t n, uint32_t &char_len) {
+    const uint8_t *u = reinterpret_cast<const uint8_t *>(s);
+    char_len = 0;
+    if (n == 0) {
+      return 0;
+    }
+    if (u[0] < 0x80) {
+      char_len = 1;
+      return u[0];
+    }
+    // straight-line per length: this runs once per multi-byte character of
+    // the text.
+    uint32_t code;
+    if ((u[0] & 0xE0) == 0xC0) {
+      if ((n < 2) || ((u[1] & 0xC0) != 0x80)) {
+        return 0;
+      }
+      code = (uint32_t(u[0] & 0x1F) << 6) | (u[1] & 0x3F);
+      if (code < 0x80) {
+        return 0;  // overlong
+      }
+      char_len = 2;
+    } else if ((u[0] & 0xF0) == 0xE0) {
+      if ((n < 3) || ((u[1] & 0xC0) != 0x80) || ((u[2] & 0xC0) != 0x80)) {
+        return 0;
+      }
+      code = (uint32_t(u[0] & 0x0F) << 12) | (uint32_t(u[1] & 0x3F) << 6) |
+             (u[2] & 0x3F);
+      if (code < 0x800) {
+        return 0;  // overlong
+      }
+      char_len = 3;
+    } else if ((u[0] & 0xF8) == 0xF0) {
+      if ((n < 4) || ((u[1] & 0xC0) != 0x80) || ((u[2] & 0xC0) != 0x80) ||
+          ((u[3] & 0xC0) != 0x80)) {
+        return 0;
+      }
+      code = (uint32_t(u[0] & 0x07) << 18) | (uint32_t(u[1] & 0x3F) << 12) |
+             (uint32_t(u[2] & 0x3F) << 6) | (u[3] & 0x3F);
+      if ((code < 0x10000) || (code > CodepointAlphabet::kMaxCodepoint)) {
+        return 0;  // overlong or out of range
+      }
+      char_len = 4;
+    } else {
+      return 0;
+    }
+    return code;
+  }
+
+  trie_t _trie;
+  CodepointAlphabet _alphabet;  // multi-byte character -> `_trie` labels
+  VocabStore _vocab;  // id -> token
+  SlotDecodeTable _slot_table;
+
+  int _utf8_id_offset{1};  // ASCII character is +1'ed in RWKV world vocab
+
+  inline uint32_t utf8_len(const uint8_t c) const {
+    if (c <= 127) {
+      // ascii
+      return 1;
+    } else if ((c & 0xE0) == 0xC0) {
+      return 2;
+    } else if ((c & 0xF0) == 0xE0) {
+      return 3;
+    } else if ((c & 0xF8) == 0xF0) {
+      return 4;
+    }
+
+    // invalid
+    return 0;
+  }
+
+  // Byte length of the UTF-8 character reconstructed from byte fallback ids
+  // starting at `loc`. Returns 0 when the ids do not form a valid sequence.
+  inline uint32_t utf8_len_from_ids(const int *addr, size_t loc, size_t n,
+                                    int id_offset = 1) const {
+    if (loc >= n) {
+      return 0;
+    }
+
+    int start_c = addr[loc] - id_offset;
+    if ((start_c < 0) || (start_c > 255)) {
+      return 0;
+    }
+
+    uint32_t len = utf8_len(uint8_t(start_c));
+
+    if (len == 0) {
+      return 0;
+    }
+
+    if ((loc + len) > n) {
+      return 0;
+    }
+
+    for (size_t i = 1; i < len; i++) {
+      int ic = addr[loc + i] - id_offset;
+      if ((ic < 0) || (ic > 255)) {
+        return 0;
+      }
+    }
+
+    return len;
+  }
+};
+
+}  // namespace nanotokenizer
@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "louds_trie.hh"
+#include "memory_usage.hh"
+#include "vocab_store.hh"
+#include "workspace.hh"
+
+namespace nanotokenizer {
+
+// Read-only tokenizer on a succinct trie(see LoudsTrie), for hosts tight
+// on RAM. Tokens are stored only in the trie: id -> string walks from the
+// token's node to the root. Same ids as CedarTrieTokenizer(byte mode).
+// Up to 65535 vocab id
+// - token id 0 is not allowed
+// - token ids in [128, 256] are reserved for UTF-8 byte fallback(+1'ed)
+class LoudsTrieTokenizer {
+ public:
+  bool load_vocab(const std::map<std::string, int> &str_to_id_map, std::string &err) {
+
+    int max_id{0};
+    for (const auto &it : str_to_id_map) {
+      if (it.first.empty()) {
+        continue;
+      } else if (it.second == 0) {
+        err += "Vocab ID 0 is not allowed.\n";
+        return false;
+      }
+      max_id = (std::max)(max_id, it.second);
+    }
+
+    if (max_id > 65535) {
+      err += "Vocab ID exceeds 65535\n";
+      return false;
+    }
+
+    // The strings are needed only while building the trie.
+    VocabStore vocab;
+    auto keep = [](const std::string &token, int id) {
+      return !token.empty() && !((id > 127) && (id < 257));
+    };
+    if (!vocab.build(str_to_id_map, keep, err)) {
+      return false;
+    }
+    if (!_trie.build(vocab, err)) {
+      return false;
+    }
+    _utf8_id_offset = 1;  // ASCII character is +1'ed in RWKV world vocab
+
+    return true;
+  }
+
+  bool encode(const std::string &s, std::vector<int> &output_ids) {
+    if (s.empty()) {
+      // empty input
+      return false;
+    }
+    output_ids.clear();
+    return encode_utf8(s.data(), s.size(), output_ids);
+  }
+
+  // Encode into `ws.ids`. See `Workspace`.
+  bool encode(const std::string &s, Workspace &ws) {
+    ws.reset();
+    if (s.empty()) {
+      return false;
+    }
+    return encode_append(s.data(), s.size(), ws);
+  }
+
+  // Append ids of `s` to `ws.ids`.
+  bool encode_append(const char *s, size_t s_len, Workspace &ws) {
+    return encode_utf8(s, s_len, ws.ids);
+  }
+
+  // Number of bytes `decode_into` writes for `input_ids`.
+  // Returns false when `input_ids` contains an unknown id or a broken UTF-8
+  // byte sequence.
+  bool decoded_length(const int *input_ids, size_t n, size_t &len) const {
+    len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(input_ids, i, n, _utf8_id_offset);
+        if (char_len == 0) {
+          return false;
+        }
+        i += char_len - 1;
+        len += char_len;
+        continue;
+      }
+
+      if (!_trie.has(input_ids[i])) {
+        return false;
+      }
+      len += _trie.token_length(input_ids[i]);
+    }
+    return true;
+  }
+
+  // Decode `input_ids` into `out` without allocating.
+  // `cap` must be at least `decoded_length(input_ids, n)`. The number of bytes
+  // written is stored to `out_len`. No null terminator is appended.
+  bool decode_into(const int *input_ids, size_t n, char *out, size_t cap, size_t &out_len) const {
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((input_ids[i] > 0) && (input_ids[i] < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(input_ids, i, n, _utf8_id_offset);
+        if ((char_len == 0) || ((len + char_len) > cap)) {
+          return false;
+        }
+        for (size_t c = 0; c < char_len; c++) {
+          out[len++] = char(uint8_t(input_ids[i + c] - _utf8_id_offset));
+        }
+        i += char_len - 1;
+        continue;
+      }
+
+      if (!_trie.has(input_ids[i])) {
+        return false;
+      }
+      // measure the token(another walk) only near the end of `out`.
+      if (((len + _trie.max_token_length()) > cap) &&
+          ((len + _trie.token_length(input_ids[i])) > cap)) {
+        return false;
+      }
+      len += _trie.copy_token(input_ids[i], out + len);
+    }
+    out_len = len;
+    return true;
+  }
+
+  // Single pass: unlike `decoded_length` + `decode_into`, each token is
+  // reconstructed(walked to the root) once.
+  bool decode(const std::vector<int> &input_ids, std::string &output_str) {
+    size_t len = 0;
+    output_str.clear();
+    const size_t n = input_ids.size();
+    for (size_t i = 0; i < n; i++) {
+      const int id = input_ids[i];
+      if ((id > 0) && (id < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(input_ids.data(), i, n, _utf8_id_offset);
+        if (char_len == 0) {
+          return false;
+        }
+        if (output_str.size() < len + char_len) {
+          output_str.resize((std::max)(2 * output_str.size(), len + char_len));
+        }
+        for (size_t c = 0; c < char_len; c++) {
+          output_str[len++] = char(uint8_t(input_ids[i + c] - _utf8_id_offset));
+        }
+        i += char_len - 1;
+        continue;
+      }
+
+      if (!_trie.has(id)) {
+        return false;
+      }
+      if (output_str.size() < len + _trie.max_token_length()) {
+        output_str.resize((std::max)(2 * output_str.size(), len + _trie.max_token_length()));
+      }
+      len += _trie.copy_token(id, &output_str[len]);
+    }
+    output_str.resize(len);
+    return true;
+  }
+
+  // Token of `id`, or an empty string.
+  std::string IdToToken(int id) const {
+    return _trie.has(id) ? _trie.token(id) : std::string();
+  }
+
+  // Exact match in the trie. -1 when `token` is not in the vocab.
+  int TokenToId(const std::string &token) const {
+    return _trie.find_exact(token.data(), token.size());
+  }
+
+  // Bytes held by this tokenizer, by component.
+  MemoryUsage memory_usage() const {
+    MemoryUsage usage;
+    usage.add("instance", sizeof(*this));
+    usage.add("louds", _trie.louds_bytes());
+    usage.add("labels", _trie.label_bytes());
+    usage.add("terminals and ids", _trie.terminal_bytes());
+    usage.add("tails", _trie.tail_bytes());
+    return usage;
+  }
+
+ private:
+  // Longest match from each position, UTF-8 byte fallback otherwise.
+  // Appends to `dst`.
+  bool encode_utf8(const char *s, const size_t s_len, std::vector<int> &dst) {
+    for (size_t i = 0; i < s_len;) {
+      uint32_t char_len = utf8_len(uint8_t(s[i]));
+      if (char_len == 0 || i + char_len > s_len) {
+        // Found invalid UTF-8 string.
+        return false;
+      }
+
+      int token_id = -1;
+      const size_t len = _trie.find_longest_prefix_length(s + i, s_len - i, token_id);
+      if (len) {
+        dst.push_back(token_id);
+        i += len;
+      } else {
+        // UTF-8 byte fallback
+        for (size_t c = 0; c < char_len; c++) {
+          dst.push_back(int(uint8_t(s[i + c])) + _utf8_id_offset);
+        }
+        i += char_len;
+      }
+    }
+    return true;
+  }
+
+  LoudsTrie _trie;
+
+  int _utf8_id_offset{1};  // ASCII character is +1'ed in RWKV world vocab
+
+  inline uint32_t utf8_len(const uint8_t c) const {
+    if (c <= 127) {
+      // ascii
+      return 1;
+    } else if ((c & 0xE0) == 0xC0) {
+      return 2;
+    } else if ((c & 0xF0) == 0xE0) {
+      return 3;
+    } else if ((c & 0xF8) == 0xF0) {
+      return 4;
+    }
+
+    // invalid
+    return 0;
+  }
+
+  // Byte length of the UTF-8 character reconstructed from byte fallback ids
+  // starting at `loc`. Returns 0 when the ids do not form a valid sequence.
+  inline uint32_t utf8_len_from_ids(const int *addr, size_t loc, size_t n,
+                                    int id_offset = 1) const {
+    if (loc >= n) {
+      return 0;
+    }
+
+    int start_c = addr[loc] - id_offset;
+    if ((start_c < 0) || (start_c > 255)) {
+      return 0;
+    }
+
+    uint32_t len = utf8_len(uint8_t(start_c));
+
+    if (len == 0) {
+      return 0;
+    }
+
+    if ((loc + len) > n) {
+      return 0;
+    }
+
+    for (size_t i = 1; i < len; i++) {
+      int ic = addr[loc + i] - id_offset;
+      if ((ic < 0) || (ic > 255)) {
+        return 0;
+      }
+    }
+
+    return len;
+  }
+};
+
+}  // namespace nanotokenizer
@@ -9,12 +9,14 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <unordered_map>
 #include <memory>
 #include <fstream>
 #include <sstream>
 #include <vector>
+#include <cstring>
 
 #if defined(RWKV_ENABLE_EXCEPTION)
 #include <exception>
@@ -23,6 +25,11 @@
 #include <sstream>
 #include <string>
 
+#include "memory_usage.hh"
+#include "slot_decode_table.hh"
+#include "vocab_store.hh"
+#include "workspace.hh"
+
 #define STRINGIFY(...) STRINGIFY_(__VA_ARGS__)
 #define STRINGIFY_(...) #__VA_ARGS__
 
@@ -72,61 +79,229 @@ struct FRException : public std::runtime_error {
 
 namespace nanotokenizer {
 
+// Byte trie of the vocab.
+//
+// Nodes are counted in advance and built into one array, children of a node
+// next to each other and sorted by label, so construction does a handful
+// of allocations and destruction frees flat arrays. A lookup scans the
+// labels of the current node's children, which are contiguous bytes.
 struct TrieTree {
-  std::unordered_map<int, std::unique_ptr<TrieTree>> children;
-  std::string word;
-  int token_id{-1}; // -1 = invalid
-
   TrieTree(const std::unordered_map<std::string, int>& word2id) {
+    std::vector<Word> words;
+    words.reserve(word2id.size());
     for (auto& pair : word2id) {
-      add_word(pair.first, pair.second);
+      words.push_back(make_word(pair.first.data(), pair.first.size(), pair.second));
     }
+    build(words);
+  }
+
+  // Non-empty tokens of `vocab`. Words point into `vocab` only while
+  // building; the trie keeps no strings.
+  TrieTree(const VocabStore& vocab) {
+    std::vector<Word> words;
+    words.reserve(vocab.size());
+    for (int id = 0; id < int(vocab.id_end()); id++) {
+      if (vocab.has(id) && vocab.length(id) > 0) {
+        words.push_back(make_word(vocab.data(id), vocab.length(id), id));
+      }
+    }
+    build(words);
+  }
+
+  // id of the word equal to `s[0, len)`, or -1.
+  int find_exact(const char *s, size_t len) const {
+    uint32_t node = 0;
+    for (size_t i = 0; i < len; ++i) {
+      node = find_child(node, uint8_t(s[i]));
+      if (node == kNoNode) {
+        return -1;
+      }
+    }
+    return _nodes[node].token_id;
+  }
+
+  // Byte length of the longest word at `s[s_offset]`(0: none). Its id is
+  // stored to `token_id`.
+  size_t find_longest_prefix_length(const char *s, const size_t s_offset, const size_t s_len, int &token_id) const {
+    size_t best = 0;
+    uint32_t node = 0;
+    for (size_t i = s_offset; i < s_len; ++i) {
+      node = find_child(node, uint8_t(s[i]));
+      if (node == kNoNode) {
+        break;
+      }
+      if (_nodes[node].token_id >= 0) {
+        best = i - s_offset + 1;
+        token_id = _nodes[node].token_id;
+      }
+    }
+    return best;
   }
 
   std::pair<std::string, int> find_longest_prefix(const char *s, const size_t s_offset, const size_t s_len) const {
-    std::string prefix;
     int token_id = -1;
-    const TrieTree* node = this;
-    for (int i = s_offset; i < s_len; ++i) {
-      auto it = node->children.find(s[i]);
-      if (it == node->children.end()) {
-        break;
+    const size_t len = find_longest_prefix_length(s, s_offset, s_len, token_id);
+    if (len == 0) {
+      return {"", -1};
+    }
+    return {std::string(s + s_offset, len), token_id};
+  }
+
+  size_t num_nodes() const { return _nodes.size(); }
+
+  size_t node_bytes() const { return _nodes.capacity() * sizeof(Node); }
+  size_t label_bytes() const { return _labels.capacity(); }
+  size_t memory_usage() const { return node_bytes() + label_bytes(); }
+
+ private:
+  static constexpr uint32_t kNoNode = 0xFFFFFFFFu;
+
+  struct Node {
+    uint32_t first_child;  // index of the first child in `_nodes`
+    uint16_t num_children;
+    int32_t token_id{-1};  // -1 = invalid
+  };
+
+  // Vocab word while building. Sorted bytewise; `head`(first 8 bytes, big
+  // endian) decides most comparisons without touching the strings.
+  struct Word {
+    uint64_t head;
+    const char *data;
+    uint32_t size;
+    int token_id;
+
+    bool operator<(const Word &rhs) const {
+      if (head != rhs.head) {
+        return head < rhs.head;
       }
-      node = it->second.get();
-      if (!node) {
-        // invalid
-        return {"", -1};
+      const uint32_t n = (std::min)(size, rhs.size);
+      if (n > 8) {
+        const int c = memcmp(data + 8, rhs.data + 8, n - 8);
+        if (c != 0) {
+          return c < 0;
+        }
       }
-      if (node->token_id >= 0) {
-        prefix = node->word;
-        token_id = node->token_id;
+      return size < rhs.size;
+    }
+  };
+
+  static Word make_word(const char *data, size_t size, int token_id) {
+    Word w;
+    w.data = data;
+    w.size = uint32_t(size);
+    w.token_id = token_id;
+    w.head = 0;
+    for (size_t i = 0; i < 8; i++) {
+      w.head = (w.head << 8) | (i < size ? uint8_t(data[i]) : 0);
+    }
+    return w;
+  }
+
+  void build(std::vector<Word> &words) {
+    sort_words(words);
+
+    // one node per distinct prefix
+    size_t num_nodes = 1;
+    for (size_t i = 0; i < words.size(); i++) {
+      size_t lcp = 0;
+      if (i > 0) {
+        const Word &prev = words[i - 1];
+        while (lcp < words[i].size && lcp < prev.size && words[i].data[lcp] == prev.data[lcp]) {
+          lcp++;
+        }
       }
+      num_nodes += words[i].size - lcp;
     }
-    if (prefix.empty()) {
-      return {"", -1};
+
+    _nodes.resize(num_nodes);
+    _labels.resize(num_nodes);
+    _num_nodes = 1;
+    build(0, words, 0, words.size(), 0);
+  }
+
+  // LSD radix sort on `head`, then comparison sort of runs with the same
+  // head(words sharing their first 8 bytes).
+  static void sort_words(std::vector<Word> &words) {
+    std::vector<Word> tmp(words.size());
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+      size_t count[257] = {};
+      for (const Word &w : words) {
+        count[((w.head >> shift) & 0xff) + 1]++;
+      }
+      if (count[((words.empty() ? 0 : words[0].head) >> shift & 0xff) + 1] == words.size()) {
+        continue;  // all the same byte
+      }
+      for (size_t b = 0; b < 256; b++) {
+        count[b + 1] += count[b];
+      }
+      for (const Word &w : words) {
+        tmp[count[(w.head >> shift) & 0xff]++] = w;
+      }
+      words.swap(tmp);
     }
-    if (token_id == -1) {
-      return {"", -1};
+    for (size_t i = 0; i < words.size();) {
+      size_t end = i + 1;
+      while (end < words.size() && words[end].head == words[i].head) {
+        end++;
+      }
+      if (end - i > 1) {
+        std::sort(words.begin() + long(i), words.begin() + long(end));
+      }
+      i = end;
     }
-    return {prefix, token_id};
   }
 
- private:
-  TrieTree() = default;
-  void add_word(const std::string& word, int token_id) { return _add_word(word, token_id, 0); }
-  void _add_word(const std::string& word, int token_id, int idx) {
-    if (idx == word.size()) {
-      this->word = word;
-      this->token_id = token_id;
-      return;
-    }
-    auto& child = children[word[idx]];
-    if (!child) {
-      child = std::unique_ptr<TrieTree>(new TrieTree());
-    }
-    child->_add_word(word, token_id, idx + 1);
+  // `words[lo, hi)` share the prefix of `node`(length `depth`).
+  void build(uint32_t node, const std::vector<Word> &words,
+             size_t lo, size_t hi, size_t depth) {
+    if (lo < hi && words[lo].size == depth) {
+      _nodes[node].token_id = words[lo].token_id;
+      lo++;
+    }
+
+    uint32_t num_children = 0;
+    for (size_t i = lo; i < hi; i++) {
+      if (i == lo || words[i].data[depth] != words[i - 1].data[depth]) {
+        num_children++;
+      }
+    }
+    const uint32_t first = _num_nodes;
+    _num_nodes += num_children;
+    _nodes[node].first_child = first;
+    _nodes[node].num_children = uint16_t(num_children);
+
+    uint32_t child = first;
+    for (size_t i = lo; i < hi; child++) {
+      const char label = words[i].data[depth];
+      size_t end = i + 1;
+      while (end < hi && words[end].data[depth] == label) {
+        end++;
+      }
+      _labels[child] = uint8_t(label);
+      build(child, words, i, end, depth + 1);
+      i = end;
+    }
   }
-  std::stringstream _err_ss;
+
+  uint32_t find_child(uint32_t node, uint8_t label) const {
+    const Node &n = _nodes[node];
+    const uint8_t *begin = _labels.data() + n.first_child;
+    const uint8_t *end = begin + n.num_children;
+    if (n.num_children <= 16) {
+      for (const uint8_t *p = begin; p < end; p++) {
+        if (*p == label) {
+          return n.first_child + uint32_t(p - begin);
+        }
+      }
+      return kNoNode;
+    }
+    const uint8_t *p = std::lower_bound(begin, end, label);
+    return (p != end && *p == label) ? n.first_child + uint32_t(p - begin) : kNoNode;
+  }
+
+  std::vector<Node> _nodes;     // [0] = root
+  std::vector<uint8_t> _labels;  // byte leading to each node
+  uint32_t _num_nodes{0};        // used while building
 };
 
 class TrieTokenizer {
@@ -137,110 +312,187 @@ class TrieTokenizer {
     for (auto& pair : word2idx) {
       if (pair.first.empty()) {
         _empty_str_id = pair.second;
-        continue;
-      }
-
-      if ((pair.second > 127) && (pair.second < 257)) {
-        // reserved for UTF-8 byte fallback
-        continue;
       }
-
-      _word2idx[pair.first] = pair.second;
-      _idx2word[pair.second] = pair.first;
     }
-    _tree = std::make_unique<TrieTree>(_word2idx);
+    auto keep = [](const std::string &token, int id) {
+      // UTF-8 byte fallback ids are reserved.
+      return !token.empty() && !((id > 127) && (id < 257));
+    };
+    if (!_vocab.build(word2idx, keep, err)) {
+      return false;
+    }
+    _tree = std::make_unique<TrieTree>(_vocab);
 
     return true;
   }
 
   bool encode(const std::string &str, std::vector<int32_t> &dst) {
-    std::vector<int> ids;
-    int str_idx = 0;
-    size_t str_len = str.size();
+    dst.clear();
+    return encode_utf8(str.c_str(), str.size(), dst);
+  }
 
-    if (str_len == 0) {
-      return true;
+  // Encode into `ws.ids`. See `Workspace`.
+  bool encode(const std::string &str, Workspace &ws) {
+    ws.reset();
+    return encode_append(str.data(), str.size(), ws);
+  }
+
+  // Append ids of `s` to `ws.ids`.
+  bool encode_append(const char *s, size_t s_len, Workspace &ws) {
+    return encode_utf8(s, s_len, ws.ids);
+  }
+
+  // Build fixed-slot decode table(see SlotDecodeTable).
+  // Once built, `decoded_length`/`decode_into`/`decode` use it.
+  // Call after `load_vocab`.
+  bool build_slot_decode_table() {
+    return _slot_table.build(_vocab, 127 + _utf8_id_offset, 256 + _utf8_id_offset, _utf8_id_offset);
+  }
+
+  // Number of bytes `decode_into` writes for `ids`.
+  // Returns false when `ids` contains an unknown id or a broken UTF-8 byte
+  // sequence.
+  bool decoded_length(const int32_t *ids, size_t n, size_t &len) const {
+    if (!_slot_table.empty()) {
+      return _slot_table.decoded_length(ids, n, len);
     }
 
-    while (str_idx < str_len) {
-      const auto ret = _tree->find_longest_prefix(str.c_str(), str_idx, str_len);
-      if (ret.first.empty()) {
-        // UTF-8 byte fallback
-        // Should be single UTF-8 character
-        
-        int char_len = utf8_len(str[str_idx]);
-        for (size_t c = 0; c < char_len; c++) {
-          ids.push_back(int(uint8_t(str[str_idx + c])) +
-                        _utf8_id_offset);
+    len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((ids[i] >= (127 + _utf8_id_offset)) && (ids[i] < (256 + _utf8_id_offset))) {
+        uint32_t char_len = utf8_len_from_ids(ids, i, n, _utf8_id_offset);
+        if (char_len == 0) {
+          return false;
         }
-        str_idx += char_len;
-      } else {
-        ids.push_back(ret.second);
-        str_idx += ret.first.size();
+        i += char_len - 1;
+        len += char_len;
+        continue;
       }
+
+      if (!_vocab.has(ids[i]) || _vocab.length(ids[i]) == 0) {
+        return false;
+      }
+      len += _vocab.length(ids[i]);
     }
-    dst = ids;
     return true;
   }
 
-  bool decode(const std::vector<int32_t>& ids, std::string &dst) {
-    std::string str;
-    for (size_t i = 0; i < ids.size(); i++) {
+  // Decode `ids` into `out` without allocating.
+  // `cap` must be at least `decoded_length(ids, n)`. The number of bytes written
+  // is stored to `out_len`. No null terminator is appended.
+  bool decode_into(const int32_t *ids, size_t n, char *out, size_t cap, size_t &out_len) const {
+    if (!_slot_table.empty()) {
+      return _slot_table.decode_into(ids, n, out, cap, out_len);
+    }
 
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
       if ((ids[i] >= (127 + _utf8_id_offset)) && (ids[i] < (256 + _utf8_id_offset))) {
-
-        std::string u8char;
-        if (!utf8_char_from_ids(ids.data(), i, ids.size(),
-                                u8char, _utf8_id_offset)) {
+        uint32_t char_len = utf8_len_from_ids(ids, i, n, _utf8_id_offset);
+        if ((char_len == 0) || ((len + char_len) > cap)) {
           return false;
         }
-
-        i += u8char.size() - 1;
-        str += u8char;
+        for (size_t c = 0; c < char_len; c++) {
+          out[len++] = char(uint8_t(ids[i + c] - _utf8_id_offset));
+        }
+        i += char_len - 1;
         continue;
       }
 
-      std::string s = IdToToken(ids[i]);
-      if (s.empty()) {
+      if (!_vocab.has(ids[i]) || _vocab.length(ids[i]) == 0) {
         return false;
       }
-      str += s;
+      const size_t token_len = _vocab.length(ids[i]);
+      if ((len + token_len) > cap) {
+        return false;
+      }
+      memcpy(out + len, _vocab.data(ids[i]), token_len);
+      len += token_len;
     }
-    dst = str;
+    out_len = len;
     return true;
   }
 
+  bool decode(const std::vector<int32_t>& ids, std::string &dst) {
+    if (!_slot_table.empty()) {
+      return _slot_table.decode(ids.data(), ids.size(), dst);
+    }
+
+    // pass 1: compute exact output size. pass 2: copy tokens.
+    size_t len{0};
+    if (!decoded_length(ids.data(), ids.size(), len)) {
+      return false;
+    }
+
+    dst.resize(len);
+    if (len == 0) {
+      return true;
+    }
+    return decode_into(ids.data(), ids.size(), &dst[0], len, len);
+  }
+
   size_t GetVocabSize() {
-    auto size = _idx2word.size();
+    auto size = _vocab.size();
     RV_CHECK(size > 0);
     return size;
   }
 
   virtual std::string IdToToken(int32_t token_id) {
-    RV_CHECK(_idx2word.size() > 0);
-    auto it = _idx2word.find(token_id);
-    if (it == _idx2word.end()) {
+    RV_CHECK(_vocab.size() > 0);
+    if (!_vocab.has(token_id)) {
       return "";
-    } else {
-      return it->second;
     }
+    return _vocab.token(token_id);
   }
 
   int32_t TokenToId(const std::string& token) {
-    RV_CHECK(_word2idx.size() > 0);
-    auto it = _word2idx.find(token);
-    if (it == _word2idx.end()) {
-      return -1;
-    } else {
-      return it->second;
-    }
+    RV_CHECK(_vocab.size() > 0);
+    return _tree->find_exact(token.data(), token.size());
+  }
+
+  // Bytes held by this tokenizer, by component.
+  MemoryUsage memory_usage() const {
+    MemoryUsage usage;
+    usage.add("instance", sizeof(*this));
+    usage.add("trie nodes", _tree ? sizeof(TrieTree) + _tree->node_bytes() : 0);
+    usage.add("trie labels", _tree ? _tree->label_bytes() : 0);
+    usage.add("vocab strings", _vocab.string_bytes());
+    usage.add("vocab offsets", _vocab.offset_bytes());
+    usage.add("slot decode table", _slot_table.memory_usage());
+    return usage;
   }
 
  private:
-  
+  // Appends to `dst`.
+  bool encode_utf8(const char *str, const size_t str_len, std::vector<int32_t> &dst) {
+    size_t str_idx = 0;
+    while (str_idx < str_len) {
+      int token_id = -1;
+      const size_t len = _tree->find_longest_prefix_length(str, str_idx, str_len, token_id);
+      if (len == 0) {
+        // UTF-8 byte fallback
+        // Should be single UTF-8 character
+        const size_t char_len = utf8_len(str[str_idx]);
+        if (char_len == 0 || str_idx + char_len > str_len) {
+          // Found invalid UTF-8 string.
+          return false;
+        }
+        for (size_t c = 0; c < char_len; c++) {
+          dst.push_back(int(uint8_t(str[str_idx + c])) +
+                        _utf8_id_offset);
+        }
+        str_idx += char_len;
+      } else {
+        dst.push_back(token_id);
+        str_idx += len;
+      }
+    }
+    return true;
+  }
+
   int _empty_str_id{0};
 
-  inline uint32_t utf8_len(const uint8_t c) {
+  inline uint32_t utf8_len(const uint8_t c) const {
     if (c <= 127) {
       // ascii
       return 1;
@@ -256,41 +508,37 @@ class TrieTokenizer {
     return 0;
   }
 
-  // Reconstruct UTF-8 bytes from int sequence(UTF-8 encoded)
-  inline bool utf8_char_from_ids(const int *addr, size_t loc, size_t n,
-                                 std::string &str, int id_offset = 1) {
+  // Byte length of the UTF-8 character reconstructed from byte fallback ids
+  // starting at `loc`. Returns 0 when the ids do not form a valid sequence.
+  inline uint32_t utf8_len_from_ids(const int *addr, size_t loc, size_t n,
+                                    int id_offset = 1) const {
     if (loc >= n) {
-      return false;
+      return 0;
     }
 
     int start_c = addr[loc] - id_offset;
     if ((start_c < 0) || (start_c > 255)) {
-      return false;
+      return 0;
     }
 
     uint32_t len = utf8_len(uint8_t(start_c));
 
     if (len == 0) {
-      return false;
+      return 0;
     }
 
     if ((loc + len) > n) {
-      return false;
+      return 0;
     }
 
-    str = "";
-    std::vector<uint8_t> buf;
-    for (size_t i = 0; i < len; i++) {
+    for (size_t i = 1; i < len; i++) {
       int ic = addr[loc + i] - id_offset;
       if ((ic < 0) || (ic > 255)) {
-        return false;
+        return 0;
       }
-      buf.push_back(uint8_t(ic));
     }
 
-    str = std::string(reinterpret_cast<const char *>(buf.data()), buf.size());
-
-    return true;
+    return len;
   }
 
   inline std::string extract_utf8_char(const std::string &str, uint32_t start_i,
@@ -338,9 +586,9 @@ class TrieTokenizer {
   std::stringstream _err_ss;
 
   // the tokenizer
-  std::unordered_map<std::string, int> _word2idx;
-  std::unordered_map<int, std::string> _idx2word;
-  std::unique_ptr<TrieTree> _tree;
+  VocabStore _vocab;  // id -> token
+  std::unique_ptr<TrieTree> _tree;  // token -> id
+  SlotDecodeTable _slot_table;
 
   int _utf8_id_offset{1};
 
@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vocab_store.hh"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace nanotokenizer {
+
+// id -> token bytes table for fast decoding.
+//
+// Each id owns a 16 byte slot. Tokens up to 15 bytes are stored inline and
+// byte 15 of the slot holds the length, so decoding a token is one 16 byte
+// load/store plus a pointer bump. Longer tokens are stored in `_pool` and
+// the slot holds (offset, length) to it.
+class SlotDecodeTable {
+ public:
+  static constexpr size_t kSlotSize = 16;
+  static constexpr uint8_t kMaxInlineLen = 15;
+
+  // Tags stored in slot byte 15 besides inline length [1, 15].
+  static constexpr uint8_t kInvalid = 0;
+  static constexpr uint8_t kOverflow = 0xFF;
+  static constexpr uint8_t kByteFallback = 0xFE;
+
+  // `byte_id_begin`/`byte_id_end`: [begin, end) range of UTF-8 byte fallback
+  // ids. byte value = id - `id_offset`.
+  bool build(const std::unordered_map<int, std::string> &id_to_str,
+             int byte_id_begin, int byte_id_end, int id_offset) {
+    int max_id = byte_id_end - 1;
+    for (const auto &it : id_to_str) {
+      if (it.first < 0) {
+        return false;
+      }
+      max_id = (std::max)(max_id, it.first);
+    }
+    if (max_id < 0) {
+      return false;
+    }
+
+    init(size_t(max_id) + 1, id_offset);
+    for (const auto &it : id_to_str) {
+      set_token(it.first, it.second.data(), it.second.size());
+    }
+    set_byte_fallback(byte_id_begin, byte_id_end);
+    return true;
+  }
+
+  bool build(const VocabStore &vocab, int byte_id_begin, int byte_id_end,
+             int id_offset) {
+    const int max_id = (std::max)(byte_id_end, int(vocab.id_end())) - 1;
+    if (max_id < 0) {
+      return false;
+    }
+
+    init(size_t(max_id) + 1, id_offset);
+    for (int id = 0; id < int(vocab.id_end()); id++) {
+      if (vocab.has(id)) {
+        set_token(id, vocab.data(id), vocab.length(id));
+      }
+    }
+    set_byte_fallback(byte_id_begin, byte_id_end);
+    return true;
+  }
+
+  bool empty() const { return _num_ids == 0; }
+
+  // Same contract as the tokenizer's `decoded_length`.
+  bool decoded_length(const int *ids, size_t n, size_t &len) const {
+    len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((ids[i] < 0) || (size_t(ids[i]) >= _num_ids)) {
+        return false;
+      }
+      const uint8_t *slot = &_slots[size_t(ids[i]) * kSlotSize];
+      const uint8_t tag = slot[15];
+      if (tag <= kMaxInlineLen) {
+        if (tag == kInvalid) {
+          return false;
+        }
+        len += tag;
+      } else if (tag == kOverflow) {
+        uint32_t slen;
+        memcpy(&slen, slot + 4, sizeof(uint32_t));
+        len += slen;
+      } else {
+        uint32_t char_len = utf8_len_from_ids(ids, i, n);
+        if (char_len == 0) {
+          return false;
+        }
+        i += char_len - 1;
+        len += char_len;
+      }
+    }
+    return true;
+  }
+
+  // Same contract as the tokenizer's `decode_into`.
+  bool decode_into(const int *ids, size_t n, char *out, size_t cap,
+                   size_t &out_len) const {
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if ((ids[i] < 0) || (size_t(ids[i]) >= _num_ids)) {
+        return false;
+      }
+      const uint8_t *slot = &_slots[size_t(ids[i]) * kSlotSize];
+      const uint8_t tag = slot[15];
+      if (tag <= kMaxInlineLen) {
+        if (tag == kInvalid) {
+          return false;
+        }
+        if ((len + kSlotSize) <= cap) {
+          // Copy whole slot. Trailing bytes are overwritten by the next token.
+          copy16(out + len, slot);
+        } else if ((len + tag) <= cap) {
+          memcpy(out + len, slot, tag);
+        } else {
+          return false;
+        }
+        len += tag;
+      } else if (tag == kOverflow) {
+        uint32_t offset, slen;
+        memcpy(&offset, slot, sizeof(uint32_t));
+        memcpy(&slen, slot + 4, sizeof(uint32_t));
+        if ((len + slen) > cap) {
+          return false;
+        }
+        memcpy(out + len, _pool.data() + offset, slen);
+        len += slen;
+      } else {
+        uint32_t char_len = utf8_len_from_ids(ids, i, n);
+        if ((char_len == 0) || ((len + char_len) > cap)) {
+          return false;
+        }
+        for (size_t c = 0; c < char_len; c++) {
+          out[len++] = char(uint8_t(ids[i + c] - _id_offset));
+        }
+        i += char_len - 1;
+      }
+    }
+    out_len = len;
+    return true;
+  }
+
+  // Single pass decode into `out`(resized to the decoded length). `out` is
+  // grown as needed instead of measured first, so each slot is read once.
+  // `decoded_length` + `decode_into` spend about 40% in the length pass.
+  bool decode(const int *ids, size_t n, std::string &out) const {
+    // room for the longest token(or a byte fallback character) at `len`.
+    const size_t room = (std::max)(kSlotSize, _max_overflow_len);
+    if (out.size() < n + room) {
+      out.resize(n + room);  // at least 1 byte per id
+    }
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+      if (out.size() < len + room) {
+        out.resize(2 * out.size());
+      }
+      if ((ids[i] < 0) || (size_t(ids[i]) >= _num_ids)) {
+        out.clear();
+        return false;
+      }
+      const uint8_t *slot = &_slots[size_t(ids[i]) * kSlotSize];
+      const uint8_t tag = slot[15];
+      if (tag <= kMaxInlineLen) {
+        if (tag == kInvalid) {
+          out.clear();
+          return false;
+        }
+        copy16(&out[len], slot);
+        len += tag;
+      } else if (tag == kOverflow) {
+        uint32_t offset, slen;
+        memcpy(&offset, slot, sizeof(uint32_t));
+        memcpy(&slen, slot + 4, sizeof(uint32_t));
+        memcpy(&out[len], _pool.data() + offset, slen);
+        len += slen;
+      } else {
+        uint32_t char_len = utf8_len_from_ids(ids, i, n);
+        if (char_len == 0) {
+          out.clear();
+          return false;
+        }
+        for (size_t c = 0; c < char_len; c++) {
+          out[len++] = char(uint8_t(ids[i + c] - _id_offset));
+        }
+        i += char_len - 1;
+      }
+    }
+    out.resize(len);
+    return true;
+  }
+
+  // Bytes used by the table, 0 when it is not built. An empty `_pool` only
+  // has its inline(small string) capacity.
+  size_t memory_usage() const {
+    if (empty()) {
+      return 0;
+    }
+    return _slots.capacity() + (_pool.empty() ? 0 : _pool.capacity());
+  }
+
+ private:
+  void init(size_t num_ids, int id_offset) {
+    _num_ids = num_ids;
+    _slots.assign(_num_ids * kSlotSize, 0);
+    _pool.clear();
+    _max_overflow_len = 0;
+    _id_offset = id_offset;
+  }
+
+  void set_token(int id, const char *str, size_t len) {
+    if (len == 0) {
+      return;
+    }
+    uint8_t *slot = &_slots[size_t(id) * kSlotSize];
+    if (len <= kMaxInlineLen) {
+      memcpy(slot, str, len);
+      slot[15] = uint8_t(len);
+    } else {
+      uint32_t offset = uint32_t(_pool.size());
+      uint32_t len32 = uint32_t(len);
+      _pool.append(str, len);
+      _max_overflow_len = (std::max)(_max_overflow_len, len);
+      memcpy(slot, &offset, sizeof(uint32_t));
+      memcpy(slot + 4, &len32, sizeof(uint32_t));
+      slot[15] = kOverflow;
+    }
+  }
+
+  void set_byte_fallback(int byte_id_begin, int byte_id_end) {
+    for (int id = (std::max)(0, byte_id_begin); id < byte_id_end; id++) {
+      _slots[size_t(id) * kSlotSize + 15] = kByteFallback;
+    }
+  }
+
+  size_t _num_ids{0};
+  std::vector<uint8_t> _slots;
+  std::string _pool;  // storage for tokens longer than kMaxInlineLen
+  size_t _max_overflow_len{0};
+  int _id_offset{1};
+
+  static inline void copy16(char *dst, const uint8_t *src) {
+#if defined(__SSE2__) || defined(_M_X64)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(src)));
+#elif defined(__ARM_NEON)
+    vst1q_u8(reinterpret_cast<uint8_t *>(dst), vld1q_u8(src));
+#else
+    memcpy(dst, src, kSlotSize);
+#endif
+  }
+
+  static inline uint32_t utf8_len(const uint8_t c) {
+    if (c <= 127) {
+      // ascii
+      return 1;
+    } else if ((c & 0xE0) == 0xC0) {
+      return 2;
+    } else if ((c & 0xF0) == 0xE0) {
+      return 3;
+    } else if ((c & 0xF8) == 0xF0) {
+      return 4;
+    }
+
+    // invalid
+    return 0;
+  }
+
+  // Byte length of the UTF-8 character reconstructed from byte fallback ids
+  // starting at `loc`. Returns 0 when the ids do not form a valid sequence.
+  inline uint32_t utf8_len_from_ids(const int *addr, size_t loc, size_t n) const {
+    int start_c = addr[loc] - _id_offset;
+    if ((start_c < 0) || (start_c > 255)) {
+      return 0;
+    }
+
+    uint32_t len = utf8_len(uint8_t(start_c));
+    if ((len == 0) || ((loc + len) > n)) {
+      return 0;
+    }
+
+    for (size_t i = 1; i < len; i++) {
+      int ic = addr[loc + i] - _id_offset;
+      if ((ic < 0) || (ic > 255)) {
+        return 0;
+      }
+    }
+
+    return len;
+  }
+};
+
+} // namespace nanotokenizer
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace nanotokenizer {
+
+// Segment of text: a special token(`special_id` >= 0) or plain text(-1).
+struct TextSegment {
+  size_t offset;
+  size_t length;
+  int special_id;
+};
+
+// Carves special tokens(`<|endoftext|>`, chat role markers, ...) out of
+// text in one left-to-right pass, so that only plain text goes to the
+// tokenizer backend or pretokenizer.
+//
+// Tokens are stored in a byte trie with dense transitions over byte
+// classes(bytes that occur in no token share class 0). Only positions
+// whose byte starts some token are tried; when all tokens start with the
+// same byte(e.g. '<') those are found with memchr. Matching is
+// leftmost-longest, as in HuggingFace added tokens. The work per
+// candidate position is bounded by the longest token.
+class SpecialTokenMatcher {
+ public:
+  SpecialTokenMatcher() { clear(); }
+
+  void clear() {
+    _tokens.clear();
+    _ids.clear();
+    _num_classes = 1;
+    memset(_byte_class, 0, sizeof(_byte_class));
+    memset(_first_byte, 0, sizeof(_first_byte));
+    _num_first_bytes = 0;
+    _next.assign(1, -1);
+    _state_id.assign(1, -1);
+  }
+
+  // Register `token`. Call `build` after the last `add`.
+  bool add(const std::string &token, int id, std::string &err) {
+    if (token.empty()) {
+      err += "Empty special token.\n";
+      return false;
+    }
+    if (id < 0) {
+      err += "Negative id for special token: " + token + "\n";
+      return false;
+    }
+    for (const auto &t : _tokens) {
+      if (t == token) {
+        err += "Duplicated special token: " + token + "\n";
+        return false;
+      }
+    }
+    _tokens.push_back(token);
+    _ids.push_back(id);
+    return true;
+  }
+
+  void build() {
+    // byte classes
+    _num_classes = 1;
+    memset(_byte_class, 0, sizeof(_byte_class));
+    memset(_first_byte, 0, sizeof(_first_byte));
+    _num_first_bytes = 0;
+    for (const auto &t : _tokens) {
+      for (const char c : t) {
+        uint8_t &cls = _byte_class[uint8_t(c)];
+        if (cls == 0) {
+          cls = uint8_t(_num_classes++);
+        }
+      }
+      if (!_first_byte[uint8_t(t[0])]) {
+        _first_byte[uint8_t(t[0])] = 1;
+        _num_first_bytes++;
+        _single_first_byte = t[0];
+      }
+    }
+
+    // trie
+    _next.assign(_num_classes, -1);
+    _state_id.assign(1, -1);
+    for (size_t i = 0; i < _tokens.size(); i++) {
+      int32_t state = 0;
+      for (const char c : _tokens[i]) {
+        int32_t &next = _next[size_t(state) * _num_classes + _byte_class[uint8_t(c)]];
+        if (next < 0) {
+          next = int32_t(_state_id.size());
+          _state_id.push_back(-1);
+          _next.resize(_next.size() + _num_classes, -1);
+        }
+        state = _next[size_t(state) * _num_classes + _byte_class[uint8_t(c)]];
+      }
+      _state_id[size_t(state)] = _ids[i];
+    }
+  }
+
+  size_t size() const { return _tokens.size(); }
+
+  // Longest special token starting at `text`. Returns its length(0: none)
+  // and stores its id to `id`.
+  size_t match(const char *text, size_t size, int &id) const {
+    size_t best = 0;
+    int32_t state = 0;
+    for (size_t i = 0; i < size; i++) {
+      const uint8_t cls = _byte_class[uint8_t(text[i])];
+      if (cls == 0) {
+        break;
+      }
+      state = _next[size_t(state) * _num_classes + cls];
+      if (state < 0) {
+        break;
+      }
+      if (_state_id[size_t(state)] >= 0) {
+        best = i + 1;
+        id = _state_id[size_t(state)];
+      }
+    }
+    return best;
+  }
+
+  // Split `text` into special-token and plain-text segments(in order,
+  // covering all of `text`).
+  void partition(const char *text, size_t size,
+                 std::vector<TextSegment> &segments) const {
+    segments.clear();
+    if (_tokens.empty()) {
+      if (size) {
+        segments.push_back({0, size, -1});
+      }
+      return;
+    }
+
+    size_t plain_start = 0;
+    size_t i = 0;
+    while (i < size) {
+      i = find_candidate(text, i, size);
+      if (i >= size) {
+        break;
+      }
+      int id = -1;
+      const size_t len = match(text + i, size - i, id);
+      if (len == 0) {
+        i++;
+        continue;
+      }
+      if (i > plain_start) {
+        segments.push_back({plain_start, i - plain_start, -1});
+      }
+      segments.push_back({i, len, id});
+      i += len;
+      plain_start = i;
+    }
+    if (size > plain_start) {
+      segments.push_back({plain_start, size - plain_start, -1});
+    }
+  }
+
+ private:
+  // First position >= `pos` whose byte starts a special token.
+  size_t find_candidate(const char *text, size_t pos, size_t size) const {
+    if (_num_first_bytes == 1) {
+      const void *p = memchr(text + pos, _single_first_byte, size - pos);
+      return p ? size_t(static_cast<const char *>(p) - text) : size;
+    }
+    while (pos < size && !_first_byte[uint8_t(text[pos])]) {
+      pos++;
+    }
+    return pos;
+  }
+
+  std::vector<std::string> _tokens;
+  std::vector<int> _ids;
+
+  uint8_t _byte_class[256];
+  uint32_t _num_classes{1};
+  uint8_t _first_byte[256];
+  uint32_t _num_first_bytes{0};
+  char _single_first_byte{0};
+
+  std::vector<int32_t> _next;      // [state * _num_classes + class], -1: none
+  std::vector<int> _state_id;      // token id ending at state, -1: none
+};
+
+// Encode `text` with special tokens recognized by `matcher`. Plain
+// segments are encoded by `encode_plain(const std::string &, std::vector<int> &)`,
+// e.g. a lambda calling `tokenizer.encode`. Ids are appended to `ids`.
+template <class EncodeFn>
+bool encode_with_special_tokens(const SpecialTokenMatcher &matcher,
+                                const std::string &text, std::vector<int> &ids,
+                                const EncodeFn &encode_plain) {
+  std::vector<TextSegment> segments;
+  matcher.partition(text.data(), text.size(), segments);
+
+  std::string plain;
+  std::vector<int> plain_ids;
+  for (const auto &seg : segments) {
+    if (seg.special_id >= 0) {
+      ids.push_back(seg.special_id);
+      continue;
+    }
+    plain.assign(text, seg.offset, seg.length);
+    plain_ids.clear();
+    if (!encode_plain(plain, plain_ids)) {
+      return false;
+    }
+    ids.insert(ids.end(), plain_ids.begin(), plain_ids.end());
+  }
+  return true;
+}
+
+} // namespace nanotokenizer
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace nanotokenizer {
+
+// id -> token bytes, the one copy of the vocab strings of a backend.
+//
+// Tokens are stored back to back in one pool in id order; the token of
+// `id` is [_offsets[id], _offsets[id + 1]). Token -> id is answered by the
+// backend's trie, which can point into the pool instead of owning copies.
+class VocabStore {
+ public:
+  // Store the tokens of `str_to_id` for which `keep(token, id)` is true.
+  // Fails when two kept tokens share an id.
+  template <class KeepFn>
+  bool build(const std::map<std::string, int> &str_to_id, const KeepFn &keep,
+             std::string &err) {
+    clear();
+
+    int max_id = -1;
+    size_t total = 0;
+    for (const auto &it : str_to_id) {
+      if (!keep(it.first, it.second)) {
+        continue;
+      }
+      if (it.second < 0) {
+        err += "Negative vocab id: " + std::to_string(it.second) + "\n";
+        return false;
+      }
+      max_id = (std::max)(max_id, it.second);
+      total += it.first.size();
+    }
+    if (total > 0xFFFFFFFFu) {
+      err += "Vocab too large.\n";
+      return false;
+    }
+
+    // lengths first, then offsets by prefix sum.
+    const uint32_t absent = 0xFFFFFFFFu;
+    std::vector<uint32_t> lengths(size_t(max_id + 1), absent);
+    for (const auto &it : str_to_id) {
+      if (!keep(it.first, it.second)) {
+        continue;
+      }
+      if (lengths[size_t(it.second)] != absent) {
+        err += "Duplicated vocab id: " + std::to_string(it.second) + "\n";
+        return false;
+      }
+      lengths[size_t(it.second)] = uint32_t(it.first.size());
+      if (it.first.empty()) {
+        _empty_id = it.second;
+      }
+      _num_tokens++;
+    }
+
+    _offsets.resize(lengths.size() + 1);
+    uint32_t offset = 0;
+    for (size_t id = 0; id < lengths.size(); id++) {
+      _offsets[id] = offset;
+      offset += (lengths[id] == absent) ? 0 : lengths[id];
+    }
+    _offsets[lengths.size()] = offset;
+
+    _pool.resize(offset);
+    for (const auto &it : str_to_id) {
+      if (keep(it.first, it.second) && !it.first.empty()) {
+        memcpy(_pool.data() + _offsets[size_t(it.second)], it.first.data(),
+               it.first.size());
+      }
+    }
+    return true;
+  }
+
+  void clear() {
+    _pool.clear();
+    _offsets.clear();
+    _num_tokens = 0;
+    _empty_id = -1;
+  }
+
+  bool has(int id) const {
+    return (id >= 0) && (size_t(id) + 1 < _offsets.size()) &&
+           ((_offsets[size_t(id) + 1] != _offsets[size_t(id)]) ||
+            (id == _empty_id));
+  }
+
+  // Token bytes of `id`. `has(id)` must be true.
+  const char *data(int id) const { return _pool.data() + _offsets[size_t(id)]; }
+  size_t length(int id) const {
+    return _offsets[size_t(id) + 1] - _offsets[size_t(id)];
+  }
+  std::string token(int id) const { return std::string(data(id), length(id)); }
+
+  // Number of tokens.
+  size_t size() const { return _num_tokens; }
+
+  // One past the largest id.
+  size_t id_end() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+
+  size_t string_bytes() const { return _pool.capacity(); }
+  size_t offset_bytes() const { return _offsets.capacity() * sizeof(uint32_t); }
+  size_t memory_usage() const { return string_bytes() + offset_bytes(); }
+
+ private:
+  std::vector<char> _pool;
+  std::vector<uint32_t> _offsets;
+  size_t _num_tokens{0};
+  int _empty_id{-1};
+};
+
+} // namespace nanotokenizer
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache 2.0
+// Copyright 2024 - Present, Light Transport Entertainment, Inc.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "special_tokens.hh"
+
+namespace nanotokenizer {
+
+// Scratch memory of encode calls: an arena for per-call temporaries plus
+// reusable output vectors. Keep one per thread and pass it to the
+// backends' `encode(text, Workspace &)`. `reset` keeps all memory, so once
+// the workspace has seen the largest input, calls do no allocation.
+//
+// Not thread-safe.
+class Workspace {
+ public:
+  Workspace() = default;
+  Workspace(const Workspace &) = delete;
+  Workspace &operator=(const Workspace &) = delete;
+
+  // Token ids. `encode_append` appends here.
+  std::vector<int> ids;
+
+  // Special-token partition(see `encode_with_special_tokens`).
+  std::vector<TextSegment> segments;
+
+  // Uninitialized storage for `n` objects of trivially copyable `T`.
+  // Valid until `reset`.
+  template <class T>
+  T *alloc(size_t n) {
+    const size_t align = alignof(T);
+    const size_t bytes = n * sizeof(T);
+    size_t offset = (_used + align - 1) & ~(align - 1);
+    if (offset + bytes > _block_size) {
+      // Spill to a block of its own. `reset` grows the main block so that
+      // the next call of this size fits.
+      _spill.emplace_back(new char[bytes ? bytes : 1]);
+      _spill_bytes += bytes + align;
+      return reinterpret_cast<T *>(_spill.back().get());
+    }
+    _used = offset + bytes;
+    return reinterpret_cast<T *>(_block.get() + offset);
+  }
+
+  // Clear `ids`, `segments` and the arena.
+  void reset() {
+    ids.clear();
+    segments.clear();
+    if (!_spill.empty()) {
+      _block_size = _used + _spill_bytes;
+      _block.reset(new char[_block_size]);
+      _spill.clear();
+      _spill_bytes = 0;
+    }
+    _used = 0;
+  }
+
+  // Bytes held, including vector capacity.
+  size_t memory_usage() const {
+    return _block_size + _spill_bytes + ids.capacity() * sizeof(int) +
+           segments.capacity() * sizeof(TextSegment);
+  }
+
+ private:
+  std::unique_ptr<char[]> _block;
+  size_t _block_size{0};
+  size_t _used{0};
+  std::vector<std::unique_ptr<char[]>> _spill;
+  size_t _spill_bytes{0};
+};
+
+// Encode `text` with special tokens recognized by `matcher` into `ws.ids`,
+// without allocating in steady state. Plain segments are appended by
+// `encode_plain(const char *, size_t, Workspace &)`, e.g. a lambda calling
+// `tokenizer.encode_append`.
+template <class EncodeFn>
+bool encode_with_special_tokens(const SpecialTokenMatcher &matcher,
+                                const char *text, size_t size, Workspace &ws,
+                                const EncodeFn &encode_plain) {
+  ws.reset();
+  matcher.partition(text, size, ws.segments);
+  for (size_t i = 0; i < ws.segments.size(); i++) {
+    const TextSegment seg = ws.segments[i];
+    if (seg.special_id >= 0) {
+      ws.ids.push_back(seg.special_id);
+    } else if (!encode_plain(text + seg.offset, seg.length, ws)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace nanotokenizer